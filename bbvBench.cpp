@@ -0,0 +1,318 @@
+/*
+ *  Microbenchmarks of the BBV pipeline of bbvCore, without Pin. Each
+ *  benchmark runs its loop with more iterations until it takes the
+ *  minimum time, then reports the time per iteration and per item, the
+ *  way Google Benchmark does, so kernels can be tuned without running
+ *  an instrumented application.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+#include "bbvCore.h"
+#include "bbvFormat.h"
+
+/* what a benchmark gets: its arguments and the iterations to run */
+struct State
+{
+    std::vector<int64_t> args;
+    uint64_t iterations;
+    /* the items (events, BBs, records) done by one iteration */
+    uint64_t items;
+    std::chrono::steady_clock::time_point begin, pauseBegin;
+    /* the time between pauseTimer and resumeTimer, taken off the run */
+    std::chrono::steady_clock::duration paused;
+
+    int64_t arg(int i) const { return args[i]; }
+
+    /* the setup before this call is not timed */
+    void startTimer()
+    {
+        paused = std::chrono::steady_clock::duration::zero();
+        begin = std::chrono::steady_clock::now();
+    }
+
+    /* pause around the refills of a batch, not around every item */
+    void pauseTimer() { pauseBegin = std::chrono::steady_clock::now(); }
+    void resumeTimer() { paused += std::chrono::steady_clock::now() - pauseBegin; }
+};
+
+struct Benchmark
+{
+    std::string name;
+    void (*fn)(State &);
+    std::vector<int64_t> args;
+};
+
+/* keep the compiler from dropping a result */
+static volatile int64_t Sink;
+
+/* BB IDs of a loop-dominated run, a few hot BBs and a cold tail */
+static std::vector<UINT32> makeIds(size_t n, UINT32 numBBs, uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<UINT32> ids(n);
+    for (size_t i = 0; i < n; ++i)
+        ids[i] = (rng() & 3) ? (UINT32)(rng() % 16) % numBBs : (UINT32)(rng() % numBBs);
+    return ids;
+}
+
+/* SparseBBV::sample, arg: the number of BBs */
+static void benchSample(State & st)
+{
+    SparseBBV bbv;
+    bbv.grow(st.arg(0));
+    std::vector<UINT32> ids = makeIds(1 << 16, st.arg(0), 1);
+    st.startTimer();
+    for (uint64_t n = 0; n < st.iterations; ++n)
+        for (size_t i = 0; i < ids.size(); ++i)
+            bbv.sample(ids[i], 5);
+    Sink = bbv.samples;
+    st.items = ids.size();
+}
+
+/* the dense Histogram the BBVs were kept in before, arg: the number of BBs */
+static void benchHistogram(State & st)
+{
+    Histogram<> h(st.arg(0));
+    std::vector<UINT32> ids = makeIds(1 << 16, st.arg(0), 1);
+    st.startTimer();
+    for (uint64_t n = 0; n < st.iterations; ++n)
+        for (size_t i = 0; i < ids.size(); ++i)
+            h.sample(ids[i], 5);
+    Sink = h.samples;
+    st.items = ids.size();
+}
+
+/* clear an interval, the fill is not timed, args: the touched BBs, the number of BBs */
+static void benchClear(State & st)
+{
+    const uint64_t batch = 4;
+    std::vector<SparseBBV> bbvs(batch);
+    for (uint64_t b = 0; b < batch; ++b)
+        bbvs[b].grow(st.arg(1));
+    st.startTimer();
+    for (uint64_t n = 0; n < st.iterations; ) {
+        uint64_t num = std::min(batch, st.iterations - n);
+        st.pauseTimer();
+        for (uint64_t b = 0; b < num; ++b)
+            for (int64_t id = 0; id < st.arg(0); ++id)
+                bbvs[b].sample(id * (st.arg(1) / st.arg(0)), 1);
+        st.resumeTimer();
+        for (uint64_t b = 0; b < num; ++b)
+            bbvs[b].clear();
+        n += num;
+    }
+    st.items = st.arg(0);
+}
+
+/* projectBBV of an interval, args: K, the touched BBs, the matrix: 0 dense, 1 sparse, 2 fixed-point, the ProjIsa */
+static void benchProject(State & st)
+{
+    const int k = st.arg(0);
+    const UINT32 touched = st.arg(1);
+    ProjMatrix m;
+    m.init(k, 1, st.arg(2) == 1, st.arg(2) == 2);
+    m.setIsa((ProjIsa)st.arg(3));
+    for (UINT32 id = 0; id < touched; ++id)
+        m.addColumn(id, id);
+
+    /* projectBBV clears its BBV, a batch of them is filled untimed */
+    const uint64_t batch = std::max<uint64_t>(1, 65536 / touched);
+    std::vector<SparseBBV> bbvs(batch);
+    for (uint64_t b = 0; b < batch; ++b)
+        bbvs[b].grow(touched);
+    std::vector<double> accu(k);
+    Histogram<> intAccu(k);
+    st.startTimer();
+    for (uint64_t n = 0; n < st.iterations; ) {
+        uint64_t num = std::min(batch, st.iterations - n);
+        st.pauseTimer();
+        for (uint64_t b = 0; b < num; ++b)
+            for (UINT32 id = 0; id < touched; ++id)
+                bbvs[b].sample(id, id + 1);
+        st.resumeTimer();
+        for (uint64_t b = 0; b < num; ++b)
+            projectBBV(bbvs[b], m, accu.data(), intAccu);
+        n += num;
+    }
+    Sink = (int64_t)accu[0];
+    st.items = touched;
+}
+
+/* BBVWriter to /dev/null, args: the record format, compress */
+static void benchWrite(State & st)
+{
+    BBVHeader hdr;
+    hdr.k = 16;
+    hdr.format = st.arg(0);
+    hdr.compress = st.arg(1);
+    BBVWriter out;
+    out.open("/dev/null", hdr);
+
+    std::mt19937_64 rng(1);
+    std::vector<double> recs(1024 * hdr.k);
+    for (size_t i = 0; i < recs.size(); ++i)
+        recs[i] = (double)(int64_t)(rng() % 200000) - 100000;
+    st.startTimer();
+    for (uint64_t n = 0; n < st.iterations; ++n)
+        for (size_t r = 0; r < 1024; ++r)
+            out.write(0, &recs[r * hdr.k]);
+    out.close();
+    st.items = 1024;
+}
+
+/* ReuseDist::access, args: the lines of the footprint, sampling bits */
+static void benchReuseDist(State & st)
+{
+    ReuseDist rd;
+    rd.init(64, st.arg(1), 2048);
+    std::mt19937_64 rng(1);
+    std::vector<ADDRINT> addrs(1 << 16);
+    for (size_t i = 0; i < addrs.size(); ++i)
+        addrs[i] = (i & 1) ? (rng() % st.arg(0)) * 64 : i * 8;
+    st.startTimer();
+    for (uint64_t n = 0; n < st.iterations; ++n)
+        for (size_t i = 0; i < addrs.size(); ++i)
+            rd.access(addrs[i]);
+    Sink = rd.hist.samples;
+    st.items = addrs.size();
+}
+
+static std::vector<Benchmark> benchmarks()
+{
+    std::vector<Benchmark> b;
+    for (int64_t bbs : {1 << 10, 1 << 16, 1 << 20}) {
+        b.push_back({"sample", benchSample, {bbs}});
+        b.push_back({"histogram", benchHistogram, {bbs}});
+    }
+    for (int64_t touched : {64, 1024, 16384})
+        b.push_back({"clear", benchClear, {touched, 1 << 20}});
+    for (int64_t isa = ISA_BASE; isa <= bestIsa(); ++isa)
+        for (int64_t matrix : {0, 1, 2})
+            for (int64_t k : {8, 16, 32, 64})
+                for (int64_t touched : {64, 1024, 16384})
+                    b.push_back({"project", benchProject, {k, touched, matrix, isa}});
+    for (int64_t format : {FMT_TEXT, FMT_FLOAT, FMT_VARINT})
+        for (int64_t compress : {0, 1})
+            if (format != FMT_TEXT || !compress)
+                b.push_back({"write", benchWrite, {format, compress}});
+    for (int64_t lines : {1 << 10, 1 << 20})
+        for (int64_t sample : {0, 4})
+            b.push_back({"reusedist", benchReuseDist, {lines, sample}});
+    return b;
+}
+
+/*
+ * the kernels of every ISA this CPU runs against projectGeneric, for the
+ * K with a kernel of their own and one without; the counts above 2^31
+ * take the split path of the fixed-point kernel. Returns the mismatches.
+ */
+static int checkKernels()
+{
+    const char * matrices[] = {"dense", "sparse", "fixed"};
+    const UINT32 numBBs = 4096;
+    int bad = 0, checked = 0;
+
+    for (int isa = ISA_BASE; isa <= bestIsa(); ++isa)
+        for (int matrix = 0; matrix < 3; ++matrix)
+            for (int k : {8, 16, 24, 32, 64}) {
+                ProjMatrix m;
+                m.init(k, 7, matrix == 1, matrix == 2);
+                m.setIsa((ProjIsa)isa);
+                for (UINT32 id = 0; id < numBBs; ++id)
+                    m.addColumn(id, id * 0x9E3779B97F4A7C15ULL + 1);
+
+                SparseBBV a, b;
+                a.grow(numBBs);
+                b.grow(numBBs);
+                std::vector<double> got(k), want(k);
+                Histogram<> intAccu(k);
+                std::mt19937_64 rng(isa * 100 + matrix * 10 + k);
+                for (int round = 0; round < 4; ++round) {
+                    for (int n = 0; n < 1000; ++n) {
+                        UINT32 id = rng() % numBBs;
+                        int64_t count = (n % 250 == 0) ? (1LL << 33) + (int64_t)(rng() % 1000) : (int64_t)(rng() % 1000000);
+                        a.sample(id, count);
+                        b.sample(id, count);
+                    }
+                    projectBBV(a, m, got.data(), intAccu);
+                    projectGeneric(b, m, want.data(), intAccu);
+                    ++checked;
+                    if (memcmp(got.data(), want.data(), k * sizeof(double)) != 0) {
+                        std::cout << "kernel " << isaName((ProjIsa)isa) << "/" << matrices[matrix] << "/" << k
+                                  << " differs from projectGeneric" << std::endl;
+                        ++bad;
+                    }
+                }
+            }
+
+    std::cout << "checked " << checked << " projections up to " << isaName(bestIsa()) << ", "
+              << bad << " differ from projectGeneric" << std::endl;
+    return bad;
+}
+
+static void usage(const char * name)
+{
+    std::cerr << "usage: " << name << " [options]\n"
+              << "  -filter s    run the benchmarks whose name contains s\n"
+              << "  -t secs      the minimum time of a benchmark (0.2)\n"
+              << "  -check       compare the projection kernels of every ISA to projectGeneric, bit for bit\n";
+    exit(-1);
+}
+
+int main(int argc, char *argv[])
+{
+    std::string filter;
+    double minTime = 0.2;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (i + 1 < argc && arg == "-filter")
+            filter = argv[++i];
+        else if (i + 1 < argc && arg == "-t")
+            minTime = atof(argv[++i]);
+        else if (arg == "-check")
+            return checkKernels() == 0 ? 0 : 1;
+        else
+            usage(argv[0]);
+    }
+
+    std::cout << std::left << std::setw(32) << "Benchmark" << std::right << std::setw(14) << "Time/iter"
+              << std::setw(12) << "Iterations" << std::setw(14) << "ns/item" << "\n"
+              << std::string(72, '-') << std::endl;
+
+    std::vector<Benchmark> all = benchmarks();
+    for (size_t b = 0; b < all.size(); ++b) {
+        std::string name = all[b].name;
+        for (size_t i = 0; i < all[b].args.size(); ++i)
+            name += "/" + std::to_string(all[b].args[i]);
+        if (name.find(filter) == std::string::npos)
+            continue;
+
+        /* grow the iterations until the timed part of a run takes minTime */
+        State st;
+        st.args = all[b].args;
+        double secs = 0;
+        for (st.iterations = 1; ; ) {
+            st.startTimer();
+            all[b].fn(st);
+            secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - st.begin - st.paused).count();
+            if (secs >= minTime || st.iterations >= (1ULL << 40))
+                break;
+            double grow = secs > 0 ? 1.5 * minTime / secs : 10;
+            st.iterations = (uint64_t)(st.iterations * std::max(2.0, std::min(10.0, grow)));
+        }
+
+        double perIter = secs * 1e9 / st.iterations;
+        std::cout << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(11) << perIter << " ns" << std::setw(12) << st.iterations
+                  << std::setw(14) << std::setprecision(3) << perIter / st.items << std::endl;
+    }
+    return 0;
+}
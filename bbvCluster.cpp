@@ -0,0 +1,366 @@
+/*
+ *  SimPoint-style clustering of the BBVs written by bbvTrace. The text or
+ *  binary stream is read, every interval is normalized the way
+ *  Histogram::manhattanDist does (divided by the sum of its absolute
+ *  values), then k-means with k-means++ seeding runs for every k of a
+ *  range. The k is chosen by the BIC, and the interval closest to each
+ *  centroid is a simulation point weighted by the size of its cluster.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <chrono>
+#include <stdlib.h>
+#include "bbvCore.h"
+#include "bbvFormat.h"
+
+/* the distance kernels of -isa */
+static DistKernels Dist;
+
+/* the intervals as a contiguous row-major n x d matrix */
+struct Dataset
+{
+    std::vector<double> rows;
+    size_t n;
+    size_t d;
+
+    const double * row(size_t i) const { return rows.data() + i * d; }
+};
+
+struct Clustering
+{
+    int k;
+    std::vector<double> centers;
+    std::vector<int> assign;
+    std::vector<size_t> sizes;
+    double sse;
+    double bic;
+};
+
+/* run fn(begin, end, t) over [0, n) split among the threads */
+template <class F>
+static void parallelFor(size_t n, int threads, F fn)
+{
+    if (threads <= 1 || n < 1024) {
+        fn(0, n, 0);
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    size_t chunk = (n + threads - 1) / threads;
+    for (int t = 0; t < threads; ++t) {
+        size_t begin = t * chunk, end = std::min(n, begin + chunk);
+        if (begin >= end)
+            break;
+        pool.push_back(std::thread(fn, begin, end, t));
+    }
+    for (size_t t = 0; t < pool.size(); ++t)
+        pool[t].join();
+}
+
+/* the nearest center of x, its squared distance in dist */
+static inline int nearest(const double * x, const std::vector<double> & centers, int k, size_t d, double & dist)
+{
+    int best = 0;
+    dist = std::numeric_limits<double>::max();
+    for (int c = 0; c < k; ++c) {
+        double dd = Dist.sqDist(x, centers.data() + c * d, d);
+        if (dd < dist) {
+            dist = dd;
+            best = c;
+        }
+    }
+    return best;
+}
+
+/* k-means++: each next center is drawn with probability D(x)^2 */
+static void seedCenters(const Dataset & data, int k, std::mt19937_64 & rng, int threads, std::vector<double> & centers)
+{
+    const size_t n = data.n, d = data.d;
+    centers.assign(k * d, 0);
+    std::vector<double> minDist(n, std::numeric_limits<double>::max());
+
+    size_t first = std::uniform_int_distribution<size_t>(0, n - 1)(rng);
+    std::copy(data.row(first), data.row(first) + d, centers.begin());
+
+    for (int c = 1; c < k; ++c) {
+        const double * last = centers.data() + (c - 1) * d;
+        std::vector<double> partial(threads, 0);
+        parallelFor(n, threads, [&](size_t begin, size_t end, int t) {
+            double sum = 0;
+            for (size_t i = begin; i < end; ++i) {
+                minDist[i] = std::min(minDist[i], Dist.sqDist(data.row(i), last, d));
+                sum += minDist[i];
+            }
+            partial[t] = sum;
+        });
+
+        double total = 0;
+        for (int t = 0; t < threads; ++t)
+            total += partial[t];
+
+        /* all the points sit on the centers, any point will do */
+        size_t pick = std::uniform_int_distribution<size_t>(0, n - 1)(rng);
+        if (total > 0) {
+            double r = std::uniform_real_distribution<double>(0, total)(rng);
+            for (size_t i = 0; i < n; ++i) {
+                r -= minDist[i];
+                if (r <= 0) {
+                    pick = i;
+                    break;
+                }
+            }
+        }
+        std::copy(data.row(pick), data.row(pick) + d, centers.begin() + c * d);
+    }
+}
+
+/* lloyd iterations until no point moves or maxIters */
+static Clustering kmeans(const Dataset & data, int k, std::mt19937_64 & rng, int maxIters, int threads)
+{
+    const size_t n = data.n, d = data.d;
+    Clustering r;
+    r.k = k;
+    r.assign.assign(n, -1);
+    seedCenters(data, k, rng, threads, r.centers);
+
+    std::vector<std::vector<double> > sums(threads, std::vector<double>(k * d));
+    std::vector<std::vector<size_t> > counts(threads, std::vector<size_t>(k));
+    std::vector<double> sse(threads);
+    std::vector<size_t> moved(threads);
+
+    /* the last pass only assigns, so assign and sse match the returned centers */
+    for (int iter = 0; ; ++iter) {
+        parallelFor(n, threads, [&](size_t begin, size_t end, int t) {
+            std::fill(sums[t].begin(), sums[t].end(), 0);
+            std::fill(counts[t].begin(), counts[t].end(), 0);
+            sse[t] = 0;
+            moved[t] = 0;
+            for (size_t i = begin; i < end; ++i) {
+                double dist;
+                int c = nearest(data.row(i), r.centers, k, d, dist);
+                if (c != r.assign[i]) {
+                    r.assign[i] = c;
+                    ++moved[t];
+                }
+                sse[t] += dist;
+                ++counts[t][c];
+                const double * x = data.row(i);
+                double * s = sums[t].data() + c * d;
+                for (size_t j = 0; j < d; ++j)
+                    s[j] += x[j];
+            }
+        });
+
+        /* reduce the partial sums of the threads */
+        size_t totalMoved = 0;
+        r.sse = 0;
+        r.sizes.assign(k, 0);
+        std::vector<double> total(k * d, 0);
+        for (int t = 0; t < threads; ++t) {
+            totalMoved += moved[t];
+            r.sse += sse[t];
+            for (int c = 0; c < k; ++c)
+                r.sizes[c] += counts[t][c];
+            for (size_t j = 0; j < k * d; ++j)
+                total[j] += sums[t][j];
+        }
+        if (totalMoved == 0 || iter == maxIters)
+            break;
+
+        /* an empty cluster keeps its center */
+        for (int c = 0; c < k; ++c)
+            if (r.sizes[c] > 0)
+                for (size_t j = 0; j < d; ++j)
+                    r.centers[c * d + j] = total[c * d + j] / r.sizes[c];
+    }
+
+    return r;
+}
+
+/*
+ * the BIC of a spherical gaussian mixture (Pelleg and Moore, as used by
+ * SimPoint), the variance is shared by all dimensions and clusters
+ */
+static double bic(const Clustering & r, size_t n, size_t d)
+{
+    const int k = r.k;
+    if (n <= (size_t)k)
+        return -std::numeric_limits<double>::max();
+
+    double variance = r.sse / ((double)d * (n - k));
+    if (variance <= 0)
+        variance = std::numeric_limits<double>::min();
+
+    double logLike = -0.5 * n * d * log(2 * M_PI * variance) - 0.5 * d * (n - k);
+    for (int c = 0; c < k; ++c)
+        if (r.sizes[c] > 0)
+            logLike += r.sizes[c] * log((double)r.sizes[c] / n);
+
+    double params = (k - 1) + (double)k * d + 1;
+    return logLike - 0.5 * params * log((double)n);
+}
+
+static void usage(const char * name)
+{
+    std::cerr << "usage: " << name << " [options] <BBV stream>\n"
+              << "  -k min:max   the range of k (1:10)\n"
+              << "  -bic f       pick the smallest k scoring f of the BIC range (0.9)\n"
+              << "  -iters n     the max k-means iterations (100)\n"
+              << "  -r n         the k-means++ restarts of each k (5)\n"
+              << "  -seed s      the random seed (1)\n"
+              << "  -j n         the worker threads (all cores)\n"
+              << "  -t tid       the guest thread of the records (0)\n"
+              << "  -isa name    the distance kernels: base, avx2 or avx512 (the widest the CPU runs)\n"
+              << "  -o prefix    write prefix.simpoints and prefix.weights (BBV)\n";
+    exit(-1);
+}
+
+int main(int argc, char *argv[])
+{
+    int minK = 1, maxK = 10, maxIters = 100, restarts = 5;
+    double bicThreshold = 0.9;
+    uint64_t seed = 1;
+    uint32_t tid = 0;
+    ProjIsa isa = bestIsa();
+    int threads = std::max(1U, std::thread::hardware_concurrency());
+    std::string prefix = "BBV", input;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (i + 1 < argc && arg == "-k") {
+            std::string range(argv[++i]);
+            size_t colon = range.find(':');
+            minK = atoi(range.substr(0, colon).c_str());
+            maxK = colon == std::string::npos ? minK : atoi(range.substr(colon + 1).c_str());
+        }
+        else if (i + 1 < argc && arg == "-bic")
+            bicThreshold = atof(argv[++i]);
+        else if (i + 1 < argc && arg == "-iters")
+            maxIters = atoi(argv[++i]);
+        else if (i + 1 < argc && arg == "-r")
+            restarts = atoi(argv[++i]);
+        else if (i + 1 < argc && arg == "-seed")
+            seed = strtoull(argv[++i], nullptr, 10);
+        else if (i + 1 < argc && arg == "-j")
+            threads = atoi(argv[++i]);
+        else if (i + 1 < argc && arg == "-t")
+            tid = atoi(argv[++i]);
+        else if (i + 1 < argc && arg == "-isa") {
+            if (!isaByName(argv[++i], isa))
+                usage(argv[0]);
+        }
+        else if (i + 1 < argc && arg == "-o")
+            prefix = argv[++i];
+        else if (arg[0] != '-' && input.empty())
+            input = arg;
+        else
+            usage(argv[0]);
+    }
+    if (input.empty() || minK < 1 || maxK < minK || threads < 1 || restarts < 1)
+        usage(argv[0]);
+
+    Dist = distKernels(isa);
+    auto start = std::chrono::steady_clock::now();
+
+    /* read and normalize the intervals of thread tid */
+    BBVReader in;
+    if (!in.open(input)) {
+        std::cerr << "cannot read BBV stream " << input << std::endl;
+        exit(-1);
+    }
+
+    Dataset data;
+    data.n = 0;
+    data.d = 0;
+    std::vector<double> v;
+    uint32_t t;
+    while (in.next(v, &t)) {
+        if (t != tid || v.empty())
+            continue;
+        if (data.d == 0)
+            data.d = v.size();
+        if (v.size() != data.d) {
+            std::cerr << "interval " << data.n << " has " << v.size() << " values, expect " << data.d << std::endl;
+            exit(-1);
+        }
+
+        double samples = 0;
+        for (size_t j = 0; j < v.size(); ++j)
+            samples += std::abs(v[j]);
+        for (size_t j = 0; j < v.size(); ++j)
+            data.rows.push_back(samples > 0 ? v[j] / samples : 0);
+        ++data.n;
+    }
+
+    if (data.n == 0) {
+        std::cerr << "no interval of thread " << tid << " in " << input << std::endl;
+        exit(-1);
+    }
+    maxK = std::min<size_t>(maxK, data.n);
+    minK = std::min(minK, maxK);
+
+    /* the best of the restarts for every k */
+    std::mt19937_64 rng(seed);
+    std::vector<Clustering> results;
+    for (int k = minK; k <= maxK; ++k) {
+        Clustering best;
+        best.sse = std::numeric_limits<double>::max();
+        for (int r = 0; r < restarts; ++r) {
+            Clustering c = kmeans(data, k, rng, maxIters, threads);
+            if (c.sse < best.sse)
+                best = c;
+        }
+        best.bic = bic(best, data.n, data.d);
+        std::cout << "k " << k << " sse " << best.sse << " bic " << best.bic << std::endl;
+        results.push_back(best);
+    }
+
+    /* the smallest k whose BIC reaches the threshold of the range */
+    double minBic = results[0].bic, maxBic = results[0].bic;
+    for (size_t i = 1; i < results.size(); ++i) {
+        minBic = std::min(minBic, results[i].bic);
+        maxBic = std::max(maxBic, results[i].bic);
+    }
+    size_t chosen = 0;
+    while (chosen + 1 < results.size() && results[chosen].bic - minBic < bicThreshold * (maxBic - minBic))
+        ++chosen;
+    const Clustering & best = results[chosen];
+
+    /* the interval closest to each centroid represents its cluster */
+    std::vector<size_t> simPoint(best.k, 0);
+    std::vector<double> simDist(best.k, std::numeric_limits<double>::max());
+    for (size_t i = 0; i < data.n; ++i) {
+        int c = best.assign[i];
+        double dd = Dist.sqDist(data.row(i), best.centers.data() + c * data.d, data.d);
+        if (dd < simDist[c]) {
+            simDist[c] = dd;
+            simPoint[c] = i;
+        }
+    }
+
+    std::ofstream points((prefix + ".simpoints").c_str());
+    std::ofstream weights((prefix + ".weights").c_str());
+    if (points.fail() || weights.fail()) {
+        std::cerr << "cannot write " << prefix << ".simpoints/.weights" << std::endl;
+        exit(-1);
+    }
+    for (int c = 0, id = 0; c < best.k; ++c) {
+        /* an empty cluster has no simulation point */
+        if (best.sizes[c] == 0)
+            continue;
+        points << simPoint[c] << " " << id << "\n";
+        weights << (double)best.sizes[c] / data.n << " " << id << "\n";
+        ++id;
+    }
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "intervals " << data.n << " dimensions " << data.d << " chosen k " << best.k
+              << " isa " << isaName(isa) << " time " << secs << "s" << std::endl;
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ *  Convert a BBV stream of bbvTrace between the text format, one line of
+ *  K values per interval as read by the matlab scripts, and the binary
+ *  formats. A binary stream becomes text by default, a text stream has
+ *  no header, its binary copy gets the default interval clock and seed.
+ */
+
+#include <iostream>
+#include <stdlib.h>
+#include "bbvFormat.h"
+
+static void usage(const char * name)
+{
+    std::cerr << "usage: " << name << " [options] <BBV stream> <output>\n"
+              << "  -format f    output format: text, float or varint (text)\n"
+              << "  -compress    compress the frames of a binary output\n";
+    exit(-1);
+}
+
+int main(int argc, char *argv[])
+{
+    std::string format = "text";
+    std::vector<std::string> files;
+    bool compress = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (i + 1 < argc && arg == "-format")
+            format = argv[++i];
+        else if (arg == "-compress")
+            compress = true;
+        else if (arg[0] != '-')
+            files.push_back(arg);
+        else
+            usage(argv[0]);
+    }
+    if (files.size() != 2)
+        usage(argv[0]);
+
+    BBVReader in;
+    if (!in.open(files[0])) {
+        std::cerr << "cannot read BBV stream " << files[0] << std::endl;
+        exit(-1);
+    }
+
+    BBVHeader hdr = in.header();
+    if (format == "text")
+        hdr.format = FMT_TEXT;
+    else if (format == "float")
+        hdr.format = FMT_FLOAT;
+    else if (format == "varint")
+        hdr.format = FMT_VARINT;
+    else
+        usage(argv[0]);
+    hdr.compress = compress;
+
+    if (!in.isBinary() && hdr.format == FMT_TEXT) {
+        std::cerr << files[0] << " is a text stream already" << std::endl;
+        exit(-1);
+    }
+
+    /* K of a text stream is known once its first line is read */
+    std::vector<double> v;
+    uint32_t tid;
+    uint64_t n = 0;
+    bool more = in.next(v, &tid);
+    hdr.k = in.header().k;
+
+    BBVWriter out;
+    if (!out.open(files[1], hdr)) {
+        std::cerr << "cannot open output file " << files[1] << std::endl;
+        exit(-1);
+    }
+
+    /* the text intervals of thread T > 0 go to <output>.T */
+    for (; more; more = in.next(v, &tid), ++n) {
+        if (v.size() != hdr.k) {
+            std::cerr << "interval " << n << " has " << v.size() << " values, expect " << hdr.k << std::endl;
+            exit(-1);
+        }
+        out.write(tid, v.data());
+    }
+    out.close();
+
+    std::cout << "K " << hdr.k << " intervals " << n << std::endl;
+    return 0;
+}
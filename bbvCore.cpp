@@ -0,0 +1,799 @@
+/*
+ *  The Pin-free part of bbvTrace, see bbvCore.h.
+ */
+
+#include "bbvCore.h"
+#include "bbvProject.h"
+#include "bbvKernels.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+template <class B>
+Histogram<B>::Histogram(int s) : _size(s), samples(0)
+{
+    bins = new B[_size];
+    /* init bins to 0 */
+    for (int i = 0; i < _size; ++i)
+        bins[i] = 0;
+}
+
+template <class B>
+Histogram<B>::Histogram(const Histogram<B> & rhs) : _size(rhs._size), samples(rhs.samples)
+{
+    bins = new B[_size];
+    for (int i = 0; i < _size; ++i)
+        bins[i] = rhs.bins[i];
+}
+
+template <class B>
+Histogram<B>::Histogram(Histogram<B> && rhs) : bins(rhs.bins), _size(rhs._size), samples(rhs.samples)
+{
+    rhs.bins = nullptr;
+    rhs._size = 0;
+    rhs.samples = 0;
+}
+
+template <class B>
+Histogram<B>::~Histogram() { delete [] bins; }
+
+template <class B>
+void Histogram<B>::setSize(int s)
+{
+    if (bins != nullptr)
+        delete [] bins;
+
+    _size = s;
+    bins = new B[_size];
+
+    /* init bins to 0 */
+    for (int i = 0; i < _size; ++i)
+        bins[i] = 0;
+
+    //std::cout << "size of bins " << _size << std::endl;
+}
+
+
+template <class B>
+const int Histogram<B>::size() const { return _size; }
+
+template <class B>
+void Histogram<B>::clear()
+{
+    samples = 0;
+    /* when clear bins, the size keeps unchanged */
+    for (int i = 0; i < _size; ++i)
+        bins[i] = 0;
+}
+
+template <class B>
+void Histogram<B>::normalize()
+{
+    for (int i = 0; i < _size; ++i)
+        bins[i] /= samples;
+}
+
+template <class B>
+double Histogram<B>::manhattanDist(const Histogram<B> & rhs)
+{
+    assert(_size == rhs._size);
+
+    B dist = 0;
+    for (uint32_t i = 0; i < _size; ++i)
+        dist += std::abs(bins[i] - rhs.bins[i]);
+
+    return (double)dist / samples;
+}
+
+
+template <class B>
+B & Histogram<B>::operator[](const int idx)
+{
+    assert(idx >= 0 && idx < _size);
+    return bins[idx];
+}
+        
+template <class B>
+Histogram<B> & Histogram<B>::operator=(const Histogram<B> & rhs)
+{
+    assert(_size == rhs.size());
+
+    for (int i = 0; i < _size; ++i)
+        bins[i] = rhs.bins[i];
+
+    samples = rhs.samples;
+    return *this;
+}
+
+template <class B>
+Histogram<B> & Histogram<B>::operator=(Histogram<B> && rhs)
+{
+    swap(rhs);
+    return *this;
+}
+
+template <class B>
+void Histogram<B>::swap(Histogram<B> & rhs)
+{
+    std::swap(bins, rhs.bins);
+    std::swap(_size, rhs._size);
+    std::swap(samples, rhs.samples);
+}
+
+template <class B>
+Histogram<B> & Histogram<B>::operator+=(const Histogram<B> & rhs)
+{
+    assert(_size == rhs.size());
+
+    for (int i = 0; i < _size; ++i)
+        bins[i] += rhs.bins[i];
+
+    samples += rhs.samples;
+    return *this;
+}
+
+template <class B>
+void Histogram<B>::sample(uint32_t x, int num)
+{
+    /* the sample number must less than max size of bins */
+    assert(x < _size && x >= 0);
+
+    bins[x] += num;
+    /* calculate the total num of sampling */
+    ++samples;
+}
+
+template <class B>
+void Histogram<B>::print(std::ofstream & file)
+{
+    //file.write((char *)bins, sizeof(B) * _size);
+    for (int i = 0; i < _size; ++i)
+        file << bins[i] << " ";
+    file  << "\n";
+}
+
+template class Histogram<int64_t>;
+template class Histogram<double>;
+
+SparseBBV::~SparseBBV()
+{
+    delete [] counts;
+    delete [] touched;
+}
+
+void SparseBBV::grow(int s)
+{
+    if (s <= _size)
+        return;
+
+    int64_t * newCounts = new int64_t[s];
+    UINT32 * newTouched = new UINT32[s];
+    for (int i = 0; i < _size; ++i)
+        newCounts[i] = counts[i];
+    for (int i = _size; i < s; ++i)
+        newCounts[i] = 0;
+    for (int i = 0; i < numTouched; ++i)
+        newTouched[i] = touched[i];
+
+    delete [] counts;
+    delete [] touched;
+    counts = newCounts;
+    touched = newTouched;
+    _size = s;
+}
+
+const int SparseBBV::size() const { return _size; }
+
+void SparseBBV::sample(UINT32 id, int64_t num)
+{
+    /* a BB instrumented after this BBV last grew */
+    if (id >= (UINT32)_size)
+        grow(std::max(_size * 2, (int)id + 1));
+
+    /* the first time this BB shows up in the interval */
+    if (counts[id] == 0)
+        touched[numTouched++] = id;
+
+    /* a BB has 1 inst at least, the count never goes back to 0 */
+    counts[id] += num;
+    ++samples;
+}
+
+const int SparseBBV::touchedSize() const { return numTouched; }
+
+const UINT32 SparseBBV::touchedId(int i) const { return touched[i]; }
+
+const int64_t SparseBBV::operator[](UINT32 id) const { return counts[id]; }
+
+void SparseBBV::clear()
+{
+    for (int i = 0; i < numTouched; ++i)
+        counts[touched[i]] = 0;
+    numTouched = 0;
+    samples = 0;
+}
+
+ProjMatrix::~ProjMatrix()
+{
+    for (int i = 0; i < MaxChunks; ++i) {
+        if (cols) delete [] cols[i];
+        if (fixedCols) delete [] fixedCols[i];
+        if (nzRows) delete [] nzRows[i];
+        if (nnz) delete [] nnz[i];
+    }
+    delete [] cols;
+    delete [] fixedCols;
+    delete [] nzRows;
+    delete [] nnz;
+}
+
+/* cpuid, and xgetbv for the vector registers the OS saves */
+static ProjIsa cpuIsa()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int a, b, c, d;
+    if (__get_cpuid_max(0, nullptr) < 7)
+        return ISA_BASE;
+    __cpuid(1, a, b, c, d);
+    if (!(c & bit_OSXSAVE))
+        return ISA_BASE;
+    unsigned int xcr0, xcr0hi;
+    __asm__ volatile("xgetbv" : "=a"(xcr0), "=d"(xcr0hi) : "c"(0));
+    __cpuid_count(7, 0, a, b, c, d);
+    /* AVX-512 needs the opmask and the upper ZMM state, AVX2 the YMM state */
+    if ((b & (1 << 16)) && (xcr0 & 0xE6) == 0xE6)
+        return ISA_AVX512;
+    if ((b & (1 << 5)) && (xcr0 & 0x6) == 0x6)
+        return ISA_AVX2;
+#endif
+    return ISA_BASE;
+}
+
+/* the kernel of isa, nullptr if its unit was built without it */
+static ProjMatrix::Kernel pickIsaKernel(ProjIsa isa, int k, BOOL sparse, BOOL fixed)
+{
+    switch (isa) {
+    case ISA_AVX512:
+        return pickKernelAvx512(k, sparse, fixed);
+    case ISA_AVX2:
+        return pickKernelAvx2(k, sparse, fixed);
+    default:
+        return pickKernel(k, sparse, fixed);
+    }
+}
+
+ProjIsa bestIsa()
+{
+    static const ProjIsa cpu = cpuIsa();
+    int isa = cpu;
+    while (isa > ISA_BASE && pickIsaKernel((ProjIsa)isa, 8, false, false) == nullptr)
+        --isa;
+    return (ProjIsa)isa;
+}
+
+const char * isaName(ProjIsa isa)
+{
+    static const char * const names[] = {"base", "avx2", "avx512"};
+    return names[isa];
+}
+
+BOOL isaByName(const std::string & name, ProjIsa & isa)
+{
+    for (int i = ISA_BASE; i <= bestIsa(); ++i)
+        if (name == isaName((ProjIsa)i)) {
+            isa = (ProjIsa)i;
+            return true;
+        }
+    return false;
+}
+
+DistKernels distKernels(ProjIsa isa)
+{
+    assert(isa <= bestIsa());
+    if (isa >= ISA_AVX2)
+        return distKernelsAvx2();
+    DistKernels k = {sqDist, l1Dist, dotProd};
+    return k;
+}
+
+void ProjMatrix::init(int rows, UINT64 s, BOOL isSparse, BOOL isFixed)
+{
+    assert(!(isSparse && isFixed));
+
+    k = rows;
+    seed = s;
+    sparse = isSparse;
+    fixed = isFixed;
+    /* pad every column to a whole number of 512-bit vectors */
+    stride = sparse ? k : (k + 7) & ~7;
+
+    if (sparse) {
+        nzRows = new UINT16 * [MaxChunks]();
+        nnz = new UINT16 * [MaxChunks]();
+    }
+    else if (fixed)
+        fixedCols = new INT32 * [MaxChunks]();
+    else
+        cols = new double * [MaxChunks]();
+
+    setIsa(bestIsa());
+}
+
+BOOL ProjMatrix::setIsa(ProjIsa isa)
+{
+    if (isa > bestIsa())
+        return false;
+    _isa = isa;
+    _kernel = pickIsaKernel(isa, k, sparse, fixed);
+    return true;
+}
+
+/* the finalizer of splitmix64 */
+static inline UINT64 mix64(UINT64 x)
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/* the high half of a 64-bit key is folded in separately */
+static inline UINT64 hashEntry(UINT64 s, UINT32 row, UINT64 key)
+{
+    return mix64(s + 0x9E3779B97F4A7C15ULL * (((key << 32) | row) + 1) + mix64(key >> 32));
+}
+
+double ProjMatrix::entry(UINT64 s, UINT32 row, UINT64 key)
+{
+    /* the top 53 bits to a uniform double in [-1, 1) */
+    return (double)(hashEntry(s, row, key) >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+}
+
+int ProjMatrix::sparseEntry(UINT64 s, UINT32 row, UINT64 key)
+{
+    UINT64 r = hashEntry(s, row, key) % 6;
+    return r == 0 ? 1 : (r == 1 ? -1 : 0);
+}
+
+void ProjMatrix::addColumn(UINT32 id, UINT64 key)
+{
+    assert((id >> ChunkBits) < (UINT32)MaxChunks);
+
+    /* the dense IDs come in order, a BB seen before has its column */
+    if ((int)id < _size)
+        return;
+    assert((int)id == _size);
+
+    int chunk = id >> ChunkBits;
+    size_t j = id & ((1 << ChunkBits) - 1);
+    if (sparse) {
+        if (nzRows[chunk] == nullptr) {
+            nzRows[chunk] = new UINT16[((size_t)1 << ChunkBits) * stride];
+            nnz[chunk] = new UINT16[(size_t)1 << ChunkBits];
+        }
+        UINT16 * col = nzRows[chunk] + j * stride;
+        int n = 0;
+        for (int i = 0; i < k; ++i) {
+            int e = sparseEntry(seed, i, key);
+            if (e != 0)
+                col[n++] = (UINT16)((i << 1) | (e < 0));
+        }
+        nnz[chunk][j] = (UINT16)n;
+    }
+    else if (fixed) {
+        if (fixedCols[chunk] == nullptr)
+            fixedCols[chunk] = new INT32[((size_t)1 << ChunkBits) * stride];
+        INT32 * col = fixedCols[chunk] + j * stride;
+        for (int i = 0; i < stride; ++i)
+            col[i] = i < k ? (INT32)llround(entry(seed, i, key) * (1 << FixedBits)) : 0;
+    }
+    else {
+        if (cols[chunk] == nullptr)
+            cols[chunk] = new double[((size_t)1 << ChunkBits) * stride];
+        double * col = cols[chunk] + j * stride;
+        for (int i = 0; i < stride; ++i)
+            col[i] = i < k ? entry(seed, i, key) : 0;
+    }
+    ++_size;
+}
+
+const int ProjMatrix::size() const { return _size; }
+
+const int ProjMatrix::rows() const { return k; }
+
+const BOOL ProjMatrix::isSparse() const { return sparse; }
+
+const BOOL ProjMatrix::isFixed() const { return fixed; }
+
+const ProjMatrix::Kernel ProjMatrix::kernel() const { return _kernel; }
+
+const ProjIsa ProjMatrix::isa() const { return _isa; }
+
+const double * ProjMatrix::column(UINT32 id) const
+{
+    assert(!sparse && !fixed);
+    return cols[id >> ChunkBits] + (size_t)(id & ((1 << ChunkBits) - 1)) * stride;
+}
+
+const INT32 * ProjMatrix::fixedColumn(UINT32 id) const
+{
+    assert(fixed);
+    return fixedCols[id >> ChunkBits] + (size_t)(id & ((1 << ChunkBits) - 1)) * stride;
+}
+
+const UINT16 * ProjMatrix::sparseColumn(UINT32 id, int & num) const
+{
+    assert(sparse);
+    size_t j = id & ((1 << ChunkBits) - 1);
+    num = nnz[id >> ChunkBits][j];
+    return nzRows[id >> ChunkBits] + j * stride;
+}
+
+void ProjMatrix::project(double * acc, UINT32 id, int64_t count) const
+{
+    projectColumn(acc, column(id), (double)count, k);
+}
+
+void ProjMatrix::project(int64_t * acc, UINT32 id, int64_t count) const
+{
+    if (fixed) {
+        const INT32 * col = fixedColumn(id);
+        for (int i = 0; i < k; ++i)
+            acc[i] += count * col[i];
+        return;
+    }
+
+    /* only the nonzero rows, about 1/3 of the column */
+    int num;
+    const UINT16 * col = sparseColumn(id, num);
+    for (int n = 0; n < num; ++n)
+        acc[col[n] >> 1] += (col[n] & 1) ? -count : count;
+}
+
+PhaseTable::~PhaseTable()
+{
+    delete [] sigs;
+    delete [] ids;
+    delete [] lastUse;
+}
+
+void PhaseTable::setCapacity(int cap, int k)
+{
+    capacity = cap;
+    sigs = new Histogram<double>[capacity];
+    for (int i = 0; i < capacity; ++i)
+        sigs[i].setSize(k);
+    sig.setSize(k);
+    ids = new UINT32[capacity];
+    lastUse = new UINT64[capacity];
+}
+
+void PhaseTable::setThreshold(double t) { threshold = t; }
+
+UINT32 PhaseTable::classify(const double * v)
+{
+    assert(capacity > 0);
+
+    /* normalize like Histogram::normalize, samples is the sum of the magnitudes */
+    sig.samples = 0;
+    for (int i = 0; i < sig.size(); ++i)
+        sig.samples += std::abs(v[i]);
+    for (int i = 0; i < sig.size(); ++i)
+        sig[i] = sig.samples > 0 ? v[i] / sig.samples : 0;
+    /* manhattanDist divides by samples, the signatures are normalized already */
+    sig.samples = 1;
+
+    ++clock;
+    int best = -1;
+    double bestDist = threshold;
+    for (int e = 0; e < _size; ++e) {
+        double dist = sig.manhattanDist(sigs[e]);
+        if (dist < bestDist) {
+            bestDist = dist;
+            best = e;
+        }
+    }
+
+    if (best >= 0) {
+        lastUse[best] = clock;
+        return ids[best];
+    }
+
+    /* a new phase, take a free entry or the least recently matched one */
+    int victim = _size;
+    if (_size == capacity) {
+        victim = 0;
+        for (int e = 1; e < _size; ++e)
+            if (lastUse[e] < lastUse[victim])
+                victim = e;
+    }
+    else
+        ++_size;
+
+    /* the old signature of the victim is the scratch of the next call */
+    sigs[victim].swap(sig);
+    ids[victim] = nextId++;
+    lastUse[victim] = clock;
+    return ids[victim];
+}
+
+const int PhaseTable::size() const { return _size; }
+
+const UINT32 PhaseTable::numPhases() const { return nextId; }
+
+PhasePredictor::~PhasePredictor() { delete [] table; }
+
+void PhasePredictor::setSize(UINT32 entries)
+{
+    assert((entries & (entries - 1)) == 0);
+    table = new Entry[entries];
+    for (UINT32 i = 0; i < entries; ++i)
+        table[i].valid = false;
+    mask = entries - 1;
+}
+
+UINT32 PhasePredictor::update(UINT32 tid, UINT32 phase)
+{
+    if (hist.size() <= tid) {
+        History empty = {0, 0, 0, false};
+        hist.resize(tid + 1, empty);
+    }
+    History & h = hist[tid];
+
+    if (h.valid) {
+        ++predictions;
+        if (h.predicted == phase)
+            ++hits;
+
+        /* train the entry of the previous (phase, run) */
+        Entry & e = table[(h.last * 0x9E3779B1U ^ h.run * 0x85EBCA6BU) & mask];
+        e.phase = h.last;
+        e.run = h.run;
+        e.next = phase;
+        e.valid = true;
+    }
+
+    /* the run length saturates, so a long phase keeps one entry */
+    if (h.valid && phase == h.last)
+        h.run = std::min(h.run + 1, (UINT32)255);
+    else
+        h.run = 1;
+    h.last = phase;
+    h.valid = true;
+
+    const Entry & e = table[(h.last * 0x9E3779B1U ^ h.run * 0x85EBCA6BU) & mask];
+    h.predicted = (e.valid && e.phase == h.last && e.run == h.run) ? e.next : h.last;
+    return h.predicted;
+}
+
+ReuseDist::~ReuseDist()
+{
+    delete [] slots;
+    delete [] tree;
+}
+
+UINT32 ReuseDist::numBins(UINT64 maxDist)
+{
+    /* 0, [1, 2), [2, 4) ... [maxDist / 2, maxDist), then the rest */
+    return 64 - __builtin_clzll(maxDist) + 1;
+}
+
+void ReuseDist::init(UINT32 lineSize, UINT32 sample, UINT64 m)
+{
+    assert((m & (m - 1)) == 0 && (lineSize & (lineSize - 1)) == 0);
+    lineBits = __builtin_ctzll(lineSize);
+    sampleBits = sample;
+    maxDist = m;
+    hist.setSize(numBins(m));
+
+    rehash(4096);
+    cap = 1 << 16;
+    tree = new UINT32[cap + 1];
+    for (UINT64 i = 0; i <= cap; ++i)
+        tree[i] = 0;
+    now = 0;
+}
+
+void ReuseDist::rehash(UINT64 n)
+{
+    Slot * old = slots;
+    UINT64 oldSize = old ? mask + 1 : 0;
+
+    slots = new Slot[n];
+    for (UINT64 i = 0; i < n; ++i)
+        slots[i].key = 0;
+    mask = n - 1;
+
+    for (UINT64 i = 0; i < oldSize; ++i) {
+        if (old[i].key == 0)
+            continue;
+        UINT64 s = ((old[i].key - 1) * 0x9E3779B97F4A7C15ULL) >> 20 & mask;
+        while (slots[s].key != 0)
+            s = (s + 1) & mask;
+        slots[s] = old[i];
+    }
+    delete [] old;
+}
+
+void ReuseDist::add(UINT64 pos, INT64 delta)
+{
+    for (; pos <= cap; pos += pos & (~pos + 1))
+        tree[pos] += delta;
+}
+
+UINT64 ReuseDist::prefix(UINT64 pos) const
+{
+    UINT64 sum = 0;
+    for (; pos > 0; pos &= pos - 1)
+        sum += tree[pos];
+    return sum;
+}
+
+void ReuseDist::compact()
+{
+    /* order the lines by their latest access */
+    std::vector<std::pair<UINT64, UINT64> > order;
+    order.reserve(lines);
+    for (UINT64 i = 0; i <= mask; ++i)
+        if (slots[i].key != 0)
+            order.push_back(std::make_pair(slots[i].stamp, i));
+    std::sort(order.begin(), order.end());
+
+    if (4 * lines > cap) {
+        delete [] tree;
+        cap *= 2;
+        tree = new UINT32[cap + 1];
+    }
+
+    for (UINT64 i = 0; i < order.size(); ++i)
+        slots[order[i].second].stamp = i + 1;
+    now = order.size();
+
+    /* a 1 at 1..now, built bottom-up in O(cap) */
+    for (UINT64 i = 0; i <= cap; ++i)
+        tree[i] = (i >= 1 && i <= now);
+    for (UINT64 i = 1; i <= cap; ++i) {
+        UINT64 j = i + (i & (~i + 1));
+        if (j <= cap)
+            tree[j] += tree[i];
+    }
+}
+
+void ReuseDist::access(ADDRINT addr)
+{
+    UINT64 line = addr >> lineBits;
+    UINT64 h = line * 0x9E3779B97F4A7C15ULL;
+    /* the top bits of the hash pick the sampled lines */
+    if (sampleBits > 0 && (h >> (64 - sampleBits)) != 0)
+        return;
+
+    /* before the lookup, the renumbering keeps a mark for every line */
+    if (now == cap)
+        compact();
+
+    UINT64 s = h >> 20 & mask;
+    while (slots[s].key != 0 && slots[s].key != line + 1)
+        s = (s + 1) & mask;
+
+    UINT32 bin = hist.size() - 1;
+    if (slots[s].key != 0) {
+        /* the lines accessed after the last access of this one */
+        UINT64 dist = (lines - prefix(slots[s].stamp)) << sampleBits;
+        if (dist == 0)
+            bin = 0;
+        else if (dist < maxDist)
+            bin = 64 - __builtin_clzll(dist);
+        add(slots[s].stamp, -1);
+    }
+    else {
+        slots[s].key = line + 1;
+        ++lines;
+    }
+    hist.sample(bin, 1 << sampleBits);
+
+    slots[s].stamp = ++now;
+    add(now, 1);
+
+    /* keep the table at most half full, s is not used after this */
+    if (2 * lines > mask + 1)
+        rehash(2 * (mask + 1));
+}
+
+VOID projectGeneric(SparseBBV & bbv, const ProjMatrix & m, double * accu, Histogram<> & intAccu)
+{
+    projectAny(bbv, m, accu, intAccu);
+}
+
+VOID projectBBV(SparseBBV & bbv, const ProjMatrix & m, double * accu, Histogram<> & intAccu)
+{
+    m.kernel()(bbv, m, accu, intAccu);
+}
+
+VOID projectColumn(double * acc, const double * col, double count, int k)
+{
+    addColumn(acc, col, count, k);
+}
+
+BBDict::BBDict(UINT32 cap) : slots(nullptr), mask(0), _size(0)
+{
+    /* the capacity must be a power of 2 */
+    assert((cap & (cap - 1)) == 0);
+    rehash(cap);
+}
+
+BBDict::~BBDict() { delete [] slots; }
+
+static inline UINT32 hashKey(UINT64 key)
+{
+    /* fibonacci hashing, the high bits are the best mixed */
+    return (UINT32)((key * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+void BBDict::rehash(UINT32 cap)
+{
+    Slot * old = slots;
+    UINT32 oldCap = old ? mask + 1 : 0;
+
+    /* key 0 marks an empty slot */
+    slots = new Slot[cap];
+    for (UINT32 i = 0; i < cap; ++i)
+        slots[i].key = 0;
+    mask = cap - 1;
+
+    for (UINT32 i = 0; i < oldCap; ++i) {
+        if (old[i].key == 0)
+            continue;
+        UINT32 h = hashKey(old[i].key) & mask;
+        while (slots[h].key != 0)
+            h = (h + 1) & mask;
+        slots[h] = old[i];
+    }
+
+    delete [] old;
+}
+
+UINT32 BBDict::lookup(UINT64 key)
+{
+    assert(key != 0);
+
+    UINT32 h = hashKey(key) & mask;
+    while (slots[h].key != 0) {
+        if (slots[h].key == key)
+            return slots[h].id;
+        h = (h + 1) & mask;
+    }
+
+    /* a new BB, keep the load factor under 1/2 */
+    slots[h].key = key;
+    slots[h].id = _size++;
+    if (_size * 2 > mask + 1)
+        rehash((mask + 1) * 2);
+
+    return _size - 1;
+}
+
+const UINT32 BBDict::size() const { return _size; }
+
+void BBDict::dump(std::vector<UINT64> & keys) const
+{
+    keys.assign(_size, 0);
+    for (UINT32 i = 0; i <= mask; ++i)
+        if (slots[i].key != 0)
+            keys[slots[i].id] = slots[i].key;
+}
+
+UINT64 imageKey(const std::string & image, UINT64 size, UINT64 offset)
+{
+    /* FNV-1a of the file name, then of the size */
+    UINT64 h = 0xCBF29CE484222325ULL;
+    for (size_t i = image.find_last_of('/') + 1; i < image.size(); ++i)
+        h = (h ^ (uint8_t)image[i]) * 0x100000001B3ULL;
+    for (int b = 0; b < 64; b += 8)
+        h = (h ^ (uint8_t)(size >> b)) * 0x100000001B3ULL;
+
+    /* 0 is the empty key of BBDict */
+    UINT64 key = mix64(h + 0x9E3779B97F4A7C15ULL * (offset + 1));
+    return key ? key : 1;
+}
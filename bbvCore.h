@@ -0,0 +1,504 @@
+#ifndef __BBV_CORE_H__
+#define __BBV_CORE_H__
+
+/*
+ *  The BBV pipeline without the instrumentation: the BB IDs, the sparse
+ *  BBV counters, the random projection, the phase table and predictor 
+ *  and the reuse distance. bbvTrace links it with Pin, the offline tools
+ *  build it with BBV_STANDALONE and get the Pin types below.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <assert.h>
+#include <stdlib.h> 
+#include <stdint.h>
+#include <float.h>
+
+#ifdef BBV_STANDALONE
+typedef void VOID;
+typedef bool BOOL;
+typedef uint16_t UINT16;
+typedef uint32_t UINT32;
+typedef int32_t INT32;
+typedef uint64_t UINT64;
+typedef int64_t INT64;
+typedef uint64_t ADDRINT;
+#else
+#include "pin.H"
+#endif
+
+/* for recording distribution into a Histogram, 
+   Accur is the accuracy of transforming calculation */
+template <class B = int64_t>
+class Histogram
+{
+    B * bins;
+    int _size;
+
+public:
+    B samples;
+
+    Histogram() : bins(nullptr), _size(0), samples(0) {};
+
+    Histogram(int s);
+
+    Histogram(const Histogram<B> & rhs);
+
+    /* takes the bins of rhs, which is left empty */
+    Histogram(Histogram<B> && rhs);
+
+    ~Histogram();
+
+    void setSize(int s);
+
+    const int size() const;
+
+    void clear();
+
+    void normalize();
+
+    double manhattanDist(const Histogram<B> & rhs);
+
+    B & operator[](const int idx);
+
+    Histogram<B> & operator=(const Histogram<B> & rhs);
+
+    /* the bins are swapped, not copied, the sizes may differ */
+    Histogram<B> & operator=(Histogram<B> && rhs);
+
+    void swap(Histogram<B> & rhs);
+
+    Histogram<B> & operator+=(const Histogram<B> & rhs);
+
+    void sample(uint32_t x, int num = 1);
+
+    const B getSamples() const; 
+
+    void print(std::ofstream & file);
+};
+
+
+/* 
+ * maps the key of a BBL (see imageKey) to a dense BB ID, it is an open
+ * addressing hash table with linear probing, filled at instrumentation time
+ */
+class BBDict
+{
+    struct Slot
+    {
+        UINT64 key;
+        UINT32 id;
+    };
+
+    Slot * slots;
+    UINT32 mask;
+    UINT32 _size;
+
+    void rehash(UINT32 cap);
+
+public:
+    BBDict(UINT32 cap = 4096);
+
+    ~BBDict();
+
+    /* return the ID of key, a new ID is assigned if key is never seen */
+    UINT32 lookup(UINT64 key);
+
+    const UINT32 size() const;
+
+    /* the keys of the BBs indexed by ID, lookup() of them in order rebuilds the IDs */
+    void dump(std::vector<UINT64> & keys) const;
+};
+
+/* 
+ * the per-interval BB counters, indexed by BB ID. The IDs touched in an
+ * interval are kept in a dirty list, so projecting and clearing the
+ * counters only costs the BBs executed in that interval
+ */
+class SparseBBV
+{
+    int64_t * counts;
+    UINT32 * touched;
+    int _size;
+    int numTouched;
+
+public:
+    int64_t samples;
+
+    SparseBBV() : counts(nullptr), touched(nullptr), _size(0), numTouched(0), samples(0) {};
+
+    ~SparseBBV();
+
+    /* enlarge the counters and keep their values */
+    void grow(int s);
+
+    const int size() const;
+
+    void sample(UINT32 id, int64_t num);
+
+    const int touchedSize() const;
+
+    const UINT32 touchedId(int i) const;
+
+    const int64_t operator[](UINT32 id) const;
+
+    /* zero the touched counters only */
+    void clear();
+};
+
+/*
+ * the interval clock of a guest thread, run by the analysis routines of
+ * bbvTrace and by bbvReplay. A BB counts the clock units of its head
+ * instructions, is sampled with the insts since the last sampled BB,
+ * then counts the units of its branch; a BB without a branch passes its
+ * insts on to the next sampled one. Whenever the units reach limit,
+ * reach() of the owner runs: a per-thread interval calls endInterval and
+ * projects the BBV, the global clock of bbvTrace publishes the units.
+ */
+class IntervalClock
+{
+public:
+    /* units of the interval clock not yet consumed */
+    UINT64 interCount;
+    /* insts since the last sampled BB */
+    UINT64 bbvInsts;
+    /* reach() runs when interCount gets here */
+    UINT64 limit;
+    /* the intervals ended */
+    UINT64 numIntervals;
+
+    IntervalClock(UINT64 l) : interCount(0), bbvInsts(0), limit(l), numIntervals(0) {};
+
+    template <class R>
+    void count(UINT64 units, R reach)
+    {
+        interCount += units;
+        while (interCount >= limit)
+            reach();
+    }
+
+    /* a BB ending in a branch, unitHead before its sample and unitTail after */
+    template <class R>
+    void branchBB(SparseBBV & bbv, UINT32 bbId, UINT32 numInsts, UINT32 unitHead, UINT32 unitTail, R reach)
+    {
+        count(unitHead, reach);
+        bbv.sample(bbId, bbvInsts + numInsts);
+        bbvInsts = 0;
+        count(unitTail, reach);
+    }
+
+    /* a BB without a branch at its tail */
+    template <class R>
+    void fallBB(UINT32 numInsts, UINT32 units, R reach)
+    {
+        bbvInsts += numInsts;
+        count(units, reach);
+    }
+
+    /* one inst, a branch samples its BB before the units are checked */
+    template <class R>
+    void inst(SparseBBV & bbv, UINT32 bbId, BOOL isBranch, UINT32 units, R reach)
+    {
+        ++bbvInsts;
+        interCount += units;
+        if (isBranch) {
+            bbv.sample(bbId, bbvInsts);
+            bbvInsts = 0;
+        }
+        while (interCount >= limit)
+            reach();
+    }
+
+    /* a per-thread interval of size units ends, the residual starts the next one */
+    UINT64 endInterval(UINT64 size)
+    {
+        interCount -= size;
+        return ++numIntervals;
+    }
+
+    /* a new interval, the counts so far are dropped */
+    void reset()
+    {
+        interCount = 0;
+        bbvInsts = 0;
+        numIntervals = 0;
+    }
+};
+
+/* the instruction sets of the projection kernels, base is the flags of the build */
+enum ProjIsa
+{
+    ISA_BASE = 0,
+    ISA_AVX2 = 1,
+    ISA_AVX512 = 2
+};
+
+/* the widest ISA this CPU runs and the compiler could build the kernels for */
+ProjIsa bestIsa();
+
+const char * isaName(ProjIsa isa);
+
+/* the ISA of a name of isaName, false if it is unknown or wider than bestIsa */
+BOOL isaByName(const std::string & name, ProjIsa & isa);
+
+/* the distance kernels of bbvCluster and bbvDist over rows of doubles, see bbvKernels.h */
+struct DistKernels
+{
+    double (*sqDist)(const double * a, const double * b, size_t d);
+    double (*l1Dist)(const double * a, const double * b, size_t d);
+    double (*dotProd)(const double * a, const double * b, size_t d);
+};
+
+/* the kernels of isa up to bestIsa, AVX-512 runs the AVX2 ones; every ISA gives the same bits */
+DistKernels distKernels(ProjIsa isa);
+
+/*
+ * the random projection matrix. An entry is a counter-based hash of
+ * (seed, row, BB key), so the same seed gives the same column to a BB in
+ * every process and run, whatever its ID there, and the matrix has no
+ * limit on its shape. The column of a BB is worked out once, when the BB
+ * is first seen. The sparse matrix follows
+ * Achlioptas: +1 and -1 with probability 1/6 each, 0 otherwise.
+ */
+class ProjMatrix
+{
+    /* 
+     * the columns are allocated in chunks that never move, so a thread
+     * projecting its interval is safe while Trace() adds new columns
+     */
+    static const int ChunkBits = 10;
+    static const int MaxChunks = 1 << 14;
+
+    /* dense: column-major, each column is padded to stride rows */
+    double ** cols;
+    /* fixed: the dense entries in units of 2^-FixedBits */
+    INT32 ** fixedCols;
+    /* sparse: the nonzero rows of each column, the low bit is the sign */
+    UINT16 ** nzRows;
+    UINT16 ** nnz;
+    int k;
+    int stride;
+    int _size;
+    UINT64 seed;
+    BOOL sparse;
+    BOOL fixed;
+
+public:
+    static const int FixedBits = 16;
+
+    /* projectBBV for the shape of the matrix */
+    typedef VOID (*Kernel)(SparseBBV & bbv, const ProjMatrix & m, double * accu, Histogram<> & intAccu);
+
+private:
+    Kernel _kernel;
+    ProjIsa _isa;
+
+public:
+    ProjMatrix() : cols(nullptr), fixedCols(nullptr), nzRows(nullptr), nnz(nullptr), k(0), stride(0), 
+        _size(0), seed(0), sparse(false), fixed(false), _kernel(nullptr), _isa(ISA_BASE) {};
+
+    ~ProjMatrix();
+
+    /* a dense matrix is kept in doubles, or in int32 with isFixed; the kernel of K and bestIsa is picked here */
+    void init(int rows, UINT64 s, BOOL isSparse, BOOL isFixed);
+
+    /* run the kernel of another ISA, false if it is wider than bestIsa */
+    BOOL setIsa(ProjIsa isa);
+
+    /* the entries of the dense and the sparse matrix */
+    static double entry(UINT64 s, UINT32 row, UINT64 key);
+
+    static int sparseEntry(UINT64 s, UINT32 row, UINT64 key);
+
+    /* cache the column of BB id with the given key, the IDs come in order */
+    void addColumn(UINT32 id, UINT64 key);
+
+    const int size() const;
+
+    const int rows() const;
+
+    const BOOL isSparse() const;
+
+    const BOOL isFixed() const;
+
+    const Kernel kernel() const;
+
+    const ProjIsa isa() const;
+
+    /* the columns of BB id, padded to a multiple of 8 rows */
+    const double * column(UINT32 id) const;
+
+    const INT32 * fixedColumn(UINT32 id) const;
+
+    /* the nonzero rows of a sparse column, the low bit is the sign */
+    const UINT16 * sparseColumn(UINT32 id, int & num) const;
+
+    /* acc[0..k) += count * column id */
+    void project(double * acc, UINT32 id, int64_t count) const;
+
+    void project(int64_t * acc, UINT32 id, int64_t count) const;
+};
+
+/*
+ * the online phase table. An interval joins the phase of the nearest
+ * signature within the manhattan threshold, otherwise it starts a new
+ * phase. The table is bounded, a new phase replaces the least recently
+ * matched signature, so a lookup costs at most size x K.
+ */
+class PhaseTable
+{
+    Histogram<double> * sigs;
+    /* the signature of the interval being classified, swapped into sigs for a new phase */
+    Histogram<double> sig;
+    UINT32 * ids;
+    UINT64 * lastUse;
+    int _size;
+    int capacity;
+    double threshold;
+    UINT32 nextId;
+    UINT64 clock;
+
+public:
+    PhaseTable() : sigs(nullptr), ids(nullptr), lastUse(nullptr), _size(0), capacity(0),
+        threshold(0), nextId(0), clock(0) {};
+
+    ~PhaseTable();
+
+    void setCapacity(int cap, int k);
+
+    void setThreshold(double t);
+
+    /* the phase ID of the projected interval v */
+    UINT32 classify(const double * v);
+
+    const int size() const;
+
+    /* the phase IDs handed out */
+    const UINT32 numPhases() const;
+};
+
+/*
+ * the run-length encoded markov predictor of the next phase, it is
+ * indexed by the current phase and how long it has run. A miss predicts
+ * that the current phase goes on. Every guest thread has its own history.
+ */
+class PhasePredictor
+{
+    struct Entry
+    {
+        UINT32 phase;
+        UINT32 run;
+        UINT32 next;
+        BOOL valid;
+    };
+
+    struct History
+    {
+        UINT32 last;
+        UINT32 run;
+        UINT32 predicted;
+        BOOL valid;
+    };
+
+    Entry * table;
+    UINT32 mask;
+    std::vector<History> hist;
+
+public:
+    UINT64 predictions;
+    UINT64 hits;
+
+    PhasePredictor() : table(nullptr), mask(0), predictions(0), hits(0) {};
+
+    ~PhasePredictor();
+
+    /* entries must be a power of 2 */
+    void setSize(UINT32 entries);
+
+    /* train with the phase of the latest interval of tid, return its next phase */
+    UINT32 update(UINT32 tid, UINT32 phase);
+};
+
+/* 
+ * the reuse (stack) distance of cache lines: the number of distinct lines
+ * touched since the last access to a line. A Fenwick tree over the access
+ * timestamps holds a 1 at the latest access of every line, so a distance 
+ * is a prefix sum, O(log n) instead of walking an LRU stack. The stamps
+ * are renumbered when the tree is full. With sampling, only the lines
+ * whose hash falls in 1/2^s of the space are tracked, and their distances
+ * are scaled by 2^s (SHARDS).
+ */
+class ReuseDist
+{
+    struct Slot
+    {
+        /* line + 1, 0 is an empty slot */
+        UINT64 key;
+        UINT64 stamp;
+    };
+
+    Slot * slots;
+    UINT64 mask;
+    UINT64 lines;
+    UINT32 * tree;
+    UINT64 cap;
+    UINT64 now;
+    UINT32 lineBits;
+    UINT32 sampleBits;
+    UINT64 maxDist;
+
+    void rehash(UINT64 n);
+
+    void add(UINT64 pos, INT64 delta);
+
+    UINT64 prefix(UINT64 pos) const;
+
+    /* renumber the stamps to 1..lines, the tree grows if it is a quarter full */
+    void compact();
+
+public:
+    /* the log2 bins of the distances, the last one holds the cold and far accesses */
+    Histogram<> hist;
+
+    ReuseDist() : slots(nullptr), mask(0), lines(0), tree(nullptr), cap(0), now(0),
+        lineBits(6), sampleBits(0), maxDist(0) {};
+
+    ~ReuseDist();
+
+    /* maxDist must be a power of 2 */
+    void init(UINT32 lineSize, UINT32 sample, UINT64 maxDist);
+
+    /* the number of bins for maxDist */
+    static UINT32 numBins(UINT64 maxDist);
+
+    void access(ADDRINT addr);
+};
+
+/* acc[0..k) += count * col[0..k), vectorized when the flags of the build allow */
+VOID projectColumn(double * acc, const double * col, double count, int k);
+
+/* 
+ * project the touched BBs of bbv into accu[0..K) and clear bbv, a sparse
+ * or fixed-point matrix sums integers in intAccu, which has K bins. It
+ * runs the kernel of the matrix and its ISA: for K of 8, 16, 32 or 64 the
+ * sums stay in registers or on the stack, any other K is projected a
+ * column at a time.
+ */
+VOID projectBBV(SparseBBV & bbv, const ProjMatrix & m, double * accu, Histogram<> & intAccu);
+
+/* the kernel of any K with the base ISA, the reference the others match to the bit */
+VOID projectGeneric(SparseBBV & bbv, const ProjMatrix & m, double * accu, Histogram<> & intAccu);
+
+/* 
+ * the key of the BB at offset in an image, named without its directory,
+ * so a BB has the same key wherever ASLR loads it and in every process.
+ * the mapped size of the image tells apart the images of one name
+ */
+UINT64 imageKey(const std::string & image, UINT64 size, UINT64 offset);
+
+#endif
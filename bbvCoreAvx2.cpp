@@ -0,0 +1,34 @@
+/*
+ *  The projection kernels of bbvProject.h and the distance kernels of
+ *  bbvKernels.h built with -mavx2, see bestIsa.
+ */
+
+#if defined(__AVX2__)
+#include "bbvProject.h"
+#include "bbvKernels.h"
+
+ProjMatrix::Kernel pickKernelAvx2(int k, BOOL sparse, BOOL fixed)
+{
+    return pickKernel(k, sparse, fixed);
+}
+
+DistKernels distKernelsAvx2()
+{
+    DistKernels k = {sqDist, l1Dist, dotProd};
+    return k;
+}
+#else
+#include "bbvCore.h"
+
+/* the compiler has no AVX2, bestIsa passes it over */
+ProjMatrix::Kernel pickKernelAvx2(int k, BOOL sparse, BOOL fixed)
+{
+    return nullptr;
+}
+
+DistKernels distKernelsAvx2()
+{
+    DistKernels k = {nullptr, nullptr, nullptr};
+    return k;
+}
+#endif
@@ -0,0 +1,20 @@
+/*
+ *  The projection kernels of bbvProject.h built with -mavx512f, see bestIsa.
+ */
+
+#if defined(__AVX512F__)
+#include "bbvProject.h"
+
+ProjMatrix::Kernel pickKernelAvx512(int k, BOOL sparse, BOOL fixed)
+{
+    return pickKernel(k, sparse, fixed);
+}
+#else
+#include "bbvCore.h"
+
+/* the compiler has no AVX-512, bestIsa passes it over */
+ProjMatrix::Kernel pickKernelAvx512(int k, BOOL sparse, BOOL fixed)
+{
+    return nullptr;
+}
+#endif
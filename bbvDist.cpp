@@ -0,0 +1,320 @@
+/*
+ *  Pairwise distances of the BBVs written by bbvTrace. The intervals are
+ *  normalized the way Histogram::manhattanDist does and kept in a
+ *  row-major matrix whose rows are padded to the AVX2 width, then the
+ *  pairs are computed tile by tile by the worker threads, a tile of rows
+ *  against a tile of columns that stay in the cache. The output is
+ *  either the full n x n matrix of floats in a memory-mapped file or the
+ *  k nearest neighbors of every interval, which is what the phase
+ *  analysis of 100k+ intervals can afford.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "bbvCore.h"
+#include "bbvFormat.h"
+
+/* the distance kernels of -isa */
+static DistKernels Dist;
+
+enum Metric
+{
+    METRIC_L1 = 0,
+    METRIC_L2 = 1,
+    METRIC_COS = 2
+};
+
+/* the header of a matrix file, the n x n floats follow row by row */
+struct DistHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t metric;
+    uint32_t reserved;
+    uint64_t n;
+    uint64_t offset;
+};
+
+/* the intervals as a row-major n x stride matrix, zero padded after d */
+struct Dataset
+{
+    std::vector<double> rows;
+    std::vector<double> norms;
+    size_t n;
+    size_t d;
+    size_t stride;
+
+    const double * row(size_t i) const { return rows.data() + i * stride; }
+};
+
+static inline float distance(const Dataset & data, Metric metric, size_t i, size_t j)
+{
+    const double * a = data.row(i), * b = data.row(j);
+    switch (metric) {
+    case METRIC_L1:
+        return Dist.l1Dist(a, b, data.stride);
+    case METRIC_L2:
+        return sqrt(Dist.sqDist(a, b, data.stride));
+    default:
+        /* an empty interval is as far as it gets from the others */
+        if (data.norms[i] == 0 || data.norms[j] == 0)
+            return data.norms[i] == data.norms[j] ? 0 : 1;
+        return 1 - Dist.dotProd(a, b, data.stride) / (data.norms[i] * data.norms[j]);
+    }
+}
+
+/* run fn(task) for the tasks [0, n) taken one by one by the threads */
+template <class F>
+static void parallelTasks(size_t n, int threads, F fn)
+{
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t task; (task = next.fetch_add(1)) < n; )
+            fn(task);
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; ++t)
+        pool.push_back(std::thread(worker));
+    worker();
+    for (size_t t = 0; t < pool.size(); ++t)
+        pool[t].join();
+}
+
+/*
+ * the upper triangle of tiles, each pair is computed once and stored
+ * twice
+ */
+static void fullMatrix(const Dataset & data, Metric metric, size_t tile, int threads, float * m)
+{
+    const size_t n = data.n, blocks = (n + tile - 1) / tile;
+    std::vector<std::pair<uint32_t, uint32_t> > tiles;
+    for (size_t bi = 0; bi < blocks; ++bi)
+        for (size_t bj = bi; bj < blocks; ++bj)
+            tiles.push_back(std::make_pair(bi, bj));
+
+    parallelTasks(tiles.size(), threads, [&](size_t task) {
+        size_t i0 = tiles[task].first * tile, j0 = tiles[task].second * tile;
+        size_t i1 = std::min(n, i0 + tile), j1 = std::min(n, j0 + tile);
+        for (size_t i = i0; i < i1; ++i) {
+            if (j0 <= i)
+                m[i * n + i] = 0;
+            for (size_t j = std::max(j0, i + 1); j < j1; ++j)
+                m[i * n + j] = m[j * n + i] = distance(data, metric, i, j);
+        }
+    });
+}
+
+/*
+ * the k nearest neighbors of every interval, nearest first; a tile of
+ * rows is scanned against the tiles of columns, each row keeps a
+ * max-heap of its k best
+ */
+static void nearest(const Dataset & data, Metric metric, size_t tile, size_t k, int threads,
+                    std::vector<std::pair<float, uint32_t> > & knn)
+{
+    const size_t n = data.n, rowBlocks = (n + tile - 1) / tile;
+    const size_t colTile = 4 * tile;
+    knn.assign(n * k, std::make_pair(0.0f, 0));
+
+    parallelTasks(rowBlocks, threads, [&](size_t task) {
+        size_t i0 = task * tile, i1 = std::min(n, i0 + tile);
+        std::vector<std::vector<std::pair<float, uint32_t> > > heaps(i1 - i0);
+        for (size_t j0 = 0; j0 < n; j0 += colTile) {
+            size_t j1 = std::min(n, j0 + colTile);
+            for (size_t i = i0; i < i1; ++i) {
+                std::vector<std::pair<float, uint32_t> > & heap = heaps[i - i0];
+                for (size_t j = j0; j < j1; ++j) {
+                    if (j == i)
+                        continue;
+                    std::pair<float, uint32_t> c(distance(data, metric, i, j), j);
+                    if (heap.size() < k) {
+                        heap.push_back(c);
+                        std::push_heap(heap.begin(), heap.end());
+                    }
+                    else if (c < heap.front()) {
+                        std::pop_heap(heap.begin(), heap.end());
+                        heap.back() = c;
+                        std::push_heap(heap.begin(), heap.end());
+                    }
+                }
+            }
+        }
+        for (size_t i = i0; i < i1; ++i) {
+            std::vector<std::pair<float, uint32_t> > & heap = heaps[i - i0];
+            std::sort_heap(heap.begin(), heap.end());
+            std::copy(heap.begin(), heap.end(), knn.begin() + i * k);
+        }
+    });
+}
+
+static void usage(const char * name)
+{
+    std::cerr << "usage: " << name << " [options] <BBV stream>\n"
+              << "  -d metric    the distance: l1, l2 or cos (l1)\n"
+              << "  -topk k      write the k nearest intervals of each, at most n - 1, not the full matrix\n"
+              << "  -tile n      the intervals of a tile (64)\n"
+              << "  -j n         the worker threads (all cores)\n"
+              << "  -t tid       the guest thread of the records (0)\n"
+              << "  -isa name    the distance kernels: base, avx2 or avx512 (the widest the CPU runs)\n"
+              << "  -o file      the output (BBV.dist)\n";
+    exit(-1);
+}
+
+int main(int argc, char *argv[])
+{
+    size_t topK = 0, tile = 64;
+    uint32_t tid = 0;
+    ProjIsa isa = bestIsa();
+    int threads = std::max(1U, std::thread::hardware_concurrency());
+    std::string output = "BBV.dist", input, metricName = "l1";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (i + 1 < argc && arg == "-d")
+            metricName = argv[++i];
+        else if (i + 1 < argc && arg == "-topk")
+            topK = strtoull(argv[++i], nullptr, 10);
+        else if (i + 1 < argc && arg == "-tile")
+            tile = strtoull(argv[++i], nullptr, 10);
+        else if (i + 1 < argc && arg == "-j")
+            threads = atoi(argv[++i]);
+        else if (i + 1 < argc && arg == "-t")
+            tid = atoi(argv[++i]);
+        else if (i + 1 < argc && arg == "-isa") {
+            if (!isaByName(argv[++i], isa))
+                usage(argv[0]);
+        }
+        else if (i + 1 < argc && arg == "-o")
+            output = argv[++i];
+        else if (arg[0] != '-' && input.empty())
+            input = arg;
+        else
+            usage(argv[0]);
+    }
+    if (input.empty() || tile == 0 || threads < 1)
+        usage(argv[0]);
+
+    Metric metric;
+    if (metricName == "l1")
+        metric = METRIC_L1;
+    else if (metricName == "l2")
+        metric = METRIC_L2;
+    else if (metricName == "cos")
+        metric = METRIC_COS;
+    else
+        usage(argv[0]);
+
+    Dist = distKernels(isa);
+    auto start = std::chrono::steady_clock::now();
+
+    /* read and normalize the intervals of thread tid */
+    BBVReader in;
+    if (!in.open(input)) {
+        std::cerr << "cannot read BBV stream " << input << std::endl;
+        exit(-1);
+    }
+
+    Dataset data;
+    data.n = 0;
+    data.d = 0;
+    std::vector<double> v;
+    uint32_t t;
+    while (in.next(v, &t)) {
+        if (t != tid || v.empty())
+            continue;
+        if (data.d == 0) {
+            data.d = v.size();
+            data.stride = (data.d + 3) & ~(size_t)3;
+        }
+        if (v.size() != data.d) {
+            std::cerr << "interval " << data.n << " has " << v.size() << " values, expect " << data.d << std::endl;
+            exit(-1);
+        }
+
+        double samples = 0;
+        for (size_t j = 0; j < v.size(); ++j)
+            samples += std::abs(v[j]);
+        for (size_t j = 0; j < v.size(); ++j)
+            data.rows.push_back(samples > 0 ? v[j] / samples : 0);
+        data.rows.resize(data.rows.size() + data.stride - data.d, 0);
+        ++data.n;
+    }
+
+    if (data.n == 0) {
+        std::cerr << "no interval of thread " << tid << " in " << input << std::endl;
+        exit(-1);
+    }
+    if (metric == METRIC_COS)
+        for (size_t i = 0; i < data.n; ++i)
+            data.norms.push_back(sqrt(Dist.dotProd(data.row(i), data.row(i), data.stride)));
+    /* an interval has n - 1 neighbors, with a single one its lines are empty */
+    const bool knnMode = topK > 0;
+    if (topK >= data.n) {
+        std::cerr << "-topk " << topK << " with " << data.n << " intervals, write " << data.n - 1
+                  << " neighbors each" << std::endl;
+        topK = data.n - 1;
+    }
+
+    if (knnMode) {
+        std::vector<std::pair<float, uint32_t> > knn;
+        if (topK > 0)
+            nearest(data, metric, tile, topK, threads, knn);
+
+        /* interval, then the pairs of neighbor and distance */
+        std::ofstream out(output.c_str());
+        if (out.fail()) {
+            std::cerr << "cannot open output file " << output << std::endl;
+            exit(-1);
+        }
+        for (size_t i = 0; i < data.n; ++i) {
+            out << i;
+            for (size_t c = 0; c < topK; ++c)
+                out << " " << knn[i * topK + c].second << " " << knn[i * topK + c].first;
+            out << "\n";
+        }
+        out.close();
+    }
+    else {
+        DistHeader hdr;
+        memset(&hdr, 0, sizeof(hdr));
+        memcpy(hdr.magic, "BBVD", 4);
+        hdr.version = 1;
+        hdr.metric = metric;
+        hdr.n = data.n;
+        hdr.offset = sizeof(hdr);
+
+        size_t bytes = sizeof(hdr) + data.n * data.n * sizeof(float);
+        int fd = open(output.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0 || ftruncate(fd, bytes) != 0) {
+            std::cerr << "cannot open output file " << output << std::endl;
+            exit(-1);
+        }
+        void * map = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED) {
+            std::cerr << "cannot map " << bytes << " bytes of " << output << std::endl;
+            exit(-1);
+        }
+        memcpy(map, &hdr, sizeof(hdr));
+        fullMatrix(data, metric, tile, threads, (float *)((char *)map + sizeof(hdr)));
+        munmap(map, bytes);
+        close(fd);
+    }
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double pairs = knnMode ? (double)data.n * (data.n - 1) : (double)data.n * (data.n - 1) / 2;
+    std::cout << "intervals " << data.n << " dimensions " << data.d << " pairs " << pairs
+              << " isa " << isaName(isa) << " time " << secs << "s" << std::endl;
+    return 0;
+}
@@ -0,0 +1,871 @@
+#ifndef __BBV_FORMAT_H__
+#define __BBV_FORMAT_H__
+
+/*
+ *  The BBV stream shared by the pintool and the offline tools, it has no
+ *  dependency on Pin. A binary stream is a header followed by frames:
+ *
+ *  header: "BBVS", version, K, record format, compression, interval unit,
+ *          interval size, projection seed, PID and parent PID of the
+ *          process (48 bytes)
+ *  frame:  raw size, stored size, number of records (u32 each), payload
+ *
+ *  A record is the guest thread ID and K values, as u32 and float32 or as
+ *  zigzag varints. A frame is LZ-compressed when it got smaller,
+ *  otherwise stored size equals raw size. The text stream is the old
+ *  format, one line of K values per interval, the records of thread T > 0
+ *  go to a file of their own with ".T" appended to the name.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+enum RecordFormat { FMT_TEXT = 0, FMT_FLOAT = 1, FMT_VARINT = 2 };
+
+enum IntervalUnit { UNIT_MEMREF = 0, UNIT_INST = 1, UNIT_BRANCH = 2 };
+
+/* 
+ * a counting site of the instrumentation: a BBL with one call, or one
+ * instruction of a BBL instrumented per instruction. The clock units
+ * before and after the BB is sampled follow from its counts, so a
+ * recorded trace replays under any interval clock.
+ */
+struct CountSite
+{
+    uint32_t bbId;
+    uint32_t numInsts;
+    /* memory refs of the head instructions and of the tail one */
+    uint32_t memHead;
+    uint32_t memTail;
+    /* the tail is a branch/call/ret, the BB is sampled */
+    bool isBranch;
+    /* the projection key of the BB */
+    uint64_t key;
+
+    uint32_t unitHead(IntervalUnit u) const
+    {
+        if (u == UNIT_INST)
+            return numInsts - isBranch;
+        if (u == UNIT_MEMREF)
+            return isBranch ? memHead : memHead + memTail;
+        return 0;
+    }
+
+    uint32_t unitTail(IntervalUnit u) const
+    {
+        if (!isBranch)
+            return 0;
+        return u == UNIT_MEMREF ? memTail : 1;
+    }
+};
+
+static const char BBVMagic[4] = {'B', 'B', 'V', 'S'};
+static const uint32_t BBVVersion = 2;
+static const uint32_t BBVHeaderSize = 48;
+/* the raw bytes of a frame before it is flushed */
+static const size_t BBVFrameSize = 64 * 1024;
+
+struct BBVHeader
+{
+    uint32_t version;
+    uint32_t k;
+    uint32_t format;
+    uint32_t compress;
+    uint32_t unit;
+    uint64_t intervalSize;
+    uint64_t seed;
+    /* the process of the stream, 0 if unknown */
+    uint32_t pid;
+    uint32_t ppid;
+
+    BBVHeader() : version(BBVVersion), k(0), format(FMT_FLOAT), compress(0),
+        unit(UNIT_MEMREF), intervalSize(0), seed(0), pid(0), ppid(0) {};
+};
+
+/* little-endian helpers, the hosts we run on are all little-endian */
+inline void put32(std::vector<uint8_t> & buf, uint32_t v)
+{
+    buf.insert(buf.end(), (uint8_t *)&v, (uint8_t *)&v + 4);
+}
+
+inline void put64(std::vector<uint8_t> & buf, uint64_t v)
+{
+    buf.insert(buf.end(), (uint8_t *)&v, (uint8_t *)&v + 8);
+}
+
+inline uint32_t get32(const uint8_t * p) { uint32_t v; memcpy(&v, p, 4); return v; }
+
+inline uint64_t get64(const uint8_t * p) { uint64_t v; memcpy(&v, p, 8); return v; }
+
+inline void putVarint(std::vector<uint8_t> & buf, int64_t v)
+{
+    /* zigzag, small magnitudes get short codes */
+    uint64_t u = ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+    while (u >= 0x80) {
+        buf.push_back((uint8_t)(u | 0x80));
+        u >>= 7;
+    }
+    buf.push_back((uint8_t)u);
+}
+
+inline int64_t getVarint(const uint8_t *& p, const uint8_t * end)
+{
+    uint64_t u = 0;
+    for (int shift = 0; p < end && shift < 64; shift += 7) {
+        uint8_t b = *p++;
+        u |= (uint64_t)(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            break;
+    }
+    return (int64_t)(u >> 1) ^ -(int64_t)(u & 1);
+}
+
+/*
+ * LZ4-style block compression: a token holds the literal length and the
+ * match length in 4 bits each, 15 means more length bytes follow, then
+ * the literals and a 16-bit match offset. The last sequence has no match.
+ */
+inline void lzPutLength(std::vector<uint8_t> & out, size_t len)
+{
+    for (; len >= 255; len -= 255)
+        out.push_back(255);
+    out.push_back((uint8_t)len);
+}
+
+inline void lzCompress(const uint8_t * src, size_t n, std::vector<uint8_t> & out)
+{
+    const int HashBits = 12;
+    int32_t table[1 << HashBits];
+    for (int i = 0; i < (1 << HashBits); ++i)
+        table[i] = -1;
+
+    size_t i = 0, anchor = 0;
+    while (i + 4 <= n) {
+        uint32_t seq = get32(src + i);
+        uint32_t h = (seq * 2654435761U) >> (32 - HashBits);
+        int32_t ref = table[h];
+        table[h] = (int32_t)i;
+
+        if (ref < 0 || i - ref > 65535 || get32(src + ref) != seq) {
+            ++i;
+            continue;
+        }
+
+        size_t m = 4;
+        while (i + m < n && src[ref + m] == src[i + m])
+            ++m;
+
+        size_t lit = i - anchor;
+        out.push_back((uint8_t)(((lit < 15 ? lit : 15) << 4) | (m - 4 < 15 ? m - 4 : 15)));
+        if (lit >= 15)
+            lzPutLength(out, lit - 15);
+        out.insert(out.end(), src + anchor, src + i);
+        out.push_back((uint8_t)(i - ref));
+        out.push_back((uint8_t)((i - ref) >> 8));
+        if (m - 4 >= 15)
+            lzPutLength(out, m - 4 - 15);
+
+        i += m;
+        anchor = i;
+    }
+
+    /* the last literals */
+    size_t lit = n - anchor;
+    out.push_back((uint8_t)((lit < 15 ? lit : 15) << 4));
+    if (lit >= 15)
+        lzPutLength(out, lit - 15);
+    out.insert(out.end(), src + anchor, src + n);
+}
+
+inline bool lzDecompress(const uint8_t * ip, size_t n, std::vector<uint8_t> & out)
+{
+    const uint8_t * end = ip + n;
+    while (ip < end) {
+        uint8_t token = *ip++;
+        size_t lit = token >> 4;
+        if (lit == 15) {
+            uint8_t b;
+            do {
+                if (ip >= end) return false;
+                b = *ip++;
+                lit += b;
+            } while (b == 255);
+        }
+        if ((size_t)(end - ip) < lit)
+            return false;
+        out.insert(out.end(), ip, ip + lit);
+        ip += lit;
+        if (ip == end)
+            break;
+
+        if (end - ip < 2)
+            return false;
+        size_t off = ip[0] | (ip[1] << 8);
+        ip += 2;
+        size_t m = token & 15;
+        if (m == 15) {
+            uint8_t b;
+            do {
+                if (ip >= end) return false;
+                b = *ip++;
+                m += b;
+            } while (b == 255);
+        }
+        m += 4;
+        if (off == 0 || off > out.size())
+            return false;
+        /* the match may overlap the bytes it produces */
+        size_t from = out.size() - off;
+        for (size_t j = 0; j < m; ++j)
+            out.push_back(out[from + j]);
+    }
+    return true;
+}
+
+/*
+ * a lock-free single-producer single-consumer ring of interval records,
+ * every slot holds k doubles. The producer fills claim() in place and
+ * publishes it, the consumer reads front() in place and pops it.
+ */
+class RecordRing
+{
+    double * slots;
+    uint64_t * ids;
+    uint32_t * tids;
+    int k;
+    uint64_t mask;
+
+    /* written by the consumer and the producer, on their own cache lines */
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+
+public:
+    RecordRing() : slots(nullptr), ids(nullptr), tids(nullptr), k(0), mask(0), head(0), tail(0) {};
+
+    /* cap must be a power of 2 */
+    void init(int rows, uint64_t cap)
+    {
+        k = rows;
+        mask = cap - 1;
+        slots = new double[cap * k];
+        ids = new uint64_t[cap];
+        tids = new uint32_t[cap];
+    }
+
+    ~RecordRing()
+    {
+        delete [] slots;
+        delete [] ids;
+        delete [] tids;
+    }
+
+    /* the slot to fill, nullptr when the ring is full */
+    double * claim()
+    {
+        uint64_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) > mask)
+            return nullptr;
+        return slots + (t & mask) * k;
+    }
+
+    void publish(uint64_t interval, uint32_t tid)
+    {
+        uint64_t t = tail.load(std::memory_order_relaxed);
+        ids[t & mask] = interval;
+        tids[t & mask] = tid;
+        tail.store(t + 1, std::memory_order_release);
+    }
+
+    /* the oldest record, nullptr when the ring is empty */
+    const double * front(uint64_t & interval, uint32_t & tid)
+    {
+        uint64_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire))
+            return nullptr;
+        interval = ids[h & mask];
+        tid = tids[h & mask];
+        return slots + (h & mask) * k;
+    }
+
+    void pop() { head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    /* drop the records not read yet, nobody may use the ring meanwhile */
+    void clear() { head.store(tail.load()); }
+};
+
+/* writes a text or binary BBV stream */
+class BBVWriter
+{
+    std::ofstream file;
+    /* the text files of threads other than 0 */
+    std::vector<std::ofstream *> threadFiles;
+    std::string name;
+    BBVHeader hdr;
+    std::vector<uint8_t> frame;
+    std::vector<uint8_t> packed;
+    uint32_t frameRecords;
+    uint64_t _bytes;
+
+    void flushFrame()
+    {
+        if (frameRecords == 0)
+            return;
+
+        const std::vector<uint8_t> * payload = &frame;
+        if (hdr.compress) {
+            packed.clear();
+            lzCompress(frame.data(), frame.size(), packed);
+            if (packed.size() < frame.size())
+                payload = &packed;
+        }
+
+        std::vector<uint8_t> fh;
+        put32(fh, (uint32_t)frame.size());
+        put32(fh, (uint32_t)payload->size());
+        put32(fh, frameRecords);
+        file.write((const char *)fh.data(), fh.size());
+        file.write((const char *)payload->data(), payload->size());
+        _bytes += fh.size() + payload->size();
+
+        frame.clear();
+        frameRecords = 0;
+    }
+
+public:
+    BBVWriter() : frameRecords(0), _bytes(0) {};
+
+    ~BBVWriter() { close(); }
+
+    bool open(const std::string & fileName, const BBVHeader & h)
+    {
+        hdr = h;
+        name = fileName;
+        file.open(name.c_str(), std::ios::out | std::ios::binary);
+        if (file.fail())
+            return false;
+
+        if (hdr.format != FMT_TEXT) {
+            std::vector<uint8_t> buf(BBVMagic, BBVMagic + 4);
+            put32(buf, hdr.version);
+            put32(buf, hdr.k);
+            put32(buf, hdr.format);
+            put32(buf, hdr.compress);
+            put32(buf, hdr.unit);
+            put64(buf, hdr.intervalSize);
+            put64(buf, hdr.seed);
+            put32(buf, hdr.pid);
+            put32(buf, hdr.ppid);
+            file.write((const char *)buf.data(), buf.size());
+            _bytes = buf.size();
+        }
+        return true;
+    }
+
+    void write(uint32_t tid, const double * v)
+    {
+        if (hdr.format == FMT_TEXT) {
+            std::ofstream * out = &file;
+            if (tid > 0) {
+                if (threadFiles.size() < tid)
+                    threadFiles.resize(tid, nullptr);
+                if (threadFiles[tid - 1] == nullptr) {
+                    std::ostringstream tname;
+                    tname << name << "." << tid;
+                    threadFiles[tid - 1] = new std::ofstream(tname.str().c_str(), std::ios::out);
+                }
+                out = threadFiles[tid - 1];
+            }
+
+            /* the same text as Histogram::print, counts keep all their digits */
+            for (uint32_t i = 0; i < hdr.k; ++i) {
+                if (fabs(v[i]) < 9e18 && v[i] == (double)(int64_t)v[i])
+                    *out << (int64_t)v[i] << " ";
+                else
+                    *out << v[i] << " ";
+            }
+            *out << "\n";
+            return;
+        }
+
+        if (hdr.format == FMT_FLOAT) {
+            put32(frame, tid);
+            for (uint32_t i = 0; i < hdr.k; ++i) {
+                float f = (float)v[i];
+                frame.insert(frame.end(), (uint8_t *)&f, (uint8_t *)&f + 4);
+            }
+        }
+        else {
+            putVarint(frame, tid);
+            for (uint32_t i = 0; i < hdr.k; ++i)
+                putVarint(frame, llround(v[i]));
+        }
+
+        ++frameRecords;
+        if (frame.size() >= BBVFrameSize)
+            flushFrame();
+    }
+
+    /* bytes written to the file so far */
+    const uint64_t bytes() const { return _bytes; }
+
+    /* push the open frame and the buffered text to the files */
+    void flush()
+    {
+        if (hdr.format != FMT_TEXT)
+            flushFrame();
+        file.flush();
+        for (size_t i = 0; i < threadFiles.size(); ++i)
+            if (threadFiles[i])
+                threadFiles[i]->flush();
+    }
+
+    /* the sizes of the file and of the text files of threads 1.., after flush() */
+    std::vector<uint64_t> offsets()
+    {
+        std::vector<uint64_t> off(1, hdr.format == FMT_TEXT ? (uint64_t)file.tellp() : _bytes);
+        for (size_t i = 0; i < threadFiles.size(); ++i)
+            off.push_back(threadFiles[i] ? (uint64_t)threadFiles[i]->tellp() : 0);
+        return off;
+    }
+
+    /* 
+     * reopen the stream of an aborted run at the offsets() of a checkpoint,
+     * the records written after it are cut off
+     */
+    bool resume(const std::string & fileName, const BBVHeader & h, const std::vector<uint64_t> & off)
+    {
+        hdr = h;
+        name = fileName;
+        if (off.empty() || truncate(name.c_str(), off[0]) != 0)
+            return false;
+        file.open(name.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+        if (file.fail())
+            return false;
+        file.seekp(0, std::ios::end);
+        _bytes = off[0];
+
+        /* a thread file is created again at its first record */
+        for (size_t i = 1; i < off.size(); ++i) {
+            std::ostringstream tname;
+            tname << name << "." << i;
+            threadFiles.push_back(nullptr);
+            if (off[i] == 0 || truncate(tname.str().c_str(), off[i]) != 0)
+                continue;
+            threadFiles.back() = new std::ofstream(tname.str().c_str(), std::ios::out | std::ios::app);
+        }
+        return true;
+    }
+
+    void close()
+    {
+        if (!file.is_open())
+            return;
+        if (hdr.format != FMT_TEXT)
+            flushFrame();
+        file.close();
+
+        for (size_t i = 0; i < threadFiles.size(); ++i)
+            delete threadFiles[i];
+        threadFiles.clear();
+    }
+};
+
+/* reads a text or binary BBV stream, the kind is told by the magic */
+class BBVReader
+{
+    std::ifstream file;
+    BBVHeader hdr;
+    bool binary;
+    std::vector<uint8_t> frame;
+    std::vector<uint8_t> packed;
+    const uint8_t * pos;
+    uint32_t frameRecords;
+
+    bool readFrame()
+    {
+        uint8_t fh[12];
+        if (!file.read((char *)fh, sizeof(fh)))
+            return false;
+
+        uint32_t rawSize = get32(fh), storedSize = get32(fh + 4);
+        frameRecords = get32(fh + 8);
+        /* a float record is the thread and K floats, a frame of another size is corrupt */
+        if (hdr.format == FMT_FLOAT && (uint64_t)frameRecords * (4 + 4 * (uint64_t)hdr.k) != rawSize)
+            return false;
+
+        packed.resize(storedSize);
+        if (!file.read((char *)packed.data(), storedSize))
+            return false;
+
+        if (storedSize == rawSize)
+            frame.swap(packed);
+        else {
+            frame.clear();
+            if (!lzDecompress(packed.data(), storedSize, frame) || frame.size() != rawSize)
+                return false;
+        }
+        pos = frame.data();
+        return true;
+    }
+
+public:
+    BBVReader() : binary(false), pos(nullptr), frameRecords(0) {};
+
+    bool open(const std::string & name)
+    {
+        file.open(name.c_str(), std::ios::in | std::ios::binary);
+        if (file.fail())
+            return false;
+
+        uint8_t buf[BBVHeaderSize];
+        binary = file.read((char *)buf, BBVHeaderSize) && memcmp(buf, BBVMagic, 4) == 0;
+        if (!binary) {
+            /* a text stream, K is the number of values in a line */
+            file.clear();
+            file.seekg(0);
+            hdr = BBVHeader();
+            hdr.format = FMT_TEXT;
+            return true;
+        }
+
+        hdr.version = get32(buf + 4);
+        hdr.k = get32(buf + 8);
+        hdr.format = get32(buf + 12);
+        hdr.compress = get32(buf + 16);
+        hdr.unit = get32(buf + 20);
+        hdr.intervalSize = get64(buf + 24);
+        hdr.seed = get64(buf + 32);
+        hdr.pid = get32(buf + 40);
+        hdr.ppid = get32(buf + 44);
+        return hdr.version == BBVVersion;
+    }
+
+    const BBVHeader & header() const { return hdr; }
+
+    const bool isBinary() const { return binary; }
+
+    /* the next interval and its thread, false at the end of the stream */
+    bool next(std::vector<double> & v, uint32_t * tid = nullptr)
+    {
+        if (tid)
+            *tid = 0;
+
+        if (!binary) {
+            std::string line;
+            do {
+                if (!std::getline(file, line))
+                    return false;
+            } while (line.find_first_not_of(" \t\r") == std::string::npos);
+
+            std::istringstream ss(line);
+            v.clear();
+            for (double x; ss >> x; )
+                v.push_back(x);
+            hdr.k = v.size();
+            return true;
+        }
+
+        while (frameRecords == 0)
+            if (!readFrame())
+                return false;
+
+        const uint8_t * end = frame.data() + frame.size();
+        uint32_t t;
+        if (hdr.format == FMT_FLOAT) {
+            /* a short frame ends the stream */
+            if (end - pos < 4)
+                return false;
+            t = get32(pos);
+            pos += 4;
+        }
+        else
+            t = (uint32_t)getVarint(pos, end);
+        if (tid)
+            *tid = t;
+
+        v.resize(hdr.k);
+        for (uint32_t i = 0; i < hdr.k; ++i) {
+            if (hdr.format == FMT_FLOAT) {
+                float f;
+                if (end - pos < 4)
+                    return false;
+                memcpy(&f, pos, 4);
+                pos += 4;
+                v[i] = f;
+            }
+            else
+                v[i] = (double)getVarint(pos, end);
+        }
+        --frameRecords;
+        return true;
+    }
+};
+
+/*
+ *  The BB trace of bbvTrace -record, replayed by bbvReplay: "BBVT" and a
+ *  version, then records of
+ *
+ *  'S' site:   varints of site ID, BB ID, insts, head and tail memory refs,
+ *              branch, then the BB key as 8 bytes
+ *  'E' events: varints of the thread ID and the byte count, then the site
+ *              IDs run by that thread as varint deltas from the previous one
+ *
+ *  A site is written at instrumentation time, before any events run it.
+ */
+static const char TraceMagic[4] = {'B', 'B', 'V', 'T'};
+static const uint32_t TraceVersion = 2;
+
+class TraceWriter
+{
+    std::ofstream file;
+    std::vector<uint8_t> buf;
+
+public:
+    bool open(const std::string & name)
+    {
+        file.open(name.c_str(), std::ios::out | std::ios::binary);
+        if (file.fail())
+            return false;
+        buf.assign(TraceMagic, TraceMagic + 4);
+        put32(buf, TraceVersion);
+        file.write((const char *)buf.data(), buf.size());
+        return true;
+    }
+
+    void site(uint32_t id, const CountSite & s)
+    {
+        buf.assign(1, 'S');
+        putVarint(buf, id);
+        putVarint(buf, s.bbId);
+        putVarint(buf, s.numInsts);
+        putVarint(buf, s.memHead);
+        putVarint(buf, s.memTail);
+        putVarint(buf, s.isBranch);
+        put64(buf, s.key);
+        file.write((const char *)buf.data(), buf.size());
+    }
+
+    /* data holds the encoded events of thread tid */
+    void events(uint32_t tid, const std::vector<uint8_t> & data)
+    {
+        buf.assign(1, 'E');
+        putVarint(buf, tid);
+        putVarint(buf, data.size());
+        file.write((const char *)buf.data(), buf.size());
+        file.write((const char *)data.data(), data.size());
+    }
+
+    void flush() { file.flush(); }
+
+    void close() { file.close(); }
+};
+
+class TraceReader
+{
+    std::ifstream file;
+    std::vector<CountSite> _sites;
+    std::vector<uint8_t> chunk;
+
+    /* a varint straight from the file */
+    bool readVarint(int64_t & v)
+    {
+        uint8_t b[10];
+        int n = 0;
+        do {
+            if (n == 10 || !file.read((char *)&b[n], 1))
+                return false;
+        } while (b[n++] & 0x80);
+        const uint8_t * p = b;
+        v = getVarint(p, b + n);
+        return true;
+    }
+
+public:
+    bool open(const std::string & name)
+    {
+        file.open(name.c_str(), std::ios::in | std::ios::binary);
+        uint8_t buf[8];
+        return file.read((char *)buf, 8) && memcmp(buf, TraceMagic, 4) == 0
+            && get32(buf + 4) == TraceVersion;
+    }
+
+    /* the sites read so far, indexed by site ID */
+    const std::vector<CountSite> & sites() const { return _sites; }
+
+    /* the site IDs of the next events record and their thread, false at the end */
+    bool next(uint32_t & tid, std::vector<uint32_t> & ids)
+    {
+        char tag;
+        int64_t v[6];
+        while (file.get(tag)) {
+            if (tag == 'S') {
+                uint8_t key[8];
+                for (int i = 0; i < 6; ++i)
+                    if (!readVarint(v[i]))
+                        return false;
+                if (!file.read((char *)key, 8))
+                    return false;
+                if (_sites.size() <= (uint64_t)v[0])
+                    _sites.resize(v[0] + 1);
+                CountSite & s = _sites[v[0]];
+                s.bbId = v[1];
+                s.numInsts = v[2];
+                s.memHead = v[3];
+                s.memTail = v[4];
+                s.isBranch = v[5] != 0;
+                s.key = get64(key);
+                continue;
+            }
+
+            if (tag != 'E' || !readVarint(v[0]) || !readVarint(v[1]))
+                return false;
+            tid = v[0];
+            chunk.resize(v[1]);
+            if (!file.read((char *)chunk.data(), chunk.size()))
+                return false;
+
+            ids.clear();
+            int64_t id = 0;
+            for (const uint8_t * p = chunk.data(), * end = p + chunk.size(); p < end; ) {
+                id += getVarint(p, end);
+                ids.push_back((uint32_t)id);
+            }
+            return true;
+        }
+        return false;
+    }
+};
+
+/*
+ *  The checkpoint of bbvTrace -ckpt, a run restarted with -resume
+ *  fast-forwards to its instruction count and appends to the outputs at
+ *  its offsets: "BBVC", a version, then varints of
+ *
+ *  K, interval unit, interval size, projection seed, instructions,
+ *  intervals written, the last interval of every thread, the offsets()
+ *  of the BBV and reuse distance streams, the size of the interval
+ *  stats, the BB count, then the keys of the BBs in ID order as 8 bytes
+ *
+ *  It is written to a temporary file renamed over the last one, so a
+ *  crash leaves either the old or the new checkpoint.
+ */
+static const char CkptMagic[4] = {'B', 'B', 'V', 'C'};
+static const uint32_t CkptVersion = 3;
+
+struct Checkpoint
+{
+    uint32_t k;
+    uint32_t unit;
+    uint64_t intervalSize;
+    uint64_t seed;
+    uint64_t insts;
+    uint64_t intervals;
+    std::vector<uint64_t> threadIntervals;
+    std::vector<uint64_t> bbvOffsets;
+    std::vector<uint64_t> rdOffsets;
+    uint64_t istatOffset;
+    std::vector<uint64_t> keys;
+
+    Checkpoint() : k(0), unit(UNIT_MEMREF), intervalSize(0), seed(0), insts(0),
+        intervals(0), istatOffset(0) {};
+
+    /* false if the stream was written with other options */
+    bool matches(const BBVHeader & h) const
+    {
+        return k == h.k && unit == h.unit && intervalSize == h.intervalSize && seed == h.seed;
+    }
+
+    bool save(const std::string & name) const
+    {
+        std::vector<uint8_t> buf(CkptMagic, CkptMagic + 4);
+        put32(buf, CkptVersion);
+        putVarint(buf, k);
+        putVarint(buf, unit);
+        putVarint(buf, intervalSize);
+        putVarint(buf, seed);
+        putVarint(buf, insts);
+        putVarint(buf, intervals);
+        const std::vector<uint64_t> * lists[3] = {&threadIntervals, &bbvOffsets, &rdOffsets};
+        for (int l = 0; l < 3; ++l) {
+            putVarint(buf, lists[l]->size());
+            for (size_t i = 0; i < lists[l]->size(); ++i)
+                putVarint(buf, (*lists[l])[i]);
+        }
+        putVarint(buf, istatOffset);
+        putVarint(buf, keys.size());
+        for (size_t i = 0; i < keys.size(); ++i)
+            put64(buf, keys[i]);
+
+        /* the data is on disk before the rename, the rename before we return */
+        std::string tmp = name + ".tmp";
+        int fd = open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+            return false;
+        for (size_t done = 0; done < buf.size(); ) {
+            ssize_t n = write(fd, buf.data() + done, buf.size() - done);
+            if (n <= 0) {
+                close(fd);
+                return false;
+            }
+            done += n;
+        }
+        if (fsync(fd) != 0 || close(fd) != 0 || rename(tmp.c_str(), name.c_str()) != 0)
+            return false;
+
+        size_t slash = name.rfind('/');
+        std::string dir = slash == std::string::npos ? "." : (slash == 0 ? "/" : name.substr(0, slash));
+        int dirFd = open(dir.c_str(), O_RDONLY);
+        if (dirFd < 0)
+            return false;
+        bool synced = fsync(dirFd) == 0;
+        close(dirFd);
+        return synced;
+    }
+
+    bool load(const std::string & name)
+    {
+        std::ifstream file(name.c_str(), std::ios::in | std::ios::binary);
+        std::vector<uint8_t> buf((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (buf.size() < 8 || memcmp(buf.data(), CkptMagic, 4) != 0 || get32(buf.data() + 4) != CkptVersion)
+            return false;
+
+        const uint8_t * p = buf.data() + 8, * end = buf.data() + buf.size();
+        k = getVarint(p, end);
+        unit = getVarint(p, end);
+        intervalSize = getVarint(p, end);
+        seed = getVarint(p, end);
+        insts = getVarint(p, end);
+        intervals = getVarint(p, end);
+        std::vector<uint64_t> * lists[3] = {&threadIntervals, &bbvOffsets, &rdOffsets};
+        /* every value takes a byte at least, a larger count is a broken file */
+        for (int l = 0; l < 3; ++l) {
+            uint64_t count = getVarint(p, end);
+            if (count > (uint64_t)(end - p))
+                return false;
+            lists[l]->resize(count);
+            for (size_t i = 0; i < lists[l]->size(); ++i)
+                (*lists[l])[i] = getVarint(p, end);
+        }
+        istatOffset = getVarint(p, end);
+        uint64_t n = getVarint(p, end);
+        if ((uint64_t)(end - p) % 8 != 0 || (uint64_t)(end - p) / 8 != n)
+            return false;
+        keys.resize(n);
+        for (size_t i = 0; i < keys.size(); ++i, p += 8)
+            keys[i] = get64(p);
+        return true;
+    }
+};
+
+#endif
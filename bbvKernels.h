@@ -0,0 +1,96 @@
+#ifndef __BBV_KERNELS_H__
+#define __BBV_KERNELS_H__
+
+/*
+ *  The distance kernels of the offline tools over rows of doubles, of
+ *  one instruction set like bbvProject.h: bbvCore.cpp includes them with
+ *  the flags of the build and bbvCoreAvx2.cpp with -mavx2, bbvCluster and
+ *  bbvDist get them from distKernels. Every kernel sums 4 lanes, the
+ *  elements i, i + 4, ... of lane i % 4, adds the lanes as the AVX2 loop
+ *  does and the tail after them, so the scalar loop is the reference the
+ *  AVX2 one matches to the bit.
+ */
+
+#include "bbvCore.h"
+#include <stddef.h>
+#include <math.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+static inline double sumLanes(const double * lane)
+{
+    return (lane[0] + lane[2]) + (lane[1] + lane[3]);
+}
+
+/* the squared euclidean distance */
+static double sqDist(const double * a, const double * b, size_t d)
+{
+    size_t i = 0;
+    double lane[4] = {0, 0, 0, 0};
+#if defined(__AVX2__)
+    __m256d acc = _mm256_setzero_pd();
+    for (; i + 4 <= d; i += 4) {
+        __m256d diff = _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(diff, diff));
+    }
+    _mm256_storeu_pd(lane, acc);
+#else
+    for (; i + 4 <= d; i += 4)
+        for (int l = 0; l < 4; ++l)
+            lane[l] += (a[i + l] - b[i + l]) * (a[i + l] - b[i + l]);
+#endif
+    double sum = sumLanes(lane);
+    for (; i < d; ++i)
+        sum += (a[i] - b[i]) * (a[i] - b[i]);
+    return sum;
+}
+
+/* the manhattan distance, the sign bit is masked off */
+static double l1Dist(const double * a, const double * b, size_t d)
+{
+    size_t i = 0;
+    double lane[4] = {0, 0, 0, 0};
+#if defined(__AVX2__)
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    __m256d acc = _mm256_setzero_pd();
+    for (; i + 4 <= d; i += 4) {
+        __m256d diff = _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+        acc = _mm256_add_pd(acc, _mm256_andnot_pd(sign, diff));
+    }
+    _mm256_storeu_pd(lane, acc);
+#else
+    for (; i + 4 <= d; i += 4)
+        for (int l = 0; l < 4; ++l)
+            lane[l] += fabs(a[i + l] - b[i + l]);
+#endif
+    double sum = sumLanes(lane);
+    for (; i < d; ++i)
+        sum += fabs(a[i] - b[i]);
+    return sum;
+}
+
+static double dotProd(const double * a, const double * b, size_t d)
+{
+    size_t i = 0;
+    double lane[4] = {0, 0, 0, 0};
+#if defined(__AVX2__)
+    __m256d acc = _mm256_setzero_pd();
+    for (; i + 4 <= d; i += 4)
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    _mm256_storeu_pd(lane, acc);
+#else
+    for (; i + 4 <= d; i += 4)
+        for (int l = 0; l < 4; ++l)
+            lane[l] += a[i + l] * b[i + l];
+#endif
+    double sum = sumLanes(lane);
+    for (; i < d; ++i)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+/* the kernels of bbvCoreAvx2.cpp, null if the compiler could not build them */
+DistKernels distKernelsAvx2();
+
+#endif
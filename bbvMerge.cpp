@@ -0,0 +1,163 @@
+/*
+ *  Merge the per-process BBV streams of a bbvTrace run that forked or
+ *  exec'd children, or of the several invocations of a benchmark, into
+ *  one stream. The BBs are keyed by image and offset, so the same BB has
+ *  the same projection in every process and the intervals are comparable.
+ *  Every guest thread of every input becomes a thread of the merged
+ *  stream, and <output>.weights gives each interval its weight in the
+ *  whole profile: the weight of its input over the weighted interval
+ *  count of all inputs.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <stdlib.h>
+#include "bbvFormat.h"
+
+static void usage(const char * name)
+{
+    std::cerr << "usage: " << name << " [options] <binary BBV stream>...\n"
+              << "  -w w1,w2,..  the weight of each input (1 each)\n"
+              << "  -format f    output format: text, float or varint (float)\n"
+              << "  -compress    compress the frames of a binary output\n"
+              << "  -o file      the merged stream, the weights go to file.weights (BBV.merged)\n";
+    exit(-1);
+}
+
+static BBVReader * openInput(const std::string & name)
+{
+    BBVReader * in = new BBVReader;
+    if (!in->open(name)) {
+        std::cerr << "cannot read BBV stream " << name << std::endl;
+        exit(-1);
+    }
+    return in;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string output = "BBV.merged", format = "float", weightList;
+    std::vector<std::string> inputs;
+    BBVHeader hdr;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (i + 1 < argc && arg == "-w")
+            weightList = argv[++i];
+        else if (i + 1 < argc && arg == "-format")
+            format = argv[++i];
+        else if (arg == "-compress")
+            hdr.compress = 1;
+        else if (i + 1 < argc && arg == "-o")
+            output = argv[++i];
+        else if (arg[0] != '-')
+            inputs.push_back(arg);
+        else
+            usage(argv[0]);
+    }
+    if (inputs.empty())
+        usage(argv[0]);
+
+    std::vector<double> weights(inputs.size(), 1);
+    for (size_t i = 0, pos = 0; pos < weightList.size(); ++i) {
+        size_t comma = std::min(weightList.find(',', pos), weightList.size());
+        if (i >= inputs.size())
+            usage(argv[0]);
+        weights[i] = atof(weightList.substr(pos, comma - pos).c_str());
+        pos = comma + 1;
+    }
+
+    if (format == "text")
+        hdr.format = FMT_TEXT;
+    else if (format == "float")
+        hdr.format = FMT_FLOAT;
+    else if (format == "varint")
+        hdr.format = FMT_VARINT;
+    else
+        usage(argv[0]);
+
+    /* the first pass counts the intervals and checks the inputs go together */
+    std::vector<uint64_t> counts(inputs.size(), 0);
+    uint32_t k = 0;
+    double total = 0;
+    std::vector<double> v;
+    for (size_t f = 0; f < inputs.size(); ++f) {
+        BBVReader * in = openInput(inputs[f]);
+        /* a text stream has no header to check, bbvConvert gives it one */
+        if (!in->isBinary()) {
+            std::cerr << inputs[f] << " is a text stream, its interval clock and projection seed are unknown, "
+                      << "convert it with bbvConvert" << std::endl;
+            exit(-1);
+        }
+        const BBVHeader & h = in->header();
+        if (f == 0) {
+            hdr.unit = h.unit;
+            hdr.intervalSize = h.intervalSize;
+            hdr.seed = h.seed;
+        }
+        else if (h.unit != hdr.unit || h.intervalSize != hdr.intervalSize || h.seed != hdr.seed) {
+            std::cerr << inputs[f] << " has another interval clock or projection seed than "
+                      << "the streams before it" << std::endl;
+            exit(-1);
+        }
+        while (in->next(v)) {
+            if (k == 0)
+                k = v.size();
+            if (v.size() != k) {
+                std::cerr << "interval " << counts[f] << " of " << inputs[f] << " has " << v.size()
+                          << " values, expect " << k << std::endl;
+                exit(-1);
+            }
+            ++counts[f];
+        }
+        total += weights[f] * counts[f];
+        delete in;
+    }
+    if (k == 0 || total <= 0) {
+        std::cerr << "no interval to merge" << std::endl;
+        exit(-1);
+    }
+
+    /* the merged stream comes from no process, its PIDs stay 0 */
+    hdr.k = k;
+
+    BBVWriter out;
+    std::ofstream weightOut((output + ".weights").c_str());
+    if (!out.open(output, hdr) || weightOut.fail()) {
+        std::cerr << "cannot open output file " << output << std::endl;
+        exit(-1);
+    }
+    weightOut << "# weight thread input pid tid\n";
+
+    /* the second pass numbers the threads of the inputs in order */
+    std::map<std::pair<size_t, uint32_t>, uint32_t> threads;
+    uint32_t tid;
+    for (size_t f = 0; f < inputs.size(); ++f) {
+        BBVReader * in = openInput(inputs[f]);
+        uint32_t pid = in->header().pid;
+        double w = weights[f] / total;
+        while (in->next(v, &tid)) {
+            std::pair<size_t, uint32_t> key(f, tid);
+            if (threads.find(key) == threads.end()) {
+                uint32_t t = threads.size();
+                threads[key] = t;
+                std::cout << "thread " << t << ": " << inputs[f] << " pid " << pid << " tid " << tid << std::endl;
+            }
+            out.write(threads[key], v.data());
+            weightOut << w << " " << threads[key] << " " << f << " " << pid << " " << tid << "\n";
+        }
+        delete in;
+    }
+    out.close();
+
+    uint64_t intervals = 0;
+    for (size_t f = 0; f < inputs.size(); ++f)
+        intervals += counts[f];
+    std::cout << "K " << k << " inputs " << inputs.size() << " threads " << threads.size()
+              << " intervals " << intervals << std::endl;
+    return 0;
+}
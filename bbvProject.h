@@ -0,0 +1,210 @@
+#ifndef __BBV_PROJECT_H__
+#define __BBV_PROJECT_H__
+
+/*
+ *  The projection kernels of one instruction set. bbvCore.cpp includes
+ *  them with the flags of the build, bbvCoreAvx2.cpp with -mavx2 and
+ *  bbvCoreAvx512.cpp with -mavx512f; everything here is static, so every
+ *  unit keeps its own copy, and ProjMatrix picks the unit the CPU runs
+ *  (see bestIsa). The units are built with -ffp-contract=off: without
+ *  FMA every ISA rounds the dense sums the same as projectGeneric.
+ */
+
+#include "bbvCore.h"
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+/* no FMA, so the vector lanes round the same as the scalar loop */
+static inline VOID addColumn(double * acc, const double * col, double count, int k)
+{
+    int i = 0;
+#if defined(__AVX512F__)
+    __m512d c8 = _mm512_set1_pd(count);
+    for (; i + 8 <= k; i += 8) {
+        __m512d a = _mm512_loadu_pd(acc + i);
+        a = _mm512_add_pd(a, _mm512_mul_pd(c8, _mm512_loadu_pd(col + i)));
+        _mm512_storeu_pd(acc + i, a);
+    }
+#elif defined(__AVX2__)
+    __m256d c4 = _mm256_set1_pd(count);
+    for (; i + 4 <= k; i += 4) {
+        __m256d a = _mm256_loadu_pd(acc + i);
+        a = _mm256_add_pd(a, _mm256_mul_pd(c4, _mm256_loadu_pd(col + i)));
+        _mm256_storeu_pd(acc + i, a);
+    }
+#endif
+    for (; i < k; ++i)
+        acc[i] += count * col[i];
+}
+
+/* any K, and the matrices of a K with no kernel of its own */
+static VOID projectAny(SparseBBV & bbv, const ProjMatrix & m, double * accu, Histogram<> & intAccu)
+{
+    const int k = m.rows();
+
+    /* compressing BBV, decrease the dimensions, only the touched BBs are projected */
+    if (m.isSparse() || m.isFixed()) {
+        /* integer adds, then convert once */
+        intAccu.clear();
+        for (int t = 0; t < bbv.touchedSize(); ++t) {
+            UINT32 id = bbv.touchedId(t);
+            m.project(&intAccu[0], id, bbv[id]);
+        }
+        const double scale = m.isFixed() ? 1.0 / (1 << ProjMatrix::FixedBits) : 1.0;
+        for (int i = 0; i < k; ++i)
+            accu[i] = (double)intAccu[i] * scale;
+    }
+    else {
+        for (int i = 0; i < k; ++i)
+            accu[i] = 0;
+        for (int t = 0; t < bbv.touchedSize(); ++t) {
+            UINT32 id = bbv.touchedId(t);
+            addColumn(accu, m.column(id), (double)bbv[id], k);
+        }
+    }
+
+    bbv.clear();
+}
+
+/* 
+ * the dense kernel of K rows, the K sums stay in vector registers across
+ * the touched BBs and are stored once; the adds are in the order of
+ * addColumn, so the results are the same to the bit
+ */
+template <int K>
+static VOID projectDense(SparseBBV & bbv, const ProjMatrix & m, double * accu, Histogram<> &)
+{
+#if defined(__AVX512F__)
+    __m512d acc[K / 8];
+    for (int r = 0; r < K / 8; ++r)
+        acc[r] = _mm512_setzero_pd();
+    for (int t = 0; t < bbv.touchedSize(); ++t) {
+        UINT32 id = bbv.touchedId(t);
+        const double * col = m.column(id);
+        __m512d c8 = _mm512_set1_pd((double)bbv[id]);
+        for (int r = 0; r < K / 8; ++r)
+            acc[r] = _mm512_add_pd(acc[r], _mm512_mul_pd(c8, _mm512_loadu_pd(col + 8 * r)));
+    }
+    for (int r = 0; r < K / 8; ++r)
+        _mm512_storeu_pd(accu + 8 * r, acc[r]);
+#elif defined(__AVX2__)
+    __m256d acc[K / 4];
+    for (int r = 0; r < K / 4; ++r)
+        acc[r] = _mm256_setzero_pd();
+    for (int t = 0; t < bbv.touchedSize(); ++t) {
+        UINT32 id = bbv.touchedId(t);
+        const double * col = m.column(id);
+        __m256d c4 = _mm256_set1_pd((double)bbv[id]);
+        for (int r = 0; r < K / 4; ++r)
+            acc[r] = _mm256_add_pd(acc[r], _mm256_mul_pd(c4, _mm256_loadu_pd(col + 4 * r)));
+    }
+    for (int r = 0; r < K / 4; ++r)
+        _mm256_storeu_pd(accu + 4 * r, acc[r]);
+#else
+    alignas(64) double acc[K] = {};
+    for (int t = 0; t < bbv.touchedSize(); ++t) {
+        UINT32 id = bbv.touchedId(t);
+        const double * col = m.column(id);
+        const double count = (double)bbv[id];
+        for (int i = 0; i < K; ++i)
+            acc[i] += count * col[i];
+    }
+    for (int i = 0; i < K; ++i)
+        accu[i] = acc[i];
+#endif
+    bbv.clear();
+}
+
+/* the sparse kernel of K rows, integer sums on the stack */
+template <int K>
+static VOID projectSparse(SparseBBV & bbv, const ProjMatrix & m, double * accu, Histogram<> &)
+{
+    alignas(64) int64_t acc[K] = {};
+    for (int t = 0; t < bbv.touchedSize(); ++t) {
+        UINT32 id = bbv.touchedId(t);
+        const int64_t count = bbv[id];
+        int num;
+        const UINT16 * col = m.sparseColumn(id, num);
+        for (int n = 0; n < num; ++n)
+            acc[col[n] >> 1] += (col[n] & 1) ? -count : count;
+    }
+    for (int i = 0; i < K; ++i)
+        accu[i] = (double)acc[i];
+    bbv.clear();
+}
+
+/* 
+ * the fixed-point kernel of K rows: the int32 entries are widened to
+ * 64-bit lanes and multiplied by the count, which has to fit 32 bits; a
+ * larger count is split at bit 31. The integer sums are exact, whatever
+ * the order of the BBs, and scaled back once.
+ */
+template <int K>
+static VOID projectFixed(SparseBBV & bbv, const ProjMatrix & m, double * accu, Histogram<> &)
+{
+    alignas(64) int64_t acc[K] = {};
+    for (int t = 0; t < bbv.touchedSize(); ++t) {
+        UINT32 id = bbv.touchedId(t);
+        const int64_t count = bbv[id];
+        const INT32 * col = m.fixedColumn(id);
+        const int64_t hi = count >> 31, lo = count & 0x7FFFFFFF;
+        assert(hi <= INT32_MAX);
+#if defined(__AVX512F__)
+        __m512i lo8 = _mm512_set1_epi64(lo), hi8 = _mm512_set1_epi64(hi);
+        for (int i = 0; i < K; i += 8) {
+            __m512i c = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)(col + i)));
+            __m512i p = _mm512_mul_epi32(lo8, c);
+            if (hi != 0)
+                p = _mm512_add_epi64(p, _mm512_slli_epi64(_mm512_mul_epi32(hi8, c), 31));
+            _mm512_store_si512((__m512i *)(acc + i), _mm512_add_epi64(_mm512_load_si512((const __m512i *)(acc + i)), p));
+        }
+#elif defined(__AVX2__)
+        __m256i lo4 = _mm256_set1_epi64x(lo), hi4 = _mm256_set1_epi64x(hi);
+        for (int i = 0; i < K; i += 4) {
+            __m256i c = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(col + i)));
+            __m256i p = _mm256_mul_epi32(lo4, c);
+            if (hi != 0)
+                p = _mm256_add_epi64(p, _mm256_slli_epi64(_mm256_mul_epi32(hi4, c), 31));
+            _mm256_store_si256((__m256i *)(acc + i), _mm256_add_epi64(_mm256_load_si256((const __m256i *)(acc + i)), p));
+        }
+#else
+        for (int i = 0; i < K; ++i)
+            acc[i] += (lo + (hi << 31)) * col[i];
+#endif
+    }
+    const double scale = 1.0 / (1 << ProjMatrix::FixedBits);
+    for (int i = 0; i < K; ++i)
+        accu[i] = (double)acc[i] * scale;
+    bbv.clear();
+}
+
+template <int K>
+static ProjMatrix::Kernel kernelOf(BOOL sparse, BOOL fixed)
+{
+    return sparse ? projectSparse<K> : (fixed ? projectFixed<K> : projectDense<K>);
+}
+
+/* picked once per matrix, so the K of the run is a compile-time constant of its kernel */
+static ProjMatrix::Kernel pickKernel(int k, BOOL sparse, BOOL fixed)
+{
+    switch (k) {
+    case 8:
+        return kernelOf<8>(sparse, fixed);
+    case 16:
+        return kernelOf<16>(sparse, fixed);
+    case 32:
+        return kernelOf<32>(sparse, fixed);
+    case 64:
+        return kernelOf<64>(sparse, fixed);
+    default:
+        return projectAny;
+    }
+}
+
+/* pickKernel of bbvCoreAvx2.cpp and bbvCoreAvx512.cpp, nullptr if the compiler could not build the ISA */
+ProjMatrix::Kernel pickKernelAvx2(int k, BOOL sparse, BOOL fixed);
+
+ProjMatrix::Kernel pickKernelAvx512(int k, BOOL sparse, BOOL fixed);
+
+#endif
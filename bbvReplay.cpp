@@ -0,0 +1,167 @@
+/*
+ *  Replay a BB trace of bbvTrace -record through the BBV pipeline of
+ *  bbvCore, without Pin. The intervals are cut by the IntervalClock of
+ *  the per-thread mode of bbvTrace, so the same options give the same
+ *  BBVs, and the time per event measures the counting and projection
+ *  alone.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include "bbvCore.h"
+#include "bbvFormat.h"
+
+/* the counters of a guest thread, as in the ThreadState of bbvTrace */
+struct ReplayThread
+{
+    IntervalClock clock;
+    SparseBBV bbv;
+    std::vector<double> accu;
+    Histogram<> intAccu;
+
+    ReplayThread(UINT64 intervalSize) : clock(intervalSize) {};
+};
+
+static void usage(const char * name)
+{
+    std::cerr << "usage: " << name << " [options] <BB trace>\n"
+              << "  -m k         the accumulator table size (16)\n"
+              << "  -i n         the interval size (10000000)\n"
+              << "  -clock c     the interval clock: ins, mem or br (mem)\n"
+              << "  -seed s      the seed of the random projection (1)\n"
+              << "  -sparse      use a {-1, 0, +1} sparse random projection\n"
+              << "  -fixed       project with a fixed-point int32 matrix\n"
+              << "  -format f    output format: text, float or varint (text)\n"
+              << "  -compress    compress the frames of a binary output\n"
+              << "  -o file      the BBV output (BBV.txt)\n";
+    exit(-1);
+}
+
+int main(int argc, char *argv[])
+{
+    uint64_t intervalSize = 10000000, seed = 1;
+    int k = 16;
+    bool sparse = false, fixed = false;
+    std::string output = "BBV.txt", input, clock = "mem", format = "text";
+    BBVHeader hdr;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (i + 1 < argc && arg == "-m")
+            k = atoi(argv[++i]);
+        else if (i + 1 < argc && arg == "-i")
+            intervalSize = strtoull(argv[++i], nullptr, 10);
+        else if (i + 1 < argc && arg == "-clock")
+            clock = argv[++i];
+        else if (i + 1 < argc && arg == "-seed")
+            seed = strtoull(argv[++i], nullptr, 10);
+        else if (arg == "-sparse")
+            sparse = true;
+        else if (arg == "-fixed")
+            fixed = true;
+        else if (i + 1 < argc && arg == "-format")
+            format = argv[++i];
+        else if (arg == "-compress")
+            hdr.compress = 1;
+        else if (i + 1 < argc && arg == "-o")
+            output = argv[++i];
+        else if (arg[0] != '-' && input.empty())
+            input = arg;
+        else
+            usage(argv[0]);
+    }
+    if (input.empty() || k < 1 || intervalSize == 0 || (sparse && k >= 32768) || (sparse && fixed))
+        usage(argv[0]);
+
+    IntervalUnit unit;
+    if (clock == "ins")
+        unit = UNIT_INST;
+    else if (clock == "mem")
+        unit = UNIT_MEMREF;
+    else if (clock == "br")
+        unit = UNIT_BRANCH;
+    else
+        usage(argv[0]);
+
+    if (format == "text")
+        hdr.format = FMT_TEXT;
+    else if (format == "float")
+        hdr.format = FMT_FLOAT;
+    else if (format == "varint")
+        hdr.format = FMT_VARINT;
+    else
+        usage(argv[0]);
+    hdr.k = k;
+    hdr.unit = unit;
+    hdr.intervalSize = intervalSize;
+    hdr.seed = seed;
+
+    TraceReader in;
+    if (!in.open(input)) {
+        std::cerr << "cannot read BB trace " << input << std::endl;
+        exit(-1);
+    }
+    BBVWriter out;
+    if (!out.open(output, hdr)) {
+        std::cerr << "cannot open output file " << output << std::endl;
+        exit(-1);
+    }
+
+    ProjMatrix projM;
+    projM.init(k, seed, sparse, fixed);
+
+    std::vector<ReplayThread *> threads;
+    std::vector<uint32_t> ids;
+    uint32_t tid;
+    uint64_t events = 0, intervals = 0;
+    size_t numSites = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    while (in.next(tid, ids)) {
+        /* the columns of the sites read with this record */
+        const std::vector<CountSite> & sites = in.sites();
+        for (; numSites < sites.size(); ++numSites)
+            projM.addColumn(sites[numSites].bbId, sites[numSites].key);
+
+        if (threads.size() <= tid)
+            threads.resize(tid + 1, nullptr);
+        if (threads[tid] == nullptr) {
+            threads[tid] = new ReplayThread(intervalSize);
+            threads[tid]->bbv.grow(4096);
+            threads[tid]->accu.resize(k);
+            if (sparse || fixed)
+                threads[tid]->intAccu.setSize(k);
+        }
+        ReplayThread & t = *threads[tid];
+
+        /* endInterval of bbvTrace */
+        auto reachLimit = [&]() {
+            t.clock.endInterval(intervalSize);
+            projectBBV(t.bbv, projM, t.accu.data(), t.intAccu);
+            out.write(tid, t.accu.data());
+            ++intervals;
+        };
+
+        /* doBBL and doBBLFall of bbvTrace */
+        for (size_t e = 0; e < ids.size(); ++e) {
+            const CountSite & site = sites[ids[e]];
+            if (site.isBranch)
+                t.clock.branchBB(t.bbv, site.bbId, site.numInsts, site.unitHead(unit), site.unitTail(unit), reachLimit);
+            else
+                t.clock.fallBB(site.numInsts, site.unitHead(unit), reachLimit);
+        }
+        events += ids.size();
+    }
+    out.close();
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "sites " << in.sites().size() << " events " << events << " intervals " << intervals
+              << "\n" << secs << " s, " << (events ? secs * 1e9 / events : 0) << " ns/event" << std::endl;
+
+    for (size_t i = 0; i < threads.size(); ++i)
+        delete threads[i];
+    return 0;
+}
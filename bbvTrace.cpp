@@ -3,170 +3,499 @@
  */
 
 #include "bbvTrace.h"
-#include "random_matrix.h"
 
-template <class B>
-Histogram<B>::Histogram(int s) : _size(s), samples(0)
+ThreadState::ThreadState(THREADID t, int k) : clock(GlobalClock ? ClockTick : IntervalSize), numMemAccs(0),
+    numInsts(0), numEvents(0), skipCount(0), skipLimit(0), skipInsts(0), pubInsts(0), tid(t), recLast(0), projInsts(0), epoch(0)
 {
-    bins = new B[_size];
-    /* init bins to 0 */
-    for (int i = 0; i < _size; ++i)
-        bins[i] = 0;
+    bbv.grow(4096);
+    accu = new double[RecordSize];
+    if (RdBins > 0)
+        rd.init(KnobRdLine.Value(), KnobRdSample.Value(), KnobRdMax.Value());
+    if (projM.isSparse() || projM.isFixed())
+        intAccu.setSize(k);
 }
 
-template <class B>
-Histogram<B>::Histogram(const Histogram<B> & rhs) : _size(rhs._size), samples(rhs.samples)
+ThreadState::~ThreadState() { delete [] accu; }
+
+void ThreadState::project()
 {
-    bins = new B[_size];
-    for (int i = 0; i < _size; ++i)
-        bins[i] = rhs.bins[i];
+    const int k = projM.rows();
+    UINT64 touched = bbv.touchedSize();
+
+    UINT64 start = readTSC();
+    projectBBV(bbv, projM, accu, intAccu);
+    UINT64 cycles = readTSC() - start;
+    ProjCycles += cycles;
+    ++ProjCalls;
+    TouchedBBs += touched;
+
+    for (UINT32 i = 0; i < RdBins; ++i)
+        accu[k + i] = (double)rd.hist[i];
+    rd.hist.clear();
+
+    if (StatFields > 0) {
+        double * stats = accu + k + RdBins;
+        stats[0] = (double)(numInsts - projInsts);
+        stats[1] = (double)touched;
+        stats[2] = (double)cycles;
+    }
+    projInsts = numInsts;
 }
 
-template <class B>
-Histogram<B>::~Histogram() { delete [] bins; }
+VOID reachLimit(ThreadState * ts)
+{
+    if (GlobalClock)
+        publishUnits(ts);
+    else
+        endInterval(ts);
+}
 
-template <class B>
-void Histogram<B>::setSize(int s)
+VOID endInterval(ThreadState * ts)
 {
-    if (bins != nullptr)
-        delete [] bins;
+    UINT64 interval = ts->clock.endInterval(IntervalSize);
 
-    _size = s;
-    bins = new B[_size];
+    /* periodic sampling, every thread drops M - 1 of its intervals on its own */
+    if ((interval - 1) % KnobSamplePeriod.Value() != 0) {
+        ts->bbv.clear();
+        ts->rd.hist.clear();
+        ts->projInsts = ts->numInsts;
+        publishInsts(ts);
+        return;
+    }
 
-    /* init bins to 0 */
-    for (int i = 0; i < _size; ++i)
-        bins[i] = 0;
+    ts->project();
+    /* print compressed BBV, we don't normalize BBVs, do it in matlab */
+    emitRecord(ts->tid, interval, ts->accu);
+    publishInsts(ts);
+
+    if (CkptEvery > 0 && TotalIntervals.load(std::memory_order_relaxed) >= NextCkpt.load(std::memory_order_relaxed))
+        requestCheckpoint(ts);
+}
+
+VOID publishInsts(ThreadState * ts)
+{
+    UINT64 total = GlobalInsts.fetch_add(ts->numInsts - ts->pubInsts) + ts->numInsts - ts->pubInsts;
+    ts->pubInsts = ts->numInsts;
+
+    /* the budget is checked at interval ends, a run stops up to an interval of every thread late */
+    if (KnobStopInsts.Value() == 0 || total < KnobStopInsts.Value() || Stopping.exchange(true))
+        return;
+
+    /* the budget is used up, only one thread gets here */
+    if (KnobStopMode.Value() == "detach")
+        PIN_Detach();
+    else
+        PIN_ExitApplication(0);
+}
 
-    //std::cout << "size of bins " << _size << std::endl;
+/* a slot of outRing, the caller holds outLock */
+static double * claimRecord()
+{
+    double * rec;
+    while ((rec = outRing.claim()) == nullptr) {
+        /* nobody else drains the ring once the writer thread is gone */
+        if (writerDone.load(std::memory_order_acquire))
+            drainRing();
+        else
+            PIN_Yield();
+    }
+    return rec;
 }
 
+/* the epochs every live thread has passed, the caller holds outLock */
+static UINT64 closedEpochs()
+{
+    UINT64 now = GlobalCount.load(std::memory_order_acquire) / IntervalSize;
+    UINT64 end = now;
 
-template <class B>
-const int Histogram<B>::size() const { return _size; }
+    for (std::map<THREADID, UINT64>::const_iterator it = ThreadEpochs.begin(); it != ThreadEpochs.end(); ++it)
+        end = std::min(end, it->second);
+    /* a sleeping thread holds nobody back for long */
+    if (now > MaxEpochLag)
+        end = std::max(end, now - MaxEpochLag);
+    return end;
+}
 
-template <class B>
-void Histogram<B>::clear()
+/* emit the epochs before epoch end, the caller holds outLock */
+static VOID emitEpochs(UINT64 end)
 {
-    samples = 0;
-    /* when clear bins, the size keeps unchanged */
-    for (int i = 0; i < _size; ++i)
-        bins[i] = 0;
+    const int k = RecordSize;
+    double * rec;
+
+    for (; EmittedEpochs < end; ++EmittedEpochs) {
+        rec = claimRecord();
+        if (EpochBufs.empty()) {
+            for (int i = 0; i < k; ++i)
+                rec[i] = 0;
+        } else {
+            std::copy(EpochBufs.front().begin(), EpochBufs.front().end(), rec);
+            EpochBufs.pop_front();
+        }
+        outRing.publish(EmittedEpochs + 1, 0);
+        ++TotalIntervals;
+    }
 }
 
-template <class B>
-void Histogram<B>::normalize()
+/* add a projected record to epoch e, the caller holds outLock */
+static VOID addToEpoch(UINT64 e, const double * accu)
 {
-    for (int i = 0; i < _size; ++i)
-        bins[i] /= samples;
+    /* a record later than its epoch goes to the oldest open one */
+    size_t slot = e > EmittedEpochs ? e - EmittedEpochs : 0;
+    while (EpochBufs.size() <= slot)
+        EpochBufs.push_back(std::vector<double>(RecordSize, 0.0));
+    std::vector<double> & buf = EpochBufs[slot];
+    for (int i = 0; i < RecordSize; ++i)
+        buf[i] += accu[i];
 }
 
-template <class B>
-double Histogram<B>::manhattanDist(const Histogram<B> & rhs)
+/* the clock passed the epoch of ts, merge its BBV into that epoch once */
+static VOID passEpoch(ThreadState * ts, UINT64 epoch, BOOL retire)
 {
-    assert(_size == rhs._size);
+    BOOL counted = ts->bbv.touchedSize() > 0 || ts->rd.hist.samples > 0;
+    if (counted)
+        ts->project();
 
-    B dist = 0;
-    for (uint32_t i = 0; i < _size; ++i)
-        dist += std::abs(bins[i] - rhs.bins[i]);
+    PIN_GetLock(&outLock, ts->tid + 1);
+    if (counted)
+        addToEpoch(ts->epoch, ts->accu);
+    if (retire)
+        ThreadEpochs.erase(ts->tid);
+    else
+        ThreadEpochs[ts->tid] = epoch;
+    emitEpochs(closedEpochs());
+    PIN_ReleaseLock(&outLock);
 
-    return (double)dist / samples;
+    ts->epoch = epoch;
+    publishInsts(ts);
 }
 
+VOID publishUnits(ThreadState * ts)
+{
+    UINT64 count = GlobalCount.fetch_add(ts->clock.interCount, std::memory_order_acq_rel) + ts->clock.interCount;
+    UINT64 epoch = count / IntervalSize;
+    ts->clock.interCount = 0;
+    if (epoch > ts->epoch)
+        passEpoch(ts, epoch, false);
 
-template <class B>
-B & Histogram<B>::operator[](const int idx)
+    /* the live threads share the rest of the epoch, so the clock ends it within a tick */
+    UINT64 left = (epoch + 1) * IntervalSize - count;
+    ts->clock.limit = std::max(left / std::max(LiveThreads.load(std::memory_order_relaxed), 1U), ClockTick);
+}
+
+ADDRINT PIN_FAST_ANALYSIS_CALL
+lightCount(ThreadState * ts, UINT32 numInsts)
 {
-    assert(idx >= 0 && idx < _size);
-    return bins[idx];
+    ts->numInsts += numInsts;
+    ts->skipInsts += numInsts;
+    ts->skipCount += numInsts;
+    return ts->skipCount >= ts->skipLimit;
 }
-        
-template <class B>
-Histogram<B> & Histogram<B>::operator=(const Histogram<B> & rhs)
+
+VOID PIN_FAST_ANALYSIS_CALL
+endSkip(ThreadState * ts)
 {
-    assert(_size == rhs.size());
+    UINT64 target = SkipTarget.load(std::memory_order_acquire);
+    UINT64 skipped = GlobalSkip.fetch_add(ts->skipCount) + ts->skipCount;
+    ts->skipCount = 0;
+    publishInsts(ts);
 
-    for (int i = 0; i < _size; ++i)
-        bins[i] = rhs.bins[i];
+    if (skipped < target) {
+        /* a single thread ends the window exactly */
+        ts->skipLimit = std::min(LightChunk, target - skipped);
+        return;
+    }
 
-    samples = rhs.samples;
-    return *this;
+    /*
+     * the window is over, the first thread here switches back. no thread
+     * ran the profiling routines before, every thread starts its first
+     * interval with the first profiled trace it runs
+     */
+    bool expect = false;
+    if (Profiling.compare_exchange_strong(expect, true))
+        CODECACHE_FlushCache();
+    ts->skipLimit = 0;
 }
 
-template <class B>
-Histogram<B> & Histogram<B>::operator+=(const Histogram<B> & rhs)
+VOID emitRecord(UINT32 tid, UINT64 interval, const double * accu)
 {
-    assert(_size == rhs.size());
+    const int k = RecordSize;
+    double * rec;
 
-    for (int i = 0; i < _size; ++i)
-        bins[i] += rhs.bins[i];
+    /* wait if the writer falls behind */
+    UINT64 start = readTSC();
+    PIN_GetLock(&outLock, tid + 1);
+    rec = claimRecord();
+    for (int i = 0; i < k; ++i)
+        rec[i] = accu[i];
+    outRing.publish(interval, tid);
+    PIN_ReleaseLock(&outLock);
+    EmitCycles += readTSC() - start;
 
-    samples += rhs.samples;
-    return *this;
+    ++TotalIntervals;
 }
 
-template <class B>
-void Histogram<B>::sample(uint32_t x, int num)
+VOID requestCheckpoint(ThreadState * ts)
 {
-    /* the sample number must less than max size of bins */
-    assert(x < _size && x >= 0);
+    /* one thread takes each checkpoint */
+    UINT64 next = NextCkpt.load();
+    UINT64 total = TotalIntervals.load();
+    if (total < next || !NextCkpt.compare_exchange_strong(next, total + CkptEvery))
+        return;
 
-    bins[x] += num;
-    /* calculate the total num of sampling */
-    ++samples;
+    /* an empty record, the state is copied by the writer thread */
+    PIN_GetLock(&outLock, ts->tid + 1);
+    claimRecord();
+    outRing.publish(GlobalInsts.load(), CkptMark);
+    PIN_ReleaseLock(&outLock);
 }
 
-template <class B>
-void Histogram<B>::print(std::ofstream & file)
+VOID writeCheckpoint(UINT64 insts)
 {
-    //file.write((char *)bins, sizeof(B) * _size);
-    for (int i = 0; i < _size; ++i)
-        file << bins[i] << " ";
-    file  << "\n";
+    UINT64 start = readTSC();
+    Checkpoint ck;
+    ck.k = projM.rows();
+    ck.unit = ClockUnit;
+    ck.intervalSize = IntervalSize;
+    ck.seed = KnobSeed.Value();
+    ck.insts = insts;
+    ck.intervals = Resumed.intervals + WriteRecords;
+    ck.threadIntervals = WrittenIntervals;
+
+    PIN_GetLock(&writeLock, 1);
+    bbvOut.flush();
+    ck.bbvOffsets = bbvOut.offsets();
+    if (RdBins > 0) {
+        rdOut.flush();
+        ck.rdOffsets = rdOut.offsets();
+    }
+    if (StatFields > 0) {
+        istatOut.flush();
+        ck.istatOffset = istatOut.tellp();
+    }
+    PIN_ReleaseLock(&writeLock);
+
+    /* Trace() adds BBs holding the client lock */
+    PIN_LockClient();
+    bbDict.dump(ck.keys);
+    PIN_UnlockClient();
+
+    if (!ck.save(KnobCkptFile.Value()))
+        std::cerr << "cannot write checkpoint " << KnobCkptFile.Value() << std::endl;
+    ++NumCkpts;
+    CkptCycles += readTSC() - start;
 }
 
 // This function is called before every instruction is executed
+template <IntervalUnit U>
+VOID PIN_FAST_ANALYSIS_CALL
+doCount(ThreadState * ts, UINT32 bbId, BOOL isBranch, UINT32 numMems)
+{
+    ++ts->numInsts;
+    ++ts->numEvents;
+    ts->numMemAccs += numMems;
+    /* count the interval length, U is a constant */
+    UINT32 units = U == UNIT_INST ? 1 : (U == UNIT_MEMREF ? numMems : (UINT32)isBranch);
+    ts->clock.inst(ts->bbv, bbId, isBranch, units, [ts]() { reachLimit(ts); });
+
+    /* if we got a maximum memory references, just exit this program */
+    //if (NumMemAccs >= 50000000000) {
+        //Fini(0, a);
+        //exit (0);
+    //}
+}
+
+/* 
+ * the per-BBL version of doCount, all the immediates are worked out at 
+ * instrumentation time. clock units of the head instructions are counted
+ * before the branch is sampled and those of the tail after it, so the 
+ * interval boundaries fall at the same place as in the per-instruction mode
+ */
+VOID PIN_FAST_ANALYSIS_CALL
+doBBL(ThreadState * ts, UINT32 bbId, UINT32 numInsts, UINT32 numMems, UINT32 unitHead, UINT32 unitTail)
+{
+    ts->numInsts += numInsts;
+    ++ts->numEvents;
+    ts->numMemAccs += numMems;
+    ts->clock.branchBB(ts->bbv, bbId, numInsts, unitHead, unitTail, [ts]() { reachLimit(ts); });
+}
+
+/* a BBL without a branch at its tail, its insts go to the next sampled BBL */
+VOID PIN_FAST_ANALYSIS_CALL
+doBBLFall(ThreadState * ts, UINT32 numInsts, UINT32 numMems, UINT32 units)
+{
+    ts->numInsts += numInsts;
+    ++ts->numEvents;
+    ts->numMemAccs += numMems;
+    ts->clock.fallBB(numInsts, units, [ts]() { reachLimit(ts); });
+}
+
+VOID PIN_FAST_ANALYSIS_CALL
+doRecord(ThreadState * ts, UINT32 siteId)
+{
+    putVarint(ts->recBuf, (INT64)siteId - ts->recLast);
+    ts->recLast = siteId;
+    if (ts->recBuf.size() >= BBVFrameSize)
+        flushRecord(ts);
+}
+
+VOID flushRecord(ThreadState * ts)
+{
+    if (ts->recBuf.empty())
+        return;
+
+    PIN_GetLock(&traceLock, ts->tid + 1);
+    traceOut.events(ts->tid, ts->recBuf);
+    PIN_ReleaseLock(&traceLock);
+    /* every events record starts its deltas from 0 */
+    ts->recBuf.clear();
+    ts->recLast = 0;
+}
+
 VOID PIN_FAST_ANALYSIS_CALL
-doCount(ADDRINT pc, BOOL isBranch, BOOL isMemRead, BOOL isMemWrite, BOOL hasRead2)
+doMemRef(ThreadState * ts, ADDRINT addr)
 {
-    ++BBVInsts;
-    /* count the interval length */
-    if (isMemRead || isMemWrite || hasRead2) {
-        NumMemAccs += (uint32_t)isMemRead + isMemWrite + hasRead2;
-        InterCount += (uint32_t)isMemRead + isMemWrite + hasRead2;;
+    ts->rd.access(addr);
+}
+
+VOID ThreadStart(THREADID tid, CONTEXT * ctxt, INT32 flags, VOID * v)
+{
+    ThreadState * ts = new ThreadState(tid, projM.rows());
+    /* a resumed run numbers the intervals on */
+    if (tid < Resumed.threadIntervals.size())
+        ts->clock.numIntervals = Resumed.threadIntervals[tid];
+    /* the global clock waits for the thread from the current epoch on */
+    if (GlobalClock) {
+        PIN_GetLock(&outLock, tid + 1);
+        ts->epoch = GlobalCount.load(std::memory_order_acquire) / IntervalSize;
+        ThreadEpochs[tid] = ts->epoch;
+        PIN_ReleaseLock(&outLock);
+        ++LiveThreads;
     }
+    PIN_SetThreadData(TlsKey, ts, tid);
+    PIN_SetContextReg(ctxt, ScratchReg, (ADDRINT)ts);
+}
 
-    if (isBranch) {
-        currBBV.sample((currBBV.size() - 1) & pc, BBVInsts);
-        BBVInsts = 0;
+VOID ThreadFini(THREADID tid, const CONTEXT * ctxt, INT32 code, VOID * v)
+{
+    ThreadState * ts = static_cast<ThreadState *>(PIN_GetThreadData(TlsKey, tid));
+
+    /* a partial interval of a thread is dropped, the global clock takes its BBs */
+    if (GlobalClock) {
+        GlobalCount.fetch_add(ts->clock.interCount, std::memory_order_acq_rel);
+        ts->clock.interCount = 0;
+        --LiveThreads;
+        passEpoch(ts, ts->epoch, true);
     }
+    if (Recording)
+        flushRecord(ts);
+    PIN_GetLock(&outLock, tid + 1);
+    ThreadSummary sum = {tid, ts->numInsts, ts->numInsts - ts->skipInsts, ts->clock.numIntervals};
+    FinishedThreads.push_back(sum);
+    PIN_ReleaseLock(&outLock);
+    TotalMemAccs += ts->numMemAccs;
+    AnalysisCalls += ts->numEvents;
+    GlobalInsts += ts->numInsts - ts->pubInsts;
 
-    if (InterCount >= IntervalSize) {
-        /* compensate the residual of insts */
-        InterCount -= IntervalSize;
-        ++NumIntervals;
+    delete ts;
+    PIN_SetThreadData(TlsKey, nullptr, tid);
+}
 
-        Histogram<double> accuTable(KnobAccumTabSize.Value());
+/* the flags passed to doCount */
+static inline BOOL isBranchIns(INS ins)
+{
+    return INS_IsCall(ins) || INS_IsBranch(ins) || INS_IsRet(ins);
+}
 
-        /* compressing BBV, decrease the dimensions */
-        for(int i = 0; i < accuTable.size(); ++i) {
-            for (int j = 0; j < currBBV.size(); ++j)
-                accuTable[i] += (double)currBBV[j] * randM[i][j];
-            accuTable.samples += std::abs(accuTable[i]);
-        }
+static inline UINT32 numMemRefs(INS ins)
+{
+    return (UINT32)INS_IsMemoryRead(ins) + INS_IsMemoryWrite(ins) + INS_HasMemoryRead2(ins);
+}
 
-        currBBV.clear();
-        //accuTable.normalize();
-        /* print compressed BBV, we don't normalize BBVs, do it in matlab */
-        accuTable.print(fout);
-        std::cout << "==== " << NumIntervals << "th interval ====" << std::endl;
+/* the doCount instance of the interval clock */
+static AFUNPTR countRoutine()
+{
+    switch (ClockUnit) {
+    case UNIT_INST: return (AFUNPTR)doCount<UNIT_INST>;
+    case UNIT_BRANCH: return (AFUNPTR)doCount<UNIT_BRANCH>;
+    default: return (AFUNPTR)doCount<UNIT_MEMREF>;
     }
+}
 
-    /* if we got a maximum memory references, just exit this program */
-    //if (NumMemAccs >= 50000000000) {
-        //Fini(0, a);
-        //exit (0);
-    //}
+/* 
+ * REP instructions call their analysis routine once per iteration, 
+ * a BBL holding one is instrumented per instruction to keep the counts exact 
+ */
+static BOOL hasRealRep(BBL bbl)
+{
+    for(INS ins = BBL_InsHead(bbl); INS_Valid(ins); ins=INS_Next(ins))
+        if (INS_HasRealRep(ins))
+            return true;
+    return false;
+}
+
+/* the key of a BBL, its image and offset, or its PC with -bbkey pc or outside the images */
+static UINT64 bblKey(BBL bbl)
+{
+    ADDRINT pc = BBL_Address(bbl);
+    IMG img = KeyByImage ? IMG_FindByAddress(pc) : IMG_Invalid();
+    if (!IMG_Valid(img))
+        return pc;
+    return imageKey(IMG_Name(img), IMG_HighAddress(img) - IMG_LowAddress(img) + 1, pc - IMG_LowAddress(img));
+}
+
+/* the counting site of a BBL instrumented with one call */
+static CountSite bblSite(BBL bbl, UINT32 bbId, UINT64 key)
+{
+    INS tail = BBL_InsTail(bbl);
+    CountSite site = {bbId, BBL_NumIns(bbl), 0, numMemRefs(tail), isBranchIns(tail), key};
+    for(INS ins = BBL_InsHead(bbl); ins != tail; ins=INS_Next(ins))
+        site.memHead += numMemRefs(ins);
+    return site;
+}
+
+/* number a site and write it to the trace, before the site can run */
+static VOID recordSite(INS ins, const CountSite & site)
+{
+    PIN_GetLock(&traceLock, 1);
+    traceOut.site(NumSites, site);
+    PIN_ReleaseLock(&traceLock);
+
+    INS_InsertCall(
+    ins, IPOINT_BEFORE,
+    (AFUNPTR)doRecord, IARG_FAST_ANALYSIS_CALL,
+    IARG_REG_VALUE, ScratchReg,
+    IARG_UINT32, NumSites++,
+    IARG_END);
+}
+
+/*
+ * the reuse distance takes every memory ref of ins. it is inserted before
+ * the counting call of ins, calls at one point run in insertion order, so
+ * the refs go to the interval the counting call may close
+ */
+static VOID instrumentMemRefs(INS ins)
+{
+    if (INS_IsMemoryRead(ins))
+        INS_InsertPredicatedCall(
+        ins, IPOINT_BEFORE,
+        (AFUNPTR)doMemRef, IARG_FAST_ANALYSIS_CALL,
+        IARG_REG_VALUE, ScratchReg,
+        IARG_MEMORYREAD_EA,
+        IARG_END);
+    if (INS_HasMemoryRead2(ins))
+        INS_InsertPredicatedCall(
+        ins, IPOINT_BEFORE,
+        (AFUNPTR)doMemRef, IARG_FAST_ANALYSIS_CALL,
+        IARG_REG_VALUE, ScratchReg,
+        IARG_MEMORYREAD2_EA,
+        IARG_END);
+    if (INS_IsMemoryWrite(ins))
+        INS_InsertPredicatedCall(
+        ins, IPOINT_BEFORE,
+        (AFUNPTR)doMemRef, IARG_FAST_ANALYSIS_CALL,
+        IARG_REG_VALUE, ScratchReg,
+        IARG_MEMORYWRITE_EA,
+        IARG_END);
 }
 
 /*
@@ -176,23 +505,169 @@ doCount(ADDRINT pc, BOOL isBranch, BOOL isMemRead, BOOL isMemWrite, BOOL hasRead
 VOID Trace(TRACE trace, VOID * v)
 //VOID PIN_FAST_ANALYSIS_CALL Instruction(INS ins, VOID *v)
 {
+    UINT64 start = readTSC();
+
     // Insert a call to record the effective address.
     for(BBL bbl = TRACE_BblHead(trace); BBL_Valid(bbl); bbl=BBL_Next(bbl))
     {
+        /* skipping, only count the insts up to the end of the window */
+        if (!Profiling.load(std::memory_order_acquire)) {
+            INS_InsertIfCall(
+            BBL_InsHead(bbl), IPOINT_BEFORE,
+            (AFUNPTR)lightCount, IARG_FAST_ANALYSIS_CALL,
+            IARG_REG_VALUE, ScratchReg,
+            IARG_UINT32, BBL_NumIns(bbl),
+            IARG_END);
+            INS_InsertThenCall(
+            BBL_InsHead(bbl), IPOINT_BEFORE,
+            (AFUNPTR)endSkip, IARG_FAST_ANALYSIS_CALL,
+            IARG_REG_VALUE, ScratchReg,
+            IARG_END);
+            continue;
+        }
+
+        /* the BB ID goes to the analysis routine as an immediate */
+        UINT64 key = bblKey(bbl);
+        UINT32 bbId = bbDict.lookup(key);
+        projM.addColumn(bbId, key);
+
+        if (!KnobInsMode.Value() && !hasRealRep(bbl)) {
+            /* one call per BBL, count insts, memory refs and clock units now */
+            CountSite site = bblSite(bbl, bbId, key);
+            if (Recording)
+                recordSite(BBL_InsHead(bbl), site);
+
+            /* with -rd the BBL is counted at its tail, after all its refs */
+            INS at = BBL_InsHead(bbl);
+            if (RdBins > 0) {
+                for(INS ins = BBL_InsHead(bbl); INS_Valid(ins); ins=INS_Next(ins))
+                    instrumentMemRefs(ins);
+                at = BBL_InsTail(bbl);
+            }
+
+            if (site.isBranch)
+                INS_InsertCall(
+                at, IPOINT_BEFORE,
+                (AFUNPTR)doBBL, IARG_FAST_ANALYSIS_CALL,
+                IARG_REG_VALUE, ScratchReg,
+                IARG_UINT32, bbId,
+                IARG_UINT32, site.numInsts,
+                IARG_UINT32, site.memHead + site.memTail,
+                IARG_UINT32, site.unitHead(ClockUnit),
+                IARG_UINT32, site.unitTail(ClockUnit),
+                IARG_END);
+            else
+                INS_InsertCall(
+                at, IPOINT_BEFORE,
+                (AFUNPTR)doBBLFall, IARG_FAST_ANALYSIS_CALL,
+                IARG_REG_VALUE, ScratchReg,
+                IARG_UINT32, site.numInsts,
+                IARG_UINT32, site.memHead + site.memTail,
+                IARG_UINT32, site.unitHead(ClockUnit),
+                IARG_END);
+            continue;
+        }
+
         for(INS ins = BBL_InsHead(bbl); INS_Valid(ins); ins=INS_Next(ins))
         {
+            if (Recording) {
+                CountSite site = {bbId, 1, 0, numMemRefs(ins), isBranchIns(ins), key};
+                recordSite(ins, site);
+            }
+
+            if (RdBins > 0)
+                instrumentMemRefs(ins);
+
             /* will be call for every inst */
             INS_InsertCall(
             ins, IPOINT_BEFORE,
-            (AFUNPTR)doCount, IARG_FAST_ANALYSIS_CALL,
-            IARG_INST_PTR, 
-            IARG_BOOL, INS_IsCall(ins) || INS_IsBranch(ins) || INS_IsRet(ins),
-            IARG_BOOL, INS_IsMemoryRead(ins),
-            IARG_BOOL, INS_IsMemoryWrite(ins),
-            IARG_BOOL, INS_HasMemoryRead2(ins),
+            countRoutine(), IARG_FAST_ANALYSIS_CALL,
+            IARG_REG_VALUE, ScratchReg,
+            IARG_UINT32, bbId,
+            IARG_BOOL, isBranchIns(ins),
+            IARG_UINT32, numMemRefs(ins),
             IARG_END);
         }
     }
+
+    TraceCycles += readTSC() - start;
+    ++NumTraces;
+}
+
+VOID CacheFlushed(VOID * v)
+{
+    ++CacheFlushes;
+}
+
+BOOL drainRing()
+{
+    uint64_t interval;
+    uint32_t tid;
+    const double * rec = outRing.front(interval, tid);
+    if (rec == nullptr)
+        return false;
+
+    if (tid == CkptMark) {
+        /* nothing to resume from once the run is finishing */
+        if (!writerDone.load(std::memory_order_acquire))
+            writeCheckpoint(interval);
+        outRing.pop();
+        return true;
+    }
+
+    UINT64 start = readTSC();
+    PIN_GetLock(&writeLock, 1);
+    bbvOut.write(tid, rec);
+    if (RdBins > 0)
+        rdOut.write(tid, rec + projM.rows());
+    if (phaseOut.is_open()) {
+        UINT32 phase = phaseTable.classify(rec);
+        phaseOut << interval << " " << tid << " " << phase << " " << phasePred.update(tid, phase) << "\n";
+    }
+    if (StatFields > 0) {
+        const double * stats = rec + projM.rows() + RdBins;
+        istatOut << interval << " " << tid << " " << (UINT64)stats[0] << " " << (UINT64)stats[1] \
+        << " " << (UINT64)stats[2] << "\n";
+    }
+    PIN_ReleaseLock(&writeLock);
+    outRing.pop();
+    if (WrittenIntervals.size() <= tid)
+        WrittenIntervals.resize(tid + 1, 0);
+    WrittenIntervals[tid] = interval;
+    WriteCycles += readTSC() - start;
+    ++WriteRecords;
+    if (KnobVerbose.Value())
+        std::cout << "==== " << interval << "th interval of thread " << tid << " ====\n";
+    return true;
+}
+
+VOID writerThread(VOID * arg)
+{
+    for (;;) {
+        /* read the flag first, the ring is empty for good after it is set */
+        bool exiting = writerExit.load(std::memory_order_acquire);
+        if (!drainRing()) {
+            if (exiting)
+                break;
+            PIN_Sleep(1);
+        }
+    }
+}
+
+VOID PrepareForFini(VOID * v)
+{
+    /* a forked child may have no writer thread */
+    if (writerDone.load(std::memory_order_acquire))
+        return;
+    writerExit.store(true, std::memory_order_release);
+    PIN_WaitForThreadTermination(writerUid, PIN_INFINITE_TIMEOUT, nullptr);
+    writerDone.store(true, std::memory_order_release);
+}
+
+VOID DetachFini(VOID * v)
+{
+    /* no PrepareForFini when detaching, Fini stops the writer */
+    Fini(0, v);
 }
 
 /* output the results, and free the poiters */
@@ -201,12 +676,224 @@ VOID Fini(INT32 code, VOID *v)
     /* sum the current SDD to total SDD */
     //totalSDD += currBBV;
     //totalSDD->print(fout);
-    ++NumIntervals;
 
-    fout.close();
+    /* 
+     * stop the writer first, the call is a no-op after PrepareForFini, then
+     * drain under outLock, a thread still running may be claiming records
+     */
+    PrepareForFini(v);
+    PIN_GetLock(&outLock, 0);
+    /* the intervals closed after the writer thread stopped */
+    if (GlobalClock)
+        emitEpochs(GlobalCount.load() / IntervalSize);
+    while (drainRing())
+        ;
+    PIN_ReleaseLock(&outLock);
+    bbvOut.close();
+    if (RdBins > 0)
+        rdOut.close();
+    if (Recording)
+        traceOut.close();
+
+    if (phaseOut.is_open()) {
+        phaseOut.close();
+        std::cout << "phase table size " << phaseTable.size() << "\nphases " << phaseTable.numPhases() \
+        << "\nnext phase predictions " << phasePred.hits << "/" << phasePred.predictions << " correct" << std::endl;
+    }
+    std::cout << "Unique BBs " << bbDict.size() << std::endl;
+    std::cout << "Intervals " << TotalIntervals << std::endl;
+    std::cout << "Total memory accesses " << TotalMemAccs << std::endl;
+    std::cout << "Total instructions " << GlobalInsts << std::endl;
+    std::cout << "Projection " << ProjCycles << " cycles, writes " << WriteCycles << " cycles" << std::endl;
+
+    if (StatFields > 0)
+        istatOut.close();
+    if (!KnobStatsFile.Value().empty()) {
+        std::ofstream statsOut(outputName(KnobStatsFile.Value()).c_str());
+        writeStats(statsOut);
+    }
+}
+
+VOID writeStats(std::ostream & out)
+{
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+    UINT64 tsc = readTSC() - StartTSC;
+    UINT64 projCalls = std::max(ProjCalls.load(), (UINT64)1);
 
-    //std::cout << "phase table size " << phaseTable.size() << std::endl;
-    std::cout << "Total memory accesses " << NumMemAccs << std::endl;
+    out << "{\n"
+    << "  \"knobs\": {\"m\": " << KnobAccumTabSize.Value() << ", \"i\": " << IntervalSize \
+    << ", \"clock\": \"" << KnobClock.Value() << "\", \"tmode\": \"" << KnobThreadMode.Value() \
+    << "\", \"sparse\": " << KnobSparseProj.Value() << ", \"fixed\": " << KnobFixedProj.Value() << ", \"insmode\": " << KnobInsMode.Value() \
+    << ", \"format\": \"" << KnobFormat.Value() << "\"},\n"
+    << "  \"wall_seconds\": " << secs << ",\n"
+    << "  \"tsc_per_second\": " << (secs > 0 ? tsc / secs : 0) << ",\n"
+    << "  \"instructions\": " << GlobalInsts << ",\n"
+    << "  \"memory_accesses\": " << TotalMemAccs << ",\n"
+    << "  \"analysis_calls\": " << AnalysisCalls << ",\n"
+    << "  \"intervals\": " << TotalIntervals << ",\n"
+    << "  \"unique_bbs\": " << bbDict.size() << ",\n"
+    << "  \"projection\": {\"calls\": " << ProjCalls << ", \"cycles\": " << ProjCycles \
+    << ", \"cycles_per_call\": " << ProjCycles / projCalls << ", \"touched_bbs\": " << TouchedBBs \
+    << ", \"touched_per_call\": " << TouchedBBs / projCalls << ", \"isa\": \"" << isaName(projM.isa()) << "\"},\n"
+    << "  \"emit_cycles\": " << EmitCycles << ",\n"
+    << "  \"write\": {\"records\": " << WriteRecords << ", \"cycles\": " << WriteCycles \
+    << ", \"bytes\": " << bbvOut.bytes() << "},\n"
+    << "  \"checkpoints\": {\"count\": " << NumCkpts << ", \"cycles\": " << CkptCycles << "},\n"
+    << "  \"instrumentation\": {\"traces\": " << NumTraces << ", \"cycles\": " << TraceCycles << "},\n"
+    << "  \"code_cache\": {\"used\": " << CODECACHE_CodeMemUsed() << ", \"reserved\": " << CODECACHE_CodeMemReserved() \
+    << ", \"limit\": " << CODECACHE_CacheSizeLimit() << ", \"traces\": " << CODECACHE_NumTracesInCache() \
+    << ", \"exit_stubs\": " << CODECACHE_NumExitStubsInCache() << ", \"flushes\": " << CacheFlushes << "},\n"
+    << "  \"threads\": [";
+    /* one line per thread, the profiled insts are the ones the interval clock saw */
+    for (size_t i = 0; i < FinishedThreads.size(); ++i) {
+        const ThreadSummary & t = FinishedThreads[i];
+        out << (i ? "," : "") << "\n    {\"tid\": " << t.tid << ", \"instructions\": " << t.insts \
+        << ", \"profiled_instructions\": " << t.profiledInsts << ", \"intervals\": " << t.intervals << "}";
+    }
+    out << "\n  ]\n"
+    << "}" << std::endl;
+}
+
+std::string outputName(const std::string & name)
+{
+    return PidNames ? name + "." + decstr(PIN_GetPid()) : name;
+}
+
+BOOL openOutputs(BOOL resume, std::string & failed)
+{
+    failed = outputName(KnobOutputFile.Value());
+    if (resume ? !bbvOut.resume(failed, StreamHdr, Resumed.bbvOffsets) : !bbvOut.open(failed, StreamHdr))
+        return false;
+
+    /* the reuse distance sidecar has the format of the BBVs */
+    if (RdBins > 0) {
+        BBVHeader rdHdr = StreamHdr;
+        rdHdr.k = RdBins;
+        failed = outputName(KnobRdFile.Value());
+        if (resume ? !rdOut.resume(failed, rdHdr, Resumed.rdOffsets) : !rdOut.open(failed, rdHdr))
+            return false;
+    }
+
+    if (StatFields > 0) {
+        failed = outputName(KnobIntervalStats.Value());
+        if (resume) {
+            if (truncate(failed.c_str(), Resumed.istatOffset) == 0)
+                istatOut.open(failed.c_str(), std::ios::out | std::ios::app);
+        }
+        else {
+            istatOut.open(failed.c_str());
+            istatOut << "# interval tid insts touched_bbs projection_cycles\n";
+        }
+        if (!istatOut.is_open() || istatOut.fail())
+            return false;
+    }
+
+    if (!KnobPhaseFile.Value().empty()) {
+        failed = outputName(KnobPhaseFile.Value());
+        phaseOut.open(failed.c_str(), std::ios::out);
+        if (phaseOut.fail())
+            return false;
+    }
+    return true;
+}
+
+VOID ForkBefore(THREADID tid, const CONTEXT * ctxt, VOID * v)
+{
+    /* released by ForkParent, the child gets them re-initialized */
+    PIN_GetLock(&writeLock, tid + 1);
+    PIN_GetLock(&traceLock, tid + 1);
+    bbvOut.flush();
+    if (RdBins > 0)
+        rdOut.flush();
+    if (istatOut.is_open())
+        istatOut.flush();
+    if (phaseOut.is_open())
+        phaseOut.flush();
+    if (Recording)
+        traceOut.flush();
+}
+
+VOID ForkParent(THREADID tid, const CONTEXT * ctxt, VOID * v)
+{
+    PIN_ReleaseLock(&traceLock);
+    PIN_ReleaseLock(&writeLock);
+}
+
+VOID ForkChild(THREADID tid, const CONTEXT * ctxt, VOID * v)
+{
+    /* the locks may be held by threads of the parent that are not here */
+    PIN_InitLock(&outLock);
+    PIN_InitLock(&writeLock);
+    PIN_InitLock(&traceLock);
+
+    /* the records not written yet belong to the parent, its outputs were flushed by ForkBefore */
+    outRing.clear();
+    bbvOut.close();
+    if (RdBins > 0)
+        rdOut.close();
+    if (istatOut.is_open())
+        istatOut.close();
+    if (phaseOut.is_open())
+        phaseOut.close();
+    if (Recording) {
+        traceOut.close();
+        Recording = false;
+    }
+
+    PidNames = true;
+    StreamHdr.ppid = StreamHdr.pid;
+    StreamHdr.pid = PIN_GetPid();
+    /* the checkpoints are the parent's */
+    CkptEvery = 0;
+    std::string failed;
+    if (!openOutputs(false, failed)) {
+        std::cerr << "output file: " << failed << " cannot be opened in the child " << StreamHdr.pid << std::endl;
+        PIN_ExitProcess(1);
+    }
+
+    /* only the forking thread lives on, it starts a new interval */
+    ThreadState * ts = static_cast<ThreadState *>(PIN_GetThreadData(TlsKey, tid));
+    ts->bbv.clear();
+    ts->rd.hist.clear();
+    ts->clock.reset();
+    ts->numMemAccs = 0;
+    ts->numInsts = 0;
+    ts->skipInsts = 0;
+    ts->numEvents = 0;
+    ts->pubInsts = 0;
+    ts->projInsts = 0;
+
+    /* the counters of the run start over */
+    StartTime = std::chrono::steady_clock::now();
+    StartTSC = readTSC();
+    std::atomic<UINT64> * counters[] = {&TotalMemAccs, &ProjCycles, &ProjCalls, &TouchedBBs, &EmitCycles,
+        &WriteCycles, &WriteRecords, &TraceCycles, &NumTraces, &CacheFlushes, &AnalysisCalls,
+        &GlobalInsts, &TotalIntervals, &GlobalCount};
+    for (size_t i = 0; i < sizeof(counters) / sizeof(counters[0]); ++i)
+        counters[i]->store(0);
+    EmittedEpochs = 0;
+    EpochBufs.clear();
+    ThreadEpochs.clear();
+    FinishedThreads.clear();
+    if (GlobalClock) {
+        ThreadEpochs[tid] = 0;
+        LiveThreads = 1;
+    }
+    ts->epoch = 0;
+    ts->clock.limit = GlobalClock ? ClockTick : IntervalSize;
+    WrittenIntervals.clear();
+    Resumed.threadIntervals.clear();
+
+    /* the internal threads are not forked, without a writer the ring is drained by its producers */
+    writerExit = false;
+    writerDone = false;
+    if (PIN_SpawnInternalThread(writerThread, 0, 0, &writerUid) == INVALID_THREADID)
+        writerDone = true;
+}
+
+BOOL FollowChild(CHILD_PROCESS child, VOID * v)
+{
+    return true;
 }
 
 /* ===================================================================== */
@@ -215,7 +902,7 @@ VOID Fini(INT32 code, VOID *v)
 
 INT32 Usage()
 {
-    PIN_ERROR( "This Pintool calculate the stack distance of a program.\n" 
+    PIN_ERROR( "This Pintool collects the BBVs and the stack distance of a program.\n" 
               + KNOB_BASE::StringKnobSummary() + "\n");
     return -1;
 }
@@ -228,27 +915,219 @@ int main(int argc, char *argv[])
 {
     if (PIN_Init(argc, argv)) return Usage();
 
+    StartTime = std::chrono::steady_clock::now();
+    StartTSC = readTSC();
+
     IntervalSize = KnobIntervalSize.Value();
-    /* out put file open */
-    fout.open(KnobOutputFile.Value().c_str(), std::ios::out | std::ios::binary);
-    if (fout.fail()) {
-         PIN_ERROR( "output file: " + KnobOutputFile.Value() + " cannot be opened.\n" 
+
+    /* the sparse columns keep a row index in 15 bits */
+    if (KnobAccumTabSize.Value() == 0 || (KnobSparseProj.Value() && KnobAccumTabSize.Value() >= 32768)) {
+         PIN_ERROR( "invalid accumulator table size.\n" 
+              + KNOB_BASE::StringKnobSummary() + "\n");
+         return -1;
+    }
+
+    if (KnobSparseProj.Value() && KnobFixedProj.Value()) {
+         PIN_ERROR( "-fixed is a dense projection, it does not go with -sparse.\n" 
+              + KNOB_BASE::StringKnobSummary() + "\n");
+         return -1;
+    }
+
+    if (KnobClock.Value() == "ins")
+        ClockUnit = UNIT_INST;
+    else if (KnobClock.Value() == "br")
+        ClockUnit = UNIT_BRANCH;
+    else if (KnobClock.Value() != "mem") {
+         PIN_ERROR( "unknown interval clock: " + KnobClock.Value() + "\n" 
+              + KNOB_BASE::StringKnobSummary() + "\n");
+         return -1;
+    }
+
+    BBVHeader hdr;
+    hdr.k = KnobAccumTabSize.Value();
+    hdr.compress = KnobCompress.Value();
+    hdr.unit = ClockUnit;
+    hdr.intervalSize = IntervalSize;
+    hdr.seed = KnobSeed.Value();
+    if (KnobFormat.Value() == "text")
+        hdr.format = FMT_TEXT;
+    else if (KnobFormat.Value() == "float")
+        hdr.format = FMT_FLOAT;
+    else if (KnobFormat.Value() == "varint")
+        hdr.format = FMT_VARINT;
+    else {
+         PIN_ERROR( "unknown output format: " + KnobFormat.Value() + "\n" 
+              + KNOB_BASE::StringKnobSummary() + "\n");
+         return -1;
+    }
+
+    /* checkpoints are taken at the intervals of a thread */
+    if (!KnobCkptFile.Value().empty()) {
+        CkptEvery = KnobCkptEvery.Value();
+        if (CkptEvery == 0 || KnobThreadMode.Value() != "thread") {
+             PIN_ERROR( "checkpoints need -tmode thread and -ckptevery > 0.\n" 
+                  + KNOB_BASE::StringKnobSummary() + "\n");
+             return -1;
+        }
+    }
+
+    /* the phase table and the BB trace are not in a checkpoint */
+    if (KnobResume.Value() && (CkptEvery == 0 || !Resumed.load(KnobCkptFile.Value()) || !Resumed.matches(hdr)
+        || !KnobPhaseFile.Value().empty() || !KnobRecordFile.Value().empty())) {
+         PIN_ERROR( "cannot resume from checkpoint: " + KnobCkptFile.Value() + ", it needs the options of its run and no -phase or -record.\n" 
               + KNOB_BASE::StringKnobSummary() + "\n");
          return -1;
     }
 
-    /* current phase BBV, max size is 2756 */
-    currBBV.setSize(2756);
-    //phaseTable.setThreshold((double)1 / KnobRdvThreshold.Value());
+    /* -bbkey, -follow and the PIDs in the headers */
+    if (KnobBBKey.Value() == "pc")
+        KeyByImage = false;
+    else if (KnobBBKey.Value() != "image") {
+         PIN_ERROR( "unknown BB key: " + KnobBBKey.Value() + "\n" 
+              + KNOB_BASE::StringKnobSummary() + "\n");
+         return -1;
+    }
+    PidNames = KnobFollow.Value();
+    if (PidNames && (CkptEvery > 0 || !KnobRecordFile.Value().empty())) {
+         PIN_ERROR( "-follow takes no -ckpt or -record, they cover one process.\n" 
+              + KNOB_BASE::StringKnobSummary() + "\n");
+         return -1;
+    }
+    hdr.pid = PIN_GetPid();
+    hdr.ppid = getppid();
+    StreamHdr = hdr;
 
-    std::cout << "truncation distance " << currBBV.size() << "\nout file " << KnobOutputFile.Value().c_str() \
-    << "\ninterval size " << IntervalSize << "\naccumulator table size " << KnobAccumTabSize.Value() << std::endl;
+    if (!KnobRdFile.Value().empty()) {
+        UINT64 m = KnobRdMax.Value(), line = KnobRdLine.Value();
+        if (m == 0 || (m & (m - 1)) != 0 || line == 0 || (line & (line - 1)) != 0 || KnobRdSample.Value() >= 32) {
+             PIN_ERROR( "-rdmax and -rdline must be powers of 2, -rdsample below 32.\n" 
+                  + KNOB_BASE::StringKnobSummary() + "\n");
+             return -1;
+        }
+        RdBins = ReuseDist::numBins(m);
+    }
+
+    /* the per-interval stats ride in the ring record too */
+    if (!KnobIntervalStats.Value().empty())
+        StatFields = 3;
+
+    if (!KnobPhaseFile.Value().empty() && (KnobRdvThreshold.Value() == 0 || KnobPhaseTabSize.Value() == 0)) {
+         PIN_ERROR( "bad phase table knobs.\n" 
+              + KNOB_BASE::StringKnobSummary() + "\n");
+         return -1;
+    }
+
+    std::string failed;
+    if (!openOutputs(KnobResume.Value(), failed)) {
+         PIN_ERROR( "output file: " + failed + " cannot be opened.\n" 
+              + KNOB_BASE::StringKnobSummary() + "\n");
+         return -1;
+    }
+    RecordSize = hdr.k + RdBins + StatFields;
+    outRing.init(RecordSize, 1024);
+
+    if (!KnobRecordFile.Value().empty()) {
+        Recording = true;
+        if (!traceOut.open(KnobRecordFile.Value())) {
+             PIN_ERROR( "trace file: " + KnobRecordFile.Value() + " cannot be opened.\n" 
+                  + KNOB_BASE::StringKnobSummary() + "\n");
+             return -1;
+        }
+    }
+
+    if (KnobThreadMode.Value() == "global")
+        GlobalClock = true;
+    else if (KnobThreadMode.Value() != "thread") {
+         PIN_ERROR( "unknown thread mode: " + KnobThreadMode.Value() + "\n" 
+              + KNOB_BASE::StringKnobSummary() + "\n");
+         return -1;
+    }
+
+    if (KnobSamplePeriod.Value() == 0 || (GlobalClock && KnobSamplePeriod.Value() > 1)
+        || (KnobStopMode.Value() != "exit" && KnobStopMode.Value() != "detach")) {
+         PIN_ERROR( "sampling needs -tmode thread and -sample > 0, -stopmode is exit or detach.\n" 
+              + KNOB_BASE::StringKnobSummary() + "\n");
+         return -1;
+    }
+
+    /* start with the light instrumentation when fast-forwarding */
+    if (KnobFastForward.Value() > 0) {
+        Profiling = false;
+        SkipTarget = KnobFastForward.Value();
+    }
+
+    /* a resumed run skips the insts of its checkpoint, -ff is in them */
+    if (KnobResume.Value()) {
+        Profiling = false;
+        SkipTarget = Resumed.insts;
+        TotalIntervals = Resumed.intervals;
+        WrittenIntervals = Resumed.threadIntervals;
+    }
+    NextCkpt = TotalIntervals + CkptEvery;
+
+    /* the threads publish at least 1/1024 of an interval at a time to the global clock */
+    ClockTick = std::max(IntervalSize / 1024, (UINT64)1);
+
+    projM.init(KnobAccumTabSize.Value(), KnobSeed.Value(), KnobSparseProj.Value(), KnobFixedProj.Value());
+    /* the BBs of a checkpoint get their IDs and projection columns back */
+    for (size_t i = 0; i < Resumed.keys.size(); ++i)
+        projM.addColumn(bbDict.lookup(Resumed.keys[i]), Resumed.keys[i]);
+
+    /* the per-thread state lives in TLS and is passed in a tool register */
+    ScratchReg = PIN_ClaimToolRegister();
+    if (!REG_valid(ScratchReg)) {
+         PIN_ERROR( "cannot claim a tool register.\n");
+         return -1;
+    }
+    TlsKey = PIN_CreateThreadDataKey(0);
+    PIN_InitLock(&outLock);
+    PIN_InitLock(&writeLock);
+    PIN_InitLock(&traceLock);
+    /* online phase classification, one line "interval thread phase next" per interval */
+    if (!KnobPhaseFile.Value().empty()) {
+        phaseTable.setCapacity(KnobPhaseTabSize.Value(), projM.rows());
+        phaseTable.setThreshold((double)1 / KnobRdvThreshold.Value());
+        phasePred.setSize(4096);
+    }
+
+    std::cout << "out file " << outputName(KnobOutputFile.Value()) << " (pid " << StreamHdr.pid << ")" \
+    << "\ninterval size " << IntervalSize << "\naccumulator table size " << KnobAccumTabSize.Value() \
+    << "\nprojection seed " << KnobSeed.Value() << (projM.isSparse() ? " (sparse)" : (projM.isFixed() ? " (fixed-point)" : "")) \
+    << "\nprojection isa " << isaName(projM.isa()) \
+    << "\ninstrumentation " << (KnobInsMode.Value() ? "per instruction" : "per BBL") \
+    << "\nBB key " << KnobBBKey.Value() << (PidNames ? ", following children" : "") \
+    << "\nthread mode " << KnobThreadMode.Value() \
+    << "\ninterval clock " << KnobClock.Value() \
+    << "\nreuse distance " << (RdBins ? KnobRdFile.Value() : "off") << " bins " << RdBins << " sample 1/" << (1 << KnobRdSample.Value()) \
+    << "\nfast-forward " << KnobFastForward.Value() << " sample 1/" << KnobSamplePeriod.Value() \
+    << " stop " << KnobStopInsts.Value() << " (" << KnobStopMode.Value() << ")" \
+    << "\ncheckpoint " << (CkptEvery ? KnobCkptFile.Value() : "off") << " every " << CkptEvery \
+    << (KnobResume.Value() ? " intervals, resumed" : " intervals") \
+    << "\noutput format " << KnobFormat.Value() << (hdr.compress ? " (compressed)" : "") << std::endl;
 
     // add an instrumentation function
     TRACE_AddInstrumentFunction(Trace, 0);
 
+    PIN_AddThreadStartFunction(ThreadStart, 0);
+    PIN_AddThreadFiniFunction(ThreadFini, 0);
+
     /* when the instrucments finish, call this API */
+    PIN_AddPrepareForFiniFunction(PrepareForFini, 0);
     PIN_AddFiniFunction(Fini, 0);
+    CODECACHE_AddCacheFlushedFunction(CacheFlushed, 0);
+    /* a forked child always writes outputs of its own, exec'd children are followed with -follow */
+    PIN_AddForkFunction(FPOINT_BEFORE, ForkBefore, 0);
+    PIN_AddForkFunction(FPOINT_AFTER_IN_PARENT, ForkParent, 0);
+    PIN_AddForkFunction(FPOINT_AFTER_IN_CHILD, ForkChild, 0);
+    if (KnobFollow.Value())
+        PIN_AddFollowChildProcessFunction(FollowChild, 0);
+    PIN_AddDetachFunction(DetachFini, 0);
+
+    /* the output is written off the application threads */
+    if (PIN_SpawnInternalThread(writerThread, 0, 0, &writerUid) == INVALID_THREADID) {
+         PIN_ERROR( "cannot spawn the writer thread.\n");
+         return -1;
+    }
 
     // Never returns
     PIN_StartProgram();
@@ -7,66 +7,193 @@
 #include <assert.h>
 #include <stdlib.h> 
 #include <deque>
-#include <float.h>
+#include <map>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 #include "pin.H"
+#include "bbvCore.h"
+#include "bbvFormat.h"
 
-static uint64_t InterCount = 0;
-static uint64_t NumMemAccs = 0;
-static uint64_t BBVInsts = 0;
-static uint64_t NumIntervals = 0;
 static uint64_t IntervalSize = 0;
+/* with the global clock, a thread publishes at least ClockTick units at a time */
+static uint64_t ClockTick = 1;
+static BOOL GlobalClock = false;
+/* what the interval clock counts */
+static IntervalUnit ClockUnit = UNIT_MEMREF;
+/* the reuse distance bins following the K projected values of a record, 0 without -rd */
+static UINT32 RdBins = 0;
+/* write the BB trace for bbvReplay */
+static BOOL Recording = false;
+/* the per-interval stats after the reuse distance bins, 0 without -istats */
+static UINT32 StatFields = 0;
+/* the values of a ring record: K, then RdBins, then StatFields */
+static int RecordSize = 0;
+/* the skipped insts are published every LightChunk */
+static const uint64_t LightChunk = 1 << 20;
+/* the BBs are keyed by image and offset, not by PC */
+static BOOL KeyByImage = true;
+/* the outputs are named with the PID, in a forked child or with -follow */
+static BOOL PidNames = false;
+/* the thread ID of a checkpoint request in outRing, its interval is the insts */
+static const uint32_t CkptMark = ~0U;
 
 /* parse the command line arguments */
 KNOB<string> KnobOutputFile(KNOB_MODE_WRITEONCE, "pintool", "o", "BBV.txt", "specify output file name");
 KNOB<UINT64> KnobAccumTabSize(KNOB_MODE_WRITEONCE, "pintool", "m", "16", "the accumulator table size");
-KNOB<UINT64> KnobIntervalSize(KNOB_MODE_WRITEONCE, "pintool", "i", "10000000", "the interval size");
+KNOB<UINT64> KnobIntervalSize(KNOB_MODE_WRITEONCE, "pintool", "i", "10000000", "the interval size, in units of the interval clock");
+KNOB<string> KnobClock(KNOB_MODE_WRITEONCE, "pintool", "clock", "mem", "the interval clock: instructions (ins), memory references (mem) or branches (br)");
+KNOB<UINT64> KnobSeed(KNOB_MODE_WRITEONCE, "pintool", "seed", "1", "the seed of the random projection");
+KNOB<BOOL> KnobSparseProj(KNOB_MODE_WRITEONCE, "pintool", "sparse", "0", "use a {-1, 0, +1} sparse random projection");
+KNOB<BOOL> KnobFixedProj(KNOB_MODE_WRITEONCE, "pintool", "fixed", "0", "project with a fixed-point int32 matrix, exact integer sums");
+KNOB<string> KnobFormat(KNOB_MODE_WRITEONCE, "pintool", "format", "text", "output format: text, float or varint");
+KNOB<BOOL> KnobCompress(KNOB_MODE_WRITEONCE, "pintool", "compress", "0", "compress the frames of a binary output");
+KNOB<BOOL> KnobVerbose(KNOB_MODE_WRITEONCE, "pintool", "v", "0", "print every interval to stdout");
+KNOB<string> KnobThreadMode(KNOB_MODE_WRITEONCE, "pintool", "tmode", "thread", "per-thread intervals (thread) or one interval clock of all threads (global)");
+KNOB<string> KnobPhaseFile(KNOB_MODE_WRITEONCE, "pintool", "phase", "", "classify the intervals online and write their phases to this file");
+KNOB<UINT64> KnobRdvThreshold(KNOB_MODE_WRITEONCE, "pintool", "t", "10", "the reciprocal of the phase distance threshold");
+KNOB<UINT64> KnobPhaseTabSize(KNOB_MODE_WRITEONCE, "pintool", "pt", "64", "the phase table size");
+KNOB<UINT64> KnobFastForward(KNOB_MODE_WRITEONCE, "pintool", "ff", "0", "skip the first N instructions with light instrumentation");
+KNOB<UINT64> KnobSamplePeriod(KNOB_MODE_WRITEONCE, "pintool", "sample", "1", "profile one interval out of every M of each thread");
+KNOB<UINT64> KnobStopInsts(KNOB_MODE_WRITEONCE, "pintool", "stop", "0", "stop after N instructions, checked at interval ends, 0 runs to the end");
+KNOB<string> KnobStopMode(KNOB_MODE_WRITEONCE, "pintool", "stopmode", "exit", "how to stop: exit the application or detach from it");
+KNOB<string> KnobRdFile(KNOB_MODE_WRITEONCE, "pintool", "rd", "", "write the reuse distance histogram of every interval to this file");
+KNOB<UINT64> KnobRdMax(KNOB_MODE_WRITEONCE, "pintool", "rdmax", "2048", "reuse distances from this power of 2 up share the last bin");
+KNOB<UINT64> KnobRdLine(KNOB_MODE_WRITEONCE, "pintool", "rdline", "64", "the cache line size of the reuse distance");
+KNOB<UINT64> KnobRdSample(KNOB_MODE_WRITEONCE, "pintool", "rdsample", "0", "sample 1 line out of 2^N for the reuse distance (SHARDS)");
+KNOB<string> KnobRecordFile(KNOB_MODE_WRITEONCE, "pintool", "record", "", "record the BB trace to this file, for bbvReplay");
+KNOB<string> KnobStatsFile(KNOB_MODE_WRITEONCE, "pintool", "stats", "", "write the counters and overhead timers of the run to this file as JSON");
+KNOB<string> KnobIntervalStats(KNOB_MODE_WRITEONCE, "pintool", "istats", "", "write the insts, touched BBs and projection cycles of every interval to this file");
+KNOB<string> KnobCkptFile(KNOB_MODE_WRITEONCE, "pintool", "ckpt", "", "write a checkpoint of the run to this file every -ckptevery intervals");
+KNOB<UINT64> KnobCkptEvery(KNOB_MODE_WRITEONCE, "pintool", "ckptevery", "1000", "the intervals between two checkpoints");
+KNOB<BOOL> KnobResume(KNOB_MODE_WRITEONCE, "pintool", "resume", "0", "fast-forward to the -ckpt checkpoint of an aborted run and append to its outputs");
+KNOB<string> KnobBBKey(KNOB_MODE_WRITEONCE, "pintool", "bbkey", "image", "key the BBs and their projection by image name and offset (image) or by PC (pc)");
+KNOB<BOOL> KnobFollow(KNOB_MODE_WRITEONCE, "pintool", "follow", "0", "profile the exec'd children too (with pin -follow_execv), every process names its outputs <file>.<pid>");
+KNOB<BOOL> KnobInsMode(KNOB_MODE_WRITEONCE, "pintool", "insmode", "0", "instrument every instruction instead of every basic block");
 
-/* for recording distribution into a Histogram, 
-   Accur is the accuracy of transforming calculation */
-template <class B = int64_t>
-class Histogram
+/* project the current BBV and start a new interval */
+VOID endInterval();
+
+/* the time stamp counter, the overhead timers count its cycles */
+static inline UINT64 readTSC()
 {
-    B * bins;
-    int _size;
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/* 
+ * the profiling state of a guest thread, created in ThreadStart and 
+ * reached by the analysis routines through a tool register
+ */
+class ThreadState
+{
+    /* keep the hot counters off the cache lines of other threads */
+    char padHead[64];
 
 public:
-    B samples;
+    /* reachLimit when its units get to its limit, IntervalSize without the global clock */
+    IntervalClock clock;
+    UINT64 numMemAccs;
+    UINT64 numInsts;
+    /* the analysis calls, counted instead of timed */
+    UINT64 numEvents;
+    /* the light instrumentation counts up to skipLimit */
+    UINT64 skipCount;
+    UINT64 skipLimit;
+    /* the insts run under the light instrumentation */
+    UINT64 skipInsts;
+
+private:
+    char padTail[64];
 
-    Histogram() : bins(nullptr), _size(0), samples(0) {};
+public:
+    /* numInsts published to GlobalInsts */
+    UINT64 pubInsts;
+    THREADID tid;
+    SparseBBV bbv;
+    /* the reuse distances of the interval, with -rd */
+    ReuseDist rd;
+    /* the projection of bbv, then the bins of rd */
+    double * accu;
+    Histogram<> intAccu;
+    /* the encoded events of -record and the last site ID in them */
+    std::vector<UINT8> recBuf;
+    UINT32 recLast;
+    /* numInsts at the last projection */
+    UINT64 projInsts;
+    /* the global epoch bbv belongs to */
+    UINT64 epoch;
 
-    Histogram(int s);
+    ThreadState(THREADID t, int k);
 
-    Histogram(const Histogram<B> & rhs);
+    ~ThreadState();
 
-    ~Histogram();
+    /* project bbv into accu, append the bins of rd and the stats, clear both */
+    void project();
+};
 
-    void setSize(int s);
+/* the interval clock of ts reached its limit */
+VOID reachLimit(ThreadState * ts);
 
-    const int size() const;
+/* project the BBV of ts and start a new interval of ts */
+VOID endInterval(ThreadState * ts);
 
-    void clear();
+/* publish the units of ts to the global clock, merge its BBV into its epoch once the clock passed it */
+VOID publishUnits(ThreadState * ts);
 
-    void normalize();
+/* publish the insts of ts, stop the run when the budget is used up */
+VOID publishInsts(ThreadState * ts);
 
-    double manhattanDist(const Histogram<B> & rhs);
+/* hand an interval to the writer thread */
+VOID emitRecord(UINT32 tid, UINT64 interval, const double * accu);
 
-    B & operator[](const int idx);
+/* ask the writer thread for a checkpoint after the intervals emitted so far */
+VOID requestCheckpoint(ThreadState * ts);
 
-    Histogram<B> & operator=(const Histogram<B> & rhs);
+/* save the checkpoint of the outputs written so far and of insts, by the writer thread */
+VOID writeCheckpoint(UINT64 insts);
 
-    Histogram<B> & operator+=(const Histogram<B> & rhs);
+// This function is called before every instruction is executed,
+// one instance per interval clock so the clock is not tested at run time
+template <IntervalUnit U>
+VOID PIN_FAST_ANALYSIS_CALL 
+doCount(ThreadState *, UINT32, BOOL, UINT32);
 
-    void sample(uint32_t x, int num = 1);
+/* called once per BBL, the BBL ends with a branch/call/ret */
+VOID PIN_FAST_ANALYSIS_CALL
+doBBL(ThreadState * ts, UINT32 bbId, UINT32 numInsts, UINT32 numMems, UINT32 unitHead, UINT32 unitTail);
 
-    const B getSamples() const; 
+/* called once per BBL that falls through without a branch */
+VOID PIN_FAST_ANALYSIS_CALL
+doBBLFall(ThreadState * ts, UINT32 numInsts, UINT32 numMems, UINT32 units);
 
-    void print(std::ofstream & file);
-};
+/* called for every counting site with -record */
+VOID PIN_FAST_ANALYSIS_CALL
+doRecord(ThreadState * ts, UINT32 siteId);
 
+/* write the recorded events of ts to traceOut */
+VOID flushRecord(ThreadState * ts);
 
-// This function is called before every instruction is executed
-VOID PIN_FAST_ANALYSIS_CALL 
-doCount(ADDRINT, BOOL, BOOL, BOOL, BOOL);
+/* called for every memory reference with -rd */
+VOID PIN_FAST_ANALYSIS_CALL
+doMemRef(ThreadState * ts, ADDRINT addr);
+
+/* the light instrumentation while skipping, returns true at the end of a chunk */
+ADDRINT PIN_FAST_ANALYSIS_CALL
+lightCount(ThreadState * ts, UINT32 numInsts);
+
+/* publish a skipped chunk, go back to profiling at the end of the window */
+VOID PIN_FAST_ANALYSIS_CALL
+endSkip(ThreadState * ts);
+
+VOID ThreadStart(THREADID tid, CONTEXT * ctxt, INT32 flags, VOID * v);
+
+VOID ThreadFini(THREADID tid, const CONTEXT * ctxt, INT32 code, VOID * v);
 
 /*
  * Insert code to write data to a thread-specific buffer for instructions
@@ -74,16 +201,152 @@ doCount(ADDRINT, BOOL, BOOL, BOOL, BOOL);
  */
 VOID Trace(TRACE trace, VOID *v);
 
+/* the output file of this process, name.<pid> in a forked child or with -follow */
+std::string outputName(const std::string & name);
+
+/* open the BBV stream and the sidecars of this process, failed is the file that cannot be opened */
+BOOL openOutputs(BOOL resume, std::string & failed);
+
+/* flush the outputs before a fork and keep them unwritten until ForkParent */
+VOID ForkBefore(THREADID tid, const CONTEXT * ctxt, VOID * v);
+
+VOID ForkParent(THREADID tid, const CONTEXT * ctxt, VOID * v);
+
+/* give a forked child outputs and a writer thread of its own */
+VOID ForkChild(THREADID tid, const CONTEXT * ctxt, VOID * v);
+
+/* run Pin in an exec'd child with -follow */
+BOOL FollowChild(CHILD_PROCESS child, VOID * v);
+
+/* count the code cache flushes */
+VOID CacheFlushed(VOID * v);
+
+/* the counters and timers of the run as a JSON object */
+VOID writeStats(std::ostream & out);
+
+/* write the records in outRing, false if it was empty */
+BOOL drainRing();
+
+/* the internal thread draining outRing to bbvOut */
+VOID writerThread(VOID * arg);
+
+/* stop the writer thread while the application threads are still alive */
+VOID PrepareForFini(VOID * v);
+
 /* output the results, and free the poiters */
 VOID Fini(INT32 code, VOID *v);
 
+/* the run stopped early with PIN_Detach */
+VOID DetachFini(VOID * v);
+
 /* ===================================================================== */
 /* Print Help Message                                                    */
 /* ===================================================================== */
 INT32 Usage();
 
 /* global variates */
-std::ofstream fout;
-Histogram<> currBBV;
+BBVWriter bbvOut;
+/* the header of bbvOut and rdOut, with the PIDs of this process */
+BBVHeader StreamHdr;
+/* the projected intervals on their way to the writer thread */
+RecordRing outRing;
+/* the producers of outRing take it at interval boundaries only */
+PIN_LOCK outLock;
+/* held while the outputs are written, so a fork sees them flushed */
+PIN_LOCK writeLock;
+PIN_THREAD_UID writerUid;
+/* the phases of the intervals, classified by the writer thread */
+std::ofstream phaseOut;
+/* the reuse distance histograms of the intervals */
+BBVWriter rdOut;
+/* the BB trace of -record, the sites are numbered by Trace() */
+TraceWriter traceOut;
+PIN_LOCK traceLock;
+UINT32 NumSites = 0;
+PhaseTable phaseTable;
+PhasePredictor phasePred;
+std::atomic<bool> writerExit(false);
+std::atomic<bool> writerDone(false);
+BBDict bbDict;
+ProjMatrix projM;
+/* the tool register holding the ThreadState of a thread */
+REG ScratchReg;
+TLS_KEY TlsKey;
+std::atomic<UINT64> TotalMemAccs(0);
+
+/* the per-interval stats, written by the writer thread */
+std::ofstream istatOut;
+
+/* 
+ * the overhead counters, only updated at interval boundaries, by the
+ * writer and at instrumentation time. The timers count TSC cycles.
+ */
+std::atomic<UINT64> ProjCycles(0);
+std::atomic<UINT64> ProjCalls(0);
+std::atomic<UINT64> TouchedBBs(0);
+std::atomic<UINT64> EmitCycles(0);
+std::atomic<UINT64> WriteCycles(0);
+std::atomic<UINT64> WriteRecords(0);
+std::atomic<UINT64> TraceCycles(0);
+std::atomic<UINT64> NumTraces(0);
+std::atomic<UINT64> CacheFlushes(0);
+std::atomic<UINT64> AnalysisCalls(0);
+UINT64 StartTSC = 0;
+std::chrono::steady_clock::time_point StartTime;
+
+/* 
+ * fast-forward and resume: while Profiling is false, Trace() inserts
+ * the light instrumentation, counting insts until GlobalSkip reaches
+ * SkipTarget. The switch back flushes the code cache, no thread has
+ * profiled counts before it. -sample is per thread and never switches.
+ */
+std::atomic<bool> Profiling(true);
+std::atomic<UINT64> SkipTarget(0);
+std::atomic<UINT64> GlobalSkip(0);
+std::atomic<UINT64> GlobalInsts(0);
+std::atomic<bool> Stopping(false);
+std::atomic<UINT64> TotalIntervals(0);
+
+/* the counts of a finished thread, for -stats */
+struct ThreadSummary
+{
+    THREADID tid;
+    UINT64 insts;
+    /* the insts the interval clock saw, without the skipped ones */
+    UINT64 profiledInsts;
+    UINT64 intervals;
+};
+/* the finished threads, guarded by outLock */
+std::vector<ThreadSummary> FinishedThreads;
+
+/* 
+ * checkpoints: every CkptEvery intervals an application thread puts a
+ * request in outRing, the writer thread saves the state once the records
+ * before it are written, so the offsets match the outputs exactly
+ */
+UINT64 CkptEvery = 0;
+std::atomic<UINT64> NextCkpt(0);
+std::atomic<UINT64> NumCkpts(0);
+std::atomic<UINT64> CkptCycles(0);
+/* the last interval written of every thread, kept by the writer */
+std::vector<UINT64> WrittenIntervals;
+/* the checkpoint of -resume, the threads continue its interval numbers */
+Checkpoint Resumed;
+
+/* 
+ * the global clock: GlobalCount sums the units of all threads. a thread
+ * keeps its BBV until the clock passes its epoch and merges it into
+ * EpochBufs once. an epoch is emitted when every live thread has passed
+ * it, or MaxEpochLag epochs later if a thread sleeps through them
+ */
+static const UINT64 MaxEpochLag = 4;
+std::atomic<UINT64> GlobalCount(0);
+std::atomic<UINT32> LiveThreads(0);
+/* the records of the epochs from EmittedEpochs on, guarded by outLock */
+std::deque<std::vector<double> > EpochBufs;
+/* the epoch of every live thread, guarded by outLock */
+std::map<THREADID, UINT64> ThreadEpochs;
+/* the epochs emitted so far, guarded by outLock */
+UINT64 EmittedEpochs = 0;
 
 #endif
\ No newline at end of file
@@ -1,36 +0,0 @@
-#pragma once
-
-double randM[32][2756] = {
-	{0.521741, 0.373034, 0.236318, 0.155985, 0.90767, -0.531068, -0.851238, -0.29592, 0.487431, 0.593365, 0.0862366, 0.927439, -0.322026, -0.927626, 0.074004, 0.753451, -0.503738, 0.144886, 0.932666, 0.853976, -0.771179, 0.669414, 0.551446, -0.360796, -0.985942, -0.159116, -0.0247501, -0.383537, 0.111479, 0.991383, 0.243981, 0.743629, 0.466761, -0.709269, -0.921593, -0.33468, 0.670366, -0.299322, -0.723149, -0.771965, -0.716374, -0.325517, -0.52294, -0.616, -0.120876, -0.765208, 0.758275, 0.0942817, -0.758466, -0.265283, -0.68382, 0.385835, -0.428986, -0.554627, 0.194996, 0.841868, -0.134089, 0.6797, -0.207813, -0.481036, 0.599149, -0.585675, -0.193641, -0.244762, 0.338627, 0.13087, -0.422434, -0.603545, 0.355999, -0.704997, -0.947122, 0.892756, -0.327062, 0.739827, 0.187398, 0.180207, -0.151801, 0.0144963, -0.800978, -0.5457, -0.0949541, -0.707956, 0.807026, -0.748959, 0.390938, -0.353218, -0.26021, -0.812355, -0.559252, -0.580051, -0.65678, -0.637927, 0.767337, 0.16055, -0.751575, -0.447069, 0.0543615, 0.391187, -0.590468, 0.319584, 0.988677, 0.769793, 0.107329, 0.551819, 0.313138, 0.348124, 0.570165, 0.984749, 0.646459, 0.539751, -0.421809, 0.218844, 0.989569, 0.981809, 0.678874, 0.794269, 0.662943, -0.584042, 0.933937, 0.514944, 0.0824825, -0.495133, 0.281022, -0.861218, 0.769622, -0.126086, 0.544033, -0.0155116, 0.704146, 0.869068, -0.560091, 0.983237, -0.112924, 0.0805692, 0.271083, 0.890094, -0.37536, -0.107669, 0.339199, 0.957196, -0.46776, -0.600051, -0.946674, 0.221453, 0.0622307, -0.140606, 0.401136, 0.0526041, 0.041293, 0.840705, 0.891877, -0.95173, -0.886706, -0.864433, -0.0651948, 0.347853, 0.216463, 0.814035, -0.350229, 0.946768, 0.225656, 0.938013, 0.711292, -0.879657, -0.726466, 0.410599, -0.197208, -0.263353, 0.837651, 0.0773348, -0.336494, 0.463842, 0.996442, 0.419254, 0.324864, 0.116481, -0.916572, 0.140731, 0.908141, 0.164687, -0.620144, -0.833546, 0.537839, 0.51077, -0.218749, 0.446194, -0.108238, -0.724849, -0.716549, -0.698644, 0.541972, 0.628693, -0.0035826, 0.0248105, -0.0397078, 0.106096, -0.38256, -0.247527, 0.727263, 0.152377, 0.238179, -0.186959, -0.0925392, -0.187517, 0.451, -0.919156, -0.350527, -0.650124, -0.37844, 0.531196, 0.619302, -0.866385, -0.653697, 0.147054, 0.544099, 0.0837268, 0.323326, -0.970325, 0.205631, 0.370104, 0.378208, -0.13104, -0.492783, -0.795257, -0.608564, -0.206213, 0.567684, 0.0689106, -0.305906, 0.506113, -0.562893, -0.53782, 0.448751, -0.337131, -0.408761, 0.945856, 0.461045, -0.462342, -0.956216, -0.402313, -0.789428, 0.369599, 0.868184, -0.723611, 0.279218, -0.0728517, 0.149983, -0.537437, -0.947353, -0.677536, -0.175659, 0.345784, 0.23277, -0.62302, -0.621215, 0.886886, -0.0917365, 0.357993, -0.732848, -0.362319, -0.0292469, 0.544688, -0.301644, -0.504201, 0.865993, 0.685298, -0.322921, 0.954727, 0.103781, 0.621773, 0.347414, -0.606746, -0.874543, 0.284077, 0.504469, -0.487088, -0.360857, 0.236994, 0.1435, 0.835344, -0.819405, -0.0495272, -0.727566, -0.170187, -0.595704, 0.106597, -0.0397938, 0.196942, 0.339427, 0.589427, 0.432565, 0.733268, 0.872945, -0.57464, -0.954133, -0.0961196, 0.55346, 0.542134, 0.258839, 0.903693, -0.159589, -0.769775, 0.781685, 0.631628, -0.0958742, -0.969591, -0.293893, -0.0118013, 0.254509, -0.642667, -0.718202, 0.0123394, 0.622542, -0.354292, 0.55251, -0.697142, -0.188589, 0.930288, -0.942451, -0.944603, -0.461779, 0.171514, -0.154374, -0.355864, -0.218574, 0.07597, 0.916465, -0.961914, 0.386838, -0.788342, 0.0295043, 0.704108, 0.836334, 0.956917, -0.579938, -0.162091, 0.536437, 0.53931, 0.529143, 0.260364, -0.575198, 0.803395, 0.574924, 0.63361, -0.757274, 0.131142, 0.553971, -0.143911, 0.281526, 0.207114, -0.831834, -0.853363, 0.839027, -0.533427, -0.0118879, -0.0749914, -0.406677, -0.448895, 0.163925, 0.0728313, -0.844043, 0.476375, -0.478867, -0.378991, -0.236029, -0.306325, -0.976508, -0.656296, -0.479877, -0.00813109, -0.617923, 0.0233094, 0.92955, 0.846055, 0.325469, 0.408725, -0.743858, 0.432159, -0.0801114, -0.473815, 0.687422, 0.13432, 0.567559, 0.195447, -0.00307621, -0.161359, -0.43735, -0.127932, -0.858056, 0.91681, -0.294112, -0.236534, -0.417952, 0.845321, -0.251377, -0.903903, 0.584376, -0.497271, 0.745393, -0.607052, 0.645738, -0.883714, -0.377263, -0.593543, -0.0691457, -0.773397, 0.935081, 0.685202, 0.390637, 0.102361, -0.662844, 0.629962, 0.849591, -0.391952, -0.730471, -0.911283, -0.0189874, 0.0684653, -0.635781, -0.603889, 0.749829, 0.0408223, -0.183985, 0.212902, -0.578309, 0.392748, 0.785805, -0.626074, -0.701985, 0.727224, -0.197917, 0.0996913, -0.914808, -0.558724, -0.481741, 0.72038, -0.573725, -0.397035, -0.281153, -0.915921, -0.269322, -0.255192, -0.852453, -0.657789, 0.232996, 0.558194, 0.920407, 0.19248, -0.694429, -0.00202877, 0.858191, -0.491877, 0.116372, 0.926085, -0.209485, 0.157583, -0.755446, -0.957702, -0.0915053, 0.527146, 0.465475, 0.291022, -0.325073, -0.800971, 0.45252, 0.399696, 0.421642, 0.556078, 0.0734906, 0.162234, 0.657116, -0.978058, -0.306541, -0.129712, 0.411971, -0.522963, 0.681844, -0.161082, 0.24996, -0.304004, -0.911153, -0.303336, 0.298112, 0.749397, 0.361719, -0.752549, -0.210202, -0.208279, 0.493477, 0.903267, 0.894709, -0.684625, -0.137987, 0.580611, -0.666151, 0.538188, 0.0763915, 0.308677, -0.414213, 0.762639, -0.815822, 0.231658, -0.0337405, 0.630678, -0.840318, -0.0568744, 0.113341, -0.337559, -0.863574, -0.782833, 0.0686, -0.122178, -0.789578, 0.696883, 0.530977, -0.982442, 0.75573, 0.228514, -0.0349326, -0.610319, -0.384807, 0.338646, -0.123846, -0.643567, 0.515608, 0.287965, 0.637224, 0.157389, -0.181693, -0.723183, -0.0453002, -0.873444, 0.116166, 0.458669, -0.448735, 0.775842, 0.263036, 0.925701, -0.0683461, 0.922388, 0.746863, 0.622859, 0.249337, -0.324873, -0.860891, -0.485077, 0.861109, 0.277737, -0.128546, -0.0615119, 0.626789, 0.676562, -0.725731, -0.467113, 0.839422, 0.671119, 0.376067, -0.184712, 0.801692, 0.529302, 0.868573, 0.714183, 0.624545, 0.652078, -0.2749, 0.546749, 0.0117283, -0.257706, 0.632928, -0.0773133, 0.489345, -0.690447, 0.805336, -0.496713, 0.831819, 0.113268, 0.206184, 0.0865782, -0.310486, -0.334851, 0.374648, 0.497716, 0.305441, 0.19248, 0.723062, -0.16342, 0.31535, -0.638585, 0.862713, 0.707008, -0.498523, 0.406504, -0.986691, 0.612115, 0.420639, 0.67507, -0.931817, 0.290039, 0.755074, 0.402699, 0.701961, -0.511053, 0.37344, 0.535589, 0.653281, 0.56509, 0.0261457, -0.886443, -0.524901, -0.329692, -0.744166, -0.12858, -0.120214, -0.957249, -0.660262, 0.660628, -0.744969, 0.935588, 0.846616, 0.486659, -0.51339, -0.00712753, -0.595479, -0.807528, 0.510159, 0.362614, -0.988267, -0.183563, 0.413162, -0.226273, -0.418159, 0.558564, 0.954144, -0.762597, 0.607229, -0.9443, -0.92889, 0.143423, 0.977672, 0.996233, -0.85332, 0.577086, 0.659933, -0.820814, 0.0387567, -0.851524, -0.731619, 0.60135, -0.392676, 0.589201, -0.260646, -0.950392, -0.849026, 0.962199, -0.256344, -0.516369, 0.070453, -0.0568656, -0.710028, -0.796791, 0.761754, 0.520966, -0.0926552, 0.0739282, -0.143542, 0.881899, 0.370835, -0.101193, -0.982413, -0.451183, -0.0241691, -0.849226, -0.37554, 0.788593, 0.0662958, 0.529271, -0.244525, -0.0669954, -0.551393, 0.279511, -0.637953, 0.822377, -0.773466, -0.46988, -0.795817, 0.827326, -0.027526, 0.974684, 0.709676, -0.92683, 0.73442, 0.384106, 0.200471, -0.421834, -0.799337, 0.027894, -0.490829, 0.963076, 0.651538, -0.184936, -0.425572, -0.882707, -0.960532, 0.778079, 0.383194, 0.190822, 0.257617, -0.0783506, 0.982659, 0.810642, -0.611513, -0.193888, -0.282682, -0.0315419, 0.196854, 0.790447, -0.892418, 0.676867, -0.916156, 0.911242, -0.98831, 0.477974, -0.740528, -0.818283, 0.91163, -0.233178, 0.295582, -0.699117, 0.967421, -0.387368, -0.208666, 0.253587, 0.633118, 0.337195, 0.929107, 0.369936, 0.309992, -0.216072, -0.563138, 0.732518, -0.815503, -0.559807, 0.21979, -0.181196, 0.332783, 0.393974, -0.152771, 0.780807, -0.111504, -0.209855, 0.447718, 0.0262285, -0.9123, 0.263943, -0.486577, -0.949251, 0.856035, -0.583146, 0.302214, 0.964577, -0.691498, -0.762531, 0.883515, 0.696059, -0.116025, -0.542231, -0.25681, 0.385237, -0.103964, 0.446138, 0.156322, 0.527676, -0.926316, -0.707253, -0.367084, -0.130589, 0.950237, -0.339536, 0.613924, 0.964958, -0.048898, 0.1654, 0.695453, 0.981336, -0.660019, -0.49072, -0.53437, -0.675161, -0.814421, -0.744353, -0.338015, 0.676472, 0.659867, -0.350318, -0.467555, 0.378429, 0.448744, 0.399812, 0.523422, -0.210016, 0.452837, 0.06974, -0.415283, 0.0355731, 0.203993, -0.808112, 0.994814, 0.471058, 0.542558, -0.19779, 0.5305, -0.177033, 0.619209, 0.715522, 0.366368, -0.208778, 0.508266, -0.605346, -0.245733, -0.531209, 0.253565, -0.80748, -0.0354299, -0.86476, 0.255206, -0.133381, 0.18785, -0.492426, -0.370114, -0.329138, -0.523073, -0.942618, -0.960479, -0.527021, -0.324287, -0.826653, 0.535459, -0.285891, 0.683546, 0.0372423, -0.0813103, 0.405753, 0.277903, 0.577529, 0.539637, 0.0561143, -0.392505, -0.714825, -0.274343, 0.392657, 0.448618, 0.726379, 0.55812, -0.515512, -0.190249, -0.314546, -0.212867, -0.422113, 0.540189, 0.0384913, 0.386421, -0.751383, -0.654568, -0.0529024, -0.0673351, -0.158607, -0.0111586, 0.797654, -0.0901284, -0.412974, 0.0338654, -0.998053, 0.0756832, 0.945243, -0.502507, 0.163518, 0.236995, -0.922859, 0.42784, 0.343455, 0.628103, 0.947409, -0.0360322, 0.100308, 0.633935, 0.872111, 0.864076, -0.732797, 0.330031, 0.224175, -0.829122, -0.100721, -0.0501882, 0.30537, 0.754705, -0.341654, 0.255024, 0.641265, -0.180862, -0.260306, -0.719014, -0.393025, -0.238932, -0.401243, -0.29561, 0.559062, 0.80814, -0.535686, 0.210337, 0.516174, -0.435343, 0.703012, -0.0687141, -0.202199, 0.47797, -0.421417, 0.508654, -0.210086, -0.63754, -0.934292, 0.266526, 0.345508, -0.171877, 0.333087, 0.525273, 0.567521, 0.527822, -0.995091, -0.445582, 0.205895, 0.923012, -0.908182, -0.980067, -0.729308, -0.768148, 0.86757, 0.689999, -0.634512, -0.00747802, -0.166607, 0.270261, 0.0805875, -0.276571, 0.887471, 0.245912, -0.588046, -0.969446, 0.542215, -0.347931, 0.844259, -0.823148, 0.572883, -0.7105, 0.236561, 0.547355, 0.464265, -0.0228674, 0.937362, -0.54637, -0.153325, 0.935423, 0.200976, 0.125859, -0.16277, -0.421075, 0.0916562, -0.772436, 0.0967438, -0.329921, -0.00648325, 0.818196, 0.156782, -0.372906, -0.246753, 0.366525, 0.140796, 0.558255, -0.985299, -0.675914, 0.293026, -0.952648, 0.731511, -0.172827, -0.439152, -0.0556915, 0.519532, -0.0660871, 0.590513, -0.38373, -0.928503, -0.780128, -0.697126, 0.51737, -0.659487, -0.441378, 0.58263, 0.25376, 0.412719, 0.231679, -0.234148, -0.569987, 0.159138, -0.0929681, -0.801431, 0.668013, -0.554762, -0.251573, 0.263582, -0.447736, -0.64991, -0.92447, -0.858567, 0.354023, -0.993775, 0.972068, -0.405551, -0.983128, -0.430244, -0.77701, -0.917906, 0.555821, -0.85232, -0.484096, -0.800921, 0.859057, 0.197671, -0.728299, -0.256547, -0.601943, 0.518423, -0.273882, -0.677326, -0.863409, -0.0504368, 0.321687, 0.625216, -0.881059, -0.06373, -0.138011, 0.696219, -0.0633835, 0.869877, 0.396339, 0.13113, -0.906566, -0.716268, 0.376564, -0.711468, -0.887168, -0.209089, -0.286927, -0.567789, -0.336144, 0.501222, 0.133435, 0.623676, 0.334483, -0.149356, -0.303306, -0.250615, -0.964243, -0.129881, -0.438683, 0.514741, 0.683515, -0.925471, -0.993498, 0.294588, -0.903376, -0.630207, 0.0854338, -0.913422, 0.435308, 0.922199, -0.934852, 0.597968, -0.849853, -0.176091, -0.0844973, 0.334422, -0.0523856, -0.133451, -0.0919483, 0.634486, -0.676424, -0.0127389, -0.330686, 0.0226032, -0.899967, 0.396073, 0.6751, 0.764776, 0.98394, -0.945233, -0.664763, -0.944779, 0.148679, -0.581771, -0.7166, -0.444771, 0.341209, -0.826403, 0.013913, -0.593469, 0.00996763, -0.241542, 0.605365, -0.830171, -0.773154, -0.933905, -0.18968, -0.753596, -0.128906, -0.343114, -0.120937, -0.396321, -0.843509, 0.0874741, -0.666516, 0.479235, 0.365734, -0.852752, -0.554492, -0.332912, -0.980608, -0.2328, 0.0348804, 0.566891, 0.323667, 0.436583, 0.707446, 0.436142, 0.350221, 0.788671, -0.0578179, 0.930489, -0.783118, 0.673725, 0.806116, -0.386929, 0.94072, 0.496608, 0.847629, -0.45549, 0.371015, 0.0188318, -0.252175, 0.579517, -0.367501, 0.932721, 0.266443, 0.778333, 0.470564, 0.167894, -0.788186, -0.778211, -0.582272, 0.145857, -0.380154, -0.960374, 0.450634, 0.350417, -0.903495, -0.570876, -0.578418, 0.774919, -0.724772, -0.341811, -0.0527504, -0.823579, -0.770967, -0.980489, -0.472229, 0.549003, 0.293371, 0.16623, 0.322991, 0.514616, 0.0680921, -0.280846, -0.788103, 0.908907, 0.826241, -0.572435, 0.17957, 0.408399, -0.181036, -0.126798, 0.408674, 0.284919, -0.612431, 0.594559, 0.431331, -0.438104, 0.388077, 0.30437, 0.525041, -0.633374, -0.0654998, -0.54438, -0.450773, -0.435484, -0.704922, 0.269562, -0.145158, 0.690665, 0.170369, -0.892803, 0.275633, 0.0756903, 0.378599, 0.510619, 0.584519, 0.524706, 0.411751, 0.0292153, -0.706429, 0.165211, -0.296014, -0.131673, 0.144383, 0.978808, -0.437291, 0.66456, 0.991738, -0.513903, 0.778514, -0.910605, -0.223656, 0.777836, 0.695336, 0.888348, -0.987032, -0.256151, -0.632962, -0.706615, -0.321582, 0.699752, -0.689571, 0.742356, -0.122119, -0.37639, -0.152068, -0.778104, -0.885918, 0.626445, -0.0991167, -0.934907, -0.980805, 0.604113, 0.817482, 0.705262, -0.635134, -0.740121, 0.241227, 0.889706, -0.500936, 0.0789705, 0.131614, 0.682243, 0.904893, -0.656634, 0.890408, -0.0966133, 0.0456829, 0.949125, 0.117028, 0.0468838, 0.41054, -0.557759, -0.0946505, 0.124557, -0.868333, -0.516224, 0.835687, 0.316961, -0.882139, -0.11728, -0.940266, -0.668555, -0.864576, 0.2056, -0.738906, 0.458132, -0.966097, -0.949786, -0.468961, -0.915171, 0.0100301, 0.730049, -0.625629, 0.714993, -0.787961, -0.286468, -0.0861787, 0.364932, -0.823298, -0.713248, 0.738121, 0.392051, -0.68163, 0.507373, -0.102424, 0.655535, -0.963152, 0.364923, -0.96291, -0.31449, 0.637726, 0.459875, 0.997729, -0.777927, 0.637818, -0.547239, -0.03498, -0.602779, -0.938761, 0.228331, 0.192991, -0.315354, -0.608648, -0.356731, 0.357197, -0.970385, -0.167235, 0.452133, -0.847201, -0.869814, 0.784811, 0.543506, 0.481457, 0.346852, 0.0430784, -0.360603, 0.138913, 0.0800996, -0.407995, -0.0536519, -0.0313647, 0.170328, -0.331089, -0.021508, 0.740894, 0.332642, 0.528843, -0.986838, -0.302736, -0.625891, -0.0140445, 0.276555, 0.679467, -0.438112, -0.0774467, -0.659323, 0.417468, 0.989571, 0.748105, 0.617828, 0.332758, -0.914045, 0.82184, -0.606699, -0.666795, 0.272144, -0.517029, 0.437, 0.456538, 0.0721811, 0.00387365, 0.660917, -0.329983, 0.0812141, -0.661812, -0.116537, 0.964052, 0.452582, 0.984499, 0.941633, -0.773502, -0.889332, -0.461856, 0.425671, -0.75228, -0.434687, -0.305, -0.812161, 0.687702, 0.599365, -0.223708, -0.155643, 0.38349, -0.391613, 0.785393, -0.0192209, 0.57937, -0.366138, -0.948774, -0.0528287, -0.523683, -0.393273, -0.721496, 0.730999, -0.365669, 0.581238, 0.779184, 0.962573, 0.416078, -0.659846, 0.413675, -0.00303624, 0.465473, 0.284041, -0.0891936, 0.125176, 0.746134, 0.265896, 0.661866, -0.882445, 0.263243, 0.40465, 0.0495226, -0.847423, 0.432674, -0.308951, -0.21038, -0.52709, 0.696101, 0.789524, 0.55714, -0.134397, 0.88466, -0.65721, -0.87472, -0.402702, 0.811499, 0.411307, -0.289322, 0.335807, -0.146525, -0.999013, -0.101863, -0.856218, -0.0131406, 0.0424698, 0.37841, 0.828576, 0.972843, -0.423106, -0.59543, -0.623526, -0.886651, 0.959724, -0.0708458, 0.780212, -0.634147, 0.285937, -0.527745, 0.300727, 0.223141, 0.416151, 0.778577, -0.920087, 0.295078, 0.260946, 0.716249, -0.797899, 0.512248, 0.930496, -0.144674, 0.119216, -0.571817, 0.569973, -0.967101, -0.914416, -0.15045, -0.394288, -0.192632, -0.387069, -0.446501, -0.349739, -0.88524, -0.977049, 0.88004, -0.552816, 0.448892, 0.677145, -0.861927, 0.558896, 0.150152, -0.313376, 0.786626, 0.129022, 0.111946, 0.0277699, 0.847618, 0.177823, -0.412964, -0.737728, 0.64971, -0.85285, 0.776896, -0.81866, -0.238766, -0.711565, 0.188239, 0.280965, -0.665619, -0.0359909, 0.349001, -0.53874, 0.160596, 0.181803, 0.800802, 0.0572959, -0.388655, 0.266119, 0.0774882, -0.281435, 0.749453, -0.222528, -0.391008, 0.0307557, 0.332689, -0.561595, -0.624302, -0.495194, 0.830894, -0.972706, -0.030122, 0.541007, -0.171501, -0.248078, -0.13005, 0.292879, 0.785071, 0.576379, -0.507444, 0.750583, -0.0426593, 0.14286, 0.80434, 0.352233, 0.53891, 0.754124, 0.00933133, -0.18442, 0.579276, -0.4493, -0.522124, -0.048223, 0.818273, -0.887815, -0.144849, 0.761498, -0.678906, -0.612601, -0.988201, -0.622349, 0.329728, -0.00732227, 0.230085, 0.250916, -0.35837, 0.656536, 0.481808, 0.850297, -0.586111, 0.704272, -0.578155, -0.115991, -0.898685, 0.388569, -0.113376, -0.316117, 0.763343, 0.0142954, 0.65266, -0.893322, 0.446762, -0.34056, 0.187856, -0.0625268, -0.632943, -0.848582, 0.512012, 0.128361, 0.327139, 0.627314, -0.663606, -0.696762, -0.9248, 0.641704, -0.0696099, -0.251051, -0.910436, -0.692804, -0.52152, 0.860594, -0.215313, -0.975768, -0.409867, -0.107182, 0.363169, -0.726874, 0.811323, -0.56581, -0.693617, -0.0526229, -0.530906, 0.643437, 0.920157, -0.358394, 0.0889073, 0.568623, 0.445797, -0.763611, 0.183119, 0.166634, -0.139814, -0.394524, -0.723372, 0.430533, -0.603976, 0.486598, 0.240973, -0.380537, -0.0908266, -0.401418, -0.341129, -0.695541, -0.92429, -0.993543, 0.242231, 0.137938, 0.233478, 0.352277, 0.256943, 0.737455, 0.590912, 0.0794852, -0.604008, -0.732884, 0.50336, 0.223682, 0.751707, 0.971899, 0.890032, 0.0878498, -0.80893, 0.171632, 0.147786, -0.525514, -0.652171, 0.301952, 0.703208, 0.189908, 0.203025, 0.99868, -0.495124, 0.0610307, 0.789911, -0.406336, -0.886119, 0.977696, -0.251584, 0.269081, -0.378213, 0.054494, 0.645306, 0.283916, -0.0991087, 0.193959, 0.786606, -0.868415, 0.88472, -0.42106, -0.4214, -0.809353, -0.879064, 0.826368, 0.947246, 0.622978, 0.193639, 0.396569, 0.0313872, -0.70166, 0.989224, -0.503013, 0.471464, 0.152789, -0.647428, -0.110459, -0.152337, 0.294886, -0.684186, -0.672453, 0.449708, -0.894947, 0.182891, 0.473952, 0.526144, -0.232869, 0.0522018, -0.597464, -0.0822574, 0.162457, 0.798424, -0.889241, -0.575127, -0.646551, 0.325725, -0.82501, 0.515381, 0.863252, 0.534095, -0.738053, -0.220406, 0.00130218, -0.998936, -0.21083, -0.925396, -0.520369, -0.281411, -0.175253, 0.997137, -0.645677, 0.578772, -0.641347, 0.765934, 0.491397, -0.941342, 0.632141, 0.290919, -0.755226, -0.705265, 0.511808, 0.32236, 0.563696, -0.261796, -0.761979, 0.647428, -0.503177, -0.354404, 0.750273, 0.880074, 0.111918, -0.0482505, -0.0779732, 0.476905, 0.0168299, -0.122047, 0.00309151, 0.338584, -0.102382, -0.96573, -0.654428, 0.185681, -0.977055, 0.95602, -0.550858, 0.969985, 0.783594, 0.388438, 0.77755, 0.351393, 0.676003, 0.548081, -0.0138573, 0.565314, -0.253425, -0.0896412, 0.295858, -0.114132, -0.143992, 0.350356, 0.261822, -0.0633194, 0.643601, 0.157702, -0.120412, 0.909846, -0.230239, 0.137427, -0.675447, -0.49993, -0.127932, 0.189515, 0.0735847, -0.750389, -0.923621, 0.434887, 0.724316, 0.791304, -0.734713, 0.460098, -0.561054, -0.494901, 0.95334, 0.796631, 0.731312, 0.238898, 0.0687763, 0.708151, -0.674097, -0.618018, -0.157594, 0.925438, 0.276253, -0.754178, -0.921745, -0.0603585, -0.257656, -0.370324, 0.550599, -0.485911, 0.326894, 0.0174753, 0.524572, 0.437146, -0.00344413, -0.275308, 0.919884, 0.493126, 0.235968, 0.142097, 0.685006, 0.177936, 0.0981999, -0.249011, 0.244687, 0.356669, -0.17296, 0.188965, 0.699199, -0.436179, 0.220905, -0.895099, 0.560188, -0.573198, -0.759985, 0.905999, -0.991395, 0.784483, -0.20355, 0.97258, -0.777421, -0.997348, 0.873405, -0.510014, -0.56312, -0.333102, -0.550413, 0.256179, -0.24234, 0.947684, -0.502494, 0.626562, -0.641386, -0.650828, 0.537656, 0.0866597, 0.621812, -0.932907, 0.335015, -0.569341, 0.798992, 0.347805, 0.0906033, -0.411827, 0.331438, 0.931158, 0.753681, -0.379726, 0.558308, 0.776395, -0.998348, 0.677031, 0.364009, 0.269444, -0.259165, -0.684874, -0.870279, 0.682565, -0.800561, 0.0685969, -0.17914, -0.9227, 0.712141, 0.877545, 0.584785, -0.288589, 0.449028, -0.368904, -0.312167, -0.0628886, -0.179345, -0.419099, -0.0335819, -0.976706, -0.255253, -0.125399, -0.957235, -0.0085494, -0.220704, 0.591067, 0.0034364, -0.976112, 0.660244, -0.717612, -0.315488, 0.595634, 0.80607, -0.494498, 0.844093, -0.32486, 0.0421664, -0.674967, 0.398786, 0.648508, -0.397981, -0.830773, 0.425607, -0.39676, 0.461984, 0.807772, 0.787721, 0.349765, 0.164647, 0.599321, 0.418047, -0.184015, -0.247242, -0.0467212, 0.924315, 0.839272, -0.442027, -0.0210028, 0.794744, 0.274116, 0.26363, -0.336913, -0.390498, 0.859104, 0.0655496, 0.185761, -0.169667, 0.675808, 0.960619, 0.110115, 0.473433, 0.965478, 0.119752, 0.22544, 0.319432, -0.64564, -0.87702, -0.0947459, 0.275521, 0.226452, -0.945449, -0.536663, -0.165491, -0.168051, -0.0843239, -0.157546, -0.539327, -0.38061, 0.370474, 0.948191, 0.314169, 0.39905, 0.844182, 0.0116657, -0.084701, -0.349317, 0.26763, -0.396276, -0.967044, 0.65674, 0.859081, -0.613913, -0.923749, -0.870672, 0.115438, 0.00374823, 0.625917, -0.93756, -0.967327, 0.944808, 0.237205, -0.887093, -0.468408, 0.704914, -0.570811, -0.171961, -0.954524, 0.650612, -0.400256, 0.969335, -0.0932268, -0.441614, 0.804943, -0.759885, -0.0991484, -0.855586, -0.878305, -0.563719, 0.0706904, -0.566963, -0.59032, -0.745404, 0.809505, -0.307431, 0.0699782, -0.540614, -0.498103, 0.974256, -0.139957, 0.030728, -0.0205251, 0.262022, 0.556881, -0.740525, -0.36724, 0.920801, 0.33427, -0.609079, 0.0850827, -0.139054, 0.39466, -0.916537, 0.79286, -0.390385, -0.348377, -0.0462852, -0.757627, -0.0151529, 0.106499, 0.0560363, -0.245157, -0.128815, -0.0754393, 0.103821, 0.0183896, 0.986323, 0.343491, -0.539928, -0.582612, -0.834682, 0.611214, 0.270316, 0.77706, 0.495302, 0.0656268, 0.320585, 0.3484, -0.00295787, 0.261841, 0.876883, -0.499086, 0.609534, -0.255099, -0.347742, 0.94488, -0.168706, -0.316659, -0.0943081, 0.778328, -0.929823, -0.893439, 0.0368687, 0.594218, 0.360706, 0.365372, -0.555684, -0.148151, 0.38533, 0.81412, -0.668404, 0.304489, -0.275699, -0.0704957, -0.514961, 0.376243, -0.978624, 0.828418, 0.76478, 0.874983, -0.340539, -0.0991476, -0.116768, -0.762159, -0.0394167, 0.556968, -0.164445, -0.620529, -0.692819, -0.242698, -0.0990566, 0.506339, -0.531986, 0.287465, 0.81038, 0.385159, 0.122598, -0.528334, 0.132378, 0.413633, 0.578131, -0.66093, -0.29653, 0.231484, -0.513924, -0.673241, 0.430606, -0.911078, 0.626206, 0.103039, -0.701011, 0.197158, -0.916093, -0.179506, -0.679303, 0.764504, 0.242101, -0.79496, 0.580555, -0.575684, 0.0595721, -0.059909, -0.1032, -0.902682, 0.652708, -0.258878, -0.250081, -0.442401, 0.88448, 0.117066, 0.631546, 0.981885, -0.00830948, 0.654407, -0.193716, -0.205864, -0.165124, -0.03575, 0.872632, 0.627539, -0.988521, 0.717854, 0.549675, -0.584061, -0.987495, -0.0981711, 0.977372, -0.490385, 0.423493, 0.195499, -0.131524, 0.19911, 0.631743, -0.600366, -0.456646, 0.949069, -0.905275, 0.729948, 0.728268, -0.640033, 0.596373, -0.137898, -0.989737, -0.193583, -0.460878, 0.904828, -0.721645, 0.713149, -0.0350116, -0.0185294, 0.838173, 0.685053, 0.675921, 0.528104, -0.890554, -0.0801537, -0.151195, -0.817998, 0.572615, 0.160301, 0.987495, 0.667486, 0.768106, 0.0390393, 0.119231, -0.88446, 0.250231, -0.543891, 0.130973, -0.801873, 0.151929, 0.399002, 0.898685, -0.166733, 0.610109, 0.229715, -0.0913934, -0.181814, 0.860104, -0.104068, -0.53204, -0.101051, 0.00551902, -0.306722, -0.802062, -0.447553, -0.728343, 0.558973, -0.339372, -0.727528, -0.917635, 0.23936, 0.266262, -0.100715, 0.59016, 0.000470478, 0.233289, 0.72866, 0.188412, 0.893929, -0.678449, 0.383653, -0.753419, -0.916124, 0.461794, 0.0286951, -0.611623, -0.638098, -0.218954, -0.0679729, 0.528939, -0.656209, -0.8736, 0.523831, -0.71428, 0.0843972, -0.682578, 0.74524, 0.95063, 0.304906, 0.380184, -0.169944, -0.90408, -0.159017, 0.596443, -0.785567, 0.121332, -0.280344, 0.432077, -0.187367, -0.586524, 0.154582, 0.818349, 0.271843, 0.0756613, -0.241833, -0.992897, 0.945104, 0.501713, 0.513748, -0.138998, 0.0944263, -0.938597, -0.70371, 0.953095, -0.0485726, -0.929435, 0.532034, -0.651133, -0.329117, -0.881419, -0.508557, -0.429971, -0.371408, 0.372962, -0.3854, 0.0117345, 0.29937, -0.0529877, -0.136504, -0.675738, 0.673711, -0.0149521, 0.384442, 0.992693, 0.400935, -0.435024, 0.749096, 0.522981, -0.984925, 0.148114, 0.0407992, -0.978648, 0.12613, -0.69101, 0.926109, -0.0728952, 0.589419, 0.262076, 0.487079, -0.827669, -0.0883343, -0.812408, -0.26608, -0.227766, 0.118226, -0.501822, 0.940476, -0.557242, -0.465134, -0.0288301, 0.168663, -0.527409, -0.103497, -0.588714, 0.737607, -0.230886, -0.805271, 0.0753765, 0.26903, -0.0158735, -0.215352, 0.931945, 0.778881, 0.275987, 0.135773, 0.714893, -0.167503, 0.969378, -0.901264, 0.799944, -0.927489, -0.92993, -0.0990976, -0.750025, -0.736297, -0.460973, 0.733951, 0.928585, 0.027995, -0.929873, 0.284672, -0.302835, 0.642507, 0.0291289, -0.805577, -0.794354, -0.187664, 0.388058, 0.664551, 0.0100445, 0.205329, 0.784408, -0.472266, 0.626626, -0.929584, -0.698387, -0.356748, -0.0265157, 0.677842, 0.131969, -0.446246, -0.784156, -0.0318241, 0.0505945, 0.144495, 0.604957, -0.029713, -0.813298, 0.964048, 0.8238, 0.735502, 0.242109, -0.642117, -0.459692, -0.869747, -0.18264, -0.0128195, 0.707477, -0.110174, 0.767818, 0.962867, -0.896171, 0.770814, 0.363399, 0.989572, 0.332259, -0.105484, -0.490663, -0.265776, -0.948848, 0.770435, -0.537729, 0.284649, -0.580731, 0.0778848, 0.955585, -0.39406, 0.852577, 0.71872, -0.307618, -0.11547, -0.636648, -0.687092, 0.507921, -0.73693, 0.0962041, -0.165167, 0.352463, -0.134909, 0.823934, -0.243248, -0.415258, -0.660865, 0.469026, -0.172978, 0.36093, -0.0949201, 0.453829, -0.987775, -0.776847, 0.789062, -0.0411315, -0.970385, -0.904433, 0.548658, 0.764941, 0.105766, 0.568493, -0.456329, 0.989596, 0.741733, -0.166767, -0.539582, 0.480766, 0.129385, -0.841128, 0.380331, 0.622103, -0.391318, 0.593932, 0.900273, -0.303979, 0.525161, 0.737415, -0.464096, -0.537889, -0.0162387, -0.872377, 0.653017, -0.707777, -0.840755, 0.18381, 0.631248, 0.79242, 0.721665, 0.30104, 0.247685, 0.229086, 0.484682, 0.0511473, -0.181297, 0.931074, 0.671199, -0.478377, 0.441407, -0.0201697, 0.523178, 0.408739, 0.510105, -0.566182, -0.762724, -0.294874, 0.0877988, 0.952908, 0.766769, 0.749437, 0.369015, -0.35297, -0.532143, -0.904297, 0.467428, 0.660256, -0.407429, 0.290017, -0.26302, 0.235833, 0.506117, -0.823032, 0.0661104, -0.00630649, -0.614834, 0.0295955, 0.944106, -0.456279, 0.662173, -0.902251, 0.757433, -0.806234, -0.229247, 0.351241, -0.941187, -0.707169, -0.478585, -0.176713, 0.740753, -0.383835, -0.378852, -0.113596, 0.233497, -0.190261, -0.585837, 0.524649, 0.569843, 0.394213, 0.771565, -0.15472, -0.190212, 0.0560622, 0.362644, -0.471455, 0.673314, -0.273592, 0.275245, 0.130188, -0.546013, -0.127573, 0.0885788, 0.594691, -0.0302284, -0.818253, 0.417168, 0.110347, -0.543493, -0.281827, -0.425544, -0.974501, 0.962235, -0.161438, 0.116323, 0.253753, -0.217046, 0.77803, 0.218881, 0.50727, 0.903662, 0.155773, -0.899198, 0.668505, 0.00748381, -0.0785874, 0.678067, -0.0648989, 0.347564, -0.467318, -0.580821, -0.804397, 0.829461, 0.0736631, -0.708807, -0.0186749, 0.899716, 0.554562, 0.45818, 0.834346, -0.397845, 0.0494423, 0.00409041, -0.11882, -0.915672, 0.673626, 0.849517, -0.142049, 0.460745, 0.0697183, 0.68722, 0.0480519, 0.0524643, -0.0237148, 0.61764, 0.843116, 0.938518, 0.552932, -0.12278, -0.260164, -0.69349, -0.706536, -0.67306, -0.0627796, 0.222118, -0.880361, 0.925433, -0.0592476, -0.0467894, -0.983786, -0.800689, 0.900249, -0.963637, -0.367425, -0.735184, -0.821316, -0.631338, 0.261128, 0.68028, -0.979094, 0.396262, 0.78439, -0.823933, -0.657969, -0.0293177, -0.973298, -0.295795, 0.646203, -0.906387, 0.325111, 0.741593, -0.859593, 0.25133, -0.432808, 0.14148, 0.375246, -0.00562828, -0.0933074, -0.323463, 0.884921, -0.0313797, 0.598065, 0.558613, 0.365575, -0.518063, -0.375741, -0.035744, 0.73633, 0.777705, -0.723724, -0.493453, 0.586443, 0.43888, 0.0842351, 0.758591, -0.38227, 0.00686366, -0.703997, 0.275358, 0.190318, -0.581747, 0.983383, -0.897501, -0.136344, 0.25484, 0.34943, -0.977896, 0.0252169, -0.865229, 0.337784, 0.479253, -0.742757, 0.613689, -0.947179, -0.0382317, -0.768576, -0.192195, -0.204165, -0.308512, 0.500417, -0.326675, 0.00890674, 0.272551, -0.436302, 0.614531, 0.510078, 0.601183, 0.845436, -0.0913464, 0.849081, 0.949478, -0.74432, -0.446922, -0.410659, -0.606473, 0.716395, -0.774266, 0.225802, 0.800037, 0.0207831, -0.647598, -0.0600619, -0.16563, -0.182725, -0.722761, 0.591205, -0.716209, -0.134089, -0.811799, -0.212415, 0.765258, 0.531866, 0.660793, -0.241237, -0.491606, -0.622333, -0.31545, 0.997122, 0.338214, 0.362699, -0.0488755, 0.697707, -0.873848, -0.886928, -0.530137, -0.142199, -0.643615, -0.490257, 0.67524, -0.503938, 0.699661, -0.312788, -0.659082, 0.18139, 0.890955, 0.954407, 0.182295, -0.190718, 0.597022, -0.309768, 0.388595, -0.232006, -0.950481, 0.663742, -0.387796, 0.0351176, -0.407972, 0.729452, 0.736642, -0.411724, -0.461002, 0.529467, 0.758767, 0.414619, 0.0540614, -0.242095, -0.984776, -0.94159, -0.587784, 0.116391, 0.316425, -0.228979, 0.916499},
-	{0.478477, 0.67036, 0.159949, -0.305524, 0.492839, 0.976859, -0.120403, 0.647224, 0.808402, 0.363389, 0.078311, 0.592232, 0.247041, 0.150473, 0.458373, -0.555105, -0.400313, -0.735052, -0.620608, -0.46895, -0.149489, -0.534638, -0.260478, 0.416649, -0.0557472, 0.828884, 0.266326, 0.418593, -0.570913, 0.803402, 0.454403, 0.812987, 0.124848, -0.32408, -0.696726, 0.350747, -0.566288, 0.856844, -0.347706, -0.81303, -0.146215, -0.341594, -0.0232759, 0.541091, -0.974774, -0.0520434, -0.573881, 0.424235, -0.854862, -0.0775465, 0.295595, -0.917543, -0.313164, -0.169633, 0.0240221, -0.359576, 0.619407, 0.935458, 0.972713, -0.584428, 0.704287, -0.431245, 0.172494, 0.252224, -0.982681, -0.531756, 0.810226, -0.290067, 0.348156, -0.720549, -0.912706, -0.127973, -0.709645, 0.639138, -0.243869, 0.641696, -0.168458, -0.000965612, 0.613778, -0.774931, -0.494952, 0.532198, 0.512397, -0.0032644, 0.379188, -0.0886317, 0.554173, 0.730346, 0.935261, 0.958903, -0.652314, -0.142136, 0.715732, 0.791308, -0.329728, -0.783511, 0.784925, 0.73896, 0.473079, -0.486366, -0.710051, -0.371123, 0.0197068, 0.950427, -0.693829, -0.733738, -0.435228, 0.279253, 0.635141, -0.0983142, 0.816504, 0.962777, -0.335626, -0.392036, 0.935727, -0.270126, 0.0385652, 0.217854, 0.104073, 0.572906, 0.308786, 0.713491, 0.540994, 0.522003, 0.439917, -0.265466, 0.743669, 0.714656, -0.276738, 0.863222, -0.0818794, -0.517547, -0.696657, 0.66433, -0.547215, 0.356861, 0.9118, 0.16918, 0.948536, 0.479499, -0.409677, 0.000741371, -0.425468, -0.439759, -0.673324, 0.124937, -0.920633, 0.374027, -0.966112, 0.961364, -0.46052, -0.315233, 0.581378, 0.597284, -0.0168252, -0.0354213, 0.864971, -0.513875, -0.287541, -0.72884, 0.127132, 0.397385, -0.61874, 0.220217, -0.336529, 0.0843058, -0.673733, -0.649656, -0.568504, 0.202949, -0.727235, -0.150897, 0.291431, 0.533197, -0.0266058, 0.926561, 0.420092, 0.789782, 0.89247, -0.163375, 0.735478, -0.456694, 0.150679, 0.381864, 0.385077, 0.232068, 0.822046, -0.698318, 0.283622, 0.476387, 0.967522, -0.628111, -0.878171, -0.50301, -0.276789, 0.411478, 0.731257, 0.0770624, -0.421815, -0.447066, -0.254401, -0.389437, 0.847195, -0.206345, -0.110464, -0.0426503, -0.669872, -0.273929, -0.383435, -0.753479, -0.295179, 0.574884, -0.0725582, -0.451096, 0.410922, -0.428845, -0.244752, 0.391513, 0.523842, 0.585766, 0.308552, 0.213307, -0.943563, 0.284594, -0.764247, 0.313962, 0.34659, -0.680197, -0.500396, -0.242652, -0.497389, -0.718044, 0.986424, -0.370003, 0.955323, 0.155059, -0.46898, 0.718137, 0.481271, -0.254047, 0.58269, 0.715239, 0.462385, 0.0477379, -0.584223, -0.836344, -0.831403, -0.95857, 0.770439, 0.900336, 0.867247, -0.406988, -0.357495, 0.956445, 0.605141, -0.690828, -0.918045, 0.151045, 0.419927, -0.702232, -0.217025, -0.0393608, -0.62184, 0.0993477, -0.314813, 0.0565345, -0.18237, 0.525645, 0.936197, 0.713434, 0.347556, -0.962436, 0.719707, 0.572516, -0.797237, -0.570523, 0.805108, 0.0539264, 0.820948, 0.976323, 0.519594, -0.148239, 0.359022, -0.183, -0.026582, 0.645894, -0.00132245, -0.592237, 0.415258, 0.401368, -0.386246, -0.749891, 0.922294, 0.893981, -0.125056, -0.653536, -0.449282, 0.922153, -0.349255, -0.0198986, -0.571001, 0.515416, -0.72521, 0.949284, -0.352814, 0.279252, -0.148419, -0.834023, 0.134031, 0.77373, 0.995073, 0.314164, -0.996275, 0.795371, 0.31419, 0.518179, 0.874286, -0.99432, 0.73076, 0.106297, 0.951079, -0.533748, -0.453467, -0.0664314, -0.642988, -0.961767, -0.801591, 0.279241, -0.956154, -0.857721, 0.624114, -0.203748, -0.578519, 0.926452, 0.48405, 0.250267, 0.248315, 0.721563, 0.454711, -0.176152, 0.480732, 0.625904, 0.228641, 0.0791049, 0.364311, 0.65797, 0.169165, -0.846387, 0.741794, 0.0246624, 0.863818, -0.234399, -0.893913, 0.582929, 0.791821, 0.743801, -0.535679, 0.129169, -0.969083, -0.345277, -0.599559, 0.218591, 0.0262742, -0.352737, 0.948072, 0.823073, -0.847272, -0.288869, 0.659602, -0.0203956, 0.104937, -0.785566, -0.689792, -0.871357, 0.910373, 0.815006, 0.26827, -0.994173, 0.381222, -0.887728, -0.0815937, -0.381937, -0.959672, -0.802668, -0.178023, -0.139581, 0.5268, -0.0519601, -0.994612, 0.908934, 0.143071, 0.12424, -0.893763, 0.904143, 0.883742, -0.455227, -0.741864, -0.830999, -0.526545, -0.150688, -0.390031, 0.718917, -0.385557, 0.810552, 0.399647, -0.0105032, 0.229744, -0.421646, 0.367527, -0.978515, -0.528786, -0.144028, 0.0623269, 0.0882081, 0.964875, 0.60579, 0.676419, -0.158839, -0.89761, 0.191022, -0.951338, 0.832599, -0.387027, 0.971386, -0.543446, 0.799964, 0.061793, 0.531302, 0.376387, -0.349602, 0.60539, 0.379716, -0.833929, 0.268424, -0.902515, 0.916433, 0.139054, -0.344272, 0.388656, 0.296988, 0.738175, 0.511445, -0.381255, -0.912688, 0.747371, -0.831597, 0.062785, 0.150582, -0.0032199, -0.733429, -0.203801, -0.754522, -0.579389, 0.617507, -0.291895, 0.982778, -0.571272, 0.0673962, -0.505187, 0.235614, -0.539892, -0.386118, -0.204053, 0.602058, -0.181463, 0.409432, -0.822375, 0.22202, 0.53545, -0.294828, -0.403245, 0.697994, 0.478878, -0.0621547, 0.15422, 0.956469, -0.817075, 0.71165, 0.685439, -0.632368, -0.876995, 0.285971, -0.476853, 0.66692, -0.876152, 0.0865428, 0.961941, 0.848085, 0.263889, -0.804603, 0.920138, -0.20552, -0.18375, -0.404841, -0.7708, -0.660394, 0.93547, -0.802399, -0.238105, -0.904918, 0.357178, -0.547915, 0.0704, 0.878421, -0.30556, -0.436566, -0.0917991, 0.219668, 0.188111, 0.903119, -0.506954, -0.217771, 0.776053, 0.729081, -0.245675, 0.140781, 0.903648, -0.85425, -0.000886675, -0.206846, 0.814909, 0.44456, 0.395521, 0.308741, 0.587003, -0.872335, -0.639033, 0.200909, 0.589934, 0.0379821, 0.508233, 0.15853, -0.349839, 0.907954, -0.0934008, 0.709541, -0.308533, -0.203604, -0.596661, 0.315746, 0.510913, -0.173295, 0.970698, -0.182269, -0.987495, -0.499414, -0.267688, -0.400044, -0.462759, 0.0943537, 0.581802, 0.65286, 0.780318, 0.935066, -0.304107, 0.709027, -0.362668, -0.822524, -0.546479, -0.781202, -0.768711, -0.512684, 0.455232, 0.0296506, 0.902309, 0.408532, 0.149061, 0.162186, -0.0242243, -0.217543, -0.159504, 0.17664, 0.55943, 0.290531, -0.273696, 0.599651, 0.498678, 0.339958, -0.692885, -0.83146, 0.722824, 0.113417, 0.190051, 0.934086, -0.755604, -0.911529, -0.532863, 0.51002, 0.297211, 0.970337, 0.95947, -0.228121, -0.243491, -0.753177, -0.438151, 0.678249, 0.945651, -0.332891, 0.833739, -0.349021, 0.884235, -0.176498, 0.12267, 0.231579, -0.224699, -0.0208696, -0.273643, -0.0355868, 0.229373, 0.370924, 0.648014, 0.396676, -0.151369, -0.902989, 0.0412965, -0.189414, -0.74144, 0.913989, 0.507066, -0.148519, -0.231944, -0.284534, -0.580757, -0.290943, -0.814048, 0.772477, -0.740018, -0.0240496, -0.745784, 0.449951, 0.753148, -0.221936, 0.260836, 0.0803846, 0.463061, 0.325534, 0.737017, 0.060063, 0.807556, -0.293501, 0.185808, -0.171387, -0.0551913, 0.38691, 0.270773, -0.171069, -0.511562, -0.807944, -0.117621, 0.762526, -0.734465, 0.910841, -0.264492, 0.342048, -0.900127, 0.753362, -0.134276, 0.295891, 0.0738464, 0.23563, 0.00729887, -0.585484, -0.38586, 0.79836, 0.948919, 0.47525, -0.833709, 0.882246, -0.794087, 0.210173, 0.614851, 0.0961674, -0.843025, -0.193878, 0.831747, 0.630312, -0.370975, 0.321203, 0.813962, 0.398323, 0.110212, 0.371757, 0.530583, -0.561917, 0.364357, -0.972465, -0.593718, 0.0204367, 0.766505, 0.923675, 0.017956, 0.574993, 0.273225, 0.367221, 0.176874, -0.174393, -0.465149, -0.0522074, -0.48987, 0.490054, -0.283278, 0.800773, 0.578508, -0.675947, 0.798144, -0.726791, -0.747861, 0.4179, 0.406489, 0.806322, -0.940692, -0.215212, 0.384401, 0.265758, 0.981365, 0.261785, 0.892708, -0.367806, 0.725999, 0.22187, -0.709437, -0.957038, -0.863814, -0.0342298, 0.137438, 0.00530548, 0.302762, 0.518508, 0.903174, -0.956133, -0.282484, 0.999124, -0.754882, -0.2388, -0.412049, -0.204607, -0.463038, -0.968013, -0.36512, -0.176684, -0.299254, -0.506265, -0.947791, -0.974003, -0.806889, 0.0259893, 0.869896, 0.165192, -0.0832913, 0.156708, 0.483047, 0.340225, -0.616034, 0.65602, -0.987719, 0.974321, -0.722844, 0.46012, 0.745311, -0.126271, 0.187482, 0.350638, -0.965986, -0.320753, -0.406187, -0.794089, 0.546644, 0.36726, 0.0770181, 0.645741, 0.384823, 0.938787, -0.0711657, -0.289433, 0.0240145, -0.659249, -0.157475, 0.351947, 0.939411, -0.712073, -0.201024, 0.652773, 0.525603, -0.89312, -0.174053, 0.369822, -0.0249632, 0.168081, 0.343258, 0.0238583, 0.0881528, -0.673889, -0.320275, -0.793368, 0.364439, -0.632126, 0.821872, 0.0106957, 0.942109, -0.39869, 0.722247, 0.465154, 0.246037, 0.653523, 0.527905, 0.767951, 0.532369, -0.103245, -0.668508, 0.372075, -0.850505, -0.741909, -0.826642, 0.70271, -0.89828, -0.488902, 0.0823169, -0.439717, 0.839067, -0.275086, -0.281435, -0.146911, 0.50936, 0.574437, -0.157322, 0.242426, -0.410582, -0.898288, 0.51096, 0.259355, 0.870506, 0.6793, -0.333919, 0.423945, 0.439132, 0.187234, -0.346265, -0.119109, 0.676121, 0.343161, 0.480109, 0.978065, -0.170171, -0.401516, -0.576636, -0.964595, -0.00270359, -0.721291, 0.434567, -0.991306, 0.00817115, 0.361715, -0.348014, -0.651751, -0.338512, 0.156855, 0.967634, 0.465964, -0.472055, 0.528535, 0.389433, -0.882869, -0.198267, -0.272811, 0.118198, -0.124773, 0.106732, -0.905041, 0.444263, -0.591155, 0.520911, -0.529879, -0.483881, 0.731192, -0.241014, 0.816829, -0.486978, 0.027022, 0.526398, 0.500513, 0.85384, -0.980281, 0.255562, 0.455408, 0.0541779, -0.89131, 0.155107, 0.960564, -0.249545, 0.437348, -0.899411, 0.812307, 0.942247, -0.214265, -0.357988, -0.163223, -0.909789, 0.791127, -0.997627, 0.447992, -0.216553, 0.42074, 0.651042, 0.94807, -0.361679, -0.213589, -0.96283, -0.0242569, 0.628015, 0.833253, 0.0977028, -0.535175, 0.222969, 0.5884, 0.307628, -0.296949, -0.359316, 0.239485, -0.348802, -0.917836, 0.579837, -0.735014, -0.837462, 0.206845, 0.840713, 0.745196, -0.546593, -0.847312, -0.978214, -0.139754, 0.614243, 0.786253, 0.275553, -0.512566, 0.488941, -0.074823, 0.360966, -0.291276, -0.522199, -0.796155, 0.304828, -0.0679614, 0.0107844, -0.230809, 0.0988561, 0.668805, -0.805877, 0.839628, 0.0820807, 0.665045, 0.403264, 0.228895, 0.622066, -0.621843, 0.271625, 0.265083, 0.101507, -0.470922, -0.321064, 0.703271, -0.488206, -0.221548, -0.269316, 0.354492, -0.61942, 0.826143, 0.528002, -0.727541, -0.84247, -0.621702, 0.268076, -0.920409, 0.292931, 0.977959, 0.489456, 0.27015, 0.485864, -0.23357, -0.986792, -0.444535, 0.912026, -0.39515, -0.589691, -0.239084, -0.720729, 0.345853, 0.594559, -0.481063, 0.829624, 0.0957042, 0.264203, 0.312716, -0.439914, -0.877521, -0.311297, -0.581234, 0.950034, -0.523179, 0.283536, 0.888598, -0.934817, 0.69288, 0.826057, -0.00663472, 0.895254, 0.708576, -0.38043, 0.20063, -0.139351, 0.492916, 0.389896, -0.351361, 0.504444, -0.758629, -0.0903902, 0.94578, 0.664778, 0.792454, -0.719704, -0.108436, -0.0789319, 0.217748, -0.667585, 0.163262, -0.72102, 0.751064, -0.928285, -0.638473, 0.90938, 0.151374, -0.0178889, 0.353118, 0.181808, 0.976642, -0.147237, -0.150191, -0.841298, 0.418734, -0.4106, -0.961963, -0.900204, -0.69157, 0.995057, 0.689634, 0.630335, 0.0115126, -0.787447, 0.524392, 0.465149, 0.895464, 0.771355, 0.448405, 0.88917, -0.963538, 0.840757, -0.56802, 0.178021, 0.836226, -0.346548, -0.549864, 0.769551, -0.282073, -0.265059, 0.168977, 0.0961956, -0.94029, -0.385556, -0.746814, -0.171377, -0.854306, 0.935608, -0.497001, -0.586113, -0.697974, 0.403434, 0.293099, 0.190431, 0.967355, 0.402444, 0.879365, -0.713808, 0.441651, -0.890149, -0.101062, -0.739726, 0.565986, 0.130312, -0.408313, 0.0203099, -0.201298, -0.00912174, 0.487754, -0.613169, 0.267217, -0.861561, -0.204383, -0.593564, -0.814992, -0.815405, -0.100894, 0.026587, -0.472597, 0.412426, 0.41744, -0.126353, 0.0147426, -0.922666, 0.855917, -0.591536, -0.688227, -0.953775, -0.413864, 0.911966, -0.561848, 0.261659, 0.0112983, 0.79291, 0.942791, -0.270858, -0.651034, -0.370559, 0.2124, 0.618998, -0.733014, -0.235428, 0.430933, 0.489472, -0.185762, 0.910964, -0.138905, -0.467712, -0.864724, 0.543738, -0.65011, 0.419359, 0.501835, 0.376508, 0.273848, 0.0848729, 0.894868, 0.167338, -0.18743, 0.118544, 0.0724929, 0.689183, -0.669124, -0.12189, -0.527456, -0.564056, 0.791913, 0.153401, 0.494982, 0.931232, 0.639616, -0.142052, 0.922892, 0.0347915, -0.406091, -0.158231, 0.515998, -0.0449623, 0.0183627, 0.602802, 0.659473, 0.883524, 0.0769763, 0.825224, 0.0964017, -0.0586513, -0.482414, 0.526229, 0.190872, -0.830552, 0.57984, 0.341645, 0.534486, 0.852827, -0.411061, -0.20716, -0.134927, -0.444929, -0.997389, -0.560564, 0.385974, 0.431914, -0.809315, 0.582404, 0.510304, 0.550746, -0.109482, -0.386841, -0.716505, -0.911674, 0.033275, -0.177646, -0.508005, 0.0623389, 0.746549, -0.359146, 0.668967, -0.24961, 0.702745, 0.306218, -0.247064, 0.334144, 0.19646, 0.254299, 0.721797, -0.691682, -0.832258, -0.841692, -0.599518, 0.408658, 0.143376, 0.800769, 0.879438, 0.105505, -0.166689, -0.474072, -0.350556, 0.272017, -0.701735, -0.428577, 0.4245, 0.988972, -0.982401, 0.112749, 0.519318, 0.361444, 0.797241, 0.644753, 0.0338275, -0.553543, 0.809271, 0.529328, -0.910239, 0.975445, -0.81408, 0.510512, -0.680021, 0.868754, -0.29023, 0.389727, 0.331888, -0.795962, 0.919692, 0.600591, -0.0608896, -0.268276, 0.444928, -0.920735, -0.739109, 0.610407, 0.59856, 0.316292, -0.0911518, -0.205937, -0.765465, 0.39431, 0.19984, -0.955477, -0.604376, -0.899157, -0.783046, 0.508914, -0.679232, -0.140657, -0.894731, 0.858224, -0.910655, 0.205237, -0.870544, -0.357162, -0.432308, -0.912326, 0.849118, 0.322144, 0.856872, -0.0118193, -0.895556, 0.46029, -0.212456, -0.990792, 0.514767, 0.792016, 0.153754, 0.948548, -0.655254, 0.180774, 0.98107, 0.814904, 0.069861, -0.0728622, -0.55811, 0.035523, -0.232386, -0.492412, 0.443635, -0.961845, 0.801334, 0.308501, 0.838916, 0.28093, -0.00860651, 0.625905, -0.0460233, -0.913612, -0.330226, 0.0476397, 0.724373, 0.858785, -0.936834, -0.726892, 0.346369, 0.455073, 0.935871, 0.201113, 0.377216, 0.399823, -0.0884944, 0.324896, 0.809236, -0.141677, -0.834901, 0.0775413, 0.359223, 0.992873, 0.288658, 0.423657, -0.476629, -0.583321, 0.929344, -0.769453, 0.201393, 0.733049, 0.962278, -0.886638, -0.594851, -0.279718, -0.909279, 0.857037, -0.656149, -0.861357, 0.609109, -0.214288, 0.741206, -0.188158, 0.291603, -0.470917, 0.0426979, -0.0935819, 0.540062, 0.662309, 0.439908, 0.598649, 0.996574, -0.230739, 0.181974, 0.00335722, -0.655103, -0.392192, 0.336844, -0.0865594, 0.944562, -0.864411, 0.45567, 0.0903765, 0.757987, 0.443589, 0.121073, 0.252673, 0.325631, -0.732133, 0.0575108, 0.609596, 0.693734, 0.132612, -0.414394, -0.554671, -0.584621, 0.0469511, 0.101259, -0.304615, 0.951396, -0.984374, -0.544304, 0.651468, 0.68194, -0.18521, -0.677697, -0.64631, 0.613447, 0.451009, -0.685937, 0.052281, -0.644414, 0.309869, -0.0340669, -0.535376, -0.25988, -0.341022, -0.818715, -0.66103, -0.15453, 0.616475, -0.711077, 0.104365, -0.269388, 0.608017, 0.68648, -0.842565, -0.147012, 0.282083, -0.350633, 0.208901, -0.953471, 0.20032, -0.101068, 0.0320623, 0.213766, -0.627342, -0.164109, 0.608076, -0.619456, 0.852127, 0.0560057, -0.624527, -0.16896, -0.795572, 0.456173, -0.0703556, 0.685941, 0.913492, 0.855336, 0.200037, -0.199338, 0.693555, -0.464672, -0.502172, 0.515995, -0.778913, -0.471249, -0.399278, 0.935059, -0.0147948, -0.245331, -0.998857, -0.208574, -0.903507, 0.299586, 0.785955, -0.826782, 0.603765, -0.660498, -0.390528, 0.35203, -0.675522, 0.0584063, 0.368474, 0.652254, -0.856298, 0.619782, -0.52897, -0.901019, -0.28019, 0.465578, -0.955731, 0.0486038, -0.27092, 0.115238, 0.213315, -0.903915, -0.70055, 0.876687, -0.886364, 0.375771, 0.221693, 0.255578, 0.452119, -0.957993, 0.284703, 0.0255704, 0.341837, -0.210331, -0.817758, 0.31809, 0.65161, -0.224758, -0.414999, -0.412683, 0.761337, 0.147221, 0.482028, -0.723528, 0.457457, 0.576769, 0.242515, 0.132147, 0.750208, 0.046198, 0.981448, -0.751445, 0.197434, -0.0997378, -0.860405, 0.110706, -0.983778, 0.112453, -0.62544, -0.0721865, 0.675515, 0.379459, -0.882628, -0.620295, 0.993014, 0.892516, -0.894435, 0.0544243, 0.605751, 0.256908, 0.00612861, -0.13031, 0.704108, 0.16432, 0.0965728, 0.806785, 0.139856, 0.812896, 0.374719, -0.0765587, -0.18603, 0.0485244, -0.61252, 0.91773, -0.0906013, -0.728883, -0.222374, -0.208556, 0.186592, 0.467016, -0.897471, -0.506992, -0.399445, 0.330666, 0.0834128, 0.913123, 0.994826, 0.0590938, -0.0830346, -0.215293, 0.908558, 0.232777, -0.0516887, -0.739802, 0.341633, 0.147863, -0.659246, 0.29929, -0.170408, -0.526565, -0.885336, -0.655022, 0.392268, -0.0838212, 0.357155, 0.320049, -0.670591, -0.0120891, -0.154121, -0.605581, 0.677387, 0.778936, 0.745057, -0.00929348, 0.940827, -0.647322, -0.135244, -0.826439, 0.410953, 0.198784, 0.375956, 0.771221, -0.144112, -0.728624, 0.707365, -0.409571, -0.482409, 0.0644421, 0.518491, -0.760989, 0.489824, -0.179504, 0.668562, 0.0367798, 0.958533, 0.0265019, -0.613418, 0.203715, 0.407365, 0.286786, 0.719644, -0.977613, 0.772058, 0.742164, 0.940079, -0.287473, -0.208244, 0.489729, 0.196477, 0.373334, -0.966306, 0.655088, -0.422107, 0.448329, -0.703532, 0.211184, -0.188487, 0.28779, 0.748931, 0.111459, 0.582139, -0.960671, -0.39792, -0.671118, -0.798684, -0.219227, -0.625796, 0.111891, -0.113612, -0.750913, -0.709621, -0.0845816, -0.275807, -0.661866, 0.111494, 0.477487, -0.32654, 0.654959, 0.545998, -0.959155, -0.0913701, 0.28417, 0.132184, 0.572768, -0.640384, 0.36907, 0.46841, -0.280799, -0.214857, 0.932674, -0.481221, 0.898387, -0.390998, -0.0921136, -0.450367, 0.191676, -0.70008, -0.575874, -0.436358, 0.974459, -0.242199, -0.567926, 0.963889, 0.211972, -0.105694, -0.401198, 0.358272, 0.610674, 0.75694, -0.558592, 0.617344, -0.792806, 0.139889, 0.595923, -0.745455, -0.138299, 0.851956, 0.368683, -0.615408, -0.884434, 0.532196, 0.705356, 0.209589, 0.0797008, 0.939644, -0.419529, 0.359719, 0.294126, -0.131979, 0.665818, 0.642861, -0.799874, -0.757187, 0.131762, 0.575423, 0.769387, -0.276753, 0.114976, 0.446126, 0.408999, -0.209572, 0.69511, -0.275652, -0.295283, 0.457627, -0.43594, 0.164904, 0.125354, 0.946989, 0.962336, -0.0262944, 0.941502, 0.0486528, -0.453246, 0.709541, -0.900646, 0.965662, 0.245565, 0.329669, -0.69179, 0.357112, 0.374164, -0.188709, -0.264456, -0.255327, 0.0456018, 0.83136, 0.630866, 0.446878, -0.356621, 0.724305, 0.136745, 0.91227, 0.437851, 0.240375, 0.724035, -0.433508, 0.0186158, -0.137503, 0.493047, 0.143968, 0.64289, 0.967401, -0.966184, -0.513395, -0.488674, -0.580365, -0.693574, -0.686229, 0.701063, 0.522287, 0.87666, -0.980726, 0.192053, 0.54082, -0.436588, 0.932752, 0.104598, 0.224069, 0.343689, 0.698904, -0.026432, -0.376995, 0.970339, -0.864485, -0.204692, -0.695615, 0.403786, -0.472886, 0.0486984, -0.326334, -0.044277, 0.0122892, 0.00296331, -0.939288, 0.807122, 0.489696, -0.506433, -0.122596, 0.451651, -0.0108362, -0.572316, -0.691258, -0.0152376, -0.674195, 0.861872, -0.797898, 0.159612, 0.619619, 0.177183, -0.487979, 0.0638753, 0.769961, 0.736594, 0.206912, 0.145164, 0.0220459, 0.793425, -0.590199, -0.0563754, 0.622423, 0.600224, 0.896686, -0.120995, 0.205213, -0.435786, -0.0473837, -0.83261, -0.903941, -0.962343, 0.0145411, -0.633423, -0.0200799, 0.823808, 0.274021, -0.244247, -0.81322, 0.0561806, -0.325769, 0.0230521, 0.770043, -0.00227581, -0.974367, -0.952852, -0.152502, -0.401317, -0.103392, -0.426447, -0.0978802, 0.508994, 0.802997, -0.0448524, 0.936601, -0.80563, 0.0962462, -0.240901, -0.249097, -0.981155, 0.15763, -0.845432, -0.74079, -0.263549, -0.126608, 0.563051, -0.726104, -0.790228, 0.0683247, -0.744933, -0.975575, -0.186973, 0.982923, -0.140067, 0.952022, -0.688792, -0.00994638, -0.784545, 0.765868, -0.64683, -0.222498, 0.475608, -0.641361, 0.913777, -0.320389, 0.934673, 0.71291, -0.865651, -0.470416, 0.777648, 0.476317, 0.851097, -0.412775, -0.106654, -0.00736076, -0.551974, 0.873903, 0.75779, 0.691381, -0.801459, 0.4331, 0.919856, -0.481567, -0.682906, -0.46226, 0.706751, 0.796487, 0.577427, -0.576791, -0.177449, 0.0211394, -0.323922, -0.774382, -0.612843, 0.49144, -0.636035, 0.147203, 0.500476, 0.101735, -0.990498, 0.196178, 0.987518, 0.291177, -0.917388, 0.28106, -0.165272, -0.695375, -0.0484858, 0.737397, 0.163501, 0.324428, 0.594865, 0.684457, 0.590902, 0.207549, 0.0963353, -0.522687, 0.872289, -0.366017, -0.506875, 0.227899, -0.870817, -0.258097, 0.205086, -0.551133, 0.45241, -0.889203, 0.271424, 0.622679, -0.255186, 0.129729, -0.0995166, -0.327814, 0.496867, -0.534368, 0.986037, -0.741795, -0.0410156, -0.874748, 0.192906, -0.769671, -0.139535, 0.235024, 0.29646, -0.78181, 0.984377, -0.260772, 0.331075, 0.607551, -0.540174, 0.386781, 0.629118, 0.356081, 0.141266, -0.751707, -0.237979, 0.122521, 0.163504, 0.0665603, 0.00339905, 0.655876, -0.0364585, -0.479095, 0.200587, 0.535663, 0.981054, 0.118226, -0.284063, 0.833578, -0.0298034, -0.342333, 0.31131, -0.353429, -0.670472, -0.00184011, 0.893848, -0.992218, -0.0370003, 0.526882, -0.948262, 0.0217668, 0.944946, 0.362267, 0.824396, -0.241233, 0.699862, 0.181047, 0.0346044, 0.458138, 0.1515, -0.43613, 0.975198, 0.70052, 0.0776689, 0.516886, -0.322177, 0.358559, -0.930726, -0.661097, -0.518313, 0.329049, 0.799664, -0.768807, -0.212919, 0.72391, -0.208452, 0.665605, 0.377044, 0.522931, 0.839357, -0.383825, 0.0904674, -0.842144, 0.69475, 0.525178, 0.127693, 0.808918, 0.721309, 0.188727, 0.482004, 0.143928, -0.00967144, -0.150637, 0.999227, -0.366301, -0.204162, 0.0245788, 0.939321, -0.310603, 0.437894, 0.107696, -0.448096, 0.642746, 0.0628635, -0.411191, -0.0784768, -0.76748, -0.24601, 0.663866, -0.955238, 0.421668, 0.621259, 0.771167, 0.440824, -0.208072, -0.0852448, -0.617186, 0.20868, 0.648534, 0.747864, -0.254113, 0.674701, -0.308218, -0.664064, -0.891881, -0.0870001, 0.362471, -0.737833, 0.486797, -0.0509997, -0.193906, -0.982975, -0.759499, -0.272222, -0.664516, -0.678278, -0.693025, 0.64005, 0.51855, 0.972807, -0.578812, -0.230917, -0.842197, 0.770633, -0.0850083, 0.930416, -0.838551, 0.677879, -0.501497, -0.81802, 0.669912, 0.178622, 0.613682, -0.60578, 0.541142, 0.881311, -0.842462, 0.512274, -0.120457, 0.510655, 0.872817, 0.37573, -0.219472, -0.266398, 0.15219, -0.811004, -0.273738, 0.201605, -0.357686, -0.784896, -0.12279, -0.249336, 0.420788, -0.0592599, -0.29838, 0.146145, 0.818795, 0.259669, 0.843649, -0.647303, -0.209455, 0.0735595, 0.0581284, -0.437548, 0.618235, 0.357437, -0.894432, -0.819234, -0.128527, -0.738773, -0.11126, 0.116444, 0.51803, 0.472448, 0.33467, 0.398449, -0.530795, -0.69032, -0.878162, 0.797128, 0.580034, 0.695693, 0.243055, -0.867987, 0.315139, 0.626552, 0.688646, -0.222003, -0.22726, 0.143647, -0.282381, -0.488897, -0.577911, -0.438367, -0.307935, -0.0297709, 0.910815, -0.954507, -0.957756, -0.717356, -0.975571, -0.0659299, -0.964431, 0.52747, -0.822855, -0.104505, -0.467727, 0.252046, 0.569488, 0.951183, 0.640248, 0.250853, 0.14035, 0.92485, -0.636832, -0.903344, -0.00177262, 0.850286, -0.128923, 0.547234, 0.814421, 0.957544, 0.0564902, -0.634443, -0.915458, 0.98717, -0.65452, -0.712342, 0.778988, 0.673499, 0.649118, 0.481983, 0.0764859, 0.519984, 0.946565, 0.676393, -0.341231, -0.921304, -0.687416, 0.327208, -0.171314, 0.159409, -0.939676, 0.150578, -0.759079, 0.714648, 0.168277, 0.0297472, 0.421184, -0.0772533, -0.0786272, 0.419002, -0.440378, -0.296002, -0.555521, -0.0561001, -0.0430201, 0.371176, -0.45361, -0.808606, 0.405925, -0.866539, 0.08454, 0.609235, -0.604136, 0.843688, 0.61831, 0.990657, 0.364155, -0.378165, 0.573237, 0.858436, 0.220536, -0.243102, 0.687893, -0.237444, 0.253502, 0.725059, 0.346821, 0.160826, -0.426544, -0.690033, -0.533236, 0.204417, -0.566642, 0.0618801, -0.778721, 0.203062, -0.191417, 0.644783, 0.435082, -0.91908, 0.300267, 0.466737, 0.747897, 0.708018, -0.447096, -0.867693, -0.651413, 0.500088, -0.168188, 0.508945, -0.657729, 0.293479, -0.599311, 0.653873, 0.91335, -0.632733, -0.799614, 0.461827, -0.853424, 0.379024, 0.675626, 0.89798, 0.00617425, 0.707786, 0.147472, 0.128585, -0.0628966, 0.398666, -0.693241, 0.798323, 0.991531, -0.326494, 0.26132, 0.316015, 0.588961, -0.154524, 0.522901, 0.867561, 0.397564, 0.976968, -0.0558131, 0.97856, 0.939584, 0.120877, 0.212943, 0.581377, -0.252027, 0.950912, -0.936243, -0.300643, 0.46041, -0.553569, 0.44088, 0.292736, -0.215222, 0.617858, -0.397076, 0.221251, 0.972657, -0.20503, -0.596309, -0.196432, 0.833644, 0.100003, 0.370658, -0.813791, -0.94271, 0.369635, 0.726595, 0.794662, -0.769111, -0.87037, -0.715944, 0.775221, -0.365443, -0.108197, 0.365581, 0.493672, 0.32103, 0.31781, 0.214661, -0.877843, -0.706688, 0.34836, 0.88571, -0.858997, 0.998341, -0.179985, -0.135545, -0.992469, 0.977611, -0.761901, 0.870056, -0.942802, 0.724297, 0.63722, 0.507786, -0.0133392, 0.781865, -0.720419, 0.369209, -0.620632, -0.271482, 0.498917, -0.0958069, -0.222003, -0.789853, -0.420076, -0.418073, 0.682452, -0.412162, -0.579845, 0.85413, -0.605995, -0.299924, 0.315629, 0.0258122, 0.865938, -0.231429, 0.995033, -0.0476536, 0.674927, -0.259089, 0.764006, 0.925861, -0.576522, 0.0462466, -0.720716, 0.106985, 0.590891, 0.705486, 0.700695, -0.858669, -0.341351, 0.0870311, 0.292205, -0.192291, -0.856355, 0.559674, 0.389591, -0.0192838, -0.600414, -0.693697, 0.316606, -0.478248, -0.649927, -0.16127, -0.997469, 0.15587, -0.73753, -0.772447, -0.126679, -0.922039, -0.145958, -0.800318, -0.422137, 0.0963311, -0.955155, 0.379008, 0.615681, 0.0746999, 0.886663, 0.283377, -0.963763, 0.281416, 0.806111, 0.597167, -0.53253, 0.923797, -0.423516, -0.0820477, -0.469874, -0.441986, 0.362742, -0.557355, -0.327412, 0.608016, -0.142213, 0.797343, 0.897629, 0.434101, 0.0831075, 0.611579, 0.494933, 0.943623, 0.700235, 0.302521, 0.468652, -0.867056, -0.822908, -0.180079, -0.174228, 0.0340272, 0.59316, 0.931286, -0.739053, -0.481027, -0.433248, -0.307397, 0.0739835, -0.871942, -0.929561, 0.719119, -0.060202, 0.587339, -0.638005, 0.233707, 0.110639, -0.245723, 0.864784, 0.784991, -0.675281, -0.0438652, -0.731949, -0.27288, 0.452051, -0.39264, -0.310669, -0.576004, 0.119829, -0.672079, -0.42504, -0.759006, 0.391018, 0.403712, -0.761766, 0.617994, 0.624387, 0.734074, 0.604994, -0.314219, 0.438361, -0.985459, 0.949673, -0.408772, -0.124436, -0.935438, -0.202995, 0.949233, 0.678462, -0.727385, 0.688954, -0.169221, 0.192335, -0.609406, -0.982184, 0.352693, 0.947459, -0.414782, -0.764931, -0.382777, -0.744314, 0.824967, 0.595817, -0.398123, -0.595875, -0.769466, -0.55593, 0.572237, 0.373211, -0.351497, -0.447241, -0.976625, 0.694166, -0.745736, 0.789119, 0.0575634, 0.249256, -0.78581, -0.666348, -0.514548, 0.840969, -0.230628, 0.14791, 0.0604899, 0.439239, 0.526603, 0.682499, -0.441503, 0.0753867, 0.0320681, -0.784963, 0.488594, -0.572013, 0.387181, -0.411253, -0.748471, -0.51045, 0.797903, -0.974519, -0.675318, -0.874398, -0.369352, 0.715904, 0.467621, -0.65097, -0.966075, -0.613901, -0.00430316, 0.81946, 0.0422838, 0.0959141, 0.32179, 0.124036, -0.414199, -0.943576, -0.543405, -0.359005, 0.0412037, -0.0266225, 0.976388, -0.702204, 0.388492, -0.241279, 0.177424, 0.340474, 0.896957, -0.454945, -0.123146, -0.715353, 0.924392, -0.515025, -0.127191, 0.251862, -0.304797, 0.720904, 0.243537, -0.0703951, 0.0822199, -0.589896, -0.408916, -0.0662447, -0.0698241, 0.205862, 0.765819, 0.0669782, 0.190031, 0.645724, -0.707028, 0.0450408, 0.419086, -0.4873, -0.576808, 0.378207, -0.733893, -0.822978, -0.814929, -0.411896, 0.37283, 0.489623, 0.442648, 0.0275458, 0.218734, 0.231014, -0.910555, 0.769486, -0.238227, -0.771178, -0.249406, 0.660917, 0.0954564, 0.700351, -0.742378, -0.0112419, 0.302564, -0.60292, 0.668619, 0.964883, -0.324007, -0.731021, 0.12881, -0.775782, 0.680728, 0.656481, -0.00869988, -0.405213, -0.2614, 0.58294, -0.230633, -0.543567, -0.372242, -0.475108, -0.49238, 0.553211, -0.0157103, 0.940134, 0.583662, 0.469777, 0.468745, 0.861043, 0.493569, -0.82785, -0.94885, -0.172596, -0.0748601, -0.924612, -0.915003, 0.177872, 0.26641, 0.475539, -0.462611, -0.475883, 0.890923, -0.67074, 0.334576, 0.00926422, -0.0715609, 0.0377257, 0.411183, 0.27629, 0.406872, -0.158877, -0.606771, -0.347787, -0.951766, -0.842321, -0.634424, 0.177158, -0.824409, 0.734458, -0.934473, -0.696877, -0.883805, 0.0918091, 0.211886, 0.927839, -0.015553, -0.150271, -0.792879, 0.498338, -0.0677386, -0.56111, 0.428071, -0.103609, 0.296114, 0.556014, 0.311349, -0.457596, -0.0183177, 0.835727, -0.0668763, -0.273986, 0.981086, 0.703125, 0.0896994, -0.358407, 0.291666, -0.765481, 0.246892, 0.293097, 0.586376, 0.0328235, -0.11819, 0.046077, 0.370907, -0.99443, 0.647386, -0.00715746, 0.247766, -0.697065, -0.810426, -0.588329, -0.506557, 0.703285, 0.439899, 0.112449, -0.968268, -0.241996, -0.729674, -0.212318, -0.5176, 0.989839, -0.729798, -0.348269, -0.245429, 0.981665, -0.549279, 0.911853, 0.0666941, -0.323213, 0.214053, 0.830939, 0.432107, 0.612155, 0.64919, -0.500324, 0.172793, -0.50445, -0.399218, 0.123937, -0.891133, 0.64122, -0.654544, -0.234833, -0.857725, -0.765342, -0.722039, -0.11337, 0.775057, -0.0923211, 0.268402, 0.723218, 0.775575, -0.555102, 0.890063, -0.996663, 0.930942, -0.993667, -0.794053, -0.00954686, 0.596097, -0.487902, -0.135106, -0.998176, -0.339312, 0.842137},
-	{0.400496, -0.463323, -0.634225, -0.587682, -0.664763, 0.466717, 0.287821, 0.56174, -0.505287, -0.338783, -0.516925, -0.607695, -0.667879, 0.976112, 0.841639, 0.896835, -0.0570195, 0.0816844, -0.303917, 0.221467, 0.352635, -0.838852, 0.149721, -0.0990673, 0.249663, 0.961025, -0.242661, 0.229142, -0.234402, 0.0148454, 0.0856857, 0.517709, -0.383692, -0.382485, 0.828411, -0.378834, -0.316921, 0.464285, 0.247681, -0.682327, -0.966424, 0.697967, -0.259722, 0.758044, -0.0508866, 0.0335395, -0.930277, -0.723164, -0.0780527, -0.85871, 0.416478, -0.243789, 0.296041, 0.858815, -0.987503, -0.108833, 0.740766, 0.64604, -0.909739, -0.712565, -0.464089, 0.525138, 0.244808, 0.726646, -0.982671, -0.714293, -0.963713, 0.751016, 0.014468, 0.13581, -0.0352516, -0.928268, -0.86682, -0.737421, 0.40778, 0.559883, -0.881376, -0.674546, -0.729713, -0.0852659, -0.571463, 0.281051, 0.52927, 0.652991, -0.0414236, -0.20744, -0.299957, -0.913626, 0.352763, -0.197337, 0.128039, -0.210753, 0.101394, -0.296894, 0.603182, 0.839838, 0.915778, -0.57458, 0.341994, -0.527201, -0.457912, 0.511296, 0.633238, -0.174563, 0.930544, 0.0161261, 0.1232, -0.835506, -0.437047, 0.908729, -0.127272, -0.158317, -0.502713, -0.217218, 0.535856, -0.856677, -0.567956, -0.725443, 0.624596, -0.2335, 0.552388, 0.186955, -0.939176, -0.611389, -0.271961, 0.944853, -0.00181192, -0.588932, 0.209023, 0.290038, 0.151926, -0.606699, -0.100321, -0.73349, -0.115971, 0.943687, 0.74842, -0.827774, 0.427529, 0.685826, -0.803142, 0.741642, 0.768853, 0.84253, 0.465418, -0.270378, 0.707371, 0.994668, -0.0240947, -0.404316, -0.447005, -0.947747, 0.818658, 0.949077, -0.415817, 0.341402, 0.728941, -0.307118, -0.508229, 0.159937, -0.271011, 0.96566, 0.609646, -0.212179, 0.912466, 0.90119, 0.729395, 0.528405, 0.731631, -0.105589, 0.0411251, -0.5791, -0.39423, 0.199245, 0.232937, 0.531228, -0.569174, -0.278374, -0.438111, -0.207552, -0.260929, -0.769668, -0.203335, -0.882034, -0.359845, 0.0400395, -0.876015, 0.0652275, 0.574637, 0.652356, 0.256709, 0.223281, -0.929013, -0.301274, -0.319429, -0.92488, -0.38222, -0.389703, 0.732621, -0.533491, 0.749523, 0.654801, 0.338103, -0.307694, -0.932661, -0.220367, -0.384953, -0.291155, -0.87373, -0.948475, 0.830152, -0.709859, -0.25752, 0.927753, -0.770629, 0.0414626, -0.634105, -0.216431, 0.560518, -0.0564207, 0.800246, 0.326611, -0.385612, -0.40165, 0.734296, 0.355406, 0.463675, 0.0545487, -0.933539, 0.212831, -0.229815, 0.542353, -0.885257, -0.46116, 0.94351, -0.395823, 0.375234, 0.759095, 0.187972, 0.449306, 0.123773, 0.128194, -0.769413, -0.136235, -0.391659, -0.0177759, -0.581301, -0.910482, -0.559214, -0.256492, 0.715472, 0.717637, -0.0887588, 0.429801, -0.403586, 0.0801641, 0.34968, -0.0650242, -0.549431, 0.290853, -0.020837, -0.360581, 0.0635116, -0.519684, -0.328428, 0.306369, -0.716043, -0.560982, 0.00864886, -0.346388, 0.763827, -0.368177, 0.525014, -0.316412, -0.585401, -0.787034, -0.434189, 0.908979, 0.0197661, 0.648849, 0.120109, -0.0751607, 0.128646, -0.847411, 0.369118, 0.39378, 0.122208, -0.659421, 0.266372, 0.717381, -0.143761, -0.495667, -0.49625, -0.390615, 0.442715, -0.320695, 0.11899, 0.206446, 0.399529, 0.0589947, 0.804481, 0.84825, -0.297547, -0.796708, -0.604671, 0.852955, 0.0614302, 0.890248, 0.065643, 0.942815, 0.0712336, -0.773694, -0.0527891, 0.0450154, -0.708227, -0.364025, -0.746737, 0.215062, 0.366302, 0.970012, 0.147277, 0.382984, 0.382535, -0.0181902, -0.0124772, -0.188107, 0.941596, 0.539919, 0.821507, -0.554765, 0.14945, -0.69139, -0.942731, -0.926712, 0.162411, 0.865667, -0.917615, -0.408319, -0.854847, -0.0614985, -0.856047, 0.173597, 0.0264453, 0.162429, -0.954445, -0.967018, -0.756459, 0.42092, 0.0395164, -0.437861, 0.393445, -0.871106, -0.784182, -0.390892, -0.00591026, 0.373279, -0.968813, 0.932444, -0.536424, -0.164062, 0.594838, 0.185881, -0.468312, 0.499098, -0.405814, -0.92737, -0.674619, 0.452663, -0.0468482, 0.210457, 0.726221, 0.210333, -0.907432, -0.983726, 0.119132, 0.999318, 0.408867, 0.595161, -0.988982, 0.284286, -0.896927, -0.697509, -0.613516, -0.381466, -0.91645, 0.699769, 0.0744743, 0.437119, -0.207564, 0.863876, 0.793362, -0.738331, 0.707343, -0.601573, 0.609603, 0.490765, 0.111628, -0.242381, 0.929704, -0.20435, -0.779203, -0.14147, -0.282288, -0.218493, 0.617451, -0.99929, -0.459262, -0.533617, 0.379298, -0.824737, 0.0570912, 0.424661, 0.0689989, -0.282811, -0.223178, 0.569631, 0.146996, -0.622812, 0.507642, -0.354496, -0.380327, -0.630416, -0.446528, 0.505822, -0.968684, 0.606411, 0.661115, -0.990516, -0.396835, 0.043127, 0.488538, -0.51219, 0.403323, -0.335652, -0.331508, 0.87795, -0.43095, -0.770081, 0.0724257, 0.182958, 0.603081, -0.087361, 0.797969, -0.573964, 0.846239, 0.607967, 0.0813129, 0.312738, -0.475898, 0.462568, -0.378681, 0.726054, -0.632861, -0.393683, -0.363354, -0.379024, -0.614294, -0.648655, -0.743865, 0.368439, -0.691808, -0.586045, 0.922491, 0.61133, 0.168033, 0.055951, -0.0898881, -0.943089, -0.0306686, -0.982947, 0.643, 0.30932, -0.210939, -0.39307, -0.410848, -0.474889, 0.515818, 0.218436, 0.952036, -0.952123, 0.644945, 0.975825, -0.675626, -0.246469, -0.179057, -0.687988, -0.598227, 0.878918, 0.224663, 0.17756, -0.180059, -0.712562, -0.238046, 0.250832, -0.404054, 0.228511, -0.648278, 0.0398492, 0.00860918, 0.114615, 0.674832, -0.367105, 0.911806, 0.603916, 0.901023, 0.14246, -0.578452, -0.0759329, 0.442147, -0.743036, 0.33506, 0.382641, -0.50997, -0.320237, -0.263771, 0.191135, -0.403905, -0.169681, -0.320714, 0.833686, -0.785775, -0.17364, 0.664951, -0.567582, -0.636339, 0.0228252, -0.726535, 0.0901228, -0.0967408, -0.72667, 0.749132, -0.0715819, 0.213519, -0.045203, -0.266747, 0.755762, -0.33159, 0.236617, 0.524392, -0.336245, -0.351826, -0.755345, -0.257943, 0.921412, 0.827634, 0.438341, -0.59527, -0.250092, -0.558694, -0.4588, 0.271476, 0.094012, 0.16533, 0.545308, -0.762311, 0.964971, -0.00742472, 0.785338, -0.767045, 0.0166224, 0.0762552, 0.0357529, -0.196358, 0.307489, -0.971745, -0.67377, -0.096363, 0.908266, -0.845567, -0.190569, -0.375396, 0.785576, 0.0398927, -0.713205, 0.912603, 0.0812461, -0.375006, 0.913404, 0.202758, 0.243176, 0.676869, 0.730844, -0.139889, -0.0228206, 0.954634, -0.177989, 0.691491, 0.238533, -0.912893, -0.138624, 0.466931, -0.971901, 0.469348, 0.621353, -0.327516, 0.240282, -0.217688, -0.0886721, 0.614395, -0.921509, 0.732263, 0.602508, -0.0195281, 0.207732, -0.557761, -0.559437, 0.527902, -0.876578, -0.223852, 0.725463, -0.818331, 0.895387, 0.928958, -0.0274608, -0.344771, 0.712889, -0.999076, -0.223559, 0.528319, 0.859078, -0.387632, -0.319562, 0.352734, 0.90751, 0.0348653, 0.342817, -0.942223, -0.209836, 0.871045, -0.556468, -0.0303428, 0.738864, 0.917833, 0.880343, -0.684335, 0.285778, 0.759565, -0.899367, 0.447779, 0.395381, -0.360407, 0.292076, 0.698506, -0.345462, 0.723585, 0.574439, 0.33488, -0.872914, 0.736145, -0.688335, -0.252601, 0.38377, -0.518949, -0.326241, -0.677297, -0.990217, -0.14088, -0.754933, -0.83882, -0.924029, 0.718852, -0.153923, -0.777909, 0.795917, 0.935439, 0.712004, 0.844042, 0.18735, 0.556165, 0.943206, -0.604718, -0.347764, 0.2412, 0.63809, -0.678023, -0.895626, -0.714213, -0.123213, -0.95117, -0.765016, -0.665306, 0.00468275, 0.860496, 0.731492, 0.142976, 0.201706, -0.797452, -0.766214, 0.886033, -0.33531, -0.883134, 0.168102, 0.0176463, -0.0557729, -0.771854, 0.462743, 0.934134, 0.854572, -0.318598, -0.397059, 0.782336, -0.113108, 0.173177, 0.142208, 0.786644, -0.0384076, -0.148451, -0.793882, 0.532423, -0.591869, -0.985575, -0.980808, -0.461004, 0.294139, 0.0456626, -0.389539, -0.387285, 0.756939, -0.386705, -0.00949256, 0.443192, -0.846323, -0.104903, -0.911867, -0.96203, 0.68421, 0.0778379, 0.14131, 0.361233, -0.966249, 0.429366, 0.341267, 0.939088, 0.587725, 0.584081, 0.149218, 0.4089, 0.351946, 0.990266, 0.303562, 0.897374, 0.425225, 0.943572, 0.946497, -0.562221, 0.511413, 0.982742, 0.0637605, 0.331993, -0.108246, -0.509968, -0.993419, 0.877778, 0.282318, 0.26681, 0.55515, 0.359137, -0.137106, 0.191917, 0.954592, 0.374703, 0.524194, 0.157107, 0.991117, -0.694599, -0.742162, 0.33581, 0.561936, -0.0865769, -0.176821, -0.228496, -0.56691, 0.438164, 0.146866, 0.522866, -0.246145, 0.0252365, 0.271151, 0.127155, 0.652631, 0.779767, -0.350553, -0.53982, -0.695554, -0.57455, -0.39269, 0.374084, -0.59067, 0.267818, -0.0882169, 0.973852, -0.10846, -0.658527, 0.218268, 0.616556, 0.743744, -0.358603, 0.406451, -0.886795, 0.434798, -0.374115, 0.646143, -0.207816, 0.647752, 0.861908, 0.174505, 0.027046, 0.852151, 0.124225, 0.697996, -0.892756, -0.69224, 0.726191, -0.426184, 0.186178, 0.344793, -0.249146, 0.0533527, 0.94647, 0.998629, 0.645453, -0.241385, 0.137863, -0.71675, -0.116149, 0.0550258, -0.839976, -0.240078, 0.351933, -0.924616, -0.874785, 0.0293068, -0.410736, -0.322038, 0.24665, 0.684206, -0.705317, -0.103326, -0.69577, -0.34481, 0.947524, 0.580283, -0.0960078, 0.930815, -0.871491, -0.502715, 0.981228, -0.171598, -0.911174, 0.859225, -0.928073, -0.157947, 0.676465, 0.261324, -0.755046, -0.419039, 0.100714, -0.00877933, 0.0722191, -0.0700498, 0.81276, -0.286624, -0.463611, -0.224717, -0.889222, -0.28655, -0.076779, -0.419604, -0.205367, 0.799959, 0.201899, 0.668779, 0.364622, -0.246877, 0.94491, 0.866636, 0.475638, 0.893163, -0.325416, 0.606651, 0.959492, 0.98325, 0.855934, 0.313807, 0.335769, 0.146581, 0.256508, -0.72471, -0.614955, 0.459876, -0.94534, -0.353696, 0.79642, 0.808984, -0.66496, 0.127472, 0.238993, 0.0452209, 0.549684, -0.377971, 0.204282, -0.301081, 0.340533, -0.177349, -0.333555, -0.967564, -0.535526, -0.347045, 0.0578121, 0.379733, -0.771775, -0.614434, -0.24479, 0.671377, -0.159001, -0.176999, 0.864285, -0.794751, 0.076914, 0.0254717, -0.578955, 0.772222, -0.804967, 0.491911, -0.526817, 0.485824, 0.244464, 0.237338, 0.986755, 0.19993, -0.279531, -0.582399, -0.407884, 0.454055, -0.265206, 0.895431, 0.950623, 0.843724, -0.958145, 0.951717, -0.104282, -0.587469, -0.979062, -0.904196, -0.0376666, 0.575172, -0.816929, 0.413621, 0.879807, 0.521627, 0.386545, 0.463792, 0.0580407, 0.419338, 0.515648, -0.140113, 0.38724, 0.958064, 0.00908782, 0.00220344, 0.419305, -0.856877, 0.396596, 0.587154, -0.750506, -0.284688, 0.209324, 0.614314, -0.266615, 0.714065, -0.805158, -0.857503, 0.726636, -0.649603, 0.0761868, 0.675807, 0.750324, 0.615667, 0.404762, 0.16783, -0.825587, -0.138248, 0.929282, -0.0472207, 0.97217, -0.0551349, 0.319499, 0.442217, -0.915764, -0.00711306, -0.991534, 0.862285, 0.447889, 0.419006, -0.92097, 0.702657, 0.660538, 0.282696, -0.493495, 0.945388, -0.090362, -0.454035, 0.664519, 0.0487161, -0.894959, 0.0145758, -0.446906, 0.776468, -0.275656, -0.694405, -0.957026, -0.250005, 0.404173, 0.381954, -0.208256, -0.837861, 0.897569, 0.245198, 0.964456, -0.27858, -0.0939723, 0.0042411, 0.157929, -0.938894, 0.93992, 0.155498, -0.962239, 0.922522, -0.5802, 0.0660098, 0.0298248, -0.00866652, 0.43032, -0.458176, 0.713152, 0.617256, 0.732278, 0.722084, -0.916181, -0.421102, 0.96329, 0.969975, -0.785144, 0.558292, -0.137869, 0.240432, -0.0983929, 0.283797, 0.747508, -0.369939, -0.0799063, -0.388871, 0.896486, 0.118782, 0.550311, 0.852134, 0.409799, 0.357129, 0.636656, -0.742371, 0.0198255, -0.807715, 0.664889, 0.636611, -0.324219, 0.700845, 0.440274, -0.531406, 0.300517, -0.835256, -0.726603, -0.00245526, -0.934882, 0.0678913, 0.729817, 0.580522, 0.166317, -0.192268, 0.0863431, -0.528436, -0.417288, -0.512402, 0.0678661, 0.828766, 0.807701, -0.10781, -0.771887, -0.293909, -0.365402, -0.380407, -0.242497, -0.825039, 0.483301, 0.491022, -0.787269, 0.597467, 0.519644, -0.353135, 0.0602776, 0.279226, -0.309968, -0.429446, -0.814876, -0.48444, -0.792413, 0.0640158, -0.332741, 0.839217, -0.980524, -0.493915, -0.663448, 0.254136, -0.964728, 0.433876, -0.987294, -0.710105, -0.641224, 0.749347, -0.599924, 0.787295, 0.0570497, 0.477689, -0.981564, -0.787129, 0.255964, 0.0730296, 0.0935449, -0.00202191, 0.38685, -0.310425, -0.303185, -0.303472, -0.301296, 0.50172, 0.214577, -0.650962, -0.436252, -0.994779, 0.414993, 0.0985458, -0.280884, -0.953302, -0.740583, -0.85653, 0.231986, 0.692378, 0.89742, -0.723882, -0.294703, -0.714204, 0.600142, -0.147999, 0.948882, 0.792487, -0.6664, 0.225632, -0.19576, -0.376264, 0.0267022, 0.957314, 0.534573, 0.445591, -0.819613, 0.536005, -0.463755, 0.354599, -0.631658, -0.570333, 0.772228, -0.0832353, -0.53094, -0.465589, 0.540252, 0.425541, 0.630734, 0.111371, 0.623903, 0.387303, -0.806452, 0.733735, -0.68453, 0.69507, 0.717447, -0.647361, 0.0162775, 0.744429, -0.0493478, -0.498822, -0.631951, 0.543867, 0.423112, 0.246499, 0.118727, -0.101974, -0.571288, -0.361038, 0.493836, -0.612737, 0.151106, 0.712291, 0.411961, 0.181206, 0.801195, -0.352432, 0.805288, -0.949401, 0.861861, -0.0786532, 0.191364, -0.162973, -0.929981, 0.269723, 0.781747, 0.840769, -0.0315912, -0.628184, 0.232087, -0.583372, -0.221397, -0.605746, -0.403065, -0.549144, -0.772523, 0.0781223, -0.929141, 0.540422, 0.0250709, -0.310078, -0.84965, 0.634864, 0.154238, 0.401257, -0.367538, -0.239901, 0.254473, 0.592238, -0.47223, -0.593534, -0.413521, 0.0998364, -0.284715, 0.526157, 0.0668276, -0.16823, 0.635378, -0.0753425, -0.640447, 0.40993, -0.902196, 0.193643, -0.679899, -0.170899, -0.597822, 0.552194, -0.553692, -0.888099, 0.596835, 0.676856, -0.823971, -0.390053, -0.627782, -0.310936, 0.443271, 0.733148, 0.912462, -0.378083, -0.908296, 0.172784, 0.884588, 0.787538, 0.490634, -0.886146, -0.704798, 0.510929, 0.110966, -0.501422, -0.465524, 0.51844, 0.0559295, 0.602684, 0.663203, 0.475958, 0.944294, 0.445443, 0.409741, -0.583396, 0.173291, 0.0628105, 0.794358, -0.767676, -0.519355, -0.480716, -0.451522, 0.955126, 0.964618, 0.238547, 0.921539, 0.141622, -0.987707, -0.839958, 0.427639, -0.856498, -0.73679, -0.52903, 0.90335, 0.550864, -0.739219, 0.682883, -0.146429, -0.0948271, -0.154761, 0.886646, -0.585216, 0.878279, 0.932488, -0.34601, -0.192944, 0.891175, 0.251671, 0.801292, 0.901212, 0.0365945, 0.916253, 0.495426, 0.496322, 0.552315, -0.524073, -0.4858, 0.241799, 0.862263, 0.0524316, 0.635905, 0.560137, -0.680091, 0.579317, -0.614646, 0.984582, 0.731987, 0.0917553, 0.00800998, -0.486667, -0.89363, -0.97062, 0.969325, -0.177526, -0.379124, 0.621093, 0.688382, 0.562491, 0.234537, -0.483899, -0.0446494, -0.76293, 0.345714, 0.914923, -0.884517, -0.121574, -0.177806, -0.670701, 0.985888, -0.651824, -0.0859669, -0.978409, -0.920351, 0.709422, -0.369002, -0.875751, 0.963448, 0.202276, 0.947884, 0.186336, 0.210374, 0.528183, 0.507895, -0.268336, 0.598621, 0.661364, 0.123316, 0.549461, 0.957097, -0.910314, -0.964583, -0.898662, 0.678794, 0.044419, -0.888806, -0.0809776, -0.22411, -0.747671, 0.277768, 0.233694, -0.029285, -0.996016, -0.961884, -0.715725, -0.352286, -0.227957, -0.364605, -0.709425, 0.564265, 0.348588, -0.661103, -0.903228, -0.712298, -0.0357818, -0.0760123, -0.475189, 0.477393, 0.285503, -0.765274, 0.81299, -0.940242, -0.60027, -0.378236, 0.122361, -0.033976, -0.285842, 0.981403, -0.149238, -0.0226328, 0.691348, -0.282649, 0.149122, 0.692299, 0.595134, 0.0876614, 0.352711, -0.209777, -0.595729, -0.960711, 0.23367, 0.684433, -0.921625, -0.95564, -0.905895, 0.68269, 0.805214, 0.15078, 0.133648, 0.733009, 0.713838, -0.663745, -0.962001, -0.131088, 0.430859, 0.0295764, 0.925201, 0.0479047, 0.0275449, -0.544004, -0.422544, -0.25944, 0.388177, 0.405154, -0.194676, -0.362628, 0.698928, -0.239261, 0.369603, -0.322974, -0.546754, 0.178712, -0.857426, 0.435083, -0.536233, 0.363452, -0.928913, -0.45313, -0.817108, -0.356953, 0.167878, 0.228544, 0.24408, 0.675462, -0.652507, 0.690794, 0.979441, -0.869775, -0.895908, 0.924391, -0.254717, 0.0516255, 0.636715, -0.111035, -0.595529, 0.0673117, -0.348082, -0.121333, -0.656631, -0.357828, -0.571969, -0.816672, 0.323664, -0.560058, 0.805204, 0.794932, -0.514184, -0.855118, 0.226855, 0.72863, -0.856554, -0.783359, -0.592457, -0.129697, -0.990726, 0.888463, 0.649712, -0.851646, -0.581335, 0.126616, -0.0809912, -0.86781, -0.432044, -0.871656, -0.0668476, -0.218201, 0.729668, 0.0361354, -0.394091, 0.0625128, -0.501731, 0.134943, 0.712191, -0.140515, 0.139816, -0.878954, -0.124586, 0.158036, -0.997102, 0.489038, -0.836013, -0.098334, 0.943801, -0.504971, 0.123197, -0.467677, -0.737792, -0.23646, -0.934769, -0.351539, -0.982295, -0.392192, -0.481849, -0.474887, -0.476076, 0.46713, -0.526567, 0.698858, -0.933118, 0.584843, -0.883523, 0.27388, 0.309197, -0.349718, -0.713471, 0.1419, 0.676274, -0.613386, -0.225711, 0.833756, 0.35353, -0.185508, 0.919251, -0.73039, 0.0893163, -0.9037, 0.559829, -0.505263, -0.279469, -0.495628, -0.189672, -0.407473, 0.64557, 0.765516, 0.540628, 0.380464, 0.650403, -0.0849559, 0.212715, 0.659055, -0.155669, 0.486499, -0.745296, -0.933693, -0.924003, -0.292144, -0.836745, 0.458577, 0.667915, -0.470702, 0.0994781, 0.453315, 0.363165, 0.302488, -0.622948, -0.988675, -0.238574, 0.0843695, 0.338339, 0.58175, 0.99989, 0.739901, 0.598201, 0.288568, 0.247921, 0.904305, -0.638057, 0.121558, 0.437247, -0.826258, 0.223047, 0.169129, -0.879581, 0.258171, -0.669126, 0.60498, 0.250576, -0.68522, -0.358657, -0.980127, -0.305451, 0.185046, 0.333402, -0.306823, -0.563785, -0.593003, -0.165155, 0.371704, 0.318769, -0.239405, -0.733226, 0.745353, 0.899284, -0.782505, 0.418232, 0.290748, 0.151833, -0.0756811, 0.44889, -0.214234, 0.842359, 0.37517, 0.606733, 0.62511, -0.888104, -0.60282, -0.109267, -0.0686759, 0.334955, 0.781164, -0.39839, -0.651426, -0.116187, -0.499221, -0.530769, 0.337659, 0.608088, 0.671565, 0.318477, 0.64135, 0.189396, -0.175355, -0.941254, -0.757046, 0.438818, -0.438838, 0.850531, 0.445376, -0.594776, -0.597363, -0.19865, 0.216748, -0.0815916, 0.374489, -0.554046, 0.61474, 0.102324, 0.638192, 0.189375, -0.95456, -0.380997, -0.816646, 0.727263, 0.834796, -0.375936, -0.478523, 0.171263, -0.448271, 0.621089, 0.859004, -0.615921, 0.215936, 0.869175, 0.496228, 0.784388, -0.481438, 0.548112, 0.606474, 0.338915, -0.212539, -0.60527, 0.379893, -0.418294, 0.22445, -0.751602, -0.598215, -0.470572, 0.531402, 0.310722, 0.514448, -0.202811, -0.711847, -0.594301, 0.380329, 0.259425, 0.486794, -0.565015, -0.242751, -0.333102, -0.723927, -0.964483, 0.0592317, -0.290992, 0.824576, -0.773537, 0.872101, -0.779839, -0.14908, -0.486027, -0.10992, -0.279346, -0.820101, -0.0309736, -0.91578, 0.420072, 0.800738, -0.248891, -0.515014, -0.190901, -0.45613, 0.163111, 0.930795, 0.758898, 0.560314, 0.286046, 0.530932, -0.9456, -0.0952417, -0.618669, -0.013599, -0.522716, -0.455321, -0.405346, 0.0907499, -0.798451, -0.523189, 0.834825, 0.658018, -0.276876, 0.820476, 0.767988, 0.473161, 0.775583, 0.58803, 0.411912, 0.907927, -0.503379, -0.594673, 0.659087, 0.08066, -0.464529, 0.415065, -0.572169, 0.751101, -0.739408, -0.482416, 0.873092, 0.688257, 0.258879, -0.435945, 0.960304, 0.621971, -0.695536, 0.0424822, -0.687002, 0.697661, -0.0806619, 0.792512, 0.953034, 0.513227, 0.426374, 0.555783, -0.938653, 0.974103, 0.358132, -0.509843, -0.475913, 0.38923, -0.131287, -0.826946, -0.00997768, 0.764202, -0.00475474, 0.967825, -0.0510942, 0.523924, 0.249608, -0.143661, -0.205171, 0.319144, 0.773833, -0.439939, 0.615035, -0.912661, 0.131948, 0.270103, 0.451173, 0.129416, 0.0785788, -0.353749, -0.964586, -0.488137, -0.0308068, -0.661523, 0.647389, 0.834559, 0.445075, -0.896038, 0.399704, -0.0979334, -0.66197, 0.049114, -0.699606, 0.810678, 0.142034, -0.931066, -0.970331, -0.809918, -0.647987, -0.594933, 0.947738, 0.278915, -0.196137, -0.289607, -0.534208, -0.184128, 0.60912, -0.766599, 0.686825, 0.655771, -0.501141, 0.476866, -0.914895, -0.660172, 0.0448683, 0.714213, 0.115795, -0.295712, 0.906796, -0.237406, 0.183274, -0.479473, -0.129677, 0.266712, 0.245407, 0.763759, -0.171191, -0.646688, 0.43873, 0.684822, -0.577618, 0.273646, 0.62309, -0.65689, 0.271704, -0.478841, 0.986372, -0.958636, 0.703935, -0.176986, -0.591093, -0.144515, 0.475345, -0.546666, 0.776866, 0.560924, 0.981651, -0.962167, -0.540703, 0.671307, -0.211495, 0.947866, 0.221302, -0.498165, 0.665939, -0.346459, -0.957572, -0.28319, 0.419873, 0.247649, 0.410698, 0.726115, -0.93958, -0.471575, -0.840592, -0.295533, 0.695841, -0.0623738, -0.545237, 0.511993, -0.824946, -0.428141, 0.293816, -0.917697, 0.788021, 0.949997, 0.516403, -0.86356, 0.109725, 0.517916, 0.0742653, -0.991086, -0.214786, 0.601653, 0.908935, 0.889967, -0.883578, 0.977557, 0.742705, 0.93624, 0.0479107, -0.747948, -0.82032, 0.672471, 0.489627, -0.894387, -0.382978, 0.599893, -0.701871, -0.704238, 0.761308, 0.608024, -0.711509, -0.279209, 0.148916, -0.697219, -0.176826, -0.556609, 0.672734, -0.590711, -0.33799, 0.0540484, 0.642873, -0.847071, -0.363487, -0.210466, -0.762547, -0.431647, 0.562053, 0.643753, 0.593116, 0.126987, -0.165971, -0.0208851, -0.633144, -0.477, -0.899554, -0.717007, -0.00500466, -0.220663, 0.0474358, -0.27318, -0.160814, -0.043528, -0.264175, 0.877086, -0.725276, -0.438516, 0.626555, -0.594085, 0.761422, 0.853499, 0.804174, -0.22764, -0.105237, -0.920596, 0.020445, -0.455975, -0.122001, -0.0815677, 0.40433, 0.306461, 0.230338, 0.0412082, -0.755953, 0.805442, 0.982083, 0.102302, 0.248778, 0.0207122, -0.0827483, 0.775173, -0.179302, -0.966083, 0.721236, 0.624591, -0.79608, -0.209049, -0.617151, 0.639037, -0.760117, 0.424535, -0.0670854, -0.858364, -0.249925, -0.811687, 0.200326, 0.565169, -0.439327, -0.353219, 0.774103, 0.253798, -0.0315313, -0.783289, -0.914497, 0.656549, 0.83526, -0.688731, -0.704609, -0.64053, -0.766701, 0.430469, -0.474335, 0.342992, 0.981269, -0.0351807, 0.138886, -0.23337, -0.668101, 0.969537, -0.739257, 0.71528, -0.127377, 0.150965, -0.196708, 0.412899, 0.939861, -0.766892, 0.0168399, 0.958896, -0.604722, -0.237286, 0.6281, 0.841617, -0.462195, -0.39477, 0.633337, -0.470803, -0.408433, 0.576026, -0.16744, 0.397542, -0.346465, 0.0789296, 0.155072, -0.411734, -0.480095, 0.714362, 0.0367777, 0.684095, -0.0185536, -0.293389, 0.770877, -0.0189705, 0.296707, -0.711152, -0.816227, -0.0781744, 0.532805, 0.821755, 0.891591, -0.983375, 0.467114, 0.827617, 0.837315, 0.440508, 0.192311, -0.402387, -0.812053, 0.131704, 0.214491, -0.957334, 0.961635, -0.37169, -0.982104, 0.431276, 0.761189, -0.453066, -0.362228, 0.0237258, -0.710266, -0.673922, 0.963568, -0.45246, -0.297957, -0.407307, -0.0977872, -0.234348, -0.869233, 0.765085, 0.0633765, 0.923851, 0.624928, 0.842365, -0.00388339, -0.59939, -0.724875, -0.74819, 0.632674, 0.544481, -0.615555, -0.581475, -0.306746, -0.047032, 0.315625, 0.296347, 0.969221, -0.97305, 0.611407, -0.68738, 0.426043, 0.0627975, 0.90682, 0.286066, 0.304275, -0.953773, -0.716785, -0.161765, 0.312117, 0.0970228, 0.430408, 0.870308, -0.868954, -0.284263, -0.501777, -0.390379, -0.604911, -0.157853, -0.638044, -0.940703, -0.758507, -0.102875, 0.565684, -0.0467341, 0.0205373, 0.816518, -0.491781, 0.73906, 0.412447, -0.300124, -0.870788, 0.124139, -0.490592, -0.190396, -0.797718, -0.78148, -0.767529, -0.29093, 0.252892, -0.957236, -0.863336, -0.156655, 0.760757, -0.212487, 0.377375, -0.597437, 0.319122, 0.345665, -0.663124, 0.0548917, -0.435048, -0.862957, -0.931495, -0.861051, -0.793545, 0.684947, 0.00954393, -0.705164, -0.88616, 0.57439, 0.397392, -0.0836198, 0.576547, 0.883322, -0.266442, 0.343571, 0.485717, 0.261518, -0.110314, -0.444422, 0.601151, 0.0464125, 0.825751, 0.255449, -0.207626, 0.614896, 0.802721, 0.217012, 0.541157, 0.690332, 0.405601, 0.194935, 0.117258, 0.0614955, -0.215191, -0.128661, 0.664967, 0.619568, 0.935517, 0.445745, -0.554852, 0.782996, 0.390407, -0.77049, 0.426145, -0.521914, 0.637606, 0.972514, 0.647936, 0.676889, -0.66559, -0.719758, 0.865795, 0.274621, -0.324388, -0.757832, -0.997179, 0.246278, -0.910671, 0.806447, -0.864424, -0.795095, 0.99178, 0.0542186, -0.603349, -0.461961, 0.197795, 0.513908, -0.793141, 0.110481, -0.647125, -0.785854, 0.601863, 0.320015, 0.847737, -0.783925, -0.691852, 0.47783, -0.474421, 0.64574, -0.829976, -0.808416, -0.244551, -0.404801, 0.298727, -0.218302, 0.957029, 0.448739, -0.406431, -0.361458, -0.570958, 0.355212, -0.918199, -0.249369, -0.173417, -0.0843331, -0.23329, -0.395644, 0.274069, -0.700729, -0.800178, 0.442348, -0.675938, 0.0291721, -0.189422, -0.589691, -0.336507, 0.976912, 0.644569, -0.445326, 0.970805, -0.0547832, -0.93284, -0.961952, -0.231298, 0.450101, -0.359884, -0.553176, 0.28659, -0.150624, 0.778343, 0.339272, -0.579205, 0.921244, 0.392528, 0.498111, 0.880918, 0.383366, -0.415354, 0.190469, 0.818597, 0.900195, 0.921369, 0.152971, -0.766603, -0.791314, 0.0471797, 0.931504, 0.950497, -0.928792, -0.997578, 0.41963, -0.970433, 0.957415, -0.950306, -0.438087, -0.86197, 0.217897, -0.14134, -0.781651, 0.167893, -0.531068, 0.962492, 0.728443, 0.64052, -0.0760414, 0.843252, 0.963161, -0.495353, 0.092898, -0.256804, -0.0834502, -0.891208, -0.591089, 0.974876, 0.355602, -0.901403, 0.270222, 0.76598, -0.665455, 0.440502, -0.792697, 0.504722, 0.796772, 0.220835, 0.568905, -0.124389, -0.187751, -0.46638, 0.585873, -0.519799, 0.833726, -0.458832, 0.588706, -0.136784, 0.250171, -0.813512, 0.999901, -0.701399, 0.414399, 0.185537, 0.442068, 0.635832, -0.230442, -0.867653, 0.226351, -0.256684, -0.670816, 0.991753, -0.531417, 0.789972, -0.16641, 0.733289, -0.461277, -0.389379, 0.955142, -0.0905003, -0.160928, 0.754256, 0.168212, 0.786044, -0.0105984, 0.109119, -0.541841, 0.054863, 0.513064, -0.498854, 0.709732, -0.494944, -0.00949727, 0.0935953, -0.777892, -0.63497, 0.0468562, -0.345266, -0.387269, -0.668426, -0.467879, 0.10904, 0.818049, -0.195594, -0.674048, 0.199045, 0.57977, 0.973753, -0.968307, 0.274553, -0.471565, 0.862583, 0.833474, 0.724364, 0.519682, 0.806926, 0.781445, 0.545903, -0.255616, 0.77194, -0.953208, 0.608403, -0.479185, -0.780364, -0.621124, 0.631586, -0.0199257, -0.957345, 0.300839, 0.878164, 0.760936, 0.230615, 0.810006, -0.236525, -0.99534, -0.723782, 0.406857, 0.243179, -0.112813, -0.280342, -0.0258568, -0.89773, -0.757989, -0.0232801, -0.836022, 0.756727, -0.0846233, 0.178004, 0.592165, -0.202213, 0.255547, 0.493271, 0.722269, -0.691359, -0.00730808, -0.490692, -0.123598, -0.243975, -0.957616, -0.0645965, 0.193885, 0.0726835, -0.976482, -0.252624, 0.898603, 0.279177, 0.0890022, -0.318735, 0.125414, 0.832999, -0.840896, -0.273131, -0.796626, -0.884, 0.688304, -0.0226828, 0.763313, 0.857428, 0.587034, 0.782751, -0.765777, 0.914126, -0.406538, -0.346515, -0.491927, 0.0924149, 0.974962, -0.651173, -0.398694, -0.541283, 0.291693, -0.637726, 0.668719, 0.172662, -0.545775, -0.216554, 0.726583, -0.158069, -0.824789, 0.355623, 0.588072, -0.389018, 0.68333, 0.892435, 0.617201, -0.295186, -0.272098, -0.0355306, -0.123545, 0.279884, -0.976663, 0.0326523, -0.809032, -0.433247, -0.323639, 0.429056, 0.693378, 0.362272, 0.130114, 0.204968, -0.970326, 0.521407, 0.728889, -0.802401, -0.0859195, 0.516554, 0.292197, 0.609475, 0.706169, -0.6501, -0.186775, 0.199192, 0.253264, -0.425384, -0.0108827, -0.295945, -0.174975, -0.654948, 0.237054, -0.843369, -0.937579, -0.532506, -0.377933, -0.146534, -0.626836, -0.84412, -0.451956, 0.544254, -0.637277, 0.784509, -0.754191, -0.137335, -0.175098, -0.503238, 0.558734, -0.273218, -0.520807, -0.830252, -0.542989, -0.221794, 0.506646, 0.939426, -0.167052, 0.784266, 0.482796, -0.0178435, -0.571856, -0.577216, 0.390684, -0.749899, 0.429339, 0.480204, -0.101761, -0.159913, 0.912103, 0.304184, -0.523963, -0.806456, 0.212258, -0.905779, -0.203448, 0.123588, 0.321872, -0.829238, -0.705098, -0.0464286, 0.684264, -0.814303, 0.485924, -0.321761, -0.993337, 0.244168, -0.147994, 0.888105, -0.165015, -0.541893, 0.577958, 0.711795, 0.0397591, 0.279171, 0.700031, -0.66324, -0.510836, 0.31749, 0.191345, -0.369632, 0.940515, -0.344456, -0.465755, 0.810644, -0.915013, -0.295202, -0.443418, -0.167804, -0.881003, -0.394728, -0.765413, 0.358555, -0.94464, 0.669662, -0.0393415, -0.89515, -0.0816789, -0.238817, 0.055242, -0.781948, -0.416145, -0.968314, 0.0331866, 0.777537, 0.930058, 0.214807, -0.975358, -0.779721, -0.727834, -0.552059, -0.210266, 0.431465, 0.0663906, -0.460353, -0.199085, -0.61097, 0.588157, 0.773112, 0.98735, 0.176205, 0.502216, -0.804734, 0.44054, 0.429405, 0.217954, -0.275606, -0.300637, 0.514435, -0.0606581, -0.0537038, 0.724655, -0.664408, 0.786539, 0.998654, -0.208631, -0.478269, -0.72131, 0.514557, -0.173753, -0.785694, -0.550498, -0.709188, 0.615765, -0.268373, -0.294499, -0.455127, -0.0320798, -0.882958, 0.970408, 0.73675, -0.750048, -0.100278, -0.789754, 0.00115217, 0.692089, -0.479293, 0.0707467, 0.0439773, 0.0538431, 0.166343, -0.992048, -0.926017, 0.159261, -0.942789, -0.788256, 0.179299, -0.277908, 0.284199, -0.209997, -0.553659, -0.339083, 0.375733, 0.0717893, 0.977166, 0.493582, 0.699606, 0.95857, -0.871186, -0.0574594, 0.00471581, -0.305388, 0.994808, 0.836074, 0.654775, -0.640825, -0.30532, 0.437683, -0.916943, 0.549739, -0.405531, -0.0241264, 0.701982, -0.500912, -0.505607, 0.887351, -0.0350164, 0.536697, -0.794162, 0.584034, -0.849936, 0.157783, -0.506342, 0.486281, -0.907547, -0.855246, -0.28809, 0.0250686, 0.757067, 0.025699, -0.981949, -0.688224, -0.912491, -0.335575, 0.276236, -0.00111071, 0.285166, -0.442453, -0.413643, 0.932869, -0.287701, 0.0281706, 0.965365, 0.531686},
-	{-0.542054, -0.664522, -0.265749, 0.494925, -0.664703, -0.0797656, 0.548727, -0.728351, 0.42771, -0.953845, -0.0759704, 0.405458, -0.219439, 0.328394, 0.837053, 0.404746, 0.334703, -0.196229, 0.234235, 0.713757, 0.571739, -0.92023, 0.892793, -0.807244, 0.074726, -0.624475, -0.612785, 0.761003, -0.279556, 0.229507, -0.574219, -0.900712, -0.454035, -0.719963, 0.410192, -0.131251, -0.821072, -0.0811896, -0.986976, 0.462374, -0.732848, -0.864363, -0.723282, -0.762315, -0.200309, 0.656398, -0.613918, -0.92919, 0.369398, 0.513731, -0.80726, -0.570587, 0.113704, -0.661523, -0.550048, -0.775977, 0.540832, -0.323242, -0.874715, -0.12734, 0.0503072, -0.116696, 0.823126, 0.552069, -0.948127, 0.788775, -0.793111, -0.50174, -0.510521, -0.672889, -0.341709, -0.995492, 0.843166, -0.351272, -0.808992, -0.545049, 0.912755, -0.671048, -0.189991, -0.818163, 0.962573, -0.884092, 0.0713565, -0.0964938, 0.00559489, 0.0370335, 0.480494, -0.398065, 0.851193, 0.827439, 0.547497, 0.237052, -0.962009, -0.921363, 0.414225, -0.754641, 0.139534, 0.372986, -0.194566, -0.981431, -0.57458, -0.829937, 0.233709, 0.0388867, -0.422918, 0.519766, -0.586427, 0.195105, 0.888142, -0.942793, -0.97538, -0.178304, 0.855518, 0.225488, -0.581422, -0.181234, 0.396522, 0.00234234, 0.197068, 0.489128, -0.523855, -0.481092, -0.576208, 0.937235, -0.923445, -0.137993, 0.351697, 0.000929348, 0.511522, 0.702237, 0.0425291, -0.132024, 0.739436, 0.211822, -0.587559, 0.963784, -0.985267, 0.416781, 0.928247, 0.990889, 0.678375, 0.802054, -0.858367, 0.160311, 0.744622, -0.00309049, 0.692576, -0.880726, 0.963702, 0.55313, 0.850655, 0.0766312, -0.354616, -0.597001, -0.624201, 0.933872, 0.626636, -0.105759, -0.766183, 0.819046, 0.947482, -0.328161, 0.844816, -0.26122, -0.489563, -0.81881, -0.419576, -0.934639, -0.525315, 0.167412, -0.630103, -0.194448, -0.622761, 0.218467, 0.251175, 0.285963, 0.488028, 0.816756, -0.405563, 0.407333, 0.893022, -0.941411, 0.591053, 0.848654, -0.262882, -0.980743, -0.364416, 0.486961, -0.302385, -0.10001, 0.775462, -0.543927, 0.614341, -0.89769, -0.748477, -0.87113, -0.98251, 0.342896, 0.115016, -0.785496, -0.412685, 0.458785, -0.23397, -0.981388, 0.310678, -0.892878, 0.938193, 0.704045, -0.836237, -0.654567, -0.620115, -0.0474819, 0.87034, 0.13499, -0.184559, 0.888294, 0.353823, -0.660176, 0.405559, 0.352508, -0.563148, 0.607514, 0.425032, 0.988998, 0.574941, 0.918394, -0.0548154, -0.60193, 0.856567, 0.327978, 0.501404, -0.49956, 0.237732, 0.786814, -0.447629, 0.80414, 0.74045, -0.693867, 0.90717, 0.693913, -0.498593, -0.125653, -0.88491, 0.727172, -0.553274, -0.63441, -0.836075, -0.660404, 0.742426, -0.91234, 0.780851, 0.90077, 0.295961, 0.627433, 0.689511, -0.653127, -0.318643, 0.726099, 0.0927944, 0.344459, -0.55508, 0.549828, -0.195164, -0.0020757, 0.266399, -0.240733, -0.50633, 0.80823, -0.653013, -0.94453, 0.876748, 0.920699, 0.121734, -0.499279, -0.662522, -0.52435, 0.252527, -0.206838, 0.754346, 0.416811, -0.34629, -0.392238, 0.492256, 0.617908, 0.520678, 0.76232, -0.780081, 0.451313, 0.517541, 0.910956, -0.55033, 0.780392, -0.904034, 0.704371, -0.320626, 0.510264, -0.606106, -0.0139267, -0.468344, -0.152275, -0.797691, -0.532706, 0.665017, 0.548312, -0.0774969, 0.0777046, -0.109767, -0.686248, 0.484897, -0.0877426, -0.866321, 0.773112, -0.250231, -0.828215, 0.9821, -0.19709, 0.782054, -0.324708, 0.627127, -0.377155, -0.98287, 0.51968, -0.595841, 0.794168, -0.0319792, 0.852473, -0.709704, 0.688099, -0.368642, -0.981513, 0.635049, 0.122281, 0.445909, 0.643227, -0.976189, -0.00731667, 0.333215, -0.689323, 0.605321, 0.038464, -0.108124, -0.306363, -0.206513, -0.63624, -0.363972, 0.465547, -0.0749644, -0.138914, 0.793294, 0.28715, 0.709719, -0.214446, -0.467406, -0.158538, -0.318472, -0.4843, -0.527233, 0.724855, 0.406336, -0.767474, -0.402103, -0.015439, 0.245956, 0.553596, -0.934809, -0.031591, 0.627398, 0.427497, 0.219083, 0.289842, -0.506992, 0.27553, -0.904781, 0.741738, 0.32262, -0.619071, 0.116203, 0.493921, -0.30941, -0.787608, 0.418579, 0.507995, 0.192462, 0.0343094, -0.511656, 0.896984, -0.0179963, 0.677722, -0.381652, -0.217444, -0.545388, -0.0652521, 0.35552, 0.44338, 0.930981, -0.966074, 0.046355, 0.50509, -0.630214, -0.178099, -0.99148, -0.565227, -0.406139, 0.618518, -0.843621, 0.0690031, -0.719864, 0.0924841, 0.548263, -0.137437, -0.528511, -0.6958, -0.878468, 0.52687, -0.0925419, -0.448065, -0.931478, 0.294825, 0.461704, 0.322411, -0.226444, 0.522441, 0.177936, -0.179141, 0.063567, -0.526343, -0.00481426, -0.928039, 0.44626, -0.611981, 0.50673, -0.401813, -0.749078, -0.260428, -0.846317, 0.978351, 0.876742, 0.562632, -0.108055, -0.40938, 0.703469, 0.41535, -0.883953, -0.352183, -0.0126064, 0.00471859, 0.70348, 0.52212, -0.65762, -0.485396, 0.903003, -0.344389, -0.0283427, -0.196027, 0.19797, 0.198574, -0.676429, -0.985969, -0.847026, 0.365885, 0.0969134, 0.745186, 0.80956, -0.945753, 0.961778, -0.720704, 0.960946, -0.115246, -0.59948, 0.173703, 0.288285, 0.157828, 0.416609, 0.395574, -0.665211, 0.436032, -0.516318, 0.224396, 0.913507, 0.565076, -0.857874, 0.264629, -0.710301, 0.745723, -0.598454, 0.249294, -0.219725, -0.796572, 0.775523, -0.679746, 0.930678, -0.153406, -0.253253, -0.558822, -0.729017, -0.836353, 0.741903, -0.101526, -0.824315, 0.240202, -0.409943, 0.786181, 0.716957, 0.0392309, 0.859448, -0.887188, 0.680313, -0.662116, 0.219454, 0.104326, 0.804638, 0.853989, -0.714186, 0.803566, -0.583954, 0.540364, 0.876862, 0.0777572, 0.157148, 0.718143, 0.126927, 0.260561, -0.0856841, -0.477815, 0.318343, -0.674036, -0.842853, -0.0496943, 0.882626, -0.960595, -0.664507, 0.0217668, 0.432156, 0.886136, 0.810847, 0.991845, -0.238606, -0.490713, -0.209863, -0.130359, 0.408454, 0.788595, 0.957891, -0.660725, -0.954871, -0.862815, 0.000579136, 0.289733, -0.14896, 0.162717, -0.311951, 0.212844, 0.198146, -0.253219, 0.266678, -0.674319, -0.351965, -0.451692, -0.219839, 0.585461, -0.764371, 0.155318, -0.941192, -0.415884, 0.791264, -0.760146, 0.817179, -0.831473, 0.769808, 0.851178, 0.888298, -0.400909, 0.708919, 0.25941, 0.494249, -0.975306, -0.544741, -0.331709, 0.569411, -0.067173, -0.179977, -0.511989, -0.732538, 0.566535, -0.322106, -0.496835, -0.144843, -0.227018, 0.912952, -0.636797, 0.546097, 0.797294, -0.0504606, 0.77994, 0.818202, 0.859256, -0.0629436, -0.719529, -0.0273505, -0.642748, 0.714464, 0.0239048, -0.117574, 0.652514, -0.946215, 0.0637963, -0.592973, -0.575901, -0.864819, -0.546478, 0.654078, -0.882756, 0.892307, 0.371174, 0.4328, 0.837562, 0.602433, 0.200019, 0.0329208, 0.620226, 0.464299, -0.576397, -0.934512, 0.532082, 0.107861, -0.355438, -0.827194, 0.00895723, -0.46796, -0.932181, -0.727253, -0.0486313, -0.651385, 0.00516929, -0.473648, -0.331351, -0.841575, 0.340898, -0.418216, 0.152589, -0.137751, -0.357414, 0.0500771, -0.226563, -0.451626, 0.229929, 0.418811, -0.329611, 0.661218, -0.0929275, 0.900198, -0.593965, -0.25862, 0.286436, -0.49896, 0.124957, 0.646247, 0.858234, 0.424607, 0.619419, -0.364916, 0.847241, 0.0722768, -0.316933, 0.117248, 0.165839, 0.935586, -0.383988, -0.462441, 0.239436, 0.164402, -0.201686, 0.516355, 0.513391, 0.175215, 0.250382, -0.74601, 0.22832, -0.181795, 0.830958, -0.259914, -0.044254, -0.143747, -0.300392, -0.211195, -0.535585, 0.530397, 0.333309, 0.680981, -0.119192, -0.270984, 0.0359683, 0.976509, -0.959449, -0.0359056, -0.16264, 0.892465, -0.365185, 0.487148, -0.610844, -0.990462, -0.395261, 0.127379, 0.688427, 0.730365, 0.424877, 0.657148, 0.837174, 0.872223, 0.152719, -0.65149, -0.956247, 0.369771, 0.0885888, 0.488545, 0.524579, 0.966372, -0.354721, -0.209568, -0.980007, -0.341276, 0.279167, 0.599703, -0.324675, 0.91899, -0.983541, -0.283658, -0.0113831, 0.291058, 0.618668, -0.00310681, -0.703799, -0.643805, 0.0555465, -0.0505903, 0.39919, -0.870016, -0.257247, 0.256174, -0.707571, -0.351732, -0.79715, -0.229967, 0.857065, 0.209595, 0.229991, -0.295991, 0.338359, 0.283447, -0.34715, -0.7671, 0.610857, 0.450843, -0.284133, 0.665294, -0.828386, -0.241867, 0.259284, -0.887645, -0.453407, -0.960165, -0.392311, 0.336069, -0.469174, -0.311754, -0.606289, -0.547274, 0.846386, -0.389885, -0.41603, -0.744231, 0.35268, -0.0365241, 0.422231, 0.105672, -0.948327, -0.14082, -0.16383, 0.655859, -0.839614, -0.493649, -0.809746, 0.460806, -0.664198, -0.260229, 0.379908, -0.370053, -0.701258, -0.770917, -0.904631, -0.663972, -0.952369, -0.710605, -0.0485221, -0.485294, -0.812687, -0.255029, 0.610903, 0.588407, -0.567654, -0.52859, 0.774079, -0.487643, 0.220268, 0.916412, -0.0655696, 0.737462, -0.449097, 0.879392, 0.901359, 0.134066, -0.957979, 0.800511, 0.875692, -0.451051, -0.83119, -0.851246, 0.57332, 0.733339, 0.978659, -0.243996, -0.279761, 0.90641, -0.259357, -0.268364, -0.417494, 0.997733, 0.115418, -0.784282, -0.793438, -0.0953629, 0.000179224, 0.750257, -0.851289, 0.75345, -0.973721, 0.965231, -0.629924, -0.989849, 0.596378, 0.798198, -0.977987, 0.877887, 0.947472, -0.0147237, 0.877294, 0.313471, 0.898241, -0.585575, 0.409545, -0.0854562, 0.505083, 0.976967, 0.449488, 0.824997, 0.500861, 0.677816, -0.492135, -0.967294, 0.69726, 0.877907, -0.451143, -0.967923, -0.089522, 0.121917, 0.661495, 0.845442, -0.529864, -0.103807, 0.694305, 0.532514, -0.701319, -0.398097, 0.185696, -0.0627023, -0.66395, -0.346097, -0.846728, 0.139665, -0.16553, -0.145776, -0.733958, 0.320697, 0.874869, -0.327132, -0.106986, 0.819988, -0.734597, -0.332469, -0.108007, 0.165951, 0.882957, 0.0193867, -0.0792705, 0.226754, 0.471634, -0.770225, -0.669587, 0.591302, 0.347268, 0.603363, 0.5406, -0.277916, -0.477288, -0.705608, -0.0444436, 0.0245331, 0.12205, 0.489479, -0.805789, 0.453981, 0.527146, 0.835124, -0.771284, 0.679076, 0.226404, 0.688799, 0.37841, -0.187358, 0.487335, 0.361056, -0.715152, 0.854162, 0.173625, 0.948616, 0.711711, -0.85523, -0.707018, 0.100796, -0.0685775, 0.7625, -0.196712, -0.849079, 0.616613, 0.347352, -0.240331, -0.0729829, 0.567598, 0.84764, 0.488372, -0.701929, -0.198556, 0.703644, 0.925112, 0.699405, -0.872336, 0.191538, -0.337552, 0.0167566, -0.669307, 0.0613406, 0.0392129, -0.33919, 0.326062, -0.643516, -0.685252, -0.556649, -0.595636, -0.886645, 0.660927, -0.30097, 0.398932, 0.589086, 0.403033, -0.677177, -0.717231, 0.273193, -0.902889, 0.818472, -0.601432, 0.531016, -0.883461, 0.481776, -0.719414, 0.0403839, -0.0887782, 0.480301, -0.603945, 0.988137, -0.401284, -0.24162, -0.344778, 0.032222, 0.200014, -0.949002, 0.794872, -0.0783236, -0.193526, -0.402453, 0.228683, 0.0689759, -0.980283, 0.854543, 0.641118, -0.482588, -0.694024, -0.982327, -0.87365, 0.919419, 0.186011, 0.806254, 0.0367569, -0.0409282, 0.722071, 0.59387, -0.816592, -0.143956, -0.328626, 0.220852, 0.310231, -0.618073, 0.368802, 0.864574, -0.270358, -0.0373982, -0.844834, 0.00188037, 0.948001, 0.756785, 0.69824, -0.0794607, -0.0552335, -0.955797, -0.0286978, 0.264425, 0.361231, 0.710084, -0.231202, -0.534844, -0.336566, -0.889099, 0.979006, -0.86793, 0.673121, -0.541644, -0.489041, -0.910712, -0.684094, -0.220304, 0.567868, 0.227069, 0.00147342, -0.186931, 0.951529, -0.661684, -0.589485, -0.336566, -0.455671, -0.0957744, -0.159125, 0.948344, -0.00885935, -0.948024, 0.339687, 0.448665, -0.395226, 0.132884, -0.258947, -0.689559, 0.279936, 0.342546, 0.0327072, 0.729599, -0.233693, 0.90497, -0.334502, -0.994099, -0.987457, 0.760715, -0.533124, 0.725871, 0.604499, -0.915133, 0.629607, 0.722933, 0.59884, 0.532748, -0.0619179, 0.453986, 0.795342, -0.714348, -0.444335, -0.37281, 0.836785, 0.321985, 0.815779, 0.965573, -0.277619, 0.600591, -0.397827, 0.794551, -0.711303, 0.670926, 0.937449, 0.90203, 0.586497, -0.931165, 0.568417, -0.183042, 0.61513, -0.641104, 0.626202, 0.376933, 0.740583, 0.278718, -0.582503, 0.853573, 0.352582, 0.381918, 0.50113, 0.0739384, 0.225814, -0.273284, -0.53861, -0.840335, -0.0723117, -0.920595, -0.723617, -0.238058, -0.335202, 0.503039, -0.275923, -0.447121, -0.672482, 0.94779, -0.614633, 0.543377, 0.952525, -0.263207, 0.396009, -0.968123, 0.534608, -0.185126, 0.71122, -0.134282, 0.867008, -0.216022, 0.147435, -0.955464, -0.338694, 0.93758, 0.31816, 0.936677, 0.877558, 0.792571, 0.804171, 0.131579, -0.0503654, 0.211489, -0.702923, -0.134069, 0.0108519, -0.466554, 0.414557, -0.645608, -0.737962, 0.949066, 0.469679, -0.00404794, 0.358024, -0.257513, 0.215012, -0.84252, 0.334436, 0.761831, -0.624212, -0.542149, 0.606246, 0.753793, 0.0649757, 0.955427, 0.176975, -0.8705, 0.170889, 0.0995017, -0.408668, -0.80212, 0.977298, -0.713899, 0.13535, 0.850306, -0.982979, -0.684487, 0.117791, -0.0719013, -0.360635, -0.557323, -0.697293, 0.774996, -0.332687, 0.551622, -0.460301, -0.864196, 0.99607, 0.119305, -0.372079, -0.190823, 0.818274, -0.3431, -0.0790215, -0.333884, -0.472338, -0.923781, 0.287761, -0.537182, 0.559122, 0.724002, 0.546818, 0.0773245, 0.120861, 0.851617, 0.570689, -0.186028, -0.326273, -0.213852, 0.56256, -0.682806, -0.875771, 0.514648, -0.931823, 0.605011, -0.810967, 0.0775615, 0.526665, 0.801859, -0.146302, -0.163387, -0.661624, -0.0621769, 0.94888, 0.811681, 0.906076, 0.596208, -0.945, -0.421884, 0.435963, -0.977289, 0.239332, -0.887434, -0.426608, -0.597787, -0.95994, 0.323574, -0.586574, -0.11267, 0.356794, -0.211721, 0.709465, 0.865294, 0.451937, 0.257126, 0.137538, -0.000163874, 0.353067, -0.175762, 0.213518, 0.920991, 0.0478756, 0.755305, 0.724337, -0.472867, 0.829419, -0.498929, -0.197875, 0.588333, -0.151635, 0.907688, 0.746035, 0.941629, 0.0057874, 0.0784359, 0.937956, 0.151895, -0.146382, -0.251741, -0.586204, -0.0372649, -0.401338, -0.399815, 0.307895, 0.557448, -0.690237, 0.703585, 0.876032, 0.570516, -0.855765, 0.731912, -0.455907, -0.0539028, -0.315077, -0.371391, -0.483442, -0.15146, -0.202954, 0.0215271, 0.776312, -0.357448, 0.366298, 0.310663, -0.785743, 0.141343, -0.31198, -0.0131657, 0.563936, 0.86139, -0.953464, -0.278456, 0.917084, -0.768357, -0.561926, 0.664578, -0.220383, 0.508804, -0.515892, 0.0876277, -0.169287, 0.645624, 0.524576, -0.0238528, 0.180494, 0.895308, 0.570229, -0.50389, -0.59022, 0.493306, -0.939042, -0.147853, 0.459749, -0.482889, -0.274347, 0.563172, 0.612386, 0.854712, 0.333949, -0.856891, -0.649035, 0.61475, 0.466293, 0.976065, -0.408384, -0.454157, -0.769484, 0.40117, -0.232598, 0.399019, -0.0265258, -0.768322, 0.449459, 0.417632, 0.840686, 0.0651427, -0.228591, -0.183538, -0.0793143, 0.140828, 0.789152, 0.405182, -0.409567, 0.659012, 0.443754, -0.462291, 0.329047, -0.558542, -0.0717318, 0.113415, -0.353278, -0.220019, -0.897005, 0.990837, -0.529533, 0.735065, 0.535474, -0.646873, -0.991324, 0.211105, -0.891361, -0.387719, -0.662396, -0.755296, 0.336071, -0.477346, -0.610892, 0.36586, -0.635219, 0.00122121, 0.649162, -0.760938, -0.109473, 0.921922, 0.125939, -0.953882, 0.495872, -0.0405903, -0.239737, -0.131349, -0.735941, 0.370442, -0.0214258, -0.777471, -0.617703, 0.698841, 0.0846605, 0.11194, -0.963683, -0.14663, 0.88966, 0.601084, 0.656325, 0.555567, -0.0556361, 0.267304, 0.76271, 0.734673, -0.876204, -0.976731, -0.657257, 0.722105, 0.920722, -0.577349, -0.572042, 0.844364, 0.990324, 0.743157, 0.00103431, -0.989325, 0.843813, 0.510211, -0.840102, 0.631754, -0.4895, 0.309309, 0.150886, -0.0522456, -0.993217, -0.208131, 0.353318, -0.636407, -0.951659, 0.0368115, -0.999881, 0.867302, -0.177859, -0.526468, -0.436473, 0.0330398, -0.964476, 0.233284, 0.0343915, -0.363942, -0.96852, 0.444849, 0.301878, 0.099042, -0.219141, -0.659109, -0.88577, 0.147723, -0.616308, 0.845903, -0.255575, -0.424613, 0.149876, 0.430674, 0.789986, -0.12963, 0.237039, 0.713667, 0.482916, -0.0319217, -0.524567, -0.804594, 0.580956, -0.832651, 0.796657, -0.262677, -0.82021, -0.0268613, -0.777034, 0.188693, -0.601127, 0.586867, -0.481635, -0.0363378, 0.120577, -0.600502, -0.820077, 0.197349, 0.480882, -0.981754, -0.0912541, -0.140294, -0.455726, 0.984303, -0.0700459, -0.749336, 0.612436, 0.409992, 0.559882, -0.361885, 0.185288, 0.00548355, -0.990295, -0.409615, 0.683457, 0.892071, 0.549569, -0.429457, -0.414843, -0.625648, 0.00339887, -0.519394, -0.0327173, -0.802873, 0.629559, -0.964885, -0.519754, 0.172483, -0.881368, -0.169272, 0.593285, -0.158778, -0.772606, -0.144569, -0.735695, 0.874101, 0.871692, 0.790855, 0.922163, 0.824608, 0.768707, 0.127625, 0.0760376, -0.917792, -0.734783, -0.113052, -0.63798, 0.933785, -0.320343, -0.721563, 0.339738, -0.533113, -0.00935394, -0.0426423, -0.941614, 0.167961, 0.786846, -0.752446, -0.860045, -0.589718, 0.531893, 0.947941, 0.78888, -0.414732, 0.815733, 0.433253, -0.035103, 0.0802921, -0.0366456, -0.0226764, -0.332572, 0.282466, 0.0661276, 0.70407, -0.610748, -0.0382717, 0.316683, -0.905041, -0.481754, -0.24619, 0.190721, -0.344035, 0.936303, -0.993187, -0.499152, -0.782804, 0.329352, -0.873262, -0.567645, 0.461795, 0.032466, -0.423222, -0.270987, -0.962415, 0.982904, 0.82565, -0.595822, 0.186617, 0.690407, 0.64335, 0.123034, -0.282138, 0.342418, 0.598096, -0.197571, -0.2779, -0.883555, -0.0638266, -0.912257, -0.344109, -0.392446, 0.471315, 0.742895, -0.425734, 0.166984, -0.107321, 0.788558, -0.627546, -0.600499, -0.175551, -0.798803, 0.993389, 0.903367, -0.191618, 0.459487, 0.0415633, -0.855702, 0.505648, -0.401723, -0.431289, -0.152039, -0.869274, 0.60133, 0.560692, 0.743757, -0.8015, -0.321543, -0.324852, 0.944135, -0.630112, 0.667858, 0.128175, -0.342726, 0.0271843, 0.553433, 0.309092, -0.870669, -0.923744, 0.823239, 0.577018, 0.377669, -0.494229, -0.829759, 0.578806, 0.775518, 0.88915, -0.437708, 0.241214, 0.322411, -0.418976, 0.65548, 0.443422, -0.169181, 0.020463, -0.540367, -0.598431, 0.739302, 0.882333, -0.576978, -0.650054, 0.300876, 0.232031, 0.453982, -0.585624, -0.20935, -0.979934, -0.692308, 0.794921, -0.806961, 0.266365, 0.285364, -0.957342, 0.424882, -0.456201, -0.560516, 0.823543, -0.763731, 0.73363, 0.266501, 0.309897, 0.104865, 0.0233299, 0.239999, 0.100831, -0.421796, 0.87047, 0.60104, -0.607001, 0.28726, -0.708595, -0.539101, -0.350924, 0.276466, 0.0911479, 0.997602, -0.149833, -0.486495, 0.913495, -0.0523281, -0.505965, -0.0383562, -0.378116, -0.700758, 0.189807, -0.791416, -0.987438, 0.355506, -0.816613, -0.413606, -0.999869, 0.487566, 0.262212, 0.284275, -0.685885, 0.902398, 0.862008, -0.651237, -0.309729, 0.918376, -0.122756, 0.132143, 0.499625, -0.821147, 0.834326, -0.603486, -0.161199, -0.926308, 0.968217, 0.714729, 0.66047, -0.513577, -0.920404, 0.465151, -0.414971, -0.628853, 0.983645, 0.409766, -0.723915, -0.86474, 0.611039, -0.141713, 0.053157, -0.484055, -0.537295, 0.757524, -0.754779, -0.0196327, 0.527872, -0.922985, 0.071609, -0.0140073, -0.795045, -0.783106, -0.466205, 0.948687, -0.0375058, 0.825721, -0.161576, 0.434936, 0.692834, 0.0511626, 0.29276, 0.955862, -0.798832, -0.92922, 0.406544, 0.408193, 0.398025, 0.588407, 0.823045, -0.701293, 0.773916, -0.981488, 0.138097, -0.449725, 0.181047, 0.0200112, 0.552239, -0.711315, 0.485184, -0.775711, -0.978269, 0.907695, 0.760076, -0.0873471, 0.190788, 0.677781, -0.209213, -0.476895, -0.509567, -0.452151, 0.432258, 0.769189, -0.0249432, -0.575897, 0.497506, 0.63545, 0.574477, 0.510478, -0.280812, -0.680608, 0.809043, -0.576143, -0.97952, 0.05869, -0.6256, -0.279279, -0.74793, -0.691857, -0.545132, 0.81953, -0.203637, -0.61019, -0.949664, 0.567992, -0.599218, 0.693482, -0.48646, -0.114365, 0.286406, 0.231, 0.551202, 0.533078, 0.244642, 0.290715, -0.847445, 0.607902, -0.778791, 0.408126, -0.69712, -0.968017, -0.130668, -0.106129, 0.28823, 0.601129, -0.983374, 0.684791, 0.47298, -0.885253, -0.865196, -0.539423, 0.0956423, 0.206333, -0.0911992, 0.527342, 0.0461945, 0.56466, 0.49915, -0.337737, -0.529887, -0.479807, -0.679635, -0.572013, 0.0778775, 0.747073, 0.147185, -0.269668, 0.974731, 0.102096, 0.748301, 0.73086, -0.382389, 0.683334, 0.32991, 0.842745, 0.0157247, 0.833145, -0.350455, 0.381339, 0.687729, -0.592996, -0.56187, 0.396334, 0.672222, -0.500109, -0.28021, -0.643338, 0.142322, -0.296071, -0.413254, -0.592723, -0.630051, 0.130664, -0.128591, 0.422495, 0.949249, 0.955227, -0.852846, -0.983108, -0.564654, -0.805402, -0.483512, -0.474319, 5.049e-05, -0.172551, 0.407164, -0.24851, -0.634624, 0.489498, 0.216898, -0.614807, 0.814876, -0.575376, 0.00384345, 0.532207, 0.232045, -0.439374, 0.251339, 0.606455, -0.135202, -0.373475, -0.227541, -0.77091, 0.626587, 0.57019, -0.527482, 0.812267, -0.597671, -0.0582229, 0.864318, 0.296699, -0.437099, 0.473125, -0.739651, 0.0303735, -0.324683, 0.592265, -0.748948, 0.641182, 0.79049, -0.729681, 0.334289, -0.507502, 0.922083, -0.283194, 0.563465, -0.392088, 0.989069, 0.896003, -0.623111, 0.221195, -0.363015, 0.51246, 0.841032, -0.592077, 0.193874, -0.578561, -0.251524, 0.83111, -0.217761, -0.778684, 0.344781, -0.900773, -0.890368, 0.671481, -0.966364, -0.22571, -0.376397, 0.589632, -0.859986, 0.291772, 0.43013, 0.831648, 0.00344739, -0.130507, -0.284729, -0.769307, -0.857831, -0.075634, -0.600087, -0.979345, 0.294103, 0.978125, 0.648991, -0.260528, -0.340324, 0.182733, -0.583181, -0.204086, -0.297111, -0.283629, -0.635372, -0.895917, 0.307186, -0.4878, -0.100835, -0.554943, -0.547622, -0.638275, 0.813311, 0.927586, -0.444641, -0.389211, 0.229383, -0.918872, 0.6574, -0.996577, -0.315765, -0.412273, -0.303346, -0.373959, 0.340095, -0.761758, -0.530173, 0.236856, 0.012715, -0.380548, -0.888341, -0.557057, -0.0151179, -0.823227, 0.863018, 0.268618, -0.288489, -0.979732, 0.0196549, -0.235911, -0.134212, -0.924914, 0.234283, 0.24867, -0.697611, 0.267309, 0.0738901, 0.628418, -0.352695, 0.737653, 0.315879, 0.15293, -0.975718, 0.749142, -0.197783, 0.203264, 0.161241, -0.0183835, -0.963777, -0.381879, 0.0892166, 0.66132, -0.707159, -0.409016, -0.0289214, 0.50858, 0.323, 0.414079, 0.50434, -0.520631, 0.924021, -0.768613, 0.353367, -0.361077, -0.937937, 0.42036, 0.433365, -0.886513, -0.317769, -0.762387, 0.556347, -0.780475, 0.527222, 0.641248, -0.186746, -0.13879, 0.549149, -0.898765, -0.660846, -0.640398, 0.417457, 0.14388, 0.941599, -0.100666, -0.767475, -0.345444, -0.504812, 0.14953, 0.732883, 0.999178, 0.183765, -0.442294, -0.582892, 0.155335, 0.241902, -0.712809, -0.185904, 0.843884, -0.782628, 0.090645, 0.358287, 0.711636, 0.808301, -0.79891, 0.614625, 0.566894, -0.738835, -0.287374, -0.433877, -0.352996, -0.466614, 0.567152, 0.814723, -0.681348, -0.972337, 0.598876, 0.489914, -0.35393, -0.284424, 0.56776, 0.322939, -0.976071, -0.150161, 0.907732, 0.158308, -0.419458, 0.755342, 0.608236, -0.424966, 0.0481239, 0.494951, 0.763687, 0.855063, -0.0298649, 0.114302, 0.914706, -0.736576, -0.528851, -0.405849, -0.714001, -0.586727, -0.479372, -0.270444, 0.341264, -0.78007, -0.356723, 0.436605, -0.309172, 0.297048, 0.737201, 0.284997, 0.0656963, -0.826555, 0.387398, -0.565932, -0.289712, 0.771031, 0.640789, 0.698677, -0.211818, 0.819002, 0.833005, 0.712506, 0.7236, 0.299469, 0.0470596, 0.19896, -0.734217, -0.91201, 0.794021, -0.565372, 0.0781134, 0.258017, 0.269524, -0.758371, 0.483786, -0.556308, -0.248343, -0.723236, -0.21942, -0.806984, -0.409354, 0.403786, 0.929293, 0.950451, -0.167511, 0.708191, -0.407544, 0.6487, -0.846582, -0.0310618, -0.927894, -0.740507, 0.248446, 0.621646, 0.634503, -0.552658, -0.762541, 0.255889, 0.654737, -0.401607, -0.799474, -0.605758, -0.676744, -0.260348, 0.696809, -0.84415, 0.113673, 0.594266, -0.853742, -0.372003, -0.78262, -0.464208, 0.783839, -0.871664, -0.489912, -0.933868, 0.439568, 0.909499, 0.615, 0.225014, 0.956725, -0.0230682, -0.783013, 0.579632, -0.872457, 0.700921, 0.236512, -0.357007, -0.471193, 0.404763, 0.451514, 0.574227, 0.897387, -0.28899, -0.490759, 0.719834, -0.252378, -0.672872, -0.128875, -0.0540651, 0.316169, -0.122332, 0.661287, -0.513623, 0.0270034, -0.125633, -0.758224, 0.405869, -0.506627, -0.168925, -0.49678, 0.355294, 0.900868, -0.422633, 0.457975, 0.812498, -0.0227477, -0.0254443, -0.608234, 0.910512, 0.325197, -0.825616, 0.553122, 0.578686, -0.326824, 0.36044, -0.915649, 0.974796, -0.272336, -0.956508, 0.399908, -0.791884, -0.987127, 0.729203, 0.306953, 0.626854, -0.742612, 0.50127, -0.818433, 0.805083, -0.412485, 0.53787, -0.408611, -0.834387, 0.838747, -0.355335, 0.870439, -0.153881, -0.247034, 0.293933, -0.257247, 0.0924413, -0.0217425, -0.887169, -0.105316, -0.311912, -0.342039, -0.449518, 0.934867, -0.913419, 0.0393418, -0.0409765, 0.564832, -0.616987, 0.571184, 0.0749796, 0.965798, 0.0260796, -0.864657, 0.503072, 0.760878, 0.833875, 0.459269, 0.0418148, -0.637808, 0.362338, -0.336666, 0.950191, 0.0777735, -0.941245, 0.458202, 0.89878, 0.179659, -0.538546, 0.56572, -0.751693, -0.299872, -0.862716, -0.406885, -0.603943, -0.596552, 0.743601, -0.118176, -0.656019, 0.237387, 0.106039, -0.230205, 0.525134, 0.885388, 0.772187, 0.191984, 0.875203, 0.359168, -0.0824169, 0.770554, -0.354337, -0.599961, -0.326925, 0.83939, 0.707763, 0.0524637, -0.745858, -0.44902, 0.288061, -0.279791, 0.699813, -0.0695005, 0.565238, -0.935482, -0.582746, -0.685929, -0.736691, -0.739166, 0.967246, 0.250705, -0.567222, 0.210466, -0.214068, -0.812894, 0.884979, 0.661149, 0.537461, 0.550683, -0.769202, -0.999866, 0.555467, 0.674596, 0.923491, 0.598372, 0.0981966, 0.107994, -0.518028, 0.496533, 0.753908, 0.0231507, -0.51234, 0.245048, 0.948171, -0.335906, 0.854958, 0.568919, 0.530984, 0.253763, 0.270134, -0.211388, 0.522687, 0.461381, 0.224942, 0.24567, 0.0337249, -0.527829, 0.246926, -0.638094, 0.85582, -0.115266, -0.571546, -0.535783, 0.675112, -0.035235, -0.468012, -0.666643, -0.719809, 0.923719, 0.710062, -0.785881, -0.573906, -0.121278, -0.260556, -0.511105, -0.756034, -0.680801, -0.432513, 0.199165, -0.0938866, -0.360736, -0.259227, 0.141534, 0.700908, -0.845262, -0.00997379, 0.596331, 0.381036, 0.743319, 0.351753, -0.664337, -0.649616, 0.736401, -0.935091, -0.135724, -0.190601, -0.0271747, -0.145013, -0.0677904, 0.0361351, -0.373206, -0.283756, -0.309823, 0.602612, 0.821623, -0.959004, -0.839044, -0.449461, -0.789473, 0.206637, -0.390246, 0.921085, 0.245886, -0.647447, 0.624413, -0.313296, -0.524275, -0.53734, 0.338247, 0.176758, -0.643467, 0.0832417, -0.86919, -0.187482, -0.61299, -0.919332, 0.775988, 0.314751, -0.897676, -0.567968, 0.913072, 0.745001, -0.191478, 0.116173, -0.199614, 0.516085, -0.672368, -0.39458, -0.611198, 0.345609, -0.816747, 0.0473011, -0.505686, -0.409464, -0.279073, 0.246033, 0.885152, -0.83392, -0.143627, -0.352737, -0.840991, 0.53805, 0.00162455, 0.0970293, 0.378918, -0.488417, -0.367958, 0.82957, 0.604727, -0.712764, -0.416998, 0.304688, -0.161976, -0.354762, 0.139183, 0.780077, -0.0260892, -0.374408, -0.693981, -0.318773, -0.0704703, -0.19454, 0.0361968, -0.689243, -0.821613, -0.356651, -0.6529, 0.0239753, -0.809657, -0.891391, -0.687006, 0.252116, -0.578779, 0.771776, 0.60254, 0.928217, -0.0707567, 0.642204, -0.594141, -0.441769, -0.189866, -0.690142, 0.273341, -0.842888, -0.465364, -0.460185, -0.2091, 0.826127, -0.964536, -0.437988, -0.604879, -0.432025, 0.793802, -0.459012, 0.727115, -0.90006, 0.229754, 0.12073, -0.542071, -0.798652, 0.182749, -0.362086, 0.92961, -0.337969, -0.35992, 0.0173085, -0.691666, -0.953208, 0.125845, 0.302216, -0.728431, -0.209893, 0.989936, -0.11534, -0.823726, -0.320251, 0.783129, -0.263911, -0.410142, 0.824771, -0.645182, 0.279605, -0.516107, -0.259655, -0.614742, 0.29445, -0.799594, 0.378001, -0.12921, -0.628289, 0.430472, 0.0996162, -0.984491, 0.799873, -0.203336, 0.0617333, -0.78694, -0.612173, -0.777738, 0.360124, -0.964339, -0.909363, -0.901094, 0.320428, 0.316113, 0.719717, 0.319351, -0.301156, 0.545813, 0.352344, 0.761139, 0.2551, -0.803672, -0.770314, 0.13211, -0.17369, 0.904503, -0.652969, 0.0865809, -0.823616, 0.517631, -0.803725, -0.652681, -0.930152, 0.970251, 0.610709, -0.980265, 0.576978, -0.908731, -0.774895, 0.591548, 0.937832, 0.718841, -0.0394589, -0.907252, 0.14274, 0.0763367, 0.956401, -0.489553, 0.702467, -0.368781, 0.219555, 0.115192, -0.557325, -0.23596, 0.442709, 0.663861, 0.426481, 0.050929, 0.591334, 0.686939, 0.612179, 0.919484, -0.958351, -0.347013, -0.0480074, -0.000654282, 0.216338, 0.166566, 0.577516, 0.197944, 0.633205, 0.447478, 0.812305, -0.813174, 0.526339, 0.759521, -0.591452, -0.942685, -0.425712, -0.49133, 0.726695, 0.332949, 0.421711, 0.578961, 0.286336, 0.622854, 0.644112, 0.436226, 0.835641, -0.255114, -0.766601, 0.200924, 0.0454567, 0.33199, 0.317688, 0.686931, -0.764836, -0.794687, 0.128964, -0.612092, 0.972819, -0.2628, -0.129133, -0.273326, -0.383348, 0.578275, 0.70135, 0.986769, 0.288714, 0.851954, 0.616102, -0.653056, 0.7109, 0.599042, -0.529733, -0.5009, -0.887002, 0.857497, 0.519248, 0.221058, -0.259084, -0.928836, -0.734735, -0.366365, 0.237285, 0.635199, 0.546271, 0.38707, -0.177595, 0.624409, 0.103903, -0.333973, -0.12587, -0.715973, -0.273248, 0.461969, 0.232622, 0.460564, 0.196642, -0.871848, 0.664519, -0.0240478, 0.705709, -0.301796, 0.626728, 0.059973, 0.237905, -0.775429, -0.456416, 0.178198, 0.470292, -0.675311, 0.499222, -0.825152, 0.459612, -0.120596, -0.0477649, -0.620117, 0.651774, -0.712162, -0.516632, 0.0300111, 0.184277, -0.466647, -0.511776, -0.720824, -0.568045, -0.430557, -0.45533, 0.674789, -0.92789, 0.444231, 0.424076, -0.359079, 0.153455, -0.866592, -0.109909, -0.878686, -0.925734, -0.145369, -0.768432, 0.433148, 0.867499, 0.85748},
-	{-0.0946486, -0.96315, 0.311364, 0.263449, 0.00951051, 0.353896, 0.351999, 0.408424, 0.153241, 0.274172, -0.956002, -0.334988, -0.519222, 0.643099, -0.112849, -0.938751, 0.861998, -0.462652, 0.649072, 0.835985, -0.59822, 0.628031, -0.687978, 0.0891406, 0.735093, -0.330926, -0.357422, -0.127322, 0.314383, -0.469902, 0.586451, 0.914692, -0.506859, 0.0907503, 0.0439845, 0.0643735, -0.0540448, -0.0751064, 0.0188409, -0.923107, -0.378292, 0.794378, -0.165594, 0.970657, -0.99062, 0.175516, -0.542874, -0.376999, 0.725989, -0.768485, 0.659667, 0.455085, -0.506637, 0.887123, -0.112379, 0.381284, -0.336294, 0.853342, -0.293873, 0.0700063, 0.108752, 0.393819, -0.362252, 0.621941, 0.581114, 0.225854, -0.68314, -0.573615, -0.684608, 0.57653, -0.193832, -0.792146, 0.879269, -0.444309, -0.543722, -0.187827, -0.639928, 0.267478, -0.804864, -0.901604, -0.335398, -0.595405, 0.912306, 0.0904795, 0.314261, 0.472258, 0.406789, 0.551011, -0.754624, 0.831481, -0.624289, 0.261105, -0.429501, -0.590868, -0.498371, 0.0334981, 0.996778, -0.747566, -0.822443, -0.544935, -0.575127, -0.521246, -0.519048, -0.314761, -0.920519, -0.252075, -0.578073, -0.213497, -0.330662, 0.230501, 0.760794, 0.181725, 0.33905, 0.267462, -0.324734, -0.44951, -0.601376, 0.76343, -0.838266, -0.059456, 0.182584, -0.359366, -0.718956, 0.20708, -0.165873, -0.212218, -0.825851, 0.985134, -0.785904, 0.895301, -0.609027, 0.0983111, -0.578109, -0.960739, -0.850228, -0.419441, 0.389736, 0.0213204, 0.774361, -0.629208, -0.868065, 0.163713, 0.0271455, 0.0633073, 0.0107894, 0.468633, -0.010876, 0.321695, -0.572134, 0.537716, 0.267493, -0.307475, -0.343411, -0.259817, -0.424747, -0.681437, 0.244467, 0.537963, -0.235391, -0.886215, 0.827146, -0.431168, 0.678629, 0.306145, 0.616334, 0.0431762, -0.85699, 0.795245, 0.939825, -0.15234, -0.309931, 0.708925, -0.414602, 0.754536, 0.476564, -0.052927, 0.693382, -0.313209, 0.891403, 0.694723, 0.928871, -0.45542, -0.421384, 0.879744, 0.927022, -0.61788, -0.183139, 0.990763, -0.733072, 0.946846, 0.433402, 0.370254, -0.862388, -0.990312, 0.986424, 0.315252, -0.149376, 0.883348, 0.320841, 0.185147, 0.791775, -0.112231, -0.430777, -0.443035, -0.55145, 0.229004, -0.709769, 0.0280883, 0.861664, 0.683781, 0.0877556, -0.770346, -0.490636, 0.822562, -0.294815, 0.110774, -0.50541, 0.56879, -0.0609023, -0.0980676, 0.298652, -0.720418, -0.559331, 0.247661, -0.816578, 0.25348, 0.922524, -0.275728, -0.327598, -0.444358, 0.933509, 0.467327, 0.328466, 0.659933, 0.561933, 0.914344, 0.29239, -0.243457, 0.246441, 0.384984, 0.543934, -0.186506, 0.30353, 0.97093, -0.953686, 0.895503, -0.19024, -0.383509, 0.920558, -0.176495, -0.685648, -0.304083, 0.773715, -0.461851, 0.189541, 0.553207, 0.715449, -0.536948, -0.656507, -0.155143, -0.779866, -0.782282, 0.239385, -0.217351, 0.514511, -0.816556, -0.140306, 0.772865, 0.927116, -0.543433, -0.784783, -0.798361, -0.182735, -0.218139, 0.0347478, -0.67928, -0.546438, 0.861604, 0.735471, 0.456461, -0.944297, 0.43614, 0.171116, 0.279722, 0.523559, -0.750238, 0.458791, -0.991146, -0.116223, -0.0853373, 0.353266, -0.793718, 0.568893, 0.507211, 0.735941, -0.80246, 0.293313, -0.361783, 0.912154, -0.667323, -0.492984, -0.253645, 0.251191, -0.895544, 0.531768, -0.911487, -0.94235, -0.0565349, 0.606274, -0.924649, 0.831628, 0.0494684, 0.714731, -0.157923, 0.796459, 0.176797, -0.215691, -0.119507, -0.613565, -0.254647, -0.0889751, 0.505369, 0.195643, -0.356123, 0.401891, 0.518682, -0.908493, -0.821503, 0.100373, 0.0880263, 0.225128, 0.0581641, 0.91474, 0.65629, -0.94853, -0.953646, -0.159326, -0.958344, -0.659513, -0.332363, -0.823907, 0.455829, 0.890322, 0.133272, 0.293426, 0.131494, -0.367729, -0.594173, 0.975372, -0.480685, 0.53975, -0.767368, -0.765715, -0.852468, 0.7478, -0.903424, -0.368617, -0.985406, 0.0215859, 0.554557, -0.251573, -0.405742, -0.0476243, 0.281173, -0.982373, -0.433313, -0.394105, -0.35227, -0.540266, -0.360896, -0.174061, -0.21121, -0.97746, -0.0828455, -0.0820074, -0.0295057, 0.630624, -0.630466, -0.0886937, 0.496488, 0.225825, 0.655361, -0.764352, 0.684817, -0.341481, 0.435134, 0.97019, 0.150428, 0.104409, -0.380076, 0.871312, -0.0231641, 0.611281, 0.533505, -0.992351, 0.284411, -0.106772, 0.863982, -0.667574, -0.919646, 0.305792, -0.423412, -0.855348, 0.83511, 0.432117, -0.288762, 0.255261, 0.738015, -0.20322, -0.822225, -0.481939, -0.247617, 0.819976, -0.409007, 0.561433, -0.953034, -0.456642, -0.647925, 0.391009, 0.233991, -0.412355, -0.771846, -0.955677, -0.44173, -0.0190406, -0.496715, 0.257445, -0.513854, -0.192587, 0.882345, -0.0604334, -0.344011, 0.26716, -0.020234, -0.960116, -0.593316, -0.690655, 0.531978, 0.303116, 0.190727, -0.938749, 0.463417, -0.658661, -0.116577, 0.103642, 0.110417, 0.326458, -0.435015, 0.0101636, 0.774995, 0.926268, 0.384077, -0.982394, -0.760404, -0.69247, -0.926455, -0.955214, 0.296974, 0.588193, -0.940337, 0.558575, 0.345532, 0.0256992, 0.00288377, 0.939032, -0.969655, -0.536404, 0.399126, -0.349657, 0.0202705, 0.743075, -0.582919, -0.613237, 0.413503, -0.608436, -0.728907, -0.932396, 0.945192, 0.473391, 0.310453, -0.474541, -0.971384, 0.197919, 0.748844, 0.349914, -0.160071, 0.98735, 0.589956, -0.625021, -0.753752, 0.923966, 0.624603, -0.565001, -0.033302, 0.534252, -0.631517, 0.427783, -0.172704, -0.775116, 0.349278, -0.953767, -0.465894, -0.52912, 0.0179758, 0.837729, 0.245349, -0.646462, -0.548084, -0.707458, -0.288483, -0.963015, -0.0200531, -0.420074, 0.918409, 0.309104, -0.870856, -0.033929, 0.31801, 0.0214422, -0.487006, 0.314637, 0.866302, -0.250502, -0.487479, 0.727746, 0.563329, 0.0312135, 0.674387, 0.459098, -0.583956, 0.514657, 0.514506, 0.132475, 0.448561, 0.832119, -0.428789, 0.287698, 0.795202, 0.0770741, -0.63731, 0.578214, -0.328068, -0.87364, 0.835697, -0.137296, -0.4513, -0.591524, 0.392813, 0.0947434, -0.512271, -0.53985, 0.683267, 0.76772, -0.356605, -0.880201, -0.109066, 0.211911, 0.642686, 0.62317, -0.409774, 0.0160891, 0.111196, -0.0375492, -0.790254, -0.496538, 0.858359, -0.194869, -0.0145165, 0.941047, 0.359626, 0.267687, 0.411672, -0.62703, -0.00813005, 0.351246, 0.462487, -0.695868, 0.796615, -0.507388, 0.436962, -0.607634, 0.367977, -0.227336, 0.0919534, -0.663707, -0.286434, -0.636501, -0.77624, -0.702899, -0.865918, -0.622999, 0.9767, -0.585009, -0.741126, 0.696388, 0.044489, 0.788789, 0.354291, -0.935007, -0.0201564, -0.582549, -0.00697825, 0.795919, -0.415523, 0.512142, -0.929584, 0.52887, 0.0292885, 0.132259, -0.776349, -0.485504, 0.322303, 0.297372, -0.84973, -0.361931, -0.223775, -0.555779, 0.359775, 0.478515, -0.397528, -0.914848, -0.179973, 0.402264, 0.075066, -0.223247, -0.837562, 0.234371, 0.573953, -0.163185, -0.144465, 0.714471, 0.672219, -0.35807, -0.228458, 0.722589, 0.907239, 0.981038, -0.522214, 0.222383, -0.217026, 0.253905, 0.499219, -0.655967, 0.141502, 0.235937, 0.80817, 0.504299, -0.878157, 0.24096, 0.673306, -0.0760334, 0.565479, 0.692974, 0.589844, -0.219765, 0.636151, 0.912966, 0.0581291, -0.0649126, 0.229418, -0.720639, -0.400383, -0.0877073, -0.263495, -0.956598, -0.426642, -0.515942, 0.290877, 0.711649, 0.335016, -0.0475084, 0.704528, 0.37245, -0.256554, -0.126728, -0.058415, 0.351282, -0.821519, -0.388536, 0.593697, -0.254933, 0.811182, 0.268322, -0.621209, -0.165633, -0.196306, -0.29536, 0.00663073, 0.214747, 0.806349, 0.311924, 0.600939, -0.527505, -0.430393, 0.856459, -0.493894, -0.175408, -0.34089, -0.690523, -0.411826, -0.725633, -0.282164, -0.96003, -0.503524, -0.733588, -0.493379, -0.438883, -0.600598, 0.448353, 0.593211, 0.136877, -0.145187, 0.201912, -0.264945, 0.503083, -0.391677, 0.894582, 0.14473, -0.948145, -0.734723, 0.565882, 0.324021, -0.644894, -0.167682, -0.810908, -0.884206, -0.824823, -0.167476, -0.31684, -0.828889, -0.434328, -0.68284, -0.449443, 0.74185, -0.846508, 0.335619, -0.28805, 0.939554, -0.0272919, -0.785971, -0.0592411, -0.84482, -0.256746, 0.135414, 0.971225, 0.523798, 0.795276, -0.106198, 0.85025, 0.394126, -0.506083, 0.569381, -0.799504, 0.19099, 0.725856, -0.0692703, -0.679117, -0.84371, -0.480582, -0.488915, 0.282876, -0.631877, 0.308154, -0.727916, 0.0146962, -0.882085, 0.835007, 0.344772, -0.238613, -0.0959401, -0.19739, -0.734084, 0.460018, -0.829272, 0.0653624, 0.320431, -0.145342, 0.808211, 0.302786, -0.659603, 0.814845, 0.810061, -0.384073, -0.465869, -0.079873, -0.714328, 0.975556, 0.999922, -0.2504, -0.438048, -0.0339706, 0.920397, 0.578221, -0.567015, -0.85381, 0.589673, 0.765885, 0.233714, -0.748897, 0.831586, 0.0887852, -0.399223, 0.452855, -0.877594, -0.343111, 0.527949, -0.32438, -0.781292, -0.161034, 0.611791, -0.809729, 0.396833, -0.515586, -0.503133, 0.175205, -0.785374, -0.469305, 0.834434, -0.637852, -0.903743, -0.680376, 0.733932, -0.55663, -0.737289, 0.227665, -0.632083, 0.310526, -0.866436, 0.558028, 0.433318, -0.379383, 0.0613786, -0.477028, 0.435476, -0.302474, 0.73904, -0.460579, 0.275169, 0.0957275, 0.58953, -0.980651, -0.645357, 0.530336, -0.349984, -0.242746, -0.217068, -0.769043, -0.197279, -0.798487, 0.587622, -0.219305, 0.0109119, -0.959805, 0.597756, 0.96126, -0.697506, -0.911809, 0.0888071, 0.188515, 0.8964, 0.29876, -0.418421, 0.413976, 0.623705, 0.25587, 0.41077, 0.0178393, 0.491349, -0.214609, 0.811552, 0.733613, -0.804292, -0.93295, 0.384726, 0.497659, -0.406183, 0.442115, 0.863076, 0.317477, 0.531699, -0.216701, -0.5996, 0.34967, 0.681596, -0.890482, 0.579232, 0.437331, -0.717676, 0.447358, 0.529799, 0.91924, 0.0665636, 0.692966, -0.5522, 0.0646256, 0.115381, -0.105014, 0.164952, -0.24668, 0.765043, 0.344338, 0.437833, -0.532286, 0.180736, 0.71744, 0.218036, 0.423445, 0.793077, 0.163805, -0.804154, 0.33905, 0.299822, -0.180923, -0.848006, -0.97018, 0.721596, 0.909924, -0.883104, 0.520372, -0.177454, 0.580364, -0.905296, -0.241652, 0.296568, 0.900266, 0.130257, -0.872371, -0.143401, 0.487363, -0.305299, -0.677185, -0.738613, 0.784717, 0.00511808, 0.69086, -0.172416, -0.118114, -0.572615, 0.558392, 0.141125, 0.777101, 0.272369, 0.639666, -0.457267, -0.675222, 0.119957, -0.824702, -0.500415, 0.0228004, 0.70303, 0.671505, -0.436763, -0.158606, 0.966634, -0.103378, 0.583807, 0.743059, -0.711232, 0.786259, 0.966724, -0.532318, 0.854709, -0.217539, -0.349994, 0.977416, -0.901675, 0.915769, -0.698967, 0.110829, -0.103731, -0.542111, 0.905233, -0.861913, -0.690197, -0.844592, -0.112828, 0.461166, 0.583714, 0.038057, 0.357817, 0.55684, -0.334345, 0.95168, -0.759914, 0.128917, 0.00295029, 0.301546, 0.791654, -0.862855, -0.796467, 0.380758, -0.444403, -0.014097, 0.583794, 0.0112159, -0.866257, -0.123989, 0.65573, 0.050757, -0.124101, -0.11795, 0.46906, 0.90759, 0.612739, 0.595958, 0.568935, -0.248796, -0.756725, -0.0699331, -0.75554, -0.45022, 0.0586342, 0.140341, 0.92276, -0.055636, -0.248598, -0.627114, 0.361567, 0.952328, 0.137161, 0.806514, -0.13289, -0.76173, -0.363422, -0.912716, -0.931997, 0.480851, 0.0428211, 0.276117, -0.288846, -0.838057, 0.962499, -0.658722, -0.366378, 0.218249, 0.373662, 0.817421, 0.327962, 0.893624, 0.490458, -0.688556, -0.20651, 0.289468, 0.0719698, -0.0173488, -0.74009, -0.15137, 0.142923, 0.347177, -0.7145, -0.0212299, -0.879271, 0.0455981, 0.802924, -0.718121, -0.884657, -0.153489, 0.869636, -0.677759, -0.230061, 0.0585577, 0.534594, 0.79527, -0.177834, -0.900525, 0.238216, -0.485411, 0.21585, -0.064682, -0.730646, -0.444614, -0.79207, 0.809687, 0.555253, 0.229109, 0.163976, -0.572102, 0.912018, -0.230237, 0.188425, -0.723376, 0.1675, -0.334192, -0.290687, -0.8194, 0.0278404, 0.634709, -0.923912, 0.17988, -0.721573, -0.0321697, 0.424915, 0.81274, 0.0463812, -0.12618, -0.901262, -0.599777, -0.999654, -0.458561, -0.47649, 0.236877, -0.643106, -0.332808, -0.238821, 0.00730128, 0.68448, 0.81712, 0.670866, 0.510308, 0.757865, 0.318418, 0.694279, -0.882463, 0.830788, -0.372891, 0.290384, 0.853046, -0.75711, -0.9213, 0.246275, -0.800707, 0.36374, -0.744662, 0.633871, 0.808426, 0.434457, -0.952955, 0.635481, -0.664927, -0.134575, -0.0204169, 0.231568, -0.147185, -0.966259, -0.996334, 0.399287, -0.430324, 0.69006, 0.692259, 0.811072, -0.994853, 0.436056, -0.380904, -0.231069, -0.0106482, 0.252706, -0.96699, 0.080482, -0.521567, -0.960236, -0.908894, 0.15867, 0.712142, -0.0161552, -0.235359, -0.196495, 0.409571, -0.0230873, -0.0834175, -0.721491, 0.629491, -0.139595, -0.914142, -0.966697, 0.916956, -0.0951171, 0.209497, 0.573891, 0.127465, -0.439773, 0.90536, 0.469439, 0.174777, 0.827699, 0.00210141, 0.873176, 0.683009, 0.977563, 0.915996, 0.406701, -0.977159, -0.497741, 0.959489, 0.0579843, 0.337321, -0.674349, -0.970459, -0.15664, -0.574727, -0.617294, 0.724519, 0.247228, 0.916978, 0.517009, 0.449231, 0.515844, -0.217366, 0.55262, 0.0187174, 0.279177, -0.235694, 0.20027, -0.217801, 0.0661219, 0.318438, 0.566984, 0.356643, 0.310101, 0.0044821, 0.597113, -0.298844, 0.351724, 0.692948, -0.932958, 0.843548, -0.797685, -0.314205, 0.399297, -0.778809, 0.954153, 0.340189, 0.514709, -0.758098, -0.328173, 0.855541, -0.594463, -0.861591, -0.549944, 0.884466, 0.959584, 0.97278, -0.143292, -0.756094, -0.281673, -0.750147, 0.0889595, 0.0242775, -0.699649, 0.277871, 0.25707, 0.210452, -0.564366, 0.566344, -0.16347, -0.148587, 0.120093, -0.734025, 0.140752, -0.267669, -0.676095, 0.781894, 0.765, -0.566854, 0.120458, 0.403243, 0.593009, -0.828729, 0.983522, -0.965201, -0.418259, -0.934959, -0.609453, 0.110816, 0.653721, -0.572524, 0.976855, -0.50843, -0.182183, -0.744925, 0.960454, 0.832862, 0.355632, -0.327, 0.326515, 0.713467, 0.518055, -0.201066, -0.595347, -0.64867, -0.115126, -0.984932, 0.499802, -0.68153, 0.647401, 0.630866, 0.763309, 0.760973, -0.925715, 0.559753, -0.601739, 0.525986, 0.173956, 0.726007, -0.123608, 0.27334, -0.710854, -0.0407368, 0.522775, 0.626563, -0.300772, 0.245447, -0.0964789, -0.157856, -0.464634, 0.0118891, 0.101898, -0.435135, 0.812376, 0.0178222, 0.203266, -0.672711, 0.436056, -0.253946, -0.839672, -0.740072, -0.188606, -0.835543, -0.0964933, 0.096474, -0.0275763, -0.883854, -0.980858, -0.128665, 0.43822, -0.870961, 0.733177, 0.364572, 0.648012, -0.497543, 0.111231, -0.217194, 0.169756, -0.521082, -0.398741, -0.231067, 0.0447638, 0.661193, -0.626799, -0.718719, 0.793297, 0.162192, 0.239881, 0.188642, -0.0796874, -0.959217, -0.408933, 0.162481, -0.0400326, 0.567827, 0.816141, -0.155256, 0.938711, -0.34783, 0.182025, 0.60804, -0.0144803, 0.421782, -0.741615, -0.353423, -0.0667918, 0.238025, 0.445033, -0.869341, -0.494954, -0.901813, 0.41624, 0.546752, -0.151185, 0.120369, -0.0231718, 0.683334, 0.119868, 0.19311, -0.76685, -0.244452, 0.5532, 0.591065, -0.378795, -0.11937, -0.73195, 0.271021, -0.0194743, 0.367531, 0.975801, -0.59082, 0.841693, -0.794731, 0.169731, -0.956063, 0.706206, -0.552651, -0.635867, 0.382104, -0.122327, -0.958251, -0.181982, 0.0154628, -0.287315, 0.230528, -0.132244, 0.220081, 0.155156, -0.409665, -0.467184, -0.942353, -0.635289, 0.274774, -0.31964, 0.0318101, 0.494624, -0.345188, 0.15482, -0.211124, 0.879641, -0.333365, 0.23325, -0.133953, 0.77347, -0.546705, 0.391653, 0.49959, 0.58776, 0.983833, -0.995648, 0.483453, 0.921395, -0.000734848, -0.587327, -0.389557, 0.333377, -0.632882, 0.64471, 0.23516, -0.557399, 0.611189, -0.29912, 0.331617, -0.714464, 0.159065, 0.69515, 0.123423, 0.293494, 0.814759, -0.467995, -0.496352, 0.0947221, -0.10309, -0.306384, 0.972741, -0.796648, 0.64936, 0.811065, -0.886344, -0.297715, 0.934047, -0.600886, 0.588283, -0.751707, 0.845024, 0.846674, -0.432273, -0.416319, 0.722928, -0.00371751, -0.164463, 0.702568, -0.800187, -0.808285, -0.457404, -0.256133, -0.652282, -0.0107717, 0.862852, -0.95651, 0.0759665, -0.772924, 0.21177, -0.543089, 0.671725, 0.0486103, 0.417854, -0.658886, 0.406567, -0.0493441, -0.666833, -0.731956, -0.744922, 0.188774, 0.987955, -0.903033, 0.434284, 0.69427, -0.526853, -0.872097, 0.163871, 0.598455, -0.185312, -0.0322232, 0.292521, 0.390624, -0.916287, -0.997319, -0.393774, 0.295518, 0.710953, -0.674434, 0.670337, -0.784636, 0.865848, 0.0265891, 0.242761, -0.701261, 0.446597, 0.912069, 0.786701, -0.500059, 0.582563, 0.404105, 0.534465, 0.239987, -0.720594, 0.121992, -0.902867, 0.950052, -0.980564, -0.322006, 0.775937, -0.187678, -0.811603, -0.988951, -0.273096, 0.0118772, 0.146384, 0.872651, 0.664208, -0.556321, -0.217797, 0.177489, -0.301755, -0.285852, 0.510236, 0.449709, 0.697231, 0.940082, 0.357108, -0.0419919, -0.674634, -0.899103, -0.398995, -0.654259, -0.859821, 0.846805, 0.224513, 0.26218, 0.875305, -0.249551, 0.155593, 0.70144, -0.490037, -0.0809387, 0.823351, -0.370113, -0.886445, -0.043593, -0.590816, 0.278697, -0.10803, -0.555378, -0.693322, -0.443754, 0.303519, 0.50737, 0.290904, -0.198787, -0.335941, 0.100401, -0.344838, 0.0698335, -0.54389, 0.875667, -0.887287, -0.0782409, 0.345385, 0.405605, -0.13583, 0.72191, 0.852981, 0.814747, 0.246076, 0.993705, -0.493322, -0.724593, 0.307533, -0.942982, 0.611098, -0.180196, -0.915425, 0.336013, 0.656865, -0.40687, -0.411312, 0.0281982, 0.585426, 0.0939685, 0.435204, 0.217643, 0.634227, 0.178501, 0.601862, 0.269611, -0.102208, 0.156374, 0.848627, -0.460611, 0.718869, -0.541225, -0.622086, -0.438947, -0.919271, -0.200607, -0.43053, -0.741514, 0.788658, -0.757985, -0.653821, 0.284311, -0.143655, 0.141435, -0.595951, -0.198485, 0.978717, -0.123529, 0.569449, 0.715771, -0.626525, -0.609718, 0.288448, 0.518599, -0.473443, -0.728254, -0.520871, 0.637873, 0.0372211, -0.968851, 0.889567, 0.227601, -0.438107, 0.862817, -0.273747, 0.182085, -0.0878583, -0.363936, -0.632562, -0.0330802, 0.00824862, 0.801083, -0.327414, -0.313206, -0.0143689, 0.698431, 0.707595, 0.609541, 0.929551, -0.149205, 0.988727, -0.247624, -0.802863, -0.0180644, 0.223537, -0.581587, 0.648363, 0.841643, -0.121301, 0.690584, 0.0724647, 0.686234, 0.522549, -0.438045, 0.679516, -0.644712, -0.723323, -0.0814013, 0.940308, 0.0613293, -0.753426, -0.0634645, -0.0211175, -0.690829, 0.0205099, -0.514332, 0.464851, 0.991636, -0.664065, -0.205656, 0.648147, -0.370791, 0.395756, -0.388554, -0.0196292, -0.932166, 0.785547, 0.464935, -0.163536, 0.783089, -0.0710094, 0.702304, -0.276282, 0.144251, 0.831527, 0.286146, 0.423721, 0.246507, 0.931559, 0.158773, 0.0119495, -0.505841, -0.586134, 0.351319, 0.377076, 0.196608, 0.330198, 0.701419, -0.229125, 0.205114, 0.5189, -0.667762, 0.413551, -0.406378, 0.581184, 0.730743, 0.250922, -0.325377, 0.608131, -0.191505, -0.0469641, -0.0532077, -0.290728, -0.619837, -0.491902, 0.141677, -0.604902, 0.392218, -0.699907, -0.749861, -0.872008, -0.648948, 0.715615, -0.959017, -0.812293, 0.786083, 0.633068, 0.930958, -0.975965, 0.553065, -0.824275, 0.942698, -0.493843, 0.798534, 0.72072, -0.522351, -0.970656, -0.0875542, -0.231081, 0.832455, 0.757846, -0.0290854, 0.0905013, 0.151166, 0.0416626, -0.721346, 0.760042, 0.579153, 0.884698, 0.348929, -0.28293, -0.119188, 0.39009, -0.966674, -0.836762, 0.23866, 0.0932416, 0.562904, 0.777949, -0.729247, 0.521636, 0.085804, -0.357396, -0.216717, 0.307413, -0.944341, 0.112379, 0.346464, 0.382034, -0.397271, -0.714602, -0.945841, -0.343435, 0.721985, -0.208965, -0.152228, -0.19554, 0.163353, 0.569451, -0.0997359, -0.672227, 0.122842, 0.268412, -0.165248, 0.0511223, -0.444064, 0.190638, 0.813962, 0.74671, -0.143522, 0.11134, 0.0684996, -0.85318, -0.43086, 0.257209, 0.355254, 0.243659, 0.542122, -0.393714, 0.495249, 0.263365, 0.376149, 0.304495, -0.212086, 0.531228, -0.757146, -0.523727, 0.442494, -0.820083, 0.622593, -0.766032, 0.564918, 0.970228, -0.520054, -0.999657, 0.708819, -0.0658829, 0.589205, 0.359648, 0.36792, 0.0536209, -0.0904635, 0.137271, -0.374613, 0.72519, -0.0814419, -0.606765, 0.746945, 0.784011, 0.495586, 0.795399, 0.321763, 0.394361, 0.34009, 0.824648, -0.858462, 0.163786, -0.903755, -0.734986, -0.590677, 0.98942, -0.61218, -0.523312, -0.792509, -0.198129, -0.0821587, 0.910721, 0.100609, -0.901657, 0.503699, 0.958454, -0.871374, 0.78824, -0.823476, -0.241898, 0.531231, -0.284528, 0.763948, 0.702683, 0.955503, 0.601768, 0.911776, 0.278312, 0.783121, -0.67699, 0.889769, -0.0893622, -0.600139, 0.750737, -0.895383, 0.478567, -0.0392527, 0.270208, 0.794502, 0.175118, -0.723307, -0.18701, 0.0149474, -0.0384881, -0.290463, 0.23377, 0.849362, -0.238957, 0.706767, 0.40372, 0.300703, 0.717986, 0.00157896, -0.660655, 0.61636, -0.0734291, -0.865935, -0.32293, 0.894791, -0.525478, 0.659691, 0.114919, 0.54295, -0.963776, -0.295127, -0.0608983, -0.767369, 0.665637, 0.655495, 0.135272, 0.654301, 0.620739, -0.491726, -0.988684, 0.289079, -0.693998, 0.305576, -0.928177, 0.835609, 0.0615592, -0.827192, -0.792439, -0.876972, -0.19799, 0.588296, 0.583574, 0.122084, -0.323952, 0.40321, -0.954236, -0.181167, -0.69357, -0.38094, 0.177545, 0.674691, -0.780404, -0.970237, 0.69471, 0.617019, 0.194443, -0.330995, -0.80793, -0.5611, -0.767117, -0.153265, -0.536516, -0.640797, 0.627671, 0.852951, 0.925559, -0.200099, -0.0648335, -0.96287, 0.711804, -0.890449, -0.0739194, 0.85552, -0.760518, -0.362095, 0.265356, 0.930834, 0.404157, -0.00191115, 0.381091, 0.801778, 0.417122, 0.700527, -0.0201085, -0.114133, -0.407956, 0.102376, -0.206821, -0.375994, 0.359344, 0.205065, -0.357896, 0.41682, -0.966705, 0.789686, -0.156796, 0.933314, -0.428475, -0.950098, 0.651675, 0.908021, -0.105936, -0.402332, 0.733084, 0.0374378, -0.0209534, 0.125939, -0.864223, 0.0619756, 0.823202, -0.474811, 0.668895, -0.696097, 0.0608678, -0.317473, 0.20415, -0.440326, -0.280152, 0.253217, 0.878661, -0.301173, 0.309154, 0.510134, -0.29749, 0.213899, -0.294654, -0.755347, 0.222943, 0.959757, 0.251648, -0.704352, -0.122873, 0.0133078, 0.0542157, 0.715258, -0.882643, -0.235734, 0.273697, 0.670167, 0.0789477, 0.433464, 0.583965, 0.732764, -0.0981935, -0.343881, -0.294872, -0.494424, 0.201045, -0.350009, 0.983481, 0.874994, 0.238378, 0.578147, 0.504453, -0.681967, -0.585385, -0.588156, 0.95331, 0.242961, 0.899109, 0.108022, 0.392776, 0.825554, 0.109176, -0.791509, -0.192524, 0.232004, -0.757141, 0.0118314, -0.49183, -0.227596, -0.637466, 0.00994359, -0.720089, -0.393845, -0.772148, -0.1385, 0.221789, -0.282206, -0.000403733, -0.588874, -0.00249053, 0.376766, 0.867135, 0.173951, 0.127398, -0.496608, -0.559708, -0.300756, 0.412488, 0.652593, -0.842575, -0.423408, -0.0102904, -0.732736, -0.549779, 0.727148, -0.207967, 0.819418, -0.102908, 0.20234, 0.559002, -0.382601, 0.627216, 0.20451, -0.946451, -0.66186, -0.300312, -0.966451, 0.242198, 0.883187, -0.0919175, 0.159098, -0.258132, 0.965569, 0.723605, -0.600513, 0.517934, -0.297124, -0.164859, -0.209149, -0.28287, 0.576101, 0.44062, -0.164544, 0.143495, -0.0768286, 0.849508, 0.504362, -0.117863, 0.344348, 0.864719, -0.906833, 0.117869, -0.241967, 0.296263, -0.00470887, 0.043112, 0.999397, 0.745006, 0.714993, -0.505166, 0.795325, -0.34855, 0.980257, 0.518213, 0.292739, 0.314732, -0.89767, -0.878776, 0.633477, 0.929044, 0.660888, -0.603934, 0.0160321, -0.240673, 0.0160366, 0.178847, -0.639946, -0.634285, -0.910342, 0.775069, 0.764658, 0.0983364, -0.818645, -0.348865, -0.970125, -0.428383, -0.11035, 0.366714, 0.85509, -0.39591, 0.0585412, -0.031468, 0.999935, -0.433566, 0.545472, -0.0299365, 0.151581, 0.695458, 0.509835, 0.705015, 0.429227, 0.277318, -0.157201, 0.964576, -0.878408, 0.185749, 0.995202, 0.308789, -0.504949, 0.629846, -0.731947, -0.29841, 0.0544058, 0.793983, 0.629078, -0.85352, -0.559442, -0.136027, -0.468131, 0.396364, -0.272682, -0.882558, 0.872776, 0.892407, 0.0341044, -0.612491, 0.835524, 0.474227, 0.243617, -0.673806, -0.420171, -0.448156, 0.0915916, -0.673458, 0.0117303, -0.510265, -0.218196, -0.932349, 0.519734, -0.605524, -0.385525, 0.604511, -0.850278, -0.267951, 0.0322745, -0.00658582, 0.229627, -0.98616, -0.858765, 0.442028, 0.425442, -0.799771, 0.366928, -0.298821, 0.321523, -0.217146, -0.286699, -0.245559, -0.89754, -0.879354, -0.681738, 0.800006, 0.320997, -0.122184, -0.414432, 0.125442, 0.592711, -0.238656, 0.85042, -0.544345, 0.123089, 0.700749, -0.209836, -0.641485, -0.781464, -0.80078, -0.464518, 0.0373829, -0.803737, 0.573585, -0.775902, 0.388549, -0.856877, 0.907672, 0.50424, 0.870879, -0.39357, 0.0971628, -0.911067, 0.437698, -0.335882, 0.745746, 0.48031, -0.186759, -0.448393, 0.434988, -0.12628, 0.971037, -0.763412, 0.358099, 0.342333, 0.612228, 0.121641, 0.464077, -0.0339422, -0.800514, -0.797914, 0.946881, 0.901673, -0.358331, -0.144835, 0.12281, -0.786369, -0.226489, 0.706784, 0.918724, -0.876889, 0.540668, 0.854039, 0.202177, -0.930975, -0.00737545, 0.566631, -0.424187, 0.740445, 0.725466, -0.320445, -0.747967, -0.548524, -0.897438, -0.0360104, 0.979914, 0.569871, 0.460437, 0.75379, 0.903338, -0.215273, 0.199701, -0.0875583, 0.449995, -0.890081, -0.819722, 0.704473, 0.642415, -0.229567, 0.763219, -0.612452, 0.95303, 0.0300832, -0.311066, -0.834757, 0.142432, 0.280171, -0.484675, 0.266631, 0.396196, -0.0692509, -0.607805, 0.687381, 0.413471, 0.0574128, 0.932984, 0.279714, 0.531848, 0.583628, 0.917588, -0.774973, -0.959724, 0.623936, -0.634995, 0.0873493, -0.237472, -0.426711, 0.0626602, 0.581014, -0.421441, -0.673556, -0.371544, -0.571737, -0.140367, 0.957449, -0.74301, 0.329664, 0.247806, -0.590784, 0.372217, 0.799871, 0.814636, 0.850306, -0.33544, -0.146138, -0.187723, 0.777862, -0.739643, 0.471682, 0.506305, -0.245937, 0.45077, 0.415566, 0.61171, 0.195947, 0.911715, 0.584983, -0.024203, 0.511352, 0.545388, 0.931282, -0.607458, 0.0695604, -0.77317, -0.438376, -0.383939, -0.456151, 0.739461, -0.315824, 0.689392, -0.592333, 0.213921, 0.200043, 0.583983, 0.81316, 0.500138, -0.567673, -0.63385, 0.479689, 0.101049, -0.329199, 0.729523, 0.53788, 0.556064, -0.951277, 0.866148, -0.970104, 0.878615, 0.0460271, 0.366102, -0.0244811, -0.709437, 0.363218, 0.134581, 0.290421, 0.595928, 0.132865, -0.0495795, -0.1757, -0.0014543, 0.409158, -0.920056, -0.697359, -0.783878, -0.927313, 0.0326572, -0.946773, 0.571101, 0.0160487, 0.600643, -0.690135, -0.666622, 0.977438, -0.56611, -0.290982, 0.766415, -0.407554, -0.420201, 0.781403, 0.408818, -0.731929, 0.569687, -0.92027, -0.685128, -0.102198, 0.920007, 0.699318, 0.224914, 0.681357, -0.172308, -0.423913, 0.196611, -0.926794, -0.850538, 0.525609, 0.619139, -0.4493, 0.466359, -0.766476, -0.632277, 0.123547, -0.59597, -0.970709, -0.873606, -0.81442, 0.755784, -0.997124, -0.389208, 0.195101, -0.349771, -0.486422, -0.917899, 0.502289, 0.990168, -0.824801, 0.280937, -0.118038, 0.149347, -0.770177, 0.61696, 0.489078, 0.980214, -0.360264, 0.208451, 0.302757, 0.0884746, -0.912785, -0.0788599, -0.432093, 0.532738, -0.653675, -0.722319, 0.669973, -0.131526, 0.403726, -0.87793, -0.0856176, 0.235518, 0.531374, -0.0835952, 0.673489, -0.5447, 0.399327, 0.543533, -0.420965, -0.933248, -0.950783, 0.0968227, 0.725712, -0.602556, 0.319042, -0.802319, 0.623309, -0.329707, 0.86244, -0.200118, 0.768177, -0.991783, 0.891866, -0.479094, 0.647603, -0.685413, 0.08249, 0.0921809, -0.291785, -0.190616, -0.284102, 0.20253, -0.365904, 0.123038, 0.25214, 0.597895, 0.692641, -0.100162, 0.827347, 0.941708, -0.584101, -0.366383, -0.851944, 0.0219585, -0.529382, -0.354339, 0.705182, -0.624328, -0.298676, -0.868791, -0.209722, -0.954048, 0.12926, -0.0452196, 0.0572005, -0.504936, 0.477599, 0.168777, 0.63615, 0.041137, -0.097144, 0.388723, -0.521452, 0.624973, 0.699957, -0.979179, 0.336106, 0.514005, 0.992667, 0.74189, 0.106458, 0.574365, 0.43567, -0.424222, -0.336896, -0.648365, -0.7662, 0.410263, 0.59895, 0.195344, -0.686939, -0.649582, 0.254768, -0.710591, 0.376984, 0.797027, 0.397973, -0.503403, -0.0166628, -0.867157, -0.546246, -0.220119, -0.851874, -0.67108, 0.0780235, 0.355027, 0.179818, 0.974491, -0.424086, -0.667225, 0.258569, -0.139905, -0.779139, -0.251046, -0.401012, -0.525541, -0.28038, -0.131752, -0.405318, -0.135286, -0.922222, -0.689972, 0.760282, 0.566294, -0.513097, 0.786937, 0.385974, 0.342253, 0.784795, 0.731213, -0.926322, 0.843552, 0.645385, -0.635124, -0.624334, 0.648463, 0.896639, -0.857543, -0.380585, 0.548444, -0.22881, -0.566077, -0.115589, -0.159788, 0.713546, -0.827176, -0.569041, -0.872917, 0.638164, -0.277509, 0.311497, -0.714765, 0.65035, -0.324713, 0.231539, -0.277594, -0.729777, 0.661946, -0.503285, 0.105056, -0.0900582, 0.274119, 0.386143, 0.375648, 0.513532, -0.374631, 0.731835, 0.650208, -0.532544, 0.990427, 0.722793, 0.00325198, 0.913262, 0.597504, -0.792387, -0.93541, 0.559481, 0.459627, -0.262529, -0.875708, -0.702376, 0.816527, 0.3243, 0.0834563, -0.445978, -0.3294, 0.0814073, -0.603666, -0.420361, 0.70337, 0.711995, 0.762342, -0.581109, 0.498766, 0.749058, 0.6881, 0.832622, -0.378657, 0.251176, -0.0680455, 0.213153, -0.00979202, 0.528669, -0.198393, -0.587512, -0.882776, 0.194822, -0.0234192, -0.0659916, -0.579414, -0.515849, -0.38902, 0.560882, 0.442316, -0.533613, 0.750354, 0.554196, 0.313098, 0.513032, 0.977783, -0.553878, -0.0856165, -0.481453, -0.719153, -0.0985317, -0.0306977, 0.651245, -0.224158, -0.628896, -0.537118, -0.0840628, -0.682718, 0.299984, -0.662228, -0.134452, 0.827333, -0.515848, -0.587413, -0.0553264, 0.451639, 0.535847, 0.45053, 0.0136142, 0.799991, 0.904894, -0.371182, 0.960125, -0.300818, 0.96274, 0.968499, 0.0637559, -0.542302, -0.191249, -0.686685, -0.941143, -0.808723, 0.360813, -0.408119, 0.030827},
-	{-0.820427, 0.764457, -0.194199, 0.93794, 0.869041, 0.834571, -0.616868, 0.414725, 0.363232, 0.0506153, 0.302056, 0.0583727, -0.599646, -0.789787, -0.0894007, -0.829762, 0.0508242, 0.730336, -0.735375, -0.767095, -0.711993, 0.588194, -0.890869, 0.739471, 0.998113, -0.374017, -0.0317636, -0.931651, -0.105871, 0.575491, 0.948173, 0.133653, 0.0422373, 0.520863, -0.447435, -0.521282, 0.680035, -0.433938, 0.448095, 0.427694, 0.204666, 0.949164, -0.288153, -0.0595476, -0.736821, 0.0362116, 0.956153, -0.974872, -0.771198, -0.591122, -0.127979, -0.217339, -0.744447, 0.325116, -0.0168348, -0.806338, -0.914748, 0.535797, 0.0222226, 0.364498, -0.836574, -0.420314, 0.402262, -0.215761, -0.32655, 0.627733, 0.636221, 0.003368, 0.779899, -0.525411, 0.136372, 0.299506, 0.107944, 0.463808, -0.456354, 0.00757294, -0.697162, -0.203509, -0.89476, 0.0369941, 0.546431, 0.294517, 0.403843, -0.885895, 0.993828, -0.811819, 0.836822, 0.229988, -0.748453, 0.294076, -0.957072, -0.517435, 0.0287693, 0.233642, -0.99801, 0.272251, 0.0546215, 0.750646, -0.107594, 0.971617, 0.589999, -0.580209, -0.00105495, -0.499864, 0.380471, 0.554656, -0.209723, 0.960734, -0.439757, 0.426425, 0.658911, 0.718938, 0.199441, 0.756114, -0.469056, 0.288874, -0.512777, -0.802786, 0.0812562, 0.378427, 0.169999, -0.967043, -0.677287, -0.0424176, -0.0759355, 0.616906, 0.375468, -0.787566, -0.67455, 0.960073, 0.435894, 0.110381, -0.39919, -0.718834, -0.188954, 0.734013, 0.151515, -0.833951, 0.0397507, 0.839719, -0.454692, -0.865525, 0.254009, 0.502927, -0.116025, -0.592189, -0.19153, -0.331804, -0.626164, -0.441317, 0.127641, 0.803762, 0.512418, 0.822364, 0.22119, -0.414521, 0.553414, -0.240706, 0.68454, -0.747, -0.990878, 0.192277, -0.636784, 0.840817, -0.944101, -0.272598, -0.973242, -0.596835, -0.0772661, -0.616185, -0.0527101, -0.874462, 0.693891, -0.358143, -0.312972, -0.0654367, -0.907595, 0.598821, 0.815129, -0.667491, 0.881472, -0.848554, -0.899971, -0.0321403, 0.573977, -0.749418, 0.771212, -0.808909, 0.389306, -0.764697, 0.934736, 0.590756, -0.481339, -0.0768873, -0.432212, -0.0669437, -0.438166, 0.0563901, 0.847399, 0.289931, 0.192075, 0.889879, -0.807529, -0.384357, 0.081242, -0.863, -0.135035, 0.435056, 0.322031, -0.00308707, 0.500734, 0.90383, 0.519251, 0.94194, 0.210621, -0.922901, -0.97136, 0.253889, -0.16556, 0.77154, 0.83379, -0.175392, 0.00219276, -0.521126, -0.345129, -0.390516, 0.0486688, -0.893472, -0.018021, -0.20955, 0.578099, -0.292865, -0.618365, 0.610583, 0.477506, -0.499855, -0.252405, -0.28877, 0.0117965, 0.907282, 0.394555, -0.87544, -0.898197, -0.636378, -0.314637, -0.577785, -0.994916, -0.518501, 0.0351864, -0.943461, 0.501111, 0.123064, -0.176239, 0.0199304, 0.0130053, 0.159411, -0.0646304, -0.745925, -0.410221, 0.227736, -0.685765, -0.77423, -0.461148, 0.00426143, 0.302207, -0.244059, -0.437132, -0.712556, 0.200278, 0.216731, -0.601034, -0.309839, -0.568441, 0.687684, 0.542268, -0.460668, -0.0895511, 0.878292, -0.468435, -0.698696, 0.44992, 0.15656, 0.812858, 0.268976, 0.292484, 0.594419, 0.424793, -0.136714, 0.0625202, -0.0209135, -0.841881, 0.295435, -0.984158, -0.399902, 0.263791, 0.774421, -0.129815, -0.0966763, 0.50331, 0.602323, -0.538016, 0.44384, 0.037964, 0.352425, -0.484409, -0.9382, -0.29542, 0.051745, 0.62922, -0.931137, -0.450445, 0.708438, 0.21765, -0.514269, 0.243133, 0.28864, -0.633654, 0.271838, -0.768891, -0.691086, 0.0214408, -0.335102, 0.377304, -0.387779, 0.319509, 0.742236, -0.968707, 0.529578, -0.864505, -0.995664, -0.256132, -0.326475, -0.79569, 0.691896, 0.124566, -0.111247, -0.436199, 0.442355, 0.0105965, -0.256967, -0.125073, 0.251667, 0.761692, 0.755603, 0.54514, -0.710977, 0.611802, -0.83865, -0.34964, -0.299632, 0.769032, 0.796485, 0.00613929, 0.0230865, -0.72306, 0.917923, 0.126643, 0.954613, 0.773856, -0.454958, 0.632795, 0.936214, 0.807575, -0.460718, -0.873933, 0.796936, -0.969372, -0.949772, 0.115846, -0.304454, -0.89895, 0.626774, 0.569033, 0.256589, -0.104753, 0.492886, 0.883148, 0.568349, 0.676258, 0.46169, 0.207837, -0.0765996, 0.0826249, 0.612789, -0.861481, 0.555479, -0.426826, -0.194705, 0.217273, 0.624619, 0.946878, -0.630351, 0.028263, 0.193794, -0.676205, 0.116434, 0.0262413, -0.481778, 0.748077, 0.639494, 0.568866, -0.532877, 0.416011, 0.173711, 0.0794555, 0.873683, -0.164674, -0.0292488, 0.218838, 0.260468, 0.386319, -0.207166, 0.0108228, -0.875235, -0.181405, 0.674442, -0.829696, 0.0293152, 0.136564, 0.481998, -0.967541, -0.954979, -0.209709, -0.267063, 0.015853, 0.604985, 0.155037, 0.350745, 0.47249, 0.602173, 0.0984925, 0.0181085, 0.754144, 0.862899, 0.570772, -0.26171, -0.692404, 0.447609, 0.953527, 0.025248, -0.885531, -0.30195, -0.437118, 0.599268, -0.875564, 0.8263, 0.813844, 0.233889, 0.981651, -0.771424, -0.424645, -0.0403458, 0.522368, -0.106464, -0.62381, -0.0240514, -0.298487, -0.753423, 0.0708824, 0.136174, -0.527394, -0.040648, -0.500841, 0.262124, 0.714571, -0.434536, -0.0373378, 0.262638, -0.919366, -0.366876, -0.169764, -0.809672, -0.224149, 0.912098, -0.540314, -0.0794563, -0.107477, -0.27933, 0.280827, 0.619191, -0.171165, -0.760479, -0.662367, -0.559853, -0.858898, 0.0037391, -0.645549, -0.889762, -0.105037, -0.0728302, 0.824405, 0.976998, -0.799755, -0.959029, -0.677005, -0.385173, 0.113845, -0.671995, -0.0622753, -0.597116, 0.485012, 0.351184, 0.365778, 0.974593, -0.342195, -0.763192, -0.509876, -0.532178, 0.999907, -0.238478, 0.790595, 0.723871, 0.010917, -0.797538, -0.270014, 0.906542, 0.19405, -0.670412, 0.222698, 0.725168, 0.35357, -0.384905, 0.982845, -0.26137, -0.677248, 0.0339104, 0.0155321, -0.815159, 0.753775, -0.53605, -0.634274, 0.0308614, 0.357797, 0.617114, -0.0805088, -0.1349, -0.387348, -0.679448, -0.928417, -0.98399, -0.267414, 0.460151, -0.496314, -0.922827, -0.373158, -0.963958, 0.134366, 0.103858, 0.390188, -0.641788, -0.302209, -0.711689, 0.0584559, -0.498841, -0.18378, -0.95086, 0.405156, 0.235559, 0.220924, 0.363396, 0.944687, 0.91845, 0.978813, -0.930942, 0.769918, 0.268026, -0.476273, 0.0360785, -0.34232, 0.693704, -0.529095, -0.387299, -0.859305, -0.416319, -0.961084, -0.0970092, -0.550679, 0.369227, 0.18008, -0.929566, 0.89541, 0.794329, 0.338283, 0.0874156, -0.956155, 0.01166, -0.206893, 0.871028, 0.611888, -0.765703, 0.3908, -0.0125701, 0.106542, -0.422587, -0.179306, -0.765174, 0.193015, 0.385028, -0.300122, 0.97374, 0.986267, -0.565084, 0.972739, -0.603648, 0.616822, -0.688931, 0.333676, 0.733718, -0.925856, -0.10807, 0.520585, 0.568756, 0.508963, -0.300698, 0.669888, -0.876202, -0.0573594, -0.184242, -0.138746, -0.976606, -0.372874, 0.417148, -0.454196, -0.158882, 0.854386, 0.796234, -0.188001, 0.275334, 0.419358, -0.778451, -0.559656, 0.794101, 0.0644036, -0.174148, 0.62665, 0.389689, -0.140353, -0.440074, 0.289578, -0.314237, 0.0875568, 0.933735, -0.860699, -0.11164, 0.236867, 0.410038, 0.311766, -0.329495, -0.742047, -0.568702, -0.459952, -0.628763, -0.231392, 0.528539, -0.598634, -0.263941, 0.657516, -0.807806, -0.718614, -0.079929, -0.236148, -0.55221, -0.199944, -0.75973, -0.0837431, -0.130604, 0.794323, 0.869083, 0.513074, -0.386062, -0.430172, -0.194419, -0.621992, 0.338678, -0.985561, 0.267863, -0.402698, -0.248635, 0.818938, -0.402094, 0.864693, -0.360993, -0.682693, -0.205088, 0.640533, -0.906751, 0.747386, 0.253192, 0.7315, 0.948256, 0.954605, 0.670859, 0.41836, -0.30681, 0.071862, 0.201731, -0.0804244, 0.0135606, -0.188173, 0.132588, 0.797127, -0.329957, -0.0251797, -0.566681, -0.0637275, -0.0827081, 0.576486, -0.902156, -0.351703, 0.991602, -0.710637, 0.371442, 0.67431, -0.745625, -0.467929, -0.289367, -0.451937, 0.224633, 0.644901, 0.0811198, 0.991034, -0.117333, 0.473667, -0.15927, -0.152291, 0.964659, 0.974992, 0.54185, -0.653645, -0.980864, -0.310154, 0.480553, -0.965464, -0.323947, -0.650245, -0.00729335, 0.131949, 0.967045, -0.959494, -0.394367, -0.852989, 0.518966, -0.68779, 0.382923, 0.562956, 0.377439, -0.744516, -0.469662, 0.983892, -0.952069, -0.788063, -0.591684, -0.816164, 0.340368, 0.515695, -0.509351, -0.0284377, -0.814459, -0.0636321, -0.511387, 0.323809, 0.449584, -0.369547, -0.126935, 0.32227, -0.402482, 0.148476, -0.607409, 0.161213, -0.382181, -0.625928, -0.0228888, 0.341976, 0.843781, 0.428087, -0.322399, 0.754711, 0.962668, 0.0992068, -0.170867, -0.663602, -0.844477, 0.45845, -0.470726, 0.554396, 0.00120708, 0.838867, 0.760717, -0.479104, 0.904964, 0.167623, -0.577329, -0.207253, -0.229674, -0.885485, 0.624839, -0.816844, 0.526127, 0.773664, 0.0334633, -0.417396, -0.686807, -0.164549, -0.343662, 0.83818, -0.291197, 0.615178, 0.619157, -0.102869, 0.408432, 0.664455, 0.376433, 0.205162, 0.0822343, 0.0051937, -0.774448, -0.760548, -0.623632, 0.340528, 0.488563, 0.522382, -0.548923, 0.306714, 0.0139162, 0.457409, 0.335846, -0.822459, 0.40239, -0.950866, 0.205808, -0.541074, -0.734637, -0.546197, 0.991056, -0.690118, 0.735881, 0.660803, -0.943084, 0.22193, 0.825848, -0.826973, 0.234983, 0.277216, 0.58155, -0.234904, 0.855393, -0.0984515, 0.782661, -0.621, -0.0361165, 0.754675, -0.728837, -0.316777, 0.435742, -0.663038, -0.0494009, -0.901647, -0.158767, -0.678741, -0.515005, -0.355088, 0.849745, 0.699492, 0.270719, 0.625181, 0.275338, -0.309445, -0.776678, -0.79974, -0.384418, -0.672901, 0.00492884, -0.755565, -0.546284, 0.91379, 0.217972, 0.312422, -0.665199, -0.606862, 0.983523, -0.37958, -0.461157, -0.318965, -0.155056, 0.810767, 0.0590629, -0.255096, -0.377448, 0.0497938, -0.90729, 0.098152, -0.757208, 0.0675643, 0.325324, -0.118857, 0.0438057, -0.190976, 0.234299, -0.207407, -0.596047, -0.196446, -0.0175346, 0.86039, -0.772057, 0.856408, -0.355846, 0.641113, 0.096594, 0.14462, 0.141498, -0.593433, 0.108735, 0.101466, 0.825357, 0.155775, -0.891404, -0.899077, -0.562507, -0.482396, 0.94173, 0.359813, -0.348574, -0.928154, -0.441216, 0.498029, 0.746905, -0.450024, -0.545068, 0.0118034, 0.987759, -0.40003, -0.714027, -0.0205782, 0.515189, 0.829165, 0.559332, 0.0303958, -0.39499, 0.659292, 0.573413, -0.0614204, -0.919605, -0.168623, 0.430059, 0.229569, -0.847691, 0.57919, -0.240388, -0.449475, 0.621267, -0.72911, -0.0705635, 0.0248781, -0.429574, 0.97757, 0.909479, -0.926427, -0.620179, 0.552207, 0.5381, 0.761593, 0.277295, -0.853045, 0.50766, 0.62705, -0.162945, 0.890994, 0.251889, 0.31959, 0.840193, 0.388863, 0.762266, 0.203662, -0.847464, 0.880842, -0.24095, -0.650488, 0.686811, -0.228919, -0.861288, -0.3082, -0.0553719, 0.295762, 0.606058, -0.916149, -0.660535, -0.339963, -0.830993, 0.654374, -0.904186, -0.307314, -0.08522, 0.806035, -0.611092, -0.235309, -0.132324, -0.330551, -0.954086, 0.867215, 0.949021, 0.742399, 0.927198, 0.683636, 0.258343, 0.335352, -0.573818, -0.386544, -0.292557, -0.146812, -0.547638, 0.0296935, -0.529186, 0.718612, 0.435332, -0.48211, 0.632883, 0.166805, 0.026824, 0.183141, 0.0813672, -0.568548, -0.416991, -0.126016, -0.794682, 0.916221, 0.701516, 0.505303, 0.466617, -0.869383, 0.294884, 0.711053, -0.216028, -0.867674, 0.278145, 0.436665, -0.3952, -0.930039, -0.00863299, -0.419034, 0.721059, 0.907031, 0.594552, -0.170799, -0.211359, -0.632062, 0.356848, -0.448245, -0.480671, -0.503298, 0.330604, -0.44253, 0.354096, -0.598575, -0.511421, 0.503153, -0.104533, 0.0524665, -0.0598414, -0.800586, -0.69076, 0.312519, 0.421555, 0.994082, 0.937213, 0.164231, 0.847847, -0.966531, 0.760772, 0.0386571, -0.114901, -0.413206, -0.351591, -0.616943, -0.0225866, 0.373051, 0.905382, -0.135177, 0.497637, -0.30872, -0.25753, -0.688279, 0.873338, 0.978577, -0.788961, -0.0263717, 0.524067, -0.0467951, 0.453782, -0.733473, -0.543358, 0.531925, -0.636884, 0.712275, 0.873641, -0.274682, -0.760027, 0.0414485, -0.871123, -0.248148, -0.575799, -0.0561452, -0.160555, -0.983623, 0.355124, 0.57197, -0.729203, 0.955984, 0.493626, -0.481822, -0.400969, 0.510605, 0.469985, -0.226967, 0.279792, -0.412337, -0.248118, 0.490895, 0.978951, -0.754388, 0.300526, -0.0974715, 0.72186, 0.329729, -0.850054, 0.695386, -0.898665, -0.261743, 0.512521, 0.347966, -0.674996, 0.032351, 0.0214759, 0.217521, 0.734434, -0.742173, 0.620784, 0.559557, -0.938173, 0.727467, -0.130058, 0.51496, -0.075538, 0.722863, -0.832599, 0.360661, -0.338205, 0.25261, 0.975202, 0.0453644, -0.838433, 0.794202, 0.658923, -0.436095, -0.138587, -0.422081, 0.115352, -0.414836, 0.395892, -0.934625, -0.21757, 0.392643, 0.0360639, 0.52984, 0.181826, -0.788692, -0.906565, -0.944623, -0.604908, -0.564628, -0.48836, -0.165113, 0.204002, 0.693188, 0.325614, -0.948175, 0.50746, 0.261471, 0.0112534, -0.371214, -0.239621, 0.467262, -0.0390201, -0.658803, 0.854227, -0.392041, -0.406029, 0.747651, 0.61895, 0.878906, 0.992182, 0.585366, 0.482204, -0.0614054, -0.261703, -0.499505, -0.343966, -0.814573, -0.879052, 0.465467, -0.99142, 0.224733, 0.145028, 0.516643, -0.621158, -0.399248, -0.848499, 0.598364, -0.773291, -0.239568, 0.814115, -0.686103, 0.121997, 0.454863, -0.389703, -0.850799, -0.602478, -0.227748, 0.0630172, -0.810059, -0.0159792, -0.884526, -0.368841, -0.0764775, -0.792081, -0.0655488, 0.426822, -0.0329712, 0.00750365, 0.910102, 0.97378, 0.182381, -0.541975, 0.838035, 0.0319944, -0.593259, -0.472316, 0.951608, 0.307857, 0.854657, -0.334111, 0.0894957, -0.394522, -0.522618, 0.871304, -0.155049, 0.656106, -0.181749, 0.275814, 0.236969, 0.859518, 0.185904, 0.278109, -0.707326, 0.364662, 0.215142, -0.803646, 0.718329, -0.568558, -0.813129, 0.346484, -0.298657, -0.731762, 0.0190481, -0.996829, -0.538323, -0.846413, -0.222412, -0.676321, 0.197632, 0.723432, 0.879879, -0.136399, -0.158488, -0.458087, -0.591493, 0.503599, -0.0483061, 0.116767, -0.766655, 0.175196, 0.35088, 0.181551, 0.291297, -0.849412, 0.724964, 0.232279, -0.31756, -0.278515, -0.406581, 0.243189, -0.546366, 0.89677, -0.671828, 0.887797, 0.118438, -0.104289, 0.0428288, 0.920209, -0.34657, -0.718594, -0.75774, 0.892834, -0.738802, 0.000732114, -0.763008, -0.0843677, 0.584831, 0.292051, -0.775352, -0.185205, 0.69997, -0.566401, -0.399458, -0.350254, -0.567992, 0.00696042, 0.486011, -0.667802, 0.41117, 0.314186, -0.0169797, -0.266493, 0.00807009, -0.493468, -0.8295, 0.0945858, 0.865698, -0.78771, -0.749045, -0.481584, 0.181012, 0.626155, 0.660957, -0.710107, -0.353218, -0.377499, -0.975293, 0.7208, 0.329551, 0.0487752, 0.351925, 0.830008, -0.627442, -0.844983, 0.326776, 0.261569, 0.122763, -0.464343, -0.237894, 0.847922, -0.601, 0.837881, -0.365195, 0.614209, 0.0671223, -0.974641, 0.66415, 0.574271, -0.388914, -0.770007, -0.522758, -0.421313, -0.788346, -0.376681, 0.785486, 0.34574, 0.860667, 0.284655, -0.986911, -0.0244213, 0.770716, -0.480351, -0.982573, 0.12016, -0.215229, 0.778601, 0.58925, 0.625469, 0.753302, 0.448139, 0.869524, -0.918493, -0.138091, -0.0888272, -0.341916, 0.873784, 0.381416, 0.240299, -0.76261, -0.56836, -0.368509, -0.153928, 0.691993, -0.224299, 0.0598961, 0.979105, -0.370783, -0.67469, -0.286203, 0.12585, 0.952998, -0.191367, -0.597182, -0.533447, -0.00349505, -0.546326, -0.763196, -0.827566, 0.178611, 0.00213047, 0.333413, -0.711702, -0.13033, -0.556716, 0.371436, -0.635418, -0.0869532, -0.540774, 0.844343, 0.959368, 0.0292026, 0.781572, 0.703229, -0.818596, 0.35291, -0.0435227, 0.721092, -0.594248, 0.0564915, -0.997883, -0.458386, -0.532253, 0.949628, -0.531497, -0.414368, -0.463206, 0.822155, -0.206131, 0.29833, 0.0363442, -0.661911, -0.7469, -0.277278, 0.220859, -0.308129, -0.784443, 0.164339, 0.869726, -0.0793824, 0.614416, 0.538933, -0.59029, -0.294348, -0.403678, 0.0256112, -0.906416, 0.99478, -0.623598, 0.617246, 0.330143, 0.472143, -0.683425, -0.978768, 0.167736, -0.654555, -0.606975, -0.356763, 0.517232, 0.261978, 0.474636, -0.156517, -0.133201, -0.90965, -0.458178, -0.118326, -0.777662, 0.878394, -0.902285, 0.198771, -0.0301603, 0.204633, -0.9901, -0.588767, -0.378027, -0.41328, 0.89362, -0.220214, 0.649926, -0.12098, 0.627637, 0.166045, -0.0236359, -0.55224, 0.974955, 0.926731, 0.317411, -0.739326, 0.811983, -0.792567, -0.164973, 0.224517, -0.0126062, 0.821027, -0.769952, -0.811931, -0.531579, 0.127526, 0.652724, -0.124446, 0.465573, 0.51869, -0.935169, -0.387831, 0.987648, -0.91828, 0.457524, 0.441997, -0.470928, 0.542049, -0.632008, 0.614028, 0.553928, -0.69161, 0.394702, -0.595974, -0.286847, -0.926192, 0.268686, 0.943858, -0.824981, -0.607544, -0.91437, 0.0175209, 0.0583363, -0.427198, -0.981813, -0.858148, -0.656465, -0.554919, -0.395627, -0.425527, 0.258241, 0.109731, -0.411623, 0.301321, -0.943335, -0.833801, 0.866638, -0.00658789, -0.195137, -0.175895, -0.662748, 0.735779, -0.166674, 0.8279, -0.177742, -0.780784, -0.808525, -0.734238, 0.354962, 0.858716, 0.339676, 0.698398, 0.0903076, 0.285902, -0.392741, -0.823978, 0.877661, 0.995851, 0.12245, 0.938159, -0.885071, 0.559209, -0.573365, 0.280575, 0.00390727, 0.00947697, 0.568134, -0.300402, 0.855256, -0.650027, 0.543092, 0.158747, 0.125576, -0.272465, -0.0936337, 0.561563, 0.650733, 0.794494, -0.800327, -0.262786, -0.613436, -0.960677, 0.59627, -0.810062, 0.594265, 0.68932, 0.757477, -0.440751, -0.620792, -0.523978, 0.601309, -0.149664, -0.110517, -0.667504, -0.282015, 0.628926, 0.577466, -0.999691, 0.956725, -0.637914, 0.958285, 0.377932, -0.592889, 0.109219, -0.140935, 0.226234, 0.487026, 0.546957, -0.893883, 0.17317, -0.472682, 0.893415, 0.699988, 0.102379, 0.188365, 0.510235, 0.803245, 0.413884, -0.714427, 0.0630353, 0.862794, 0.822381, -0.907122, 0.947238, -0.472982, -0.968046, 0.152054, -0.159479, -0.0994118, 0.422967, 0.205557, 0.135604, 0.77834, -0.187617, 0.684116, 0.616309, 0.540248, 0.939235, -0.928376, 0.283496, -0.0193233, -0.503909, -0.862354, 0.483658, -0.0726332, -0.196758, -0.207933, 0.852481, -0.131445, 0.871326, 0.905412, 0.728538, -0.877774, 0.0298443, 0.536007, -0.682393, 0.521577, -0.219901, -0.618284, 0.926539, -0.980285, -0.987345, -0.951908, 0.169546, -0.534327, 0.134249, -0.404984, -0.692156, -0.0178826, 0.969054, -0.37303, 0.77815, 0.00661672, -0.702175, 0.118085, 0.507135, 0.151246, -0.849172, -0.479537, -0.403659, -0.867832, 0.867392, 0.857481, -0.620427, 0.864304, 0.232046, -0.60877, -0.646256, -0.562914, -0.920239, 0.695563, -0.716651, 0.388625, 0.172314, -0.975887, -0.073261, 0.638239, -0.9391, 0.851612, -0.0685129, -0.358854, -0.667587, -0.364737, 0.976379, 0.262907, -0.930031, -0.516037, -0.956829, -0.938372, 0.848725, 0.0295865, -0.803992, -0.993748, -0.262333, 0.745314, -0.94528, 0.820996, -0.0100653, 0.90104, -0.932595, 0.0365672, -0.607402, 0.381583, -0.176467, 0.126958, -0.898031, -0.133068, -0.758169, 0.735391, 0.196995, -0.971359, 0.716952, 0.772149, 0.183409, 0.592931, 0.548163, 0.985143, 0.814312, 0.555419, 0.535289, 0.249702, -0.578919, 0.805846, 0.700956, -0.194923, -0.379214, -0.520949, -0.365782, -0.825562, 0.697478, 0.918086, 0.466387, -0.0528413, -0.48856, 0.217595, 0.465483, 0.00708623, 0.0569442, 0.602161, -0.622584, 0.817765, -0.305755, -0.396156, -0.75278, -0.990281, 0.693649, -0.628927, -0.760659, -0.839019, 0.984045, 0.422014, -0.226841, 0.870674, 0.366532, 0.0712567, -0.948643, 0.805458, 0.357251, -0.826291, -0.14382, -0.963803, 0.79397, 0.276159, -0.000491466, 0.4192, -0.972435, -0.674175, 0.803749, -0.873759, -0.893148, -0.0927632, -0.772233, 0.299946, 0.959428, -0.846651, 0.925607, 0.456482, -0.408685, -0.830295, 0.339001, 0.233739, -0.561443, 0.18837, 0.281856, -0.23392, 0.783842, -0.721488, 0.981542, -0.211852, 0.415249, 0.0739567, -0.371701, -0.222213, 0.877794, -0.914736, 0.977615, -0.191517, -0.546139, -0.978413, -0.363346, -0.295409, -0.357162, -0.150034, -0.319675, 0.846799, -0.0492998, -0.674841, -0.581037, -0.712015, -0.154027, 0.00527414, -0.411659, -0.666146, -0.945006, -0.835953, -0.916208, 0.902869, -0.515934, 0.126193, 0.688287, 0.809433, 0.610701, 0.695887, 0.336451, 0.976085, 0.0400481, -0.0057248, -0.445834, 0.242944, 0.485234, 0.474847, 0.955386, -0.200297, 0.370295, -0.922827, 0.682233, 0.887255, -0.155798, 0.654447, -0.5803, 0.322742, 0.805073, 0.653018, 0.179613, -0.297381, -0.513979, 0.745856, -0.953216, 0.454738, -0.544428, 0.686449, 0.758154, -0.868466, 0.267332, 0.211794, -0.149242, -0.238259, 0.579954, 0.678819, -0.778473, -0.561475, 0.883785, 0.798249, -0.970124, -0.115128, -0.680381, -0.122719, 0.810013, 0.835816, -0.697756, -0.398436, 0.296002, 0.661802, 0.529161, 0.721927, 0.909316, -0.153992, -0.0789681, 0.555549, -0.55522, -0.947372, 0.881166, 0.402914, -0.845261, -0.486331, -0.847494, -0.214659, 0.452389, -0.142125, -0.856175, -0.938775, 0.992786, 0.285216, 0.0547465, 0.848341, -0.92166, 0.093698, 0.647475, 0.578967, 0.356279, 0.337606, 0.874886, 0.91378, 0.298867, 0.955767, -0.530813, 0.683686, 0.116575, -0.869677, 0.156714, 0.718053, 0.842894, 0.862665, 0.321786, 0.141842, 0.259209, 0.0645347, -0.292187, -0.895332, -0.333502, -0.101141, 0.384459, 0.103491, -0.867684, 0.604396, 0.723147, 0.165677, -0.0254124, 0.0830068, 0.369253, -0.334757, 0.158293, -0.934021, 0.496534, -0.821343, -0.0595009, -0.754401, 0.0200697, 0.23835, -0.141579, 0.284503, -0.219456, -0.779922, -0.0200302, 0.267844, 0.347007, 0.970217, 0.610162, -0.962424, -0.181659, -0.498846, 0.0956942, -0.37954, -0.793112, 0.530296, -0.206283, 0.630228, 0.383403, -0.0505686, -0.218251, 0.773212, 0.914585, -0.602862, -0.576748, -0.127052, 0.478226, 0.676507, -0.239078, -0.202083, -0.158071, -0.842607, 0.453923, 0.00127556, 0.651484, 0.778712, -0.0935045, -0.89949, 0.0532688, 0.11016, -0.901616, -0.232426, 0.954264, -0.267357, -0.880155, -0.110053, -0.420903, -0.310893, 0.300678, 0.40342, 0.597397, 0.826538, 0.0522231, 0.924362, 0.578456, -0.878502, -0.779897, 0.914131, 0.146137, 0.83804, -0.906306, 0.310148, -0.64379, 0.676943, -0.279421, -0.306307, 0.968749, -0.265113, 0.186656, -0.0468805, -0.198682, 0.444101, 0.0525256, 0.461175, 0.144343, 0.624418, -0.0777816, 0.0210048, 0.329278, 0.161294, -0.439621, -0.707161, -0.800457, -0.288759, 0.651489, -0.360616, 0.947481, -0.952252, 0.959749, -0.109845, -0.750029, 0.270622, -0.166666, -0.217083, -0.982446, -0.263152, -0.12768, -0.450239, -0.934642, -0.963987, 0.517465, 0.774936, 0.551408, -0.133915, -0.485119, -0.94135, 0.967753, -0.384896, 0.326244, 0.617855, -0.948455, -0.454719, 0.239335, -0.0445964, 0.995076, -0.328047, 0.556835, -0.464891, 0.748015, -0.311376, -0.522396, -0.246739, 0.0511493, 0.650482, 0.68944, -0.503794, -0.784513, -0.510878, -0.954542, 0.452507, -0.832312, 0.649315, -0.648725, 0.365814, -0.805929, -0.36216, 0.448127, 0.966559, 0.969386, -0.382697, 0.867249, 0.977242, -0.41212, -0.18785, 0.93249, -0.579122, 0.72075, -0.72898, 0.0800715, -0.541062, 0.644045, -0.13766, -0.472054, -0.0805084, -0.812592, 0.937862, -0.495706, -0.229384, 0.319035, -0.681963, 0.19145, -0.248598, 0.481939, 0.924069, 0.267343, -0.91926, 0.277464, -0.694673, -0.38996, -0.352824, -0.929552, -0.446113, 0.443126, -0.799025, 0.850155, 0.365942, 0.712794, 0.729621, 0.103812, 0.281453, 0.191825, -0.232519, -0.212865, -0.0166089, -0.80709, 0.269726, -0.905723, -0.210594, -0.462701, -0.0540655, -0.955902, 0.726596, 0.160187, -0.102011, 0.864701, -0.298798, -0.481407, 0.64619, -0.129792, -0.181431, -0.731343, 0.725878, -0.0436452, 0.990359, -0.962406, 0.54231, 0.938017, -0.362643, -0.207147, -0.00172995, 0.108343, -0.306406, 0.0961777, -0.7239, 0.219246, 0.751196, -0.310719, -0.533514, 0.296109, -0.388826, 0.325313, 0.550896, -0.897387, -0.123011, -0.404921, -0.830319, 0.527519, -0.202969, 0.693118, -0.2729, -0.371506, 0.564812, 0.671842, -0.458735, 0.365924, -0.600127, 0.34636, 0.511892, -0.537928, 0.938033, 0.0592449, 0.000644417, 0.127993, 0.148062, -0.477994, 0.28598, -0.887405, -0.472064, -0.527976, -0.533009, -0.21049, -0.593601, -0.201393, 0.57631, 0.605481, 0.270384, 0.366241, 0.268727, 0.51409, -0.124551, 0.131112, -0.121013, 0.710309, 0.726999, 0.602011, -0.686656, -0.977765, -0.721324, 0.420084, -0.286988, -0.225392, 0.826867, -0.799079, -0.57877, -0.831919, 0.496849, -0.858987, -0.395528, 0.838018, -0.536307, -0.925929, 0.148655, -0.590444, 0.848765, -0.939488, 0.283324, -0.476597, 0.835018, 0.285156, -0.0577831, -0.0130079, 0.73858, 0.469355, -0.541855, 0.286547, 0.295184, 0.0370351, -0.28069, -0.917231, 0.0604218, 0.417668, 0.490063, -0.225641, 0.273433, -0.994733, 0.813201, -0.933038, 0.575979, 0.446836, -0.731293, 0.77473, 0.518408, 0.721536, 0.518973, -0.220286, 0.173995, -0.403815, 0.4489, 0.416453, 0.0256594, 0.343035, -0.697861, 0.240265, -0.729163, -0.295835, 0.407455, -0.791664, 0.508758, 0.660196, -0.375645, -0.00321701, 0.680311, -0.187751, 0.962385, -0.354042, -0.519836, -0.592483, -0.804998, -0.445221, 0.764403, 0.372539, 0.583976, -0.902764, -0.339833, 0.74551, -0.742441, 0.656419, 0.101076, -0.20054, -0.14888, -0.955521, -0.769349, 0.92589, -0.624765, 0.605009, 0.255227, -0.230206, 0.283148, -0.947572, 0.425498, -0.71346, -0.586494, -0.868516, -0.173549, 0.06803, -0.832169, -0.404905, 0.252028, -0.988545, -0.204908, 0.228335, 0.247312, -0.937917, 0.278728, -0.449285, 0.776489, 0.362844, 0.158041, 0.928536, 0.602648, -0.258813, -0.0481522, 0.296146, 0.819027, 0.75504, 0.516518, -0.0338969, 0.0659418, -0.730096, 0.46581, 0.823314, -0.0211754, -0.768854, 0.883819, -0.721181, -0.919331, 0.742042, 0.910749, 0.632055, -0.305979, 0.0932228, 0.936161, 0.0363261, 0.355037, -0.0674743, 0.473383, -0.521005, 0.399041, -0.271671, -0.0385015, 0.641305, -0.49706, 0.0869095, -0.284425, -0.969759, 0.69048, 0.152964, 0.717315, -0.41566, 0.779182, -0.653052, -0.420887, 0.171604, 0.166646, 0.809713, -0.0695428, -0.392367, -0.750118, -0.362512, -0.395056, -0.774737, 0.54789, 0.298964, -0.0783525, -0.906416, 0.304769, -0.766044, 0.711992, -0.893224, -0.68721, -0.733988, -0.212992, 0.677159, -0.386436, -0.128402, -0.804354, 0.13247, -0.569236, -0.19148, -0.123353, -0.961158, 0.632247, -0.522365, -0.792338, -0.647199, -0.247621, 0.0407673, 0.44315, -0.851696, 0.22055, -0.377578, 0.780732, 0.575883, 0.658771, -0.0631248, -0.209836, 0.352426, 0.0538785, -0.977346, -0.652274, 0.153614, 0.230435, -0.317999, 0.455941, 0.465325, 0.451245, -0.0649581, 0.834973, -0.293999, 0.815149, 0.406708, -0.0914054, -0.489728, 0.314584, -0.890888, -0.88904, -0.875639, -0.520719, -0.543541, -0.0806302, 0.460782, 0.639787, -0.388267, 0.46937, 0.590787, 0.98338, -0.827812, 0.375462, -0.0731158, 0.281731, 0.819572, -0.0144469, -0.699102, -0.257209, -0.798693, -0.546719, 0.814944, 0.0892692, -0.908746, -0.721348, 0.339638, -0.0723303, -0.399889, 0.0845318, 0.826805, 0.603171, -0.841067, 0.604502, 0.813787, 0.509081, -0.911177, 0.227585, -0.0994092, 0.642912, -0.850833, -0.41658, 0.761404, -0.762355, 0.454748, -0.27764, 0.497272, 0.742124, 0.1578, 0.321352, -0.712449, -0.609816, 0.872993, 0.737372, 0.630582, -0.763213, 0.966929, 0.00131023, -0.68654, 0.94467, -0.97879, 0.555313, 0.544724, -0.215056, -0.77518, -0.486279, 0.194818, 0.0390939, -0.534073, 0.744673, -0.695655, -0.948604, 0.981796, -0.846598, 0.240303, 0.0916205, -0.925104, -0.354696, -0.0827251, 0.773173, -0.376343, -0.928533, -0.987293, -0.69942, 0.331583, -0.921116, -0.892532, -0.574112, 0.622825, 0.829716, -0.935701, -0.378333, -0.379442, 0.445759, 0.0402789, 0.424151, 0.499737, 0.0531046, 0.567031, 0.57467, 0.790185, 0.935571, -0.753024, -0.749237, 0.392418, 0.174999, -0.92634, 0.274721, 0.84297, -0.910917, 0.679166, -0.452082, -0.239518, -0.373329, 0.591021, 0.956895, 0.27065, 0.0823444, -0.296199, -0.591555, -0.588763, 0.858358, 0.326371, -0.480178, -0.712805, -0.939432, -0.134828, 0.787062, 0.849859, -0.197801, 0.270612, -0.570037, -0.244984, 0.262812, -0.317409, -0.0840167, -0.346553, 0.511316, -0.886725, 0.239427, -0.747713, -0.0515472, -0.915481, -0.110278, 0.550021, -0.494176, 0.739373, -0.0554824, 0.792024, -0.242054, 0.0505187, -0.674878, -0.95569, -0.319415, -0.359223, -0.544914, -0.606013, -0.678772, 0.774561, 0.487003, -0.911737, -0.960848, 0.161209, 0.233968, -0.381114, -0.149607, 0.00544812, -0.309465, -0.589815, 0.522922, 0.820001, -0.66614, -0.553492, 0.0650623, -0.476773, 0.567669, 0.60094, -0.405512, 0.890984, -0.949863, -0.710797, -0.376372, -0.956153, 0.507899, -0.942288, 0.834618, 0.776291, 0.486354, 0.260952, 0.823333, -0.213169, 0.476958, -0.563378, 0.385356, 0.328712, 0.89827, 0.644466, 0.538958, 0.121338, 0.16559, -0.628459, 0.838759, -0.0248332, 0.370342, 0.602232, -0.931402, 0.555205, -0.644666, 0.871377, 0.771186, 0.215176, -0.00107228, 0.525796, 0.1674, -0.395518, 0.539854, 0.577121, -0.211814, 0.434422, -0.620973, 0.88482, 0.983933, -0.39884, 0.0325283, -0.761083, 0.467483, -0.0282742, -0.0410003, 0.884627, 0.918662, -0.904163, -0.180749, 0.411659, 0.915136, -0.559786, 0.629133, 0.0229489, -0.553859, -0.864912, -0.0400674, 0.454374, -0.823989, 0.29486, -0.927303, -0.677568, -0.060324, 0.909532, 0.525416, 0.842142, 0.241977, -0.590969, -0.90293, -0.398226, -0.97392, 0.692608, -0.59331, -0.268612, 0.834854, -0.390842, -0.27151, 0.0690131, -0.866596, 0.401776, 0.873795, 0.702837, 0.763722, 0.888636, -0.685491, -0.466591, 0.698666, -0.559332, -0.542657, 0.150212, -0.796634, 0.407327, -0.258233, -0.47324, 0.328465, 0.35467, 0.0967242, -0.316314, -0.474611, -0.186694, -0.845276, 0.647086, 0.710815, -0.57988, -0.53306, -0.451772, -0.954134, 0.886161, 0.478697, -0.138513, -0.96134, 0.586226, 0.131556, 0.500923, 0.536589, -0.587479, -0.199682, 0.206274, 0.00407928},
-	{-0.588328, 0.880733, -0.755587, -0.0308402, -0.0229089, 0.0984096, 0.540528, -0.557877, 0.661109, -0.416697, 0.22148, -0.608287, -0.955089, 0.0926754, -0.905369, -0.0411279, 0.889184, -0.751692, -0.0316315, -0.232907, 0.00929198, 0.50098, 0.631834, -0.0826763, 0.258057, 0.935634, 0.0122078, -0.0680667, -0.383688, 0.970099, 0.975649, -0.401504, -0.273794, 0.689664, 0.541519, -0.576473, -0.858772, 0.108072, -0.842887, -0.883224, 0.107659, -0.556689, -0.229928, 0.433349, 0.591787, 0.287019, -0.60256, -0.52501, 0.473193, 0.0225463, 0.454384, -0.620622, 0.491041, 0.639265, -0.925322, 0.32332, -0.389764, -0.0626751, -0.984006, 0.469186, -0.13521, 0.975278, -0.582286, 0.39486, 0.990884, -0.84444, -0.987533, 0.167976, 0.0897036, 0.0953814, 0.562568, -0.270912, 0.26993, -0.575627, -0.406417, 0.0739123, 0.0224284, 0.833841, 0.404908, 0.139826, -0.44472, -0.881066, 0.336294, -0.358365, 0.789491, 0.543023, -0.859522, 0.91385, -0.109407, -0.142484, -0.886151, -0.224939, -0.44788, -0.457495, -0.791852, 0.169211, 0.67352, 0.992395, -0.76913, -0.2505, -0.0928948, -0.654058, -0.53112, 0.557034, 0.511565, -0.916969, 0.982026, -0.862912, -0.432148, -0.76668, -0.330497, 0.542815, 0.341396, 0.675, 0.177343, -0.274529, -0.992774, -0.939342, -0.121501, 0.645094, -0.94108, -0.465025, 0.928818, -0.901888, 0.461707, 0.649603, -0.391398, -0.217021, 0.258724, 0.89406, -0.614134, -0.86902, -0.704454, 0.916801, -0.440826, 0.8206, -0.641007, -0.322298, 0.607677, 0.874246, 0.146618, 0.162449, 0.516297, 0.798538, 0.504284, -0.574589, 0.861544, 0.227623, -0.341565, -0.824172, 0.80765, 0.0887305, -0.847754, -0.225762, 0.553713, -0.621736, 0.409513, 0.520982, -0.609535, -0.858213, 0.979541, 0.507231, 0.48063, 0.874805, 0.671068, -0.481596, 0.601274, -0.200769, 0.924768, -0.490011, 0.237118, 0.776837, 0.204247, 0.505079, -0.278632, -0.668505, -0.710739, -0.410318, 0.231835, 0.717117, -0.371616, -0.485088, -0.589226, -0.531491, -0.366115, -0.866655, 0.498818, 0.316252, -0.00719316, -0.0764894, -0.716042, 0.669905, -0.862301, 0.430655, 0.193161, 0.200517, -0.321988, -0.999519, 0.929716, 0.0925787, -0.034671, -0.0547976, -0.00654683, 0.753726, -0.659626, 0.755033, -0.0102535, 0.970605, 0.942323, -0.805235, -0.961064, -0.367711, -0.240154, -0.750886, 0.828253, -0.787688, 0.589267, 0.488306, 0.792213, -0.153454, 0.397771, 0.218723, -0.684883, -0.243243, 0.551304, -0.894636, -0.386323, 0.0147428, 0.0640722, 0.74946, -0.746008, -0.605917, -0.558867, -0.842097, -0.259531, -0.374478, 0.181173, -0.5265, 0.967988, 0.38051, 0.252676, -0.614585, 0.484475, 0.201933, -0.99315, -0.970229, 0.897564, -0.455329, 0.961574, 0.317591, -0.527575, 0.93093, 0.196082, -0.103862, -0.906487, 0.1493, -0.101293, 0.748906, -0.572226, -0.403496, -0.401025, 0.789439, 0.0617853, 0.776949, 0.662461, 0.0678227, -0.706668, -0.406061, 0.289133, 0.074022, -0.460888, -0.725451, -0.862228, -0.760641, 0.230865, -0.389881, -0.694738, -0.973495, -0.220755, 0.946204, -0.459371, 0.692307, -0.500509, 0.713422, 0.62386, 0.64139, -0.346252, -0.0151121, -0.414479, 0.275401, -0.73812, -0.758656, -0.749138, 0.0960408, 0.425727, -0.574716, 0.134248, -0.509639, 0.929648, 0.358267, 0.988756, -0.341815, -0.803289, 0.279518, -0.167465, 0.173517, -0.720012, 0.568417, 0.538326, 0.271119, 0.534828, 0.71585, -0.755471, 0.772838, 0.740816, 0.0772967, -0.331643, 0.900389, -0.164108, 0.546383, -0.865819, 0.339163, -0.405488, -0.287816, 0.108959, 0.551148, 0.771861, -0.0914403, -0.772959, -0.263525, -0.462187, 0.318703, 0.299069, -0.175095, -0.28379, -0.480198, 0.804616, 0.530389, 0.993114, -0.480738, -0.985948, 0.0377561, -0.562793, 0.893498, -0.00416071, 0.424591, -0.988186, 0.775057, 0.898919, -0.0896589, 0.184178, 0.505403, -0.983987, -0.00858279, -0.929301, 0.225308, 0.146118, -0.803181, -0.245714, -0.732925, 0.69371, 0.473748, -0.251566, -0.204399, -0.601, 0.104319, 0.082505, 0.288594, 0.988023, 0.750951, 0.234106, -0.720808, 0.59933, -0.942873, -0.0647928, -0.645595, -0.327107, 0.40889, -0.622678, 0.910268, 0.798156, 0.323763, 0.669382, -0.561701, 0.671755, 0.414881, -0.00902077, -0.332335, 0.852477, 0.0365958, 0.00706803, 0.407949, -0.621482, -0.844775, 0.148907, -0.0693774, 0.365132, 0.299018, -0.661228, 0.0797518, -0.197353, 0.132028, -0.912671, -0.212785, -0.801372, -0.92801, 0.692667, -0.80204, -0.101952, 0.0133914, -0.145492, 0.185674, -0.73145, -0.686814, -0.981736, -0.708719, 0.0375019, 0.630181, 0.0428767, 0.33389, 0.253778, 0.229698, -0.713837, -0.272837, 0.533027, -0.973023, -0.83201, -0.752579, -0.920688, 0.419121, 0.385683, 0.591493, 0.120656, -0.888472, 0.100578, -0.636213, 0.632891, 0.683895, -0.233335, -0.575094, -0.342321, -0.152457, 0.335734, 0.550956, -0.203321, 0.883624, -0.159564, 0.346147, -0.288629, -0.731908, 0.813409, 0.695194, -0.189473, -0.479403, -0.764409, -0.834901, -0.397916, 0.205612, 0.197289, 0.401385, -0.569425, -0.356398, 0.742783, 0.114458, -0.653171, 0.978595, -0.0555492, -0.324496, 0.24666, 0.67393, -0.890533, 0.865794, 0.742242, -0.696849, -0.632649, -0.789366, -0.498803, 0.877748, 0.441545, -0.0853349, -0.29517, -0.661334, 0.0900876, 0.554801, -0.577685, -0.501381, 0.44674, -0.420768, 0.993783, 0.0614597, -0.263362, 0.304275, 0.0511331, -0.942757, -0.335316, 0.25233, 0.156428, -0.346326, -0.450936, -0.710985, 0.236505, 0.89683, 0.368031, 0.568711, 0.841576, 0.299629, -0.378786, -0.748583, 0.744366, 0.33253, -0.827312, 0.149349, 0.570862, -0.957502, -0.69831, 0.940757, -0.259404, -0.0943313, -0.00849458, -0.90697, 0.352009, 0.0634161, 0.485622, 0.439472, 0.945154, -0.837259, 0.753358, -0.146156, 0.217496, 0.0492833, 0.745444, 0.601239, -0.421286, -0.195793, -0.347128, -0.900516, 0.953375, 0.0224365, 0.209904, 0.893578, 0.885495, 0.00542241, -0.861951, -0.30081, 0.733475, -0.904694, -0.057251, -0.0831332, 0.555836, 0.852778, -0.383166, -0.905634, -0.421443, -0.49921, 0.645265, -0.413298, -0.315571, -0.573725, 0.263071, 0.981934, -0.496249, 0.536211, -0.774811, -0.744701, 0.632274, -0.616373, 0.846254, -0.037687, 0.988297, 0.752191, 0.421599, 0.961137, -0.338301, -0.419158, -0.364532, 0.18596, -0.2908, 0.151075, -0.817959, -0.319151, 0.337147, -0.74525, -0.117683, 0.627265, 0.18798, -0.880317, -0.266321, -0.109204, 0.493765, 0.576247, -0.9544, -0.412267, -0.0989227, 0.843967, -0.566776, -0.980777, -0.425565, 0.515122, -0.142865, 0.328595, 0.403469, -0.883404, 0.491203, 0.447729, -0.467011, 0.525613, 0.400469, -0.307194, -0.122242, 0.861232, -0.507864, -0.133146, -0.174077, -0.521349, -0.445451, 0.485242, 0.612176, -0.545984, 0.913058, 0.214803, 0.712837, -0.108251, -0.131454, -0.693561, 0.240349, 0.539086, -0.135562, -0.389053, -0.416165, -0.0601933, 0.521127, -0.0922023, 0.737067, -0.301555, -0.341187, -0.545608, -0.579536, -0.73076, -0.60165, 0.706652, 0.548062, 0.178727, 0.163035, 0.620606, -0.965775, -0.839028, 0.91491, -0.904513, -0.771861, 0.264152, 0.369175, -0.870496, 0.978363, -0.785935, 0.219912, 0.455178, -0.048017, 0.621227, -0.75645, 0.737, -0.0112362, -0.0837319, -0.49096, 0.285481, 0.752612, 0.207141, -0.896304, 0.469392, -0.995167, -0.566836, 0.552534, -0.941323, 0.598693, 0.0154883, -0.253246, 0.166057, 0.998434, 0.288394, -0.0328103, -0.195662, -0.15989, 0.0694787, -0.179529, -0.652128, 0.660989, -0.700126, -0.584385, -0.831029, 0.0888209, 0.138945, 0.16082, -0.291529, 0.983719, -0.591084, -0.776153, -0.541873, 0.091293, -0.634425, -0.976491, 0.163732, -0.374153, -0.252074, -0.742098, 0.979356, -0.0854118, 0.377293, -0.981912, 0.0844043, 0.257247, -0.244322, 0.713194, -0.687109, 0.310397, -0.394362, -0.940245, -0.975456, -0.203423, -0.0180809, -0.74933, -0.788258, -0.112861, 0.367246, 0.767011, -0.796694, -0.526131, 0.0350268, -0.4916, -0.178664, 0.727469, -0.578239, 0.35789, -0.889057, 0.791508, -0.509454, 0.542143, -0.175982, 0.953836, 0.502505, -0.0191577, -0.199893, -0.807529, -0.656587, -0.673423, -0.510715, -0.825128, 0.163155, 0.266456, 0.161257, 0.416048, 0.128631, 0.101233, 0.310271, 0.141827, -0.393336, 0.405193, 0.305578, -0.302292, -0.679571, 0.332289, 0.542663, -0.357655, -0.0961211, -0.727793, -0.250897, -0.887266, -0.685796, -0.0447847, 0.284139, 0.0150936, -0.125546, -0.637064, -0.150992, 0.822799, -0.639864, -0.437567, -0.677916, -0.239009, -0.328096, -0.819655, 0.177969, 0.584228, 0.463469, 0.801949, -0.361971, -0.175297, 0.276255, -0.352851, 0.987485, 0.679835, 0.0293619, 0.875545, 0.877555, 0.865512, -0.368161, 0.802085, -0.899105, -0.726449, 0.87012, 0.59462, -0.0739886, -0.184037, -0.475693, 0.901451, -0.268304, 0.0686433, -0.96034, -0.401913, 0.213253, 0.608675, -0.935231, 0.849017, -0.65241, 0.549783, -0.260017, 0.231361, -0.241002, 0.60638, 0.254599, 0.823908, -0.29977, 0.842994, -0.430832, 0.865423, -0.00199158, -0.74557, 0.751737, 0.397689, 0.646035, -0.62629, 0.542678, -0.810024, 0.330058, 0.0434222, 0.836598, 0.85975, 0.0100972, 0.0441327, 0.462224, -0.104253, -0.651647, -0.685963, -0.692211, 0.741694, 0.801584, 0.84044, -0.941191, -0.990501, -0.932026, 0.144838, -0.647441, -0.0165799, -0.944822, -0.16237, -0.886983, 0.732526, -0.799658, 0.498503, -0.153883, -0.145275, 0.371599, -0.626363, 0.515102, 0.39979, -0.708665, -0.495743, 0.460692, -0.558103, 0.134976, -0.200157, -0.0836341, 0.843579, 0.448516, -0.00691213, 0.0618526, -0.717945, 0.335785, 0.132754, 0.560071, -0.644422, 0.383727, -0.757591, 0.5031, 0.217968, -0.558918, -0.352471, -0.72794, 0.858414, 0.757654, 0.504133, -0.997344, 0.627949, -0.636936, -0.538054, -0.0565081, 0.0358509, 0.822551, 0.405801, -0.597124, -0.0836802, 0.880052, 0.350875, -0.918504, -0.343857, 0.927625, 0.273871, -0.414381, 0.3971, -0.896178, -0.244176, 0.385346, -0.883233, -0.824276, 0.794606, -0.586736, -0.516613, 0.521223, 0.584555, -0.169185, -0.993893, -0.030191, 0.0605813, 0.0128348, -0.801847, 0.250438, -0.659989, -0.880251, 0.214432, 0.382958, 0.731057, 0.0123795, 0.396697, 0.369216, -0.485732, 0.0357461, -0.592083, -0.410188, -0.774816, -0.949507, 0.471134, 0.85667, -0.00721846, 0.849773, -0.0586342, -0.391553, 0.63293, 0.667608, 0.391825, 0.634199, 0.889427, -0.31958, 0.251266, -0.711941, -0.0505441, -0.400175, -0.478238, -0.0445973, -0.616818, -0.372131, -0.656476, -0.324792, 0.802685, 0.152998, 0.271822, -0.789141, -0.243327, 0.980311, -0.77518, 0.8326, 0.94147, -0.761543, -0.706927, 0.220213, 0.749069, 0.519521, -0.851128, 0.484992, -0.796228, -0.118707, 0.232662, 0.160593, -0.336144, -0.942927, -0.300182, 0.559203, -0.729014, -0.96412, -0.372997, -0.806706, -0.698707, -0.59129, 0.674021, -0.417985, 0.112738, -0.986551, 0.770771, 0.66132, -0.81585, -0.999129, 0.996832, -0.152372, 0.102865, -0.396522, 0.557232, 0.191551, 0.606836, 0.211951, -0.501722, 0.485641, 0.308155, 0.204544, -0.934831, 0.380158, -0.146272, 0.674638, -0.0776765, -0.660952, 6.7762e-05, 0.501872, 0.520686, -0.931134, 0.395271, -0.709361, 0.824455, -0.562654, -0.723995, 0.10738, 0.351668, 0.13478, 0.246329, 0.74789, 0.357465, 0.788225, 0.327333, 0.770799, -0.328475, 0.73719, -0.0312857, 0.456368, 0.713945, -0.430455, -0.448733, -0.576035, 0.405819, -0.510442, 0.498492, 0.182564, -0.227735, 0.395088, 0.0606785, 0.5952, 0.505919, 0.774969, 0.919282, 0.123091, 0.205302, 0.389158, 0.986367, -0.808865, 0.868231, -0.467366, 0.355133, -0.966358, 0.233638, 0.458543, 0.01667, 0.848669, 0.481066, -0.713922, 0.397144, -0.436824, 0.423245, 0.856296, -0.308275, 0.832567, -0.0819299, 0.924546, 0.399116, -0.451528, -0.97983, -0.957835, -0.857266, -0.0564751, 0.271488, 0.654477, 0.922478, -0.440512, 0.905385, -0.852021, 0.226995, 0.724754, -0.110273, 0.188382, 0.554105, -0.419287, 0.713119, -0.473407, 0.214848, 0.0726824, 0.955122, -0.262817, -0.481583, 0.223223, 0.258619, -0.8598, 0.955761, 0.713364, 0.874492, -0.259194, 0.152188, -0.0468819, -0.233105, 0.294696, -0.289735, 0.01842, -0.425899, -0.854469, -0.761529, 0.0964574, -0.765527, -0.529101, 0.428326, -0.820561, -0.951915, 0.010475, -0.816989, 0.864456, 0.756955, -0.343431, 0.59131, 0.656994, -0.0209044, 0.0837784, 0.470113, -0.0386234, -0.0122708, -0.247172, -0.414657, -0.205549, -0.491194, 0.144258, -0.972787, 0.358795, 0.286894, -0.788079, -0.455057, 0.451462, -0.738239, 0.403986, -0.0956693, -0.946507, 0.0882997, -0.686424, -0.360134, -0.622018, 0.101147, 0.00824327, 0.917233, -0.383986, 0.469189, 0.560661, 0.938686, 0.383389, -0.0763514, 0.49058, -0.965823, -0.6875, 0.162788, 0.23239, -0.754462, -0.900288, 0.49466, -0.465376, -0.839364, -0.881859, -0.586491, 0.541518, -0.91991, -0.86714, 0.0522957, 0.109442, -0.872013, -0.732512, 0.392731, -0.21651, 0.0309933, 0.77769, -0.276181, -0.998304, 0.371796, 0.395127, -0.215098, 0.951735, -0.444409, -0.638113, 0.849063, 0.73168, 0.451352, 0.520654, -0.364504, -0.987687, -0.493583, 0.87289, 0.0946721, -0.718116, 0.970846, 0.866012, -0.962749, -0.921577, -0.974461, -0.371934, -0.101319, -0.20902, -0.807557, 0.969672, -0.872872, 0.713545, -0.988912, 0.89836, 0.700093, -0.644096, -0.322272, 0.100621, -0.744514, -0.567099, 0.300637, -0.621545, -0.543525, 0.236613, 0.724133, 0.544334, -0.192591, 0.983361, -0.948779, 0.737968, -0.651503, 0.987064, 0.44917, -0.334802, 0.98375, -0.970799, 0.345383, 0.0544368, -0.292945, -0.621015, 0.379378, -0.301277, -0.250732, 0.384586, -0.316853, -0.682727, -0.825543, 0.75053, -0.0687563, 0.993229, 0.55433, 0.522068, -0.943891, -0.870538, -0.151008, -0.465392, -0.562539, -0.41423, -0.254175, 0.982012, 0.372457, 0.814685, -0.394171, -0.12465, -0.851523, -0.377439, 0.959177, 0.67442, -0.81604, -0.490888, 0.269137, 0.704112, 0.1803, 0.594717, 0.516013, 0.939917, -0.629667, 0.249281, 0.925064, 0.462682, -0.0380016, 0.472157, -0.180422, 0.728535, -0.252057, 0.400113, -0.654123, 0.374738, -0.449845, -0.212802, 0.687499, 0.160652, 0.795033, 0.129205, -0.412319, 0.239044, 0.1422, 0.790529, -0.0875608, -0.106325, 0.191631, 0.117129, 0.552369, -0.677053, 0.842455, -0.521993, -0.56798, -0.664684, 0.075325, 0.351526, -0.134296, -0.769533, 0.731079, 0.704663, -0.758472, 0.603177, 0.136709, -0.0281274, 0.198832, 0.564594, 0.0775797, -0.837421, 0.02491, 0.813274, 0.347046, 0.774943, 0.647279, 0.498054, -0.286272, -0.245207, 0.301566, -0.771886, 0.0598103, 0.123985, -0.638262, 0.868142, 0.285244, -0.838345, 0.77273, 0.515807, -0.769456, -0.947986, -0.653998, -0.699963, 0.755776, 0.0491723, -0.42318, -0.348166, 0.882094, -0.517125, 0.601465, -0.653002, -0.546377, 0.576829, -0.590001, -0.59925, -0.553521, -0.0815541, 0.0816478, -0.630633, 0.569138, -0.41975, -0.181738, 0.954266, -0.641503, -0.192131, -0.715875, -0.816478, 0.058247, 0.0120898, -0.00799538, 0.828695, -0.873356, 0.425091, -0.148842, 0.807028, 0.826446, 0.614284, -0.00105817, -0.62107, 0.63445, -0.257262, -0.698878, 0.23846, -0.297961, -0.60899, 0.535543, 0.178335, -0.064298, 0.246888, 0.14038, 0.686781, 0.802873, -0.593504, -0.359518, -0.195756, 0.685849, -0.219377, -0.286808, 0.633473, -0.958374, -0.159497, -0.164813, -0.0513036, 0.627142, -0.998573, 0.0793053, 0.0715984, -0.28036, 0.163522, -0.000413954, -0.521188, 0.688792, 0.210919, -0.151459, -0.411286, -0.242316, 0.528012, -0.123879, 0.856368, -0.208901, 0.368077, -0.587947, 0.194449, 0.991888, -0.646772, 0.895084, -0.0859823, 0.353321, 0.903142, 0.889003, 0.532384, -0.72337, -0.101276, 0.388972, -0.853833, -0.862374, 0.334278, -0.324727, 0.951421, -0.84, -0.536825, 0.525447, -0.871795, 0.843484, -0.945181, -0.644797, 0.992843, -0.874371, 0.949363, -0.565949, 0.581041, 0.546799, -0.463725, 0.224171, 0.997607, 0.315902, 0.613504, -0.454469, 0.583297, 0.0968078, -0.580212, -0.631153, -0.369413, 0.176348, 0.425672, 0.466352, -0.107361, -0.405419, 0.0460136, 0.917954, 0.280697, -0.206597, -0.792602, 0.629712, -0.302169, -0.688157, 0.00631656, -0.199151, -0.0881785, 0.959251, -0.607323, -0.855802, -0.773111, -0.893198, 0.43638, -0.649488, -0.188353, -0.70579, 0.316284, 0.670897, 0.581299, 0.126192, 0.845627, 0.842541, -0.756881, 0.79321, 0.588814, -0.915501, -0.348941, 0.667306, 0.475423, -0.782546, -0.603859, 0.449937, 0.937654, -0.719013, -0.621321, 0.287726, 0.351941, 0.739061, 0.274199, -0.628104, -0.871328, 0.13343, 0.906923, -0.954164, 0.398616, 0.404761, -0.237349, 0.784439, 0.826823, 0.00933649, -0.743851, 0.179427, -0.143234, 0.983194, 0.647877, -0.304681, -0.0755642, 0.127959, -0.0752331, -0.794986, -0.0436444, -0.923679, -0.504872, 0.817637, -0.643359, 0.244289, 0.917105, 0.72918, -0.156869, 0.570546, -0.915526, -0.805422, -0.347324, -0.724226, 0.312841, 0.293174, 0.659582, -0.970804, -0.53199, -0.289912, -0.569081, 0.738346, 0.652435, -0.647371, 0.27667, 0.126921, -0.925722, 0.796437, -0.252212, -0.75592, -0.568041, -0.593985, 0.126725, -0.306869, -0.200834, 0.644753, -0.331909, -0.699278, -0.978362, -0.323174, 0.0127131, -0.591083, -0.121496, -0.119581, 0.507673, -0.444506, -0.912907, -0.154382, -0.225409, 0.925137, 0.470603, 0.0488255, 0.297098, -0.943199, -0.327472, -0.14933, 0.118224, 0.35088, -0.772412, 0.279506, -0.0250033, 0.556727, 0.502455, -0.686247, 0.54432, 0.524617, 0.349936, 0.934608, -0.381923, 0.66836, 0.670917, -0.457265, 0.0169625, 0.345538, 0.715472, 0.932322, 0.128305, -0.447633, -0.81692, -0.197824, 0.342158, -0.939931, 0.683959, -0.922276, -0.706793, 0.623235, 0.0607193, -0.511782, 0.412824, -0.900045, 0.879937, 0.237194, 0.970633, 0.573995, -0.857953, -0.590543, 0.567392, -0.754238, -0.876832, 0.717716, -0.55379, 0.838817, 0.973549, 0.682048, -0.180065, 0.565481, 0.973283, 0.14326, -0.77733, 0.700256, -0.803793, -0.87439, 0.864511, 0.615127, -0.0838455, -0.858889, 0.461482, -0.0140491, -0.499144, 0.74344, 0.398437, 0.00855043, -0.581254, 0.53842, -0.771748, -0.958946, 0.815258, 0.460413, 0.462088, -0.64378, -0.694244, 0.461004, -0.848819, -0.00119008, -0.181385, 0.717822, -0.493771, -0.908965, 0.427277, -0.807655, -0.0779538, -0.563622, -0.407488, -0.209966, 0.120583, -0.605331, -0.95196, 0.268937, -0.836847, -0.663955, 0.75067, 0.0238293, -0.620823, 0.794234, 0.624764, 0.57353, 0.171762, 0.682952, -0.100879, 0.356333, 0.689696, 0.365283, 0.564562, -0.761934, -0.978729, 0.285587, 0.069202, -0.876128, -0.825134, 0.420023, -0.858418, 0.905684, -0.562803, 0.835023, -0.0231444, -0.0395309, 0.219261, -0.269324, 0.812345, -0.70844, 0.379034, -0.284413, -0.203698, -0.0923922, 0.781707, -0.0123853, -0.798325, -0.11016, -0.162849, 0.93916, -0.362646, 0.725207, -0.835034, 0.300619, -0.502065, -0.642197, 0.659151, -0.630173, -0.866026, -0.561324, 0.733524, -0.340973, 0.593124, -0.0613959, -0.285158, -0.193899, -0.894248, -0.637529, -0.96789, 0.828508, 0.95726, 0.709062, 0.865511, -0.826261, 0.493724, 0.825784, 0.137068, 0.260868, -0.306764, 0.946195, -0.0668845, -0.507602, -0.984709, 0.863937, -0.426844, 0.0774209, 0.0382062, 0.628209, -0.125464, 0.180265, -0.370488, 0.529707, 0.883862, 0.475634, 0.314461, -0.0370751, 0.822668, 0.355649, -0.250918, 0.218818, 0.57389, -0.590969, -0.162843, 0.467548, -0.389764, -0.243358, 0.815262, -0.483728, -0.311633, 0.42259, -0.533941, 0.257749, 0.86946, 0.376601, 0.808207, -0.253163, 0.780806, 0.306707, 0.929415, 0.399225, -0.372187, -0.858953, -0.921143, 0.964808, -0.808147, -0.723341, 0.00208925, 0.413966, 0.144564, -0.944836, 0.394068, -0.392659, 0.986551, -0.620126, 0.602685, 0.630511, -0.986627, -0.664848, -0.75484, -0.245515, -0.526158, -0.46028, 0.72524, -0.936458, -0.120293, 0.748443, 0.11397, -0.964484, 0.810749, -0.305735, -0.782504, 0.902161, -0.486209, -0.0524782, 0.255884, -0.35602, -0.890577, -0.972019, -0.283693, -0.0784637, -0.646703, -0.574052, 0.966846, 0.673394, -0.235434, 0.415874, 0.0442394, 0.173395, -0.92704, -0.562665, -0.330357, -0.589286, -0.538438, 0.781478, -0.607247, 0.405069, -0.51669, 0.0960969, 0.931713, 0.734162, 0.33999, -0.705343, -0.766243, -0.75056, -0.960202, -0.116651, 0.759314, -0.465452, 0.663494, 0.96105, -0.662791, 0.656344, 0.0124867, -0.573297, -0.830102, 0.517854, -0.638566, 0.953169, 0.117812, -0.029429, -0.904502, -0.746969, -0.36585, 0.314075, 0.943457, -0.0716839, 0.998952, -0.6522, -0.83112, 0.757116, 0.752558, -0.16208, 0.0189724, -0.0932395, 0.265519, 0.650221, 0.223854, 0.438125, -0.767287, -0.562527, 0.83538, -0.0398207, 0.252594, -0.662463, -0.402111, 0.320984, -0.893469, -0.0189501, -0.86777, 0.727654, 0.757212, 0.304916, -0.228592, 0.658454, -0.201072, -0.127766, -0.530648, -0.0470317, -0.905384, -0.141259, -0.733317, -0.744134, 0.679016, 0.503555, -0.296219, -0.314717, 0.837691, 0.0913987, -0.278617, -0.64485, 0.0866889, 0.946309, 0.0795931, 0.409852, -0.545465, 0.129683, 0.176591, 0.623903, 0.514004, -0.566256, -0.00793783, -0.555185, -0.382179, -0.692941, 0.258743, -0.671549, -0.0775763, 0.0657801, -0.486006, -0.286375, -0.789294, -0.219465, 0.302454, -0.63734, -0.442526, 0.791501, 0.477111, -0.446233, -0.745768, 0.404394, 0.287584, 0.335572, 0.996144, 0.449315, 0.164972, 0.5368, 0.270756, -0.00379354, -0.372871, -0.338123, 0.170582, 0.272814, 0.053324, -0.302903, 0.568202, 0.346851, -0.285113, -0.588316, 0.924096, 0.762982, -0.121331, -0.158159, -0.829349, 0.622623, -0.99822, 0.590291, 0.810437, -0.541155, -0.11928, -0.314282, -0.00104692, -0.0952445, 0.582874, 0.69087, 0.279189, -0.158009, 0.11196, -0.352547, -0.643572, -0.931892, 0.800234, 0.645949, -0.801654, -0.124638, -0.237215, 0.162565, 0.0640886, 0.0807205, 0.0531451, 0.318059, 0.422125, 0.753131, -0.53634, -0.82963, 0.940912, 0.388282, 0.29838, 0.34881, 0.213865, -0.833463, 0.594736, 0.517558, -0.581089, -0.871922, -0.674954, -0.122667, -0.816595, 0.690325, -0.871737, 0.83943, -0.282445, 0.115081, 0.843785, 0.266419, 0.198723, -0.519676, -0.417435, 0.955157, 0.768867, -0.698342, 0.444049, -0.853193, 0.455538, 0.535089, 0.712643, 0.167701, -0.359085, -0.754647, 0.101472, -0.0685119, -0.0305519, 0.229008, -0.929855, -0.74858, -0.754857, 0.781842, 0.337311, -0.343008, 0.828778, 0.392411, 0.971222, 0.140038, -0.72412, 0.592678, -0.153734, 0.167698, -0.230619, 0.880839, -0.773454, -0.263749, -0.322562, 0.222388, -0.0911456, 0.288435, -0.599346, 0.0915945, -0.387082, -0.912237, -0.882678, 0.939885, 0.197551, 0.0877802, 0.97463, -0.64261, -0.159738, -0.737463, 0.51233, 0.812365, -0.73832, 0.490384, 0.204339, -0.196986, 0.134259, 0.673596, 0.564433, 0.768265, -0.390889, -0.417268, 0.076777, -0.715259, 0.153389, 0.166114, 0.21094, -0.391168, -0.712225, 0.280497, -0.140419, 0.360103, 0.0202481, -0.0686728, 0.616429, -0.0566477, -0.586323, -0.832758, -0.718887, -0.429839, -0.33445, -0.710816, 0.0541734, 0.117523, -0.15128, 0.635324, 0.0192775, -0.620757, -0.730627, 0.669552, -0.727328, -0.212019, 0.779951, 0.18884, 0.616916, 0.327735, 0.196158, 0.152637, 0.451609, 0.538911, -0.281376, -0.881719, 0.933453, -0.729445, -0.269708, 0.18641, -0.00124994, 0.0424044, 0.472348, -0.839245, 0.846115, 0.541549, -0.894434, 0.747129, 0.15654, -0.292599, -0.735742, -0.219099, -0.934936, 0.822543, -0.922538, -0.51773, 0.441893, -0.430586, -0.499097, 0.0700287, -0.439828, 0.413496, -0.9746, -0.542669, 0.622348, 0.305298, -0.856931, -0.839924, 0.0295252, 0.0631426, 0.157933, -0.924792, 0.335062, -0.0237052, 0.754564, 0.758652, 0.854755, -0.49363, -0.586028, 0.587854, 0.810599, -0.507452, -0.313994, -0.708561, 0.982873, 0.72559, 0.068074, 0.245242, 0.60448, -0.262479, -0.423413, 0.0683857, -0.909465, 0.111927, -0.337018, -0.927789, 0.662517, -0.351838, 0.895173, -0.882006, -0.870541, -0.648435, 0.279569, -0.253757, 0.801369, 0.818811, -0.804437, -0.935256, -0.241588, 0.865901, 0.61876, -0.249552, -0.404388, 0.0965528, -0.397705, 0.799966, -0.68966, 0.982281, 0.904361, 0.0910138, 0.186539, -0.550494, 0.710037, -0.634842, 0.656233, 0.343433, 0.698044, -0.0839659, 0.342808, -0.672983, 0.392878, 0.456657, 0.901408, 0.0323292, -0.906968, -0.556787, -0.790942, 0.953845, 0.0590578, 0.725832, 0.608233, -0.475181, 0.0899669, -0.174005, -0.44183, -0.186713, -0.891564, 0.236554, 0.778856, -0.296743, -0.338619, -0.0952241, -0.49769, -0.728835, 0.327731, -0.585519, 0.502805, 0.143338, 0.327561, 0.23486, -0.304006, 0.453212, 0.17022, -0.505849, 0.93049, 0.845753, -0.408243, 0.958853, -0.556178, -0.556027, 0.827372, -0.46569, 0.656813, -0.927254, 0.291937, 0.30439, -0.612035, 0.420413, -0.56287, 0.0348732, 0.650014, 0.587636, 0.825575, 0.56028, 0.62145, 0.73399, 0.71168, 0.0208738, 0.0281862, -0.433385, -0.983005, -0.374518, 0.247888, -0.831009, -0.410732, -0.322233, 0.328105, -0.354789, -0.0578667, 0.763405, 0.352163, 0.782723, -0.424346, -0.483676, -0.201082, -0.0495998, 0.138243, 0.187942, -0.341934, 0.352725, 0.106347, 0.792097, -0.935467, 0.43269, 0.20951, 0.56962, 0.273491, -0.933607, 0.112652, 0.964234, -0.155501, -0.998553, 0.138578, 0.362998, 0.204384, 0.42095, -0.837897, -0.598768, -0.352649, -0.442596, -0.916805, -0.486606, -0.453143, 0.0461544, -0.717754, 0.231233, -0.0957824, -0.407962, -0.0294551, 0.494747, -0.321687, 0.131014, 0.726526, -0.38626, 0.96278, -0.740937, 0.577776, 0.0544875, -0.434232, 0.445918, -0.101488, -0.581921, 0.60399, 0.449685, 0.182099, 0.517494, 0.791905, 0.915511, 0.379815, -0.835442, 0.188359, -0.0195852, -0.296678, 0.656835, 0.734655, -0.500175, 0.294389, 0.985227, -0.498086, 0.356107, 0.258154, 0.968518, 0.586413, 0.816171, -0.709303, 0.483476, 0.678779, -0.441454, -0.874754, -0.233325, -0.00337027, -0.69521, -0.795779, -0.734398, -0.231964, -0.765446, -0.427162, 0.684499, 0.878967, -0.748424, 0.19144, 0.679486, 0.964265, -0.486854, -0.293079, -0.272222, 0.187633, 0.506042, -0.00512602, -0.176312, -0.460808, 0.952571, -0.246768, 0.185028, -0.761069, 0.682402, 0.756544, -0.955274, -0.517548, 0.957539, -0.602766, -0.51882, -0.446855, -0.610411, -0.277757, 0.161815, -0.287991, -0.815925, -0.0304342, -0.521478, -0.457388, 0.994565, -0.543142, -0.863012, -0.985145, 0.5611, -0.0407396, 0.0350591, 0.678026, 0.19782, 0.637385, -0.132178, -0.786714, 0.893938, 0.579013, 0.500845, -0.977102, -0.89204, -0.00557278, -0.57404, -0.681639, -0.465234, 0.906349, -0.367573, -0.746725, 0.346162, -0.280127, -0.376015, 0.270101, -0.365009, 0.407249, 0.364299, 0.203257, 0.731404, 0.0872692, 0.200908, 0.201801, 0.50514, -0.520686, -0.981343, -0.67443, -0.601377, -0.269487, -0.921004, -0.53257, 0.0495508, 0.914422, -0.859273, -0.842485, 0.19258, 0.800519, -0.259419, 0.380803, 0.418031, 0.399739, -0.79804, 0.925787, -0.866243, 0.325026, -0.107714, 0.832501, -0.661657, 0.640147, -0.0687349, 0.577312, 0.141382, 0.28229, -0.975712, -0.820634, 0.180771, 0.775819, -0.373007, 0.390525, -0.0558504, 0.269287, -0.653275, 0.299122, 0.0587333, 0.464902, 0.173744, -0.826919, 0.922714, -0.77369, -0.619683, 0.82607, -0.974262, 0.481041, 0.935594, -0.42248, -0.499169, 0.615028, 0.190407, -0.270311, 0.846357, 0.0280537, 0.736319, -0.964127, 0.273716, -0.750889, 0.440391, 0.198309, -0.0100628, 0.209248, 0.437411, -0.193023, 0.471553, 0.745997, -0.855341, -0.0983066, -0.790727, -0.343067, -0.517106, -0.0886086, -0.563279, 0.113494, 0.693861, 0.815385, -0.465018, -0.96423, 0.906956, 0.802511, -0.504601, -0.621944, 0.771821, -0.530532, -0.993627, 0.50674, 0.85082, 0.309605, 0.0762375, -0.56556, 0.583995, 0.997219, -0.319641, -0.713498, -0.683056, -0.936172, -0.235632, -0.598896, 0.988333, 0.910081, 0.497298, -0.354551, -0.342833, -0.0391757, 0.0183101, 0.480786, 0.659208, 0.474434, 0.174887, -0.127852, 0.605022, 0.435079, 0.899116, -0.994098, -0.761655, 0.3721, -0.16666, 0.19791, -0.545363, 0.786493, 0.468999, -0.799258, 0.238841, 0.743397, -0.0859648, -0.511288, 0.799725, -0.591307, 0.845145, 0.843803, -0.723696, 0.899959, 0.438172, 0.0479185, 0.814711, 0.515305, 0.537437, -0.255506, 0.980313, 0.193436, -0.73493, 0.933986, 0.487062, 0.239595, 0.366148, 0.177764, 0.157208, 0.102589, 0.717493, -0.187854, 0.603762, 0.494024, 0.368923, 0.638304, -0.386532, -0.0630225, 0.370191, 0.0683671, -0.641071, -0.274552, 0.97994, -0.673576, 0.987461, 0.447649, 0.0566181, -0.934359, -0.0413296, 0.888192, -0.0819051, 0.246243, 0.0575546, -0.253075, -0.746893, -0.352677, -0.210712, -0.790648, 0.959578, 0.438645, -0.714399, 0.828285, -0.931939, -0.347848, 0.7971, -0.865959, -0.868477, 0.827121, -0.690781, 0.257724, 0.357125, -0.336133, 0.669991, -0.717281, -0.644978, -0.776438, 0.225166, 0.309294, -0.318597, -0.93214, -0.450755, -0.97756, 0.880575, -0.139635, -0.964237, -0.10894, 0.326612, -0.921973, -0.0881385, -0.469129, 0.995887, 0.782307, -0.710961, 0.452264, 0.552346, -0.0465873, 0.636287, 0.324596, -0.174781, 0.602913, 0.00908093, -0.367588, 0.894731, -0.383826, -0.0646434, -0.950691, -0.970133, -0.355053, 0.0711053, 0.23248, 0.0664711, -0.0587311, 0.111861, -0.60175, 0.972101, -0.763463, 0.0291195, -0.440726, 0.534697, -0.817849, 0.871389, 0.26363, 0.0816416, 0.606443, -0.518295, -0.0557311, -0.22017, -0.751294, 0.775243, 0.0215409, -0.305868, 0.131992, 0.694357, -0.706963, 0.854227, -0.0533278, -0.274019, 0.666726, -0.635889, -0.105341, -0.412745, 0.222917, 0.213111, -0.704293, -0.639088, -0.694031, -0.721208, 0.826117, 0.823335, 0.353389, 0.849573, -0.332341, -0.0451788, 0.145476, -0.501821, 0.664186, 0.0264779, -0.951608, -0.984981, -0.956298, 0.85389, -0.926993, 0.985259, -0.793151, 0.367608, -0.179299, -0.0663228, -0.267999, 0.694064, -0.81643, 0.284279, -0.237554, 0.0973474, -0.374092, -0.603178, 0.353134, -0.827389, 0.192735},
-	{0.847018, -0.856635, 0.673821, 0.53086, -0.0143022, -0.669264, 0.446308, 0.904194, -0.613029, 0.90227, -0.807079, -0.237572, 0.497752, 0.248822, -0.554917, 0.697401, -0.135875, 0.618159, 0.971595, 0.376959, -0.327249, -0.721515, -0.827911, 0.308329, 0.748889, -0.626012, 0.490406, 0.49279, -0.144503, 0.696008, -0.461404, -0.731093, 0.313611, 0.491354, 0.958844, 0.0864002, -0.866369, -0.602164, 0.350679, 0.387654, 0.46471, -0.768325, 0.667225, -0.983712, -0.0408253, -0.255792, 0.495784, -0.889988, -0.697823, -0.160052, 0.144133, -0.767538, 0.0166974, 0.207889, -0.692393, -0.825314, -0.172784, 0.727739, -0.343919, 0.846774, -0.221164, 0.0474789, 0.322681, 0.0500397, -0.333296, -0.294492, 0.0667052, -0.385451, 0.964426, -0.622864, -0.778345, 0.890452, 0.405711, 0.192127, 0.700133, 0.854829, -0.055057, 0.816302, -0.358639, -0.632102, 0.72298, 0.369869, -0.35452, -0.655156, -0.943142, -0.962332, -0.297124, 0.578694, 0.204149, 0.708223, 0.368907, -0.0501792, 0.814805, -0.466641, -0.851535, -0.479077, -0.409185, 0.930478, 0.695201, -0.391909, 0.334202, -0.13916, -0.128296, 0.634431, 0.0398789, -0.20694, -0.178354, -0.727247, 0.908038, 0.148297, -0.312481, -0.410735, 0.602741, -0.250291, -0.630637, -0.389583, 0.839679, 0.967626, -0.210127, -0.225004, 0.931823, -0.0322162, -0.837987, 0.285256, 0.231619, 0.538104, 0.912758, -0.957533, 0.216963, -0.781014, -0.334805, -0.896775, -0.390601, 0.993899, 0.422628, -0.464544, -0.592977, 0.392428, 0.808395, 0.613252, 0.0693805, -0.324909, -0.317335, 0.928118, 0.731354, -0.13561, 0.416861, -0.319406, -0.948067, 0.748894, -0.60205, 0.916056, 0.137059, 0.104755, 0.259205, 0.909139, 0.144884, -0.956697, -0.939722, 0.531097, -0.389908, 0.932989, -0.412243, 0.997223, 0.106003, 0.321281, -0.578013, -0.879349, 0.97987, -0.400353, 0.327763, 0.719761, 0.606958, -0.285707, -0.820307, 0.222459, 0.845399, -0.725448, -0.0608716, 0.852544, -0.716734, 0.846694, 0.600842, 0.219603, 0.8935, 0.498566, 0.972213, 0.84343, -0.0913893, 0.833534, -0.795778, -0.655703, -0.532964, -0.387492, 0.486032, -0.593698, 0.3067, -0.850027, 0.118052, -0.3669, 0.241129, -0.263853, -0.0157606, 0.68026, 0.45918, -0.750698, 0.86553, 0.686885, -0.569469, 0.916712, -0.63455, -0.0271014, 0.966625, -0.0793633, -0.278298, -0.457176, 0.932451, 0.815825, -0.0262342, -0.254826, 0.1255, 0.085899, -0.13524, 0.0762779, -0.141167, 0.80539, 0.393359, -0.528719, -0.0664969, -0.141473, 0.87976, 0.627257, 0.0180754, -0.269858, -0.972099, -0.153222, 0.314959, 0.592168, -0.380851, -0.891284, 0.0318026, -0.326199, 0.795811, 0.159625, -0.20013, -0.492574, -0.417796, -0.752, 0.145566, -0.394141, 0.797867, 0.5886, -0.557879, 0.436216, 0.944605, -0.793082, -0.245632, 0.739422, -0.136619, -0.984483, -0.989738, 0.928065, -0.626638, 0.0899445, 0.439854, 0.157285, 0.907017, 0.656156, 0.793992, -0.974532, -0.196559, 0.805572, 0.605082, 0.623556, 0.796718, -0.866566, 0.295989, 0.6499, 0.637321, -0.0853008, -0.0858861, -0.158068, -0.347836, 0.125899, -0.876172, -0.756867, -0.315599, -0.104313, -0.810998, -0.0707769, 0.800171, 0.285024, 0.25205, -0.425779, 0.079331, 0.171245, -0.231383, -0.719845, 0.286956, 0.69676, 0.894539, -0.948181, 0.377847, -0.858327, 0.0233555, 0.193223, -0.229955, -0.878418, 0.109774, -0.439489, 0.708869, 0.08535, 0.431268, 0.452793, -0.0899902, -0.926502, 0.661193, 0.38047, 0.943248, 0.84326, -0.552775, 0.0659272, -0.925988, 0.894612, 0.692227, 0.355327, 0.362671, 0.578903, -0.951842, -0.777539, 0.979019, -0.0282648, 0.218795, 0.713283, 0.94232, -0.321405, -0.137188, -0.467033, -0.804747, 0.122065, -0.756611, -0.925324, -0.967563, 0.549122, -0.454276, 0.638694, 0.791442, -0.298454, -0.547591, -0.275491, 0.183831, 0.541957, -0.359562, -0.235795, -0.708701, -0.41852, -0.577096, 0.280743, -0.609715, -0.74978, 0.906814, 0.49176, -0.352733, -0.540018, 0.925824, -0.0811226, 0.0422272, -0.925169, -0.656401, -0.814666, -0.359685, -0.482351, 0.85318, 0.103448, 0.908145, -0.330597, -0.709627, 0.658841, 0.242183, 0.952414, -0.811449, -0.88881, 0.771065, 0.328226, -0.857368, 0.896635, 0.0019434, -0.329297, 0.964405, -0.41573, -0.35026, 0.554626, -0.329754, 0.962877, 0.586971, -0.685253, 0.300723, -0.582479, -0.769724, -0.000841583, -0.841077, -0.730333, -0.894369, -0.928897, -0.735099, 0.457465, -0.477398, 0.0526187, 0.796364, -0.161383, -0.401348, 0.19558, -0.248885, 0.22284, -0.901933, -0.276837, -0.106659, -0.969147, 0.648099, 0.916572, -0.878169, 0.478743, 0.132283, 0.957154, 0.411529, 0.882689, 0.155966, -0.447602, 0.928014, -0.777519, 0.210785, -0.388642, 0.767586, -0.0762482, 0.799431, -0.763365, -0.519849, 0.689613, -0.590414, -0.40291, -0.0477542, 0.842919, -0.953821, 0.371856, -0.67343, 0.822144, -0.991097, 0.560598, 0.196176, 0.819894, -0.146478, -0.400719, 0.556672, -0.445939, -0.091303, -0.655612, -0.926099, 0.579598, -0.437183, 0.220346, -0.0502438, 0.0866894, 0.928273, -0.646567, 0.581429, 0.505052, 0.353566, -0.0177431, -0.905716, 0.667401, 0.671997, 0.904103, 0.440807, 0.540698, 0.554968, -0.199922, -0.637921, 0.705874, 0.249418, -0.518315, -0.587367, 0.337289, 0.187799, 0.0792791, 0.088207, -0.947071, 0.825518, 0.609009, -0.862673, 0.559027, -0.483151, 0.670729, -0.587617, -0.0326693, -0.897679, 0.476572, -0.959756, 0.333129, 0.550687, 0.692527, -0.162551, 0.267807, 0.0513422, 0.990248, -0.053591, 0.275773, 0.683776, -0.412586, -0.361356, 0.423179, -0.68161, -0.508073, 0.916787, 0.384141, -0.732596, -0.678651, 0.100787, 0.593439, -0.694997, 0.802696, -0.97768, -0.148996, -0.602943, -0.35542, 0.2789, 0.731591, 0.683194, -0.97175, -0.81126, -0.370505, 0.92073, -0.095697, 0.798842, -0.955904, 0.506621, 0.492935, 0.543308, -0.862335, 0.0630988, -0.342142, 0.99061, 0.55149, 0.105981, 0.0229953, -0.817529, -0.351409, -0.0736732, 0.0135411, 0.89591, -0.82257, 0.822779, 0.649545, -0.709937, 0.758597, -0.221422, -0.648909, -0.555553, -0.857253, 0.261837, 0.473262, 0.335271, 0.806135, 0.935166, 0.393808, -0.26643, -0.978602, -0.362731, -0.166984, -0.926406, -0.537951, -0.630769, -0.599248, 0.593349, -0.611778, -0.0278526, -0.611814, 0.13975, 0.88127, -0.211749, -0.616062, 0.911284, -0.095299, 0.0300165, 0.753861, -0.540586, -0.628453, 0.145604, 0.241498, -0.771053, -0.0729252, -0.403721, 0.843205, 0.173186, -0.558407, 0.279184, -0.987696, -0.0171086, -0.521509, -0.361949, 0.842012, -0.678056, 0.56377, 0.0363298, 0.950686, 0.7143, -0.148226, -0.029103, -0.196921, 0.922218, -0.589819, -0.0596302, 0.684497, 0.294194, -0.394453, -0.485608, 0.187091, -0.234293, -0.391942, 0.69938, -0.833254, -0.788905, 0.695521, -0.785903, 0.912484, 0.691713, 0.287366, -0.19767, -0.144765, -0.0398633, -0.223443, 0.630759, 0.978787, -0.0761496, -0.486891, -0.618856, 0.565786, -0.962416, 0.399791, 0.362695, 0.207193, -0.316787, 0.856027, -0.697539, -0.235426, 0.726254, 0.932309, 0.862976, 0.868162, -0.14972, 0.791903, 0.556708, -0.82265, -0.912087, 0.124025, 0.511069, -0.705359, -0.564576, -0.754808, -0.837207, 0.0342083, 0.122995, -0.492809, -0.991876, 0.42747, -0.385308, -0.24953, -0.455106, 0.717318, -0.973703, 0.563789, 0.277736, -0.0148197, -0.651302, -0.158461, -0.849158, -0.0953328, 0.548044, 0.0227042, 0.41128, -0.772396, -0.47055, -0.257403, -0.194582, -0.988475, -0.224601, -0.525876, 0.928878, -0.101182, 0.958837, 0.540928, -0.646576, -0.0374995, 0.615263, 0.934447, -0.519239, 0.187059, -0.260767, -0.434575, 0.0560511, -0.148557, -0.51486, -0.717549, 0.208178, -0.268663, -0.837248, -0.142499, 0.331553, -0.838244, -0.0034282, 0.565764, 0.906873, -0.112745, 0.672979, 0.629365, 0.547718, 0.00588859, 0.99314, -0.943193, 0.741695, -0.196205, 0.262466, -0.642928, -0.262519, 0.678355, -0.372846, -0.570077, 0.878607, 0.0352186, 0.322501, -0.369701, -0.185623, -0.307098, -0.242892, 0.939133, -0.895869, -0.831078, -0.799206, 0.771568, -0.129884, -0.654469, -0.5126, -0.435579, -0.159288, 0.910603, -0.58693, -0.308963, -0.594381, 0.82172, 0.475095, 0.614073, -0.925202, 0.893084, 0.0379315, 0.0222608, 0.761361, 0.248213, -0.205945, 0.85989, -0.890914, 0.940475, -0.429226, 0.210547, 0.0491745, 0.192987, 0.747215, 0.939968, 0.408276, 0.418911, -0.711652, 0.455222, -0.870496, 0.197593, -0.899731, -0.142044, 0.534424, -0.75202, 0.833232, -0.178328, 0.324507, -0.200724, -0.212068, -0.333789, 0.899462, 0.501655, 0.832184, 0.693214, -0.193439, 0.970805, 0.165711, -0.39379, -0.874647, -0.0190354, -0.145089, 0.668172, -0.0214681, -0.765313, 0.534681, -0.981492, -0.530527, 0.554651, 0.590494, -0.0215225, -0.242025, -0.897959, 0.174778, -0.65163, 0.984044, -0.627632, 0.744225, 0.507149, 0.274519, 0.905439, 0.971465, -0.841655, 0.86674, -0.821089, 0.489003, -0.598814, 0.375124, 0.340005, -0.538924, -0.811113, 0.533966, 0.0989643, -0.0779519, 0.874363, -0.889599, 0.501704, 0.864662, -0.719918, -0.404769, 0.90239, -0.695304, 0.841733, -0.709079, -0.392281, 0.0123799, -0.87066, 0.784806, 0.236756, -0.210778, 0.725163, -0.880383, 0.159191, -0.772517, -0.140054, 0.184319, -0.862254, -0.313388, -0.926126, 0.653234, -0.0786757, -0.729855, -0.81005, -0.802834, 0.212966, 0.664087, 0.221992, 0.108067, 0.564734, 0.00115711, 0.764775, -0.65009, -0.592292, 0.0924175, 0.501186, -0.774922, 0.981282, -0.059718, 0.1232, -0.134716, -0.640906, -0.862307, -0.113605, -0.244641, -0.134392, -0.714459, 0.161952, 0.581378, -0.136004, 0.308253, -0.132742, -0.959081, -0.377749, -0.264043, 0.818009, 0.0749884, 0.274951, 0.477216, 0.347743, 0.729599, 0.87191, 0.394598, -0.152585, -0.38854, 0.177453, 0.0201759, -0.213256, -0.323938, 0.490811, -0.12897, -0.555955, -0.00373475, 0.0882706, 0.389563, 0.35345, -0.865276, -0.137728, -0.175503, -0.738495, -0.527593, -0.670936, 0.765291, 0.23741, -0.97772, -0.152915, 0.18551, -0.45699, 0.877956, 0.0589944, -0.853233, -0.179039, 0.0821256, 0.2308, -0.0680775, 0.817473, -0.899475, 0.602461, 0.795222, -0.440391, 0.768865, 0.646238, 0.170518, -0.180697, 0.136489, -0.772857, 0.150688, 0.941261, -0.802357, 0.281611, 0.516147, -0.15057, 0.669716, 0.390184, 0.0688937, -0.491352, -0.463138, -0.944704, 0.414716, -0.568107, 0.807352, 0.622006, 0.61785, -0.855421, -0.666593, -0.169478, 0.997687, 0.396299, -0.521888, -0.231625, 0.323907, -0.539378, 0.398132, 0.29215, 0.311816, -0.946846, -0.0875641, -0.380425, -0.724293, -0.406002, -0.163351, 0.113157, 0.559967, 0.871593, 0.550639, 0.704363, 0.514647, 0.0310673, -0.914734, 0.08764, 0.701919, -0.394026, -0.0335508, 0.342939, -0.409897, -0.357035, 0.755944, -0.422281, -0.694428, 0.430853, 0.688203, -0.622619, 0.200117, 0.521936, 0.390143, -0.741585, 0.637492, -0.817372, -0.964953, -0.582358, -0.285514, 0.596545, 0.164834, 0.342959, 0.361715, -0.417135, 0.564927, -0.875693, 0.483742, 0.218465, 0.583275, 0.509767, -0.359129, -0.610761, 0.903076, -0.825421, 0.858591, -0.679026, 0.888607, 0.317194, 0.872167, 0.648212, 0.540246, 0.162677, 0.665079, 0.656549, 0.114468, -0.397966, -0.973775, 0.747638, 0.707301, -0.717392, -0.851034, -0.382175, -0.835939, 0.401539, -0.0264537, 0.464553, 0.0227749, -0.914835, 0.0798539, -0.320029, -0.496419, 0.389051, -0.159248, -0.843384, -0.613086, 0.745889, -0.838567, 0.473783, -0.38642, 0.285684, -0.916877, -0.996315, -0.201576, 0.575797, 0.194872, 0.626772, -0.367731, 0.463138, -0.950109, 0.99756, 0.270091, -0.375289, -0.629661, 0.0774245, -0.738914, 0.791948, 0.0697293, -0.75844, 0.190398, 0.558819, 0.575258, -0.388078, 0.301792, -0.0209748, 0.303926, -0.526702, 0.337096, 0.334232, 0.69786, -0.671939, 0.845967, 0.212241, -0.0585897, 0.824594, -0.429127, 0.686779, 0.179871, -0.307786, 0.504619, 0.321909, 0.903765, 0.830342, -0.937632, 0.258616, 0.441662, -0.160705, 0.870554, 0.299253, -0.469728, 0.448946, -0.475325, -0.665976, -0.379122, -0.892432, -0.56507, -0.728656, -0.754773, -0.248599, 0.211275, -0.904559, 0.265896, 0.793433, 0.889611, 0.550548, 0.736111, 0.980622, -0.681439, -0.600472, -0.170535, -0.996577, -0.238432, 0.80281, -0.573131, -0.0362199, -0.353614, 0.1958, -0.780111, -0.382503, 0.899389, -0.483488, 0.00462977, 0.764674, -0.977754, -0.541052, -0.817297, -0.554296, 0.906863, -0.295844, 0.40015, -0.448241, -0.739198, 0.187891, -0.610683, -0.782903, 0.820041, -0.487507, -0.686825, -0.645162, 0.638336, -0.424969, 0.313545, -0.201499, 0.664016, -0.743533, 0.838717, 0.116206, 0.241999, 0.479777, 0.566362, -0.089021, 0.21841, -0.967244, 0.303878, 0.0951339, 0.664191, 0.59807, 0.842436, 0.781399, -0.696623, -0.849803, 0.951213, -0.696288, 0.996553, 0.412384, -0.0677675, 0.681687, 0.0872373, 0.97781, -0.417184, -0.353357, 0.10038, -0.833135, -0.857282, 0.0967417, 0.420929, 0.664434, -0.751331, -0.831403, -0.331541, 0.0741715, -0.108762, 0.725858, 0.546241, -0.428011, 0.59822, -0.276977, 0.531058, -0.273497, 0.128818, 0.940386, 0.15833, 0.608936, -0.634072, 0.289959, 0.638394, 0.0221922, -0.805507, -0.433812, -0.246419, -0.692555, -0.567598, 0.607213, -0.255853, -0.683346, -0.674803, 0.630709, 0.136151, 0.0513284, 0.144136, 0.910829, -0.994978, 0.0100131, 0.203921, -0.318505, 0.524809, -0.143575, 0.696294, 0.739839, -0.359162, -0.451902, 0.532854, 0.505105, -0.388443, 0.533322, 0.445948, 0.532874, 0.338834, 0.3331, 0.0388502, 0.871214, 0.294855, 0.502594, 0.139081, 0.381501, 0.977768, 0.254767, -0.160287, 0.310149, 0.00693808, 0.201217, -0.975708, -0.51742, -0.542121, -0.64763, -0.120762, 0.594361, 0.439997, -0.368273, 0.148035, -0.738852, 0.670407, -0.407707, 0.390356, 0.71625, 0.215802, -0.542368, -0.52425, -0.613016, 0.530947, -0.953554, -0.713042, -0.42511, -0.845554, -0.0905017, 0.891523, -0.963023, -0.473602, -0.867861, -0.131416, 0.278943, -0.306673, -0.52948, 0.617521, 0.244723, -0.193185, 0.357061, 0.60843, 0.496369, -0.601239, 0.780039, -0.428248, -0.984714, 0.886935, 0.136776, 0.456016, 0.381867, -0.622448, 0.997126, -0.798049, 0.700552, -0.206866, 0.72163, -0.777572, -0.652688, -0.203434, 0.393353, -0.558246, 0.126111, 0.770972, 0.610004, -0.768235, -0.810319, -0.394203, 0.0923279, -0.552252, -0.166114, -0.310911, -0.158306, -0.42361, -0.441734, 0.200775, 0.649679, -0.242813, 0.720838, -0.479377, 0.600855, -0.497314, 0.897251, 0.0603466, 0.424405, -0.272288, -0.323454, -0.863142, 0.870259, 0.519565, 0.731544, -0.880873, -0.143502, -0.482343, -0.481792, 0.22737, -0.258571, 0.54998, 0.216014, 0.598534, -0.937065, 0.48695, 0.34937, 0.63503, 0.251846, -0.862823, -0.777504, -0.595188, 0.0411926, 0.830963, -0.475958, 0.307547, 0.719028, 0.111458, -0.794211, 0.631673, -0.172734, 0.69179, -0.88322, 0.794382, 0.974184, -0.965661, 0.106769, 0.183939, -0.984024, -0.610672, 0.540137, -0.0373468, 0.245072, 0.877774, -0.362951, 0.829594, 0.675096, -0.417446, -0.880578, -0.36886, -0.67094, -0.0641898, 0.64973, 0.644195, -0.352224, 0.887074, 0.753487, -0.234254, 0.191842, -0.0982207, -0.461869, -0.0603549, 0.179818, -0.942686, 0.0910593, -0.63758, -0.859957, 0.785, -0.656411, 0.616577, -0.464362, -0.151414, 0.741148, 0.576279, 0.679493, -0.178737, -0.825389, -0.214797, -0.666432, -0.730739, 0.111077, 0.942564, 0.159688, -0.45064, 0.388072, -0.0608112, 0.247343, -0.500837, 0.431155, 0.574211, -0.440397, -0.464519, 0.463637, 0.870814, -0.472979, -0.408755, -0.682281, -0.492264, 0.365156, 0.996242, 0.390829, 0.867177, -0.762893, -0.611864, -0.221283, 0.986787, 0.586737, 0.0164773, 0.372796, 0.483, -0.297272, 0.966004, 0.0381768, 0.0241401, -0.19696, -0.510781, 0.996659, 0.124524, -0.00378773, 0.259124, 0.836564, 0.363498, -0.381277, -0.577285, 0.0592644, 0.713617, 0.474113, 0.0470445, -0.620641, 0.0660838, -0.974854, 0.0881769, 0.104219, -0.892322, -0.116654, 0.305009, -0.83621, 0.791584, -0.401543, 0.128475, 0.00566263, 0.987055, -0.884516, 0.856612, -0.444067, -0.0465976, -0.399139, 0.571506, 0.223541, 0.110172, 0.928859, -0.229698, -0.77628, -0.230468, 0.912868, -0.88685, 0.471534, -0.298631, 0.418332, -0.215051, -0.521425, 0.0330701, -0.317662, 0.342791, -0.774427, 0.683009, -0.793169, 0.342594, 0.185765, 0.897151, 0.648447, 0.148507, -0.643022, 0.975361, -0.835404, -0.185678, 0.458611, -0.593207, 0.428855, 0.0601642, 0.59141, -0.55713, 0.885753, -0.208551, -0.953938, -0.833243, 0.224823, 0.754077, 0.862895, -0.295702, -0.739688, -0.308418, 0.712768, 0.537835, -0.41792, -0.167399, 0.473159, 0.233503, -0.254575, 0.91197, -0.912506, -0.740143, 0.186527, 0.572133, 0.339575, -0.0928731, 0.0626905, 0.3136, -0.0393378, 0.915068, 0.0165704, -0.798483, 0.185576, -0.50903, 0.712762, -0.809871, -0.239208, 0.842702, 0.639345, -0.155852, -0.919613, -0.298368, -0.819721, 0.74116, 0.946533, 0.927634, 0.882473, -0.0334746, 0.354293, -0.840592, 0.424137, -0.692252, -0.389776, -0.0238873, 0.886835, -0.67839, 0.554973, -0.149115, -0.886679, -0.247011, -0.924683, -0.572284, -0.287186, 0.543123, 0.32932, 0.91943, 0.918607, 0.796429, 0.365168, 0.580468, -0.712128, 0.634012, -0.525561, -0.311618, 0.941071, 0.814424, -0.792236, 0.972905, 0.63995, -0.704898, 0.883347, -0.617086, -0.955772, 0.482095, 0.857179, 0.918298, -0.472975, 0.37473, 0.396923, -0.740864, 0.255515, -0.851442, -0.162937, -0.092165, -0.693312, -0.064467, 0.0142867, -0.0924811, 0.41867, -0.601802, -0.846069, -0.0572717, -0.91409, 0.426587, -0.332131, -0.200012, -0.863853, 0.975152, -0.756391, 0.766213, 0.307149, 0.343084, -0.572293, 0.411965, 0.917182, -0.896548, 0.420611, 0.382002, 0.738665, 0.987244, 0.883717, -0.244627, -0.590366, 0.573134, -0.073442, 0.988251, 0.338808, -0.639213, -0.618793, 0.741708, -0.917002, 0.580679, -0.362255, 0.696528, -0.523407, 0.932303, 0.429033, 0.76466, -0.375161, 0.543201, 0.164077, -0.369, 0.394387, -0.239671, 0.931558, -0.926454, -0.586618, -0.538869, -0.411421, 0.830003, 0.779585, -0.412571, -0.097032, -0.494375, 0.154773, -0.290513, -0.502563, 0.214442, -0.83334, 0.807276, 0.178298, -0.439503, -0.278593, -0.670071, 0.576366, -0.30814, -0.751435, 0.482163, -0.684105, 0.302626, -0.0628315, -0.179924, 0.509646, -0.459305, -0.282924, -0.401556, -0.34793, -0.56793, -0.809504, -0.135873, 0.128698, 0.799647, 0.863017, -0.594832, -0.393058, 0.477933, 0.166372, -0.435824, -0.84008, 0.343437, -0.936407, -0.791888, -0.261767, -0.250713, 0.729126, -0.346824, -0.689202, -0.838405, 0.996148, -0.610472, 0.457603, -0.782297, 0.181233, 0.182567, 0.28385, 0.228016, 0.63982, 0.261124, 0.119061, -0.288257, -0.893353, -0.145505, -0.620907, -0.80138, 0.448771, 0.858056, 0.159298, 0.955392, 0.826878, 0.388555, -0.582891, 0.98151, 0.981931, 0.619441, 0.215739, -0.723418, 0.343829, -0.118615, 0.298834, 0.808515, -0.0881845, -0.249775, 0.272824, -0.259996, 0.708054, 0.970109, -0.0986931, -0.446708, 0.552638, 0.0479944, 0.422166, 0.729804, 0.803764, 0.476586, 0.978691, -0.322793, -0.929477, -0.57144, 0.397204, -0.366825, 0.487631, -0.539244, -0.5761, 0.432604, -0.88975, 0.332564, 0.692869, 0.426596, 0.13124, -0.277891, 0.0489833, 0.00784292, -0.270175, 0.997202, 0.147566, 0.401656, 0.3335, -0.239381, -0.51729, -0.72134, -0.481411, 0.633189, 0.966167, -0.444641, 0.704513, 0.400494, -0.0401187, -0.74761, -0.939714, -0.829387, -0.988691, -0.110311, -0.408287, 0.988382, 0.651442, 0.239934, 0.501933, 0.0723251, -0.195721, -0.686286, -0.915245, -0.683324, 0.659251, -0.829456, 0.482833, 0.864938, -0.202919, 0.680635, -0.903469, 0.396824, -0.329851, -0.565066, -0.326404, -0.0788561, 0.289571, -0.596585, -0.0649802, 0.0244093, 0.176876, 0.439093, 0.534312, -0.619536, 0.76211, 0.867509, -0.0380038, 0.01942, 0.531586, 0.526044, -0.796374, -0.56037, 0.158258, 0.448498, 0.290291, -0.570366, -0.594495, 0.343695, -0.181001, 0.263648, -0.597907, 0.381318, 0.151107, -0.717541, -0.510904, 0.445058, 0.441216, 0.881827, 0.798574, -0.735304, 0.36752, -0.0997305, -0.931623, -0.735344, 0.848371, -0.606929, -0.445074, -0.604782, -0.290968, 0.31493, 0.529781, 0.161738, -0.927075, -0.647618, -0.731559, 0.409518, -0.677593, -0.20331, 0.159971, 0.494532, -0.666817, -0.874495, 0.602991, 0.439785, 0.645273, -0.312351, 0.0841862, -0.935526, 0.800437, 0.881917, -0.561336, -0.154199, 0.947285, -0.517784, 0.0562196, -0.175265, 0.163436, 0.721379, -0.94787, -0.545603, 0.558432, 0.296051, -0.308409, 0.943135, -0.847161, -0.867595, 0.208732, 0.222424, 0.178927, 0.699639, 0.497191, 0.139809, 0.979922, 0.582803, 0.950335, -0.619366, 0.166272, -0.0475878, -0.532344, -0.168213, -0.962555, 0.943993, -0.49017, -0.246836, -0.616927, 0.956482, 0.201644, 0.904043, 0.971092, 0.855415, -0.189268, 0.0243441, 0.29359, 0.442935, 0.173331, -0.0589131, -0.00713748, -0.694269, 0.927678, 0.397832, -0.71158, 0.376344, 0.111032, -0.704825, -0.0657555, 0.283458, 0.241133, -0.299713, 0.674096, -0.298683, 0.565982, -0.00925699, -0.567581, 0.180526, -0.319341, 0.024757, 0.323295, 0.635246, 0.0217261, -0.155848, 0.862309, -0.559409, -0.612306, 0.115462, -0.044395, -0.897841, -0.504589, -0.885548, -0.329322, 0.471577, 0.127639, -0.568025, -0.58042, -0.0404578, 0.169339, 0.978596, 0.918608, 0.0393823, -0.715919, -0.824628, -0.176496, -0.92633, -0.173163, -0.3989, -0.571397, 0.176318, 0.64193, 0.609534, -0.337047, 0.719581, 0.0672775, 0.701115, -0.61851, 0.577386, 0.653487, 0.334775, -0.0270792, 0.540648, -0.199421, -0.455572, 0.145872, -0.256966, -0.0833148, 0.103195, 0.276176, 0.552399, -0.671017, -0.566979, -0.560868, 0.904469, -0.903127, -0.934239, 0.176544, 0.711628, 0.232193, 0.721935, 0.966383, 0.472872, -0.108221, -0.386777, 0.439674, -0.601387, -0.614795, -0.400314, 0.0842223, 0.96191, -0.210418, 0.175425, 0.75831, 0.0564209, 0.287868, -0.620745, 0.828816, 0.779992, 0.81309, 0.649953, 0.831733, -0.305285, 0.959313, -0.512828, -0.712415, 0.886914, 0.867987, 0.719482, 0.279886, 0.496631, 0.0402971, -0.366757, 0.901848, 0.782077, 0.384715, 0.134521, -0.0542708, -0.511856, 0.0767153, 0.791331, 0.774168, 0.825577, -0.31863, -0.211596, -0.554276, -0.236534, 0.103681, -0.835657, -0.0295936, -0.952156, -0.884059, 0.0688552, 0.802045, 0.991389, 0.722564, -0.508212, -0.410775, 0.52022, -0.727817, 0.750387, 0.770538, -0.437417, -0.982212, -0.985031, -0.332487, 0.0745768, 0.2696, -0.537612, 0.272722, 0.728229, 0.258512, -0.463932, 0.521943, 0.0585437, 0.0336481, -0.947566, 0.805233, 0.285646, 0.834416, -0.348763, 0.89732, 0.359116, 0.227685, 0.940795, -0.789851, 0.585013, 0.098752, 0.220763, -0.687697, 0.0800935, 0.273481, 0.305512, -0.443303, -0.0664971, -0.725455, -0.506778, 0.117623, 0.867353, 0.651001, -0.212784, -0.640614, -0.376623, 0.847385, -0.527756, -0.895573, 0.997839, 0.162148, -0.785135, -0.686307, -0.683545, -0.538665, -0.0123906, 0.498117, 0.409692, -0.410365, 0.0350139, 0.573831, -0.40052, 0.890612, -0.0644014, -0.356836, -0.539219, 0.589046, 0.339975, 0.341262, 0.600232, -0.622659, -0.872545, 0.596758, -0.449992, 0.809348, -0.42938, -0.238366, -0.120818, -0.367931, 0.698966, -0.951825, -0.338813, 0.0889786, 0.722614, 0.0295193, -0.00907427, -0.742549, 0.339255, -0.00451587, -0.754784, -0.841719, 0.656301, 0.639488, -0.355922, 0.537662, -0.724368, 0.00608766, -0.660106, -0.508381, 0.182377, -0.769457, 0.726998, -0.618994, -0.677069, -0.194591, -0.107266, -0.492388, 0.484565, 0.269247, 0.816163, 0.0951859, 0.0085893, 0.465306, 0.220533, -0.426675, -0.779248, -0.079345, -0.0294305, 0.224353, -0.0574669, -0.00557687, -0.918235, 0.94958, -0.953101, 0.724835, 0.094041, 0.638445, -0.62899, 0.500795, -0.192098, -0.782607, 0.347076, 0.601869, -0.286038, 0.657475, -0.0715784, 0.900288, -0.310355, -0.641321, 0.105039, -0.193103, 0.886474, -0.345798, 0.0670055, 0.761984, 0.160097, 0.301195, -0.128991, 0.315973, -0.100543, -0.0486807, -0.726957, 0.196785, 0.234247, 0.396018, 0.704602, -0.977602, -0.18568, 0.544642, -0.280864, -0.831822, 0.245138, -0.00876919, -0.405006, 0.773613, -0.574953, 0.917117, 0.57314, 0.235553, -0.92385, 0.314145, 0.52409, -0.0916016, 0.633956, 0.0675955, 0.168691, -0.757533, -0.175839, -0.45866, -0.103913, -0.709037, 0.830364, 0.620813, 0.461669, -0.252047, 0.486184, -0.696452, -0.777105, 0.115552, -0.712323, 0.61816, 0.822878, -0.102295, 0.943862, -0.0601909, -0.0893187, 0.794241, 0.108877, -0.97183, 0.712807, 0.228015, -0.556553, -0.182952, 0.306102, -0.488591, 0.812522, 0.209397, 0.971262, 0.676677, -0.275281, 0.764423, -0.236452, -0.864638, 0.831268, -0.902616, 0.0333252, 0.962456, 0.866964, -0.948835, 0.142574, -0.781613, -0.949026, -0.686501, 0.00292034, 0.0860201, 0.0456203, -0.128327, 0.106725, 0.367486, -0.926194, 0.660442, 0.177022, 0.605269, -0.175943, 0.00141592, -0.193717, -0.928051, -0.308807, -0.361727, -0.814392, -0.295445, -0.742903, 0.91139, 0.343201, 0.43918, 0.310915, 0.148094, -0.498097, 0.982534, -0.691429, 0.506341, 0.164015, 0.459396, 0.112396, 0.481034, -0.423007, -0.482216, -0.625944, -0.10219, 0.216274, -0.899291, -0.531309, -0.124623, 0.580066, -0.665836, 0.475469, 0.720046, 0.307536, -0.235645, -0.961473, -0.809839, -0.0188383, -0.968613, 0.86817, -0.0868677, 0.739183, 0.920209, 0.815637, 0.115391, -0.61059, -0.626239, 0.875952, -0.93722, 0.537932, 0.538142, -0.325305, -0.0211643, -0.145366, -0.47008, 0.0517567, 0.670437, -0.119845, -0.270385, 0.359062, -0.900859, -0.792382, -0.58484, -0.953935, 0.0167394, 0.329696, -0.446465, 0.804953, 0.904494, 0.0897302, -0.709251, 0.0497569, 0.13419, 0.882, 0.996424, -0.362799, 0.198031, 0.974546, 0.858924, 0.183629, -0.805204, -0.793056, 0.404453, 0.073441, -0.833604, 0.487553, 0.165269, -0.346319, 0.138854, -0.318483, -0.87275, 0.825686, -0.292062, -0.363623, -0.931902, 0.522487, 0.374101, 0.949677, 0.620755, -0.153001, -0.792511, -0.900284, 0.0395679, 0.354814, -0.507969, 0.827007, -0.864693, 0.541131, 0.63609, 0.0554558, 0.908559, -0.795733, 0.0251187, 0.673414, -0.0628423, 0.357014, -0.00185093, 0.541756, -0.557202, 0.514472, -0.604815, -0.81287, -0.494522, 0.613143, -0.3961, 0.788644, -0.878817, -0.0231407, 0.754954, -0.00570475, -0.364756, -0.82535, -0.830657, -0.475931, 0.0297676, -0.809858, -0.536443, 0.0757029, -0.926011, 0.0569949, 0.790853, 0.131929, -0.656215, 0.0225853, 0.579718, 0.691708, 0.98219, 0.693505, -0.0814642, -0.231517, -0.707156, -0.935941, 0.747686, -0.0475393, 0.0525783, 0.208078, 0.678526, -0.0527586, 0.238518, 0.0589977, 0.601913, 0.816973, -0.36942, -0.281825, -0.136118, 0.761367, -0.160879, -0.519821, 0.453046, -0.730907, 0.620501, -0.233462, -0.721601, -0.0197846, 0.418325, -0.777068, -0.483536, 0.157148, -0.910869, -0.394278, 0.775854, 0.802185, 0.416424, 0.748927, -0.482498, 0.620864, 0.881617, 0.0823176, 0.55561, 0.777637, 0.139835, 0.37003, 0.14039, -0.912404, 0.800142, 0.492021, 0.935134, 0.6961, 0.292893, -0.163999, 0.0290193, 0.753566, -0.0861141, 0.160824, 0.893231, -0.299205, 0.72232, 0.652014, -0.361536, -0.0204232, -0.887531, -0.527806, -0.323783, 0.386976, -0.791349, -0.894229, -0.18561, 0.537614, -0.00418093, -0.839519, 0.926896, 0.329584, 0.279639, 0.385803, 0.636227, -0.867735, 0.773923, 0.931262, -0.00945875, -0.992515, -0.432965, 0.943916, -0.0341655, -0.241347, -0.397386, 0.865354, -0.015081, -0.213555, -0.261396, 0.229579, 0.250466, -0.461572, 0.153486, 0.00909448, -0.820901, 0.370662, -0.453944, 0.86751, 0.791318, 0.984653, 0.941342, -0.299215, 0.429778, -0.563475, -0.320564, -0.509657, 0.187076, 0.399517, -0.0438071, 0.958464, -0.382853, 0.509893, -0.581393, -0.30089, -0.248633, -0.61397, 0.264444, 0.664258, 0.254774, -0.435208, 0.911875, -0.778048, 0.926416, -0.262693, -0.69362, 0.163627, 0.130124, -0.989429, -0.508213, 0.488057, -0.985683, -0.79831, 0.815898, 0.272748, -0.596225, -0.0626306, -0.0706375, 0.684893, -0.780273, 0.828496, -0.918673, 0.307068, 0.785126, 0.440335, 0.172337, 0.933367, -0.228307, -0.464678, -0.743392, 0.712046, 0.959702, 0.897938, -0.87729, -0.295042, 0.0333479, 0.139886, 0.581596, 0.838275, 0.285579, -0.834968, -0.0637177, 0.148706, 0.318337, 0.220189, 0.706003, -0.610655, 0.452253, 0.824179, 0.701726, -0.218262, 0.903853, -0.839169, 0.387069, -0.433984, -0.110193, -0.370131, 0.979116, -0.812381, -0.132331, 0.411877, -0.654233, 0.484059, -0.433598, -0.742974, -0.914712, -0.0675443, 0.0561886, -0.439725, -0.602469, -0.827739, 0.51549, -0.136658, -0.837324, -0.825888, -0.747358, -0.749608, -0.832058, 0.54608, -0.0176709, 0.10332, -0.717249, 0.599319, 0.427375, -0.679841, 0.383515, 0.418479, 0.172104, 0.215932, -0.704598, 0.790005, -0.707129, 0.368193, 0.11632, -0.411215, 0.551117, -0.761237, -0.598039, -0.761008, -0.132939, 0.00894664, -0.899205, -0.196277, 0.898792, 0.924593, -0.987051, -0.605726, 0.653748, 0.701028, -0.201178, 0.704627, 0.466867, -0.482261, -0.256718, -0.273138, -0.170322, -0.853331, -0.90121, 0.286996, 0.218963, 0.512657, -0.291586, -0.943691, 0.848466, 0.640033, -0.974515, -0.576027, -0.538579, -0.00171789, -0.696371, -0.152303, -0.354629, 0.207401, 0.465975, 0.45104, -0.171711, 0.809358, -0.0370405, -0.705956, 0.482383, -0.640276, -0.937028, 0.136, -0.608135, -0.253977, -0.516664, -0.333271, -0.619362, 0.800021, 0.963519, -0.790028, -0.911576, 0.312354, -0.196003, 0.0394407, -0.353997, -0.768079, 0.533668, -0.182075, -0.631269, 0.590149, -0.841367, 0.953491, -0.687684, -0.650986, 0.633373, -0.939197, 0.478284, -0.890405, 0.354595, -0.279545, 0.243677, 0.801597, 0.55399, -0.976808, -0.805686, 0.408731, -0.859784, 0.412515, -0.598938, 0.470631, -0.930817, -0.627542, 0.780955, -0.0288048, 0.482213, -0.0602528, -0.960486, 0.935062, -0.328062},
-	{-0.88583, -0.317779, 0.0601632, 0.120194, -0.100952, 0.696137, -0.686795, 0.4676, 0.529767, 0.563155, 0.329934, -0.573775, 0.323979, 0.446227, -0.424182, -0.488777, 0.591939, -0.181861, 0.391509, -0.772786, 0.300088, 0.135095, -0.574382, 0.647222, -0.436381, 0.17086, 0.170514, 0.733363, 0.205088, -0.590413, 0.719988, 0.289508, 0.506542, -0.460385, 0.996092, -0.450681, 0.488439, 0.169011, 0.915485, -0.295899, -0.42184, 0.0202531, -0.192239, 0.873305, 0.852069, -0.737487, 0.844201, 0.0658582, 0.563778, -0.878689, 0.259089, -0.398877, 0.139457, -0.584326, 0.930244, -0.743797, 0.228756, 0.117756, 0.773379, -0.350661, -0.108832, -0.474999, 0.0934442, -0.77305, -0.048866, 0.553556, -0.89751, 0.196596, 0.627575, 0.932958, -0.915873, -0.598887, 0.528497, 0.691937, -0.31762, 0.952167, -0.587309, -0.375295, 0.849344, 0.144068, 0.930448, -0.310988, 0.712534, -0.873218, 0.835544, -0.417434, -0.518726, -0.14982, 0.563716, -0.709138, 0.258877, 0.565345, -0.654034, -0.191575, 0.975077, 0.096326, -0.651412, -0.235617, -0.371278, 0.829961, -0.623377, -0.676256, -0.183023, 0.741549, -0.723809, -0.892166, 0.408619, -0.587091, 0.143247, 0.830862, 0.670135, 0.767162, 0.247262, 0.981784, -0.204414, -0.886541, 0.344192, -0.339497, 0.521304, 0.365312, 0.970132, 0.260318, 0.525426, -0.851102, 0.603675, 0.283667, 0.405996, 0.309176, -0.28404, 0.396163, -0.00568271, -0.0909668, -0.246261, -0.454976, -0.816579, 0.902858, 0.876161, -0.828313, -0.0735444, -0.725128, 0.234485, -0.371052, -0.560595, -0.788246, 0.644623, -0.293177, 0.938035, 0.899201, -0.598905, -0.641926, 0.229802, 0.507423, -0.626775, 0.372782, 0.249211, -0.136428, 0.467721, -0.659992, 0.708804, -0.680579, -0.411171, -0.358168, -0.0780851, 0.886465, -0.0232518, -0.696048, -0.842806, 0.667572, -0.213068, 0.717929, -0.353551, 0.0418813, 0.428124, 0.554848, -0.847205, 0.728829, 0.903642, -0.424553, 0.475241, 0.0870784, -0.0278135, 0.66938, 0.277126, 0.851816, 0.473329, -0.853437, 0.469664, 0.166167, -0.186298, 0.161752, 0.486092, 0.105923, -0.787159, -0.958126, 0.795434, 0.540586, 0.129324, -0.657266, 0.975662, 0.948272, -0.970966, -0.609012, 0.0408083, 0.941867, 0.410022, 0.476951, 0.888699, -0.324703, 0.784365, 0.886732, -0.18247, -0.883937, -0.674001, 0.555289, 0.288074, 0.374849, -0.228066, 0.467981, 0.553132, 0.97215, 0.862438, 0.96622, -0.768981, 0.162304, -0.858049, 0.886298, -0.353974, 0.0101308, -0.161647, 0.348167, 0.0261918, 0.306998, 0.575242, 0.622747, -0.675713, -0.0257999, 0.464682, -0.963052, -0.839976, 0.597437, 0.738073, 0.354818, 0.650214, 0.373112, 0.0631169, 0.959204, 0.00176785, -0.430069, -0.652787, 0.231418, -0.399219, -0.071585, 0.919458, 0.381592, -0.793148, 0.763025, -0.232057, -0.459425, -0.324083, 0.323277, -0.327029, 0.0610564, -0.21043, 0.133214, 0.16549, 0.131979, -0.815253, 0.707829, 0.94318, -0.00763233, -0.612565, 0.927001, 0.432545, 0.799707, 0.479407, -0.552282, 0.825613, -0.36992, 0.623202, 0.468372, 0.252234, 0.168609, -0.687456, 0.512422, 0.467885, 0.122123, -0.453173, -0.311401, 0.515151, 0.919723, 0.691609, -0.0259172, 0.834584, 0.596004, 0.728529, -0.58238, -0.126173, 0.16851, -0.909982, -0.832593, -0.730868, -0.393256, 0.734592, 0.119266, -0.101619, -0.372804, -0.198771, 0.896055, 0.662122, 0.573997, -0.0559034, 0.656606, -0.0675284, -0.854603, -0.450683, -0.421685, -0.0615115, -0.99245, 0.0502345, -0.755804, 0.911831, -0.605416, 0.908311, -0.60118, 0.91654, -0.79817, 0.453629, 0.712299, -0.181302, 0.564648, -0.117677, 0.317285, -0.578645, 0.209008, -0.338354, -0.678795, 0.2474, 0.819405, -0.149476, 0.129518, -0.668491, 0.68061, 0.895227, 0.818693, -0.639456, 0.88323, 0.878222, 0.758536, -0.41367, 0.425854, -0.0408492, 0.0722864, 0.179943, -0.0540933, 0.947651, -0.220534, -0.706404, 0.934471, 0.287508, 0.376071, 0.567586, 0.708162, -0.197227, -0.0437484, 0.732837, 0.658227, -0.56249, -0.176748, 0.969106, -0.249885, 0.666399, 0.0986264, -0.820263, 0.646092, 0.426501, 0.20373, 0.939197, -0.971504, 0.189581, -0.492572, 0.250579, -0.605471, -0.380219, -0.746839, 0.19689, -0.909133, -0.136158, 0.919843, -0.532543, 0.633963, -0.90732, 0.209698, 0.771378, -0.98575, 0.253871, 0.338594, -0.914384, 0.986253, 0.388599, 0.818478, -0.442458, -0.0908872, 0.164022, -0.708623, -0.988062, -0.506933, 0.656874, 0.788252, 0.200142, 0.515897, 0.115382, -0.657104, -0.1068, -0.26245, 0.128679, -0.592906, 0.16158, -0.291915, -0.51639, 0.958304, -0.793551, -0.840448, -0.922128, 0.34412, 0.0412742, 0.421469, 0.0431907, 0.729935, -0.0563723, -0.670339, 0.947145, -0.870188, 0.538238, 0.442161, 0.176945, 0.999944, 0.671449, -0.273305, 0.964327, 0.976473, -0.316828, 0.159996, -0.841048, 0.624083, -0.47503, -0.619725, -0.219626, 0.732961, -0.331908, -0.0733739, 0.422546, -0.152753, -0.266552, 0.13868, 0.313128, 0.751149, 0.195356, 0.669073, -0.585461, 0.336796, 0.988444, 0.165681, 0.053263, -0.256164, 0.331814, 0.251255, -0.997001, 0.0643982, 0.0743138, 0.806415, 0.79462, -0.0308393, 0.489891, 0.907855, -0.272124, 0.268653, 0.221939, -0.093799, 0.937109, -0.0995191, 0.21966, 0.70904, -0.705765, -0.205468, 0.945045, -0.182918, -0.647878, 0.824799, 0.0550766, 0.427671, -0.787798, -0.551772, -0.419886, 0.630421, -0.412887, -0.329459, 0.826561, -0.0460308, -0.940089, 0.523835, 0.291515, -0.27059, 0.934044, -0.182221, 0.741955, -0.0817718, -0.202802, 0.186668, -0.0206926, -0.493992, -0.348842, 0.756366, -0.239863, 0.143406, 0.0905191, -0.435141, 0.846389, 0.779773, 0.879169, 0.0667275, -0.153935, -0.441751, 0.461893, 0.915848, 0.578004, 0.0693278, 0.678149, -0.696406, 0.31225, -0.752845, 0.994632, -0.0674368, 0.544533, 0.0137333, 0.407854, -0.604916, 0.669849, -0.824672, 0.440305, 0.805739, 0.161636, -0.619239, -0.00795523, 0.973095, 0.868135, -0.734354, -0.716143, -0.512245, 0.223861, 0.977425, -0.267082, 0.234252, 0.341563, 0.211669, -0.310266, -0.684103, -0.446029, 0.761894, -0.0828278, 0.163899, -0.181807, -0.628197, -0.766191, 0.537515, 0.0684798, -0.420184, 0.965684, -0.454779, 0.537193, 0.0779991, 0.918951, 0.795288, -0.573252, -0.551348, 0.786117, 0.674338, 0.451541, -0.877705, 0.525782, 0.763809, 0.9408, -0.0758215, -0.911912, 0.727819, -0.407904, -0.735797, -0.214188, 0.224903, -0.203493, 0.715358, -0.16482, 0.243956, 0.192566, 0.831336, 0.314773, -0.204775, 0.0525311, -0.782851, 0.259081, -0.347621, -0.052907, -0.0319245, 0.281931, 0.0247034, -0.828052, 0.195145, -0.26929, 0.0850019, 0.453189, -0.935092, 0.410287, 0.610479, 0.561677, 0.315646, 0.431575, -0.848821, 0.0516785, -0.402194, -0.609605, -0.675956, -0.567703, -0.736154, -0.381258, -0.0720151, 0.781435, 0.026027, -0.257335, -0.90822, 0.321471, 0.569999, 0.67452, -0.981997, -0.723563, -0.627082, -0.410745, -0.664624, 0.101648, -0.405016, -0.623383, -0.664631, 0.0886543, -0.4888, 0.600612, 0.475021, -0.987312, -0.38091, 0.901145, -0.345092, -0.298301, -0.188259, 0.515324, 0.794019, -0.805861, -0.835796, 0.995963, -0.690551, 0.766095, -0.22109, -0.712008, -0.0524589, 0.655432, -0.551579, -0.0462436, -0.31556, -0.156861, -0.290107, -0.322504, -0.00406494, -0.457829, 0.999529, -0.999143, 0.0476376, 0.401814, 0.470926, 0.440966, -0.37257, -0.722388, 0.758925, -0.985516, 0.350999, 0.683644, 0.504641, -0.673172, 0.238862, -0.626457, 0.547265, -0.221552, 0.969556, 0.452224, 0.966821, -0.911321, 0.601127, -0.836325, 0.884942, -0.124316, 0.141515, -0.798707, 0.862344, -0.589477, 0.229769, 0.293741, -0.346387, 0.590396, -0.348327, -0.930547, 0.87251, 0.178203, 0.996134, -0.158001, -0.920559, -0.990185, 0.859025, -0.782063, 0.352556, 0.575816, 0.932336, 0.139829, 0.241189, 0.682049, -0.79518, -0.464757, -0.29583, 0.571951, 0.865035, -0.499461, 0.939551, -0.421123, 0.842301, 0.353515, -0.706284, -0.710619, 0.295137, -0.12874, 0.423905, 0.417777, -0.191286, 0.386257, 0.524526, 0.510602, -0.903941, -0.169798, -0.779325, -0.588801, 0.444601, -0.998506, 0.868089, -0.925553, -0.243268, 0.671154, 0.834982, 0.919368, 0.424864, 0.328414, -0.627585, -0.297135, -0.637959, -0.504736, 0.708675, -0.671089, -0.115188, -0.495826, 0.17003, 0.485073, 0.926564, -0.719195, -0.0574542, 0.565231, -0.053458, 0.153083, 0.0948883, -0.675967, 0.65188, -0.587063, 0.358646, -0.459313, 0.940056, -0.603603, -0.824148, 0.057602, -0.831286, 0.698698, -0.945596, -0.622774, 0.54625, -0.799103, 0.312044, -0.0365144, -0.827299, -0.783743, 0.900954, 0.261092, 0.341315, 0.779506, 0.454603, -0.522641, -0.959458, 0.903604, 0.0247889, 0.388066, -0.157385, 0.268459, -0.731372, -0.161788, -0.164474, -0.414847, -0.550337, -0.427632, -0.673935, 0.462667, -0.0149077, -0.314569, 0.966421, -0.743448, -0.262714, -0.0122248, 0.138354, -0.449883, -0.97544, 0.974282, -0.859551, 0.387195, 0.402707, 0.895164, -0.179483, 0.721444, 0.784213, 0.642565, 0.658845, 0.53955, -0.317328, 0.984954, -0.285676, -0.514613, -0.597633, 0.802448, 0.625034, 0.530254, 0.657918, 0.0837688, 0.0755447, -0.223281, 0.627589, 0.201027, 0.784299, -0.992702, -0.442836, 0.4996, 0.951462, -0.270356, -0.0662824, -0.711728, 0.178468, -0.465759, -0.140231, 0.716298, -0.603783, 0.431127, -0.0195818, 0.476049, 0.052584, -0.444263, 0.32846, 0.208346, 0.993602, 0.625165, -0.185143, 0.332753, -0.548158, 0.590079, 0.305546, 0.712977, 0.917054, -0.318106, -0.0635584, -0.919318, 0.00657154, 0.22668, 0.869194, 0.782801, -0.218012, 0.0826218, 0.265082, -0.0690908, -0.0800706, 0.130395, -0.936032, 0.902288, 0.580049, -0.0978855, 0.63329, 0.8323, 0.351115, 0.95058, -0.0166886, -0.0814605, 0.876777, -0.500943, 0.660489, -0.835864, 0.366411, -0.165652, -0.565347, -0.93044, 0.552421, 0.741915, 0.134215, -0.90387, 0.203265, -0.958259, 0.426209, -0.0432294, 0.367886, 0.897249, 0.471371, 0.605922, 0.637722, 0.447723, -0.458586, -0.635567, 0.218362, 0.307624, 0.406042, 0.668856, -0.886822, 0.559196, 0.131262, -0.846759, -0.710481, -0.66024, -0.371357, -0.526185, 0.115545, 0.309311, 0.897075, 0.964971, -0.576956, -0.449572, 0.219382, 0.695099, -0.284473, -0.081254, 0.454088, 0.5006, -0.875674, -0.49327, 0.205147, 0.851976, -0.439575, -0.577465, -0.86065, -0.543335, 0.616984, 0.587402, -0.973143, -0.51918, 0.47079, -0.450233, -0.107405, 0.580537, -0.856673, 0.658931, -0.860018, 0.47526, -0.939188, 0.122061, 0.771914, 0.503402, -0.447842, 0.131724, -0.9477, 0.355281, 0.787793, 0.223025, 0.277353, -0.530023, -0.18899, -0.815169, 0.850651, 0.695446, 0.322999, 0.795933, -0.919832, -0.982793, 0.349993, 0.309947, 0.0961899, -0.995497, -0.742136, 0.845319, -0.01171, -0.603513, -0.259977, 0.339725, -0.222594, 0.934251, -0.676607, -0.16965, 0.979863, -0.306335, -0.685681, 0.966024, -0.278254, -0.166406, 0.465454, -0.717006, -0.638487, -0.438108, 0.99653, -0.225644, 0.998355, 0.39322, -0.388541, 0.45741, 0.934674, -0.923543, 0.961564, -0.427341, 0.565445, -0.463919, -0.412371, 0.781175, 0.577225, 0.232381, -0.582847, 0.485596, 0.451791, -0.709133, -0.581467, 0.382453, -0.959067, -0.833183, 0.644347, 0.814883, 0.210206, -0.0911224, 0.408911, 0.23622, -0.917793, -0.250763, -0.252789, -0.811994, -0.202797, -0.215622, -0.809714, 0.531652, 0.0973262, -0.854379, 0.468273, 0.730654, -0.613583, 0.959439, -0.708172, 0.754543, -0.93812, -0.657958, -0.711719, -0.117357, -0.932858, 0.313974, -0.97073, -0.568054, -0.284364, 0.929506, 0.853844, 0.0707431, 0.921236, 0.239579, 0.511175, -0.313406, -0.742664, 0.37259, -0.130174, 0.697051, -0.251885, -0.0361342, 0.014373, 0.268894, 0.663881, 0.00404092, 0.393606, -0.30523, -0.0237381, 0.235223, -0.0241164, -0.947095, 0.505444, 0.339058, 0.591856, 0.50716, -0.3146, 0.336335, -0.288191, 0.706818, 0.830479, -0.44925, 0.674907, 0.765711, 0.510469, 0.397449, 0.689354, 0.627311, -0.274956, 0.580824, 0.238712, 0.00682919, 0.764032, -0.730379, 0.982554, 0.446525, -0.765264, 0.127649, -0.263487, -0.0752958, 0.820448, -0.340153, 0.937183, -0.755206, -0.290617, 0.922129, -0.206678, -0.565786, -0.238284, -0.577573, -0.414146, 0.0459795, 0.431342, 0.415174, 0.378521, -0.533088, -0.340471, 0.211222, 0.631355, 0.617954, -0.115383, 0.919927, -0.578756, 0.702133, -0.166499, 0.478049, -0.523571, -0.327624, -0.966514, -0.498001, -0.395683, -0.540386, -0.899562, 0.146084, 0.346633, -0.618469, -0.816711, 0.715025, -0.0217765, -0.216539, -0.188372, -0.252518, 0.193086, -0.0931696, -0.547034, -0.65174, 0.20345, 0.332093, -0.272622, -0.451271, 0.350594, -0.0367698, 0.0725716, 0.603901, -0.883036, 0.326627, -0.641666, -0.696003, -0.0536644, -0.0256448, -0.422578, -0.663972, -0.85227, 0.378813, 0.821015, -0.746235, 0.0658121, 0.461589, -0.821007, 0.0932597, 0.294298, -0.634542, 0.314471, 0.859627, 0.220021, 0.934924, -0.442564, 0.252347, -0.189204, -0.286236, 0.988736, -0.150149, 0.891071, -0.807064, -0.600939, -0.921852, 0.39174, -0.997607, 0.144224, -0.704514, -0.155897, -0.399688, -0.475739, 0.707894, -0.339544, 0.82226, 0.202008, 0.816496, -0.116523, -0.597789, 0.821112, -0.111272, 0.80687, -0.701079, -0.632589, 0.287865, 0.681071, 0.139017, 0.835783, 0.0863652, -0.866045, -0.219368, -0.211674, -0.848358, -0.487394, 0.226897, 0.665487, 0.884024, 0.666148, -0.601746, 0.538593, -0.113436, -0.651946, 0.714747, -0.0809517, 0.611544, -0.775183, 0.542322, 0.499998, 0.312097, 0.746856, 0.00807613, 0.224948, -0.370279, -0.808732, -0.463103, 0.258297, 0.311865, -0.70463, 0.482015, 0.283942, -0.512571, -0.00205739, -0.685739, 0.564707, 0.116824, 0.40303, -0.427261, 0.460581, -0.791418, 0.304746, -0.200627, -0.497078, 0.611907, -0.14265, 0.766882, 0.326432, -0.0680685, -0.846641, 0.0637325, 0.725296, 0.764345, 0.546865, 0.172816, 0.375153, 0.17999, -0.476275, 0.222835, 0.398807, -0.767353, -0.298443, -0.209095, -0.51254, 0.0647632, -0.414606, -0.847518, -0.100939, 0.938228, 0.416669, 0.325484, 0.0184491, 0.984942, 0.238506, -0.105231, 0.920479, -0.350172, 0.67754, 0.845263, 0.898625, -0.00596836, -0.675958, 0.997218, 0.187888, 0.474363, 0.478129, 0.0976406, 0.309419, 0.771649, -0.696425, -0.359988, 0.85562, 0.44646, -0.992971, 0.887128, -0.515994, -0.770719, 0.802994, -0.781508, -0.184864, -0.150437, 0.239617, -0.247502, -0.787036, -0.40266, -0.542284, 0.544209, -0.0295078, -0.988143, 0.15277, 0.633846, 0.231008, -0.67594, -0.202331, 0.971484, -0.693751, 0.746941, -0.400311, -0.312375, 0.858833, 0.437583, -0.504386, -0.253805, 0.404729, 0.251913, -0.473871, 0.0323661, -0.650378, 0.374507, 0.217159, -0.580572, -0.425757, -0.526818, -0.471526, -0.0745926, 0.262043, -0.118753, 0.502638, 0.814499, 0.985031, 0.91729, 0.885479, 0.399425, 0.0262061, 0.778883, 0.999275, 0.171595, 0.87258, 0.853667, 0.683642, -0.217032, 0.242802, 0.238293, 0.142688, -0.0120511, 0.312523, 0.790538, 0.920546, 0.659292, 0.458594, 0.5605, 0.00959172, 0.771533, 0.303421, 0.873653, 0.75587, 0.912645, 0.538936, 0.170167, -0.473656, 0.429239, -0.116976, -0.893049, 0.378058, -0.0112421, 0.0759047, -0.815263, 0.116466, -0.931589, 0.288746, -0.044288, 0.103007, -0.0354972, 0.353268, 0.052658, -0.820143, 0.0504179, -0.474324, 0.0276343, 0.0349033, -0.284371, 0.552932, 0.860168, 0.867322, 0.956557, 0.900275, 0.534539, 0.172721, -0.401135, -0.922991, 0.00167117, -0.0830931, -0.547875, -0.53909, -0.687431, 0.316402, -0.0965843, 0.895478, -0.192097, 0.302509, 0.451063, 0.266002, 0.258303, 0.834114, 0.13612, -0.815222, -0.451648, 0.00442072, -0.180019, -0.194379, -0.151439, 0.468254, 0.608149, -0.650495, 0.818793, 0.876298, 0.136366, -0.721746, 0.764933, -0.112235, -0.0680318, -0.566582, 0.486665, -0.547284, 0.503872, 0.137522, 0.931994, 0.0497605, -0.846697, -0.0657475, 0.0626885, -0.522366, -0.961535, -0.123323, 0.967662, -0.754235, 0.249874, 0.956945, 0.551658, 0.769631, -0.6968, 0.50789, -0.989229, 0.906753, 0.534757, 0.0641557, 0.195366, -0.569404, 0.977309, 0.935873, -0.805135, 0.551204, -0.345303, 0.509828, 0.257217, -0.585062, -0.161049, -0.0485038, 0.573246, -0.562113, -0.0973025, -0.455849, -0.115383, -0.914489, -0.772761, 0.563408, 0.928961, 0.7594, 0.75357, -0.428831, -0.769764, -0.0948747, -0.0675744, -0.366347, 0.0824751, -0.141524, -0.903583, -0.774439, 0.994447, 0.636849, 0.518207, 0.543184, 0.00609049, 0.607599, 0.453814, 0.409675, 0.190976, -0.235112, 0.734633, 0.769908, 0.923298, 0.138452, 0.112865, 0.0586007, -0.397229, 0.049029, 0.235346, 0.578635, -0.877295, 0.714996, 0.642697, 0.917953, -0.356794, 0.643201, -0.61711, -0.47841, -0.569712, 0.680481, 0.377922, 0.0265317, -0.234999, 0.112327, -0.525005, 0.179938, -0.432075, -0.557995, 0.452974, -0.93088, -0.593427, -0.726156, 0.350933, -0.952168, 0.759876, 0.024354, 0.380766, 0.577286, -0.756689, -0.658516, 0.466554, 0.411544, -0.180577, 0.752886, -0.747831, -0.840543, -0.308397, -0.702325, 0.858632, -0.31917, -0.618108, 0.681774, -0.954838, -0.586657, 0.32335, -0.268905, 0.390389, -0.128103, -0.480412, -0.0916447, 0.0285354, 0.892755, -0.176952, -0.254474, 0.865909, 0.871354, 0.457079, 0.406067, 0.611602, -0.17023, 0.42852, 0.382908, -0.0386466, 0.674286, 0.508847, -0.217997, -0.152165, 0.0549678, -0.913074, -0.783898, 0.567385, 0.95913, -0.308428, -0.0830988, -0.195734, -0.35587, 0.621905, -0.657994, 0.742792, -0.344864, 0.270794, 0.577181, 0.405549, -0.517419, 0.841652, 0.988185, -0.138935, -0.266438, -0.142875, -0.872825, -0.532113, 0.963416, -0.287861, -0.456743, -0.966328, -0.998476, -0.154393, -0.759014, 0.872633, 0.62598, -0.4221, 0.355857, 0.871322, -0.304127, 0.758262, 0.750994, 0.483779, 0.745882, -0.842601, -0.458691, 0.347209, -0.0139432, -0.770217, 0.86345, 0.351578, -0.287261, 0.36015, 0.66344, -0.920777, 0.981102, -0.729477, -0.177681, 0.215696, 0.374189, -0.264953, -0.549404, -0.559429, 0.215005, 0.216495, -0.872563, -0.259892, 0.865369, -0.75075, -0.397624, -0.605676, 0.241088, 0.788614, 0.701761, -0.937774, 0.985266, 0.511164, -0.847178, 0.497534, 0.361108, 0.830412, -0.82116, 0.328502, 0.512231, 0.17172, -0.425524, 0.0575352, 0.924287, -0.317954, 0.853472, 0.949521, 0.634645, 0.523756, -0.359826, 0.670058, -0.875774, 0.0665261, -0.704691, -0.906273, 0.930184, 0.370439, -0.546207, 0.294142, 0.64457, -0.523457, -0.0888858, -0.458627, -0.824044, 0.227204, 0.294553, 0.726754, 0.458386, 0.74778, 0.735041, -0.581907, 0.45526, 0.497761, -0.659615, -0.0167695, 0.476682, -0.304311, 0.964887, 0.610841, -0.881482, -0.892239, 0.898105, -0.744732, -0.314434, 0.0256959, -0.206785, -0.64088, 0.572033, -0.546623, 0.987545, 0.152124, 0.896219, 0.389025, 0.0317073, 0.0387505, -0.596122, -0.740248, -0.762503, 0.371469, 0.698248, -0.226803, -0.137233, -0.544375, 0.073297, -0.886793, 0.20425, 0.0617534, 0.424431, -0.761954, -0.531756, 0.707132, 0.906979, -0.113899, -0.393086, -0.402801, -0.187485, -0.776415, -0.27459, -0.692534, 0.682553, -0.558705, -0.119646, -0.841429, 0.52247, -0.122011, 0.815298, 0.125246, 0.763311, 0.375633, 0.306115, 0.39983, -0.249765, -0.56342, -0.898892, 0.774845, -0.861192, -0.250728, -0.238696, 0.290676, -0.501259, -0.497587, -0.374842, 0.553171, 0.743192, 0.624069, 0.613197, 0.520439, 0.766551, 0.15234, -0.35866, -0.291144, -0.911121, 0.243552, -0.496149, -0.772205, 0.0255157, -0.673156, -0.993988, 0.752243, 0.925476, -0.62628, 0.0370947, 0.387515, 0.941224, -0.0412098, 0.744067, -0.857991, -0.866779, -0.781226, 0.166924, 0.884595, -0.154948, 0.221075, -0.974906, -0.977656, -0.725441, 0.232172, 0.861361, 0.506756, 0.228247, 0.110808, -0.477747, 0.292893, -0.880334, 0.71932, -0.881705, -0.935901, -0.349529, 0.585675, 0.252619, -0.468154, 0.143382, -0.0273228, -0.314373, -0.670568, 0.0675331, 0.289202, -0.878791, 0.169266, -0.846047, -0.441015, -0.727708, -0.120952, -0.0803186, 0.613876, 0.770867, 0.590638, 0.989224, -0.138838, -0.317893, -0.235667, -0.295815, 0.686899, -0.653527, -0.820729, 0.0122376, 0.953731, -0.550682, 0.916385, 0.468908, -0.844725, 0.778926, 0.473928, 0.529464, 0.483212, -0.659731, 0.0317911, 0.411063, -0.797961, -0.499541, -0.451886, -0.563639, 0.77698, 0.596856, 0.127764, -0.921452, 0.853558, -0.430847, 0.288876, -0.43645, 0.015943, 0.625652, 0.0941765, 0.983379, 0.00134444, 0.754426, 0.929903, 0.0266016, -0.131578, -0.0695976, 0.583163, -0.663732, -0.42374, -0.739755, 0.831164, -0.780416, -0.301209, 0.408943, -0.56318, -0.929248, 0.917265, -0.400056, 0.423783, 0.919534, -0.440181, -0.390294, -0.534273, -0.970116, -0.400899, -0.571092, 0.80137, -0.0903898, 0.67003, -0.42158, 0.0198216, -0.345788, 0.930758, -0.626478, 0.759344, -0.385097, -0.858384, -0.180305, 0.900835, -0.335235, 0.0798095, -0.634478, -0.312395, 0.749425, -0.703728, -0.99545, -0.0807942, 0.461966, -0.995907, 0.101001, 0.676792, -0.839861, 0.2366, 0.170269, 0.919275, -0.808549, -0.0294969, -0.462288, -0.177195, -0.104666, 0.379016, 0.904668, 0.871611, 0.286402, -0.234548, 0.2403, -0.788381, -0.644607, -0.29865, -0.842451, 0.996479, 0.516415, -0.0665806, 0.441839, -0.50285, 0.556226, 0.0976992, 0.890135, 0.236966, -0.658036, 0.577523, 0.432595, 0.00205083, 0.0297488, 0.344263, -0.09652, -0.314088, -0.937579, 0.00955423, 0.385785, -0.680091, 0.78003, 0.51064, 0.744918, 0.687526, 0.153988, 0.869435, -0.315836, -0.534211, 0.755444, 0.800174, -0.0149125, -0.962636, -0.201424, -0.0269124, -0.56468, -0.266767, 0.405154, 0.901311, 0.459488, -0.357188, 0.423319, -0.612927, -0.857451, -0.38914, 0.119885, -0.19009, 0.42446, -0.726989, 0.46088, 0.328866, 0.81047, -0.250828, 0.493141, -0.951763, -0.239606, 0.887904, -0.0453664, 0.502652, -0.565086, -0.740376, -0.480515, -0.346025, -0.559347, -0.741897, -0.949686, -0.311746, 0.845671, -0.976306, -0.0478881, -0.202721, 0.640641, 0.615902, -0.208405, -0.734401, 0.259184, -0.336982, -0.735157, -0.496856, -0.204046, 0.0731598, -0.183468, -0.941871, 0.324578, 0.952274, -0.851153, -0.365973, 0.325694, 0.947347, 0.370085, -0.950477, 0.918671, 0.78852, -0.371362, 0.605004, -0.317292, 0.305292, -0.795599, 0.746643, 0.393151, -0.833138, -0.587241, -0.197897, -0.271878, 0.5441, 0.284282, -0.00170104, 0.95216, -0.157855, 0.225397, -0.887513, -0.0445059, 0.179799, -0.522997, 0.337859, -0.445891, 0.442209, -0.435288, -0.249135, -0.196939, -0.960199, -0.0980959, 0.273132, 0.512846, 0.92721, 0.608857, 0.0282268, -0.573296, -0.665857, -0.492362, -0.911817, -0.081789, -0.690065, -0.514982, -0.310907, 0.0969285, 0.635654, -0.0172631, 0.725648, 0.29465, 0.638776, -0.732054, 0.593022, -0.918569, 0.719068, 0.526916, 0.138146, 0.404996, -0.560398, -0.253894, -0.127521, -0.774705, 0.404318, 0.180699, 0.95159, 0.65392, -0.376158, -0.62053, 0.705601, 0.618474, -0.164552, -0.837021, 0.498883, 0.419285, -0.443833, -0.793021, 0.562996, -0.852892, -0.073917, 0.61149, -0.0586148, 0.332059, -0.255379, 0.504056, -0.542458, 0.244673, 0.531897, 0.4683, -0.697876, 0.675173, 0.0939097, -0.141098, -0.522495, -0.220891, 0.324127, -0.115181, 0.206519, -0.243515, 0.839418, -0.125378, 0.0819714, 0.734594, 0.0367618, 0.64897, -0.248187, 0.314951, 0.700469, -0.278702, -0.00961182, -0.432455, -0.719225, 0.368008, 0.0971627, 0.449038, -0.837599, 0.414536, -0.673724, 0.726755, -0.383401, -0.940364, 0.922858, -0.233558, 0.460016, 0.553678, 0.875938, 0.49935, 0.344794, -0.228277, -0.247536, 0.829261, 0.436795, -0.642738, 0.138898, -0.713889, 0.124899, 0.765107, 0.734227, 0.33578, -0.663639, 0.109523, 0.152408, 0.057029, 0.677754, 0.410263, 0.0802236, 0.183125, -0.0772495, -0.389628, 0.199108, 0.317439, -0.335802, 0.977774, -0.297035, -0.902753, 0.376099, -0.444137, -0.651698, 0.572348, -0.699028, 0.358452, -0.0832857, 0.517443, 0.182072, -0.000329738, 0.85006, -0.159088, 0.243822, 0.102956, -0.262457, -0.587738, -0.379262, -0.285468, 0.926031, 0.628748, -0.894153, 0.937829, -0.470002, -0.748532, -0.0660817, 0.790519, 0.310185, -0.910617, 0.968187, -0.939348, -0.774564, -0.0653049, -0.0218624, -0.924857, 0.0728252, 0.85184, -0.813389, 0.854755, 0.159756, -0.210415, 0.30038, -0.841489, 0.469224, -0.736028, -0.762385, -0.474328, -0.909939, 0.301667, 0.112191, -0.51182, 0.532445, -0.712489, 0.972603, 0.499206, -0.28452, -0.234449, 0.388529, 0.0764686, -0.76073, 0.713568, 0.917077, -0.900896, 0.569605, -0.838877, 0.906817, -0.662983, 0.355667, 0.372654, 0.168786, -0.0499355, -0.211966, 0.816027, 0.901502, 0.310749, -0.459011, 0.919078, -0.373992, 0.0534701, -0.495367, -0.149411, -0.844419, 0.811999, 0.0672547, 0.727477, -0.992484, -0.185812, 0.155613, 0.13214, 0.609453, 0.187942, -0.173472, -0.267771, -0.66156, -0.517907, -0.648056, -0.692289, 0.384066, 0.307665, -0.681794, -0.779001, 0.400442, 0.932695, -0.24595, -0.942354, 0.291576, -0.962899, 0.873593, -0.537486, 0.591676, -0.8402, 0.122955, 0.320187, -0.432264, 0.0458374, 0.601115, 0.343738, 0.758111, 0.800292, -0.0178998, -0.750506, -0.707976, 0.34264, 0.0402042, 0.190818, 0.63297, -0.786312, -0.860862, 0.980707, -0.105785, 0.44131, 0.179162, -0.749236, -0.355417, -0.526085, 0.222393, 0.282147, -0.571612, 0.94034, 0.80687, -0.219036, 0.610073, -0.429701, -0.505081, 0.880427, -0.944755, -0.169241, 0.0815347, -0.559013, -0.318033, -0.291492, -0.345584, -0.600888, 0.171581, 0.145321, -0.601518, 0.8449, 0.294807, -0.980877, 0.731396, -0.918559, 0.766539, 0.21099, -0.850246, -0.518918, -0.391647, -0.12349, -0.791494, 0.0219763, -0.160515, 0.908748, -0.364678, 0.835537, -0.641329, 0.655558, -0.677023, 0.0942103, -0.327699, -0.40528, 0.471559, 0.0981115, 0.00749633, 0.558265, -0.931615, -0.282306, 0.538194, -0.388172, 0.15124, -0.804692, 0.599506, -0.111851, -0.169425, -0.952287, -0.41862, 0.055408, 0.401852, -0.804786, 0.471476, -0.868867, -0.302734, 0.0277235, 0.825017, -0.989533, 0.783452, -0.0229902, -0.944495, 0.642071, -0.87248, 0.243728, 0.0630722, -0.301206, -0.543368, 0.869317, -0.563325, 0.799222, 0.403714, -0.205668, 0.348596, -0.00855127, -0.192406, 0.128863, 0.798683, 0.495372, -0.437177, -0.224045, -0.227376, 0.695763, -0.657322, -0.116266, 0.993581, 0.18414, 0.397997, 0.901749, 0.770081, 0.951428, -0.177345, 0.831398, -0.920835, -0.520096, -0.966097, 7.67267e-05, -0.0768147, 0.973727, 0.941736, 0.578772, 0.668011, -0.58378, -0.0543243, 0.545126, -0.248345, -0.0782055, 0.360586, 0.890834, -0.728235, 0.740567, -0.210378, 0.487623, 0.835655, -0.908998, -0.51284, 0.831209, -0.0258499, -0.569562, -0.0626508, 0.0599614, 0.0786106, 0.832245, -0.29626, 0.351333, 0.640477, -0.451414, 0.922695, -0.272167, 0.0736287, -0.71551, -0.918543, 0.693747, -0.659498, 0.563194, -0.657198, -0.861896, 0.856861, 0.127771, 0.949743, 0.0110884, 0.944158, 0.323482, -0.194651, -0.492573, -0.492479, -0.276496, 0.364784, -0.500974, 0.66708, -0.597013, -0.487253, -0.693534, -0.865706, -0.546905, -0.981207, -0.451953, -0.29036, -0.698745, 0.684899, 0.709001, -0.605598, -0.0792453, -0.735763, -0.901645, 0.899254, -0.125125, 0.590207, -0.854108, 0.112145, 0.880708, 0.262372, 0.472706, 0.534502, 0.766418, 0.0624541, 0.487537, 0.283533, 0.588919, 0.745361, -0.329152, 0.709896, 0.215873, 0.485451, 0.795648, -0.563791, 0.90362, 0.848278, -0.436706, 0.457218, 0.582975, 0.944452, 0.693409, -0.506002, 0.328777, -0.464791, -0.658809, 0.624191, -0.381745, 0.370596, -0.858721, -0.846668, -0.279469, -0.751203, -0.864482, -0.594336, 0.0147388, -0.859244, 0.422215, 0.150496, -0.918852, -0.865498, 0.170928, 0.177267, -0.575754, -0.628719, -0.721529, -0.187297, 0.0598325, 0.255615, 0.328102, 0.638902, 0.378853, 0.272982, -0.448412, -0.843091, 0.935303, -0.66836, -0.135072, -0.166842, -0.430928, -0.759214, 0.545182, 0.539983, 0.0166079, -0.827387, 0.1418, 0.26247, 0.717095, 0.903531, 0.67511, 0.32923, -0.820931, -0.952071, -0.538881, -0.139654, -0.359887, 0.465331, -0.188346, -0.955395, -0.104692, 0.0451766, -0.878048, -0.889408, -0.040905, -0.692627, -0.0810151, 0.433291, -0.605462, -0.885309, -0.837582, 0.649843, -0.790898, 0.985698, 0.967578, 0.636839, -0.575164, 0.567852, -0.690005, -0.500618, 0.103059, -0.0869481, 0.603195, -0.607597, 0.826537, 0.834888, 0.229774, 0.666164, -0.472083, 0.436576, 0.485975, -0.0148182, 0.76476, 0.0524171, 0.999409, 0.410195, -0.0361148, -0.138164, -0.474793, -0.594116, -0.582247, 0.175716, -0.77343, -0.962271, -0.233932, 0.238847, 0.796817, 0.789533, 0.300811, -0.739269, -0.638541, -0.297402, 0.390406, -0.3365, -0.169483, -0.953725, 0.269811, -0.151176, 0.45473, -0.0463161, -0.130503, 0.547104, 0.56386, -0.684874, 0.611505, 0.873365, 0.2801, 0.281294, -0.433223, -0.94723, 0.1032, 0.201349, 0.498344, 0.658151, 0.584142, 0.908245, -0.441855, 0.266393, 0.610373, 0.654323, 0.260673, 0.984957, 0.703977, -0.884393, -0.861763, 0.23074, 0.197127, 0.126294, 0.101406, 0.373525, 0.162341, -0.85341, -0.608643, 0.39193, -0.435228, -0.251519, 0.890177, -0.969801, -0.426294, 0.12356, -0.101613, -0.415357, 0.793081, -0.533139, 0.952646, 0.0992627, 0.360677, -0.683302, 0.441023, -0.797633, 0.00445776, -0.00113659, 0.639259, -0.603656, -0.447135, 0.161829, -0.836857, -0.8214, 0.095934, -0.696916, -0.58722, 0.594129, 0.500963, 0.952154, -0.186859, -0.11885, -0.288147, -0.441152, 0.132982, 0.132741, -0.462071, -0.231426, -0.976107, -0.414686, 0.921574, -0.102201, -0.771036, 0.321587, -0.849386, -0.250792, -0.761027, -0.948082, 0.123279, -0.491664, -0.239272, -0.358931, 0.102951, 0.198305, -0.360073, -0.638681, 0.737191, 0.823418, 0.13156, -0.87951, 0.890186, 0.857544, 0.395789, 0.947084, -0.211853, -0.0732447, 0.47356, 0.561264, 0.972718, -0.0612871, -0.593073, -0.366048, -0.382754},
-	{-0.664049, -0.885101, 0.106307, -0.0811417, 0.668922, 0.837855, 0.676048, 0.426885, 0.389959, 0.34783, 0.272073, -0.892747, 0.355335, 0.382476, 0.306764, -0.0424425, -0.764073, -0.905151, -0.0452398, 0.832394, -0.695834, -0.125615, -0.818662, -0.205468, 0.193756, 0.478378, -0.363084, 0.395138, 0.803978, 0.792372, 0.372087, -0.106449, 0.938642, -0.82588, 0.901663, -0.207991, 0.59445, 0.531796, 0.58053, -0.148924, -0.674647, -0.879002, 0.306519, 0.472743, 0.108458, 0.887485, 0.812952, 0.24387, -0.988752, 0.739081, -0.18459, 0.832286, 0.376883, 0.702667, 0.27911, -0.741648, 0.678718, 0.990599, 0.621369, 0.827535, -0.603346, 0.745854, 0.898682, -0.790339, 0.87959, -0.507239, -0.258205, -0.499629, 0.628553, -0.168156, 0.841456, -0.785519, -0.29305, 0.154485, -0.708397, -0.0587869, 0.0441992, 0.655059, -0.515272, -0.495503, 0.733017, -0.352466, -0.488856, -0.305473, 0.129013, -0.365133, -0.57614, 0.159682, 0.808695, 0.348966, 0.219492, -0.0794901, 0.826919, -0.0484935, 0.293186, 0.517095, -0.0418768, 0.942231, -0.552195, -0.822376, -0.500142, -0.647064, -0.178848, -0.358005, 0.450139, 0.102681, -0.538274, -0.448056, -0.84944, 0.35396, 0.574942, 0.131577, -0.699012, -0.614881, -0.756959, -0.290816, 0.529954, -0.252856, -0.191643, -0.310208, -0.833067, 0.647863, 0.220101, 0.810503, 0.437419, -0.561351, -0.178418, -0.551683, 0.516107, -0.376644, 0.452565, 0.14913, 0.697175, 0.905413, 0.161324, -0.705342, 0.568878, -0.798703, 0.334624, 0.917115, -0.749097, -0.549986, 0.949424, -0.0301856, -0.909341, 0.569803, 0.831927, 0.0130512, 0.526076, 0.147443, -0.189178, 0.823104, -0.627491, -0.892278, 0.15525, -0.0888399, 0.308857, 0.160483, 0.980332, -0.1784, -0.567324, -0.906069, 0.925835, -0.446086, 0.342938, 0.916002, 0.775119, 0.0121977, 0.514124, -0.572224, 0.361218, 0.799108, 0.524161, 0.426657, 0.803684, -0.0533719, -0.845297, 0.456061, 0.808843, 0.537109, -0.397543, 0.456692, 0.573551, -0.182738, -0.533929, 0.61196, 0.466425, 0.15853, -0.567897, -0.284881, -0.410488, -0.829451, -0.736449, 0.0667658, -0.380277, -0.833628, 0.91051, 0.297802, 0.0601333, -0.818876, 0.570435, 0.729663, -0.10797, -0.976736, -0.516153, -0.26243, 0.275774, -0.858844, 0.959073, 0.921055, -0.976014, 0.0601202, -0.421666, -0.73837, -0.97617, 0.996399, -0.584675, -0.38537, 0.488603, -0.738839, 0.477308, 0.668924, -0.454344, 0.750442, 0.389579, 0.347233, -0.255915, -0.798384, 0.481855, -0.21743, 0.202248, 0.694861, -0.409139, -0.242001, -0.661082, -0.502794, -0.0309036, -0.319851, -0.634157, 0.441971, 0.405221, -0.0309638, 0.762793, 0.401843, -0.729772, 0.670358, -0.516327, -0.137792, -0.763504, -0.385432, -0.915028, -0.630518, 0.791768, -0.25088, -0.499214, 0.502128, 0.327767, -0.912442, 0.566614, -0.578101, -0.744729, 0.763869, 0.743908, -0.541005, -0.496118, 0.974573, -0.184497, -0.392524, -0.391073, -0.82137, 0.132624, -0.796825, 0.703339, -0.885192, -0.747493, -0.587884, -0.228006, 0.967876, -0.830779, -0.747919, -0.765174, 0.546049, 0.543737, 0.731465, 0.438346, 0.97785, 0.839482, 0.456451, 0.0906539, 0.342963, 0.0133474, -0.724564, -0.488053, -0.635642, 0.660911, -0.394759, 0.845176, -0.363652, 0.512652, -0.583615, 0.275053, 0.223633, 0.156722, -0.7462, 0.940947, -0.333705, 0.821424, 0.850517, -0.470969, -0.868436, -0.111598, 0.128831, -0.426321, 0.882447, 0.183, 0.467829, 0.655214, -0.314608, 0.0867215, 0.305423, -0.473713, 0.415755, 0.539504, 0.636841, -0.827223, -0.584344, -0.0175541, 0.694039, 0.31308, 0.209572, -0.258317, -0.48612, -0.16779, -0.246202, 0.932857, -0.361072, -0.989077, -0.25993, 0.848112, 0.75358, 0.682903, 0.615394, -0.573683, -0.288451, 0.684448, 0.935604, -0.82037, -0.834876, -0.456476, -0.424284, 0.225617, 0.912966, -0.279135, -0.772619, -0.225541, 0.874601, -0.881013, 0.105617, -0.697949, 0.946845, 0.906891, -0.278485, 0.0716388, 0.442036, -0.826929, 0.101374, -0.153549, -0.700738, -0.633534, 0.495013, 0.0113876, 0.309353, -0.271756, 0.679157, -0.288561, -0.540582, 0.357206, 0.636471, 0.320352, 0.259663, 0.416177, 0.20027, -0.408141, -0.607579, -0.286172, 0.799077, 0.924686, -0.16413, 0.306381, -0.83134, 0.151267, -0.961642, 0.991065, 0.290155, -0.891072, 0.853012, 0.767823, -0.295748, 0.972416, 0.626364, -0.943267, -0.0774058, -0.193136, -0.16812, 0.750682, 0.382663, 0.304661, -0.667227, -0.753324, 0.347168, 0.55974, 0.328971, 0.263163, -0.969445, -0.911064, 0.29526, -0.0377636, 0.818277, 0.628884, -0.614548, -0.765922, -0.450613, 0.379536, 0.213146, 0.109791, 0.611878, 0.777173, 0.425381, 0.427188, 0.0997887, 0.548414, 0.982679, 0.88508, -0.941722, -0.79042, 0.730332, 0.45571, -0.320697, -0.23647, -0.523938, 0.459342, -0.371825, -0.976926, -0.365509, -0.237739, 0.730025, -0.0166631, 0.0771609, -0.779089, 0.0648506, 0.689624, -0.495714, 0.423087, -0.430198, -0.93842, -0.865595, -0.683209, 0.44375, -0.366972, -0.0515522, 0.714885, -0.0473505, -0.513985, -0.785398, 0.93052, 0.513164, -0.0119591, -0.98373, 0.913944, -0.303472, 0.182167, -0.246362, -0.286629, -0.631576, 0.999491, -0.227451, 0.0338706, -0.466517, 0.132328, 0.573126, 0.90055, -0.504223, 0.21649, 0.780529, -0.695184, 0.928937, 0.58052, -0.998108, -0.621193, -0.0749765, 0.434678, -0.179886, 0.996534, -0.660504, -0.0997042, -0.499283, 0.429981, -0.96323, -0.129754, 0.570504, 0.755603, 0.920752, 0.930209, -0.188073, -0.636898, 0.382379, 0.616586, -0.808154, -0.666818, 0.0408134, 0.921132, -0.447173, -0.213431, 0.59204, 0.808067, 0.466807, -0.225495, -0.0192126, -0.920949, -0.511575, -0.887599, 0.419059, 0.156112, -0.289169, 0.909035, -0.54168, 0.0110344, -0.661793, -0.291333, -0.746907, -0.621358, 0.549666, -0.591456, -0.739888, 0.601441, -0.525341, -0.467753, -0.574046, 0.387397, -0.153243, 0.886581, -0.566994, -0.291942, 0.405251, -0.472861, -0.50641, -0.738342, -0.0801056, 0.463862, 0.428568, 0.734864, -0.480651, -0.806697, 0.325328, -0.645953, 0.573197, -0.165569, 0.550612, 0.954409, -0.266088, -0.357951, -0.701895, -0.29743, 0.646062, 0.724698, -0.901953, 0.925327, 0.691429, 0.224003, -0.574055, 0.561949, 0.581164, 0.513179, -0.669722, 0.927204, 0.00981908, 0.076486, -0.509598, -0.824485, -0.776556, -0.510527, 0.141365, -0.457959, 0.969345, 0.183456, -0.938263, 0.410303, 0.155278, 0.505359, -0.604793, 0.63959, -0.202478, -0.839781, -0.254411, -0.583675, 0.506466, 0.390851, 0.282948, -0.254448, -0.0509686, -0.209109, -0.60903, -0.411645, 0.0287299, 0.353836, -0.592491, 0.544647, 0.128858, -0.158715, -0.0850719, -0.703896, 0.92858, 0.967015, -0.557009, -0.127614, -0.897792, 0.180977, -0.249491, -0.176318, -0.442575, 0.152262, -0.854406, 0.111562, -0.234722, 0.132555, -0.415186, 0.672437, 0.358182, 0.39088, 0.660157, -0.365507, -0.555932, 0.06609, -0.752125, -0.69332, 0.516375, 0.509057, 0.591968, -0.0221475, -0.273876, 0.972574, -0.954989, 0.951652, -0.597232, 0.0968007, -0.642143, 0.675135, -0.50217, 0.763988, 0.348129, 0.647876, 0.809037, 0.296609, -0.276781, -0.845361, -0.277004, -0.568729, -0.352168, 0.565365, 0.462468, -0.711287, 0.431987, -0.627657, 0.185066, 0.776916, 0.0739024, 0.731957, 0.287944, 0.110416, -0.636751, -0.416625, 0.308252, 0.790489, -0.91164, -0.205708, -0.394762, 0.00150494, 0.45603, 0.749396, 0.845562, 0.220277, -0.754286, 0.146773, 0.505, -0.548395, -0.599759, -0.883782, -0.360087, -0.896336, 0.330576, -0.854255, 0.343142, 0.161941, 0.155971, -0.779934, -0.337895, 0.516257, -0.905638, 0.723233, 0.834231, 0.322557, -0.121603, -0.825127, -0.0180755, 0.183938, 0.700325, 0.486019, -0.201722, 0.120098, 0.0922296, 0.98824, -0.224895, 0.114266, 0.76532, 0.300133, 0.212595, 0.436507, -0.682499, -0.401695, 0.092714, 0.755788, 0.992873, 0.345191, 0.696552, -0.722654, -0.458794, -0.337355, 0.205697, 0.437027, 0.226246, -0.499802, -0.501374, 0.263785, -0.625526, -0.612625, 0.295034, 0.441351, 0.664292, -0.202042, 0.760828, -0.392477, -0.97594, 0.00960149, -0.573742, 0.260463, 0.215607, 0.623877, 0.624706, -0.781115, 0.0336767, -0.0339017, -0.778191, 0.332315, -0.684514, 0.998054, -0.481025, 0.204278, -0.518378, -0.23242, 0.0702527, -0.145773, -0.446606, -0.772614, 0.805259, -0.734461, -0.943346, 0.497805, -0.339036, 0.798833, 0.969466, -0.62403, -0.930271, 0.482575, -0.61971, -0.922148, 0.492432, 0.173454, -0.468265, 0.695215, -0.301635, -0.676459, 0.545834, -0.641328, -0.0159359, -0.389392, 0.840613, 0.503281, -0.161769, 0.701424, -0.766739, 0.718875, -0.0899529, 0.857053, -0.801922, 0.773808, -0.039852, -0.430512, 0.0546105, 0.613831, 0.803775, 0.843549, -0.0378989, -0.403402, -0.297495, 0.862958, 0.413811, 0.0439049, 0.487913, -0.405983, -0.443683, 0.113967, 0.689444, 0.44301, 0.783319, -0.948824, -0.0193181, -0.593251, -0.0785021, -0.0377621, -0.855891, 0.0866414, -0.502368, 0.308256, -0.0189358, -0.131458, 0.831614, 0.138, -0.944213, -0.392787, -0.626072, -0.456909, 0.976519, 0.326298, -0.16099, 0.671828, 0.637494, 0.404615, 0.0313913, 0.264101, -0.559835, 0.290223, -0.081751, -0.408966, -0.313743, 0.650994, -0.628778, 0.218378, -0.732053, -0.667485, 0.861768, 0.717078, 0.13119, 0.627734, -0.175604, -0.655425, -0.354121, -0.793801, 0.888126, -0.770258, -0.227636, 0.93115, -0.689555, -0.109936, -0.205117, 0.37614, 0.814323, -0.630771, -0.855888, 0.837616, 0.465666, 0.746183, -0.768344, -0.380396, -0.277629, 0.874484, -0.610623, 0.0714774, -0.309799, 0.278464, 0.012117, -0.00824071, -0.936018, 0.795918, 0.18666, -0.233485, 0.780321, 0.846801, 0.928404, 0.436101, 0.296214, -0.144297, 0.875653, 0.329907, 0.0875154, 0.702534, 0.0358112, -0.884064, -0.909408, 0.926912, -0.897212, -0.58661, 0.387754, 0.680483, -0.308395, 0.0120504, -0.570586, 0.873002, -0.49342, -0.0684506, -0.306265, -0.377568, -0.835104, 0.131016, -0.950213, 0.075364, 0.0340089, -0.308228, 0.953645, -0.439596, 0.197847, -0.722723, 0.986524, 0.805107, -0.556727, 0.524541, 0.396941, 0.830929, -0.887722, -0.897816, 0.932224, -0.876264, 0.724139, -0.811321, 0.396351, -0.986953, 0.264003, -0.0617793, -0.818262, 0.277458, -0.545833, -0.809336, -0.8888, -0.128588, -0.374356, 0.981067, 0.214563, 0.336733, -0.700397, -0.660835, 0.608171, -0.380411, 0.270152, -0.907565, 0.209218, 0.0333295, -0.493879, 0.678456, 0.258626, -0.96059, 0.46365, 0.401912, 0.383212, 0.00636186, -0.464568, -0.629236, 0.213239, 0.882174, 0.70707, 0.46582, -0.867465, 0.508297, 0.056354, 0.103202, 0.601241, 0.994562, 0.660691, -0.527679, -0.366963, 0.190123, -0.105649, 0.463359, -0.189052, -0.423743, -0.653407, 0.191547, 0.972259, 0.109754, 0.25215, 0.429431, 0.0409543, -0.472539, 0.00230476, -0.482443, -0.917445, 0.582724, 0.715765, 0.220438, 0.800696, 0.164451, -0.491079, 0.981211, 0.687183, 0.229079, -0.92414, 0.944101, -0.617931, 0.629215, 0.0172735, 0.579031, -0.404541, -0.187914, -0.21666, -0.601527, 0.709518, -0.270218, -0.0168018, 0.502574, -0.399982, 0.841465, -0.0172398, -0.0869117, 0.96507, 0.0918426, 0.754565, -0.997758, 0.306361, -0.89843, -0.107442, 0.232027, 0.0311019, 0.409386, 0.177162, 0.592364, 0.194393, 0.374163, 0.764696, -0.861597, 0.288489, 0.562565, -0.470098, 0.449627, -0.358171, -0.967324, -0.656019, 0.227043, 0.627086, -0.889292, 0.425024, 0.402436, -0.362095, 0.682129, 0.359324, 0.129112, -0.272939, -0.300549, -0.939744, 0.284616, -0.830713, 0.240987, -0.94981, -0.427371, 0.341619, -0.114243, 0.523209, -0.77776, -0.66546, -0.655685, 0.823295, 0.713832, -0.429789, 0.499213, -0.111569, -0.740708, 0.520935, -0.0325288, 0.0188614, 0.524937, 0.960969, -0.0189767, -0.114133, -0.671975, 0.836653, 0.727934, -0.67966, 0.606775, 0.598257, -0.787764, -0.823582, 0.945726, 0.750888, 0.716213, -0.878657, -0.230059, 0.395304, -0.658376, -0.867048, -0.187404, -0.0372982, 0.843413, 0.179587, -0.210651, -0.53595, -0.410856, -0.275703, 0.873194, -0.343698, 0.460442, -0.780237, 0.582374, 0.319991, -0.0710238, -0.416152, -0.653061, 0.992686, -0.455703, -0.822256, 0.687964, 0.0807391, 0.895061, 0.616404, 0.556001, -0.0732232, -0.815558, -0.668913, -0.326458, -0.16015, 0.247661, 0.584046, 0.719188, 0.128566, -0.388335, -0.963955, -0.908979, -0.426419, 0.454466, -0.564277, -0.412682, -0.597581, 0.981023, 0.808267, -0.100136, -0.783901, -0.169276, -0.339039, 0.488616, 0.130422, -0.998907, 0.494786, -0.744101, -0.276713, 0.454188, -0.616924, 0.961929, 0.527914, -0.597226, -0.11923, -0.0845069, -0.801139, -0.154838, 0.318546, 0.665317, -0.586301, -0.768322, -0.416985, 0.417919, 0.413278, 0.560755, -0.0260873, -0.217212, -0.446024, 0.235136, 0.795615, -0.769121, -0.799113, -0.847003, -0.279233, -0.959313, -0.614239, 0.867276, -0.0194914, -0.103866, 0.17961, 0.317348, -0.782145, -0.371917, 0.481146, -0.171914, -0.0262953, 0.311667, -0.129383, -0.843448, 0.0472503, 0.249893, 0.903776, -0.368505, 0.421358, -0.66841, -0.768219, -0.786964, -0.959823, 0.382559, 0.11149, 0.666793, 0.1482, -0.38512, -0.410532, -0.139048, -0.379481, 0.667211, -0.866992, -0.675067, 0.0553428, 0.318433, -0.256675, -0.521062, -0.577167, -0.335033, -0.892447, 0.984138, -0.73333, 0.0871194, -0.616818, -0.765574, 0.729848, 0.115852, -0.85304, 0.461469, -0.980736, -0.612156, 0.954781, 0.161298, -0.641168, 0.117425, 0.481679, 0.323087, -0.13851, -0.954153, -0.601288, 0.677889, -0.943009, -0.453577, -0.295364, 0.489943, 0.66687, 0.24523, -0.200182, -0.804895, -0.123674, 0.714232, 0.329138, -0.504394, 0.899049, -0.827402, -0.129654, 0.749722, 0.332015, -0.0716078, -0.818506, 0.121011, 0.949208, 0.338291, -0.619701, 0.415512, -0.0776705, -0.765972, 0.441026, 0.118159, 0.0426076, -0.718112, 0.389961, 0.2738, -0.033541, 0.220872, 0.920736, -0.59112, 0.404269, -0.705723, -0.978748, 0.483903, -0.325502, -0.334561, 0.412636, 0.998597, 0.889371, -0.740604, -0.652858, 0.216769, -0.988936, -0.816051, -0.555739, 0.829036, 0.555105, -0.807363, 0.357, 0.307863, 0.945663, -0.444033, 0.578841, 0.140568, -0.527101, -0.0359091, 0.522869, 0.75471, -0.267113, 0.109671, -0.402567, -0.0382344, -0.0988332, 0.319341, -0.166936, 0.729612, 0.265578, 0.282194, 0.339243, 0.267774, -0.81393, 0.997375, -0.373301, -0.849745, 0.769559, 0.743349, -0.1459, -0.669669, 0.681739, -0.148183, 0.610946, 0.107074, 0.455864, 0.425684, 0.972621, 0.710978, -0.48739, 0.541451, -0.708517, -0.204603, -0.649299, -0.999454, -0.411999, 0.8852, -0.360154, 0.184348, 0.382123, -0.393009, -0.51385, -0.985785, 0.837542, 0.984588, 0.314752, 0.797338, 0.153878, 0.501876, -0.64364, -0.920828, -0.971584, -0.933655, 0.173012, 0.680905, -0.416483, 0.95279, 0.55412, 0.121538, -0.216406, 0.491219, 0.0497984, 0.717494, -0.748835, 0.0818625, -0.911651, -0.165853, -0.392054, -0.0811182, -0.569662, -0.772411, 0.955283, 0.341625, -0.837011, 0.560477, 0.598215, 0.454045, 0.0270707, 0.198809, -0.105544, -0.682157, 0.803356, 0.671097, 0.732797, 0.211558, -0.5243, -0.0947869, -0.111273, 0.286106, 0.399855, -0.0290083, -0.217955, 0.939589, -0.853054, 0.413798, -0.441373, 0.365911, 0.474776, -0.38786, -0.63471, -0.786634, -0.587684, -0.79888, -0.766979, 0.0284219, -0.390556, 0.537153, -0.0877608, -0.907626, -0.818996, -0.831765, -0.750431, -0.965818, -0.196489, 0.234223, -0.085009, 0.0445641, -0.985337, -0.363226, 0.435362, 0.148372, 0.772323, -0.286228, 0.493573, 0.959672, 0.866096, 0.995933, 0.61863, -0.596201, -0.270601, 0.174852, -0.228257, -0.866446, -0.321598, -0.810287, -0.835805, -0.410434, -0.833633, -0.639153, 0.178013, -0.149323, -0.662968, -0.079725, 0.849053, -0.279992, -0.180038, -0.742199, -0.317793, -0.912871, 0.779623, 0.0390497, -0.466778, 0.798933, -0.0166015, -0.952572, -0.717396, -0.406778, -0.178775, -0.499026, -0.362739, 0.672292, 0.701772, 0.744348, -0.545933, 0.366028, -0.43047, -0.0252733, -0.579021, -0.0825358, 0.337459, -0.742326, 0.468342, 0.0599054, 0.288651, -0.487153, 0.259413, 0.597057, 0.812093, -0.995609, -0.814246, -0.911957, 0.297021, -0.581648, -0.673697, 0.203568, 0.0471397, 0.815558, -0.271189, -0.31721, 0.655817, 0.574615, -0.0720208, 0.550594, -0.471148, 0.734293, -0.406184, -0.350007, -0.215089, -0.766459, -0.329756, 0.723796, -0.657144, 0.461005, -0.698516, 0.620117, -0.677642, 0.390746, -0.311474, 0.89106, 0.522907, 0.341669, -0.210148, 0.379822, -0.141239, -0.961605, 0.850272, 0.0413269, -0.494462, 0.370991, -0.055522, 0.147291, 0.911055, -0.249042, -0.397994, -0.696524, -0.0593798, -0.417815, -0.313176, 0.634592, -0.973316, -0.866092, -0.232037, 0.266442, 0.462049, -0.0183474, 0.38244, 0.13253, -0.474985, 0.268837, -0.908516, 0.447367, 0.520556, 0.639856, 0.729464, 0.157051, 0.688816, -0.114644, 0.0955309, -0.618049, -0.856604, -0.453396, -0.271964, -0.257918, 0.997467, -0.243315, -0.00388752, 0.151823, 0.621466, -0.622848, -0.595881, 0.299224, -0.629849, -0.406892, -0.382468, 0.193927, 0.113182, 0.215602, -0.173599, -0.561145, 0.351494, 0.936737, 0.211381, 0.0371121, 0.84858, 0.646087, -0.240415, 0.463696, 0.648974, -0.28381, 0.601431, 0.555193, 0.600884, 0.980515, -0.936641, -0.801946, 0.320283, -0.38024, -0.0768815, 0.145318, -0.642127, 0.956868, 0.963853, 0.0603498, 0.360576, 0.833771, 0.324164, 0.687449, -0.557657, -0.909675, 0.0815619, 0.0589357, 0.73789, 0.465189, 0.26102, -0.579597, -0.116918, 0.729471, 0.188659, 0.00204007, -0.153218, 0.867231, -0.10929, -0.697708, -0.754773, 0.392769, 0.892452, -0.236029, 0.371554, 0.752179, -0.435158, -0.828965, -0.423883, -0.902819, -0.537434, -0.78569, 0.218842, 0.910271, -0.00855967, 0.17973, 0.269548, -0.221563, -0.0146032, 0.909336, 0.0346896, 0.594716, -0.764004, -0.7151, -0.875382, 0.623597, 0.736494, 0.184891, -0.618456, 0.216663, -0.724743, -0.938902, -0.624586, -0.249771, -0.307529, 0.301192, -0.226512, 0.120389, 0.518425, 0.941183, -0.457713, 0.186498, -0.93225, 0.0183913, 0.667246, 0.237652, -0.620374, -0.314503, -0.136207, -0.996864, -0.427738, 0.0821035, 0.374967, 0.466326, 0.0493688, 0.275528, 0.266491, -0.347716, -0.79098, 0.267369, 0.981722, -0.793822, 0.773095, 0.313435, -0.978257, -0.537228, -0.1654, 0.847682, -0.000803645, 0.119565, -0.589771, -0.501426, 0.166567, -0.172993, 0.556476, -0.710076, -0.960975, -0.0490941, 0.684167, -0.770841, 0.335852, 0.668256, 0.908923, -0.555695, -0.582416, 0.138232, -0.039954, -0.892085, 0.554204, -0.322241, -0.6483, 0.348435, -0.286146, -0.127214, 0.0552502, -0.69718, 0.980584, 0.947782, 0.745346, -0.395917, -0.137791, -0.479394, -0.414974, -0.979496, 0.968421, 0.121561, 0.664433, 0.25929, 0.562325, 0.733151, -0.941422, -0.444556, 0.511191, 0.122758, -0.876202, 0.571727, 0.906172, 0.12297, 0.56828, -0.826409, 0.983839, -0.721387, -0.605383, 0.131289, 0.326661, 0.303269, 0.860899, 0.730576, -0.264017, 0.776888, -0.396587, -0.303201, -0.618087, 0.446878, 0.159836, -0.333038, 0.377472, -0.0230042, 0.379454, -0.508325, -0.422511, 0.507085, 0.838797, -0.923394, 0.723382, 0.0407764, 0.162178, 0.0974852, -0.831715, 0.350916, -0.0586075, 0.975956, -0.0478209, -0.94909, -0.669905, -0.275012, -0.908855, -0.827904, -0.153429, -0.773701, 0.92722, -0.0886431, 0.0515803, 0.00431634, 0.878138, -0.271741, -0.22602, -0.912198, 0.0773611, 0.689351, 0.561936, 0.00953529, -0.316457, 0.752329, -0.509241, 0.120658, 0.240015, 0.36375, -0.556693, -0.196722, 0.520623, -0.643525, 0.452203, -0.421097, 0.700977, -0.693936, 0.201247, 0.212274, 0.835862, -0.0191782, -0.0143454, -0.692526, 0.179281, -0.383488, 0.981323, 0.495867, 0.625044, 0.419701, 0.692362, 0.826785, -0.48728, -0.582487, -0.433446, -0.675833, 0.00868468, -0.454739, -0.479873, -0.147275, -0.210316, -0.342732, 0.0566262, 0.0956433, 0.613609, 0.121916, 0.108614, 0.219427, 0.772289, -0.297861, 0.731533, -0.280468, 0.879772, -0.363302, 0.459449, -0.88606, -0.70723, 0.746634, -0.797325, -0.39784, 0.466334, 0.452129, -0.261187, 0.0979204, 0.502027, -0.543509, 0.325356, 0.436691, 0.786689, -0.184567, 0.424325, -0.340543, 0.868964, 0.46059, 0.357813, 0.718073, -0.21838, -0.981137, 0.645521, 0.0378468, 0.955688, -0.0992163, -0.857291, 0.995097, 0.453056, 0.588751, -0.931008, -0.18565, -0.425846, -0.75819, 0.300038, 0.67079, 0.327123, 0.205676, -0.815012, -0.70904, -0.185657, 0.795788, -0.330818, -0.424756, -0.1333, -0.381165, -0.0493133, 0.537848, 0.736477, 0.621981, 0.660922, 0.380888, -0.35976, -0.0340953, 0.0799247, 0.68864, 8.8916e-05, -0.538104, 0.235571, 0.824849, 0.692256, -0.59981, -0.185755, -0.297446, 0.265486, -0.527446, 0.92047, -0.249501, -0.41987, 0.371217, 0.309231, -0.46816, 0.44475, -0.994597, 0.448572, 0.875769, -0.598255, -0.585491, 0.0729173, 0.94097, 0.497591, 0.515284, -0.814404, 0.813861, 0.622345, 0.411996, -0.339183, -0.608812, -0.35939, -0.552486, 0.189868, -0.339688, 0.222999, 0.670098, 0.172187, -0.479543, -0.114387, 0.870022, 0.652279, -0.503841, 0.584178, -0.848696, -0.860293, -0.614436, -0.0738409, 0.25899, -0.745834, 0.53076, -0.0255437, 0.650436, 0.0214033, 0.686902, -0.980783, 0.207875, -0.308403, 0.0673287, 0.490092, -0.668762, -0.272742, -0.00242807, -0.671356, -0.682032, -0.391816, 0.0968528, 0.480456, -0.718068, 0.714729, 0.550562, 0.172643, 0.822419, 0.467389, -0.947591, -0.0727855, 0.0809277, 0.73321, -0.576375, 0.753055, 0.690887, -0.0349952, 0.416935, 0.764263, -0.0969196, 0.492859, 0.437121, 0.0972911, 0.49434, -0.292277, 0.0294262, -0.638437, 0.869583, 0.789275, -0.796303, -0.102357, -0.778381, 0.580588, -0.0815548, -0.704648, -0.917459, -0.945918, -0.138473, 0.974605, 0.300189, -0.187332, -0.545134, -0.868953, 0.299021, -0.283096, -0.149005, 0.238825, -0.700459, -0.35902, 0.927751, 0.390446, 0.422424, -0.811866, 0.214537, 0.115305, 0.258753, -0.669647, -0.70283, 0.147686, 0.0732167, 0.744842, 0.640483, -0.993407, -0.513875, 0.209808, -0.473728, 0.28034, 0.955484, -0.114734, -0.334923, 0.835234, -0.785355, -0.0478377, 0.818569, 0.392144, -0.822787, 0.982348, 0.881544, -0.109531, 0.204464, -0.030556, -0.420086, -0.700677, 0.748889, -0.997561, -0.338555, 0.141068, -0.0642597, 0.380168, -0.770981, -0.566561, -0.577615, -0.600944, -0.613389, -0.0749777, -0.484086, -0.760899, -0.821455, -0.254011, -0.0649205, 0.609911, -0.0173228, -0.757008, 0.516568, -0.954485, 0.629142, 0.996468, 0.689774, 0.435867, -0.883605, 0.971924, -0.870002, -0.214057, -0.441674, 0.212128, 0.454589, 0.187129, 0.576781, -0.924399, -0.796326, -0.613849, -0.43448, 0.507171, -0.0486801, 0.140456, -0.227388, 0.494904, 0.612749, -0.714698, 0.341512, 0.389343, 0.948466, -0.481515, -0.0795847, -0.742246, 0.734632, 0.969609, -0.0279478, 0.126166, 0.912938, -0.0988968, 0.250962, 0.254934, -0.054152, 0.744185, 0.655193, -0.494646, -0.465962, 0.88071, 0.591632, 0.379413, 0.923204, 0.00189348, 0.985507, -0.934927, 0.165223, -0.825694, -0.542863, -0.462997, 0.281738, 0.88644, -0.690555, 0.500183, 0.91768, -0.593311, -0.346893, 0.764832, -0.375794, -0.0686848, -0.164097, 0.443814, -0.932535, 0.10343, 0.269134, 0.550025, -0.691917, -0.857272, -0.394729, 0.0398627, 0.745099, -0.469099, 0.123952, -0.644125, -0.271009, 0.0365804, 0.568417, -0.328781, 0.248025, -0.152477, -0.53857, 0.268266, -0.497296, -0.684099, 0.721999, 0.32845, 0.924291, -0.403245, 0.513038, 0.356816, -0.2298, -0.0448856, 0.042771, -0.804244, -0.0122838, 0.447223, 0.31884, 0.387458, -0.0653015, -0.477961, 0.265825, -0.929574, 0.256202, 0.230759, -0.0643911, -0.926946, 0.442446, 0.806109, 0.441146, -0.234426, -0.167062, -0.477418, -0.68693, 0.843728, -0.514311, 0.690564, 0.875895, -0.418242, -0.138802, -0.633317, -0.669033, -0.720966, -0.403237, -0.119808, 0.656305, -0.165158, 0.041399, 0.984624, -0.126756, 0.417226, -0.0593891, -0.593464, 0.519539, 0.911079, -0.311435, 0.734571, -0.490464, 0.977202, -0.912372, -0.297521, 0.97477, 0.109431, -0.59777, 0.175875, 0.0141125, -0.894896, 0.132678, 0.933652, 0.812226, 0.360479, -0.871504, -0.42108, 0.287995, 0.943069, 0.0150439, 0.943448, -0.955636, 0.832499, -0.027563, 0.597124, 0.562934, 0.00988939, 0.599901, 0.0135719, 0.775248, 0.382131, 0.339929, 0.612523, 0.40517, 0.117133, 0.769451, -0.242372, 0.162591, 0.960567, -0.76617, 0.145817, 0.0363423, 0.540122, 0.467077, 0.302499, 0.291642, -0.59794, -0.158046, -0.42731, -0.692836, 0.829693, 0.234156, 0.493517, 0.694481, -0.651458, -0.693843, -0.505282, 0.577523, 0.615838, 0.272775, -0.187516, 0.547068, 0.813964, -0.405928, 0.318249, -0.771902, 0.240436, -0.215657, 0.421746, 0.935469, -0.870876, 0.992742, 0.484704, 0.618591, -0.84286, -0.0360099, 0.184296, 0.877268, -0.294991, -0.687136, 0.595182, 0.0801568, -0.561146, -0.0719433, 0.212277, 0.104946, -0.69983, -0.505642, 0.822349, 0.835735, -0.873429, -0.630253, 0.638685, 0.955792, 0.34821, -0.0606309, -0.752234, -0.458217, 0.985084, -0.40963, -0.475605, -0.380059, 0.0317142, 0.820764, -0.784449, -0.245902, 0.114936, 0.261238, -0.654169, -0.33885, -0.337809, 0.0867041, 0.0335439, 0.118095, -0.759295, -0.252181, 0.430921, 0.144569, 0.279993, 0.929582, -0.037912, 0.126096, -0.434311, 0.410464, -0.576965, -0.423043, -0.656859, -0.202343, -0.364205, -0.687986, 0.0550793, 0.342052, -0.825139, 0.29228, -0.952675, 0.937616, 0.103606, -0.425629, -0.568911, -0.633073, -0.819933, -0.335303, 0.46924, -0.0141975, 0.923399, -0.693102, -0.0340241, -0.452081, 0.737639, 0.802653, -0.0513404, 0.361785, 0.738921, 0.289497, 0.791251, -0.812187, -0.944542, -0.689688, 0.015511, 0.750692, -0.574724, 0.455301, 0.570441, -0.213151, 0.846522, 0.0276052, -0.433805, 0.690361, -0.334001, 0.35666, 0.279152, 0.187063, -0.401243, 0.4071, -0.740661, 0.665228, -0.229574, 0.95932, -0.625142, -0.57338, -0.602141, -0.260671, -0.90926, 0.289068, -0.4151, -0.527486, -0.840828, -0.704108, -0.593853, 0.726999, -0.208948, -0.446153, 0.920151, -0.35119, 0.789573, -0.552341, 0.798904, -0.0338525, 0.313596, 0.755416, 0.255133, -0.365421, -0.345298, 0.134129, 0.0698548, -0.649661, -0.895751, 0.10936, -0.0436211, -0.917003, 0.455307, 0.352184, 0.715912, -0.183334, -0.0158224, -0.612324, -0.0540849, -0.426164, -0.849102, 0.510686, -0.189732, -0.409983, 0.226433, 0.561092, 0.345961, -0.0468326, 0.97994, 0.614063, 0.835775, -0.0502389, 0.16869, -0.86929, -0.525475, -0.716308, 0.738264, 0.725272, -0.616576, -0.994722, 0.981583, 0.881114, 0.885857, -0.220505, 0.877624, -0.843538, 0.0804073, 0.693325, -0.279634, -0.28607, 0.84536, -0.135227, 0.466625, -0.542525, 0.601837, -0.449237, 0.729548, -0.592739, 0.949302, 0.562514, 0.35002, 0.492233, -0.72971, 0.197368, 0.908571, -0.293756, -0.737991, -0.0517762, 0.349252, 0.277958, 0.416953, -0.799522, -0.88516, -0.713617, -0.702303, 0.087757, 0.196844, -0.331846, 0.624067, -0.519363, 0.706697, -0.715212, 0.142161, -0.390137, -0.784337, -0.0463437, 0.71258, 0.0771765, -0.9422, 0.890196, -0.490515, 0.99334, -0.27222, -0.0605252, 0.161147, -0.585689, 0.231012, 0.579145, 0.849385, 0.410989, -0.672445, 0.397054, -0.0282604, -0.877167, -0.176286, -0.793034, 0.215685, 0.29228, -0.184451, 0.6696, -0.352057, -0.303343, -0.483608, 0.897959, 0.510315, 0.886114, -0.137152, 0.154843, 0.147335, 0.341153, -0.589065, 0.398343, -0.444103, 0.685476, 0.76656, -0.175713, 0.339548, -0.906457, -0.0675687, -0.140737, -0.137116, 0.121136, -0.162914, 0.114507, 0.437248, 0.567389, -0.155332, 0.437236, -0.655184, 0.203591, 0.526508, -0.783671, -0.821536, 0.422821, 0.232582, -0.856072, -0.687276, -0.709082, -0.154512, -0.593795, -0.798031, -0.36629, 0.661559, 0.960623, -0.851251, 0.23228, 0.501246, 0.0786714, 0.185025, -0.612896, -0.900336, -0.934725, -0.349876, -0.115374, -0.159369, -0.855263, -0.957302, 0.194487, -0.227479, 0.606202, -0.95848, 0.337834, -0.680492, -0.923794, 0.109064, 0.507843, 0.822495, -0.30446, 0.628916, 0.45288, 0.19917, 0.521533, -0.570125, 0.163819, -0.164064, 0.496511, 0.540865, -0.298374, -0.654365, 0.806277, 0.00756979, -0.752962, -0.98872, 0.603421, -0.506577, 0.359808, -0.603189, 0.278672, 0.551959, -0.28756, 0.146597, 0.725196, -0.156418, -0.266119, 0.205324, -0.041619, -0.470759, 0.0605193, 0.663214, -0.763651, -0.811463, -0.44842, -0.600234, 0.993811, -0.725933, -0.186959, -0.187546, 0.735548, 0.00908467, -0.365643, -0.791701, 0.190627, -0.767137, -0.917899, 0.580912, 0.150789, 0.809817, 0.551311, 0.947224, 0.542475, 0.939412, 0.726605, 0.835946, -0.0688705, 0.40238, 0.563979, 0.237321, 0.395622, -0.162909, 0.824273, 0.506321, -0.275123, 0.576484, 0.111302, -0.386902, -0.704891, -0.744976, -0.168045, -0.401395, 0.155493, -0.418518, 0.384393, 0.743549, -0.362156, 0.0896347, 0.548946, -0.364202, -0.939548, 0.432357, -0.523799, 0.0377514, -0.195798, 0.350932, 0.786704, -0.482247, -0.0202947, 0.233193, 0.881787, 0.848062, 0.259622, -0.689379, 0.0470845, -0.311421, 0.807849, -0.517382, 0.598049, -0.794453, 0.460806, -0.238235, 0.923093, -0.578105, 0.00768198, -0.101321, 0.0989544, 0.0306356, -0.742637, 0.654818, -0.336783, -0.717248, 0.860306, 0.938701, 0.969892, -0.793874, -0.161675, -0.72902, 0.61034, 0.157597, -0.898056, 0.928544, 0.992681, 0.950871, 0.905605, 0.271537, 0.0381626, -0.535104, -0.0583094, 0.904435, -0.187134, -0.35855, -0.482192, -0.123977, -0.08803, 0.930454, -0.275792, -0.939139, 0.684105, -0.499424, 0.354231, 0.881899, 0.0564047, 0.348467, -0.743263, -0.703156, -0.613758, 0.712884, 0.665304, 0.608751, -0.700299, 0.854947, 0.693195, 0.452132, -0.202946, 0.774965, -0.752032, -0.607609, 0.54848, 0.8767, -0.449001, 0.335722, 0.704435, -0.620635, -0.803815, -0.675478, -0.959482, -0.308833, -0.803784, 0.414062, 0.110983, -0.677416, -0.991393, -0.298158, 0.0489075, -0.663047},
-	{0.510964, -0.848766, 0.770488, 0.442663, 0.156736, 0.163747, -0.836131, -0.502791, -0.705273, 0.706345, 0.0686922, 0.86737, 0.0513752, 0.861341, -0.0796279, 0.534554, -0.383102, -0.548207, -0.409549, -0.930844, 0.950133, -0.253422, -0.470151, -0.0471159, 0.258827, 0.499108, -0.988706, -0.530262, 0.150049, 0.787344, -0.329978, -0.553297, -0.575603, -0.231505, 0.266662, -0.405764, 0.742612, -0.271635, 0.14683, 0.636711, 0.294828, 0.571258, 0.194151, 0.572296, -0.916307, -0.559377, 0.303865, -0.18368, -0.981342, -0.00355668, 0.248622, 0.0490953, -0.206859, 0.0154495, 0.673947, 0.0686102, -0.162105, 0.144968, 0.108583, -0.982501, 0.328814, 0.0426925, -0.906742, -0.678395, 0.785167, 0.682505, 0.60425, 0.838199, -0.682984, -0.123274, -0.766113, 0.166388, -0.167019, -0.454606, 0.194575, 0.0520518, 0.92331, 0.925254, 0.195487, -0.250071, 0.624141, 0.530795, 0.57778, -0.770146, 0.0501522, 0.572884, -0.341869, 0.879183, -0.829478, 0.58134, -0.678942, 0.975602, 0.460085, -0.665676, -0.436775, 0.24965, 0.728635, -0.110638, -0.0179217, -0.759229, 0.975111, 0.170084, 0.00959809, 0.265194, 0.874832, 0.293224, -0.262668, 0.223881, -0.878763, 0.223521, 0.945258, 0.448179, -0.664732, -0.8923, -0.075161, 0.556645, 0.917255, -0.0341729, 0.781892, 0.848784, -0.119106, -0.504778, 0.20819, -0.813303, -0.531445, -0.210082, -0.497782, -0.09033, -0.0191054, 0.455775, -0.614877, -0.534433, 0.125249, -0.772523, 0.322189, -0.300301, 0.610116, 0.689871, 0.244824, 0.700684, 0.512443, 0.208961, -0.269221, -0.67911, -0.0301019, -0.859024, -0.491279, -0.133312, 0.31671, 0.502999, 0.214061, 0.698442, -0.848383, -0.300059, 0.951547, -0.302012, 0.821967, 0.327519, -0.607442, -0.739072, -0.789212, -0.452198, 0.505845, -0.781093, 0.0445515, 0.568067, -0.229475, -0.983278, -0.758231, -0.836711, 0.292563, -0.738452, 0.209123, 0.0786662, 0.106236, -0.147038, -0.72251, 0.947649, -0.932602, -0.116973, 0.342898, -0.496146, -0.304607, 0.767928, 0.788365, -0.44959, 0.786049, 0.380196, -0.280196, 0.29075, -0.985314, 0.374307, -0.746582, 0.142164, 0.403376, 0.320181, 0.685751, 0.816753, -0.440769, -0.637354, 0.734786, 0.452918, -0.782169, 0.472894, 0.922306, -0.772407, -0.775077, 0.168799, 0.792538, 0.423755, -0.68902, -0.665558, 0.226553, 0.319576, 0.358518, -0.438891, -0.329816, 0.368424, 0.370255, 0.858015, 0.625779, -0.987462, -0.259887, -0.754153, 0.469429, -0.457162, 0.773485, 0.00818032, -0.666769, 0.424004, -0.703229, 0.93793, 0.427931, 0.394747, -0.164944, 0.201111, 0.803061, -0.129738, -0.0763672, -0.269289, -0.909828, 0.91674, -0.53116, 0.342523, 0.557692, -0.852543, -0.371269, -0.0828986, -0.572186, -0.734039, -0.539603, 0.462102, 0.197975, 0.18785, 0.288576, 0.946251, 0.522837, 0.591888, -0.277094, 0.240178, 0.0422006, 0.410446, 0.466547, 0.525082, -0.968974, 0.631999, -0.877234, 0.384143, 0.190899, 0.752924, -0.353201, -0.0815286, -0.767988, 0.846638, -0.947259, -0.177747, -0.229813, -0.772259, -0.341617, 0.591792, 0.926875, 0.266817, -0.149486, -0.863076, -0.133127, 0.236883, -0.239111, -0.105922, -0.536411, 0.736464, -0.183405, 0.15458, -0.958899, 0.25199, -0.374473, -0.84622, 0.75788, -0.14792, -0.322495, 0.90646, -0.445411, 0.11131, -0.362847, 0.936563, -0.506802, -0.879087, 0.221348, -0.808147, -0.511858, 0.516869, 0.862826, 0.73145, -0.0533735, 0.865947, -0.924414, -0.402243, 0.903213, 0.90669, 0.363339, 0.524345, 0.449926, 0.551333, -0.399354, 0.743022, -0.422834, -0.158295, -0.129314, -0.755447, 0.420637, -0.468797, 0.553007, 0.891204, -0.94342, -0.913903, -0.727103, -0.597728, 0.5408, -0.133412, 0.374496, -0.728141, -0.884258, 0.294013, 0.206708, -0.686371, -0.640996, -0.41194, -0.393398, 0.296106, -0.232483, 0.291102, 0.786341, -0.590275, -0.579282, 0.909216, 0.132562, -0.751442, 0.373732, -0.886838, 0.357986, -0.367465, 0.554853, -0.934235, 0.163643, 0.187079, -0.120237, 0.226979, -0.0141564, 0.180386, -0.135491, -0.209842, -0.823686, 0.400461, 0.787097, 0.40781, 0.77466, -0.274216, -0.930158, 0.78557, -0.669355, 0.119005, -0.232121, 0.436143, 0.851479, -0.905805, 0.998433, -0.509206, 0.155846, 0.315111, 0.770219, 0.454656, -0.832998, 0.680694, 0.510194, 0.448968, 0.204411, -0.234838, -0.932293, 0.0745764, -0.0061936, 0.589815, 0.724724, 0.0355049, 0.0710606, -0.227301, -0.721267, -0.817814, 0.269475, -0.641878, 0.030643, -0.379566, 0.0186713, 0.274591, 0.688876, -0.760038, 0.75631, 0.142433, -0.443249, -0.17751, 0.122947, -0.742791, 0.0202915, 0.737804, 0.138124, -0.971881, -0.520412, 0.953219, -0.479842, 0.20817, 0.567239, 0.631277, 0.122222, 0.0433642, 0.600844, 0.393066, -0.0100646, 0.880652, 0.54274, 0.744841, 0.68373, 0.873022, 0.248426, -0.317329, 0.844473, 0.789259, -0.777265, -0.321715, 0.623461, -0.65301, 0.375912, 0.274928, 0.922016, -0.56347, 0.959955, -0.81991, -0.752479, -0.0886315, 0.849232, -0.4425, -0.222241, 0.308484, 0.327785, 0.234833, -0.211866, -0.686783, -0.456644, -0.469398, 0.893704, 0.815098, -0.283197, -0.857463, 0.691146, 0.408436, 0.182071, 0.30813, -0.878349, 0.129399, -0.452759, -0.308247, 0.933401, -0.373555, -0.496149, 0.246362, -0.0581281, -0.634523, -0.866733, -0.559705, 0.408131, -0.310983, -0.94688, 0.892982, -0.616517, 0.130838, 0.393604, -0.0384505, -0.0825747, 0.893081, -0.757974, -0.790076, 0.149458, -0.558686, 0.756463, -0.459559, -0.0625064, -0.200701, -0.918173, 0.53454, 0.0147844, 0.983671, -0.519383, 0.516408, -0.015976, -0.198127, 0.0150967, 0.540115, 0.313663, -0.444408, 0.139917, 0.486849, 0.440117, -0.791348, 0.865223, 0.112893, -0.371064, -0.752214, -0.782284, 0.282034, -0.275658, -0.71885, -0.020294, 0.00734062, -0.257309, 0.757857, -0.349843, -0.306167, -0.587929, 0.884528, -0.467387, 0.781176, -0.341727, 0.344641, -0.593151, -0.841898, -0.0783051, 0.939159, -0.773337, -0.791519, -0.257676, -0.806613, -0.0972947, 0.606114, 0.263603, 0.60576, -0.812262, 0.0502054, -0.210291, -0.64594, 0.74543, 0.960539, 0.959927, -0.435713, 0.948166, -0.667746, -0.439583, 0.192136, 0.955726, 0.330424, -0.0924585, 0.47941, -0.275073, -0.0676699, -0.800085, 0.603914, -0.903733, 0.0116157, -0.523009, -0.448199, -0.635435, -0.275304, -0.437511, -0.501895, 0.283822, -0.963511, 0.679491, -0.23411, -0.968694, -0.403558, 0.365659, 0.767508, -0.548137, 0.472058, 0.11419, -0.0671498, -0.703846, -0.343244, 0.55945, 0.329245, 0.237026, 0.932988, -0.165891, -0.904074, -0.736139, 0.950246, 0.879937, -0.190146, 0.085029, -0.794991, -0.102645, -0.6684, -0.962675, -0.851423, 0.889135, 0.601062, 0.471032, -0.738439, 0.513065, -0.689818, 0.162058, -0.840503, -0.38944, 0.58784, 0.672865, 0.439882, 0.636794, -0.0398192, -0.857843, -0.859755, -0.0163811, 0.466118, 0.982105, -0.990841, -0.60756, -0.629474, -0.407857, 0.839998, -0.918607, -0.818965, -0.718271, -0.661832, -0.944924, 0.846008, -0.18228, -0.725211, 0.34996, -0.871168, 0.588276, 0.461904, -0.581469, 0.579689, 0.831425, 0.0662187, -0.704682, -0.353909, 0.920017, -0.442822, 0.919249, -0.834083, -0.811316, 0.615999, 0.299053, -0.701618, 0.0729872, -0.925151, 0.809344, 0.739958, 0.215693, -0.635852, 0.117064, -0.511334, 0.009536, 0.0802584, -0.0212552, -0.593978, -0.294278, 0.340903, -0.690602, 0.816025, 0.31579, -0.0578579, -0.902705, 0.457492, -0.518869, 0.00366043, 0.873752, 0.941618, 0.0745384, -0.459496, 0.792143, 0.814875, 0.487354, 0.434799, 0.0674842, 0.525123, 0.456155, -0.951837, -0.830017, 0.227478, -0.0732581, -0.289264, -0.571061, -0.913768, -0.989257, 0.201884, -0.823319, 0.0385448, -0.211065, -0.173687, 0.334934, 0.7308, -0.730564, 0.191576, 0.959857, -0.201026, -0.898681, 0.426206, -0.717826, 0.772098, -0.40984, 0.801497, -0.632595, 0.132278, 0.223658, 0.251868, -0.353549, 0.386447, 0.849372, -0.895534, 0.871421, 0.0817112, 0.437921, -0.226013, -0.441394, -0.354106, -0.28428, 0.776234, -0.132997, -0.897727, 0.241613, 0.747531, -0.748014, -0.471941, -0.12036, 0.766002, -0.0766885, -0.228892, -0.474704, -0.909569, -0.225199, 0.0496741, -0.533036, 0.0449666, 0.0717567, -0.811123, -0.0786286, 0.135536, 0.148834, 0.0123286, 0.312649, 0.821635, 0.752435, -0.528228, 0.290552, -0.889283, -0.670592, 0.773503, -0.594758, -0.19824, -0.329523, -0.0254708, -0.57527, -0.93232, -0.264366, 0.0690705, -0.535677, 0.360423, -0.451481, 0.318357, -0.622789, 0.247625, 0.0513816, -0.510938, 0.0918414, -0.262117, -0.915754, -0.201243, -0.0353382, 0.550051, -0.636032, -0.745086, 0.471015, 0.65464, 0.0365257, 0.0305007, 0.0880786, -0.676638, 0.940676, -0.0204916, -0.398943, -0.668181, 0.906578, 0.791715, 0.888791, 0.116477, -0.696307, -0.790115, -0.104978, 0.639203, 0.132959, -0.0100641, -0.756168, -0.816942, -0.713243, 0.656497, 0.53773, 0.307533, -0.250174, -0.698693, 0.999371, 0.00845204, -0.905066, 0.944238, -0.83084, -0.958466, 0.176002, 0.331923, -0.442548, 0.294656, 0.801934, -0.944721, -0.882434, 0.576678, 0.0532146, -0.166048, 0.0124425, 0.336629, 0.613726, 0.553117, 0.733714, 0.571742, 0.978846, -0.571357, -0.0610003, -0.898002, 0.956028, -0.968207, 0.0481024, -0.669615, -0.557667, 0.557432, 0.787918, -0.425325, 0.912035, -0.0068369, 0.936714, -0.75489, -0.658627, 0.866359, 0.187788, -0.765808, 0.828553, 0.132998, -0.815397, -0.575724, 0.926864, 0.446128, -0.802033, -0.943624, 0.00629786, -0.557471, 0.38106, 0.671628, 0.206681, 0.707595, -0.642257, -0.758151, -0.878682, -0.48674, 0.893725, 0.462906, 0.3464, 0.454594, -0.554209, -0.164509, -0.687962, -0.38276, 0.539979, 0.800741, 0.769461, 0.494037, -0.459779, 0.76232, -0.640285, 0.38904, 0.747459, 0.624624, 0.570034, 0.11172, 0.2715, -0.957258, -0.892067, 0.281979, 0.391472, 0.941883, 0.859908, 0.567114, 0.312756, -0.74252, -0.012664, -0.481816, -0.608831, -0.575332, -0.0876297, -0.930688, -0.251436, 0.841824, 0.4965, 0.480808, -0.079284, 0.99422, 0.762649, 0.483928, -0.017308, 0.970301, 0.815885, -0.954566, -0.107201, -0.233911, 0.855198, -0.531018, 0.767672, -0.351006, -0.515111, 0.504368, -0.437429, -0.466844, 0.437462, -0.136757, 0.0177162, -0.970434, -0.638799, 0.0417862, -0.280021, -0.476374, 0.752807, 0.696242, -0.187917, -0.147233, -0.201789, -0.611365, -0.57489, 0.396809, 0.516514, -0.314834, 0.621921, -0.109592, -0.920811, 0.344841, -0.657183, 0.142191, -0.824705, -0.0653205, -0.638029, 0.195755, 0.322563, 0.339326, 0.0480599, -0.879257, 0.477182, -0.77739, 0.757156, 0.142631, 0.516767, 0.484043, -0.0564368, 0.166839, 0.996995, -0.413392, 0.131819, 0.61369, 0.268297, 0.989426, -0.801544, -0.577514, -0.962076, -0.461157, 0.35002, 0.508013, 0.329422, 0.241183, -0.379516, -0.462514, 0.406388, -0.232348, -0.0317941, 0.0980024, -0.810516, -0.923228, 0.354151, 0.919013, -0.607171, 0.500908, -0.122646, 0.81984, -0.342761, 0.0445851, 0.743442, 0.0209324, -0.20372, 0.345345, -0.242264, 0.207497, -0.810041, 0.607759, 0.236664, -0.425087, 0.614845, 0.337056, 0.542604, -0.055674, 0.502794, 0.698312, 0.0996996, 0.222315, 0.156005, 0.468877, -0.277388, -0.451701, -0.581569, -0.166857, 0.0193651, 0.333568, -0.312609, 0.987675, 0.717978, -0.536261, 0.199232, 0.77861, -0.577851, -0.418968, -0.719552, 0.246336, 0.348615, -0.670061, -0.568148, -0.357531, -0.626531, -0.812377, -0.903667, 0.655774, 0.0414934, -0.974383, 0.102406, -0.892141, -0.407955, 0.824936, 0.860372, -0.432208, 0.106457, -0.414771, 0.984628, -0.995187, -0.335602, 0.174464, -0.68728, 0.824395, -0.527282, 0.0227736, -0.453869, 0.412552, -0.11855, -0.142809, -0.8512, 0.357532, 0.966357, -0.8324, 0.982399, 0.563128, 0.134623, -0.650352, 0.769299, 0.842108, -0.0896443, 0.850726, -0.0322605, -0.682625, -0.418438, -0.24095, -0.815583, -0.857318, -0.684943, 0.974856, 0.975966, -0.144039, -0.255695, -0.190972, 0.783421, 0.572826, -0.904384, 0.329826, 0.255314, 0.204459, -0.123829, 0.335536, 0.0674327, -0.0120182, 0.0582551, 0.272087, -0.639232, 0.3197, -0.304612, 0.209598, 0.996512, 0.700607, -0.445095, 0.811936, 0.902439, 0.182218, -0.436759, 0.968567, -0.359506, 0.312227, -0.619723, 0.595541, -0.59631, 0.149131, -0.448575, 0.216277, -0.833639, 0.44279, -0.0563933, -0.391853, 0.173632, -0.103442, 0.527948, 0.709593, -0.31926, 0.264255, -0.39228, 0.893276, 0.294127, -0.0927033, -0.640921, 0.202926, -0.435376, -0.784298, 0.391427, 0.770098, 0.511871, -0.205175, 0.429356, -0.595901, -0.701005, 0.510309, 0.167076, 0.599131, 0.159324, 0.752946, 0.38758, 0.538882, 0.828513, 0.65217, -0.652661, 0.942492, -0.639276, 0.836234, 0.954065, 0.962216, 0.0412061, -0.61569, -0.13292, -0.964072, -0.174142, -0.245791, -0.710305, -0.79375, -0.331514, 0.331771, 0.746093, -0.480224, -0.968333, 0.467494, -0.358251, -0.547212, -0.544562, 0.940373, -0.762103, -0.787882, -0.880992, -0.652333, 0.168986, 0.495061, 0.723506, 0.821192, 0.533007, -0.963477, -0.769761, 0.0739509, -0.0904188, 0.707258, 0.729133, 0.763767, 0.784119, -0.0739876, -0.265386, -0.172011, -0.0902353, 0.15599, 0.335644, 0.49338, 0.392163, 0.705801, -0.935045, -0.0532085, 0.421564, 0.285761, -0.221854, 0.724546, 0.402767, 0.224138, 0.734807, -0.897239, -0.834543, -0.133961, -0.713723, -0.14319, -0.400995, 0.751721, -0.19431, 0.104178, 0.555022, 0.748504, 0.71561, -0.67438, 0.258173, -0.830467, -0.202118, -0.567251, 0.65363, 0.371688, -0.0400698, 0.91475, -0.752045, -0.00239457, 0.158696, -0.646449, 0.656031, 0.258319, -0.854219, 0.785765, 0.108357, -0.381001, -0.955623, 0.374292, 0.99865, -0.972697, -0.435825, 0.461094, 0.436359, 0.653903, -0.883742, -0.428133, -0.69154, -0.828518, 0.800609, 0.148064, 0.508575, 0.367265, -0.492417, 0.546228, -0.619324, 0.216974, -0.705394, -0.407529, 0.402199, 0.594016, 0.0370153, 0.0136103, 0.296162, -0.881622, 0.126727, 0.256662, -0.364852, 0.378377, 0.109172, 0.0249723, -0.397332, 0.683996, -0.225889, 0.389797, -0.996814, 0.241674, -0.784315, 0.940826, -0.907655, 0.745373, 0.654865, 0.833083, 0.686169, 0.711935, 0.0561432, -0.0356597, 0.886913, -0.00420853, 0.758675, -0.125127, 0.373362, 0.90048, 0.218737, -0.856175, -0.111491, -0.320342, -0.502454, 0.627744, -0.730831, 0.90227, -0.434725, -0.918561, 0.852993, 0.860377, -0.188179, -0.292284, -0.261011, -0.657726, -0.608153, -0.81299, -0.859978, -0.330763, -0.362791, -0.882779, 0.626822, 0.82205, 0.889067, 0.545129, -0.317863, -0.650847, 0.807018, 0.0938137, -0.820608, 0.0788699, -0.527699, 0.575095, 0.999207, -0.0317396, -0.654829, -0.554796, -0.546471, 0.959197, 0.393038, -0.297786, -0.828894, -0.907169, -0.648372, 0.669015, 0.11686, -0.243757, 0.091238, 0.720843, -0.398057, 0.655347, -0.278681, 0.935061, -0.229427, -0.110649, -0.594796, 0.382895, 0.305678, 0.963071, -0.483606, 0.442033, 0.0344203, 0.502146, -0.364812, -0.66156, -0.209352, -0.635903, 0.49649, -0.28854, -0.344907, 0.881331, 0.979575, 0.815563, -0.497354, -0.178483, -0.241221, 0.269852, 0.312756, -0.88512, -0.816241, -0.605556, 0.102076, -0.541589, 0.698873, -0.571729, 0.412637, 0.209723, 0.290571, -0.682342, -0.582998, 0.645894, -0.104613, 0.240113, -0.631517, -0.630696, -0.525057, -0.971212, -0.124553, 0.976247, -0.912664, 0.67462, -0.0255981, 0.31501, -0.407882, -0.706066, 0.661921, -0.777784, -0.975737, 0.759941, 0.894351, 0.823411, -0.785811, 0.79159, -0.914982, -0.254561, 0.300774, -0.283943, 0.337955, 0.738708, 0.939422, -0.605043, -0.232084, -0.312409, -0.916519, 0.813847, 0.802289, -0.99552, -0.336114, -0.187191, 0.645329, 0.0858562, 0.835354, -0.765755, 0.79385, 0.24624, 0.868318, -0.67001, -0.51665, 0.209248, -0.530508, -0.315144, 0.71218, -0.0301567, 0.964159, 0.237458, 0.571526, 0.491894, 0.626811, -0.853258, -0.147935, -0.198989, -0.31684, -0.312998, 0.978971, -0.53709, -0.129764, 0.666571, 0.517791, 0.561395, -0.341887, -0.610191, 0.963073, 0.0661385, 0.0152953, -0.626093, 0.475835, 0.392498, -0.0718231, 0.792606, -0.478204, -0.085366, 0.641105, 0.424966, 0.162811, 0.321328, -0.0503788, -0.736407, -0.395016, 0.583898, -0.60302, -0.004594, -0.894512, -0.715923, -0.832525, -0.79787, -0.129607, -0.440793, 0.789156, 0.238817, 0.338246, 0.585352, 0.198229, -0.577674, -0.104266, -0.0179773, 0.478056, -0.207369, 0.397533, 0.265019, -0.610381, -0.218558, -0.727786, 0.694485, -0.438254, 0.536766, 0.571399, -0.961868, -0.253715, -0.306991, -0.445565, -0.344592, -0.124125, -0.649076, -0.975082, 0.985557, -0.753206, 0.942164, 0.750055, -0.284033, -0.687872, -0.713319, 0.538068, 0.0528519, -0.944163, -0.955854, 0.398042, -0.861333, 0.835684, 0.710181, 0.996813, 0.48802, 0.0711728, 0.534423, -0.208974, 0.406192, -0.677968, -0.870862, 0.100248, 0.327415, 0.594563, -0.400949, 0.394724, -0.619559, 0.118618, -0.557595, 0.209594, 0.109065, -0.718826, -0.0056368, 0.885773, -0.262261, -0.851028, -0.770425, -0.882907, 0.659056, 0.0784773, 0.0358196, -0.759033, 0.540958, 0.0849423, 0.719516, 0.929996, 0.620965, 0.467275, -0.00294982, -0.398555, -0.330065, 0.893269, -0.190336, 0.973286, 0.393089, -0.764647, 0.698724, 0.250303, 0.845929, 0.205719, 0.690112, 0.682742, 0.130612, 0.593349, -0.511903, 0.459121, -0.423312, 0.322171, -0.57327, -0.831155, 0.481585, -0.343988, 0.644432, -0.737104, 0.670418, -0.116027, -0.97789, 0.010898, 0.598223, 0.389575, 0.437819, -0.739262, -0.0184128, -0.198682, -0.773768, -0.0378637, 0.567302, -0.68838, 0.414594, 0.418235, -0.0250545, 0.944268, -0.0989181, 0.928263, 0.268889, 0.0782942, 0.296315, 0.649299, -0.568883, -0.846757, 0.410916, -0.386608, -0.843205, 0.450985, 0.103586, -0.574276, 0.0907909, 0.405148, -0.675713, -0.0411675, 0.368648, 0.545445, -0.0268264, 0.498608, -0.229642, 0.0708313, -0.570374, -0.485361, -0.0134832, 0.117816, -0.549514, -0.157218, 0.218826, -0.92395, 0.718004, 0.328341, 0.701114, 0.610052, 0.720175, 0.703663, 0.531303, 0.0726127, 0.203854, 0.23516, 0.0542678, -0.223332, 0.885775, 0.985509, -0.175252, -0.930332, 0.677793, 0.776316, 0.770905, -0.954821, -0.329912, 0.502633, 0.0889474, -0.45981, -0.92329, -0.162999, -0.703691, -0.34133, 0.967018, -0.0606685, -0.880299, -0.672564, -0.165622, 0.664335, 0.0849242, -0.641814, 0.80017, -0.385821, 0.0757886, 0.0657797, -0.290229, 0.189575, 0.391294, 0.204876, 0.820561, 0.327904, -0.512279, -0.856537, 0.447802, 0.868816, 0.632977, -0.831753, 0.869193, 0.221335, 0.322612, -0.777578, 0.222822, -0.790282, -0.824686, 0.484825, 0.542496, 0.987243, -0.298781, 0.199471, 0.970704, -0.697363, -0.410344, -0.140825, -0.0146061, 0.73923, -0.823255, -0.133103, -0.591109, -0.993981, -0.744553, 0.543148, 0.567229, 0.404599, 0.217436, 0.023413, 0.646721, 0.853751, 0.886432, 0.220296, 0.350574, -0.550901, 0.613092, 0.307623, -0.298374, -0.895565, -0.0357719, -0.205392, -0.819729, -0.918492, -0.894196, -0.466275, 0.29022, -0.770727, -0.705895, 0.652155, 0.35877, 0.742639, -0.291345, 0.983628, 0.835268, -0.00356453, -0.0327689, 0.205714, 0.550502, 0.0352398, -0.0227745, 0.41964, 0.0913006, -0.655604, -0.613747, -0.929692, -0.911113, -0.293166, 0.617748, 0.660178, 0.704466, -0.434011, -0.076932, -0.650881, 0.549527, 0.190972, -0.437536, -0.467842, -0.653782, 0.257475, 0.935504, -0.940398, 0.895215, -0.865038, -0.192101, 0.107847, 0.433388, 0.481108, -0.0836083, -0.744055, 0.810437, -0.439022, -0.424784, -0.178053, 0.0180736, 0.490564, 0.874133, -0.693373, 0.944716, 0.293947, 0.827615, -0.8507, 0.42971, 0.42994, -0.103593, -0.848864, -0.0461656, -0.194247, 0.0423511, -0.0682019, -0.965416, -0.418918, 0.629335, 0.526111, 0.75718, 0.58164, -0.699806, 0.349881, -0.184525, 0.842473, 0.481276, -0.16464, 0.836551, -0.319431, 0.76812, 0.85206, 0.995275, 0.964619, 0.362877, 0.889754, 0.563508, 0.864847, 0.24776, -0.420361, 0.0976093, 0.725836, -0.421768, -0.152957, 0.144573, 0.839042, 0.0307696, -0.227962, -0.189912, 0.883601, 0.596222, 0.678521, 0.900963, 0.0102885, 0.190328, 0.188816, -0.222921, -0.421775, 0.80708, 0.103839, 0.276365, 0.962038, -0.881941, -0.427092, 0.445951, -0.97825, -0.291351, 0.532488, 0.833973, 0.251239, -0.801012, -0.188949, -0.0391055, -0.409343, -0.117032, -0.426966, -0.943489, -0.718435, 0.92411, 0.877092, -0.116365, 0.0969416, -0.527782, -0.0101602, 0.730038, 0.7788, 0.878923, -0.948751, -0.600689, 0.77052, 0.566845, -0.330947, 0.785807, -0.336159, 0.24362, 0.167259, -0.526194, -0.656908, -0.836993, -0.709674, -0.668275, 0.395714, -0.88831, -0.127962, -0.742946, 0.33136, 0.00424889, -0.252327, -0.160289, -0.507971, -0.416111, -0.768994, -0.710512, -0.956171, -0.191613, -0.850915, 0.273636, -0.969499, -0.746238, -0.823467, -0.475573, -0.768845, -0.170627, 0.578301, -0.175374, 0.315915, -0.513811, 0.93585, 0.68845, -0.821569, 0.192854, -0.739361, 0.0484851, 0.481895, -0.837919, 0.955599, 0.313733, 0.8544, -1.79609e-05, 0.810541, -0.0555147, -0.354929, -0.399422, -0.937725, 0.0145483, -0.388149, 0.925482, 0.783803, -0.133265, -0.0901805, 0.56352, -0.422662, -0.0433767, 0.828661, -0.724826, -0.436442, 0.897553, -0.800612, -0.984282, -0.231053, -0.534493, 0.263368, 0.490114, 0.087794, 0.389586, -0.770847, -0.996557, 0.534489, -0.899421, -0.0277288, -0.18636, -0.51936, 0.098102, -0.602122, -0.545211, 0.0186035, -0.566115, -0.9802, 0.883209, -0.169408, 0.316912, 0.205976, 0.967555, 0.117605, 0.410808, 0.695668, 0.388443, 0.636511, -0.469156, 0.713276, 0.37192, -0.958727, 0.469077, 0.331501, 0.952638, -0.802797, 0.644403, 0.750074, -0.107192, -0.109252, 0.354984, 0.139049, 0.694088, 0.537143, -0.937081, 0.452427, 0.0776795, 0.658774, 0.770931, -0.778492, 0.100285, 0.0523201, -0.363664, 0.311714, -0.768101, -0.386166, 0.612642, -0.0381795, -0.441817, -0.734299, 0.103486, 0.512397, 0.05189, -0.588801, -0.474778, 0.345713, 0.530051, 0.888084, 0.584568, 0.115264, -0.331037, -0.035841, -0.810426, 0.777653, -0.92891, 0.834655, -0.100097, -0.405433, 0.689634, 0.295035, -0.629534, 0.845843, -0.0307525, -0.708024, 0.65779, 0.182043, -0.104699, 0.601935, -0.925428, -0.410648, 0.416681, 0.905631, 0.283241, 0.397562, -0.635798, 0.23229, -0.243691, 0.824506, 0.529011, -0.341464, -0.68775, 0.963474, 0.80083, 0.213677, 0.783023, -0.713638, -0.844642, -0.936218, -0.774916, -0.0330174, 0.944228, -0.097266, -0.153344, 0.374249, -0.00628978, -0.336617, -0.663485, -0.426008, -0.605152, -0.289814, 0.913584, -0.34379, 0.916157, -0.283116, -0.0613821, -0.0496417, 0.325397, 0.214133, -0.186939, 0.866672, 0.395641, -0.0170384, -0.969741, 0.0292074, 0.241627, 0.552891, -0.214828, -0.159513, 0.494542, 0.14547, -0.354649, -0.558784, -0.680749, -0.326, 0.0497055, 0.240414, 0.614427, -0.464731, -0.472088, 0.767453, -0.0453747, 0.504399, 0.849604, -0.296863, 0.831542, -0.165393, 0.192969, 0.708425, 0.30255, -0.449753, 0.314568, -0.788446, 0.424882, 0.115671, 0.808618, 0.434329, 0.252688, 0.92806, 0.688583, 0.447505, 0.794958, 0.203259, -0.593683, 0.729929, -0.0516869, -0.583334, 0.701393, 0.962946, -0.609616, -0.133737, -0.423278, -0.67046, 0.246269, -0.625026, -0.208602, -0.940789, 0.777917, 0.221236, -0.135195, 0.0210062, -0.258246, 0.653516, 0.116557, -0.876829, 0.126285, 0.903004, -0.186555, -0.626763, 0.628223, -0.485891, -0.240386, -0.558307, 0.358993, 0.344223, -0.717847, -0.889929, 0.856366, -0.827167, -0.798893, 0.814693, 0.331183, -0.647114, 0.802379, 0.834945, 0.857388, -0.0808373, 0.508734, 0.892978, 0.133542, -0.212446, 0.567659, -0.507012, -0.0145852, -0.252645, -0.432353, -0.497591, 0.76327, -0.289996, 0.383848, -0.133022, -0.979169, -0.971071, 0.455754, -0.2829, 0.0605924, 0.0451371, 0.804872, -0.934277, -0.482719, 0.0513036, -0.611742, -0.38588, -0.943418, 0.82153, 0.414501, 0.73213, -0.963304, 0.306572, 0.487765, -0.384732, 0.930221, 0.701658, 0.0402458, 0.822821, 0.880548, -0.92543, 0.11452, -0.894636, 0.907544, 0.0894943, 0.956918, 0.940328, -0.0426686, 0.367791, 0.986233, -0.882524, -0.673865, -0.88394, -0.700589, 0.319139, -0.137315, -0.718065, 0.949677, 0.333535, 0.592568, -0.788781, 0.650063, 0.888569, 0.51215, -0.0263468, -0.359598, 0.208201, -0.444795, 0.115192, -0.540871, 0.922904, -0.778127, 0.388525, -0.506927, -0.698485, -0.17202, -0.127944, -0.131424, 0.314151, 0.627049, 0.620503, 0.447467, 0.0845132, 0.292374, 0.473917, 0.938548, 0.735055, 0.568703, -0.967566, -0.345847, -0.98803, -0.964444, 0.0195838, -0.672199, 0.714203, -0.0677459, -0.00991429, 0.56631, -0.951882, 0.738589, 0.0247586, -0.820207, 0.490257, 0.764667, -0.240735, 0.475658, -0.444275, 0.520941, -0.47122, 0.244235, -0.436083, -0.838428, -0.767198, 0.76285, 0.656518, -0.888356, -0.18265, -0.102681, -0.825249, -0.0280711, 0.302666, 0.49101, 0.658191, 0.14282, -0.0770285, -0.977574, -0.790243, -0.656295, -0.576743, -0.498064, -0.462938, 0.646322, -0.141048, -0.503405, -0.766997, -0.617019, -0.365058, 0.986628, -0.420714, -0.0934354, 0.309501, 0.0291924, -0.918056, -0.92193, 0.162669, -0.60495, 0.232158, 0.660537, 0.34808, 0.645043, 0.889102, 0.548645, 0.307634, -0.429336, 0.999514, 0.0952292, 0.77772, -0.150293, 0.17383, -0.458789, 0.694734, -0.816498, 0.803968, -0.722286, -0.629988, 0.359298, -0.94175, -0.163209, -0.106704, 0.561579, -0.356486, 0.902955, -0.740015, -0.80372, -0.304007, 0.553203, -0.210959, 0.328471, -0.470232, 0.475337, -0.130824, 0.942191, 0.659448, -0.50457, -0.128279, -0.8028, -0.760242, -0.99627, -0.724488, -0.372622, -0.389238, -0.151698, 0.305063, -0.60478, -0.968625, -0.106506, 0.963422, 0.766506, 0.500806, 0.739011, -0.108731, 0.75659, -0.486633, -0.93568, -0.428736, 0.599777, -0.652568, -0.429818, 0.0204411, -0.626986, 0.0723217, -0.802921, -0.662616, 0.494421, 0.791611, -0.521771, 0.726894, -0.941428, -0.266176, -0.809478, -0.349185, -0.697517, -0.312423, -0.509398, -0.311058, 0.767593, -0.669479, -0.313821, -0.764459, 0.450142, 0.653207, -0.245736, -0.809676, -0.694496, 0.523814, -0.831145, 0.100266, -0.149681, 0.682748, 0.813549, 0.302321, -0.602581, -0.607818, -0.59068, -0.0330098, -0.0449078, 0.827898, 0.578481, -0.282617, -0.245981, 0.666262, 0.694014, 0.160355, 0.0201959, 0.898719, 0.688718, 0.991657, -0.622213, 0.135193, 0.337214, 0.72419, -0.148552, -0.537608, -0.306767, 0.966554, -0.05394, -0.0716579, -0.8334, 0.848237, -0.938016, 0.772165, 0.990302, -0.906168, 0.415649, -0.0867281, -0.706058, 0.296724, 0.776184, -0.248063, 0.153295, 0.0460406, 0.185523, -0.817128, 0.29831, 0.0533611, -0.0122154, 0.617147, -0.521324, -0.44575, 0.718153, 0.247595, -0.490987, 0.834963, 0.217521, 0.661752, 0.968867, -0.321145, 0.829308, 0.22302, 0.930248, 0.811333, 0.164009, -0.610314, -0.0983934, -0.50316, 0.116083, -0.317749, -0.515285, 0.535192, -0.741267, -0.303962, -0.407908, -0.390929, -0.0170793, 0.708047, -0.460879, -0.0537216, -0.810124, 0.225166, 0.620128, -0.546408, -0.143481, -0.0198883, 0.398697, 0.697249, 0.467968, -0.882256, -0.574682, 0.278852, -0.974077, -0.80721, -0.0804813, -0.290822, -0.59895, -0.119548, -0.589491, 0.504376, -0.615024, 0.751428, 0.299353, -0.216958, 0.604031, 0.245249, -0.503064, 0.981228, -0.759145, -0.507419, 0.895632, -0.64828, -0.0148308, 0.367844, 0.23249, 0.140875, -0.625615, 0.957867, -0.28634, -0.631926, -0.189292, 0.997211, -0.307952, -0.0961067, -0.342567, -0.578542, -0.73988, 0.483112, 0.570564, -0.0565707, 0.937038, -0.38161, -0.0709885, 0.00450054, -0.694526, 0.563059, 0.40579, -0.476949, 0.431046, -0.635469, -0.332953, 0.824253, -0.789961, 0.191476, -0.171669, 0.120747, -0.726571, 0.669941, 0.202284, -0.653904, -0.89865, 0.086642, -0.59433, -0.809661, -0.661472, 0.0225158, 0.393185, -0.876595, 0.498604, 0.188533, -0.326941, 0.804599, -0.719636, -0.318745, 0.313851, 0.675421, -0.0232799, -0.00703579, 0.763908, 0.0492051, 0.884077, -0.937119, -0.187183, 0.853491, 0.234256, 0.665645, -0.649612, 0.899992, 0.249864, -0.0858054, -0.624787, 0.980615, 0.48484, -0.336299, 0.117274, 0.912494, 0.567142, 0.00727258, 0.928501, 0.717005, 0.161149, -0.0678876, -0.114486, -0.580534, 0.129957, 0.55392, -0.240086, -0.732522, 0.287746, -0.23017, -0.15521, 0.997086, -0.372233, 0.957621, 0.337867, -0.850689, 0.70063, -0.280161, -0.885193, -0.113857, -0.483791, -0.0642745, 0.0863874, -0.089349, -0.032926, 0.538094, -0.783407, 0.710084, -0.456199, -0.877602, 0.495449, -0.469425, -0.970473, 0.934379, 0.496171, 0.927454, -0.944095, 0.543307, -0.700667, -0.135692, 0.981009, -0.0756113, 0.460409, -0.627088, 0.173985, 0.216273, -0.556329, 0.872553, -0.38925, 0.780382, 0.0512377, -0.515688, -0.454159, -0.63847, -0.0960749, -0.429259, 0.867155, -0.834539, 0.456784, -0.199653, -0.349882, -0.914829, 0.721569, 0.705471, -0.587923, -0.795946, 0.500734, -0.837413, 0.846485, 0.722559, -0.521187, 0.775577, -0.384024, 0.719505, -0.717933, 0.123887, -0.612662, 0.349299, 0.413468, 0.607758, 0.249856, -0.0307344, -0.938786, -0.600796, 0.302364, -0.895692, 0.541965, -0.0940426, -0.569741, 0.535013, 0.330434, 0.922821, -0.863082, -0.921408, -0.38393, -0.51873, -0.269827, 0.201735, 0.510728, 0.838641, 0.843201, -0.765813, 0.387847, -0.604592, -0.438215, 0.657788, -0.598622, -0.713391, -0.72532, -0.536217, -0.234511, -0.448754, 0.940843, 0.137744, 0.625695, -0.113157, -0.193056, -0.650651, 0.857597, 0.653704, 0.0302446, 0.808402, -0.990426, 0.920495, -0.468318, 0.758445, 0.977308, -0.191608, 0.958468, 0.71587, -0.749543, 0.0799616, -0.740605, 0.559025, 0.139643, 0.0103612, 0.478871, 0.815028, -0.431006, -0.29014, -0.660777, 0.576419, -0.316805, -0.669633, -0.483073, -0.696411, 0.668276, -0.578432, -0.670935, 0.597472, -0.545843, 0.920132, -0.262199, 0.539245, 0.76387, -0.966225, 0.22769, 0.949752, -0.082928, -0.441641, 0.112812, 0.561956, 0.0382374},
-	{0.988793, -0.260364, 0.594379, -0.880653, 0.338737, 0.615626, 0.125788, 0.824492, -0.497109, -0.443186, -0.40499, 0.223035, -0.204751, -0.240842, 0.258424, 0.497696, -0.317788, -0.730502, -0.433629, -0.563652, 0.432984, 0.0860968, -0.735018, 0.652198, 0.14829, 0.618708, 0.440063, -0.35956, 0.791621, -0.697627, 0.398791, 0.196094, -0.79469, -0.866013, -0.80177, 0.572085, 0.418058, -0.485224, 0.440501, -0.357131, 0.433655, 0.458833, -0.525728, 0.478459, -0.93992, 0.989688, -0.391987, -0.370543, 0.584678, 0.258421, 0.700569, -0.578189, 0.991067, -0.851309, -0.703494, 0.540663, 0.0144925, 0.188882, -0.568132, 0.237277, -0.608226, 0.718925, -0.986286, -0.283013, -0.385171, -0.296546, 0.779356, -0.969734, -0.866568, 0.0926732, 0.705979, -0.584534, -0.155738, -0.364839, 0.716288, -0.00929221, -0.797975, -0.412428, 0.52303, 0.663173, -0.404613, -0.127241, -0.487396, 0.997051, -0.202122, 0.496588, -0.447997, 0.338752, 0.553221, 0.910678, 0.0116622, 0.888039, 0.6136, -0.281787, -0.727786, 0.458051, -0.636113, 0.872048, 0.769446, 0.34125, 0.239797, -0.702033, 0.98421, -0.498837, -0.399609, 0.761978, 0.703763, 0.282094, -0.150174, -0.346402, 0.0432302, -0.606256, -0.911747, -0.291341, -0.749476, -0.152589, -0.53524, 0.15279, 0.135115, -0.40412, 0.952909, 0.951126, 0.121803, 0.667593, -0.0581418, -0.123244, -0.588043, -0.18529, -0.310913, 0.560397, 0.969832, 0.659447, 0.79915, -0.599221, 0.493361, -0.705428, -0.727967, -0.845116, 0.191131, -0.715673, -0.670659, -0.477169, 0.751445, 0.765583, 0.207993, 0.725475, 0.18666, -0.265527, -0.0873334, -0.495137, 0.576675, -0.412868, -0.593477, -0.206931, -0.227362, 0.0507391, -0.993739, -0.00590645, 0.155669, -0.777806, 0.254427, -0.13265, 0.0853755, -0.871715, -0.387405, -0.34284, 0.0554173, 0.835078, 0.93702, -0.796596, -0.92367, -0.266766, 0.783901, -0.803458, -0.820641, 0.938372, 0.100617, -0.368662, -0.519033, 0.0234524, -0.485278, -0.42851, -0.0279714, 0.365291, -0.302324, 0.338562, 0.260291, 0.507022, -0.0257432, -0.00793103, -0.809355, -0.765351, -0.383358, 0.0114867, -0.427178, 0.860816, -0.0660541, 0.431427, 0.842737, -0.395429, 0.159396, -0.967778, 0.104252, -0.0955803, 0.266643, 0.233362, 0.827232, 0.633724, 0.67721, 0.00827071, -0.119547, -0.431535, 0.769504, -0.20423, -0.635133, -0.834519, 0.674625, 0.197687, 0.0246819, 0.0873967, 0.299535, 0.978554, -0.588702, -0.343941, -0.88936, -0.639495, -0.651308, -0.644563, 0.344246, -0.269273, 0.148552, -0.665311, 0.14527, -0.90474, -0.196102, 0.960993, 0.839835, 0.328191, 0.304439, 0.0165619, 0.182048, 0.444556, -0.602757, 0.319495, -0.356864, 0.287864, -0.932677, 0.527084, -0.537417, -0.925131, -0.96887, 0.518343, -0.205071, -0.367974, 0.892698, -0.282024, 0.90558, 0.624812, -0.319384, -0.451038, 0.272496, -0.0789152, -0.32065, -0.697034, -0.154288, -0.135284, 0.833132, 0.516681, 0.111958, -0.597318, -0.348103, 0.772149, 0.00910453, -0.628484, 0.392069, -0.248373, -0.145677, -0.974479, 0.622956, -0.445418, -0.38495, -0.384501, 0.516046, 0.809331, 0.847133, -0.513114, -0.963783, 0.951386, 0.319543, 0.892424, 0.777559, -0.752336, 0.515763, -0.883246, 0.277664, 0.256889, -0.836442, -0.332339, -0.853547, -0.788639, 0.548954, -0.76182, 0.720135, 0.631624, -0.849935, -0.665788, 0.394331, -0.963229, -0.695788, -0.363189, 0.224082, 0.489667, 0.769933, -0.00811247, 0.591367, 0.971218, -0.254136, 0.66852, 0.252813, 0.731807, -0.758286, 0.912084, -0.444814, -0.277555, -0.449977, 0.231194, -0.411924, 0.343749, 0.95804, 0.286146, -0.314622, -0.334476, 0.780258, -0.400156, -0.563535, -0.114028, 0.497178, 0.997097, -0.96153, -0.635731, -0.192871, -0.696735, 0.26813, 0.199042, 0.732212, -0.55312, 0.202704, -0.546346, 0.792266, 0.420885, 0.969772, -0.160751, 0.0399776, 0.760816, 0.0345477, 0.356791, 0.37741, -0.261258, -0.118542, -0.0673781, -0.314465, 0.416424, 0.493483, 0.544902, 0.802891, -0.658325, -0.0882203, 0.650536, 0.891134, -0.230348, 0.10598, -0.802564, 0.0726777, 0.624348, 0.121235, 0.262474, 0.534432, -0.166679, -0.176592, 0.777038, -0.759664, -0.0370917, -0.196236, 0.326199, 0.258225, 0.125272, -0.187089, -0.0344933, 0.110473, 0.643868, 0.531762, -0.10621, -0.66188, -0.530718, 0.840887, -0.864938, -0.175223, -0.888144, 0.639028, -0.984247, -0.126207, 0.535861, 0.843869, 0.336238, -0.159682, -0.389927, -0.637637, 0.443089, -0.583748, -0.157713, -0.563955, 0.369983, 0.321919, 0.990484, -0.775281, -0.570219, -0.945557, -0.497354, 0.599939, -0.729421, -0.72776, 0.495914, -0.88898, -0.237081, -0.158312, 0.33197, 0.22439, -0.667348, -0.908246, -0.579755, -0.265871, 0.546808, 0.116268, -0.469047, 0.727449, -0.934963, 0.378565, -0.356157, -0.341322, 0.415589, 0.389654, 0.530635, 0.199365, -0.0983404, -0.401949, -0.622992, -0.9538, 0.672351, 0.369154, -0.701471, 0.71767, 0.838642, 0.581822, -0.258469, -0.260236, -0.267531, -0.483675, 0.280459, 0.820553, -0.499217, -0.186002, -0.645129, 0.364248, 0.0417229, -0.0213288, -0.786818, 0.397913, 0.571433, 0.599429, -0.109088, 0.194914, 0.737184, -0.172502, -0.469228, 0.444952, -0.917241, -0.98042, 0.995203, 0.0359555, 0.783121, 0.695801, 0.240246, -0.507738, 0.966974, 0.105701, -0.944385, 0.758845, 0.659377, 0.646934, -0.107815, -0.215969, -0.830369, 0.74161, -0.204008, 0.859579, 0.329437, -0.419123, -0.550755, -0.98014, -0.31767, 0.563045, 0.884462, -0.193903, -0.607765, 0.67288, -0.718635, -0.881268, 0.90608, -0.746226, -0.142239, -0.646257, 0.178031, 0.847371, -0.944706, 0.56635, 0.878833, -0.313067, -0.253995, -0.209021, -0.75659, -0.984211, -0.358157, -0.777589, 0.876113, 0.700956, -0.0928212, 0.460382, 0.859151, 0.33441, 0.867519, -0.79241, -0.281423, 0.0765252, 0.872493, 0.774742, 0.798689, -0.462021, 0.551942, 0.406693, 0.545392, -0.388726, 0.542659, -0.726144, 0.419497, 0.126342, -0.245448, -0.205264, 0.90426, 0.659236, -0.614455, -0.898372, 0.676285, -0.269755, -0.282874, -0.252127, 0.787562, -0.412383, -0.600657, 0.310598, 0.673251, 0.00212395, 0.801698, -0.804637, -0.831036, -0.183171, -0.5315, 0.65847, -0.934724, 0.000996786, 0.532242, 0.214876, -0.656723, -0.160747, 0.809954, -0.202118, 0.975814, 0.174155, 0.418169, -0.233171, -0.853851, 0.0915568, 0.700225, 0.152021, -0.305492, -0.188856, 0.924076, 0.0851915, -0.562004, -0.767225, 0.736504, -0.669308, 0.343336, -0.373361, 0.254474, -0.970409, 0.920464, -0.676395, -0.917498, 0.607744, 0.0230553, 0.308669, -0.556495, -0.0280919, -0.0938578, 0.636271, -0.403356, 0.24655, 0.464732, 0.844316, 0.0293179, 0.012103, -0.896062, 0.27255, -0.892386, 0.369617, 0.701275, 0.391807, -0.576042, -0.102896, -0.558324, 0.860344, -0.411682, -0.650534, 0.649377, -0.888076, -0.178218, 0.00687376, 0.296484, -0.864317, 0.324227, 0.975155, 0.868228, 0.175098, -0.455165, -0.525608, 0.229748, -0.727615, -0.214446, 0.994336, 0.0770899, 0.985024, -0.892244, 0.286956, 0.114152, 0.337985, -0.661138, 0.329932, -0.256423, -0.0729276, 0.798818, -0.512957, 0.132491, -0.276235, -0.758726, 0.0322882, -0.521587, 0.817159, -0.910376, 0.305338, 0.710488, 0.429586, -0.92062, 0.263052, -0.386194, -0.537903, -0.601891, 0.267725, 0.850289, -0.189699, 0.634349, 0.238827, -0.318654, -0.671734, -0.47061, 0.979614, 0.973517, -0.450397, -0.874158, 0.935783, 0.770654, 0.611682, -0.613586, 0.301718, 0.663352, -0.318878, 0.0106195, -0.0800867, 0.24573, -0.867507, 0.660723, 0.64152, -0.207489, -0.128702, -0.0905448, -0.455859, -0.252882, 0.570007, 0.196812, 0.203344, 0.607475, 0.206498, -0.442248, -0.693141, 0.750277, -0.678892, -0.916876, 0.927883, -0.3925, 0.764109, 0.958079, 0.0390702, -0.137219, 0.882936, -0.209504, -0.658859, 0.578001, -0.521352, -0.509267, -0.675171, 0.338486, 0.645292, -0.228245, -0.179847, -0.889144, -0.980371, -0.967202, 0.670628, -0.179053, 0.900661, -0.318128, -0.382188, 0.0507179, 0.305998, 0.372051, -0.820828, -0.937864, -0.0299514, 0.783252, 0.888515, -0.213996, 0.359717, -0.887013, -0.0736679, 0.447699, -0.763498, -0.657888, 0.0654399, 0.419464, 0.977897, -0.350695, -0.641355, 0.875149, -0.397418, 0.889033, -0.59736, 0.145701, 0.0653753, 0.9885, 0.737305, 0.728209, 0.966236, 0.843607, -0.788166, 0.338731, 0.858338, -0.799571, 0.378756, -0.833922, -0.200275, 0.291298, 0.516396, 0.687758, -0.890253, -0.725072, 0.238603, -0.959432, -0.0229016, 0.866796, -0.421662, -0.898843, -0.838767, 0.0904795, -0.414214, 0.107512, -0.306725, -0.383935, 0.196836, -0.881275, 0.707237, 0.363621, -0.836061, -0.0268094, -0.367085, -0.705616, -0.627318, 0.850915, -0.360348, -0.0942258, 0.667541, -0.734378, -0.17192, -0.553408, -0.707313, 0.495983, 0.835563, -0.160012, 0.678212, -0.544232, -0.0344922, -0.0885534, 0.411021, 0.218381, -0.172434, -0.691881, -0.28656, 0.902996, -0.217784, -0.828091, -0.199354, 0.837546, -0.962735, 0.140428, -0.397392, 0.586209, 0.0134705, 0.787629, -0.885123, 0.412878, 0.935059, -0.703976, 0.415745, 0.797735, -0.0867294, 0.620964, 0.610848, 0.157969, -0.579279, 0.725723, -0.191481, 0.578001, -0.572648, 0.709022, -0.330327, 0.882361, -0.544817, -0.275472, -0.736581, 0.612996, -0.976318, -0.745301, 0.921309, -0.597997, 0.761132, 0.526653, 0.764144, 0.187962, 0.135333, -0.873136, 0.343442, -0.930433, 0.288096, 0.772161, -0.326388, 0.429265, -0.0675188, 0.166292, -0.87128, -0.923312, -0.110105, 0.158079, 0.0796066, -0.302032, -0.564268, 0.0295601, -0.668738, -0.861754, -0.751769, 0.67047, 0.0765492, -0.413207, -0.788812, 0.0710169, -0.20994, 0.695432, 0.624096, -0.893277, -0.389225, -0.866117, -0.596314, -0.133696, 0.360059, -0.188741, 0.106255, -0.116983, 0.433455, -0.276987, 0.488197, 0.309409, -0.870084, -0.527392, -0.204063, 0.791732, -0.873933, 0.370549, 0.74946, 0.510224, -0.917641, 0.99282, 0.265701, -0.320674, -0.427374, -0.262537, -0.342409, -0.267839, 0.957583, 0.587894, 0.208439, 0.00497817, -0.0727719, -0.214188, 0.484226, 0.97042, -0.685159, -0.951787, 0.10403, 0.630591, -0.81966, -0.39254, 0.551311, -0.313694, -0.787253, -0.613678, -0.558539, -0.27294, 0.0198732, -0.0142976, -0.457658, -0.247854, 0.132953, -0.652733, 0.674187, 0.702011, -0.306751, 0.564527, -0.296691, -0.424846, 0.79827, -0.608464, -0.113962, 0.625167, -0.0656608, 0.412683, -0.871851, 0.956076, -0.700822, -0.823442, -0.549098, -0.73759, 0.664247, -0.144495, -0.646446, 0.35048, 0.140936, 0.172308, -0.750583, -0.107355, 0.0351224, -0.222715, 0.413862, -0.857489, -0.748852, -0.933608, -0.117709, 0.556745, -0.533614, 0.607553, 0.250437, -0.0136183, 0.796572, 0.931867, -0.781556, 0.213346, -0.632578, -0.313455, 0.234059, 0.929179, 0.0208475, 0.567028, -0.465234, 0.503528, -0.670911, -0.813751, -0.0209336, -0.920698, -0.17199, 0.363585, -0.674911, 0.31784, 0.225397, 0.665735, -0.821966, 0.758943, -0.255922, 0.729092, -0.760692, -0.255995, -0.251921, -0.183541, 0.326743, -0.580235, -0.986072, 0.335508, -0.189263, 0.928842, -0.877558, -0.276573, -0.274688, 0.990907, -0.167366, -0.720878, -0.359023, 0.143739, 0.36661, -0.525332, 0.444804, 0.146907, 0.24298, 0.97488, 0.613561, -0.698113, -0.205197, 0.322748, 0.809848, -0.898205, -0.0536744, -0.135575, 0.496132, -0.235616, -0.515388, 0.978858, -0.801535, 0.121937, -0.981055, 0.061956, 0.568785, 0.747318, -0.440732, -0.954388, -0.159376, 0.848878, -0.918057, -0.601574, -0.705769, 0.923333, 0.989602, -0.297673, -0.843519, 0.834074, 0.813558, 0.683412, -0.171015, 0.855209, 0.236855, -0.195071, -0.585404, -0.762585, -0.920763, -0.745597, -0.543086, -0.906856, -0.587054, 0.602298, -0.818449, 0.578604, 0.802476, -0.976341, -0.546848, -0.431084, -0.719086, 0.118049, 0.316638, -0.772006, 0.832156, 0.936954, -0.979108, -0.581515, -0.950368, 0.0792346, -0.658968, 0.298903, 0.231752, 0.437346, 0.240372, 0.661636, -0.113122, 0.617315, 0.350998, 0.198726, 0.922891, 0.981242, 0.183192, 0.209264, 0.301185, -0.581151, 0.755483, -0.891627, 0.208171, -0.711936, 0.859919, -0.937155, -0.646171, 0.95527, -0.758885, 0.0294713, -0.543152, -0.497973, -0.318867, -0.56843, 0.323772, 0.0580674, -0.992514, -0.38926, -0.407904, 0.430743, -0.393826, 0.457312, 0.570601, -0.378016, 0.950974, -0.614789, -0.807914, 0.713735, 0.492288, -0.738084, 0.371975, -0.93876, -0.597777, -0.998435, 0.232237, -0.182697, -0.601365, -0.72897, -0.427682, -0.623389, -0.160552, -0.520689, -0.408572, 0.801961, -0.0594002, -0.763786, 0.399265, -0.936414, -0.868998, -0.799351, -0.299364, 0.120322, -0.85706, 0.139637, 0.00304136, 0.153039, 0.875403, -0.957262, 0.932406, 0.0877181, 0.499985, 0.772194, -0.0611282, -0.429898, -0.374264, -0.376762, -0.492166, -0.0454341, -0.0666031, 0.461575, 0.310257, 0.80377, -0.595323, 0.017147, -0.580687, 0.346332, -0.531444, 0.127699, -0.0637623, 0.679176, 0.99473, -0.38036, -0.607816, -0.156368, 0.62122, -0.453912, 0.0758551, -0.850646, -0.64389, -0.739386, -0.0521463, 0.402415, -0.685822, 0.219019, -0.659751, -0.0579435, -0.418552, -0.43752, -0.677281, 0.542459, -0.90812, -0.651924, 0.0596024, 0.98457, 0.0256924, 0.38369, 0.259607, 0.864093, 0.757895, -0.139454, 0.684421, 0.230629, -0.137062, -0.183078, -0.141022, 0.178643, 0.497503, 0.540243, -0.0533206, 0.970855, 0.794939, -0.306443, -0.939987, 0.749997, -0.10414, -0.142882, -0.0889642, 0.222248, -0.0384406, -0.410083, -0.47792, 0.213021, -0.473036, -0.0910941, -0.417984, -0.390509, -0.274151, 0.0371276, 0.832341, -0.51033, -0.898784, 0.641473, 0.767281, -0.58858, 0.688867, -0.05256, 0.509035, 0.505855, 0.625719, 0.915965, 0.180049, -0.0880156, -0.977357, -0.987992, 0.447436, -0.913587, 0.957557, -0.775416, 0.465908, -0.746909, 0.373101, 0.534586, -0.666773, 0.169394, -0.148418, -0.839275, 0.525706, 0.662198, 0.907262, -0.164283, -0.0278852, 0.739029, -0.556322, 0.925802, 0.680022, -0.83513, 0.168415, 0.964524, 0.834976, -0.979562, -0.012511, -0.439951, -0.829257, 0.992383, 0.721923, -0.573347, 0.314936, 0.777617, 0.625535, 0.151245, 0.776921, -0.971852, -0.612773, -0.972494, 0.816873, -0.875633, 0.245356, -0.591666, 0.032884, 0.193801, 0.384699, 0.352424, 0.138117, 0.207452, 0.070678, -0.975371, 0.142061, -0.250032, -0.815895, 0.478828, -0.992791, 0.89653, 0.625533, 0.645303, 0.0495235, 0.647063, -0.0184155, -0.644738, 0.72571, -0.472825, -0.0164981, -0.293879, -0.162851, 0.633943, -0.0278778, 0.302531, 0.55955, 0.788145, -0.800584, -0.883691, -0.750321, -0.149003, 0.428209, -0.412225, -0.263655, 0.610763, 0.329543, -0.871331, 0.712389, 0.851276, 0.879371, 0.542609, -0.662252, 0.0871415, 0.118391, -0.147046, -0.71117, 0.811334, 0.350815, 0.331482, -0.738029, 0.552367, -0.317848, -0.134237, -0.914221, -0.691924, -0.291784, -0.91777, -0.272825, -0.643012, -0.762451, 0.518406, -0.689524, 0.717686, -0.12937, -0.743211, 0.342621, 0.532205, 0.759153, 0.346857, 0.374115, 0.532882, 0.215897, -0.420965, 0.245536, 0.0189522, -0.944046, 0.0526441, -0.29874, -0.624271, -0.240823, 0.421211, -0.400396, 0.219238, 0.431165, 0.501428, 0.188456, 0.986736, -0.349189, 0.973755, -0.660643, 0.781919, 0.229386, -0.827865, 0.0573055, -0.927006, -0.31868, 0.178315, -0.445239, 0.0385626, -0.704345, -0.973569, -0.188374, 0.792002, 0.263265, -0.560408, -0.571058, -0.143682, 0.206077, -0.0408194, -0.48387, 0.685485, 0.240329, 0.24743, -0.479473, -0.147506, -0.135937, 0.137134, 0.993329, 0.0397166, 0.694868, -0.664186, 0.58228, -0.936588, 0.320306, -0.648926, -0.253659, -0.573193, -0.0846972, -0.115404, 0.0636599, -0.593059, 0.517842, -0.757544, -0.140353, 0.993309, 0.363561, -0.886837, -0.23626, -0.636067, 0.753119, -0.850527, -0.943753, -0.500647, 0.105689, 0.032132, -0.653808, 0.802639, 0.13897, -0.547838, -0.0717379, -0.562919, -0.267892, 0.937713, -0.667257, -0.094913, 0.533183, -0.61879, 0.145268, 0.573203, -0.234534, -0.670212, 0.127331, 0.243043, 0.282237, -0.981212, 0.338219, 0.203097, 0.317891, -0.124619, 0.4195, -0.9075, 0.391512, -0.64941, -0.538941, 0.170425, 0.285723, -0.33891, 0.199415, -0.909967, 0.134362, -0.24442, 0.689388, -0.61742, -0.218365, 0.753766, 0.991061, -0.13907, -0.61688, -0.819456, 0.093365, 0.0198239, -0.591219, 0.731742, -0.488248, 0.793041, -0.093272, 0.156125, -0.827856, 0.178462, 0.522574, 0.0495781, 0.615279, 0.907681, -0.73494, 0.258693, 0.119226, -0.246608, -0.542962, 0.664376, -0.717697, 0.0399734, -0.349373, 0.224491, 0.0590231, -0.445209, -0.931796, 0.0697229, -0.32775, 0.796014, -0.115574, 0.214149, -0.621594, 0.181305, 0.735959, -0.49339, 0.883975, -0.444873, -0.952995, -0.710491, -0.031894, -0.884683, -0.868057, 0.274386, -0.258882, 0.000968357, 0.671644, 0.796634, -0.461417, 0.0450478, 0.550971, 0.281508, 0.307275, -0.678607, 0.185052, 0.489541, -0.645153, -0.397327, 0.00747309, 0.347675, -0.94437, 0.573882, 0.695412, 0.753756, 0.344839, -0.323654, -0.0549334, -0.347312, 0.857353, -0.833822, 0.670985, -0.843091, -0.268211, -0.303527, -0.786644, -0.236899, 0.881604, 0.890146, 0.229925, 0.675751, -0.490052, -0.902174, -0.436672, -0.0710188, -0.65597, -0.424258, -0.0865667, -0.158567, 0.499579, 0.593343, -0.27343, 0.453781, -0.93016, 0.73861, 0.953122, -0.662494, 0.0996835, -0.5072, 0.34395, 0.975371, -0.259896, -0.977824, -0.470209, -0.254715, 0.685075, -0.205144, 0.127357, -0.928943, 0.18576, 0.803372, 0.527759, 0.428179, -0.556829, -0.963839, 0.01806, -0.0891279, -0.116212, 0.676873, 0.932015, -0.916613, -0.0464673, -0.584957, 0.330634, -0.666767, 0.52857, -0.730677, -0.858205, -0.714626, -0.510395, -0.288466, -0.133405, -0.312733, -0.112898, 0.738384, -0.252889, -0.847254, -0.0097102, 0.917406, 0.837243, 0.833592, 0.128455, 0.216458, 0.414068, 0.0491249, 0.113027, 0.414047, -0.367893, -0.324078, -0.351545, -0.123076, 0.933231, -0.0487218, -0.520335, -0.501592, -0.958821, 0.395252, 0.681819, 0.594307, -0.857539, 0.997634, 0.588122, 0.720921, -0.391432, -0.355435, -0.957509, -0.47278, 0.657539, -0.313336, -0.208912, 0.668089, -0.649286, -0.344839, -0.203539, -0.232494, -0.152753, -0.510981, 0.635997, 0.566471, -0.275141, 0.31871, -0.575799, 0.580831, 0.481105, -0.35945, -0.820614, 0.944966, 0.549118, -0.816361, -0.843892, -0.465074, 0.00815202, 0.0797466, -0.0808382, -0.609902, 0.0886049, -0.761427, -0.189748, -0.44138, -0.738039, 0.193533, -0.0634622, 0.301964, -0.447072, 0.346216, 0.559986, 0.669618, 0.818873, -0.573031, 0.753277, 0.279707, 0.41464, 0.795993, -0.461529, 0.419698, 0.722299, -0.359577, 0.766559, -0.238829, -0.714575, -0.625128, 0.998746, 0.332569, 0.189482, 0.0348293, -0.354402, -0.184165, 0.897202, -0.221714, -0.502925, 0.891349, 0.219986, -0.438872, -0.09225, -0.276907, -0.25549, -0.558837, -0.121643, -0.577632, -0.744494, 0.0903923, -0.0143883, 0.336887, 0.517241, -0.0905081, 0.384951, -0.929369, 0.414802, -0.0094265, -0.345749, 0.87835, -0.994705, 0.871656, -0.101051, 0.0551091, 0.5816, 0.966709, 0.323894, 0.646495, 0.0654005, -0.64069, 0.687842, 0.537802, 0.996719, -0.56564, 0.593442, 0.623352, 0.798901, 0.969189, 0.582591, 0.972954, -0.0294044, -0.522801, 0.327875, -0.596447, 0.243922, -0.885469, 0.111436, 0.110773, 0.0974416, -0.402604, -0.452484, -0.402691, -0.224662, 0.418924, 0.410802, -0.0330765, 0.18859, 0.817449, -0.383929, 0.830608, 0.893419, -0.919944, 0.565545, 0.928671, -0.142469, -0.991575, -0.280316, -0.962732, 0.680219, -0.452236, -0.000464082, -0.123711, -0.262581, -0.00784877, 0.529472, -0.101078, 0.776253, -0.0486707, -0.386094, 0.141401, 0.447219, -0.882956, -0.205662, 0.701341, -0.231351, 0.230621, -0.114477, 0.744324, 0.650519, -0.317203, 0.308383, -0.893323, -0.437322, 0.684681, 0.255558, -0.798873, 0.783333, 0.309136, 0.0199919, -0.187324, 0.482843, 0.629309, -0.828261, -0.973391, 0.0516411, -0.582524, -0.53333, -0.77737, 0.336982, 0.601952, -0.846739, 0.698324, -0.38589, 0.141511, -0.263948, -0.706228, -0.856215, 0.703973, 0.327853, 0.626531, -0.0968375, -0.421801, -0.0701288, 0.490305, 0.252053, -0.997192, -0.166278, -0.811555, 0.974423, 0.985766, -0.886565, -0.0121651, 0.141941, 0.148011, -0.421877, -0.807516, 0.919655, -0.988366, 0.207957, 0.769685, -0.162341, 0.103628, 0.860869, 0.652493, 0.705587, 0.960225, -0.973175, 0.828435, 0.605046, 0.216044, -0.0820711, 0.598483, -0.794365, -0.382298, -0.144326, -0.100767, -0.107384, 0.999534, -0.775016, 0.554717, 0.950743, 0.430947, -0.110927, 0.373204, -0.703696, -0.770206, -0.357258, -0.538566, -0.526979, 0.748079, -0.140212, -0.0399472, 0.599928, 0.883302, 0.182467, -0.580887, -0.0942719, -0.035231, 0.195164, 0.666411, 0.381867, 0.860908, 0.392929, 0.661954, -0.30023, -0.485515, 0.758049, -0.483994, -0.676462, 0.169605, 0.877911, -0.0460134, -0.714258, -0.872884, 0.264921, 0.524144, 0.174345, 0.518517, 0.321908, -0.9752, 0.364458, 0.372715, -0.00851599, -0.138602, 0.905205, 0.335854, -0.428805, 0.0282074, -0.378334, 0.708557, -0.937027, 0.115003, -0.493856, -0.986771, -0.503899, -0.014928, -0.0701662, 0.373566, -0.661537, -0.336885, 0.229236, -0.0907467, -0.737739, 0.219284, 0.671734, 0.306096, -0.444786, -0.723151, -0.58007, 0.848825, 0.656345, 0.320317, -0.0598883, 0.816951, 0.589363, 0.772842, 0.395734, 0.0298942, 0.952779, 0.818319, 0.711777, -0.0140599, -0.710775, -0.286522, -0.50061, 0.403517, -0.746768, 0.117995, 0.634365, 0.936879, 0.758649, 0.397411, 0.136309, -0.0231171, -0.0402955, 0.478172, -0.586133, -0.420624, 0.713673, 0.16035, -0.746555, -0.870115, 0.141864, -0.730275, -0.309163, 0.247258, 0.417509, 0.485671, -0.143452, -0.0517255, 0.0141045, -0.397198, -0.859039, 0.94513, -0.664987, -0.226085, 0.662299, -0.653186, -0.0689441, 0.129642, -0.829514, 0.229944, 0.536581, -0.0884585, -0.705601, 0.385802, -0.369666, 0.531274, -0.532326, -0.118602, -0.105145, -0.000824929, -0.758071, 0.0774739, -0.394218, -0.526995, 0.415792, -0.261995, 0.25981, 0.678488, -0.36318, -0.954726, 0.843516, -0.643908, 0.246539, -0.985353, 0.244855, 0.971882, 0.246403, -0.793616, -0.182936, 0.802935, 0.879033, -0.0736323, 0.0947335, -0.504187, 0.0275926, 0.0190565, -0.625016, -0.892703, 0.239849, 0.0608339, -0.201116, 0.802033, -0.494086, -0.0365776, 0.722088, 0.481398, 0.199419, -0.837104, -0.136443, 0.651736, -0.8646, -0.55486, 0.408747, 0.793605, 0.182339, 0.3229, -0.185876, 0.216264, 0.793687, 0.668574, 0.117706, -0.907819, 0.229017, 0.22162, 0.629161, -0.431195, 0.218147, -0.804639, -0.413471, -0.342497, 0.0284989, 0.731569, 0.446376, -0.0709464, 0.21362, 0.878935, 0.045548, -0.85644, -0.57667, -0.628168, -0.142146, -0.517838, -0.83284, 0.738235, -0.946831, 0.292856, 0.406893, 0.462992, -0.810834, -0.803468, -0.055076, 0.828176, 0.773206, -0.881781, 0.921227, 0.0633311, 0.709911, 0.329198, 0.79236, -0.480782, -0.450477, -0.796978, 0.11052, -0.710121, 0.046697, -0.791827, 0.10257, -0.256525, -0.295998, 0.984793, -0.949639, 0.553827, -0.495952, -0.74385, 0.184409, 0.800772, 0.564269, -0.603213, -0.23754, -0.046615, 0.516911, 0.185913, 0.493859, -0.569218, -0.00663031, -0.10847, 0.208384, -0.326124, -0.130316, -0.376533, 0.807396, 0.902936, -0.336639, 0.241516, 0.857889, 0.0673888, 0.749759, -0.326332, -0.0449319, -0.308998, -0.790362, -0.410594, 0.100809, -0.498349, 0.645808, -0.48564, 0.0520178, 0.167315, -0.894505, -0.343876, -0.01171, 0.388477, 0.748092, 0.00685813, 0.218846, 0.458028, 0.0766779, -0.364042, -0.520976, -0.519133, 0.147727, -0.596196, 0.262272, 0.937428, -0.39991, -0.785321, -0.221131, 0.694283, 0.754144, 0.348877, -0.265239, 0.87845, 0.853028, 0.870786, -0.672204, 0.379842, 0.0781305, -0.796817, -0.780665, -0.209396, 0.310814, -0.896533, 0.935513, -0.942953, -0.860165, -0.113208, 0.675612, 0.428707, 0.908781, 0.690483, 0.733392, 0.741726, -0.159336, 0.0497679, 0.18728, 0.429197, 0.508445, 0.227265, 0.524514, -0.201214, -0.888017, -0.980733, -0.201874, -0.349526, 0.954908, -0.61025, -0.444792, 0.23292, 0.548423, -0.221566, 0.507297, -0.94558, -0.524211, 0.0667154, -0.0584869, 0.599175, 0.0366153, -0.547058, -0.679164, -0.943669, -0.894355, -0.233097, 0.554999, -0.324237, -0.55229, 0.954534, 0.141665, 0.634628, 0.526466, 0.466177, 0.499014, 0.98486, 0.498513, -0.0575338, 0.469349, 0.373807, -0.443878, -0.967445, -0.575042, -0.870956, 0.469877, 0.448838, -0.876976, 0.161815, 0.94148, 0.708516, 0.444042, -0.0998211, -0.880775, -0.475262, 0.663499, -0.0498184, 0.903976, -0.655414, -0.730682, -0.424958, 0.764522, -0.317949, -0.348669, 0.821457, -0.977965, -0.610649, -0.470297, -0.860539, -0.212025, 0.933832, -0.0725259, -0.837586, -0.932832, 0.756965, 0.592028, 0.534161, -0.130071, 0.419768, 0.00665251, -0.893322, 0.835485, 0.888471, -0.351534, -0.515643, -0.619621, -0.233288, 0.787585, -0.296731, -0.383007, -0.652557, -0.633821, -0.0306758, 0.472128, -0.343292, -0.854747, -0.527248, 0.141231, -0.875339, -0.0408031, 0.186558, -0.288696, -0.950792, 0.78477, -0.155038, 0.177844, 0.492132, 0.924247, 0.761147, 0.894338, 0.328644, -0.342702, -0.0806294, 0.17519, 0.446424, -0.678829, -0.236764, 0.740928, 0.850702, 0.0336888, -0.57219, 0.682237, 0.678673, 0.620708, -0.545385, 0.17134, 0.913047, 0.380759, 0.351286, -0.139063, 0.455775, -0.528917, 0.815937, -0.683412, -0.66528, 0.843336, -0.991878, 0.277447, 0.930587, -0.660821, 0.177091, -0.377987, -0.243765, 0.288792, 0.757518, -0.737375, 0.94728, -0.025954, 0.888524, 0.0568578, 0.37783, 0.288421, 0.79657, 0.25053, -0.740246, -0.219402, -0.186566, -0.240221, -0.243443, -0.0429062, -0.946713, 0.653967, -0.502129, -0.24671, -0.768864, -0.613102, 0.687919, 0.604316, 0.783811, 0.248103, -0.853294, -0.642148, -0.568375, -0.787402, 0.105945, 0.201135, -0.601273, -0.181391, 0.0805535, -0.733585, 0.823389, -0.283958, 0.554731, 0.334516, -0.745206, -0.110651, 0.674026, 0.963707, -0.959142, 0.187013, -0.00913778, -0.0359609, 0.607302, 0.800278, -0.692471, 0.923775, -0.494326, 0.596254, 0.394638, 0.00656931, 0.532145, 0.70293, 0.999199, -0.863266, -0.548098, -0.741369, -0.167953, 0.556166, -0.361748, -0.0756966, -0.626732, 0.382336, -0.322053, -0.604281, 0.362646, -0.503171, -0.130845, -0.522415, 0.319672, -0.517895, 0.400004, -0.393838, 0.46329, 0.636663, -0.817001, -0.432208, 0.569321, -0.353164, -0.0866198, -0.79499, -0.781932, 0.224786, 0.170768, -0.812286, 0.458772, -0.756269, -0.0281335, 0.893024, -0.44346, -0.564109, 0.808689, 0.833508, 0.0989245, -0.460692, 0.953395, 0.822849, -0.301895, 0.936611, -0.884886, -0.0877163, 0.159249, 0.716737, 0.920093, 0.973391, -0.0389015, 0.139519, -0.494262, -0.901133, 0.60437, 0.725979, 0.028704, -0.609959, 0.741106, 0.631608, -0.582942, -0.880539, -0.830541, -0.647856, 0.918717, -0.42928, 0.758765, 0.143807, 0.171059, -0.843465, -0.574348, 0.943137, 0.574582, -0.561271, 0.807006, 0.0513826, 0.897316, -0.48992, 0.682468, -0.413138, -0.881561, 0.664766, -0.211467, 0.558761, -0.452009, -0.852156, -0.610432, -0.443945, 0.514173, 0.253196, -0.431739, 0.83112, 0.417337, -0.258806, -0.389583, -0.618919, -0.629439, 0.790952, 0.335801, -0.964563, -0.875997, -0.777834, 0.316376, -0.913314, 0.489728, 0.694846, -0.699527, 0.481312, -0.309456, 0.870176, 0.0604302, -0.755762, -0.271213, 0.227699, -0.407404, 0.674497, 0.326628, -0.955396, -0.432113, -0.250983, 0.430589, -0.224607, 0.450737, -0.4235, 0.5539, -0.0720885, -0.00483855, -0.880567, -0.990475, 0.319028, -0.889514, 0.431012, -0.24603, -0.771258, -0.713179, -0.981273, -0.204171, 0.65884, -0.668307, 0.985442, 0.778311, -0.182316, 0.858531, 0.54545, 0.67037, -0.631317, 0.584142, 0.875891, -0.716678, -0.133628, -0.861626, -4.89787e-05, -0.12005, 0.932703, -0.845841, 0.215356, -0.516741, -0.315554, 0.871285, 0.568452, 0.137391, -0.484789, 0.585447, -0.450589, -0.51819, 0.0130852, -0.516197, -0.598558, 0.986375, 0.759165, 0.594283, -0.496914, -0.389069, 0.199897, 0.144085, 0.0718303, 0.465254, 0.996706, -0.944812, -0.340593, -0.986663, -0.748712, 0.370424, 0.662404, -0.19776, 0.029763, -0.32756, 0.534897, 0.489362, -0.435285, 0.439083, -0.140918, 0.42994, -0.428633, 0.492251, 0.709918, 0.674407, -0.842316, 0.558118, 0.0351704, 0.278257, -0.60551, 0.252392, 0.792743, -0.312929, 0.32424, 0.626968, -0.950467, -0.556767, 0.340069, 0.0981318, 0.722304, 0.807299, -0.309983, -0.843944, 0.129854, 0.312504, -0.870973, 0.0684881, -0.82106, 0.135679, 0.205057, -0.957293, 0.949224, 0.0630849, -0.126044, -0.540784, -0.559356, 0.55459, -0.473864, -0.905453, -0.369636, -0.0697574, -0.808969, 0.145328, -0.806899, -0.809999, 0.241788, 0.64139, -0.133389, 0.514926, -0.913954, -0.000422191, -0.702154, -0.725895, 0.604044, -0.457049, 0.192146, 0.0644927, 0.409713, 0.616149, -0.855368, -0.629847, -0.253165, -0.593285, 0.599294, 0.656065, -0.492621, 0.454872, 0.579338, -0.873461, 0.300689, 0.985076, -0.739027, -0.847972, -0.202998, -0.4673, 0.867839, -0.857979, -0.331111, 0.797306, 0.222214, 0.0484329, -0.607105, 0.636748, 0.669467, -0.377525, 0.302216, -0.248218, 0.504054, -0.26088, 0.746771, 0.876173, 0.692334, -0.290444, -0.662193, -0.189843, -0.0586472, 0.592989, 0.880501, -0.864119, -0.206151, 0.103561, 0.847885, 0.998565, 0.770544, -0.0810809, -0.913261, -0.188287, 0.595659, -0.0592748, 0.160483, 0.601131, -0.34253, 0.0667916, 0.98135, -0.338646, 0.0370026, -0.768206, 0.34782, -0.741384, -0.329473, -0.0440387, 0.212133, -0.914908, 0.386996, -0.993407, -0.131984, 0.632922, 0.668391, -0.39103, 0.0488625, 0.895414, -0.412791, 0.935387, -0.708816, -0.0887587, 0.522136, -0.499376, 0.315211, 0.0120081, 0.927686, 0.698749, -0.835508, 0.141624, -0.350778, 0.228526, 0.961489, -0.198621, -0.631317, -0.97371, 0.565571, -0.545287, -0.749696, -0.251935, 0.91225, 0.222162, 0.888175, 0.279884, -0.539015, -0.459243},
-	{0.241123, -0.715824, 0.412688, -0.0820029, 0.861197, 0.0708134, 0.0717223, -0.706493, -0.347281, -0.487565, 0.458367, -0.251807, -0.966046, 0.512466, 0.445089, 0.662663, 0.816495, 0.596163, 0.533011, 0.345921, -0.275673, -0.308721, -0.730792, 0.684919, -0.840923, -0.890424, -0.0523521, -0.961777, -0.79942, -0.905631, 0.341272, -0.457426, -0.389612, -0.801336, -0.769722, 0.162393, -0.496626, -0.428671, -0.791664, 0.194117, -0.863548, 0.468192, -0.350355, -0.300244, -0.0334184, 0.626817, 0.887354, 0.776129, 0.624166, 0.159284, -0.661849, -0.846333, 0.965639, -0.0629549, 0.603868, -0.643256, -0.178601, 0.00130035, -0.647713, -0.524831, -0.369174, 0.573371, 0.653018, -0.975891, 0.0095142, -0.538257, 0.837675, 0.922216, -0.485379, -0.908989, -0.282921, 0.392045, 0.824808, 0.207693, -0.409687, -0.157192, -0.690875, -0.281351, 0.0556542, -0.505603, -0.63769, -0.93249, -0.792703, 0.630445, 0.824713, 0.922198, 0.342927, -0.529125, 0.129478, -0.016814, 0.269015, -0.84148, -0.565829, -0.75708, 0.373622, 0.604374, 0.704289, 0.661091, -0.152477, -0.782987, 0.34369, -0.890815, -0.258088, 0.248039, -0.902807, -0.204987, -0.120498, -0.283954, -0.483893, -0.384168, -0.641477, 0.257336, 0.249984, 0.679661, 0.238173, -0.530104, 0.336572, 0.604017, -0.670029, -0.35308, -0.396533, -0.604085, 0.0821742, 0.0757154, 0.0100316, 0.622686, 0.956412, -0.374406, 0.333235, 0.989566, -0.260058, 0.705645, -0.975457, 0.989669, -0.246429, -0.508307, 0.350003, -0.320143, -0.789589, -0.288718, -0.376602, 0.10323, 0.391261, 0.0567533, 0.805916, -0.0962488, -0.541742, 0.233372, 0.885352, 0.0697864, -0.617247, 0.570614, -0.868087, 0.404137, 0.0808545, -0.201383, 0.449903, 0.835529, -0.823346, 0.0390576, -0.8095, 0.341837, 0.703228, 0.647934, -0.6534, -0.877499, -0.786164, -0.737817, -0.0813291, -0.654961, -0.791496, -0.829177, -0.108359, -0.469272, -0.0153886, -0.336333, -0.769862, 0.324465, -0.0928224, 0.0924916, 0.556651, 0.0266636, -0.941731, 0.374733, 0.586668, -0.653882, 0.227502, -0.967279, 0.742287, -0.39898, 0.998124, 0.332743, 0.569095, 0.234002, 0.519363, 0.54978, -0.296551, 0.936137, 0.865763, 0.139108, 0.378226, 0.440837, -0.995222, 0.987964, -0.00934948, -0.500612, -0.488287, -0.404515, -0.522581, 0.108229, 0.214933, 0.281725, 0.523891, 0.427719, 0.759787, 0.761621, 0.377336, -0.736486, 0.715046, -0.662689, 0.873862, 0.695521, -0.96675, 0.13946, -0.638806, -0.301177, 0.499668, 0.127846, -0.666802, 0.259315, -0.125941, 0.0494112, -0.60319, 0.33169, 0.0860232, 0.701689, 0.405331, 0.671597, 0.462071, -0.548079, 0.238081, -0.180931, -0.22488, 0.944719, 0.230304, 0.381978, -0.955369, -0.768429, -0.721902, 0.426357, -0.68366, -0.0663908, 0.242988, -0.454718, 0.556666, 0.344278, -0.138896, -0.287722, -0.99998, -0.650395, -0.345974, -0.606563, 0.829286, -0.859708, -0.732721, 0.524918, 0.264547, -0.281764, 0.963239, -0.184871, 0.857585, -0.563302, 0.394706, 0.996861, -0.315997, -0.431416, 0.0186351, 0.28428, 0.305464, -0.480759, 0.607805, 0.913166, 0.0935432, 0.533232, -0.945534, 0.88276, -0.61363, 0.441967, 0.990843, -0.980529, -0.588513, 0.907893, 0.541254, 0.706748, -0.539133, -0.981575, -0.829673, 0.434202, -0.328747, 0.132237, 0.19617, 0.63137, 0.37452, -0.300657, 0.0937611, 0.832721, 0.919842, -0.537438, -0.100185, -0.0509736, 0.882729, 0.236904, 0.291821, 0.777619, -0.303262, -0.706995, 0.597272, -0.365622, -0.859331, -0.737399, -0.879419, 0.267406, -0.852573, 0.41079, -0.0156076, -0.641905, -0.531965, -0.388013, 0.654588, 0.136373, -0.130026, 0.340677, -0.675663, -0.956243, 0.83244, 0.150242, -0.272347, 0.745351, 0.446195, -0.712448, -0.0243792, -0.284307, -0.122986, 0.0594368, -0.155307, -0.0571709, -0.111795, 0.000355466, -0.942626, -0.826293, -0.672974, -0.553717, -0.978216, 0.165768, -0.575958, -0.475906, 0.912017, 0.99575, -0.968814, -0.162297, -0.827542, 0.138172, 0.0204495, 0.200767, 0.47366, -0.100726, 0.357474, 0.893036, 0.0386069, 0.575019, -0.923761, -0.117043, -0.998868, 0.154195, 0.965191, 0.570468, -0.45192, -0.671771, 0.838633, -0.789981, 0.481527, 0.901187, -0.793858, 0.0226506, -0.0273635, 0.106884, 0.274964, 0.0627149, -0.19904, -0.382499, 0.941372, 0.915046, -0.414103, 0.902291, -0.947682, 0.297504, -0.0961341, 0.181245, 0.0897892, -0.777521, 0.949884, 0.0169587, 0.0676107, 0.798753, 0.354089, -0.399364, 0.840933, -0.0472847, -0.100763, 0.298341, -0.32156, 0.187035, -0.756875, 0.448394, 0.364857, -0.850642, 0.469733, 0.114003, -0.800106, -0.839158, 0.921719, 0.964842, -0.574301, 0.321227, -0.0640826, -0.298452, 0.701969, -0.0778132, -0.850496, -0.245578, -0.802597, 0.271052, 0.318523, 0.458433, 0.382904, -0.250066, 0.654148, -0.148349, -0.115356, 0.142153, -0.087436, 0.196523, -0.917795, 0.315027, -0.373117, -0.288659, 0.134314, 0.04889, 0.837748, -0.104825, 0.0526669, 0.143866, 0.629049, 0.891406, 0.470607, -0.83506, 0.521549, -0.806359, -0.544532, 0.222197, 0.48746, -0.796627, -0.88347, -0.170721, 0.254231, -0.229935, 0.955481, 0.216324, 0.464661, 0.461978, 0.642229, 0.133973, -0.118378, 0.850263, 0.377257, 0.782301, -0.280998, 0.410053, 0.711453, -0.973167, 0.0713597, 0.361627, -0.279584, -0.270762, 0.430876, -0.195276, -0.899462, 0.39729, 0.0780724, 0.431403, 0.821693, -0.0839872, 0.190727, -0.12966, 0.565882, 0.732313, -0.759195, -0.748684, 0.492429, -0.495437, 0.423084, -0.574893, -0.503438, 0.457588, 0.418909, 0.189606, 0.522324, -0.634763, 0.489154, 0.273819, -0.145599, -0.49756, -0.492287, 0.761592, -0.000623554, -0.539967, 0.991832, -0.868688, 0.589161, 0.01175, -0.933781, -0.260379, 0.0814415, -0.399749, -0.955984, 0.876426, -0.989347, 0.714636, 0.598644, 0.735913, -0.648504, -0.474936, 0.991114, -0.846361, -0.335988, 0.592024, -0.502082, 0.791384, -0.802183, -0.00981054, 0.840467, 0.0204804, -0.384507, -0.0411313, 0.580261, -0.982813, -0.151908, 0.193653, -0.125863, -0.777393, -0.357041, 0.903986, -0.9764, 0.512489, -0.0811292, -0.897891, 0.121202, 0.618291, 0.911738, 0.108097, 0.344875, -0.0962669, -0.00769131, -0.985342, -0.879561, -0.455321, -0.820322, 0.433602, 0.735624, 0.474594, 0.617004, -0.573209, 0.574952, -0.612411, -0.889697, -0.902956, -0.806499, 0.258725, 0.769698, 0.125339, 0.333113, -0.910751, 0.973614, 0.351016, 0.315461, 0.219843, 0.290496, 0.767987, -0.567315, 0.511096, -0.882297, -0.5825, 0.077209, -0.262623, -0.31289, -0.0841505, 0.129769, -0.519536, -0.265495, 0.452796, -0.727736, 0.831658, -0.423661, 0.378802, -0.116629, 0.0581007, 0.0870489, -0.808353, 0.708178, 0.45467, 0.779086, -0.172589, 0.920836, -0.804228, 0.205852, -0.458408, -0.88038, -0.0193387, -0.421952, 0.939657, -0.426065, 0.064943, -0.36454, 0.862642, -0.29028, -0.748415, 0.82536, 0.741575, 0.0059572, -0.609656, 0.505078, -0.804056, -0.551332, -0.0118185, 0.0640274, 0.326527, 0.661705, 0.00509995, -0.46583, -0.108457, -0.3637, 0.527814, -0.986962, 0.18124, -0.252206, -0.66971, 0.583132, 0.810188, -0.658632, 0.37495, 0.927999, -0.763982, 0.927505, -0.666557, 0.360209, 0.754962, 0.227741, 0.0408453, -0.974854, 0.960952, 0.102796, 0.458753, 0.81338, -0.334201, -0.670157, 0.190788, -0.0564951, 0.972862, 0.588319, -0.453712, -0.219987, 0.96304, 0.544795, -0.137712, -0.659321, -0.234751, 0.131017, 0.88358, 0.22213, -0.260676, -0.691884, 0.26461, 0.291233, 0.993018, -0.561066, 0.449576, -0.727254, 0.743499, -0.159309, -0.369911, 0.182813, -0.75723, -0.229668, -0.104833, -0.994445, 0.256755, 0.348927, -0.3391, -0.345049, -0.6663, -0.69722, -0.62539, -0.210952, -0.454094, 0.876847, -0.772533, -0.788452, -0.627436, -0.0227737, -0.933384, 0.234542, 0.944893, -0.160967, 0.799455, 0.567518, 0.285099, 0.566541, 0.0659493, 0.482447, -0.986669, -0.459079, -0.358282, 0.720687, 0.275317, 0.242685, 0.667507, 0.985798, 0.903523, -0.78858, 0.599193, -0.105274, 0.663006, 0.117376, -0.163196, 0.679814, 0.895549, -0.693309, -0.356023, 0.858678, -0.357129, 0.938866, -0.952051, -0.190774, 0.0777385, -0.85877, 0.115574, -0.804148, 0.300095, -0.698664, 0.00916555, -0.347328, 0.489722, 0.31491, 0.152244, 0.270007, -0.767536, -0.284927, 0.585264, 0.423929, 0.914021, 0.0460202, 0.796809, -0.113385, 0.834901, -0.761807, 0.310512, -0.412469, 0.00273819, 0.0878555, 0.841317, -0.929759, 0.166205, -0.14118, 0.369091, -0.703252, 0.0252218, -0.507627, 0.230403, 0.841469, 0.34033, -0.264652, 0.721979, 0.196968, 0.417636, -0.0482703, -0.50856, 0.445222, 0.767842, 0.660414, -0.40988, 0.404853, -0.385772, -0.532696, 0.430521, 0.315047, 0.378354, -0.860235, 0.423477, -0.421911, 0.546916, -0.921375, 0.422381, 0.576545, 0.140568, 0.583307, -0.556808, 0.134538, -0.564616, 0.572054, -0.615045, -0.195551, -0.0514985, 0.29686, 0.738564, 0.00386476, 0.898615, 0.999595, -0.539126, 0.432216, 0.996186, 0.868123, 0.525514, -0.511518, 0.0314402, 0.797529, 0.592967, 0.318826, 0.795061, 0.0477056, 0.102928, 0.222975, -0.634794, -0.307786, -0.032176, 0.15155, -0.654792, -0.103727, -0.890845, 0.0345103, 0.813083, 0.16034, 0.7572, 0.016833, 0.971275, -0.0096677, -0.0848525, -0.0252109, 0.96784, -0.152499, -0.494764, 0.334276, 0.854598, -0.457543, -0.125114, 0.977667, -0.58127, -0.567165, -0.907343, 0.967505, 0.56191, 0.223592, -0.406023, -0.250247, -0.0969785, -0.986773, -0.683695, -0.222201, -0.0822759, 0.972924, -0.741054, -0.134356, -0.390541, -0.324981, 0.762784, -0.497693, 0.801951, -0.476377, -0.0682237, -0.508351, -0.84562, 0.39014, 0.718719, -0.49028, -0.676656, 0.549222, -0.25519, -0.656963, -0.847495, -0.482279, 0.0752147, 0.891512, -0.758682, 0.960823, 0.152707, -0.29609, -0.804693, 0.265388, 0.971773, -0.82923, 0.727661, 0.146073, -0.944453, -0.632526, 0.235965, 0.369942, 0.264567, -0.913748, 0.69182, -0.782637, 0.316492, 0.18424, -0.274557, 0.212094, 0.18329, 0.262192, 0.725169, 0.864811, -0.86242, 0.0527434, 0.813789, 0.803164, 0.229866, -0.363367, 0.442572, -0.757681, 0.307946, -0.231432, 0.0442069, 0.527884, -0.606251, -0.426519, 0.283625, -0.301365, 0.618496, 0.80113, 0.751548, -0.425969, 0.304287, 0.573563, 0.31202, 0.630824, 0.319571, -0.958634, 0.671538, 0.241494, 0.495351, -0.468583, -0.578099, 0.78189, 0.573657, -0.464073, -0.933043, 0.59026, 0.0304425, -0.746581, -0.995868, -0.174185, -0.689852, 0.936309, 0.438525, 0.342397, -0.43034, -0.518384, 0.479814, -0.492678, 0.0217752, 0.608064, 0.844574, -0.314589, -0.525542, -0.488224, -0.911735, -0.337126, -0.217063, 0.149193, 0.708469, 0.317997, 0.288625, -0.990578, 0.759799, -0.113176, 0.940237, 0.762739, -0.61637, 0.608637, -0.952053, 0.309182, -0.417527, -0.252136, 0.648888, 0.177693, -0.11598, 0.413676, 0.118905, 0.797127, 0.295093, -0.238044, 0.367447, -0.501172, -0.578346, 0.0639089, 0.170028, 0.955455, -0.0828129, 0.687388, -0.0780405, -0.372108, -0.743348, -0.803577, 0.580265, 0.900134, 0.29197, 0.306542, -0.931509, -0.933493, -0.100315, 0.0198498, -0.0467432, 0.965877, 0.565713, -0.11046, -0.00999389, -0.610145, 0.438708, 0.42764, 0.188382, -0.810072, 0.057262, 0.129873, 0.634149, -0.852384, 0.525514, 0.620184, 0.177506, 0.0622937, 0.552076, 0.0649155, 0.540112, -0.805446, -0.790446, -0.563671, -0.283178, -0.923265, -0.159081, -0.878706, -0.0965054, -0.853232, 0.348784, 0.248963, -0.691818, -0.328503, 0.820618, 0.829595, -0.210054, -0.892264, 0.8822, 0.204798, 0.445882, -0.881877, -0.00999039, -0.426785, 0.237597, 0.711325, -0.885035, -0.1654, -0.399616, 0.1258, -0.171375, -0.956664, 0.366892, -0.810819, -0.439332, -0.104871, 0.544769, 0.616554, -0.792301, 0.136406, -0.530614, -0.00830445, -0.193995, 0.364965, 0.114993, 0.216229, 0.26636, -0.863191, -0.973279, 0.165743, -0.906807, 0.267656, 0.588288, -0.157918, 0.637987, -0.234558, 0.0469419, -0.62977, -0.343648, -0.954288, -0.686882, -0.729353, 0.815955, -0.66948, 0.901811, 0.504274, 0.850499, -0.201561, 0.323633, -0.700773, 0.847595, 0.104545, -0.160809, -0.988149, 0.641715, 0.0736089, -0.763157, 0.899935, -0.886092, 0.51701, 0.208119, -0.440678, 0.595652, -0.978894, 0.586425, -0.491945, 0.766946, 0.334867, 0.0160214, -0.965781, 0.37258, -0.300653, 0.775953, -0.59224, -0.791813, 0.323853, 0.612927, -0.415687, -0.364024, -0.686741, -0.423889, 0.949437, -0.855015, 0.695775, -0.697095, 0.851403, 0.540189, -0.0921062, -0.473371, -0.889345, 0.101472, -0.374892, -0.814774, -0.779014, -0.583325, -0.421352, -0.161743, -0.68287, -0.148714, 0.639663, 0.314802, 0.361225, -0.96663, -0.0362969, -0.995999, -0.582658, -0.0203474, 0.762238, 0.513597, -0.957916, -0.948554, 0.760571, -0.853944, 0.691576, -0.701169, 0.923771, -0.0178992, -0.557423, 0.880714, -0.89818, -0.769603, 0.595294, 0.708481, 0.148479, -0.801209, 0.116999, -0.365609, 0.0434474, -0.147502, -0.120204, -0.847492, 0.201462, -0.14924, -0.31186, -0.337545, 0.586987, 0.219686, 0.24317, -0.695652, 0.744327, 0.628399, -0.653124, 0.704209, 0.902668, 0.743794, -0.793594, -0.958158, 0.892299, 0.825189, 0.493637, 0.802681, 0.964441, 0.54773, 0.772702, 0.804813, 0.916409, -0.676275, -0.678015, -0.61476, 0.0914711, -0.0813815, -0.341204, -0.749294, 0.0261054, -0.288492, -0.172472, -0.112473, 0.412284, -0.319851, -0.567201, -0.883808, 0.819138, 0.189502, -0.0196662, 0.748503, -0.0202434, 0.59452, -0.862877, -0.696072, -0.66786, 0.305588, 0.53115, 0.430623, 0.591773, -0.389646, -0.836944, 0.755975, -0.945716, 0.405898, -0.735237, 0.151264, -0.475754, 0.4652, 0.201627, -0.973897, -0.732502, -0.491514, 0.0732803, -0.849527, -0.0289515, 0.475247, -0.765517, -0.514641, 0.292657, -0.278194, 0.430561, 0.135482, -0.693878, -0.250903, 0.294937, 0.205422, -0.984935, -0.541362, 0.882923, 0.363926, 0.372407, -0.331346, -0.127495, -0.274013, 0.901839, 0.646955, 0.0864561, -0.904368, -0.726785, -0.235552, -0.520329, 0.264124, 0.596176, -0.343015, -0.475509, 0.100926, 0.286961, 0.46168, 0.889311, 0.805071, 0.981152, -0.397819, 0.0270925, 0.378312, -0.927279, -0.467114, 0.699514, 0.494217, -0.110137, -0.11622, 0.823125, -0.961559, -0.297847, 0.0618093, -0.516306, -0.889406, 0.114722, 0.853138, 0.274979, -0.178619, -0.855189, 0.928637, 0.599625, 0.0614631, 0.264746, -0.378895, 0.911844, -0.223522, -0.310783, 0.371379, -0.099984, -0.461894, -0.962147, -0.862519, 0.778411, -0.701927, -0.681004, -0.457543, 0.168836, 0.000397133, -0.354573, -0.011856, -0.174458, 0.630949, 0.16443, 0.878156, -0.780036, 0.740459, -0.503265, 0.461866, -0.41814, -0.192116, 0.098697, -0.250815, 0.0899266, -0.632558, 0.0214093, -0.734784, 0.590202, -0.809924, 0.832852, -0.143377, -0.633131, -0.73745, 0.852475, -0.551654, -0.6583, 0.845806, -0.608065, -0.121007, 0.180928, 0.842927, 0.654404, -0.945232, -0.883099, -0.638285, 0.695097, -0.891631, -0.465137, -0.646909, 0.192937, 0.389264, 0.13573, -0.851984, -0.746305, -0.441957, -0.902038, 0.765793, -0.213021, -0.686283, 0.31118, 0.832573, 0.671333, 0.220044, 0.787844, 0.385968, -0.883442, -0.82969, -0.263597, -0.655775, 0.533312, 0.410354, -0.266416, -0.906557, 0.90964, 0.798072, -0.808966, -0.604367, 0.537541, -0.787339, 0.88588, 0.0591958, -0.773466, -0.228298, -0.745019, -0.671604, 0.833439, 0.981805, -0.451124, 0.809004, 0.17322, 0.496914, -0.198779, 0.122564, 0.395931, -0.7316, -0.290568, -0.947338, -0.107483, -0.52814, 0.4689, -0.905818, 0.970072, -0.94378, -0.0272071, 0.889053, 0.637338, -0.666552, -0.476152, 0.883621, 0.196597, -0.214367, 0.474199, 0.30444, 0.967171, 0.735163, 0.210362, -0.262513, 0.611855, 0.309458, -0.816739, -0.739272, -0.401045, -0.184797, -0.924791, -0.627434, 0.0316809, -0.347423, -0.130225, -0.431083, 0.824976, 0.218697, 0.848951, -0.305825, 0.225576, 0.880051, 0.292977, -0.0558702, -0.809625, -0.178768, 0.222876, -0.408108, 0.407627, 0.58726, 0.710915, -0.241454, 0.409439, -0.276627, 0.000893332, -0.450015, 0.87318, 0.935249, 0.989929, 0.792742, -0.970564, -0.175168, 0.399866, 0.115039, -0.465168, 0.623939, -0.546094, 0.0584594, -0.918371, 0.984629, 0.462624, -0.177584, 0.149457, -0.366182, -0.715386, 0.596065, -0.476212, 0.57466, -0.396359, 0.201145, -0.16284, -0.48, 0.203561, 0.997431, -0.230242, 0.862034, 0.60591, 0.47788, 0.771928, -0.521928, -0.415568, 0.858864, -0.416815, 0.360184, -0.133152, 0.814915, -0.923594, 0.0273344, 0.921411, -0.114118, -0.286465, -0.327556, 0.342413, -0.640329, -0.741246, 0.562767, -0.767822, -0.530133, -0.0184391, 0.0186353, -0.496162, 0.665534, 0.320078, 0.652745, -0.708884, 0.412687, 0.671401, 0.514336, -0.291003, -0.304544, 0.309002, 0.399682, 0.692419, 0.7753, 0.495174, 0.0822907, -0.0539887, -0.0921086, -0.964055, -0.225956, -0.931622, -0.475379, -0.694829, 0.820245, 0.623983, 0.210137, -0.554742, -0.546237, -0.590105, -0.731278, -0.218365, -0.308005, -0.70348, 0.158799, -0.0687053, -0.993409, 0.893131, 0.275754, -0.891338, 0.0408476, -0.974082, -0.672279, 0.940796, -0.960778, -0.0556637, 0.519779, -0.442399, 0.819462, 0.770085, -0.842162, 0.348987, 0.285428, -0.953882, -0.223058, -0.800273, 0.409122, 0.450032, -0.705248, -0.554411, -0.128481, 0.306946, -0.211623, -0.23598, 0.681852, 0.435827, 0.376121, -0.272174, 0.935647, 0.401201, 0.0731944, -0.824543, -0.308294, 0.362027, -0.974927, 0.663446, 0.0025016, -0.0721769, 0.0826399, -0.902922, 0.968319, -0.65803, -0.541829, -0.719852, -0.519673, 0.0608165, -0.130994, -0.691866, -0.14447, -0.12053, -0.0557183, -0.762063, -0.91349, 0.888155, 0.697575, -0.442522, -0.258164, 0.829382, 0.460762, 0.878194, 0.87332, 0.030226, -0.493099, 0.198681, -0.398489, -0.662217, 0.74868, 0.735973, 0.169807, 0.60236, -0.759793, 0.760669, -0.479437, 0.603845, 0.131296, -0.557139, -0.52619, -0.13493, -0.757358, -0.89575, -0.142699, 0.769596, 0.740096, 0.064602, 0.87771, 0.435085, 0.135292, -0.0485062, -0.618387, 0.502097, 0.963299, -0.16082, 0.06154, 0.942561, 0.852045, 0.703761, -0.255059, -0.21683, -0.198195, -0.150663, 0.223754, 0.0150481, -0.567922, 0.359374, 0.928482, 0.161149, -0.335975, -0.207317, 0.636564, -0.901862, 0.165749, -0.689497, -0.549932, 0.791909, 0.384864, 0.176648, 0.103588, -0.418546, 0.309736, -0.34721, -0.529623, 0.501389, -0.253748, -0.262713, -0.611555, -0.811544, -0.875409, -0.0933332, 0.189991, -0.781746, 0.256453, 0.47715, -0.23849, -0.645018, 0.801382, -0.673052, -0.736594, 0.156551, -0.677573, -0.0981717, -0.726351, -0.41987, 0.697567, 0.409426, 0.524833, 0.490294, -0.105694, -0.966111, 0.418932, -0.533063, 0.412853, 0.368877, -0.117398, 0.734668, -0.125287, -0.922033, -0.237069, 0.947406, 0.472554, -0.60087, -0.0871759, 0.0609524, -0.598931, -0.490469, -0.349354, 0.681955, -0.631133, -0.0602169, 0.570323, -0.0367455, -0.973721, -0.693228, -0.895074, -0.903197, -0.275339, -0.917919, 0.442428, -0.133171, -0.332001, -0.336255, 0.774661, -0.456986, -0.696838, -0.0636928, -0.413549, -0.620074, 0.950217, -0.257597, -0.652769, -0.461054, 0.000706924, 0.386114, 0.00782337, -0.178476, 0.368081, 0.336257, -0.777812, 0.901906, -0.934775, 0.603009, -0.616113, 0.577476, -0.660583, -0.312111, 0.0786741, 0.741486, -0.946445, 0.424561, 0.944348, -0.107736, 0.602429, -0.739686, -0.234826, -0.874739, -0.881906, -0.10985, -0.321813, -0.0520043, -0.37208, 0.552922, 0.807805, -0.666116, 0.439128, -0.115406, 0.81486, -0.569858, -0.842576, -0.601594, 0.724856, 0.0552972, -0.278385, 0.801485, 0.376142, 0.837987, -0.752474, -0.436214, 0.710068, 0.774913, 0.605815, -0.748775, 0.783423, -0.539898, 0.773862, 0.186964, -0.93337, -0.390583, 0.725978, -0.183059, 0.673099, 0.241125, 0.966379, 0.337404, -0.434026, 0.36133, 0.0919574, 0.94005, 0.82809, 0.0993134, 0.80684, 0.289614, -0.0160217, -0.609655, 0.708357, -0.797074, 0.698379, -0.203176, -0.0423587, -0.948867, -0.584578, 0.111821, 0.0303689, 0.56274, -0.475745, 0.955471, -0.147019, 0.684071, -0.163012, -0.585351, -0.258029, 0.947194, -0.104585, 0.524853, -0.364151, 0.725129, -0.150776, -0.263109, 0.539026, -0.753763, 0.326814, 0.61378, -0.829067, -0.827078, -0.571824, -0.240242, -0.411101, -0.064233, -0.830802, 0.683581, -0.0585049, 0.608106, 0.179215, 0.560255, -0.480743, -0.872884, 0.756775, -0.578231, -0.0954031, 0.208359, -0.238009, 0.342763, 0.521689, 0.45649, 0.540962, 0.284928, 0.932098, 0.195967, -0.308055, 0.982232, 0.547234, -0.68935, 0.949729, 0.819398, 0.0833235, 0.292069, -0.193171, 0.313473, 0.808901, 0.252939, 0.248516, -0.365599, -0.496191, -0.808555, -0.392268, 0.703383, 0.35714, -0.0425261, 0.768497, -0.176398, -0.281282, 0.0240006, -0.499616, -0.655144, -0.798627, 0.64223, -0.288934, 0.991858, 0.201338, -0.966084, -0.312598, 0.589393, -0.095165, 0.34776, 0.41347, 0.312892, 0.303802, -0.706707, 0.15624, -0.0420444, 0.60059, 0.542343, -0.383537, -0.116624, 0.720262, 0.518452, 0.519337, -0.579417, 0.25897, 0.386334, -0.129917, 0.0807597, 0.105233, -0.872185, -0.312883, -0.132687, -0.383228, 0.0967489, 0.666229, -0.592587, 0.673007, 0.531309, -0.462659, 0.906574, -0.245862, 0.0903457, 0.48902, -0.66679, 0.471426, 0.562785, -0.378055, -0.550777, 0.328163, -0.017215, -0.687701, -0.7119, -0.100088, -0.364078, 0.533834, -0.308303, 0.146194, 0.834687, -0.877676, -0.809775, 0.294818, 0.365614, -0.334895, -0.195782, -0.216869, -0.903034, 0.45288, 0.370876, 0.931999, 0.38367, -0.570464, -0.182898, 0.121607, -0.232727, 0.144589, 0.957892, -0.187846, -0.756538, 0.113431, 0.410907, 0.252489, -0.478186, -0.550667, 0.116486, -0.188838, -0.0156786, 0.675436, -0.961059, 0.765577, 0.55956, -0.484667, -0.508349, -0.663478, 0.221062, 0.193492, -0.280882, 0.0826167, 0.920034, 0.184306, 0.992247, -0.723932, 0.487798, -0.395134, -0.344636, -0.400646, -0.5619, -0.238949, -0.406143, 0.985497, -0.0973148, -0.322077, -0.0568586, 0.111116, 0.0390814, 0.312053, 0.178295, -0.986576, 0.708692, -0.125345, -0.327406, -0.301303, -0.149462, -0.507846, -0.897498, -0.644046, -0.418887, 0.812377, 0.490294, 0.565124, 0.348468, 0.80025, -0.282166, -0.981906, -0.506575, 0.490807, 0.208952, 0.0387538, 0.506473, 0.712751, 0.752749, -0.537769, -0.582651, 0.812523, 0.172715, 0.952326, 0.919763, 0.0183002, -0.671351, 0.89651, -0.911539, -0.901706, -0.159118, -0.136693, 0.726328, 0.542059, -0.877976, -0.151315, -0.158247, -0.0732673, -0.199849, 0.367182, 0.679016, -0.709072, 0.76516, -0.708577, 0.768493, -0.96097, -0.0440955, -0.0967154, -0.108934, -0.175538, -0.993636, 0.734792, 0.230589, -0.625689, -0.749126, -0.0381468, -0.20144, -0.394501, -0.130827, -0.762568, -0.0829225, -0.535715, 0.11696, -0.72761, -0.451441, 0.975087, -0.191515, -0.805655, -0.11513, -0.795202, 0.947642, 0.390365, 0.13859, 0.374453, 0.859016, -0.00867736, -0.0781796, -0.374722, -0.551072, 0.471209, 0.895195, -0.565653, -0.524245, 0.203922, 0.848209, 0.247713, 0.477979, 0.849413, -0.501087, -0.44712, -0.574069, 0.540859, 0.0957607, 0.322667, -0.249621, -0.672002, -0.734209, 0.300717, -0.30353, -0.541423, -0.760788, 0.135569, -0.886561, -0.444377, -0.687286, -0.102531, -0.560958, -0.441641, -0.721031, 0.85939, 0.493852, 0.416951, -0.915543, 0.0317684, 0.0661832, -0.983959, -0.469556, -0.405084, -0.6392, -0.403275, 0.472795, -0.83858, -0.186284, -0.4011, -0.764457, 0.901689, 0.803693, -0.711394, -0.344858, -0.0977506, 0.983127, -0.217338, -0.917706, -0.155497, -0.094097, -0.998603, 0.278083, 0.227492, -0.0224346, -0.928578, -0.203492, -0.471363, -0.53076, 0.695781, 0.847842, -0.756177, -0.358979, -0.953147, 0.0181812, 0.967526, -0.964256, -0.361906, -0.882267, 0.0817907, 0.215326, -0.164145, 0.314824, -0.540819, -0.6252, 0.230031, 0.399169, 0.822341, 0.320001, -0.13534, -0.746403, -0.595779, 0.469078, 0.244604, -0.283083, 0.958582, -0.0380333, -0.68088, -0.697604, -0.234933, -0.189632, 0.913731, 0.747633, -0.514201, -0.248072, 0.791234, 0.119609, -0.642276, -0.718519, 0.859229, 0.484681, 0.792079, -0.38993, 0.537367, -0.0721363, 0.89095, 0.531152, -0.541454, 0.901256, 0.439022, 0.0310002, -0.205126, -0.401265, 0.621847, 0.746863, 0.565492, 0.0946394, 0.386759, 0.836333, -0.325242, -0.325067, -0.674379, 0.844603, 0.266289, 0.44314, -0.708102, 0.956298, -0.220532, -0.210684, -0.000265248, -0.414577, 0.117867, -0.878116, 0.937324, -0.76823, 0.425567, 0.773527, -0.510415, 0.798799, -0.59535, 0.210651, -0.924176, -0.998358, -0.166337, 0.354347, -0.153632, -0.260524, 0.907276, 0.638413, -0.571758, 0.613889, -0.973683, -0.426741, -0.862159, 0.195342, -0.356856, 0.0775406, -0.574668, -0.100967, -0.117201, -0.278116, 0.857986, -0.87687, -0.662726, -0.273717, 0.140585, -0.521785, -0.628351, 0.256618, 0.841994, 0.292576, 0.111158, -0.271748, 0.793305, -0.917368, 0.641183, -0.242923, 0.497035, -0.858957, -0.975854, -0.318012, -0.208505, 0.117912, -0.588938, 0.751783, -0.242268, -0.852178, 0.566972, 0.179159, -0.122511, -0.0287698, -0.795137, 0.646424, 0.633473, 0.711775, 0.319359, -0.416481, -0.980787, -0.103339, -0.297693, 0.823815, -0.646347, -0.835242, 0.645043, 0.770483, 0.214438, -0.413331, 0.753404, 0.715504, -0.770554, 0.0322266, 0.779796, -0.613409, 0.673751, 0.037123, 0.145538, -0.316252, 0.182998, -0.748123, 0.0264158, 0.278597, 0.834449, -0.824324, -0.866435, 0.551818, 0.0569486, -0.193575, 0.00472288, -0.367401, -0.126651, 0.813917, 0.886779, 0.105722, -0.157989, -0.610321, -0.977129, 0.829985, 0.268968, 0.216245, 0.932946, -0.849737, 0.00156696, -0.548762, 0.229644, -0.115265, -0.49371, -0.0900357, -0.311938, 0.997608, -0.411153, -0.283778, 0.932528, 0.833652, 0.829148, 0.691492, 0.254728, -0.436726, -0.303176, -0.769461, -0.0677594, -0.466275, 0.740908, 0.8553, 0.688775, 0.0259107, 0.518135, 0.36646, 0.0927179, 0.196201, -0.311029, -0.459707, -0.149676, -0.17742, 0.315627, -0.49793, 0.0359322, -0.437097, -0.588171, -0.263509, 0.578517, -0.756319, -0.187822, 0.630581, -0.383065, 0.636553, 0.813897, 0.951511, 0.424085, 0.812453, 0.136978, -0.846994, -0.269015, 0.469629, -0.700878, -0.522494, 0.611978, 0.436426, 0.363798, 0.684445, -0.816304, 0.244921, -0.969212, 0.555838, -0.0925687, 0.651077, 0.0796117, 0.569768, -0.549079, -0.480169, 0.643578, -0.487354, -0.438922, 0.356199, 0.7458, -0.483308, -0.330775, -0.00650384, 0.878316, -0.161487, -0.198003, 0.866288, -0.711383, -0.421357, 0.0797409, -0.283158, 0.690077, 0.58399, -0.358164, -0.221258, -0.55654, 0.652776, 0.641385, -0.693805, -0.838106, 0.329359, -0.991114, -0.764228, -0.569144, -0.346147, 0.381475, -0.309888, 0.732519, -0.180052, 0.110002, 0.723044, -0.587942, -0.156832, -0.146713, 0.435094, -0.875727, -0.473231, 0.432846, 0.188273, 0.279594, -0.334507, 0.486467, 0.916597, -0.86049, 0.280553, 0.962451, -0.359871, -0.827409, 0.587366, 0.10918, -0.336565, 0.222958, 0.38706, 0.918107, -0.344862, -0.573114, 0.621857, 0.875497, 0.754173, 0.351956, 0.955476, 0.673539, -0.700615, 0.0548703, 0.904219, 0.896232, 0.521446, -0.75886, 0.669352, 0.929625, -0.44485, 0.250298, -0.184305, 0.0924262, 0.279714, -0.269994, -0.61677, -0.337616, -0.988435, 0.262319, 0.974241, 0.0847429, -0.334543, 0.628911, 0.613943, -0.0814969, -0.763337, -0.729926, -0.907243, 0.707363, -0.116839, 0.871903, -0.921851, 0.241053, 0.39786, 0.0708219, 0.368743, -0.481273, -0.205022, 0.119227, -0.319832, 0.263777, -0.290675, -0.371442, 0.0451955, 0.508527, -0.749029, 0.262448, -0.606616, 0.695971, -0.943841, -0.384183, 0.242994, -0.812663, 0.989984, 0.369945, 0.197783, 0.230248, -0.346309, -0.118503, -0.411502, -0.837462, 0.786385, 0.947436, 0.203519, 0.0561911, -0.554378, -0.0135502, -0.324493, 0.55934, 0.655228, -0.871428, 0.527574, -0.342759, -0.568677, 0.329754, -0.207299, 0.561817, 0.386902, -0.521936, -0.0657841, -0.364332, -0.648329, -0.329898, -0.573564, -0.385697, -0.808874, 0.114305, -0.076277, 0.926925, 0.908347, 0.85794, 0.751679, 0.122849, -0.0659287, -0.423242, 0.454886, -0.903938, -0.784334, 0.316519, 0.438348, -0.621198, 0.546286, -0.791803, -0.893707, -0.997409, 0.495318, -0.218655, -0.90529, 0.653548, 0.283061, -0.0169235, 0.464553, -0.494046, -0.363458, 0.406153, -0.22969, 0.38501, -0.564729, 0.0984917, -0.0664918, 0.287527, 0.22823, -0.0104541, 0.789617, 0.304497, 0.977259, 0.00633124, -0.857047, 0.366876, 0.126475, -0.947661, 0.554804, -0.693022, 0.611642, -0.611186, -0.479952, -0.98664, 0.0143384, 0.41565, 0.74307, 0.611926, 0.335768, 0.907239, 0.780999, 0.383478, 0.910602, 0.384138, -0.111989, 0.997816, -0.104635, -0.754731, -0.665575, -0.789913, 0.77104, 0.587327, -0.287594, -0.537806, 0.465239, 0.593085, -0.840722, -0.0150289, 0.801601, 0.395087, -0.520209, -0.707235, -0.428244, 0.977165, -0.343892, 0.158142, 0.422693, -0.693471, 0.517946, -0.422964, 0.991963, -0.259899, 0.0185814, -0.324141, -0.637482, 0.716027, -0.0375946, 0.514806, -0.8895, -0.0515504, 0.982397, 0.90058, -0.792066, 0.22082, -0.332075, 0.906467, 0.583696, 0.964708, 0.260966, 0.358927, 0.437547, 0.419706, -0.864432, 0.565901, -0.97997, 0.997522, 0.837145, -0.712771, 0.905542, -0.60785, 0.02231, -0.21674, -0.613462, 0.438779, 0.832911, 0.345688, 0.304237, 0.188727, 0.563918, -0.140327, -0.284354, -0.108846, -0.351309, 0.91243, 0.385165, -0.28506, -0.230699, -0.982266, -0.143955, 0.0183295, 0.12208, 0.257592, -0.349131, 0.620155, 0.41931, 0.172675, 0.856835, -0.116804, -0.35968, 0.554786, -0.00413469, -0.797396, -0.0721877, 0.218471, -0.493554, 0.907252, 0.88767, -0.820744, -0.817169, 0.725885, -0.536624, -0.650616, 0.0264754, -0.0387278, -0.757167, 0.39416, 0.514134, 0.526891, -0.75985, 0.365075, -0.290856, -0.773123, -0.782196, -0.358976, -0.753885, -0.108901, 0.679418, 0.588052, -0.386599, 0.123665, 0.75266, -0.427877, -0.112436, 0.26773, 0.666453, -0.915197},
-	{-0.212468, -0.149111, -0.670478, 0.708592, 0.678935, -0.134848, -0.245366, -0.447542, -0.145891, 0.629083, -0.375891, 0.0894452, 0.315041, -0.242265, 0.217484, 0.807388, 0.000893151, 0.584019, -0.77057, 0.950974, -0.16641, -0.774746, 0.113977, -0.207076, -0.692151, 0.376007, -0.583707, -0.687743, 0.724138, -0.916975, 0.0462, -0.516095, -0.924215, -0.904423, -0.799023, 0.0495848, -0.849467, -0.49582, -0.835052, 0.801267, 0.345305, 0.345204, 0.21721, 0.693917, 0.52754, -0.468876, 0.61495, -0.809046, 0.934837, 0.536727, 0.31466, -0.30263, 0.267236, -0.0938482, -0.528855, 0.414022, 0.3281, -0.709333, 0.967765, 0.616265, 0.438198, 0.011637, -0.328166, -0.417808, -0.0516696, 0.709271, 0.842273, 0.820142, -0.166762, -0.175626, -0.980894, -0.654056, 0.12264, -0.0109834, -0.841227, -0.482613, 0.850977, 0.984038, 0.140449, -0.927711, -0.0403956, -0.808182, 0.299639, 0.535882, 0.560099, 0.382096, 0.786674, -0.763834, 0.836558, 0.897474, 0.560147, 0.937313, -0.637038, 0.674425, 0.305441, -0.441852, 0.0197223, -0.956292, 0.232035, -0.394781, 0.450325, 0.201078, -0.233991, 0.798682, 0.0087367, -0.0764698, -0.380578, 0.200728, 0.129922, -0.879467, -0.911812, 0.488368, 0.286233, -0.979398, 0.803077, 0.271785, 0.0374159, -0.851792, -0.460389, -0.821619, 0.645435, -0.792651, -0.752439, 0.527633, -0.456371, -0.43533, 0.925821, -0.620228, -0.0421754, -0.519636, -0.727055, -0.322963, -0.272716, 0.331633, 0.039414, 0.519186, 0.947849, 0.538615, 0.150879, -0.17866, 0.27185, -0.879387, 0.48054, 0.601406, -0.687888, 0.517698, 0.592126, -0.80342, 0.150895, 0.446315, 0.208813, -0.948428, 0.858083, 0.860568, 0.0213513, 0.811854, -0.313064, -0.98448, 0.869075, -0.878237, -0.0304626, -0.400923, -0.765406, 0.142767, 0.0720866, 0.764891, -0.0480453, -0.918535, 0.00226647, -0.219299, -0.582154, 0.400801, -0.162868, 0.725339, -0.642395, 0.731962, 0.858548, -0.41728, 0.673307, 0.171444, 0.0608494, -0.288688, -0.918622, 0.790558, 0.638415, 0.644764, 0.192285, 0.313764, -0.561634, 0.50939, -0.34474, 0.599925, 0.556337, 0.00198982, 0.106308, -0.234598, -0.180736, 0.792115, 0.7383, -0.447743, 0.932025, 0.383674, 0.684816, -0.698142, -0.790017, 0.79167, 0.872336, -0.426941, 0.827934, 0.546588, -0.772015, 0.373361, 0.593459, -0.905645, -0.469435, 0.257321, 0.124155, 0.708026, -0.200939, -0.562157, 0.988116, 0.361188, -0.993045, -0.517028, 0.567252, 0.945355, 0.563985, 0.546855, -0.0927818, 0.851005, 0.146246, -0.218898, -0.907891, -0.413829, -0.691961, 0.504328, 0.164433, 0.185158, -0.246414, -0.606319, 0.383632, 0.80633, 0.268089, 0.333024, 0.236534, -0.788599, 0.852143, 0.661292, -0.759048, -0.161439, 0.510243, -0.701344, 0.366347, -0.453111, -0.596823, 0.679172, -0.133279, 0.205832, 0.00629488, 0.493136, -0.621213, -0.858318, 0.280782, 0.0673746, -0.176582, 0.141784, -0.594961, -0.787993, 0.961142, 0.013447, 0.223614, 0.534732, -0.618739, -0.502886, -0.176935, -0.915705, -0.260842, -0.65093, 0.890437, 0.252852, 0.0370655, 0.181425, -0.726389, 0.118087, 0.509455, -0.190262, -0.248899, -0.378414, 0.0815089, -0.80659, -0.535994, 0.954075, -0.881498, -0.148976, -0.83569, -0.00311322, 0.607301, 0.980263, 0.266937, 0.831172, -0.713979, 0.71523, 0.147099, 0.730653, -0.331657, 0.201377, -0.00834972, 0.335314, -0.12501, 0.203487, -0.120353, 0.00429904, -0.435676, 0.868132, -0.446017, 0.126044, -0.626661, -0.0125647, 0.259066, 0.519604, 0.792878, 0.381858, -0.566517, 0.578644, 0.317307, 0.991368, 0.025331, 0.522594, 0.710722, 0.762844, -0.744742, 0.31773, -0.0875, -0.771117, -0.509492, -0.540787, -0.494607, 0.767651, 0.919096, -0.71858, 0.233275, -0.521691, 0.682775, 0.417095, -0.441565, 0.320902, -0.0797336, -0.716824, -0.0596252, 0.929059, 0.933395, 0.222365, 0.875299, -0.861568, 0.956233, -0.424389, 0.20605, -0.693474, -0.346754, 0.56619, -0.123535, -0.468622, -0.196224, 0.250286, -0.715544, -0.605192, 0.485687, 0.515246, -0.80299, -0.338727, -0.308604, 0.312778, 0.528206, 0.832769, 0.861376, 0.676351, 0.707124, -0.377226, -0.0453564, -0.514031, -0.859235, 0.622328, -0.113211, 0.551689, -0.551226, 0.296301, -0.896626, -0.821486, -0.175777, 0.226186, -0.139751, -0.258425, -0.173198, 0.856314, -0.972367, 0.932688, 0.726237, 0.921819, -0.0650447, 0.682661, 0.605745, 0.361863, 0.330698, 0.418869, -0.472426, 0.982292, 0.342866, 0.21235, -0.29224, 0.84978, -0.927635, -0.995294, -0.366493, 0.977492, 0.653099, -0.0912615, -0.107371, -0.577455, 0.728708, -0.408555, 0.314837, -0.980236, 0.990448, 0.0364194, -0.342403, 0.764418, -0.566632, -0.475708, 0.173865, 0.196437, -0.833863, 0.301818, 0.00117155, -0.911305, 0.786209, 0.0563576, 0.39121, -0.664359, -0.743646, -0.577792, 0.266962, 0.629793, -0.464201, 0.550274, -0.501197, 0.718968, 0.416505, 0.478634, -0.53247, 0.55132, -0.519655, 0.536264, 0.579659, -0.31778, 0.996877, -0.437125, 0.181166, 0.185269, 0.247235, 0.0839221, 0.908374, -0.602096, 0.712611, -0.637404, -0.430068, 0.559717, -0.136919, -0.200351, 0.938086, 0.645872, 0.348255, 0.570978, 0.396371, 0.554668, 0.296565, 0.158679, 0.337029, 0.084302, -0.554127, 0.272943, -0.748971, 0.219814, 0.560478, 0.712824, 0.990821, 0.939155, -0.17734, -0.603833, 0.796401, -0.862389, -0.603394, 0.609575, 0.983602, -0.494203, -0.27016, -0.80113, 0.939351, 0.305628, -0.492979, 0.783909, 0.737987, 0.648019, 0.0848317, -0.780224, -0.243479, -0.240853, -0.905235, -0.944214, -0.133746, -0.189279, 0.742566, 0.705021, 0.0258014, -0.618818, -0.714248, -0.672855, 0.997751, -0.188294, -0.356604, 0.145147, 0.0700862, -0.739935, 0.343748, -0.234527, -0.615697, 0.0112279, -0.108766, 0.124643, 0.710214, -0.737419, -0.146183, 0.778993, 0.0863598, 0.751299, 0.996448, -0.137906, -0.27584, -0.551817, -0.545451, -0.114213, -0.103158, 0.00217822, 0.399221, 0.662789, 0.646561, -0.682344, 0.913753, 0.217475, -0.409128, 0.353597, -0.621786, -0.534213, 0.398882, 0.429104, 0.986432, -0.522271, -0.835192, 0.361304, 0.585492, -0.409096, -0.250137, -0.178022, -0.461467, 0.440933, 0.601472, -0.155569, 0.34314, 0.782246, -0.845942, -0.805808, 0.682307, -0.68563, 0.218478, 0.494392, 0.778187, 0.391478, 0.881135, 0.840322, 0.217103, -0.20583, 0.965839, -0.876127, 0.519082, -0.935078, 0.636874, 0.339024, 0.693167, 0.0890868, -0.930677, 0.320568, -0.45017, -0.831563, 0.413582, 0.722218, -0.187116, -0.596359, 0.839548, -0.0678692, 0.540501, -0.889602, -0.879525, 0.565632, 0.668292, -0.177339, -0.507321, -0.395726, 0.664847, -0.110342, 0.944807, -0.109228, -0.25082, 0.576941, 0.608522, 0.149418, -0.520469, -0.337906, 0.669369, 0.894518, -0.553698, -0.288826, -0.788683, 0.538356, -0.864234, 0.359694, 0.229235, 0.225627, -0.445296, 0.196724, -0.364396, -0.923673, -0.695407, 0.110397, -0.28242, 0.262616, -0.992284, 0.848096, -0.281261, -0.759761, -0.292185, 0.316533, 0.592374, 0.31213, 0.00408482, 0.365433, -0.520265, 0.872136, -0.653258, 0.835745, -0.765356, 0.309938, -0.447736, -0.59644, 0.60547, -0.291689, -0.311884, 0.966323, -0.962341, 0.75627, -0.765765, -0.328728, 0.472214, -0.846535, -0.171052, 0.651627, -0.723885, -0.695511, -0.676766, -0.375306, 0.738647, -0.0811115, -0.695112, -0.832314, 0.981618, -0.964651, -0.934551, 0.739694, -0.991848, 0.236626, -0.852646, 0.424478, -0.616196, 0.490433, 0.18773, 0.503238, 0.201476, -0.583184, -0.788573, 0.100768, 0.830998, -0.68425, -0.582608, -0.492631, -0.370265, -0.676018, 0.00528547, 0.367113, 0.940726, -0.152533, -0.263801, 0.448232, -0.872701, -0.817835, -0.630995, 0.649736, -0.818572, -0.660871, -0.415245, -0.74186, -0.839358, -0.478281, 0.821171, 0.667523, 0.0572935, -0.506476, -0.291362, -0.727061, 0.789944, 0.0863414, 0.103722, -0.31867, -0.960366, 0.915529, -0.330912, -0.00253091, 0.833175, 0.685184, -0.120664, -0.416139, 0.483035, -0.698083, -0.0388828, 0.498385, 0.0738261, 0.662737, -0.499181, -0.281304, 0.459679, -0.164412, 0.904802, 0.856978, -0.860075, -0.84504, -0.188233, 0.193158, -0.0335176, -0.925711, -0.22984, -0.717651, 0.474456, 0.110394, 0.624831, -0.652545, 0.527834, 0.0508695, -0.898745, 0.965124, -0.992146, 0.0327633, 0.466841, -0.672168, 0.380107, 0.696503, 0.525387, 0.495461, 0.106978, 0.452042, 0.704908, -0.819629, 0.039537, 0.539897, -0.316725, 0.816922, 0.693145, 0.206362, -0.590599, -0.0266478, -0.615041, -0.375017, -0.447561, 0.970662, 0.751269, 0.671183, -0.38365, -0.766853, 0.0854519, 0.450926, 0.814567, 0.250078, 0.0677266, -0.246571, 0.447076, -0.891071, -0.47476, -0.176215, 0.871216, -0.899799, -0.980126, -0.341369, 0.321091, 0.918591, 0.764431, 0.955415, 0.93053, -0.55863, 0.372128, 0.525274, -0.360822, -0.144377, 0.466455, 0.543471, -0.241843, -0.117219, 0.893227, -0.0119054, 0.124504, -0.36718, -0.302411, -0.569001, -0.183129, 0.983284, -0.560262, 0.406159, 0.225478, -0.425366, 0.217666, 0.679165, -0.581878, 0.416745, 0.91714, -0.502737, -0.957242, 0.778101, -0.0344877, -0.218202, 0.855831, -0.515446, -0.897937, -0.837337, 0.316578, 0.235515, 0.36609, -0.625102, 0.851523, -0.829426, -0.3717, -0.78292, 0.976387, -0.65405, 0.151127, 0.619906, -0.519172, 0.249135, 0.130131, -0.317944, 0.530702, 0.0250856, 0.679247, 0.406692, -0.691408, -0.744798, 0.0862042, 0.672924, -0.870818, 0.385724, 0.842504, 0.384421, 0.917153, -0.26593, -0.351067, -0.468219, 0.0980996, -0.834013, 0.443299, -0.985576, -0.711035, -0.595497, -0.924197, 0.693908, -0.846234, -0.919338, 0.39517, -0.363955, -0.978957, -0.900541, -0.52846, -0.568752, 0.533607, -0.241415, 0.972183, -0.130732, -0.538377, -0.871793, 0.169481, -0.24409, -0.8698, 0.647627, -0.104984, 0.143278, -0.984577, 0.639406, -0.296652, -0.722269, -0.766703, 0.378149, -0.779043, -0.17791, -0.263436, 0.857079, 0.282416, -0.36004, -0.430155, 0.586976, -0.443496, -0.77511, 0.0147307, 0.11392, 0.515691, 0.499984, -0.255207, -0.358751, 0.26458, -0.0230291, -0.295605, 0.457769, 0.784562, 0.8541, -0.966438, 0.707997, -0.177657, 0.0406795, 0.490682, -0.80582, 0.895129, -0.299597, 0.0660457, -0.0117559, -0.576237, 0.835604, 0.775959, 0.696237, 0.650717, -0.096941, -0.700844, -0.625981, 0.0984744, -0.733073, -0.883593, -0.63719, -0.451023, -0.725155, 0.853736, -0.493211, 0.496908, -0.329268, -0.501598, 0.34319, 0.452707, -0.555959, -0.143739, -0.515963, -0.876429, -0.797098, -0.91358, -0.123983, 0.0844496, 0.996393, 0.327191, -0.40748, 0.898728, 0.0890528, -0.62312, -0.324389, -0.603149, 0.363883, -0.858344, 0.686236, -0.0841739, 0.52106, 0.0875919, -0.849106, 0.648237, 0.379286, -0.358659, 0.454128, 0.689547, -0.106321, -0.91692, -0.0448781, -0.0296491, 0.555119, 0.556213, -0.471575, -0.0267845, 0.887039, 0.284626, 0.523898, 0.580941, 0.370828, -0.97517, 0.590727, 0.864626, -0.55239, 0.474867, -0.516962, 0.371065, 0.145651, -0.300851, 0.996326, 0.0623873, -0.344993, 0.0510593, 0.210177, -0.611316, 0.879182, 0.173965, 0.724545, -0.390849, 0.894023, 0.0813615, -0.220967, 0.592971, 0.355289, -0.726358, -0.576059, -0.368181, 0.318523, -0.127021, 0.866637, 0.660491, -0.026415, 0.027493, 0.232621, 0.200716, 0.600798, 0.811512, -0.883992, 0.602347, -0.680817, 0.122869, -0.751066, 0.0112603, -0.577511, 0.751119, 0.873828, 0.697838, 0.103504, 0.0590283, -0.786788, -0.931756, -0.319444, -0.720916, 0.0962125, 0.395724, -0.875987, -0.449165, -0.346294, -0.22759, -0.6789, 0.124241, -0.524277, -0.161318, -0.843413, 0.18474, 0.643103, 0.519421, -0.850901, -0.73546, 0.52243, -0.940988, -0.393543, 0.665274, 0.391565, -0.773378, 0.421412, -0.927723, -0.160877, -0.142636, -0.551889, 0.614675, 0.785557, -0.35125, -0.908479, 0.0636817, -0.997032, 0.333368, -0.639601, -0.294714, -0.460434, -0.191385, 0.880629, -0.0443065, 0.641479, 0.749139, -0.00274638, -0.506255, -0.189171, -0.684373, 0.908217, 0.289866, 0.474942, 0.846161, -0.890012, 0.822666, -0.882588, -0.306834, -0.723321, 0.885904, -0.0796638, -0.328439, -0.633043, 0.0249119, 0.729768, -0.164832, -0.962893, -0.804353, 0.406195, 0.606529, 0.172251, 0.80011, 0.55219, 0.635429, -0.419154, 0.119161, -0.191913, 0.315734, 0.702277, 0.413726, -0.349572, 0.827155, -0.533311, 0.774828, -0.162428, -0.20336, -0.806514, -0.233362, 0.0579448, -0.270255, 0.798627, -0.0451424, -0.882102, -0.0521002, -0.0942724, 0.115956, -0.641985, 0.121522, 0.705102, 0.204722, 0.903587, 0.234662, -0.702715, -0.286307, -0.215388, 0.625885, 0.73759, -0.910941, -0.513535, 0.74299, -0.702073, 0.829341, 0.980684, 0.693128, -0.115625, 0.486366, 0.482148, 0.192264, -0.482188, -0.233143, -0.65844, 0.229483, -0.342254, -0.231993, -0.185712, 0.334997, 0.411602, -0.518205, -0.377905, 0.729832, 0.328697, 0.693172, -0.929137, 0.356969, -0.334168, 0.90221, 0.408258, -0.599979, -0.488072, -0.194684, 0.384789, 0.389581, 0.622983, 0.840996, -0.808379, -0.993411, -0.937203, -0.778832, 0.628335, 0.0588538, 0.556758, -0.675003, 0.736373, 0.241487, -0.416053, 0.038257, 0.103357, 0.166584, -0.049185, -0.187369, 0.865438, -0.100873, -0.865363, 0.720849, 0.822331, 0.136289, -0.642172, -0.642208, 0.790645, 0.516731, 0.0578843, -0.167732, -0.243339, -0.719126, 0.574977, -0.540243, 0.823139, -0.808675, -0.487279, 0.825268, 0.95981, -0.945542, -0.683564, -0.351886, 0.688587, 0.477969, -0.624993, 0.136416, -0.611689, -0.812728, -0.893168, -0.578246, 0.608212, 0.64894, 0.846954, 0.479317, -0.578888, -0.53133, 0.501639, -0.104222, 0.476617, -0.493898, 0.486098, 0.331936, 0.151169, -0.0881659, 0.675341, -0.0533366, 0.556834, 0.888644, 0.4872, 0.808594, -0.531692, -0.241554, 0.902963, 0.789967, -0.640114, 0.496276, -0.653399, -0.657143, 0.158564, 0.71478, -0.944678, 0.539039, -0.475114, -0.120471, 0.252215, -0.133074, 0.492046, -0.18132, 0.71807, 0.441679, 0.0829337, 0.271028, -0.199831, -0.578975, -0.433636, 0.552019, 0.920159, 0.561192, 0.906217, -0.224633, -0.325385, -0.210368, 0.583472, 0.297051, 0.676269, -0.52296, 0.707426, -0.953496, 0.706544, 0.166787, 0.282991, -0.86946, -0.921542, -0.541286, -0.965012, 0.983677, 0.71901, 0.339705, -0.684935, 0.0602593, -0.662998, -0.728236, 0.112949, -0.607095, 0.438237, -0.145074, -0.899806, 0.663099, 0.897897, 0.978463, 0.986136, -0.733295, -0.0883873, -0.321631, -0.64236, 0.952772, -0.492826, 0.663583, -0.519478, 0.9263, 0.233561, -0.249536, -0.166473, -0.0107462, 0.28693, -0.781577, -0.612688, -0.430554, -0.95822, -0.474341, 0.751034, -0.0475316, 0.179533, -0.797578, 0.522028, 0.19176, 0.441947, 0.0379451, 0.446007, 0.637911, -0.945066, -0.611907, -0.0587965, 0.0650701, -0.277385, -0.656908, -0.0572398, -0.82592, 0.66715, 0.618727, -0.743058, 0.316198, -0.464064, -0.722869, 0.0922585, -0.416521, -0.601571, -0.576001, -0.361483, -0.251162, -0.945337, 0.726953, 0.071156, -0.976024, 0.134874, 0.618276, 0.102682, -0.261883, 0.463693, 0.767549, -0.924369, 0.980862, -0.540313, -0.653558, -0.686317, 0.872559, -0.182401, 0.617165, -0.879226, 0.878087, 0.853873, -0.338579, -0.45211, 0.555094, 0.666144, 0.718259, 0.851437, -0.982849, -0.468045, -0.557528, -0.510091, -0.391625, 0.910012, 0.0809405, -0.143677, 0.792423, 0.633276, -0.913354, -0.191078, -0.846235, -0.118878, 0.261467, -0.275081, 0.407211, 0.381142, 0.667367, 0.142291, 0.0563464, 0.43186, -0.483802, 0.747544, 0.309174, -0.503966, 0.278018, -0.698277, -0.52614, 0.0563736, 0.514673, 0.769704, 0.554776, -0.570822, -0.974871, 0.68166, 0.196149, 0.48026, -0.119928, 0.81311, -0.703782, 0.38359, -0.729871, -0.259547, -0.462747, -0.797305, -0.76214, -0.469112, 0.728669, -0.936391, -0.210986, 0.0271938, 0.941319, -0.0350232, 0.487672, 0.881548, 0.227627, 0.292835, -0.0327448, 0.281491, -0.332564, -0.797163, -0.939442, 0.641206, 0.714373, 0.610098, 0.577309, -0.849248, 0.0138823, -0.301845, -0.127058, 0.152219, 0.950237, 0.858682, -0.796557, -0.430739, -0.63533, -0.0821018, -0.772987, -0.969255, -0.126267, 0.455942, 0.172768, 0.966955, -0.9164, -0.743931, 0.658174, -0.508633, 0.103267, 0.492983, -0.71333, -0.410206, 0.176956, 0.949963, 0.383077, 0.852547, 0.338656, -0.406248, -0.407494, 0.395245, 0.286959, 0.552766, 0.633612, -0.588935, 0.498724, -0.790205, 0.447213, -0.956818, 0.850724, 0.648134, -0.353298, 0.355049, -0.573565, -0.652726, 0.509434, 0.572348, -0.28898, -0.943305, 0.290893, 0.5932, -0.0981849, 0.245316, -0.950599, -0.0536393, 0.352251, 0.239513, -0.583259, 0.273038, 0.581449, 0.634376, 0.756974, 0.775268, -0.875376, 0.756001, -0.894577, -0.104453, 0.92576, -0.700119, -0.844487, 0.709243, -0.903928, 0.336502, 0.237806, -0.229028, 0.317746, 0.737589, 0.261757, 0.261513, 0.032931, -0.868855, -0.0201157, 0.807545, 0.829485, -0.295429, -0.240575, -0.70131, 0.583721, -0.13874, -0.974098, -0.971512, 0.37026, 0.726467, 0.320704, 0.671855, 0.546986, 0.75658, -0.403071, -0.870303, -0.0462929, 0.11857, 0.200208, -0.952635, 0.854097, 0.0495157, 0.0159142, -0.34967, -0.638571, -0.613983, -0.0835949, -0.947326, -0.70694, -0.400025, 0.942836, 0.573575, -0.469135, 0.0550349, 0.00109473, -0.564366, -0.865992, 0.891704, -0.113552, 0.855253, 0.591372, -0.180004, -0.84891, -0.583541, -0.734584, -0.138298, -0.731767, -0.397166, 0.38719, -0.930632, 0.82576, 0.262703, -0.130886, -0.547607, 0.908916, -0.490027, 0.764575, 0.736727, -0.0295739, -0.965153, 0.673789, -0.764778, -0.275874, -0.567507, -0.658712, -0.546177, 0.0248411, -0.701292, -0.324001, 0.812606, -0.160575, -0.927081, 0.537648, 0.723002, 0.475448, 0.62898, -0.28253, -0.592332, -0.430524, -0.499316, 0.149246, -0.685683, -0.527113, -0.8357, 0.520592, -0.0196688, 0.79312, -0.71784, 0.249336, -0.704481, -0.674574, 0.455463, -0.245401, -0.693101, 0.734126, 0.791009, -0.406898, 0.289353, 0.581587, -0.112321, 0.351675, 0.0650007, 0.679062, -0.833052, -0.910198, 0.890968, -0.516725, 0.257246, 0.0157275, -0.540235, -0.964362, -0.182809, -0.400316, 0.842495, 0.328115, -0.605994, 0.560996, -0.285235, 0.908424, 0.252943, 0.828933, -0.94024, 0.742575, -0.128534, -0.288985, 0.167277, -0.717001, 0.357701, 0.942475, -0.589073, -0.598889, -0.130208, -0.974126, -0.597836, -0.85957, -0.668887, -0.47341, -0.394884, 0.540712, 0.363853, -0.539384, -0.833698, -0.952798, 0.327095, 0.0589908, -0.609185, -0.461772, 0.984757, -0.459486, 0.714913, 0.483703, 0.148726, -0.924079, 0.962337, -0.577606, 0.0616086, 0.662392, -0.346969, 0.254554, 0.217109, -0.23664, -0.580207, -0.456238, 0.557356, 0.931323, -0.554768, 0.320047, -0.537186, -0.358434, -0.700409, 0.0287595, 0.278015, 0.741774, 0.885608, 0.218333, 0.628053, 0.165347, 0.875282, -0.928259, 0.672356, -0.886669, 0.19336, -0.656911, -0.554382, 0.670068, 0.0490454, 0.014955, 0.323936, 0.716756, 0.997404, -0.65946, -0.360448, -0.16899, 0.462866, -0.69148, -0.962493, 0.607547, -0.559198, -0.917982, 0.426749, 0.533946, -0.171039, -0.377515, -0.476248, -0.482405, -0.965902, 0.0410478, 0.364419, -0.151748, -0.943641, -0.817187, 0.493403, 0.69449, 0.901881, 0.807187, -0.0689701, 0.12124, 0.621753, 0.489681, 0.966849, 0.297523, 0.20467, 0.316181, 0.00191725, -0.0516244, -0.442602, 0.793091, 0.672378, -0.635721, -0.0890337, -0.98514, 0.232964, 0.50858, 0.826686, 0.105849, -0.249394, 0.968112, 0.110161, 0.845226, 0.375194, -0.530209, -0.586635, -0.0690333, 0.348483, -0.542573, 0.048934, 0.707642, -0.0960401, 0.57709, -0.539585, 0.79375, 0.458027, 0.227687, 0.770654, -0.389233, -0.440766, -0.619627, 0.65628, 0.367105, -0.771902, -0.745835, 0.00382824, -0.727619, 0.127766, 0.804747, -0.54141, 0.0346186, 0.238263, -0.413288, 0.699372, -0.78739, -0.249295, 0.148304, 0.314351, 0.634339, 0.844441, -0.288875, -0.290076, 0.97738, -0.237134, 0.305931, 0.600519, 0.494531, 0.137182, -0.597716, 0.148734, -0.254202, 0.0862677, -0.933368, -0.419879, 0.955992, 0.222952, -0.737956, -0.840319, 0.0738803, -0.42352, 0.607644, -0.199637, 0.387283, -0.157224, 0.485784, -0.0329733, -0.403021, -0.35031, 0.830341, -0.176689, -0.548826, 0.309576, -0.796715, 0.805525, 0.428579, -0.760234, -0.565113, -0.118522, -0.866601, 0.922698, 0.547122, 0.281538, -0.704871, 0.632845, -0.755109, 0.258773, 0.264014, 0.72568, -0.184343, 0.624278, 0.672484, -0.182704, 0.523806, -0.789613, 0.510632, 0.915849, 0.687122, 0.889628, 0.0155519, -0.200626, 0.357465, -0.415958, -0.550642, 0.942222, -0.380708, 0.44066, -0.447245, 0.00332234, 0.640837, -0.126037, -0.108992, 0.721863, 0.195707, 0.400519, -0.620858, 0.874528, 0.905333, 0.905603, -0.53992, 0.654504, -0.821152, -0.804098, -0.378244, -0.788173, 0.101327, -0.0038498, -0.951924, 0.0467135, 0.158353, 0.897681, 0.0364934, -0.75964, 0.407249, -0.426648, 0.141685, 0.656432, -0.995059, 0.651836, -0.621872, -0.0607543, 0.738584, 0.183027, -0.373649, -0.197377, 0.649145, 0.890117, -0.275889, -0.650696, 0.303193, -0.424947, -0.282917, 0.201662, -0.48602, 0.91026, -0.66795, 0.0592898, 0.749143, 0.263498, -0.756613, 0.498754, 0.14489, -0.432884, -0.527734, -0.336058, -0.840952, -0.409572, 0.348806, -0.0163826, -0.729377, -0.159262, -0.205196, -0.891063, -0.954021, -0.375777, 0.841765, -0.856366, 0.567179, 0.383154, -0.0485863, 0.769447, 0.745171, -0.0168871, -0.0165586, 0.366951, -0.885342, 0.295681, 0.442752, 0.569382, 0.188754, 0.925391, 0.926269, -0.0831557, -0.0906291, 0.0837925, -0.132331, -0.790258, -0.00290623, -0.731187, -0.414185, 0.236357, -0.285091, 0.4061, 0.856454, -0.474863, -0.962813, -0.469574, 0.026441, -0.247342, 0.91621, -0.101582, 0.128871, 0.678455, -0.241897, 0.22134, -0.410095, -0.606598, -0.276852, -0.868596, 0.29476, -0.41612, 0.637077, 0.993554, 0.74432, 0.951072, 0.0282594, -0.172766, 0.716866, -0.569193, -0.0556174, 0.823845, 0.793099, 0.799408, -0.308787, -0.0944431, -0.625816, -0.440697, -0.00982538, -0.245175, 0.221362, 0.531658, 0.567883, 0.691882, 0.888672, 0.517893, 0.41054, -0.0182009, 0.792274, 0.598956, -0.9592, -0.631355, 0.268026, -0.581309, -0.480375, -0.0152159, 0.43452, 0.735136, -0.542524, -0.429698, 0.875461, 0.921695, 0.620743, 0.878875, -0.225551, -0.705808, 0.848446, 0.888366, -0.900287, 0.93991, -0.585157, 0.0273529, -0.650875, -0.129287, -0.826586, -0.962421, 0.153856, 0.846441, 0.503629, 0.41475, -0.00352575, -0.071349, -0.801635, -0.999647, 0.455167, 0.138714, -0.936274, -0.492338, -0.603535, -0.113886, 0.219612, -0.649498, 0.0335796, 0.0990543, 0.819916, 0.682745, 0.277148, -0.803697, 0.0350883, -0.649147, 0.63715, 0.925302, -0.46912, -0.114524, -0.566162, 0.329675, 0.0301938, 0.623839, -0.670503, 0.818543, -0.0573092, 0.584859, 0.47444, 0.279017, -0.137812, -0.856325, 0.0765842, 0.99788, -0.884858, -0.234608, -0.780106, -0.630221, 0.660399, -0.749104, 0.268565, -0.572697, 0.908344, -0.610099, -0.517339, -0.285154, -0.746026, 0.628413, 0.470809, 0.0139652, -0.802363, 0.777398, 0.746468, 0.606808, 0.346488, -0.767791, -0.151835, -0.147642, 0.116913, 0.306443, 0.58746, -0.738527, 0.14889, 0.558374, 0.610683, 0.981461, 0.319366, 0.461565, 0.445258, -0.60347, 0.389254, -0.363757, -0.337131, -0.325532, 0.0600522, -0.785552, -0.917281, 0.434261, 0.934217, -0.0263308, 0.365603, -0.545934, 0.867938, 0.798354, 0.284881, 0.249323, -0.0772805, 0.763674, 0.980179, -0.768002, 0.280847, 0.851935, -0.682849, 0.997714, -0.470138, -0.0716239, 0.577311, 0.801712, 0.0236041, -0.114196, 0.289063, 0.664646, 0.501537, -0.476367, 0.280895, -0.296872, -0.175174, -0.502677, -0.059736, -0.362567, -0.731572, 0.734409, 0.969001, -0.735575, -0.398821, -0.980201, -0.270793, -0.402542, 0.530681, -0.151745, 0.220491, -0.637681, 0.0790371, 0.966808, -0.496305, 0.309038, 0.990209, 0.679497, -0.10228, -0.690226, -0.638158, 0.941086, -0.721912, 0.80976, 0.656054, -0.816508, -0.382713, 0.623618, -0.0412568, 0.659816, -0.735477, 0.297642, 0.0565119, -0.648172, -0.564943, -0.366326, 0.360289, 0.7919, -0.153433, -0.812947, 0.953302, 0.274945, 0.0171294, 0.407173, 0.0350078, -0.665502, -0.3929, -0.284003, -0.351678, 0.252156, -0.352682, 0.588869, 0.168701, -0.786417, -0.90726, -0.371836, 0.129674, 0.469749, 0.503581, -0.265824, 0.855218, 0.419852, -0.312928, 0.146301, 0.408754, 0.283196, -0.295812, -0.217329, 0.0382448, 0.508122, 0.990593, -0.524488, -0.216437, 0.665152, 0.879962, 0.411384, 0.854321, 0.591184, -0.401739, 0.792217, -0.00395951, 0.827287, -0.172986, -0.613519, -0.342395, -0.219789, -0.672185, 0.609705, 0.67302, 0.809111, 0.00845638, 0.197473, -0.0078044, -0.793209, 0.944102, 0.224646, -0.419848, 0.82089, -0.237299, -0.0895024, 0.245109, -0.462684, 0.988829, -0.779263, -0.536633, 0.722403, -0.193406, 0.0204323, -0.994285, 0.691983, 0.843257, -0.753808, 0.855846, 0.444865, 0.802777, 0.219687, -0.583928, -0.130465, 0.501696, 0.421629, -0.860794, -0.509239, 0.335406, 0.360397, -0.142309, -0.663686, 0.0709567, 0.788444, -0.801467, -0.80618, -0.539443, -0.0493252, -0.619389, 0.671345, 0.0245567, -0.500408, -0.486693, -0.0293596, -0.50583, -0.727971, -0.594975, -0.0830223, -0.91645, 0.108652, -0.0877349, -0.690586, 0.10474, 0.593527, -0.463238, 0.796277, -0.615857, -0.227138, -0.206461, -0.826953, 0.782555, -0.27038, 0.0789417, 0.789369, 0.742451, -0.0852659, -0.991431, 0.587643, -0.0351866, 0.792455, 0.494257, 0.269322, -0.940591, -0.372186, -0.813963, -0.212108, -0.962239, -0.229298, -0.954535, 0.161216, -0.738122, -0.619756, -0.199472, -0.811207, 0.0314951, -0.661138, -0.216805, -0.364457, 0.368866, 0.314675, 0.249099, -0.982738, 0.334679, 0.707989, -0.696214, -0.0482856, -0.279041, 0.0589157, 0.67578, -0.810847, -0.122862, 0.283119, 0.636822, -0.908134, -0.775589, -0.014694, -0.678366, -0.799778, 0.520891, 0.0837299, -0.502257, 0.123732, 0.594827, 0.01552, 0.319971, -0.0613383, 0.29457, 0.677643, -0.0243415, -0.463401, -0.799072, -0.767194, -0.696779, -0.622513, -0.436434, 0.276583, -0.0932693, -0.207013, -0.759307, 0.826591, 0.70211, -0.667314, 0.0612715, 0.299674, 0.981023, -0.25933, 0.202641, -0.339266, -0.827731, 0.988633, 0.0723558, 0.281756, -0.958059, 0.399123, 0.821145, -0.687167, 0.16772, 0.893116, -0.101896, -0.85896, -0.327924, -0.282827, -0.649228, -0.911142, 0.193428, -0.80364, 0.638741, 0.46738, -0.450454, -0.743041, 0.492855, 0.420514, 0.444649, 0.502299, 0.70997, 0.806075, -0.195299, -0.872925, -0.920847, 0.252082, 0.457267, -0.816317, -0.517027, -0.562873, -0.620029, 0.243441, 0.597442, 0.812338, 0.457989, 0.089079, -0.0362353, 0.497053, 0.17524, 0.00240645, 0.466067, 0.393027, -0.502362, -0.981004, 0.0837983, -0.860557, 0.689756, -0.76486, 0.885955, 0.763213, -0.0289987, 0.0202604, -0.174408, -0.570406, -0.782253, -0.125088, 0.4111, -0.096755, 0.737674, -0.886268, -0.440368, -0.960267, -0.446362, -0.0706184, -0.81117, 0.0489563, -0.813099, 0.348641, 0.40768, -0.208279, -0.141656, 0.946904, 0.736198, -0.996742, -0.302082, -0.732629, -0.655153, 0.204778, 0.40049, -0.981967, -0.543489, -0.273696, -0.442036, 0.190389, -0.566273, -0.79558, -0.949168, 0.723178, 0.456365, 0.617144, -0.766333, 0.408227, 0.782654, 0.216436, 0.860241, 0.646505, -0.359236, -0.0563452, 0.687114, -0.478849, 0.0122569, 0.34297, -0.00775422, 0.167719, -0.272762, -0.231402, -0.0864598, -0.665204, -0.392983, -0.429179, 0.84089, 0.0650543, -0.807549, 0.257626, -0.6965, -0.415387, 0.613929, 0.914772, -0.98121, 0.754995, -0.597076, -0.60294, -0.157738, 0.509218, 0.0180061, 0.502069, -0.105131, 0.887267, -0.404816, 0.681618, -0.517416, -0.876951, -0.13479, -0.716592, -0.0389359, 0.489389, -0.338134, -0.629616, -0.619312, -0.548939, 0.349065, -0.570244, -0.150406, -0.862252, 0.112641, 0.652659, -0.0573349, 0.148713, 0.793589, -0.121392, 0.290875, 0.518561, -0.224866, 0.428283, 0.955177, 0.873691, 0.197405, 0.639497, 0.505664, 0.543099, -0.528248, -0.122933, 0.514433, -0.169731, 0.544041, 0.623061, -0.119318, -0.979795, -0.123035, -0.123047, 0.124737, 0.882708, -0.420116, 0.444575, -0.109152, -0.840234, 0.514326, 0.808093, -0.471165, -0.646629, 0.992896, 0.995435, -0.984391, 0.841035, 0.93401, 0.569453, 0.579545, -0.599933, -0.949015, 0.70186, 0.971562, 0.365911, 0.965334, 0.559851, -0.0638338, -0.79609, 0.0232919, 0.367764, -0.962985, 0.376586, -0.290094, -0.516001, 0.807522, 0.779445, -0.608874, -0.951362, -0.739686, 0.911821, -0.839004, 0.0102081, 0.741976, -0.409584, 0.233696, -0.836568, -0.0912475, -0.16861, 0.496035, 0.679982, -0.578957, -0.74955, -0.772612, -0.807419, -0.0108566, 0.48622, -0.2331, 0.304531, -0.272786, -0.422425, -0.209232, -0.602344, 0.105405, -0.260415, 0.50047, -0.445052, 0.248531, 0.28144, 0.462474, -0.868955, -0.583803, -0.60573, -0.913329, 0.991632, -0.524919, 0.687076, 0.939203, -0.885461, 0.809159, 0.380999, -0.901378, 0.895408, -0.489147, -0.527809, 0.212346, -0.505471, 0.312438, -0.575255, 0.545006, -0.256711, -0.458578, -0.244041, -0.72929, -0.986737, 0.31957, -0.606576, -0.667674, 0.294955, -0.0550261, 0.464232, -0.336028, -0.622034, -0.554228, 0.205236, 0.321118, 0.101065, 0.716409, 0.663882, -0.419546, 0.384733, -0.344067, -0.467322, -0.878244, 0.162218, -0.490286, -0.624121, 0.254726, 0.374758, -0.847912, 0.450639, 0.316788, 0.827357, 0.234977, -0.477628, -0.102757, 0.105431, -0.984956, -0.709469, 0.709649, -0.474435, 0.436609, -0.60982, 0.115649, -0.116387, -0.131767, 0.525415, -0.0397729, 0.848059, 0.829818, 0.0408298, 0.676432, 0.823203, 0.556425, -0.152479, -0.111031, 0.113136, 0.53997, -0.697264, -0.422805, -0.638172, -0.0485103, 0.134414, -0.534453, -0.588015, -0.43008, 0.220778, 0.522369, -0.599895, -0.548137, -0.826355, 0.417538, -0.0520399, -0.828387, 0.957387, -0.64741, 0.864952, -0.84302, -0.872044, 0.180548, -0.950285, -0.233279, 0.0735229, -0.674007, 0.70675},
-	{0.43438, -0.806538, -0.27347, -0.443657, -0.712462, 0.656229, 0.385429, 0.573273, -0.270891, -0.99397, -0.676457, -0.851759, -0.472335, 0.14777, 0.489966, 0.283496, -0.759191, -0.817412, 0.271643, -0.664176, 0.0472051, -0.608082, 0.69866, 0.061555, -0.116471, 0.294972, 0.826594, 0.0314396, 0.953486, -0.858499, 0.328512, 0.98579, 0.915843, -0.0701168, -0.891191, -0.160993, 0.602322, -0.798314, -0.358586, -0.745911, -0.00850254, -0.0557012, 0.132326, 0.205856, -0.247943, 0.279423, 0.17436, -0.71044, -0.20932, 0.508176, -0.727046, 0.0435421, -0.648798, 0.300104, 0.594613, -0.863059, 0.681832, -0.492073, -0.125099, 0.116536, -0.558188, -0.846486, -0.588195, -0.061728, -0.210079, 0.835408, -0.34346, 0.0200261, 0.518116, 0.762763, 0.982864, -0.504357, -0.978981, 0.517356, 0.939799, 0.898563, 0.776253, -0.648931, 0.0478591, 0.022828, 0.114561, 0.263692, 0.0781171, -0.21675, -0.757315, 0.825096, 0.0581243, 0.771238, -0.916921, 0.809466, 0.00361821, 0.177315, 0.607137, -0.964909, -0.974158, -0.0839679, -0.343609, 0.738683, 0.945164, -0.936248, 0.455634, 0.841592, 0.755127, 0.760717, 0.628451, -0.247989, 0.210154, 0.977881, 0.908023, -0.950784, -0.951156, -0.448189, 0.924698, -0.659224, -0.770149, -0.414659, -0.118284, 0.73385, 0.791524, -0.647792, 0.00128304, -0.744789, -0.201246, 0.187363, 0.711759, 0.750558, 0.0836885, -0.315547, -0.669005, -0.696342, -0.227896, 0.988546, -0.227904, -0.967509, 0.598818, 0.490423, 0.307778, 0.236999, -0.514381, -0.794849, -0.768008, 0.12235, 0.35936, -0.284488, 0.188128, 0.7544, 0.326293, -0.216402, -0.434499, 0.395646, -0.0876505, -0.817323, 0.962968, -0.849436, -0.632877, 0.120063, -0.457685, -0.117324, 0.0191958, 0.385498, -0.00028982, -0.203539, -0.863041, 0.606552, -0.830389, 0.129814, 0.968798, -0.30601, -0.307082, -0.297823, 0.852919, -0.186471, -0.0429391, -0.207976, -0.865003, 0.4984, -0.840837, 0.549685, -0.300361, -0.323823, -0.443358, -0.530804, 0.332518, -0.386716, -0.13712, 0.724059, 0.121178, -0.215788, 0.0870493, -0.448266, -0.776338, 0.0982083, -0.335813, -0.884175, 0.128835, 0.684016, -0.423885, 0.294625, -0.370724, 0.670455, -0.949231, -0.0841299, 0.270319, -0.0668381, 0.194743, 0.453176, -0.832828, 0.623433, 0.318159, -0.0929268, -0.38961, 0.114801, 0.433016, 0.254542, 0.955205, -0.107567, -0.468896, 0.276797, -0.274062, 0.270865, 0.631292, -0.219952, 0.253213, -0.293494, 0.589141, -0.718971, 0.173793, -0.210948, -0.596019, 0.0241307, -0.0823916, 0.876484, 0.125419, 0.448712, -0.557363, -0.686918, 0.582639, 0.664444, -0.340405, 0.973447, 0.99007, -0.741131, 0.102606, 0.767378, 0.823383, -0.921336, 0.954606, -0.532044, 0.281689, -0.613738, -0.445042, -0.18486, -0.831183, 0.652423, -0.948758, 0.79538, 0.395227, 0.192435, -0.62306, -0.159622, -0.67369, 0.932532, 0.9113, 0.298653, 0.855823, -0.256673, -0.478942, -0.0762523, 0.557326, -0.0893067, -0.244305, 0.259716, 0.705769, -0.189879, -0.220882, 0.449473, -0.399028, 0.0212676, 0.117108, 0.855296, -0.13528, 0.593012, 0.534984, -0.623898, -0.0407689, -0.217892, -0.959148, 0.965174, -0.142987, 0.505277, -0.0619544, -0.846088, -0.282202, 0.0650531, 0.524503, -0.861712, 0.509719, -0.852374, 0.320376, -0.00700972, -0.0261432, 0.772157, 0.718995, -0.949748, 0.150378, -0.331009, 0.558291, 0.768695, -0.563388, 0.854863, -0.187891, 0.0881295, 0.628336, -0.542778, -0.620773, -0.497587, -0.0573709, 0.162488, 0.253291, -0.377256, -0.877656, -0.238761, -0.902835, 0.270036, 0.695639, -0.946273, -0.118261, 0.0410538, 0.333534, 0.615305, 0.0598563, 0.829862, -0.921354, -0.816971, 0.831842, -0.74657, 0.152109, 0.89638, 0.91498, -0.437038, 0.577889, 0.816769, -0.290649, -0.928636, -0.145598, 0.0123781, -0.892998, 0.548134, -0.968953, 0.535562, 0.604349, 0.937766, -0.0420101, 0.306076, 0.285881, 0.522849, 0.135963, 0.289513, 0.75074, -0.759046, 0.559943, 0.506268, 0.434161, 0.628123, 0.349205, 0.927903, 0.257726, 0.881079, -0.926413, -0.595151, -0.792248, 0.856047, 0.686525, -0.218321, -0.125276, 0.876363, 0.0178653, -0.880327, -0.853926, 0.523995, 0.583514, -0.391624, 0.181423, 0.752923, -0.262353, 0.57258, 0.149864, -0.564562, 0.523534, -0.334556, 0.632376, -0.141835, 0.458108, -0.323435, 0.000579173, -0.380544, 0.44251, 0.878537, 0.991807, 0.263502, 0.991357, 0.230908, -0.729011, 0.315372, -0.661044, 0.442556, 0.0857901, -0.407193, -0.640032, -0.457323, -0.525975, 0.916785, -0.17826, 0.642884, -0.832238, -0.250409, 0.47915, 0.617297, -0.305274, -0.119389, 0.925568, -0.834792, -0.200381, -0.389327, 0.976957, -0.485129, -0.261328, 0.376386, 0.683252, 0.756953, 0.102301, 0.498865, -0.344817, -0.677258, -0.272852, -0.0572951, -0.798845, 0.912694, 0.358964, -0.149442, 0.805435, 0.931671, -0.771495, 0.633612, 0.930301, 0.0368857, 0.763006, -0.825339, -0.525182, -0.951404, 0.775734, -0.164724, -0.746951, -0.488289, 0.467703, 0.994663, -0.708487, -0.983514, 0.452782, 0.236893, 0.916129, 0.0453337, -0.579504, -0.555915, -0.269429, 0.0525821, -0.298844, -0.229187, -0.657937, -0.528818, -0.276109, 0.365047, 0.713052, -0.282173, 0.438578, 0.201346, 0.796853, -0.0847534, 0.46322, -0.272449, -0.443846, 0.467529, 0.966934, -0.676122, -0.473498, 0.37461, 0.666237, 0.00201003, -0.119815, -0.595642, -0.987384, -0.771471, -0.318489, -0.109606, 0.230491, -0.748786, -0.940285, -0.239054, -0.902923, 0.916918, 0.171266, -0.973018, 0.972051, -0.0218445, -0.27738, 0.450388, 0.589026, 0.244241, -0.206059, 0.265119, 0.32563, -0.00442537, -0.791742, 0.223101, -0.652915, -0.00910539, -0.244338, 0.510698, -0.250825, 0.253284, 0.654129, -0.00701086, -0.821112, 0.886901, -0.396775, 0.175215, -0.420148, 0.0569466, 0.203857, -0.0123561, -0.56562, 0.505666, -0.76251, -0.810222, -0.353575, -0.535649, 0.307746, 0.436179, 0.301432, -0.196987, -0.649749, 0.217818, 0.324135, 0.102135, 0.673599, -0.54583, 0.618497, -0.980986, 0.0642247, 0.720828, -0.807, -0.952728, 0.151746, 0.323065, -0.825742, -0.605983, 0.0232171, 0.039529, 0.649163, -0.509226, -0.862121, 0.951986, 0.193493, -0.00756954, 0.32092, -0.798302, 0.722269, -0.0402282, 0.355204, -0.207535, 0.0235206, 0.358105, -0.94249, -0.89138, -0.817922, -0.167719, 0.515528, -0.510062, -0.308429, 0.487553, -0.608693, -0.0685759, 0.177564, -0.10968, -0.904776, 0.143663, 0.939878, 0.772453, -0.159661, -0.519381, -0.162604, 0.0632609, -0.491309, 0.667282, -0.681648, -0.511432, -0.793295, -0.380115, -0.0465969, 0.580177, -0.247717, -0.350038, 0.264642, -0.169087, -0.705728, 0.336254, -0.611854, -0.234489, 0.442213, 0.798243, -0.470319, -0.75152, -0.617894, -0.280086, 0.108076, 0.891902, -0.17421, -0.56134, 0.501228, 0.938413, -0.354862, -0.733899, 0.181209, -0.775811, -0.798606, -0.982406, -0.688934, 0.921357, -0.101612, -0.521068, 0.293262, -0.0233108, 0.100894, 0.262247, 0.945545, -0.357145, -0.592934, -0.704733, -0.0256674, 0.584368, 0.461778, 0.510835, 0.190779, -0.757216, 0.552896, 0.743221, -0.768095, -0.103132, 0.559437, 0.884145, -0.49339, 0.986131, -0.267902, 0.300007, 0.18798, 0.661524, -0.868496, 0.401588, -0.195508, 0.463151, -0.255715, 0.118016, 0.944925, -0.53802, -0.53338, -0.235889, 0.558944, 0.557619, -0.210043, -0.942377, -0.28524, -0.0903884, -0.986781, -0.238578, -0.092097, 0.26012, -0.00704911, 0.0952166, -0.418737, 0.933657, -0.253678, -0.455554, 0.511869, 0.107071, 0.997309, 0.628817, -0.805255, 0.93253, 0.540805, 0.472971, -0.684774, -0.155892, 0.923023, -0.130388, -0.619283, -0.956082, 0.413063, -0.961811, -0.879558, -0.545206, 0.790107, 0.919557, 0.967268, 0.91, 0.496516, -0.469198, 0.974318, -0.0263287, -0.918505, -0.194772, 0.875574, -0.686593, -0.393276, -0.935813, 0.837769, 0.714695, -0.16725, -0.00938273, -0.854133, -0.183522, 0.85461, -0.598281, 0.336881, 0.0161286, 0.471101, 0.436028, -0.367685, -0.344293, 0.543401, 0.0261968, -0.884753, -0.926574, 0.748296, -0.979831, 0.6108, 0.798265, 0.627885, -0.389596, 0.881524, -0.768671, 0.790029, 0.778385, 0.941837, 0.103735, 0.544196, 0.891988, 0.993988, 0.682474, -0.12567, 0.381964, -0.349586, -0.512255, 0.275154, -0.752469, 0.0435448, -0.327542, -0.283005, 0.886451, -0.757957, 0.250235, 0.436232, -0.34736, -0.708205, -0.351366, 0.162009, -0.16048, 0.532432, 0.973285, -0.844436, 0.890174, 0.652341, -0.443528, 0.116906, -0.22239, -0.895005, 0.591255, -0.0513365, 0.0591939, -0.715619, -0.869701, -0.301647, 0.0887671, -0.926681, -0.0235052, -0.0132015, -0.0142806, -0.368736, -0.927936, -0.112031, -0.746622, 0.354786, 0.0926385, 0.0199287, -0.870159, 0.512613, -0.289694, 0.940903, 0.0385144, 0.26524, 0.287967, -0.083412, -0.541301, 0.626554, 0.290705, 0.934322, 0.630154, -0.799657, -0.430009, -0.27407, 0.579232, -0.54131, 0.412323, -0.597565, 0.560311, -0.424384, -0.0711322, -0.146327, -0.550453, 0.77443, -0.0736762, 0.253748, 0.443946, -0.993274, -0.471491, -0.349053, -0.451969, 0.00510047, 0.71942, 0.373959, -0.0307673, 0.81196, -0.167779, -0.00602367, -0.484083, -0.483844, -0.353658, -0.0715074, 0.538871, 0.102344, -0.684819, 0.677125, -0.67319, -0.287854, 0.196048, -0.569833, 0.487655, 0.551845, -0.836369, -0.108399, -0.765524, 0.5332, -0.319178, -0.90835, 0.619633, -0.759459, -0.42164, 0.403438, 0.689805, 0.650432, -0.908841, -0.725947, 0.416785, -0.831474, -0.764791, -0.19852, -0.576897, 0.820063, -0.0645898, 0.929161, 0.172098, -0.201549, 0.398407, -0.194069, 0.952373, 0.195419, -0.426312, 0.698015, -0.224052, -0.542658, -0.234761, 0.0512588, 0.485042, 0.410956, 0.775413, -0.248098, -0.587734, 0.341418, 0.327681, -0.124889, -0.887042, 0.824928, 0.338557, -0.0467599, -0.84285, -0.585413, 0.624331, 0.252559, 0.907822, 0.882571, -0.527228, 0.926476, -0.285823, -0.182227, 0.542927, 0.092543, -0.85555, 0.0763886, -0.10892, -0.561985, -0.986076, -0.626825, -0.664441, -0.666747, 0.275563, 0.445631, -0.700225, 0.360435, 0.491831, 0.331446, -0.00126989, 0.620155, -0.0737662, -0.261732, 0.791227, 0.828204, -0.0657157, -0.919363, 0.92518, -0.723796, -0.213277, -0.667184, 0.0876616, 0.38619, 0.906112, -0.35576, -0.20747, -0.384043, -0.639947, -0.879914, 0.78828, -0.480419, -0.65991, -0.162565, -0.852219, -0.601376, -0.196901, 0.58883, -0.543722, 0.828736, -0.926692, -0.512614, -0.728127, -0.881837, -0.620677, 0.838996, 0.44197, 0.522056, 0.0700681, -0.980392, 0.519058, -0.419409, 0.0548369, 0.0482201, 0.30745, 0.536186, 0.624133, -0.793444, -0.329786, -0.675995, 0.600681, -0.973121, -0.00433329, 0.265828, -0.401496, 0.684036, 0.894614, -0.0891697, -0.19465, -0.0397643, 0.450301, 0.854455, 0.0728673, -0.901165, 0.169785, -0.975705, -0.871369, 0.893766, 0.916459, 0.821515, 0.188986, 0.284153, -0.578274, -0.283099, -0.551163, 0.771108, -0.0738043, -0.122069, 0.650734, 0.467465, -0.467416, -0.610065, 0.820997, -0.266167, 0.32763, -0.736679, -0.711647, -0.146436, -0.932505, -0.188237, 0.253642, 0.8645, 0.312914, 0.573544, 0.890886, -0.0573527, -0.503572, 0.570913, 0.985664, -0.882967, 0.720758, 0.0137022, -0.457679, 0.582877, 0.522634, -0.298244, -0.302735, -0.376169, -0.0501349, -0.453277, 0.198681, 0.0705737, -0.96071, 0.0267233, -0.445916, -0.448687, 0.207866, 0.273095, 0.155454, -0.730341, -0.588324, 0.86064, -0.226678, 0.270209, 0.919226, 0.85169, -0.938574, -0.0445885, 0.634046, 0.325018, 0.847791, 0.0859386, 0.301717, 0.293836, 0.507894, 0.306481, -0.286505, 0.431041, -0.16444, -0.89848, -0.531409, -0.839958, 0.310019, 0.870693, -0.618831, -0.930782, 0.21545, 0.644894, 0.624039, -0.367039, 0.0336149, 0.837465, 0.54881, -0.308539, -0.788842, -0.604398, 0.793402, 0.564645, -0.840769, -0.863617, -0.392351, 0.112852, 0.824906, 0.638593, 0.838309, -0.195353, 0.413604, 0.649537, -0.435077, -0.429259, -0.444698, 0.789009, 0.900639, -0.92371, -0.205659, -0.848407, 0.324858, 0.752112, 0.550937, -0.0134506, -0.870385, 0.383038, 0.257183, -0.376677, -0.498775, -0.686808, -0.236323, -0.265964, -0.576689, -0.331331, 0.5724, 0.630081, -0.212504, 0.812967, -0.87468, -0.816998, 0.427883, 0.440547, 0.314991, 0.101826, -0.34707, 0.256077, 0.774941, 0.588659, 0.565836, -0.958076, -0.325123, 0.254002, 0.512373, 0.998757, 0.959074, 0.376722, 0.831057, 0.328619, 0.189082, -0.0231899, 0.255043, 0.662412, -0.902514, 0.55755, -0.246989, -0.657573, 0.216957, -0.211704, -0.814528, 0.425713, -0.528891, 0.12242, -0.2547, 0.783384, 0.795298, -0.724194, -0.720923, 0.965372, 0.206056, 0.414306, -0.528179, 0.756443, -0.91044, 0.85975, 0.145392, 0.391864, 0.263948, -0.0663179, 0.841103, 0.210537, 0.872371, 0.0227104, 0.902475, 0.670929, 0.0450242, -0.421236, 0.524539, -0.166178, -0.674935, -0.801398, -0.664536, -0.386171, -0.0467719, -0.698444, 0.977379, -0.389077, 0.751658, -0.8705, 0.248518, 0.965914, 0.962528, 0.132036, -0.527301, 0.0520391, 0.833926, 0.833874, 0.133733, -0.772607, -0.326713, -0.433332, 0.725256, -0.736492, 0.440641, -0.230575, 0.967601, 0.401237, 0.845472, 0.138388, -0.241796, -0.646628, 0.0774674, -0.364913, 0.875398, 0.613071, -0.275664, -0.839682, -0.636922, -0.468535, 0.150964, -0.387168, 0.273944, 0.235193, 0.386992, -0.426008, -0.107675, -0.502145, -0.784604, -0.237036, -0.65294, 0.24374, 0.875932, -0.44069, 0.113616, 0.887333, -0.993927, -0.272752, -0.50298, 0.646292, -0.736329, -0.648415, -0.34775, -0.627819, -0.433453, -0.0254255, -0.574835, 0.809487, 0.696491, 0.362041, -0.295382, 0.90154, 0.310004, 0.488421, 0.00988683, 0.865723, 0.313787, 0.347906, 0.712122, 0.495236, 0.807256, -0.298401, 0.249401, 0.35619, 0.335897, -0.474268, -0.605914, -0.21711, -0.117788, -0.551246, 0.655438, -0.506909, 0.821024, -0.968897, -0.129744, 0.700268, -0.825597, -0.780169, 0.773051, -0.570855, 0.232565, 0.412057, -0.636009, -0.170299, -0.834441, 0.751505, 0.35981, 0.394474, 0.345299, -0.170617, -0.762098, -0.756938, -0.978835, 0.130391, 0.0149519, -0.0958749, -0.430975, -0.526842, -0.273165, 0.865057, -0.204802, -0.960878, 0.763181, 0.3945, -0.358765, 0.600207, 0.792134, -0.536051, 0.657297, -0.697692, 0.994431, -0.70116, 0.0351395, 0.790774, 0.00741674, 0.323869, -0.613362, -0.899566, -0.391322, 0.609938, 0.929459, 0.817153, -0.116022, 0.997745, -0.810788, -0.638901, -0.742011, 0.67498, 0.301809, 0.50272, 0.305595, -0.78956, -0.363209, 0.575957, 0.501779, 0.927139, 0.864255, 0.823336, 0.414223, 0.931343, -0.506736, -0.381641, 0.188594, 0.333044, 0.389209, 0.0558477, -0.484266, 0.297735, -0.41729, -0.561244, -0.628033, 0.164943, -0.202912, -0.467123, -0.55622, 0.292081, 0.636156, 0.309282, -0.519232, -0.0267596, -0.828124, -0.0603079, 0.180804, 0.0889011, -0.0399862, -0.660635, -0.738121, 0.0981884, 0.602257, 0.41537, 0.0348682, -0.520144, 0.579912, 0.00621262, 0.424012, -0.870627, -0.350028, 0.160094, 0.962593, -0.6641, -0.116594, 0.0404757, -0.290921, -0.755945, -0.869851, 0.197484, -0.700991, 0.761904, -0.579062, -0.419424, 0.763734, 0.412136, 0.7049, -0.250844, 0.875364, 0.945751, -0.590583, 0.0897818, -0.926862, -0.293171, 0.707599, 0.117767, -0.663462, -0.853551, -0.354304, -0.338663, 0.43457, 0.931662, -0.246058, -0.618969, 0.246818, -0.139203, -0.994208, -0.199593, -0.965135, -0.352296, -0.245349, 0.229565, 0.0374675, 0.374439, 0.82629, 0.957465, 0.690922, 0.928083, 0.110944, 0.921797, 0.289848, -0.466613, 0.438437, 0.0623006, -0.946975, -0.245783, 0.607499, 0.279014, -0.406595, 0.322962, -0.42244, 0.284405, -0.935551, 0.797598, 0.106663, -0.958175, 0.536741, 0.162382, 0.50719, 0.383369, 0.432377, 0.182767, -0.0668343, 0.0982662, -0.554577, -0.680533, 0.106955, -0.409937, 0.805809, 0.385051, -0.565267, 0.603744, 0.0542773, 0.0451558, 0.709932, 0.934034, -0.556055, -0.241081, -0.785473, 0.522926, -0.16804, -0.0408916, -0.871464, -0.730033, 0.385647, -0.709771, -0.630036, -0.782622, 0.35716, 0.412349, 0.666437, -0.127258, 0.959299, -0.741912, 0.455534, -0.468543, 0.0650337, 0.485699, 0.78006, 0.134726, 0.637941, -0.0636082, -0.325419, 0.322569, -0.0825099, 0.110541, -0.526752, 0.255412, -0.0759198, -0.509717, -0.513475, 0.00940979, 0.491648, 0.516924, 0.197044, 0.54235, -0.973178, -0.216521, -0.745536, -0.130583, 0.880338, -0.0671662, 0.361155, -0.17281, -0.585842, 0.449215, 0.29539, 0.676112, 0.715794, 0.388206, -0.265722, 0.946538, -0.0525272, 0.645233, -0.0296919, 0.252598, 0.355404, 0.511177, 0.713359, 0.718805, 0.0686813, 0.429609, -0.973137, 0.0172962, -0.284586, 0.70251, 0.444648, -0.778635, -0.999108, -0.602184, -0.722661, 0.920081, -0.397055, 0.580207, 0.337694, 0.715338, -0.806574, 0.105188, 0.129475, -0.922982, -0.59083, 0.485079, -0.0735114, -0.699464, 0.429127, 0.517381, 0.435985, 0.158145, -0.879851, -0.148333, 0.531823, 0.953978, 0.62463, 0.70735, 0.317398, -0.455208, 0.250919, 0.959417, 0.657084, -0.108505, -0.544682, 0.351295, 0.383642, 0.612023, 0.317806, -0.729249, 0.027919, -0.0972634, -0.484052, -0.426696, 0.0998683, 0.651206, 0.189448, 0.261964, 0.838579, -0.567165, -0.625337, -0.0722728, 0.152643, 0.483131, -0.0323636, -0.970585, 0.145374, 0.202793, -0.0903162, -0.518393, 0.580704, -0.434425, 0.736972, 0.320912, 0.0185803, 0.628486, -0.727489, 0.46165, 0.321274, -0.971827, -0.946407, 0.692857, 0.694806, 0.996314, -0.630759, 0.156531, -0.695323, 0.399894, 0.0921163, 0.381314, -0.999194, 0.15173, 0.804957, -0.142939, -0.843066, 0.875617, -0.476027, -0.252274, -0.899495, 0.460349, 0.677294, -0.681518, 0.0398963, -0.538705, 0.866212, 0.419955, -0.476059, -0.691021, -0.84355, -0.393388, 0.0346106, 0.364885, -0.828265, -0.222716, -0.800525, 0.196093, -0.325936, -0.395735, 0.640982, 0.480964, 0.652386, 0.150617, 0.881272, 0.724849, -0.175415, -0.613235, 0.973101, -0.60434, -0.859269, 0.358055, -0.304444, 0.148065, 0.499977, 0.575807, -0.799692, -0.814558, -0.504909, -0.55543, -0.351894, 0.782533, 0.510144, 0.987697, 0.971303, 0.113211, -0.317087, 0.415695, -0.288436, 0.891864, -0.234862, 0.755388, -0.994672, -0.615789, 0.937765, 0.922795, 0.553347, 0.287893, 0.442969, -0.930524, 0.942796, -0.231726, -0.683473, 0.173928, 0.879113, -0.862479, -0.515555, -0.823493, 0.475473, -0.237607, -0.841705, 0.466116, 0.741503, -0.534752, 0.389218, 0.0155971, 0.418208, -0.392315, -0.186805, -0.111047, 0.24738, -0.631888, -0.499585, -0.686541, -0.380774, 0.294215, 0.953718, 0.497383, -0.951899, 0.172984, 0.767376, 0.977142, 0.680311, -0.982427, 0.655617, -0.400444, 0.482864, 0.583996, 0.216048, 0.18407, -0.513072, 0.238377, 0.679589, -0.5081, 0.302584, 0.682914, 0.315662, -0.881317, -0.83318, 0.876224, 0.670561, -0.528791, -0.92152, -0.3447, 0.146105, -0.248467, -0.797405, -0.513206, 0.63983, -0.939967, -0.0294786, 0.910791, -0.317197, -0.861149, -0.814502, -0.620014, 0.371896, -0.799455, 0.250974, 0.205722, -0.828582, 0.780404, -0.948305, -0.031924, -0.943607, -0.274148, -0.474512, -0.957644, 0.817162, 0.0673527, -0.130626, 0.349505, 0.788979, 0.122507, 0.663733, -0.757269, -0.647976, -0.592456, -0.956917, 0.805739, -0.600735, 0.561422, 0.126898, -0.164998, -0.491636, -0.941264, 0.161059, 0.406484, -0.35014, 0.396332, 0.465619, -0.877207, 0.633141, 0.228653, 0.216846, -0.597832, 0.650792, 0.137275, -0.255326, -0.0754103, -0.00601526, -0.553841, 0.208843, -0.0274211, -0.0560558, -0.139018, 0.236087, -0.403786, -0.243896, -0.979515, 0.525431, -0.959511, 0.751024, 0.706704, -0.800324, -0.296863, 0.873672, 0.421746, -0.0677526, -0.634329, 0.936442, -0.446482, 0.170196, -0.48513, -0.405254, -0.730219, 0.0111532, -0.736103, 0.68327, 0.929509, 0.930166, 0.352328, 0.830077, -0.00706815, -0.979739, 0.755951, -0.231544, -0.617638, -0.35211, 0.678148, 0.330687, 0.996802, 0.709987, 0.788456, -0.92939, 0.0230659, 0.367028, 0.769886, -0.219662, -0.635315, -0.331946, 0.373056, -0.583924, 0.872184, -0.403151, -0.872782, 0.236991, 0.515407, 0.465907, -0.626256, -0.560626, -0.963145, -0.884825, 0.724205, -0.899825, 0.154688, 0.473274, -0.112108, -0.164387, -0.303938, 0.052845, -0.228289, 0.327432, -0.206746, -0.751686, -0.513044, -0.502511, 0.265016, -0.184182, -0.603784, -0.375692, -0.838775, 0.795924, 0.401287, 0.0999925, 0.1515, -0.2198, 0.272686, 0.22388, -0.73527, 0.290469, 0.202013, -0.768368, 0.0588771, -0.589847, 0.988977, -0.309875, 0.261938, -0.597611, -0.58244, -0.982924, 0.747397, 0.584086, -0.124711, -0.0333372, 0.105895, -0.657517, 0.290522, 0.995533, 0.282412, 0.718419, 0.104359, 0.0719902, -0.30371, 0.258816, -0.184339, 0.278588, 0.377597, -0.780302, 0.117096, 0.652988, -0.295745, -0.5352, -0.00661067, 0.886424, -0.554191, 0.115718, -0.0750279, -0.633055, -0.84214, -0.213478, 0.82265, -0.776561, 0.989741, -0.99618, 0.640466, 0.484585, 0.778277, -0.357035, 0.174541, -0.350021, 0.0736744, -0.254655, 0.644402, 0.602464, -0.934578, -0.786014, -0.778239, 0.56974, -0.895842, -0.485824, -0.0443406, -0.95374, -0.582645, -0.326765, 0.143812, 0.598138, 0.0777359, -0.901674, 0.225242, 0.171031, -0.848281, 0.611111, 0.189244, 0.0326251, 0.827596, -0.722379, -0.975704, 0.338942, -0.511986, -0.00368375, -0.167261, -0.321863, -0.163095, 0.639304, -0.342357, 0.177567, 0.546474, 0.349634, 0.246721, 0.364668, 0.100009, 0.0340677, -0.737485, -0.96996, 0.0847959, -0.49466, -0.888705, 0.356932, 0.543752, -0.24004, 0.128164, -0.556092, -0.986185, -0.830175, -0.356108, -0.913247, -0.828106, -0.59617, -0.370713, -0.324435, -0.150005, -0.954547, -0.0409891, 0.886257, 0.786314, 0.256138, 0.167302, -0.0927776, 0.170897, 0.414844, 0.511152, -0.320455, 0.245906, 0.405469, 0.554701, 0.389611, 0.602229, 0.636788, 0.992324, 0.185787, 0.372002, 0.670856, 0.628675, 0.715387, -0.0149943, 0.0234009, -0.0957705, 0.331439, 0.691648, 0.336661, 0.481206, 0.727084, -0.752033, -0.843265, -0.426545, -0.710232, -0.202982, 0.557918, -0.540625, -0.88359, 0.397851, 0.714844, 0.474289, -0.00338581, -0.0820985, 0.301919, 0.300341, 0.688588, -0.856579, -0.812992, -0.353011, -0.732749, -0.393069, 0.17542, -0.521192, -0.0771306, -0.682118, 0.327601, 0.159777, 0.706651, 0.987806, 0.8949, 0.627544, -0.882822, -0.520516, 0.0871022, 0.427181, 0.22854, 0.061122, 0.978617, -0.088907, 0.520782, 0.448983, 0.402584, -0.89596, -0.0478337, -0.391986, 0.199718, -0.0601919, -0.14046, 0.23012, -0.424071, 0.00557977, 0.752322, -0.317764, -0.638158, 0.893218, 0.914218, -0.730948, 0.708872, -0.615138, -0.160177, 0.103157, 0.464039, 0.162743, 0.859527, 0.53826, -0.315281, -0.754888, -0.723644, 0.775231, 0.856834, 0.197005, 0.888643, 0.669248, -0.663798, -0.513074, -0.662011, 0.915181, 0.923158, 0.277474, 0.526057, -0.673198, -0.776727, 0.622331, -0.66002, 0.801656, 0.103314, 0.369283, 0.374165, 0.17577, 0.109824, -0.184172, 0.466772, 0.0134536, 0.696866, 0.811344, -0.413376, 0.0878006, -0.303033, -0.526931, 0.0163594, -0.992703, 0.993948, 0.857482, 0.880771, -0.979668, 0.81275, 0.210407, -0.311811, -0.361577, 0.858244, -0.875642, -0.443951, 0.0396016, 0.350148, 0.767474, 0.264713, 0.692904, 0.823039, -0.846432, 0.644838, -0.550951, -0.937295, -0.570437, 0.062637, 0.867173, 0.307309, 0.735892, -0.619103, -0.425632, 0.517554, 0.897334, -0.917709, 0.69559, 0.510283, 0.656759, 0.223443, -0.445265, 0.179149, -0.6514, 0.921367, 0.228161, -0.562898, 0.373114, -0.678729, -0.400011, -0.734026, -0.574413, -0.0396374, 0.0784981, 0.851678, 0.963409, 0.856178, -0.528237, -0.866712, -0.340715, 0.937744, 0.173198, -0.19677, 0.594327, 0.675597, -0.0873205, 0.20322, -0.294204, -0.864702, -0.553464, -0.6871, 0.151304, -0.555307, 0.598548, 0.769599, -0.794973, 0.166037, -0.986448, 0.285672, 0.281968, -0.174716, 0.592782, 0.0497838, 0.751801, 0.143196, 0.630384, 0.605913, -0.442226, 0.463594, -0.0761654, 0.7917, -0.249122, -0.735981, -0.00557779, -0.317031, -0.308262, -0.479901, -0.616327, 0.459654, 0.767154, -0.293075, -0.00157045, -0.90109, 0.798889, -0.565588, -0.846041, -0.449118, -0.900939, -0.410745, 0.120453, 0.823592, 0.244675, 0.00986524, -0.114672, -0.155809, 0.822283, 0.431164, 0.679851, -0.812454, -0.950253, -0.572435, -0.466302, 0.920095, -0.884275, -0.849497, -0.506608, -0.820866, 0.5044, -0.177855, 0.872886, 0.437319, -0.593882, 0.681457, 0.881209, 0.908643, -0.508601, 0.0449388, 0.31335, -0.0150322, -0.137495, -0.0647532, -0.369849, -0.667434, -0.267742, 0.292916, -0.393894, -0.127968, -0.373098, 0.946662, -0.252648, 0.592052, -0.0607954, 0.907393, 0.589562, -0.00980494, -0.280394, -0.65316, 0.627675, 0.375822, -0.439555, 0.327796, 0.753036, 0.461075, 0.0603792, -0.227635, -0.73635, 0.797694, -0.58143, -0.954658, -0.219314, -0.563636, -0.0896029, -0.770438, 0.775816, -0.185386, -0.844473, 0.347127, 0.83061, -0.171995, -0.656401, 0.135712, -0.0509948, 0.698049, 0.24345, -0.955103, 0.373232, 0.167435, -0.19145, -0.773345, -0.734862, -0.170162, -0.91068, -0.932839, 0.378358, -0.521633, -0.490284, -0.7315, 0.166328, -0.0280371, 0.716717, 0.206218, -0.0541335, 0.667016, -0.296371, -0.211989, -0.667827, -0.461922, -0.166853, -0.923634, 0.497654, -0.929382, 0.482295, 0.162858, 0.443247, -0.0648308, 0.0587014, -0.702878, -0.506146, 0.523387, -0.394217, 0.295881, -0.100477, 0.584456, -0.294317, -0.532065, -0.441873, 0.693823, -0.506086, -0.107541, -0.13631, -0.580287, -0.94502, 0.989896, 0.359122, -0.632115, 0.281966, 0.748888, -0.848795, 0.557166, -0.628274, 0.263035, -0.962403, 0.365131, 0.736307, 0.582143, 0.865696, -0.108304, 0.294404, 0.470367, -0.535409, -0.803319, 0.880831, 0.584527, 0.374953, -0.675455, -0.675415, 0.0297853, -0.0465408, 0.707383, 0.965376, -0.336135, -0.11627, -0.645032, 0.378253, 0.437633, 0.402787, -0.0877932, -0.285997, 0.20097, 0.898868, -0.628118, 0.0103788, 0.406143, 0.902051, 0.707595, -0.0882757, -0.83621, 0.505128, -0.356433, -0.893488, -0.699364, -0.619473, 0.549462, -0.268037, 0.462526, 0.555359, -0.67976, 0.349878, -0.784268, -0.56256, -0.00852826, 0.371153, 0.501718, 0.59594, 0.141535, 0.465482, 0.39653, 0.0635125, -0.713659, 0.859118, -0.597858, 0.280753, 0.601085, -0.813659, -0.60594, -0.779844, -0.448491, 0.340652, 0.565639, -0.465949, -0.149927, -0.151744, -0.235118, 0.369002, -0.84315, -0.812302, 0.617683, 0.982806, -0.330128, 0.546891, 0.771737, -0.778418, -0.121742, -0.66171, 0.326698, 0.338145, 0.836841, 0.506775, -0.508056, -0.696756, 0.867487, -0.793063, -0.252129, -0.631284, -0.848748, -0.992171, 0.291301, -0.269465, 0.854766, -0.276769, -0.245177, 0.0315679, 0.631103, 0.78614, -0.00952126, -0.0447122, -0.280722, -0.600348, 0.0451108, -0.584939, -0.0856268, -0.541195, 0.804556, -0.731697, 0.216717, 0.850973, -0.144609, -0.20608, -0.12949, -0.444499, 0.260242, -0.257475, -0.639697, -0.738499, 0.126175, 0.066206, 0.684002, -0.803813, -0.582381, 0.664216, -0.773412, 0.854253, -0.534977, 0.722114, -0.710828, 0.814786, -0.944391, -0.976278, 0.779937, 0.435007, 0.561527, -0.860663, 0.403837, 0.464953, -0.71245, 0.450111, -0.576385, 0.224355, -0.0317292, 0.215561, 0.575932, -0.129559, -0.881919, -0.76085, -0.911239, 0.955606, 0.012101, -0.690559, 0.417605, -0.194958, 0.600321, -0.0848663, 0.269466, 0.23221, 0.862648, -0.972546, -0.327075, 0.383343, -0.873885, -0.635576, -0.896817, -0.798301, 0.277407, -0.54709, 0.739659, -0.0774889, 0.104603, 0.0882948, 0.361869, 0.260723, 0.542774, 0.370777, -0.0761023, 0.0361952, -0.79439, -0.16917, 0.88741, 0.807447, 0.184181, -0.766808, 0.442177, 0.892871, -0.331939, -0.747408, 0.866261, -0.57738, 0.0384355, -0.99323, -0.872022, -0.575269, -0.435935, -0.952521, 0.335782, 0.870863, -0.700973, -0.714353, -0.373655, 0.865548, -0.909745, -0.403026, 0.444158, -0.649377, -0.00584441, -0.41671, 0.922969, 0.713111, -0.410917, -0.0388227, 0.621978, -0.735211, -0.613292, -0.301694, -0.837103, -0.493363, 0.686023, -0.61119, 0.428476, -0.715765, 0.997328, -0.00396409, 0.982292, 0.733584, -0.677561, -0.688717, -0.209609, -0.651176, -0.363953, 0.477644, 0.970643, -0.203669, 0.0402841, -0.0505209, 0.364711, 0.0786735, -0.155204, 0.479473, -0.36873, 0.704096, 0.239412, 0.395251, 0.363259, -0.194419, -0.375182, 0.446675, -0.435212, -0.259783, -0.879882, 0.280431, 0.738973, 0.541217, -0.468433, 0.462263, 0.643124, -0.208863, -0.0577667, -0.0161814, 0.410098, 0.0184581, 0.879663, -0.215557, 0.324184, 0.344014, 0.0416644, -0.235014, -0.315277, 0.991822, 0.638889, 0.605798, -0.3684, -0.553382, 0.69718, 0.72483, -0.949672, 0.514395, 0.101916, 0.701493, 0.25364, 0.535946, 0.942946, -0.287412, 0.49805, 0.329076, -0.65262, -0.869418, -0.370408, -0.0307994, 0.14365, -0.664784, -0.633551, 0.594956, -0.0377127, -0.0689951, 0.102139, -0.257891, 0.250671, 0.124254, -0.0492704, 0.906145, 0.915078, -0.232937, -0.986085, -0.924749, 0.377215, 0.00285777, -0.516461, 0.646738, -0.284386, -0.52, 0.389002, -0.57385, -0.87053, -0.0220575, 0.0249114, -0.531682, 0.868588, 0.237159, 0.872088, -0.985605, -0.513198, 0.678278, 0.639724, -0.0761588, 0.436194, -0.518874, 0.346011, -0.123066, 0.465636, 0.236126, -0.872714, -0.247977, -0.124116, -0.113761, -0.508188, -0.638573, -0.913113, -0.967025, 0.24702, -0.335055, 0.683333, -0.426505, 0.603986, -0.367266, -0.731965, -0.940318, -0.890752, 0.916406, -0.509756, -0.750216, 0.828977, -0.505996, -0.429467, 0.181459, -0.0541537, 0.47716, -0.845918, -0.150464, -0.543696, 0.564132, -0.627182, -0.971022, 0.718123, -0.127918, -0.828334, 0.307165, -0.0880152, 0.902878, 0.787518, -0.767792, 0.732939, -0.320434, -0.614127, 0.942027, -0.130695, -0.925197, -0.690481, 0.0104532, -0.694386, 0.362285, -0.151482, -0.0826255, -0.302254, -0.713699, 0.446958, -0.945368, 0.963273, 0.641818, 0.414703, 0.0161855, -0.651765, 0.633984, 0.709761, -0.0442513, 0.730141, 0.643796, 0.396977},
-	{0.705114, -0.661097, 0.190484, 0.289739, -0.841387, 0.76618, -0.736131, 0.0931, 0.215402, 0.0717579, -0.872978, 0.805885, 0.75333, 0.752767, 0.173935, -0.987328, -0.00645751, 0.988615, 0.366754, 0.399965, 0.490202, -0.552056, 0.288579, -0.952512, -0.356575, -0.144186, 0.709027, 0.62242, -0.975599, -0.815971, 0.166283, 0.484805, 0.121463, -0.792091, 0.425044, -0.488188, 0.657318, -0.286712, -0.911538, -0.129842, 0.964888, -0.420083, -0.57919, -0.574947, 0.458165, 0.448348, 0.303826, -0.635413, 0.569924, -0.176006, -0.784608, -0.23029, 0.222091, 0.752901, 0.616478, -0.376665, 0.437469, 0.215455, 0.727949, 0.858663, 0.882891, -0.444429, 0.231981, 0.867331, -0.905149, -0.748725, 0.160268, 0.918903, -0.656833, -0.915814, 0.551927, 0.984209, -0.883987, 0.562876, -0.552056, 0.448773, -0.65444, 0.505593, 0.554415, 0.434556, -0.422148, 0.576279, 0.126631, -0.968843, 0.126764, -0.695064, 0.051935, -0.296768, 0.859139, -0.16785, 0.744242, 0.668488, -0.553324, 0.886803, 0.558724, -0.0878653, -0.620736, 0.324098, -0.322579, 0.875649, 0.29638, -0.957364, 0.91418, -0.231206, 0.433507, 0.518301, -0.80388, -0.53907, -0.766718, -0.684898, -0.75587, -0.788725, 0.411225, -0.641332, 0.376026, -0.584753, -0.23398, -0.534334, 0.856508, -0.921516, -0.999857, -0.915762, -0.476551, 0.908445, 0.596947, 0.676828, -0.260887, -0.556597, 0.938193, -0.827995, -0.0635944, -0.203829, 0.281905, -0.149381, 0.222087, -0.578385, -0.805743, -0.876004, -0.837189, 0.248262, 0.419557, -0.112131, -0.00304189, 0.876102, 0.467482, 0.0242333, 0.620441, 0.265298, 0.66844, -0.713399, 0.1994, -0.939444, 0.726722, 0.407703, 0.0335121, 0.671524, 0.110307, -0.025405, 0.523672, 0.870548, 0.991722, 0.429699, -0.104572, 0.864966, 0.976104, -0.661275, -0.0692088, 0.0197891, 0.560306, 0.364364, -0.811272, -0.715543, 0.992947, 0.612626, 0.531199, -0.428721, -0.935261, 0.581721, 0.730894, -0.655086, 0.447222, -0.368898, 0.612203, -0.231283, -0.140889, -0.216253, 0.252862, -0.132787, 0.614617, -0.135394, -0.0711348, 0.436531, -0.80887, -0.941648, -0.527522, 0.291485, 0.994509, 0.878474, 0.915707, -0.00969565, 0.464833, 0.709231, 0.472708, -0.554693, 0.225963, -0.549634, 0.0334742, 0.395938, 0.680984, 0.279472, 0.729854, 0.84771, 0.925105, 0.477981, -0.933879, 0.916961, 0.603709, -0.96996, 0.80492, 0.682241, 0.67375, -0.0839375, 0.221348, 0.153253, -0.435237, -0.227895, -0.966768, 0.267838, -0.0998376, 0.681786, 0.00165142, 0.164684, -0.34758, -0.193383, 0.405151, -0.708084, 0.267399, -0.981872, -0.19301, 0.380814, 0.909288, -0.185086, -0.463481, -0.336828, -0.154653, 0.748714, -0.148247, -0.578489, 0.610563, 0.0466058, -0.796965, 0.594294, 0.77899, -0.999585, 0.929365, 0.695377, -0.0672985, 0.443332, 0.814988, -0.265048, -0.140651, -0.614941, 0.801552, -0.262025, -0.272822, 0.13465, -0.573324, -0.973312, -0.223953, -0.148729, 0.508965, -0.514225, 0.344797, 0.0135249, -0.476383, -0.489993, -0.538793, 0.931462, -0.879637, 0.275546, 0.658764, -0.425307, 0.743787, -0.959055, -0.663129, -0.598304, -0.0602042, 0.0217054, -0.0286809, -0.147167, -0.342472, -0.737066, 0.753109, -0.388173, 0.736428, 0.38326, -0.41274, -0.781515, -0.439516, -0.292141, 0.380203, -0.884432, 0.190885, 0.804203, 0.644569, 0.115311, -0.469507, 0.0654559, 0.997579, 0.560503, 0.38752, 0.371599, -0.331583, -0.935956, -0.203857, -0.859301, -0.164512, -0.268432, -0.876405, -0.708329, 0.237297, -0.595996, 0.935499, -0.680252, -0.202904, -0.275405, 0.834345, -0.0456826, 0.928967, -0.317483, -0.749256, 0.287388, -0.150091, -0.903157, -0.134604, -0.497547, -0.0841775, -0.969693, -0.132053, 0.887981, -0.622756, -0.202203, -0.546263, 0.874004, -0.632915, 0.430455, -0.81713, -0.968315, -0.722672, 0.826648, 0.850672, -0.604877, -0.241507, 0.284166, -0.506821, -0.774643, -0.160991, -0.239122, 0.799066, -0.598893, -0.771669, -0.664474, -0.449984, 0.557345, 0.933188, 0.256704, -0.837581, -0.5418, -0.708782, -0.881527, 0.1449, -0.0630794, -0.499509, 0.330674, -0.922588, 0.808542, 0.0174865, -0.268877, 0.880253, -0.832792, 0.989645, -0.710834, 0.368926, 0.149609, -0.022809, 0.917692, 0.478599, -0.642524, 0.292144, 0.65395, -0.152305, -0.496569, 0.134056, 0.954428, 0.76688, -0.454117, 0.146784, -0.098476, 0.610177, -0.346796, -0.290224, -0.988621, -0.136934, 0.734957, 0.37683, -0.258946, 0.876835, -0.974381, -0.741481, -0.93029, -0.975272, -0.206324, 0.836649, -0.420152, 0.551626, -0.227759, 0.865531, -0.884644, 0.506133, -0.835797, -0.0884945, -0.0612658, -0.452505, -0.313273, 0.0655379, 0.988072, 0.281135, 0.265865, 0.167978, -0.947073, 0.166807, 0.169505, 0.960588, 0.313092, 0.597568, 0.568819, -0.415521, -0.411597, 0.139142, 0.773712, -0.808381, -0.604242, 0.0861821, 0.93665, -0.0616903, 0.610772, 0.89066, -0.596479, 0.833011, 0.644565, 0.0828459, -0.770983, 0.91349, -0.343112, 0.140685, 0.0401051, -0.980877, 0.15375, 0.390481, 0.121444, 0.936681, 0.459345, 0.919272, 0.64093, 0.666618, 0.327941, -0.301311, -0.0289896, -0.98139, 0.155902, -0.155312, -0.185395, -0.692167, 0.697436, 0.773999, -0.901716, 0.978801, -0.780412, -0.518709, -0.1209, -0.464526, 0.261088, 0.960617, 0.720829, -0.645373, -0.77937, -0.448386, -0.117543, 0.102556, -0.571244, 0.297066, 0.456498, 0.32242, 0.0147141, 0.647923, -0.587244, -0.59665, 0.839919, -0.208275, 0.905941, 0.481892, 0.0128003, 0.038412, 0.696636, 0.0478799, -0.303284, -0.309238, -0.137256, -0.70761, -0.301725, 0.585813, -0.0551718, 0.426056, -0.0127775, -0.893577, 0.999275, 0.64692, -0.668264, -0.515434, -0.914859, -0.0481216, 0.377709, 0.0824215, 0.925675, 0.286645, -0.142034, -0.950396, -0.958074, -0.12239, -0.767336, -0.610116, 0.0326323, -0.571975, -0.219712, 0.35376, 0.504817, 0.924194, -0.535265, -0.95177, 0.787945, -0.972622, 0.696472, 0.276054, -0.133084, -0.711467, 0.779775, 0.624885, 0.952777, -0.0311231, 0.137084, 0.210515, 0.24149, 0.566502, -0.808655, -0.52562, 0.99092, -0.556328, 0.0420186, 0.765492, -0.0917489, -0.244012, -0.936965, -0.891541, 0.0833653, -0.0557758, 0.953886, 0.795403, 0.569173, -0.462054, 0.59333, -0.359654, -0.796333, 0.898349, 0.406908, 0.531205, 0.28871, 0.207542, -0.0799534, -0.156009, 0.0428668, -0.95302, -0.406309, -0.981075, -0.596425, -0.406976, -0.673091, 0.290184, 0.805884, -0.684019, 0.583108, -0.372322, 0.910186, 0.729984, 0.958084, -0.235104, -0.827049, -0.262692, -0.550912, 0.252912, 0.497769, -0.291834, 0.986503, -0.667031, 0.980929, -0.59396, -0.909826, -0.239349, 0.229037, -0.77191, 0.660113, 0.85563, 0.293433, 0.517976, -0.382603, -0.444042, -0.341664, -0.601178, -0.00346857, 0.986683, 0.159733, 0.267254, 0.532561, -0.808068, 0.621813, 0.328508, -0.586677, -0.114856, -0.95376, 0.689235, -0.781756, 0.154776, 0.937787, -0.861144, -0.686336, 0.307307, -0.705712, -0.350202, -0.326922, -0.217097, -0.181361, -0.472709, 0.298334, 0.190129, 0.167183, 0.512918, -0.427365, -0.233892, -0.685561, 0.340807, 0.535087, -0.875245, -0.265332, -0.713537, -0.912674, 0.0611747, 0.94327, 0.888063, -0.980297, -0.0734724, 0.545089, 0.37458, -0.277776, 0.0293754, 0.757716, 0.841411, 0.800709, 0.508722, 0.0511723, -0.715103, 0.473568, 0.751545, 0.292088, 0.19232, 0.249001, -0.528268, 0.919809, -0.941432, 0.509926, 0.856957, 0.285067, -0.939584, 0.10146, 0.45824, 0.137028, -0.567207, 0.432235, -0.448235, 0.107389, 0.70104, 0.364206, 0.677727, 0.519882, -0.748001, -0.918729, -0.814074, -0.738824, 0.258669, 0.792784, -0.70106, 0.221859, 0.194612, 0.734458, 0.108836, -0.405206, 0.859222, -0.561571, 0.0933233, 0.0566601, -0.27002, 0.139055, -0.626579, -0.423014, 0.362465, -0.694641, -0.907139, -0.913411, -0.930592, 0.995852, -0.239836, 0.64189, 0.619268, -0.227213, 0.324863, -0.402256, -0.537861, 0.857037, 0.848419, 0.377355, 0.595393, -0.479063, 0.619048, 0.680677, -0.249703, 0.355895, 0.0556282, 0.881809, -0.974337, 0.389225, -0.869557, -0.364595, 0.852707, 0.231552, -0.452299, 0.122914, -0.532355, 0.208989, 0.398846, 0.271704, 0.136379, -0.44552, 0.537469, 0.62699, 0.632017, -0.510196, -0.252306, -0.640959, -0.397715, 0.917429, -0.419551, -0.976491, -0.336747, -0.414886, 0.321404, 0.900909, -0.260304, 0.257401, -0.273739, -0.272176, 0.023201, -0.673753, -0.490476, -0.704861, 0.437977, 0.343303, 0.817889, -0.721077, -0.715961, -0.754394, 0.564484, 0.22472, 0.346862, -0.783295, 0.999458, 0.736276, -0.294526, 0.720509, 0.56755, -0.196692, -0.81043, -0.357966, 0.0495445, -0.803168, -0.677634, -0.889978, -0.513661, -0.805738, -0.650454, 0.743651, 0.808604, 0.499406, 0.564855, -0.290534, 0.0698467, 0.829478, 0.659218, -0.318412, 0.62283, 0.897014, 0.894119, -0.132589, 0.638568, -0.0610803, -0.766213, 0.47464, 0.677296, 0.638018, -0.783985, -0.824907, 0.462309, 0.584245, -0.177845, 0.22892, 0.0094056, -0.532318, -0.197084, 0.986163, -0.386698, -0.346934, -0.0916375, -0.524642, 0.540041, 0.261234, 0.519845, 0.583109, -0.100989, 0.520441, -0.435624, -0.0388939, 0.102817, 0.956796, -0.12405, 0.0476212, 0.821064, 0.256331, -0.194162, -0.595131, 0.607674, 0.615608, -0.0814782, 0.334637, 0.08518, -0.280761, -0.566058, 0.228455, -0.720651, 0.752406, -0.85232, -0.037615, -0.00720536, 0.880444, 0.594775, -0.955057, 0.633514, -0.997292, 0.103664, 0.363613, -0.934262, 0.0797407, 0.24987, -0.506797, 0.940554, -0.735257, 0.607579, -0.125463, 0.256935, -0.802504, -0.856495, -0.806376, 0.00192853, -0.843987, 0.736306, -0.332821, -0.37905, 0.653816, -0.227612, -0.792179, 0.612993, 0.626095, -0.329688, -0.65317, 0.666943, 0.39546, 0.107923, 0.978729, 0.77024, -0.274538, -0.0226588, -0.631568, 0.428805, -0.10946, -0.298716, 0.297633, 0.318316, 0.569377, 0.916142, -0.15185, -0.139281, -0.580077, 0.0784409, -0.456675, 0.458615, -0.492634, 0.364763, -0.641965, 0.304455, 0.654992, -0.0463741, 0.647425, -0.690551, -0.0216381, 0.109746, 0.185589, -0.702723, 0.114243, -0.788813, -0.476384, -0.578915, 0.889322, 0.846963, -0.152032, -0.618468, -0.449562, 0.484243, -0.987636, -0.736445, 0.890266, 0.975584, 0.0403643, 0.955606, 0.706759, -0.706425, 0.55713, 0.689764, -0.861523, -0.845986, 0.848081, -0.129847, -0.583968, 0.534613, 0.177412, 0.813969, 0.54105, -0.525599, -0.333233, 0.486448, 0.97794, 0.114898, -0.209022, -0.52651, -0.477943, -0.496192, 0.260931, 0.392888, 0.083235, -0.411311, 0.998817, 0.499012, -0.642898, -0.892904, -0.0409458, 0.643925, 0.319807, -0.892845, -0.963281, -0.353599, 0.753413, -0.749737, -0.553676, 0.315225, 0.889545, -0.877886, -0.830482, 0.755582, 0.0897054, -0.914868, 0.169804, -0.623639, 0.846935, 0.796939, 0.442621, -0.079665, 0.818872, 0.929474, -0.668246, 0.621681, 0.596772, -0.247764, -0.10683, 0.317439, -0.866328, 0.790156, 0.462312, 0.016207, 0.541167, 0.337011, 0.0314792, 0.673646, 0.337833, -0.24624, 0.276581, -0.984709, 0.0482462, -0.739192, 0.894574, 0.80563, 0.0921584, -0.0561639, 0.671255, 0.408613, 0.172555, -0.451395, 0.682477, -0.556935, -0.650527, 0.787019, 0.088309, -0.489488, 0.285432, 0.751918, 0.359512, -0.726924, 0.260559, 0.493316, -0.746856, -0.633958, 0.291344, -0.951596, -0.42568, 0.516109, -0.353339, -0.425382, 0.1345, 0.770926, -0.638009, -0.22797, -0.961333, 0.866499, -0.917235, 0.0227295, 0.688024, -0.393469, -0.0511508, -0.829967, -0.638549, 0.622522, -0.613545, 0.0571353, -0.856317, 0.465106, -0.754914, 0.969734, 0.557372, 0.423225, -0.322217, -0.90158, 0.762424, 0.17075, -0.309938, 0.598972, -0.467806, -0.785914, -0.324253, -0.88235, -0.810542, -0.398299, -0.686857, 0.165392, -0.2577, 0.605383, 0.900731, -0.48492, -0.0409934, -0.363125, -0.856905, 0.629369, 0.170699, -0.13916, -0.394353, 0.586369, -0.322565, -0.143838, -0.0487428, -0.0942023, 0.0885879, -0.124093, 0.607696, 0.61848, 0.738116, 0.971629, 0.133969, 0.139686, 0.773231, -0.909619, -0.946397, 0.726288, 0.954641, -0.436039, 0.511421, -0.895953, 0.681823, 0.453904, -0.725885, -0.235384, -0.0113991, -0.0415042, -0.182516, 0.767466, -0.0516255, -0.659467, 0.193384, -0.833565, 0.344357, -0.59, -0.884431, -0.327444, 0.892735, 0.832154, 0.490706, 0.673734, -0.404751, -0.558717, -0.122479, -0.83659, 0.66592, 0.756392, -0.234152, -0.141375, -0.490791, -0.234007, -0.0459603, 0.244353, -0.439098, 0.0724469, -0.574396, -0.54633, -0.173532, -0.712013, 0.800959, 0.210406, 0.116007, -0.750416, -0.383269, -0.624842, 0.858844, 0.557216, -0.206884, 0.732348, 0.609175, 0.336211, -0.340213, -0.63882, -0.973131, -0.896628, 0.694981, 0.861059, -0.311421, -0.106654, -0.151642, -0.240103, 0.0683791, 0.605466, 0.162387, 0.518108, 0.81942, 0.0108397, 0.21437, 0.563928, 0.377828, -0.452422, 0.52636, 0.539005, -0.453699, 0.143678, 0.00083068, 0.943398, 0.630199, -0.269303, 0.541473, -0.84698, -0.544712, -0.459353, 0.316012, 0.324887, -0.331555, -0.360284, -0.130406, 0.332795, 0.390831, -0.834838, -0.928154, -0.635149, 0.888788, -0.698829, 0.604313, -0.0862908, -0.935678, -0.575685, 0.775057, -0.39961, 0.131975, -0.356727, 0.474392, 0.196737, -0.181038, 0.211586, -0.445977, -0.362962, -0.733816, -0.584589, 0.848984, 0.871235, 0.317694, -0.472425, 0.531262, 0.345396, 0.572166, 0.600449, -0.35873, -0.399253, -0.101097, -0.629949, -0.3672, 0.414198, 0.0460617, -0.952607, -0.613763, 0.90064, -0.380764, -0.0225726, -0.959409, 0.663704, -0.983913, 0.853807, -0.961913, -0.0414433, 0.889815, -0.332501, 0.909377, 0.461473, -0.241523, 0.870678, 0.186291, 0.450439, 0.196362, -0.645099, 0.294839, 0.746887, 0.975218, 0.741982, 0.974948, 0.128309, 0.933131, 0.117249, 0.307309, -0.0855597, -0.285638, -0.843413, -0.848883, 0.031749, 0.745279, 0.897184, -0.281425, 0.835176, -0.523385, -0.133293, -0.927488, -0.952682, 0.325518, -0.804316, 0.0684901, -0.266481, -0.86615, -0.371473, -0.502133, 0.0166834, 0.818699, -0.248348, -0.489928, 0.716783, -0.925962, -0.980301, 0.685492, 0.981001, -0.877027, -0.618372, -0.00151718, -0.680612, -0.306645, 0.480136, 0.721011, 0.534715, 0.64004, 0.711044, 0.641668, 0.34967, 0.252489, -0.451804, -0.903236, 0.621988, 0.00412363, 0.178451, 0.0731911, -0.0828846, -0.290929, 0.688646, 0.420148, 0.717042, -0.747719, 0.650876, -0.0219685, 0.906913, 0.310783, 0.967889, 0.972839, 0.413168, 0.542031, -0.747716, -0.268327, -0.74886, -0.205915, 0.816893, 0.119903, -0.990793, -0.6418, -0.785009, -0.598862, 0.2377, 0.962766, -0.544887, 0.598809, 0.0393449, 0.861001, 0.842116, 0.839043, 0.0469066, 0.593258, -0.92336, -0.954441, -0.282742, -0.352189, -0.570176, -0.300568, -0.888119, 0.967137, 0.764449, 0.224397, -0.396119, 0.862225, 0.271788, 0.860327, -0.823746, -0.974049, -0.0264997, -0.598302, 0.0404339, 0.693219, 0.900604, 0.29494, -0.16936, -0.310645, -0.257021, 0.936832, -0.291734, 0.687752, 0.509096, -0.253775, 0.482908, -0.0748436, -0.439535, -0.605276, -0.422876, 0.324382, 0.879256, -0.38884, -0.340439, -0.591623, 0.582579, 0.914378, 0.934766, 0.191304, -0.138793, -0.480231, 0.26881, -0.906786, 0.449341, 0.173547, 0.20699, 0.278183, 0.307485, 0.223253, -0.682382, -0.453926, 0.895943, -0.526763, -0.951406, 0.0722643, -0.140315, 0.903837, -0.236172, 0.0440529, -0.890702, -0.519065, -0.18844, -0.708153, 0.648837, -0.683864, 0.569367, -0.815065, -0.673956, -0.894266, -0.84164, 0.320588, 0.358986, 0.212426, -0.229451, 0.579086, -0.0468411, -0.78931, -0.305855, -0.546016, -0.701367, -0.81516, -0.834994, -0.535468, 0.944906, 0.181643, -0.523288, 0.812137, 0.709534, -0.204426, -0.663463, 0.00166819, -0.674962, 0.982494, -0.591985, -0.128277, 0.452818, -0.226413, -0.983063, -0.994638, -0.311028, 0.75579, 0.636272, 0.0984956, -0.673327, -0.481573, 0.259096, -0.629579, 0.00378715, -0.976324, -0.468086, -0.300409, 0.0982927, 0.414908, 0.356624, -0.0773865, -0.753125, 0.34543, 0.341857, -0.0184483, 0.402762, -0.636353, -0.68797, -0.717116, 0.0127847, -0.77711, 0.0211159, 0.596841, 0.155701, -0.246185, 0.696904, 0.597526, 0.450157, -0.395616, -0.661133, 0.554112, 0.618275, -0.568897, -0.752143, 0.343211, -0.840228, 0.89285, 0.890247, 0.247266, 0.697958, 0.746172, 0.90148, -0.964734, -0.227281, -0.394047, -0.142158, 0.619831, -0.778257, -0.619033, -0.836395, -0.572719, 0.56949, -0.739197, -0.659324, 0.431177, -0.0518966, -0.0510425, -0.363084, 0.945411, -0.677435, -0.995087, 0.715944, 0.204432, -0.394326, 0.150299, 0.885575, 0.0258366, 0.911262, -0.0842506, -0.0804073, -0.926472, 0.661807, 0.972513, 0.812502, 0.0473522, 0.696362, 0.800687, 0.28002, -0.78306, 0.644095, 0.521, 0.825428, 0.528335, 0.74385, -0.212332, 0.279101, -0.223488, -0.989635, 0.640514, 0.468532, 0.139592, -0.905324, 0.803242, -0.00530332, 0.266657, -0.815255, -0.526043, -0.418786, -0.994246, -0.470884, -0.46985, -0.894834, -0.768712, -0.431637, 0.355955, 0.590506, -0.00608715, -0.526141, -0.266749, -0.390844, 0.149143, -0.519291, -0.520613, 0.354514, 0.631223, 0.710821, 0.600198, 0.675545, -0.51859, 0.00388741, 0.747854, -0.25334, 0.992393, 0.260112, 0.510179, -0.720415, -0.724287, -0.88979, -0.752736, -0.707115, 0.831207, 0.0787938, -0.226298, -0.752247, -0.992444, 0.0377751, 0.631314, 0.640515, 0.43498, -0.832383, 0.77263, -0.943297, 0.231349, -0.816642, 0.851332, 0.856019, 0.191623, 0.601169, 0.399167, 0.255962, 0.623011, 0.873702, 0.636044, -0.44349, 0.564905, -0.586396, -0.217063, 0.548621, 0.892487, 0.649067, 0.802268, -0.795718, 0.66216, -0.596242, -0.211074, -0.760006, 0.90839, -0.135264, -0.839074, -0.398569, -0.329418, 0.373908, 0.492746, 0.181684, -0.0580316, -0.57733, 0.785537, -0.0951819, 0.892253, 0.736459, 0.54852, -0.840875, -0.947447, 0.675486, 0.308287, 0.780074, 0.647089, 0.4557, -0.400304, 0.252427, -0.727027, 0.431136, 0.155069, -0.0172483, 0.941285, 0.356729, 0.461268, -0.970133, 0.547881, 0.528818, 0.12019, 0.283754, 0.249525, -0.752885, -0.522967, -0.0952881, 0.334506, 0.406285, -0.109668, 0.31116, 0.747128, 0.498584, -0.499036, -0.546582, -0.721172, 0.0918831, 0.791011, -0.572885, 0.539316, -0.954344, 0.500212, -0.938922, 0.542205, -0.560028, -0.00146692, -0.395951, 0.698652, 0.929294, -0.569697, 0.0931313, -0.383095, -0.611147, -0.603995, 0.372002, -0.933056, -0.976716, 0.66199, -0.321471, -0.411582, 0.996032, -0.0714256, 0.956477, 0.246874, 0.750346, 0.710985, 0.0961617, 0.382171, -0.927217, 0.532887, -0.152381, 0.977433, -0.269123, -0.71275, -0.760175, -0.465949, -0.47731, -0.32397, 0.554046, 0.606098, -0.263226, 0.420554, -0.166899, 0.955916, -0.0462201, 0.208122, -0.000611573, 0.416922, -0.891316, 0.0972487, -0.794708, -0.683891, 0.0474185, -0.934211, -0.406834, 0.0360755, -0.442963, -0.27704, 0.796507, 0.153668, 0.807187, -0.168587, 0.388918, 0.346739, -0.538737, 0.00566145, 0.902556, -0.703882, -0.875058, 0.634344, 0.914533, 0.0434091, -0.162604, 0.759667, 0.479533, -0.94744, 0.0140832, 0.563621, -0.613638, 0.727484, -0.405913, 0.590931, -0.142869, 0.520704, -0.818967, -0.262158, 0.0457672, 0.522674, -0.124637, 0.226918, 0.962788, -0.760852, -0.644009, 0.692206, -0.97216, 0.33849, 0.407498, -0.73908, 0.720021, -0.108091, 0.950529, 0.00254837, 0.959335, -0.581601, 0.336838, 0.978772, -0.27513, -0.194901, 0.656112, -0.63625, 0.236281, -0.454358, -0.509686, 0.711393, -0.333701, -0.475336, 0.834196, 0.973967, -0.10259, -0.749476, 0.445999, 0.352568, 0.562037, 0.0993329, 0.132257, -0.909806, -0.795503, -0.701483, 0.736164, 0.410306, 0.351019, -0.930993, 0.270792, -0.347095, 0.361304, 0.982269, -0.335162, 0.10272, -0.0441448, 0.379123, 0.236492, -0.310427, 0.619431, 0.434238, -0.894272, 0.0508477, 0.788576, 0.585025, -0.695222, -0.717978, -0.508567, -0.388835, 0.94879, -0.534074, 0.586333, 0.961094, 0.646888, 0.908453, -0.470267, 0.808686, 0.0851758, 0.515194, -0.893758, -0.429385, -0.495292, -0.532034, -0.992837, -0.608945, 0.847359, 0.492888, -0.664959, -0.482913, 0.638403, -0.996391, -0.68307, -0.743596, 0.558549, 0.301945, 0.333714, -0.4386, 0.732039, -0.953481, 0.65265, 0.67376, -0.387687, 0.00884935, 0.696559, 0.275529, -0.42571, 0.925722, 0.65511, 0.711882, -0.649411, -0.286517, -0.13199, -0.333694, 0.159237, 0.968017, 0.92976, -0.407836, 0.645348, -0.0867329, 0.988984, 0.127367, 0.429054, -0.532827, 0.257738, -0.178689, 0.743048, 0.140544, 0.788012, 0.427249, -0.183632, 0.611341, 0.390994, 0.930808, -0.122429, -0.568774, 0.904136, 0.70828, 0.397079, -0.627991, -0.794115, 0.0875959, -0.494172, 0.667084, -0.983717, 0.0181268, 0.499556, -0.362754, 0.240862, -0.753932, -0.111992, -0.58165, -0.994963, 0.363963, -0.1987, -0.0330677, -0.663461, 0.743034, -0.603695, -0.0464024, -0.558638, 0.118981, -0.697192, 0.789447, 0.806886, -0.800628, 0.983725, -0.773407, 0.738898, -0.656665, 0.91852, 0.974186, -0.0301005, -0.350433, 0.693619, 0.13905, 0.22725, 0.619196, 0.306844, 0.298477, 0.931193, 0.998033, -0.226702, 0.543333, -0.719822, 0.136378, -0.36704, 0.67232, 0.04088, -0.724883, -0.319331, -0.716794, 0.845093, 0.0678968, 0.275465, 0.0886296, -0.405137, -0.0867279, 0.973686, 0.599033, 0.652538, -0.484203, -0.105274, -0.222813, -0.641206, -0.369748, -0.222052, 0.147706, -0.794302, 0.725208, 0.860939, -0.750297, 0.6584, 0.23998, 0.233452, -0.850318, -0.660544, -0.638035, -0.987745, 0.685487, 0.191199, -0.339003, -0.262273, -0.420436, 0.119183, 0.981386, 0.156287, 0.911355, 0.346534, -0.676446, 0.501557, 0.206286, -0.403767, -0.502905, 0.863098, 0.12333, -0.32379, -0.696931, -0.00369209, -0.79685, -0.0712249, -0.718289, -0.790159, -0.281435, 0.41681, -0.0562654, -0.18995, 0.81053, 0.624128, -0.935182, 0.278294, -0.72581, 0.543479, -0.570673, 0.952931, -0.267461, 0.92769, -0.876043, 0.950389, 0.390449, -0.431741, -0.959609, 0.934251, -0.556466, 0.427924, 0.755806, -0.722994, 0.0826104, 0.891778, 0.176357, 0.875322, 0.50358, -0.508365, 0.517185, -0.88955, -0.95565, 0.305805, 0.0462593, 0.161179, 0.974637, -0.595944, -0.507616, 0.701917, -0.1236, -0.31697, -0.20085, -0.534706, -0.20357, -0.278497, 0.459824, 0.159203, 0.363895, 0.654074, -0.671463, 0.854549, -0.243626, -0.649209, -0.716051, -0.862456, 0.311371, 0.0693011, 0.470104, -0.231139, 0.394084, -0.832454, 0.85473, -0.487854, -0.437569, -0.437613, 0.370934, 0.0906583, 0.805309, -0.737414, -0.0417858, 0.687977, -0.143405, 0.399678, 0.517149, 0.474457, 0.580005, 0.69372, -0.781389, 0.397687, 0.373419, -0.62206, 0.538373, -0.0349517, -0.905692, -0.955315, 0.0968818, 0.915889, 0.81417, -0.0870977, -0.433229, 0.668152, -0.776712, -0.282806, -0.591347, -0.556357, -0.0203309, 0.459285, 0.92032, -0.364719, 0.675901, -0.872098, -0.913898, -0.295765, -0.774631, -0.724272, 0.854565, -0.859587, 0.421882, -0.0744435, -0.974497, 0.494662, -0.622458, 0.0400963, 0.522542, 0.973206, -0.640492, -0.921185, 0.0426818, -0.48455, -0.251374, -0.864604, 0.923209, 0.0691316, 0.690757, -0.837445, -0.206112, -0.550713, -0.206369, 0.808087, -0.819938, -0.281652, 0.566417, 0.302549, -0.538018, -0.682369, 0.315991, -0.36555, 0.958645, 0.649922, 0.641628, -0.289503, 0.0380278, 0.495294, 0.362461, 0.908673, 0.377642, -0.987497, 0.83802, -0.664603, -0.650891, 0.246794, -0.780964, -0.428862, 0.134371, -0.378465, -0.0131581, 0.22936, 0.542762, 0.431051, 0.217254, 0.680649, 0.764851, -0.466596, -0.169385, 0.717893, 0.163876, 0.534611, -0.725437, 0.615326, 0.840591, 0.97702, -0.253306, -0.856242, -0.0117402, 0.327205, -0.518362, -0.919928, -0.0926509, -0.989077, -0.437967, 0.319842, 0.91501, -0.324735, -0.9381, 0.0527169, 0.493584, -0.723659, -0.772382, 0.50591, 0.716449, 0.942677, 0.83118, 0.510985, -0.413259, 0.751288, 0.1015, -0.369241, -0.829514, -0.828667, 0.19102, 0.805245, -0.939137, -0.630828, -0.996535, -0.977229, 0.645216, 0.840915, -0.949012, -0.603574, -0.934602, 0.527213, -0.837529, -0.123289, -0.144119, 0.714232, 0.014746, 0.882927, 0.71937, 0.213445, 0.224126, -0.00402819, -0.745274, -0.837499, 0.381665, -0.755888, -0.938381, -0.0309885, 0.965555, -0.0398212, 0.0604267, 0.0717258, -0.809122, 0.58792, 0.85737, 0.0679169, -0.0562269, -0.741059, 0.877405, 0.00220025, 0.125762, 0.478479, -0.0914244, -0.41346, 0.264748, 0.424804, -0.229276, -0.838173, -0.254237, -0.387418, -0.954904, -0.908157, 0.520877, 0.271921, 0.95524, 0.664445, 0.842464, 0.00612063, -0.35788, -0.525614, 0.971237, 0.974422, 0.275522, 0.849338, 0.164146, 0.0647476, -0.858855, 0.209753, -0.144176, 0.193741, -0.825973, -0.69672, -0.346824, -0.997126, 0.81454, -0.695357, 0.46335, 0.0705848, 0.624034, 0.47397, 0.873981, -0.435314, -0.428457, 0.799045, -0.0958153, 0.786294, 0.444602, -0.251987, 0.676064, -0.191703, -0.591273, -0.0386192, -0.590747, -0.690611, 0.627101, 0.830797, 0.0789684, 0.728828, -0.845934, 0.33219, -0.279347, -0.840023, 0.940721, -0.393369, -0.566654, 0.648644, -0.731696, -0.23014, 0.436571, 0.768845, -0.35246, -0.0840596, 0.0304542, -0.0163096, -0.0533105, 0.957845, -0.965013, 0.329339, 0.152838, 0.254834, 0.158549, 0.168304, -0.597378, -0.869616, 0.396258, 0.720114, -0.945324, 0.569949, -0.930103, 0.219276, -0.979671, -0.925621, 0.664439, 0.619244, -0.27795, -0.702147, 0.235486, 0.792287, -0.258244, -0.438418, 0.382744, 0.546797, -0.371134, 0.344025, 0.202625, -0.807821, -0.814605, -0.800803, -0.0889925, -0.290761, -0.830032, -0.942385, 0.0739369, -0.313943, -0.275013, 0.44261, 0.278895, 0.118101, 0.206352, 0.148633, -0.903717, -0.587652, 0.00197796, -0.106319, 0.328062, 0.477681, 0.702276, 0.811618, 0.845016, 0.77441, 0.703893, -0.751029, 0.299429, -0.498507, 0.774928, -0.733875, 0.649566, -0.0795115, 0.579595, -0.77891, -0.304426, -0.638291, -0.41888, -0.0701851, 0.875346, 0.853641, 0.271974, 0.155047, 0.201849, 0.706914, -0.69944, -0.433088, 0.282162, -0.304057, -0.557406, 0.759488, 0.192746, 0.685133, -0.511752, 0.578933, -0.733766, -0.212158, 0.931936, -0.287575, -0.0760274, -0.290604, 0.232065, 0.675089, -0.609012, 0.377713, 0.830217, -0.271784, 0.849883, -0.108666, 0.0441476, -0.16903, 0.0602462, 0.01719, 0.677862, -0.27375, 0.695186, -0.650789, 0.477367, 0.3504, 0.986736, 0.706578, -0.297111, -0.101973, -0.572132, -0.454718, -0.14964, -0.904271, -0.651208, 0.508089, 0.399387, 0.287555, 0.630993, 0.608483, 0.196602, 0.174305, 0.185329, 0.933013, -0.26464, 0.482358, 0.365544, -0.816247, -0.0624086, -0.299717, 0.224957, -0.506516, 0.83925, 0.278539, 0.00799117, 0.196515, -0.237379, -0.630657, 0.0688208, 0.998749, -0.993586, -0.0302721, -0.622105, -0.36424, -0.315014, -0.390028, -0.660194, -0.365627, 0.518204, 0.680721, -0.693617, -0.950081, 0.0768294, -0.594416, -0.233113, 0.18123, 0.00358209, 0.923395, -0.882118, -0.247749, -0.0164945, 0.830891, -0.014124, 0.399084, -0.773592, 0.811529, -0.773754, -0.292173, 0.00145005, -0.00459789, 0.0915903, 0.836675, 0.424585, 0.760151, 0.419398, -0.638515, 0.794344, -0.538566, -0.14381, 0.184911, 0.540565, 0.132264, -0.454981, -0.615599, -0.620895, -0.577973, 0.632965, -0.192932, 0.0686989, -0.51687, 0.40765, 0.268635, -0.694402, -0.948401, 0.664681, 0.252299, 0.198527, -0.752556, -0.585771, 0.900382, 0.506058, 0.821625, -0.790778, 0.0527581, -0.885053, 0.171298, -0.494188, -0.674375, 0.0411674, -0.541212, -0.272071, -0.838936, 0.60545, 0.121068, -0.175075, -0.692207, -0.728654, 0.0309614, 0.597754, -0.302912, 0.0295164, -0.977561, -0.414117, -0.547564, -0.386398, 0.358152, 0.188221, -0.7556, -0.740991, 0.270752, 0.0761683, 0.51538, 0.638161, -0.295136, -0.138979, 0.426416, -0.552938, -0.797975, -0.180834, -0.832267, -0.786357, -0.679546, 0.529672, -0.280631, 0.776037, 0.413865, -0.253512, -0.561951, 0.917172, 0.0446544, 0.90976, 0.644647, -0.128474, -0.786463, 0.178707, 0.375934, -0.528234, 0.455425, -0.46221, -0.658195, 0.922272, 0.580643, -0.154954, 0.478613, 0.679745, -0.400503, -0.926706, -0.879649, -0.989518, 0.427946, -0.328811, 0.405705, -0.279864, -0.498693, -0.212988, -0.897045, -0.0925264, 0.159036, -0.468546, 0.998186, -0.723293, 0.623098, -0.435534, -0.272221, 0.93869, 0.826851, -0.434483, 0.901892, 0.933445, -0.0205679, 0.384095, -0.575161, -0.610849, -0.776716, -0.191599, -0.399632, 0.137721, -0.321233, -0.732207, 0.663492, -0.856491, 0.797573, -0.925637, -0.984086, 0.910886, -0.402904, 0.873807, -0.491227, -0.785821, -0.638887, 0.940468, 0.51774, -0.583196, -0.889515, -0.175416, -0.0961154, -0.162955, 0.56896, -9.53968e-06, -0.877445, 0.0566254, 0.626265, -0.638287, -0.203005, 0.571693, -0.399761, -0.119975, -0.748052, 0.451288, 0.421018, -0.709119, -0.547872, -0.800615, -0.13574, 0.232462, 0.60442, 0.19048, -0.162522, -0.363482, 0.489757, -0.351763, -0.497771, -0.536738, 0.913308, -0.875194, 0.830311, -0.713263, -0.725406, -0.252584, 0.711724, -0.52583, -0.30907, -0.0630502, -0.304107, -0.694976, 0.819024, 0.451967, -0.592486, -0.190413, 0.681704, 0.967435, -0.525072, -0.0743651, -0.412422, 0.9684, -0.639742, -0.953798, -0.518987, 0.157888, -0.735695, -0.137114, -0.638218, 0.396777, 0.511519, 0.085909, -0.208561, -0.0218041, 0.289277, 0.421776, 0.917334, -0.772392, 0.709855, -0.362434, -0.406126, 0.954858, -0.553252, 0.386502, -0.229649, 0.937986, 0.933816, -0.51261, -0.374577, 0.789865, 0.453423, -0.321526, 0.777424, 0.956143, -0.406319, 0.154721, -0.542408, 0.160763, -0.304365, 0.234046, -0.124459, 0.040362, 0.950918, 0.283386, -0.938718, 0.414226, -0.881895, -0.779484, -0.0575704, 0.883213, 0.112736, 0.579294, -0.22969, -0.408944, 0.244247, -0.51484, -0.559335, -0.265999, 0.112026, -0.675962, -0.967841, -0.965174, 0.0671919, 0.713959, -0.997521, 0.354815, -0.774048, -0.622772, 0.139188, -0.399308, -0.0876842, 0.946981, -0.470349, -0.803172, 0.158058, 0.110067},
-	{-0.342818, -0.298398, 0.422724, 0.692064, -0.806143, 0.0951137, 0.970162, -0.762907, -0.184745, -0.70756, 0.736742, -0.979996, 0.321856, -0.583963, -0.447527, -0.279683, 0.48648, -0.142873, -0.834919, 0.489455, 0.000245978, 0.955013, -0.622258, -0.556388, -0.693915, -0.0163793, -0.916412, -0.806179, 0.487747, -0.538778, 0.42552, -0.937, 0.444346, -0.352952, 0.295086, 0.443897, -0.335431, -0.797089, -0.505544, -0.351292, 0.0588461, -0.92375, -0.729205, -0.348828, 0.586639, 0.624175, 0.371135, -0.887894, 0.687017, -0.191927, 0.472774, -0.671788, -0.482575, 0.684262, 0.766165, 0.742231, -0.214141, 0.0258892, 0.300749, -0.642055, 0.949398, -0.515585, 0.735604, 0.675366, -0.911397, 0.0260343, 0.109172, -0.621914, 0.66842, -0.294234, 0.44923, 0.394284, 0.730883, 0.947644, -0.965974, -0.429122, -0.903975, 0.417277, -0.376341, -0.103839, 0.387371, 0.334772, -0.505814, 0.0812836, 0.129076, -0.609999, 0.480123, 0.0646829, 0.77843, -0.111439, 0.260859, 0.333797, -0.63957, 0.475447, 0.99252, 0.252199, 0.132747, -0.805115, 0.835246, 0.908681, 0.486838, -0.0487327, -0.400876, -0.592582, -0.453995, -0.341679, 0.643628, -0.950134, -0.805764, -0.655335, 0.435986, 0.85398, -0.138115, 0.26405, -0.00687417, -0.811087, -0.0873924, -0.941326, 0.565658, -0.783895, 0.0341882, -0.370568, 0.00800835, -0.305789, -0.0162837, 0.481832, 0.263672, -0.885314, 0.116082, -0.384291, -0.705418, 0.441001, -0.428826, -0.34984, -0.539462, 0.100384, -0.191872, 0.980742, 0.0473444, -0.933932, 0.984679, -0.63665, -0.105484, 0.267805, 0.197886, -0.449646, 0.340883, -0.725302, 0.597333, 0.980013, -0.254319, -0.79585, -0.0546783, 0.610907, 0.0748388, -0.411877, -0.269539, 0.41548, 0.443754, -0.949086, -0.480071, -0.907261, 0.533629, 0.401808, -0.978286, 0.87408, 0.945473, 0.802803, -0.690152, -0.0619295, 0.10416, -0.195506, 0.724683, -0.246584, 0.490894, 0.797044, 0.255703, -0.456335, 0.737587, 0.223984, 0.668093, 0.932874, -0.562378, 0.838252, -0.139371, -0.920724, 0.4823, -0.0779762, -0.321164, -0.332463, -0.861506, 0.648176, -0.265722, -0.220441, -0.96472, -0.0900085, -0.542436, -0.814428, -0.784285, 0.687643, 0.56084, 0.000222551, 0.336298, 0.453738, 0.34973, -0.603686, 0.00382013, -0.489724, -0.382936, -0.977649, -0.407471, 0.785788, -0.193842, 0.159201, -0.210677, -0.331139, 0.910885, -0.297619, 0.829791, 0.00579959, 0.169741, -0.646048, -0.532166, 0.769891, -0.24687, -0.0863624, -0.483009, 0.456684, -0.248422, 0.098484, 0.709151, -0.651185, 0.79557, 0.839771, -0.54187, -0.865266, -0.120682, -0.350647, 0.772964, 0.285163, -0.759552, -0.415461, 0.170932, -0.666071, 0.274901, -0.536133, 0.431185, 0.338092, 0.588457, -0.623723, 0.942373, -0.781087, 0.000288083, 0.0935855, 0.143525, -0.580351, 0.671922, 0.544838, -0.729824, 0.00949623, -0.154584, -0.486367, -0.725371, -0.26917, -0.273932, -0.783949, -0.056422, 0.725938, -0.702813, -0.500481, 0.845569, 0.839374, 0.709118, 0.813866, -0.575223, -0.836656, -0.117195, -0.751727, -0.423151, -0.325784, 0.619553, -0.546033, -0.00470503, -0.384596, 0.3334, -0.79468, 0.768971, 0.709862, 0.420186, -0.31896, 0.941146, -0.0690685, 0.787782, 0.582053, 0.94533, 0.67485, 0.299584, 0.57761, 0.215787, 0.757769, -0.241063, -0.857197, 0.617955, -0.114266, -0.708002, -0.680117, 0.225753, -0.0895802, -0.441012, -0.119016, 0.0394087, 0.28544, -0.601747, -0.345444, 0.522266, -0.825402, -0.354034, 0.00484, 0.599173, -0.329564, 0.505702, -0.459923, 0.618057, -0.980341, 0.333924, -0.347552, 0.195452, -0.807032, 0.774075, 0.602213, -0.938814, 0.137079, -0.875034, -0.0381939, 0.398404, -0.885208, 0.721251, 0.24324, -0.104339, -0.435036, -0.780569, 0.863652, 0.407854, -0.606301, 0.517173, -0.559626, -0.160473, -0.485581, -0.124044, -0.658094, -0.310605, 0.864723, -0.884715, 0.620417, -0.828224, 0.545426, -0.379289, 0.636218, 0.317858, 0.192774, -0.053089, 0.803284, 0.931542, -0.215975, -0.278929, 0.597479, -0.627953, -0.326949, -0.674055, 0.948854, -0.154637, 0.669861, -0.00681484, 0.523675, -0.379647, -0.644143, 0.00842183, 0.202064, 0.218246, 0.395651, -0.574216, -0.779527, -0.498739, 0.958178, -0.480055, 0.629004, 0.193064, -0.0068514, 0.2676, -0.725546, 0.603202, 0.171552, 0.915844, -0.617154, 0.576022, -0.359111, -0.00605196, -0.956623, 0.950839, -0.888177, 0.825366, -0.161567, -0.143954, 0.571513, 0.758651, 0.35947, 0.632424, 0.692635, -0.436779, 0.463818, -0.505628, 0.702548, 0.436938, -0.596771, -0.0878262, 0.536539, 0.827254, 0.951254, -0.162415, 0.301645, -0.512572, -0.769982, -0.444015, -0.55405, 0.553774, -0.929531, 0.176657, 0.772873, -0.365343, 0.544369, 0.0586615, 0.259104, -0.822256, -0.226851, 0.849511, 0.582617, 0.961727, 0.0176194, -0.151943, 0.0835778, -0.900919, 0.911694, 0.997345, 0.218626, -0.517847, -0.161345, 0.682732, -0.660172, -0.630519, -0.701434, 0.623967, 0.990219, 0.961012, -0.607859, -0.878058, -0.878365, -0.81911, 0.486545, 0.279487, 0.326181, 0.983645, 0.291951, -0.544632, 0.288992, -0.720431, -0.601741, -0.741926, 0.404048, 0.188891, -0.560251, 0.679899, -0.469998, 0.940441, 0.140093, 0.522799, 0.727014, -0.258471, 0.627018, -0.815339, 0.69131, 0.789167, 0.387402, -0.911519, -0.331956, 0.156066, -0.857407, -0.80749, 0.637784, 0.499983, 0.0356152, -0.0540042, 0.825392, 0.649129, 0.384964, -0.150644, 0.337748, -0.870532, 0.614793, -0.20217, 0.0362382, -0.385979, -0.220119, 0.537688, -0.182361, 0.159698, -0.443239, 0.799322, -0.572098, 0.107368, -0.456429, 0.0254155, 0.0499165, 0.174919, -0.481471, -0.336078, -0.829589, -0.424292, -0.36354, 0.445059, -0.803274, 0.361497, -0.46534, 0.914382, 0.724451, -0.42341, -0.286183, 0.534534, -0.845014, -0.518831, -0.0350744, 0.539176, 0.450452, -0.731407, 0.143289, 0.470144, 0.62179, -0.944336, -0.815179, -0.306513, 0.479222, -0.780917, 0.610179, 0.301007, -0.770686, 0.299047, -0.875973, 0.217434, -0.865567, 0.921643, 0.0408749, 0.367012, -0.238318, -0.184058, 0.535549, 0.287804, -0.955752, -0.986509, -0.43339, 0.389132, 0.71109, 0.477979, 0.803143, 0.845043, -0.878508, -0.712155, 0.463456, 0.978469, 0.339627, -0.951052, 0.813158, -0.270171, 0.508904, -0.0262449, 0.917509, 0.478284, -0.533844, -0.776679, 0.0143155, -0.658693, -0.960684, -0.909408, -0.0367135, 0.774329, -0.110544, 0.903447, 0.399114, -0.994341, -0.215202, 0.824424, 0.771576, 0.807837, -0.17346, 0.544812, 0.0130012, 0.83285, 0.500519, 0.740238, 0.42691, 0.679459, 0.503249, -0.643607, 0.924548, 0.469632, 0.333757, 0.176074, -0.938706, -0.391258, 0.147563, -0.903803, -0.514687, -0.876574, -0.335556, -0.112415, -0.541218, -0.819634, 0.12202, 0.894926, -0.914582, -0.224573, 0.431245, -0.822811, 0.0207547, -0.856069, -0.207946, -0.657366, 0.688871, 0.948881, -0.472903, 0.767734, -0.15221, -0.750536, 0.811985, -0.270675, 0.735655, -0.18982, 0.961324, 0.93507, -0.313618, 0.554469, 0.54559, -0.849609, 0.604031, -0.657055, 0.279937, -0.260957, -0.563574, -0.280625, 0.929002, -0.310351, -0.712446, 0.346245, -0.293763, -0.726199, -0.617071, 0.0953537, 0.783296, 0.112157, 0.0873991, 0.14907, -0.854007, 0.0232343, 0.951366, -0.981072, 0.00712072, 0.559811, 0.0295515, -0.949853, 0.530074, 0.0220729, -0.132044, -0.160505, -0.123948, 0.374195, 0.314755, -0.43608, 0.452307, -0.613728, -0.244608, -0.955028, -0.425251, -0.924465, -0.108851, 0.235689, -0.463332, 0.75793, -0.366918, -0.77811, -0.795512, 0.989499, -0.731557, -0.68283, 0.288502, -0.849868, -0.198362, -0.548214, 0.180313, 0.617005, 0.201669, -0.706484, 0.0289498, -0.234736, 0.467676, 0.42496, 0.855219, -0.614491, -0.401139, 0.330952, 0.927088, -0.879214, -0.350941, 0.263961, -0.989076, 0.0400175, 0.425017, 0.923403, -0.521448, 0.654969, 0.0592564, -0.600532, 0.75957, 0.870906, -0.0716121, 0.75173, -0.69889, 0.0774793, -0.14698, -0.277242, -0.4706, -0.910849, -0.0762068, 0.697684, 0.374423, -0.431172, -0.330067, -0.86331, 0.363431, -0.709887, 0.299757, -0.952833, -0.919491, 0.398939, 0.418926, -0.995488, 0.295355, -0.235381, 0.0838468, -0.553242, 0.561723, 0.714962, 0.973714, 0.277636, 0.604857, 0.657344, -0.261548, -0.401622, 0.623544, -0.189609, -0.032755, 0.174667, -0.992505, -0.408455, -0.266293, -0.322141, 0.226264, -0.48193, -0.0679848, 0.609806, 0.90516, 0.733326, -0.718123, 0.658839, -0.33486, 0.190314, 0.398862, -0.187166, -0.967361, 0.117543, 0.0839055, -0.224619, -0.803164, -0.12233, -0.643814, -0.748003, 0.215087, -0.773224, -0.531721, 0.342375, 0.377459, 0.737404, 0.0481147, 0.0149609, 0.405317, 0.386642, 0.183074, -0.603915, -0.743135, 0.809094, 0.620722, 0.375904, 0.78464, -0.493411, 0.92388, -0.273015, -0.0147778, -0.075091, 0.823074, 0.683231, -0.201506, 0.423674, 0.485956, 0.237096, -0.352484, 0.673563, 0.60751, -0.595929, 0.35672, 0.264549, -0.100226, 0.28953, 0.465606, 0.332923, -0.993672, 0.717132, 0.759573, -0.503995, 0.0885281, -0.197386, -0.643374, -0.681095, -0.3376, -0.888081, 0.0082217, -0.403285, -0.86432, -0.717877, 0.940522, 0.07518, 0.912297, 0.795941, -0.323974, 0.258202, -0.817183, -0.089471, 0.321822, 0.18288, -0.00148434, 0.00524809, -0.179449, 0.21695, -0.839799, 0.937709, 0.316731, 0.0704245, 0.175816, -0.48014, 0.345034, -0.315061, 0.601418, -0.371592, -0.167526, 0.56251, 0.0907325, 0.496818, -0.32171, 0.22595, -0.202614, -0.76193, -0.990479, -0.423539, -0.150829, 0.605074, -0.943251, -0.333849, -0.922765, -0.103448, 0.138237, 0.196885, -0.343354, 0.655632, -0.328008, -0.859184, 0.184138, -0.197871, 0.50252, -0.348109, 0.783452, -0.729222, -0.721028, 0.906767, -0.797542, -0.0424005, 0.50578, 0.38633, 0.0556321, -0.799235, -0.315509, -0.660733, -0.552441, -0.559727, -0.186757, -0.268148, -0.940708, 0.224108, 0.910128, -0.620648, 0.871177, -0.471673, -0.045097, 0.887404, -0.953115, 0.110568, 0.397129, 0.925245, 0.131243, -0.850338, -0.225311, 0.674791, -0.229592, -0.732177, -0.420246, -0.451438, 0.567179, 0.203823, -0.749302, -0.670275, -0.620233, 0.847619, 0.133942, -0.247397, 0.685938, -0.392462, -0.532954, 0.389703, -0.506909, 0.888256, 0.107746, -0.745196, 0.960613, -0.906688, 0.459997, -0.439286, 0.22956, -0.0941226, -0.437485, 0.626698, 0.967675, -0.52508, -0.774369, 0.237506, -0.139606, -0.816352, 0.919347, -0.840253, 0.680468, -0.00114342, 0.946336, -0.945029, -0.0236396, -0.19077, -0.417687, -0.0234962, -0.455884, 0.934557, -0.523662, 0.373585, 0.562769, 0.150454, 0.628809, 0.331025, 0.957627, 0.952802, -0.0759277, 0.759545, -0.952371, 0.328273, 0.656793, -0.176751, -0.609137, -0.0280264, -0.975353, 0.841035, 0.282203, 0.107419, 0.323955, -0.395639, -0.952791, -0.156281, 0.636029, -0.992392, -0.0418676, 0.407245, -0.258099, -0.686286, -0.71553, 0.57542, -0.970887, -0.939829, 0.0475438, -0.942583, -0.792193, 0.660298, -0.0754399, 0.267368, 0.713757, -0.637794, -0.0627066, -0.946622, 0.380595, -0.267712, -0.158685, -0.490827, 0.00335255, -0.637509, 0.398759, -0.702343, 0.524624, 0.704378, -0.967771, -0.642877, 3.12238e-05, 0.554745, 0.219591, -0.485057, -0.511882, 0.108823, 0.720493, -0.0828096, -0.49084, 0.337242, 0.0341696, -0.879889, 0.35809, -0.0526862, -0.853139, 0.110449, 0.724451, 0.670892, 0.193503, 0.561033, 0.552966, -0.56501, -0.451988, -0.648576, -0.140032, 0.78536, 0.779348, 0.850892, 0.658552, -0.734976, 0.740419, 0.982163, 0.353162, 0.881005, 0.426571, -0.14969, 0.109093, 0.799335, 0.46808, -0.545355, 0.786351, -0.393306, -0.913182, -0.646324, -0.719368, 0.35391, 0.361654, 0.642764, 0.501597, 0.866407, -0.0975534, 0.270459, -0.213229, 0.314115, -0.635754, 0.879199, -0.577646, 0.925651, 0.656994, 0.449282, -0.690535, 0.545646, 0.0612471, -0.977191, 0.850631, -0.343054, -0.77635, -0.144639, -0.809651, -0.733408, 0.940583, 0.680746, -0.711045, -0.353377, -0.87095, -0.823258, 0.772492, 0.224401, 0.852069, -0.204035, 0.19021, -0.841969, 0.0857827, -0.098097, 0.408091, 0.822276, 0.840599, 0.0935632, 0.100473, -0.639621, 0.24116, -0.201565, 0.0197553, 0.699111, -0.540692, 0.636991, -0.0113161, 0.695926, -0.582407, -0.804899, -0.15018, 0.287827, 0.7277, -0.330086, 0.112646, -0.510778, 0.954971, -0.239584, 0.921512, -0.124025, -0.964801, -0.0926342, -0.399639, -0.273125, 0.434753, 0.0521553, 0.300515, 0.944874, 0.566414, 0.687414, -0.385065, -0.552037, -0.345904, 0.629295, -0.830023, 0.773329, -0.192387, 0.247664, 0.651211, 0.330858, -0.809585, 0.831323, 0.404821, -0.732055, 0.634773, 0.366463, 0.410513, 0.286478, -0.571085, 0.537827, 0.57576, -0.279462, -0.229815, -0.0354145, -0.231572, 0.682681, -0.914828, 0.782897, 0.691623, -0.672394, -0.783814, 0.586136, 0.0187576, -0.421106, 0.900538, -0.981268, -0.227455, -0.256835, 0.613442, 0.738771, 0.505775, -0.510312, 0.436353, 0.26937, 0.558317, -0.27502, 0.00610787, -0.181231, -0.16297, 0.290598, -0.870737, -0.279143, 0.667062, -0.246909, 0.895901, -0.415928, 0.119564, 0.501502, -0.246467, 0.868585, -0.896078, 0.234859, 0.842635, -0.814522, -0.0506502, 0.645409, 0.948199, 0.766418, 0.106082, 0.56303, -0.294309, -0.794518, -0.143514, -0.182242, 0.884645, -0.0280727, -0.529106, -0.350049, 0.250576, -0.675284, -0.880523, -0.229726, -0.63265, 0.428599, -0.140102, -0.195802, -0.690282, -0.0821132, -0.898919, -0.871418, 0.00345613, 0.0461041, 0.608291, 0.73297, -0.595924, 0.174612, 0.566893, -0.566507, -0.998847, -0.719433, 0.563294, -0.621602, 0.364931, 0.776064, -0.802272, 0.134129, -0.722505, -0.773265, -0.962209, -0.0228478, -0.131521, -0.246849, 0.389953, 0.932305, 0.137102, 0.361558, -0.991367, 0.749323, 0.636295, 0.713075, 0.280613, -0.13329, -0.309085, 0.37302, -0.842045, -0.118584, -0.776033, -0.62019, -0.877961, 0.21137, -0.811929, -0.891501, -0.971257, 0.383632, 0.432027, 0.26086, 0.570535, -0.804715, -0.831914, 0.709335, 0.963663, 0.689775, -0.292364, 0.926963, 0.593966, -0.916261, -0.476452, -0.374694, 0.202458, 0.196157, -0.137212, 0.429065, 0.917731, 0.465606, 0.265271, -0.435686, -0.618745, 0.712328, 0.0280923, -0.763011, -0.57858, -0.774921, -0.494931, -0.917315, -0.11646, -0.035534, -0.670551, 0.231563, 0.876185, -0.687578, 0.238905, -0.882327, -0.739146, 0.279677, 0.260354, -0.316651, -0.10942, -0.45589, -0.0514808, 0.885256, 0.623898, 0.971484, -0.679831, 0.235257, -0.187215, 0.367551, -0.103655, 0.0329187, 0.79981, 0.0876074, 0.421121, 0.0522444, 0.284027, -0.685694, 0.067425, -0.339559, -0.814881, 0.466833, -0.56197, -0.628772, -0.886014, 0.639596, -0.308159, -0.114102, -0.178663, 0.822977, 0.226726, 0.644675, 0.959447, -0.996779, 0.314533, 0.40901, 0.772588, 0.00486267, -0.887675, -0.765071, -0.864564, 0.422099, -0.327056, -0.551417, 0.421357, 0.687347, -0.968725, 0.236719, 0.233761, 0.614251, 0.443546, 0.570347, 0.0996371, 0.840861, 0.910796, 0.250483, 0.632555, 0.288507, 0.549692, 0.206511, 0.81194, 0.28724, -0.730811, -0.071667, 0.348854, -0.0291072, -0.651339, -0.60219, -0.754921, -0.0433665, 0.107703, -0.305007, -0.723166, -0.0540935, 0.96482, 0.452924, 0.135229, 0.0403502, 0.860428, -0.847666, 0.852805, -0.670216, 0.225214, -0.307048, 0.435996, -0.583576, 0.430237, -0.49508, -0.81617, 0.169288, 0.180454, 0.607563, 0.27301, 0.387195, 0.607361, -0.417268, 0.749123, 0.379349, -0.0241415, -0.487866, 0.335819, -0.404662, 0.876444, -0.590238, 0.0144705, -0.844367, 0.832546, -0.643038, -0.998446, 0.345308, 0.882682, -0.0630285, 0.255908, -0.0162625, 0.0677589, 0.557789, 0.266708, -0.488685, 0.911725, 0.83567, 0.846625, 0.709534, -0.158635, 0.756926, 0.253344, 0.349333, -0.126066, -0.0324035, -0.893888, -0.181606, 0.0718162, -0.225533, 0.859222, 0.483721, 0.555979, 0.702552, -0.880629, 0.193209, -0.760741, -0.291475, -0.633446, 0.417668, 0.10087, -0.834989, 0.632237, 0.122953, 0.276831, -0.758764, 0.95172, -0.745011, -0.655864, -0.493586, 0.881853, 0.637226, -0.298802, 0.226326, -0.355084, 0.120029, 0.542325, -0.679187, 0.25197, 0.695493, -0.35309, 0.506482, 0.0195023, 0.0701314, 0.0574631, -0.840346, -0.883317, -0.841075, 0.038375, 0.0392649, -0.803926, -0.536535, -0.677862, 0.788886, -0.435356, -0.875372, -0.874165, -0.784628, 0.0310725, 0.496627, -0.836692, 0.320001, -0.918545, -0.851427, -0.850456, -0.623287, -0.807021, -0.0807296, -0.383147, 0.219723, -0.826334, -0.601828, 0.985828, -0.307856, 0.884693, -0.527655, -0.385715, 0.870559, -0.831364, 0.270275, -0.809881, -0.121146, -0.872473, -0.212459, 0.0880193, 0.883768, 0.235798, -0.311092, -0.60112, -0.652808, 0.356107, -0.745134, 0.355187, 0.627973, 0.805466, -0.411783, 0.361519, 0.16304, 0.121942, 0.903568, 0.352718, -0.140337, 0.235325, -0.925292, -0.680957, 0.750778, 0.642787, -0.300694, 0.781028, 0.12761, 0.540993, -0.00173705, 0.39123, -0.880651, -0.757195, 0.789985, 0.577159, 0.948539, 0.990353, 0.503507, -0.825429, 0.341897, -0.852909, -0.693114, -0.176163, -0.874665, 0.318519, -0.372717, -0.801017, -0.843622, 0.280195, 0.354988, 0.881733, -0.0250364, -0.64183, 0.0578461, 0.485841, 0.189144, 0.940921, -0.089163, -0.976328, -0.34595, 0.469965, -0.315179, 0.882674, 0.345986, -0.90304, -0.137895, 0.985092, 0.593984, -0.837807, 0.175264, -0.765331, -0.971855, 0.15504, 0.271972, -0.438301, 0.209729, 0.364752, 0.707108, -0.203527, 0.417518, 0.259615, 0.702872, 0.268841, -0.982226, 0.316491, -0.0673195, 0.270104, 0.666049, -0.191802, 0.313566, -0.111579, -0.496619, 0.144671, 0.854057, 0.47484, -0.427104, 0.13938, -0.79446, -0.375318, 0.994676, 0.184891, -0.858673, 0.47298, -0.0307977, -0.565418, 0.0290957, -0.96229, -0.613087, -0.999302, 0.782589, 0.00610382, 0.917728, 0.609315, -0.200831, 0.245358, -0.833423, 0.284815, 0.796677, -0.97586, -0.556631, 0.801042, -0.254534, 0.372429, 0.354122, 0.613267, 0.298149, -0.456474, 0.224476, 0.443019, -0.376305, 0.606852, 0.255373, 0.383559, -0.833123, 0.101134, -0.480689, 0.0107816, 0.811067, 0.326713, -0.704614, 0.720781, 0.386567, -0.627132, -0.902697, 0.95523, -0.636809, -0.793571, 0.506372, 0.360627, -0.825198, -0.399249, -0.693328, -0.126121, -0.60537, 0.0794438, 0.827528, 0.262701, 0.99445, 0.980256, 0.718051, 0.492597, -0.194327, -0.401327, -0.501237, 0.955344, -0.915639, -0.426891, 0.361797, 0.437175, 0.892099, 0.291791, -0.170377, 0.145305, -0.491785, -0.497598, -0.0389304, 0.316358, -0.282281, 0.400369, -0.432419, -0.449692, 0.35524, 0.497461, 0.543556, -0.821392, 0.31004, 0.96616, 0.319987, -0.986837, 0.653161, 0.358741, -0.332192, 0.788253, -0.90403, 0.0323286, 0.42247, 0.446895, -0.0767702, 0.401074, -0.845377, -0.66898, -0.597253, -0.393341, 0.832452, -0.796339, 0.930797, 0.663595, 0.84175, -0.541926, -0.623345, -0.94472, -0.517835, 0.155952, -0.446256, 0.497252, 0.535921, 0.164733, 0.0952723, 0.942983, -0.982175, 0.485334, -0.370963, -0.0330112, -0.894808, -0.287116, 0.838811, 0.127689, -0.192792, -0.440451, -0.501067, 0.412552, -0.481409, 0.0926374, 0.297203, -0.872104, -0.417374, -0.00564012, 0.148932, 0.751158, -0.234022, 0.875182, 0.25748, -0.820519, 0.963535, 0.455184, -0.139307, -0.450568, -0.635139, -0.845786, -0.675452, -0.232849, 0.14691, 0.0333974, -0.757373, 0.12402, 0.181764, -0.383168, -0.190876, 0.528433, -0.103005, -0.167119, 0.713528, -0.965901, 0.530887, -0.698581, 0.778357, 0.9989, 0.875166, 0.110936, 0.836575, 0.727767, -0.478826, 0.459143, -0.368737, 0.346485, -0.130479, -0.767616, 0.884179, 0.371385, -0.994373, 0.39161, -0.0845819, 0.739812, 0.771884, -0.614256, -0.405198, -0.531662, 0.373494, -0.995934, -0.53899, -0.610231, 0.0258476, 0.670764, -0.920001, 0.0269516, -0.593484, -0.691768, 0.410477, 0.0212092, -0.790549, 0.0069483, 0.775389, -0.627605, -0.0433162, -0.374432, 0.318297, 0.812488, -0.246735, 0.101167, 0.752608, -0.843909, -0.339167, -0.852078, 0.222901, -0.207613, -0.554129, -0.94628, -0.0177438, -0.822712, 0.318789, -0.752327, 0.871596, 0.110422, 0.801741, 0.616049, -0.920684, 0.368525, 0.860521, -0.724588, 0.10894, 0.458532, 0.449886, -0.201542, -0.878741, 0.553179, 0.386375, 0.159414, -0.714033, -0.857468, 0.712494, -0.440617, -0.811043, -0.388899, 0.397248, -0.946235, -0.551017, 0.814171, -0.0343658, 0.146999, 0.23878, -0.471258, 0.511849, 0.03009, 0.523608, -0.753556, 0.705479, -0.721075, 0.862332, -0.763998, -0.381381, 0.749237, -0.125118, 0.745449, -0.854775, 0.364161, -0.611262, -0.93039, -0.35388, -0.28434, 0.652556, 0.389494, 0.844057, 0.188427, -0.32828, 0.205385, -0.586956, 0.783452, 0.975555, -0.0839949, 0.339424, 0.792117, 0.522104, 0.501876, 0.999052, -0.514613, 0.552168, 0.198789, -0.729872, 0.456927, 0.866693, 0.658434, -0.899261, 0.953166, 0.277925, 0.314037, 0.496004, 0.275679, -0.60694, -0.938207, -0.198204, 0.640097, -0.501098, 0.105677, -0.97364, -0.869759, 0.764405, 0.943774, -0.65742, 0.868213, -0.669945, -0.0213096, -0.272651, -0.689873, 0.765507, -0.838574, 0.228584, 0.284433, -0.247853, 0.399352, -0.196727, 0.919705, -0.830226, -0.00995007, -0.622901, -0.190542, 0.00689502, 0.521689, 0.928472, -0.66889, 0.506177, -0.860739, -0.243535, 0.637951, 0.710746, -0.420245, -0.147489, 0.319086, 0.118273, 0.894034, 0.823716, -0.585141, 0.251295, 0.466639, -0.13722, -0.48528, 0.936874, 0.0273415, 0.972833, -0.158964, -0.684521, 0.820814, -0.81388, 0.824032, 0.0914891, 0.743771, -0.0314143, -0.969588, 0.579695, 0.487216, -0.0985255, -0.292881, 0.944596, 0.984774, -0.753975, -0.404946, -0.109095, 0.0846487, 0.154316, -0.704437, -0.0589243, -0.00596229, -0.428629, 0.287354, 0.947769, -0.557276, -0.832245, 0.445201, -0.561186, 0.483995, -0.274091, 0.427851, 0.657909, -0.856633, 0.617536, -0.388895, -0.257808, 0.885812, -0.424928, 0.478761, 0.634758, 0.917572, 0.383106, -0.15801, -0.88938, 0.726018, -0.782521, -0.198997, 0.950824, 0.14122, 0.710511, -0.937289, 0.986053, -0.894134, 0.909714, 0.46606, -0.738238, -0.75748, 0.320091, 0.65667, 0.688473, 0.435653, 0.155221, 0.890785, -0.376189, -0.952478, 0.658494, 0.570102, -0.0638574, 0.79805, 0.292383, 0.462616, 0.837705, -0.821467, 0.493587, 0.264741, -0.607172, -0.262188, 0.643601, 0.839696, -0.678052, -0.249322, -0.620676, 0.723011, 0.453609, -0.49507, -0.813761, -0.21197, 0.969276, -0.958507, 0.791808, 0.140192, 0.654957, -0.807154, -0.555642, 0.779841, 0.719581, 0.060799, -0.912247, -0.162007, -0.597827, -0.319835, -0.875781, 0.697223, -0.694513, -0.401271, 0.471479, 0.599464, -0.706564, 0.0500994, -0.20394, 0.154407, -0.302095, 0.201263, -0.506873, -0.686272, 0.164243, -0.0885322, 0.0616106, 0.558033, 0.168505, 0.948405, -0.712206, -0.876375, -0.765093, 0.341639, -0.916653, -0.019999, -0.56791, -0.783028, 0.622925, 0.725186, -0.618192, 0.142225, 0.0981124, 0.518455, -0.965622, 0.96588, -0.0989604, 0.846445, 0.732856, 0.625824, 0.871899, -0.551312, -0.726125, 0.857963, 0.889842, -0.928018, -0.534016, 0.449518, -0.529652, 0.533272, 0.539956, -0.933841, 0.946815, -0.939429, -0.590038, 0.487508, 0.640089, 0.527814, 0.936142, 0.241631, 0.833282, 0.151189, -0.0745263, 0.212095, 0.456205, 0.188291, 0.249562, 0.80306, -0.00458246, -0.706835, -0.944835, 0.0941638, -0.0992131, 0.80644, 0.161397, 0.294637, -0.574929, 0.870656, -0.660276, 0.919922, 0.146976, -0.698761, 0.842396, -0.579761, 0.708544, -0.03636, 0.322048, 0.664134, -0.532222, -0.8852, -0.17183, 0.427141, 0.0828864, -0.326164, -0.558813, 0.84045, 0.308162, 0.687147, -0.55928, 0.497936, 0.669735, 0.686233, 0.340107, 0.487458, 0.903279, -0.918561, -0.59895, 0.417201, -0.119456, 0.369731, 0.166246, -0.238662, 0.0429978, 0.613902, 0.466156, -0.226828, 0.161162, -0.384263, 0.0720173, -0.462402, 0.590865, -0.832274, -0.626275, -0.383941, -0.678858, -0.0676907, -0.216224, -0.539684, -0.974679, 0.875846, 0.193171, -0.684985, -0.931247, -0.711593, 0.102898, 0.979634, -0.377715, 0.953973, 0.605264, 0.53639, 0.890273, 0.825128, -0.0121652, -0.797114, 0.281178, -0.37872, 0.628272, -0.342174, 0.99345, -0.696884, -0.713865, 0.332628, 0.230739, 0.0386125, -0.399264, -0.106863, 0.106704, -0.095643, 0.771738, 0.0395651, 0.599688, 0.112005, -0.434109, 0.548855, 0.878615, 0.175265, 0.516064, 0.771773, -0.426312, -0.982694, 0.530831, -0.0552635, -0.0720083, 0.665444, 0.610883, 0.741547, -0.919237, -0.283277, 0.449358, -0.283227, -0.58215, -0.0346823, -0.630791, -0.561177, 0.427796, 0.307148, 0.117157, 0.267145, -0.0269017, -0.563627, -0.954463, 0.668812, 0.276146, 0.717224, 0.161931, 0.349775, 0.482177, 0.642108, 0.654817, 0.173545, -0.104909, -0.743768, 0.265018, 0.0939972, 0.00555923, -0.910442, -0.915799, 0.287198, -0.700652, 0.717621, 0.815576, 0.589387, -0.731801, 0.0649302, 0.569397, -0.276967, 0.0788719, 0.216597, 0.488313, -0.637493, -0.853114, -0.489976, -0.446145, -0.333016, -0.421287, 0.813211, -0.33082, -0.535394, -0.435303, 0.30592, 0.813099, 0.520882, 0.160124, 0.660786, 0.492071, 0.902054, 0.893293, 0.892717, -0.209023, -0.903313, 0.28525, -0.220961, 0.322702, -0.880558, 0.58684, -0.552645, 0.335014, 0.824047, 0.668506, -0.991046, -0.392312, -0.49047, 0.360336, -0.82349, 0.0490928, 0.425943, -0.767672, -0.587538, -0.400405, 0.558606, -0.0583101, -0.10028, 0.438367, 0.448563, 0.795482, -0.0675283, -0.736556, -0.68249, 0.977312, -0.583343, 0.239714, -0.18585, -0.0181331, -0.853451, -0.631373, -0.0646618, 0.124753, 0.279436, -0.628975, 0.742498, 0.465324, 0.573853, 0.44927, -0.896332, -0.775678, 0.528952, -0.378355, 0.346046, 0.162019, -0.15322, -0.0248727, -0.441535, 0.0410118, 0.712531, -0.889372, 0.69282, 0.625419, 0.823703, -0.486537, -0.183113, 0.0438231, 0.154797, -0.337757, 0.0225756, 0.481021, -0.0861534, -0.0273875, -0.874478, 0.312134, -0.609222, -0.285995, -0.0703963, 0.181405, -0.369556, 0.815318, -0.157693, -0.788665, 0.981331, -0.211516, -0.00752792, -0.0334828, -0.755793, 0.0851374, -0.905036, -0.109411, 0.262336, 0.465483, 0.563635, 0.0309873, 0.664338, -0.739347, -0.804897, 0.0188165, -0.0200223, -0.859119, -0.752619, 0.423537, -0.690721, -0.773791, 0.0243966, 0.322038, 0.754998, 0.760365, -0.486984, -0.289584, -0.0511719, -0.0856332, 0.608924, -0.658844, 0.281911, 0.444668, -0.296106, 0.0216243, 0.555763, 0.303463, -0.839646, -0.968594, -0.362208, -0.449521, -0.213406, -0.589711, 0.430794, 0.997569, 0.55723, -0.0366111, 0.566109, 0.692054, -0.455567, -0.709018, 0.614532, -0.842589, -0.696705, 0.890598, 0.763604, -0.0731781, -0.060682, 0.653551, -0.847736, 0.589247, 0.772726, -0.996179, 0.231339, -0.455156, 0.583015, 0.206658, -0.371667, 0.990991, -0.639117, -0.00595845, 0.705752, 0.170162, 0.587735, 0.59751, -0.0735508, -0.739949, 0.943953, -0.381404, -0.779139, 0.0197798, 0.337193, 0.483534, 0.738169, 0.888954, 0.0821589, -0.200501, 0.187187, -0.560614, 0.019654, -0.73772, 0.544179, 0.189678, -0.825149, 0.663798, 0.618108, -0.913734, -0.865886, 0.852886, -0.294205, 0.0570677, -0.467515, -0.759357, 0.0263204, 0.64635, -0.71743, -0.98776, -0.710967, -0.607884, 0.539586, 0.350776, 0.0737285, 0.413906, -0.700343, 0.663453, -0.209578, 0.266931, 0.142094, 0.62434, -0.0634233, -0.443333, -0.131674, -0.260301, 0.984862, -0.833506, -0.361714, 0.173192, -0.404975, -0.0514266, -0.667723, 0.963883, 0.592885, -0.847333, 0.141569, 0.966288, -0.856339, 0.991816, 0.744047, 0.201561, 0.624903, 0.155579, -0.356357, -0.732937, -0.0454268, -0.342189, -0.032051, -0.351641, -0.194178, 0.254905, 0.270304, 0.63121, 0.413437, -0.188809, 0.181505, -0.573666, 0.799048, -0.4346, 0.86547, 0.341419, -0.801095, -0.399492, 0.355907, -0.177939, 0.194617, 0.178494, 0.576117, -0.12038, 0.389379, -0.0244609, -0.0259011, -0.242514, 0.36174, 0.617171, -0.452774, -0.087416, 0.767155, 0.284291, -0.984547, -0.54733, -0.609813, 0.0404752, 0.681747, -0.631403, 0.954164, -0.816622, 0.581065, 0.415072, 0.0362204, -0.790878, 0.770979, 0.135595, -0.356883, 0.712585, 0.862481, 0.305076, 0.470801, -0.506846, -0.420132, -0.611601, 0.00760896, 0.738749, 0.0322659, -0.695539, -0.159465, 0.181941, -0.24869, 0.635253, 0.506353, 0.368455, 0.754955, 0.138422, -0.502244, 0.201511, 0.873372, 0.577161, -0.997523, -0.758801, -0.491378, -0.661209, 0.757155, -0.903055, -0.645308, 0.0972859, 0.178431, -0.901939, -0.754425, -0.9445, -0.371461, -0.231291, -0.685723, -0.445046, -0.206629, 0.362041, -0.815721, -0.682054, 0.0964098, 0.823342, -0.607527, -0.391767, -0.0146462, -0.783755, 0.411267, -0.360993, 0.466526, -0.384071, -0.243111, 0.438378, 0.602149, 0.567641, -0.961465, -0.120576, -0.376109, -0.574119, -0.247179, -0.254391, 0.00247729, -0.111258, 0.186766, 0.237237, -0.120912, 0.175254, 0.247259, -0.118973, 0.0764303, -0.124277, 0.62796, -0.744341, 0.992323, -0.425184, -0.00895839, 0.78264, 0.32431, 0.639762, 0.894281, -0.183162, 0.822701, 0.967471, -0.560828, -0.335884, -0.215156, 0.506768, 0.441609, -0.37733, 0.356662, -0.455464, 0.63063, 0.0752224, 0.834582, -0.30575, 0.0901862, 0.573442, -0.878053, 0.235492, -0.662717, -0.651676, -0.158498, 0.297112, 0.271151, -0.820455, 0.468643, -0.963842, -0.83849, -0.992716, 0.250905, -0.170114, -0.0735946, 0.670684, -0.131622, -0.613294, -0.868033, 0.882966, -0.433158, 0.844196, 0.565385, -0.636482, -0.1252, 0.502265, 0.487304, 0.729942, -0.187733, 0.207032, 0.82913, -0.507923, 0.57924, -0.772378, -0.332726, -0.625351, -0.811629, 0.425376, -0.929362, -0.814098, -0.430937, 0.0530813, -0.945623, -0.336198, -0.472532, -0.693784, -0.351578, -0.275048, 0.804383, 0.819966, -0.859645, -0.595167, 0.67306, 0.92945, -0.0558379, -0.868408, -0.139416, -0.91134, -0.968371, 0.38469, -0.692529, 0.100269, 0.292615, -0.182174, -0.917943, -0.647045, 0.706604, -0.661126, -0.824558, -0.37073, -0.931406, -0.925022, 0.687157, -0.507999, 0.912328, 0.841349, 0.59986},
-	{-0.616041, -0.478916, -0.0319894, 0.805616, 0.230021, 0.614133, 0.613549, 0.651561, -0.267102, 0.687753, 0.0222365, 0.503588, -0.155753, -0.650646, -0.411937, -0.229507, 0.498547, -0.548026, -0.393369, 0.8422, -0.228089, 0.411418, -0.166046, 0.72419, -0.700718, 0.0346343, -0.216211, 0.910897, 0.403375, 0.538793, -0.539701, -0.755572, 0.116266, 0.603685, -0.0745897, 0.832307, -0.0351776, -0.759789, -0.782952, -0.288703, -0.993499, 0.984105, 0.0144857, -0.882942, -0.718274, -0.602035, 0.745303, -0.0693372, -0.778948, 0.52591, -0.387676, -0.657924, 0.8791, 0.709513, 0.567494, -0.531539, 0.745955, 0.586362, -0.589082, -0.275561, 0.98015, -0.5751, 0.597974, 0.785932, 0.0564156, -0.799271, 0.624574, 0.0733549, -0.587381, -0.195761, 0.662611, -0.996512, 0.103509, 0.982861, 0.800008, 0.0786972, -0.328238, -0.657154, 0.718057, 0.406649, 0.394339, 0.202566, 0.508752, 0.203451, 0.255775, -0.590585, -0.984105, 0.333274, 0.326376, -0.29511, 0.721193, -0.572814, 0.241892, 0.393985, 0.19857, 0.97227, -0.53707, -0.46451, 0.179342, -0.489616, -0.0159931, 0.243198, -0.943249, 0.134247, -0.887498, -0.123703, 0.728178, -0.395063, -0.700442, 0.957865, -0.301209, -0.877096, -0.00172835, -0.338652, 0.924411, 0.687793, 0.301199, 0.831355, -0.288658, -0.485403, 0.0157976, 0.370195, -0.0992458, 0.361439, -0.881525, 0.738894, 0.250999, 0.305672, 0.090749, -0.365332, 0.0456946, -0.0798555, 0.379121, 0.60117, 0.0614766, 0.674045, -0.465637, -0.805403, -0.564451, 0.790271, -0.685521, -0.693339, -0.152022, 0.486503, 0.319107, -0.227325, 0.486314, 0.168745, 0.487312, -0.0180388, 0.578901, -0.143443, 0.825292, -0.0527763, -0.719573, -0.845157, 0.869101, 0.523077, -0.860097, 0.554932, 0.0421024, 0.669969, 0.161559, -0.97543, 0.813356, 0.507518, 0.36582, -0.486176, -0.680867, 0.424102, -0.389206, 0.820941, 0.365398, 0.926855, -0.267461, 0.49917, 0.956587, 0.536231, 0.906433, -0.859369, -0.250659, -0.958555, -0.240063, 0.94312, 0.247147, 0.294176, -0.78849, -0.750734, -0.830364, 0.760628, -0.179873, -0.451887, 0.839719, -0.348655, -0.319758, 0.983468, -0.284808, -0.54909, -0.15831, -0.0203313, 0.951728, 0.620078, 0.749453, -0.644816, -0.248381, -0.477342, 0.000225191, -0.0985248, 0.936504, -0.792225, 0.480904, -0.264626, -0.66145, -0.22372, -0.28138, -0.604385, 0.857087, 0.859068, 0.823421, -0.739348, -0.00488007, -0.370679, -0.0260989, 0.68201, -0.931532, 0.389025, 0.300804, -0.117549, -0.367289, -0.731699, -0.283012, 0.815295, 0.529446, 0.456464, 0.697442, 0.783902, -0.225272, 0.013658, 0.75246, -0.482268, -0.131011, 0.975276, 0.923844, 0.210207, -0.34552, -0.649419, 0.925084, 0.83853, -0.485521, -0.925075, 0.145571, -0.462119, -0.280162, 0.811296, 0.751145, 0.522349, 0.176191, 0.876155, 0.679382, -0.187093, 0.571584, -0.00900307, -0.726373, -0.771471, -0.18187, -0.217981, 0.365383, 0.325985, 0.537521, -0.344203, -0.661866, 0.00700234, -0.334364, -0.372583, 0.785311, -0.549533, -0.44662, -0.842336, -0.0701128, 0.133552, -0.0217916, -0.00573022, -0.0300257, 0.88566, 0.676521, -0.547019, 0.689804, 0.0565539, 0.881955, 0.227632, 0.79157, -0.619639, 0.292323, 0.180774, 0.402931, 0.636483, 0.587582, -0.501295, 0.805966, -0.368195, 0.381383, 0.513524, -0.424061, 0.0716517, 0.260573, -0.807762, 0.611938, -0.0594692, 0.642064, 0.651422, 0.864185, 0.792235, -0.166754, -0.390888, -0.712949, 0.454586, 0.335032, 0.804735, -0.542423, 0.735132, 0.0768145, -0.743566, -0.299202, -0.672984, 0.0602824, -0.335686, 0.842149, -0.606094, -0.228025, 0.514043, -0.516327, -0.844241, -0.106674, 0.163403, 0.741577, -0.653008, -0.962054, -0.3528, 0.155576, 0.769749, 0.915518, -0.633163, -0.206516, 0.689813, 0.0603037, -0.747982, -0.53286, -0.52755, -0.647041, 0.816066, -0.27012, -0.688939, 0.320151, 0.934493, 0.4822, 0.629906, -0.619337, 0.166519, -0.372922, 0.589779, -0.739714, -0.644279, -0.112552, 0.902188, -0.691731, 0.0969688, 0.165272, -0.258067, -0.320757, 0.399907, 0.791103, -0.459434, 0.250272, 0.998042, -0.833886, 0.363313, -0.714213, 0.00703902, -0.0537403, 0.893511, -0.599258, -0.541481, 0.0774816, -0.393091, 0.893034, -0.95842, -0.628142, -0.796042, -0.429747, -0.54972, 0.0566979, 0.0882105, -0.0037374, 0.568117, -0.615971, 0.32891, 0.646753, -0.639674, 0.962212, 0.137413, -0.488366, 0.101621, -0.921023, 0.717049, 0.364659, 0.777733, 0.0221408, 0.973605, 0.110848, -0.366554, -0.572453, -0.483438, 0.715323, -0.370484, -0.0380092, 0.592057, 0.178188, 0.811265, 0.448859, 0.986947, 0.558432, 0.990726, 0.441232, -0.531314, -0.960427, -0.632609, 0.496717, 0.0617971, -0.48421, -0.774428, -0.293733, -0.0538891, -0.643879, -0.184528, 0.0880913, -0.195384, -0.492773, 0.276529, 0.374596, 0.864113, -0.943468, 0.0927738, 0.343333, -0.723488, 0.892415, -0.1395, -0.592822, 0.803424, 0.78016, -0.491054, 0.910783, -0.591547, 0.765955, 0.385711, -0.523219, -0.971859, 0.569733, 0.193255, 0.10887, -0.529567, 0.109246, 0.207191, -0.445594, -0.580356, 0.608989, 0.736525, 0.280119, 0.820951, 0.655158, -0.389026, -0.898941, 0.816936, 0.453059, 0.68618, 0.83141, 0.0813426, 0.707297, -0.399686, 0.775104, -0.567797, 0.964016, 0.0316464, -0.81684, 0.804373, 0.462197, -0.432233, 0.898839, 0.897787, -0.765682, -0.250589, 0.552682, 0.57937, 0.875427, -0.75757, -0.482529, -0.53344, 0.265102, -0.282063, 0.0882412, 0.461038, -0.948303, -0.505544, 0.272066, 0.619309, 0.306863, 0.798595, 0.877565, 0.721994, -0.620982, 0.487517, 0.915962, -0.721297, -0.880892, 0.437824, 0.213609, 0.909442, -0.370509, -0.487889, 0.430797, -0.90408, -0.0111832, 0.304769, 0.985203, -0.913347, -0.212896, 0.687937, 0.552739, -0.776872, -0.475397, -0.792843, 0.820257, -0.220578, 0.161692, 0.64184, 0.112885, 0.312998, 0.924665, 0.105023, 0.25344, 0.186407, -0.400539, -0.633592, -0.599444, 0.280956, -0.313104, -0.205777, -0.674107, -0.363271, 0.559813, 0.748199, 0.32149, 0.0491625, 0.456102, 0.176653, -0.186361, 0.412899, -0.346616, -0.49941, -0.702155, -0.569329, -0.987517, 0.541566, 0.875237, 0.487213, 0.545642, -0.201606, -0.502355, -0.593828, 0.935993, 0.728464, 0.395511, 0.264505, 0.337047, -0.533109, -0.594862, -0.593193, 0.225896, 0.140033, 0.783898, -0.20604, 0.807232, 0.92766, 0.565223, -0.116045, -0.0980812, 0.813149, -0.634261, 0.457222, -0.781953, -0.00191647, 0.534019, 0.704038, 0.588208, 0.994726, -0.0805593, -0.0129282, -0.17942, -0.116324, -0.276962, 0.634375, -0.441829, 0.121903, -0.691166, 0.75165, 0.211539, 0.349754, -0.641618, 0.753397, 0.40482, -0.387828, 0.530873, -0.0331524, -0.83703, -0.5261, -0.118022, 0.457713, -0.701601, -0.469714, -0.692798, -0.430674, 0.236421, 0.617247, 0.569282, 0.0494534, 0.464582, 0.83263, -0.483361, 0.318438, -0.672532, 0.939054, -0.658092, -0.346154, -0.86877, 0.836355, 0.12287, 0.695452, -0.247917, 0.600816, 0.463551, -0.230436, -0.221476, 0.369549, -0.694994, -0.613677, -0.0829657, 0.116442, -0.311633, -0.00412968, -0.31079, -0.96619, -0.350895, -0.0589104, -0.613642, 0.251815, 0.50884, -0.400634, -0.106982, 0.966583, 0.966942, 0.448488, -0.323455, 0.328494, -0.568473, -0.309997, -0.789895, 0.0653738, -0.958702, -0.819975, -0.0817711, -0.0548201, -0.998424, -0.457417, -0.653812, -0.708341, -0.990137, 0.519023, 0.971636, 0.665601, 0.793922, 0.796206, 0.689537, -0.270627, 0.249436, 0.272839, 0.160876, -0.364448, 0.127533, 0.0189666, -0.251944, -0.313772, -0.209365, -0.353559, -0.105164, -0.604559, 0.700813, 0.930337, 0.129512, -0.319058, -0.595421, -0.388171, -0.513816, -0.0585749, -0.226116, -0.810555, 0.740831, -0.867355, -0.392141, -0.700767, -0.761432, -0.845912, -0.513979, -0.324928, -0.0843841, -0.639029, 0.181378, 0.0673713, -0.0672626, 0.817838, 0.746034, -0.555265, -0.642377, 0.141274, 0.559632, 0.72292, 0.527943, -0.641292, 0.00568822, -0.405019, 0.591387, -0.972945, 0.311148, 0.214172, -0.469554, -0.907096, 0.718906, 0.347055, -0.0211684, -0.626076, -0.330879, -0.71816, 0.353316, -0.861008, 0.259097, 0.17636, -0.387613, 0.724012, 0.0661856, -0.625149, -0.810035, -0.198666, -0.668506, 0.62317, 0.135277, 0.578907, 0.908359, -0.901279, -0.591023, 0.253158, 0.366002, 0.236607, -0.586447, 0.287601, 0.805283, -0.43683, -0.929553, -0.540474, 0.160241, 0.355536, -0.109872, -0.196768, 0.687807, -0.331057, 0.619502, 0.0160359, -0.446344, 0.620185, 0.625124, 0.620026, 0.195016, 0.849523, 0.736711, -0.885709, 0.606463, 0.600269, 0.17538, 0.0782343, 0.0284674, -0.453779, -0.065865, 0.766572, -0.103173, -0.86091, 0.180163, 0.643757, 0.223171, -0.812555, 0.941409, 0.89011, -0.624676, -0.395778, -0.976773, 0.99465, 0.608481, 0.0990905, 0.416147, 0.471357, 0.604639, 0.572406, 0.900601, -0.671054, 0.41644, -0.658074, 0.865365, -0.478626, 0.569398, 0.126418, 0.829515, 0.137548, -0.102713, 0.0851881, 0.819683, -0.330904, -0.10453, -0.872815, 0.93451, 0.615305, -0.203692, 0.298067, 0.753229, 0.326812, 0.0985921, 0.61524, -0.786768, 0.381817, -0.0956385, 0.332744, 0.193818, -0.041698, -0.815939, 0.0670555, -0.396899, -0.641364, 0.398432, -0.449913, 0.850401, -0.710737, -0.502985, 0.790709, 0.591775, 0.120446, 0.261952, -0.536441, -0.435237, 0.909393, -0.715581, 0.693808, 0.622404, 0.657063, -0.145706, 0.723026, -0.9071, 0.0126424, 0.899386, 0.687753, -0.796951, 0.185336, 0.111136, 0.774752, 0.724244, 0.544521, 0.0528283, 0.685816, 0.383645, 0.21476, 0.666368, 0.902559, -0.817068, -0.323896, 0.400695, 0.421395, -0.306101, -0.797285, -0.223034, 0.63304, -0.0416372, -0.625389, 0.776302, -0.124617, 0.995767, 0.875032, -0.409035, -0.669742, -0.34944, 0.486375, 0.183758, 0.526537, 0.919077, -0.554864, 0.864046, 0.135417, -0.244154, 0.466924, 0.251161, 0.0791973, -0.384121, -0.598424, -0.784936, 0.813556, 0.0763149, 0.873482, -0.168151, -0.496763, -0.742203, 0.904381, 0.0696974, -0.369935, -0.20942, -0.345586, 0.655041, -0.861866, 0.815249, 0.981525, 0.317814, 0.151829, -0.518932, -0.0365113, 0.989982, 0.930305, -0.567519, 0.463809, -0.0706649, -0.279481, 0.595148, -0.545374, -0.0678211, -0.683753, -0.473841, -0.944758, 0.457355, -0.767657, -0.970019, 0.275814, -0.205917, 0.0482642, -0.964503, 0.391888, -0.896693, -0.817832, 0.965013, 0.605886, -0.948174, 0.1837, -0.0546135, 0.335519, 0.745593, 0.668485, -0.504553, 0.0880158, -0.855331, 0.652489, -0.0125865, 0.232497, -0.29316, -0.532464, -0.0259438, 0.630604, -0.948571, 0.279301, 0.448701, -0.245593, -0.088399, 0.900723, -0.10908, 0.222343, 0.439692, -0.934143, -0.734068, 0.778692, -0.789917, 0.35126, -0.243874, -0.209483, 0.308202, -0.738974, 0.00185158, 0.25261, 0.628169, 0.201336, 0.587899, -0.501787, -0.548095, 0.483797, 0.942553, 0.688522, -0.516394, 0.304458, -0.571873, 0.183582, 0.749573, -0.305791, 0.105045, -0.588504, -0.768932, 0.276944, 0.214864, -0.0140885, -0.840674, 0.43807, 0.291004, -0.517901, 0.0209295, 0.0376369, -0.0559126, -0.166279, 0.91526, -0.88326, -0.880619, 0.760298, 0.957059, 0.557998, 0.98271, 0.934452, 0.363516, 0.0775073, 0.519939, -0.113221, 0.746746, 0.648811, 0.0595337, 0.698587, 0.12715, 0.136208, -0.851374, -0.344398, 0.766433, -0.323868, -0.784542, 0.380626, 0.766324, -0.852562, -0.566276, -0.908365, -0.35202, 0.404234, 0.318191, 0.948241, 0.900843, 0.166657, 0.373497, 0.165146, 0.384178, 0.603974, 0.196637, 0.912467, -0.342798, -0.803469, -0.930471, 0.700768, 0.555003, -0.902128, 0.343356, 0.0584034, -0.96695, -0.354601, 0.459176, -0.539852, -0.969037, -0.28375, 0.686548, -0.848597, -0.398199, -0.0584608, -0.679916, 0.302367, 0.570083, -0.567482, -0.497764, 0.147206, 0.043078, -0.107609, -0.53043, 0.460492, 0.163388, -0.440668, -0.220807, 0.363839, -0.578018, 0.600679, 0.57448, 0.0131726, -0.169197, 0.615979, 0.511608, -0.326932, 0.287606, -0.475759, 0.442862, -0.524922, -0.513795, -0.856795, -0.492112, 0.473761, 0.66195, -0.330317, 0.632104, -0.911507, -0.381085, -0.278941, -0.116153, -0.920964, 0.259309, 0.668658, -0.476231, 0.0840853, 0.337846, -0.344991, -0.715765, 0.788588, 0.16241, 0.606477, 0.433496, 0.215488, 0.162098, -0.334605, 0.226741, 0.430469, -0.907933, -0.569166, -0.675237, 0.428577, 0.564779, 0.725879, 0.395494, 0.750445, 0.702994, 0.513362, 0.689086, -0.922234, -0.372455, 0.6964, -0.124593, 0.225563, 0.634217, 0.290435, 0.17654, 0.266081, -0.667048, 0.433546, -0.936517, 0.801719, 0.898501, -0.366903, -0.262868, 0.90785, -0.402511, 0.270108, -0.0670145, -0.352678, 0.201509, -0.366084, -0.225229, -0.174252, -0.656669, 0.0951924, 0.614099, 0.33984, -0.0494643, -0.19368, 0.466022, 0.836208, 0.146966, 0.830718, -0.265007, 0.160712, 0.955393, -0.915511, -0.443546, 0.28119, -0.300371, 0.638238, -0.259196, 0.648865, 0.909636, -0.24049, -0.848953, -0.9545, -0.58992, 0.703495, 0.304141, -0.386571, 0.989375, 0.851426, -0.77516, 0.411333, 0.269263, -0.82692, -0.68384, -0.762507, 0.679334, -0.5489, -0.540262, 0.163336, 0.0482503, -0.39642, -0.432573, 0.683417, 0.737337, 0.149338, 0.94677, -0.142626, 0.681631, 0.360779, -0.692033, -0.866795, 0.312334, 0.41196, -0.995646, 0.79064, -0.77186, -0.990798, -0.865209, -0.908932, 0.00540781, 0.776697, 0.424385, 0.931198, 0.407065, 0.955976, -0.136663, -0.0706355, -0.924934, -0.615744, 0.637956, 0.440423, 0.106525, 0.38269, 0.66207, -0.807181, 0.635987, -0.863452, 0.217442, -0.945488, -0.73144, -0.398403, 0.419671, 0.34483, 0.74487, -0.126455, 0.0501631, 0.196487, 0.01199, -0.730745, -0.0182542, 0.325307, 0.593627, -0.502574, 0.945974, 0.849309, 0.186643, 0.712252, 0.648545, -0.581834, 0.112696, -0.625725, 0.385944, -0.0835489, 0.349127, 0.701589, -0.848517, -0.941588, -0.572803, -0.306731, 0.751458, -0.697775, 0.353117, 0.828687, -0.171663, 0.899746, -0.827355, 0.0342007, -0.980591, -0.340679, 0.175815, -0.861816, 0.369174, 0.15427, 0.801381, 0.485273, -0.197495, -0.330224, -0.320482, 0.745809, -0.203745, -0.0180906, 0.31127, 0.769453, 0.555284, 0.568504, -0.63076, 0.887523, -0.391525, -0.814847, -0.6828, -0.206719, 0.654136, 0.518645, -0.797008, -0.944949, -1.5951e-05, 0.606014, -0.84978, 0.778165, -0.595314, 0.782968, 0.760397, 0.672039, 0.136712, -0.574789, -0.205321, 0.375647, 0.919203, -0.692155, 0.429563, 0.754171, 0.799013, -0.516599, 0.958351, 0.708913, -0.646203, 0.297793, 6.36678e-05, 0.647821, 0.245873, 0.0621739, -0.873532, -0.135581, -0.542767, 0.249483, 0.0734689, 0.746491, -0.490766, -0.409601, -0.174141, 0.840228, -0.627913, 0.577769, -0.976873, -0.464871, -0.048765, 0.974907, -0.787233, -0.80232, -0.888241, 0.831652, 0.301104, -0.648476, -0.442546, 0.9671, 0.340488, 0.877954, 0.501532, -0.691362, 0.0653023, -0.762259, -0.427042, 0.576685, -0.427593, 0.196926, -0.602433, -0.308753, 0.0200415, -0.612608, -0.15708, 0.476571, -0.492291, 0.632413, -0.338337, 0.771129, 0.706834, 0.0585001, -0.0110831, 0.983762, -0.531995, -0.0645184, -0.27443, 0.617892, 0.806029, 0.45688, -0.470712, 0.762177, 0.0234635, 0.637349, -0.72787, -0.470874, -0.0752009, -0.0882555, -0.70163, -0.213588, 0.741088, -0.613251, 0.214163, 0.529949, 0.880493, 0.58913, 0.59595, -0.882734, -0.102858, 0.73046, -0.280313, -0.503191, 0.40002, -0.0817465, -0.00101533, -0.306014, 0.248242, -0.842596, 0.206338, 0.788754, 0.566117, 0.926918, -0.498247, 0.529604, 0.79509, 0.193918, 0.16718, 0.595064, -0.327673, -0.563799, 0.66377, -0.229245, 0.301737, -0.420248, -0.0293515, -0.727421, -0.324189, -0.990771, 0.271569, -0.984647, -0.0522941, -0.992606, -0.400669, -0.25506, 0.741327, 0.0909274, 0.851008, 0.290875, 0.334918, 0.768109, -0.805488, -0.334663, 0.850833, 0.923898, -0.905391, 0.966288, 0.376457, -0.357711, -0.948837, -0.783728, -0.956298, 0.693087, 0.385657, -0.712944, 0.757345, 0.952201, 0.281315, -0.888274, 0.0870381, 0.811433, -0.786569, 0.968799, -0.382986, 0.758676, 0.101818, -0.513512, 0.245173, -0.392067, 0.32106, 0.196436, 0.589096, 0.728923, 0.937111, -0.490565, 0.217217, 0.365027, -0.716718, 0.065902, -0.906055, 0.929015, -0.425842, 0.425415, 0.453654, 0.884189, -0.423859, 0.101552, 0.0801265, 0.863502, -0.26724, 0.94808, 0.657734, 0.975307, -0.489029, 0.452258, 0.00182197, 0.999272, 0.419418, 0.536253, -0.136107, 0.865795, 0.214041, -0.727615, 0.505228, 0.401422, -0.404451, -0.226853, -0.72987, 0.547507, -0.829039, 0.81222, 0.758919, -0.808145, -0.886919, 0.633116, 0.866561, 0.254087, 0.861074, 0.958855, -0.906983, 0.873398, -0.827035, 0.433805, -0.898208, 0.556537, -0.525328, -0.565807, -0.967333, -0.502471, 0.799564, -0.727895, -0.97014, 0.0328259, 0.300719, 0.292899, -0.75989, -0.427104, -0.119195, -0.874951, 0.895057, 0.560373, -0.715209, 0.528475, 0.512602, -0.413579, 0.385191, 0.916377, 0.293947, 0.455304, 0.0547501, 0.279828, -0.256439, 0.905384, 0.822414, -0.300928, 0.164618, -0.829535, 0.141067, -0.769899, 0.202619, -0.682869, -0.892383, -0.842496, -0.775904, -0.396876, -0.968512, -0.397323, -0.514288, 0.371955, 0.47149, -0.684919, -0.0960801, -0.667215, 0.384051, -0.982922, -0.555961, 0.581861, -0.500954, 0.940932, -0.346726, 0.0973899, 0.764919, -0.0926909, -0.529577, -0.529993, -0.739651, 0.172868, -0.363499, -0.68132, -0.68381, -0.405282, 0.89133, 0.0166453, -0.31521, -0.221854, 0.102301, -0.969443, 0.478186, 0.725985, 0.87599, -0.396496, -0.575113, 0.646402, 0.910833, -0.237122, -0.536896, -0.961082, 0.175388, 0.072759, 0.595506, 0.931324, -0.573989, -0.49874, -0.155926, -0.626914, 0.941592, -0.0278487, -0.913946, -0.118661, 0.692535, -0.681596, 0.90242, 0.543941, 0.23101, 0.0837857, 0.373802, -0.12549, -0.784206, 0.484663, -0.573322, -0.762789, 0.691343, -0.593634, 0.410688, -0.450144, -0.629383, 0.0810348, -0.0521056, 0.573712, -0.908594, 0.491311, 0.0074283, 0.0711526, -0.115953, -0.501016, 0.036111, -0.237111, 0.306619, -0.682334, -0.719315, 0.994851, 0.704755, -0.157563, -0.486539, -0.616399, -0.317057, 0.683176, 0.011284, 0.558198, -0.0679961, -0.0978831, -0.0386635, -0.00321128, 0.418834, 0.484067, 0.429469, 0.148976, -0.0194985, -0.146245, 0.558526, -0.498154, -0.604139, 0.700769, 0.0830675, -0.837478, 0.281187, 0.633645, 0.915651, 0.0496448, 0.261142, 0.784475, 0.831781, -0.413605, -0.695524, -0.481025, 0.0762468, 0.945515, -0.950685, 0.846991, 0.379347, 0.155593, 0.980214, 0.00350467, 0.729774, 0.636586, -0.495158, -0.735666, 0.400803, 0.824557, -0.0677282, 0.0709684, -0.161585, -0.359894, 0.445839, -0.247784, -0.106684, -0.959921, -0.804831, 0.610958, 0.733655, 0.708024, 0.650818, -0.410672, -0.361617, 0.406546, -0.769215, -0.458449, 0.389166, -0.512256, 0.097377, 0.806096, -0.967086, -0.831109, 0.740251, 0.288596, 0.0787125, 0.709134, -0.90378, -0.513208, 0.761373, 0.293609, -0.0169612, 0.491506, -0.721583, -0.966099, 0.312878, 0.883713, 0.741581, 0.252142, -0.245506, -0.819226, 0.22974, -0.728587, 0.251536, -0.968814, 0.269213, 0.0195067, -0.0666002, 0.687458, 0.0638202, -0.316608, 0.785993, -0.207453, -0.959079, 0.316356, -0.11255, -0.846292, -0.0494595, 0.559153, -0.545114, 0.232752, 0.915325, 0.358661, 0.610613, -0.629762, -0.101861, 0.872976, 0.295794, 0.501486, 0.577235, -0.878779, 0.996029, 0.35256, 0.433932, -0.795085, 0.609419, -0.0676847, -0.39363, -0.718406, -0.204629, 0.903928, -0.873135, 0.113197, 0.203948, -0.119388, -0.335265, 0.0145902, 0.115466, -0.218173, 0.152784, 0.586497, 0.287321, 0.625139, -0.652584, 0.24143, 0.216503, 0.296352, 0.324138, -0.109868, 0.470045, -0.963473, 0.112887, -0.601016, 0.215344, 0.286583, 0.507252, -0.101292, 0.912611, -0.849495, 0.640363, 0.516294, 0.473672, -0.385061, 0.348597, -0.0968619, -0.873782, -0.365468, -0.0420411, 0.61081, 0.429701, 0.060052, 0.201643, -0.104209, -0.359934, -0.75557, 0.102387, 0.899645, 0.703325, -0.151079, 0.492634, 0.655619, 0.427414, 0.77245, -0.373818, 0.715042, -0.190135, -0.228322, 0.31561, -0.559933, -0.370302, 0.406662, -0.596532, -0.818341, 0.576914, 0.948822, 0.776027, -0.892312, 0.778712, 0.736038, -0.729055, 0.147794, 0.925667, 0.921251, -0.230524, 0.670157, 0.947705, 0.9463, -0.998673, -0.540006, 0.0692182, -0.953927, 0.828517, -0.443965, 0.0664326, -0.0897448, 0.442466, -0.535513, -0.809743, -0.0199533, 0.0891112, -0.811863, -0.734456, -0.518041, -0.438618, 0.75077, -0.652333, 0.647909, 0.564453, 0.163448, -0.721766, -0.783434, 0.480398, -0.0348976, 0.646354, -0.296599, -0.472743, -0.409877, 0.430305, -0.902515, 0.39214, 0.743046, 0.927581, 0.430144, -0.478493, 0.009421, -0.0135661, 0.346975, 0.376846, 0.73489, -0.00797562, -0.936704, -0.968351, -0.413555, -0.324137, 0.995722, -0.0704123, -0.510964, 0.0847734, 0.00175203, 0.266075, -0.409274, -0.779028, 0.787974, -0.988382, 0.264224, -0.444028, 0.0663936, -0.432735, -0.316588, -0.186626, 0.0180904, 0.67348, 0.851972, -0.134313, -0.0882424, 0.731558, 0.731797, 0.833116, 0.110641, -0.980651, 0.932474, 0.65745, -0.780906, -0.513264, 0.203344, -0.789715, -0.133198, -0.295284, -0.731694, 0.123599, 0.727255, -0.0969841, 0.787425, 0.922723, 0.304784, 0.958506, 0.348549, -0.938416, -0.352654, 0.929636, 0.985621, 0.325977, 0.0269519, 0.586163, -0.676796, 0.575196, 0.20617, -0.350684, -0.917638, -0.473483, -0.677427, 0.602713, 0.591966, -0.233681, -0.848504, -0.216066, 0.867594, -0.776447, 0.012583, 0.451842, 0.563245, 0.186666, -0.643383, 0.224427, -0.76108, 0.220635, 0.212067, 0.485077, 0.82075, -0.280903, 0.102544, 0.938186, -0.988615, 0.468413, -0.409224, -0.705214, 0.896536, 0.295244, -0.474652, 0.55006, -0.168746, -0.400276, -0.364274, 0.545814, 0.926724, 0.730799, -0.852378, 0.537116, 0.89234, -0.337489, -0.55569, 0.366197, 0.865969, -0.65463, 0.226289, 0.946594, 0.467438, -0.60293, -0.752165, 0.555752, -0.120403, -0.542337, -0.292109, -0.385951, 0.575622, 0.73725, 0.525437, -0.940173, -0.734736, 0.789549, -0.447165, 0.758585, -0.138326, 0.96474, 0.00632928, 0.0978587, -0.791237, -0.843064, -0.0832204, -0.199544, -0.31899, 0.764843, 0.915207, 0.991447, 0.573549, 0.00877557, -0.739357, -0.374274, 0.47448, 0.849599, -0.668145, 0.183392, -0.291403, 0.461753, -0.74966, -0.0933533, 0.718063, -0.944099, 0.902694, 0.625787, 0.0569284, -0.990298, 0.901105, 0.802242, -0.0923013, 0.249039, 0.177414, 0.41546, -0.989737, 0.149997, 0.130719, -0.11868, -0.572666, 0.922584, 0.316881, 0.652641, 0.694972, 0.253631, -0.182034, -0.490705, -0.656989, -0.75211, -0.77708, 0.973706, -0.95389, 0.88996, -0.921477, -0.812123, -0.585883, -0.677466, -0.772752, 0.515974, -0.683356, -0.581559, -0.756924, 0.950732, -0.864256, -0.226916, 0.344149, -0.783753, 0.253486, -0.650761, 0.846495, 0.852204, 0.34642, -0.500286, 0.780425, -0.943098, -0.0231711, -0.810452, 0.519608, -0.894454, -0.00640614, -0.312961, -0.54267, 0.209982, -0.0982444, -0.87745, -0.828789, -0.0466506, 0.697419, 0.983978, 0.705422, 0.281296, 0.769165, 0.384336, 0.442831, 0.736596, 0.560372, 0.942425, 0.929336, -0.63337, -0.667992, -0.590397, -0.825618, -0.168888, -0.0700035, 0.157223, 0.657685, -0.921494, 0.504607, -0.494865, 0.792497, -0.442801, -0.0615182, -0.674691, 0.939182, -0.090727, 0.211776, 0.754139, -0.284246, -0.217323, 0.955857, 0.714296, -0.0121324, -0.690387, 0.257873, 0.653271, -0.892587, -0.74775, -0.359495, 0.375191, -0.595641, -0.946826, 0.144085, 0.829332, -0.457629, 0.719311, -0.0430513, 0.832132, -0.753919, 0.155237, -0.093311, 0.106117, 0.908716, -0.373138, 0.608084, 0.894876, -0.288117, 0.889188, -0.396923, -0.210072, 0.935555, 0.761521, 0.495075, -0.905562, 0.938299, -0.107598, -0.548902, -0.589318, 0.490446, 0.84857, -0.548371, 0.217306, -0.535734, 0.0195072, 0.141749, -0.195434, -0.224007, -0.756437, 0.383941, -0.595964, -0.409652, 0.438443, -0.895245, -0.7563, -0.716203, -0.479036, -0.0742869, -0.491552, 0.837087, 0.753503, -0.596453, -0.822353, -0.774359, 0.131924, 0.169285, 0.119025, 0.055227, -0.99617, 0.748765, 0.0229976, -0.228037, -0.399562, -0.888255, -0.556167, -0.638093, 0.377058, 0.930611, 0.398327, 0.111019, 0.713949, -0.229241, 0.929093, -0.843964, 0.505569, 0.487399, 0.257771, 0.460385, 0.873804, 0.494117, -0.307727, 0.141244, 0.624262, -0.328069, 0.0365804, 0.107454, 0.710567, 0.33237, -0.771996, 0.372574, -0.0789342, -0.803195, -0.0862231, 0.907932, 0.430402, 0.415378, -0.661496, -0.909629, 0.368678, -0.353318, 0.317701, 0.799939, 0.915419, -0.0409848, -0.0848193, 0.893972, 0.765657, -0.221011, 0.243716, -0.599509, 0.347766, -0.659951, -0.849401, -0.460944, 0.386187, -0.753643, -0.670431, -0.786992, 0.142508, -0.318402, -0.94162, 0.271477, -0.461599, -0.572169, -0.507355, -0.537959, 0.651955, -0.814733, 0.788594, -0.156463, -0.85837, 0.0728732, 0.070312, -0.370555, -0.307855, -0.521647, 0.28712, 0.76559, 0.66005, -0.400526, -0.258092, 0.102155, -0.671982, -0.40532, -0.623606, 0.139308, 0.240281, -0.0103769, 0.457247, -0.522916, -0.84941, -0.887327, 0.370865, 0.546006, 0.223322, -0.656592, 0.7749, 0.580625, 0.547983, -0.971503, -0.200431, 0.429683, 0.151839, 0.237264, 0.952581, 0.0416823, -0.657177, 0.760027, 0.265156, 0.902877, 0.103705, 0.953221, 0.19811, -0.650001, 0.818504, 0.60793, 0.0572044, -0.078743, -0.291632, 0.232698, -0.503855, 0.841108, 0.647772, -0.448329, 0.648867, 0.338344, 0.240087, 0.510986, 0.150951, 0.888493, 0.714402, -0.98861, -0.611211, 0.616644, 0.214258, 0.925562, 0.736995, -0.621356, 0.502119, -0.71859, -0.816897, 0.880363, 0.331542, -0.445078, 0.975743, 0.346666, 0.021981, -0.379766, -0.770544, -0.614521, 0.00594553, 0.808854, 0.890966, 0.471379, -0.0457159, 0.324536, -0.599473, 0.41865, 0.49479, -0.593494, -0.930739, -0.0650668, 0.0325539, 0.400616, -0.192569, 0.983245, -0.365797, 0.88078, 0.664483, 0.17074, 0.509646, 0.0363833, 0.915068, -0.336934, -0.678247, -0.533696, 0.399325, 0.601373, -0.358884, 0.315814, 0.364728, -0.396097, 0.327115, 0.392239, -0.96208, -0.391837, 0.701857, -0.699409, -0.598774, 0.0555567, -0.23169, -0.643182, -0.0677033, 0.793556, 0.270942, -0.455192, 0.236857, -0.27638, 0.456247, 0.589389, -0.712512, 0.792555, 0.288552, 0.0178008, 0.308585, -0.931088, -0.503155, 0.74817, 0.672397, -0.733708, -0.430954, -0.476841, 0.157828, 0.877159, -0.519617, -0.208381, 0.807803, -0.229628, 0.661932, 0.0835451, 0.884548, -0.424864, 0.523479, -0.838279, 0.521024, -0.640767, 0.459276, 0.309097, 0.735271, 0.670719, -0.284824, 0.859295, -0.741116, -0.680082, -0.915297, -0.0184071, 0.588604, 0.532178, 0.606549, 0.854276, 0.955568, 0.716602, 0.318604, -0.84547, -0.864748, 0.791365, 0.799154, -0.556334, 0.424218, -0.457588, -0.0467878, -0.314011, -0.552148, -0.168724, 0.53098, 0.571559, 0.540539, -0.00156813, -0.666137, -0.0876693, 0.243492, 0.601201, 0.985891, -0.387396, -0.77221, 0.719804, 0.842582, 0.0120968, -0.289578, 0.600483, 0.122602, -0.356334, 0.126101, -0.978925, 0.720866, 0.819059, -0.130392, 0.240799, 0.823983, -0.557929, 0.843436, 0.374763, 0.229913, 0.950804, 0.929088, -0.237546, 0.0757972, -0.621051, 0.65408, 0.284476, -0.859319, 0.357148, 0.891559, -0.327748, -0.0729518, -0.975786, -0.087485, 0.0169011, 0.411572, -0.628547, -0.11461, 0.838185, 0.352183, 0.172386, 0.978291, 0.881774, -0.915141, -0.992293, 0.143237, -0.909669, 0.176107, 0.263206, -0.996369, -0.265438, 0.8711, -0.309141, 0.233712, 0.359767, -0.605317, 0.773756, 0.393792, -0.758774, -0.203776, 0.647884, -0.0390145, 0.848287, -0.109604, -0.736768, 0.331289, -0.373799, -0.180015, -0.743029, -0.80239, -0.384399, 0.110527, 0.509178, 0.808088, 0.963212, -0.807282, -0.629679, 0.0705471, 0.46226, 0.0862096, -0.128644, -0.0401439, -0.498044, 0.961297, -0.794628, -0.622711, 0.438459, -0.0400685, 0.448106, 0.0318676, -0.552337, -0.636243, 0.206843, -0.348523, -0.883768, -0.282627, 0.0297187, -0.867522, -0.728259, -0.292426, -0.217153, 0.964287, -0.83189, 0.508383, 0.466563, 0.60522, -0.555466, -0.12802, -0.182185, -0.487351, -0.998229, -0.274929, 0.75149, -0.18019, -0.269201, -0.529093, 0.264746, -0.859281, -0.185986, -0.231832, -0.926785, 0.488043, -0.688098, 0.0727782, 0.80674, -0.780572, -0.652013, 0.575637, -0.968858, -0.825161, 0.569493, 0.0126776, -0.909705, 0.427352, -0.799956, -0.699458, 0.54478, -0.280893, -0.495355, -0.338565, -0.407035, 0.756281, -0.21684, 0.503279, -0.799571, 0.329577, -0.518056, -0.153556, 0.826316, 0.405241, -0.531192, -0.124953, 0.199021, -0.125861, 0.00890925, 0.619986, 0.0324347, 0.145052, -0.229378, -0.574831, 0.126654, -0.883153, 0.867426, 0.489041, 0.098224, 0.686188, 0.409661, -0.963955, 0.39747, -0.955732, -0.890271, -0.827655, -0.529622, 0.952635, -0.971449, 0.539844, 0.642387, 0.765314, 0.560107, 0.938744, 0.165025, 0.672243, 0.985962, -0.293116, -0.628441, -0.607483, -0.854414, -0.626001, 0.769883, 0.158201, 0.194766, 0.552381, -0.390477, 0.358981, 0.749729, 0.796058, -0.876231, 0.406872, 0.99583, -0.186066, 0.449779, 0.933706, 0.365101, 0.533752, -0.66442, 0.496803, 0.507079, 0.328958, -0.397851, -0.840765, 0.0124128, 0.709942, 0.155978, -0.652886, 0.0791934, 0.0926259, 0.549454, 0.705968, -0.993298, 0.0905284, -0.190637, -0.0754581, 0.378814, -0.842708, 0.571098, 0.799873, -0.584601, 0.950809, 0.178083, -0.944469, 0.424061, -0.201647, -0.394591, -0.513724, 0.58909, -0.515939, 0.0657427, 0.550161, 0.321556, -0.398077, -0.926217, -0.587046, 0.713143, -0.135611, -0.283852, 0.468065, 0.517563, 0.0900604, -0.741701, 0.295701, -0.177949, 0.951615, -0.994409, 0.599954, 0.0689191, 0.292858, 0.704152, -0.208693, 0.925751, -0.594025, 0.570505, 0.786181, -0.818617, 0.581044, 0.0751855, -0.0159075, 0.700897, 0.829152, 0.865615, -0.20776, -0.65406, -0.875242, -0.0108919, 0.650957, -0.846851},
-	{0.541441, 0.585943, -0.721185, -0.717823, 0.120118, 0.890574, -0.960568, -0.408366, -0.225623, 0.754417, -0.0099084, -0.899141, -0.455898, -0.278575, 0.250216, -0.0512098, 0.505951, 0.647214, 0.987593, -0.570647, 0.793838, 0.667698, 0.995377, -0.671269, -0.0826916, 0.0155258, -0.147942, 0.169877, -0.629807, -0.379114, -0.625964, -0.0573398, 0.0600185, -0.311512, -0.778543, 0.851638, -0.986205, -0.0365904, -0.140618, -0.250227, -0.707945, -0.197019, -0.853886, -0.868783, 0.658688, -0.376904, 0.160584, 0.972992, -0.305554, -0.146052, -0.596078, 0.31577, 0.930064, 0.698994, -0.468195, -0.885094, -0.27819, -0.906292, -0.857401, 0.672268, 0.612431, 0.983135, 0.820152, -0.996273, -0.556067, 0.669949, -0.266329, -0.321286, -0.27253, -0.282589, -0.330139, 0.246362, 0.153306, 0.561648, 0.56226, 0.977627, -0.625528, -0.394829, 0.175606, -0.0932244, 0.612415, 0.224204, -0.713258, 0.924344, -0.170555, 0.64802, -0.585191, 0.512369, 0.667829, -0.68003, -0.280364, -0.743402, 0.230217, -0.520495, 0.215068, -0.976181, -0.366945, 0.159329, 0.684831, 0.0315691, -0.895711, -0.907465, 0.3338, 0.937777, 0.812396, -0.0289603, 0.989226, -0.215351, -0.265099, 0.609379, 0.630138, -0.675208, -0.314215, -0.71439, 0.53831, -0.659698, 0.278683, 0.891974, 0.508593, -0.318225, -0.703296, -0.00757521, 0.963042, 0.0594173, 0.746076, -0.175872, 0.530156, -0.866077, 0.660542, -0.475456, -0.566174, 0.265912, -0.75708, 0.0651172, -0.0142316, -0.225769, 0.523438, -0.452231, 0.0787061, -0.313786, -0.221328, -0.96935, 0.850682, 0.941658, -0.716159, -0.285383, 0.765566, 0.00705481, 0.658104, 0.398888, -0.763512, 0.551695, 0.149594, -0.44372, -0.106516, -0.402904, -0.0098424, -0.676804, 0.573123, 0.852532, 0.280174, -0.743565, 0.872925, -0.77066, -0.798719, 0.865254, 0.372544, -0.225676, -0.0989294, 0.0346941, -0.0841573, -0.667026, 0.82015, 0.750268, -0.124891, -0.83564, 0.267774, -0.507805, -0.6189, -0.510205, -0.569697, -0.958587, -0.648487, -0.668643, -0.504969, -0.370536, -0.832852, -0.820862, -0.0107402, 0.800504, -0.202319, -0.961849, -0.685118, 0.0711208, -0.783426, -0.263219, -0.810885, -0.475049, 0.481936, 0.54914, -0.860089, 0.624369, -0.680404, -0.907843, -0.478914, -0.481396, 0.108798, 0.29759, -0.147283, -0.921111, -0.211696, 0.739635, 0.503853, 0.336527, 0.953758, 0.51304, 0.827857, -0.716842, -0.860264, 0.262612, 0.0770589, 0.0945393, 0.238241, 0.16213, -0.00974865, 0.226973, 0.384955, -0.254791, -0.116535, 0.755066, 0.518588, -0.50674, 0.0890799, -0.0344393, -0.49853, -0.699336, 0.658379, 0.0854172, 0.863076, 0.851776, 0.746272, -0.55559, 0.39796, 0.590296, -0.684926, 0.136582, -0.120791, -0.202365, -0.968312, -0.0488354, -0.982437, 0.161449, -0.132109, 0.0855391, -0.899259, -0.69252, 0.452846, -0.625309, -0.850883, -0.321708, -0.974534, -0.244379, 0.750773, 0.830854, -0.757778, 0.441898, 0.392657, -0.92634, 0.320391, -0.913656, -0.301898, 0.0100752, -0.58471, 0.580171, 0.599776, 0.644807, -0.0452223, -0.782304, -0.124679, 0.963274, -0.768053, -0.0951481, -0.644981, 0.138969, -0.366056, -0.341982, 0.979736, 0.701712, -0.958519, 0.916563, 0.355487, -0.188661, 0.690998, 0.612727, -0.107867, 0.890781, -0.146763, 0.0476402, 0.850182, 0.563342, 0.288777, -0.94796, -0.039116, -0.709223, -0.421895, 0.85501, 0.783847, -0.0581546, 0.261825, 0.147069, 0.476215, -0.0671302, 0.17299, -0.0755249, 0.277977, 0.906877, 0.158912, 0.857609, 0.348504, 0.522495, 0.934796, -0.559113, -0.0217765, -0.459688, 0.488687, -0.253612, 0.606128, -0.8187, 0.383911, 0.515993, -0.256885, 0.626363, -0.356955, 0.904948, -0.961804, 0.737488, -0.42565, -0.501468, -0.960951, -0.127318, -0.513874, -0.748638, 0.800937, -0.626553, 0.627693, -0.424657, -0.189165, -0.522619, 0.0427954, -0.83817, 0.0766089, 0.73469, 0.832754, 0.342885, -0.663284, 0.339393, -0.746974, -0.471656, 0.91434, -0.804969, 0.675306, 0.0257357, 0.966855, 0.209146, 0.962863, -0.437407, -0.0518915, 0.683611, 0.405116, -0.34039, -0.151606, -0.610714, 0.100958, -0.0849969, 0.355495, 0.667639, -0.590836, 0.900502, 0.962339, -0.911098, -0.528033, 0.833721, 0.947356, -0.284016, -0.803481, 0.924341, 0.528875, -0.266035, -0.253833, -0.990415, -0.083046, -0.0409104, -0.433465, -0.55255, -0.000801945, 0.277291, -0.130118, 0.574579, 0.798258, -0.442649, 0.207911, -0.236205, -0.716004, -0.632458, 0.278803, 0.173764, -0.82484, 0.751045, -0.564149, -0.0516557, 0.716596, -0.459218, 0.756092, 0.44571, 0.361179, -0.596525, 0.278569, -0.386287, 0.679856, 0.412888, 0.787385, 0.741503, -0.339394, 0.680725, 0.61188, -0.568259, 0.150044, -0.297343, 0.29531, 0.86867, -0.752859, -0.127393, -0.536524, -0.713725, -0.143994, 0.0651005, 0.5786, -0.00136854, -0.570955, 0.782512, 0.137747, 0.146541, -0.404401, -0.930025, -0.606928, -0.150732, -0.84334, -0.150517, -0.199579, 0.53476, 0.60622, 0.383663, -0.26476, 0.629917, 0.550028, 0.061755, -0.165812, -0.13105, 0.516528, 0.474003, 0.370155, 0.372723, -0.549529, -0.145231, 0.204619, -0.814411, -0.847247, 0.669062, 0.0419799, -0.851535, 0.596477, 0.368038, 0.503923, -0.226396, -0.440336, 0.170224, 0.626182, -0.977578, -0.75615, 0.784225, -0.583734, -0.333725, -0.84688, 0.166505, -0.214735, -0.603587, -0.293594, 0.263847, -0.991258, -0.338528, 0.31274, -0.308268, -0.743934, 0.325272, -0.370798, -0.0101553, 0.348323, 0.442861, 0.49611, -0.774238, 0.427383, -0.122638, 0.48407, 0.225302, -0.452042, 0.382048, -0.067212, -0.361594, 0.941461, 0.859926, -0.86735, -0.193431, -0.45745, -0.131781, 0.94851, -0.661243, -0.375448, -0.00758265, 0.414992, -0.734045, -0.406556, 0.965675, -0.0549383, -0.371721, -0.770026, 0.330514, -0.203725, 0.172037, -0.406412, 0.277828, 0.389061, 0.985844, 0.66599, -0.634871, 0.208151, -0.439606, -0.93596, -0.536204, 0.155426, -0.882229, -0.0571336, -0.744639, -0.497101, -0.978048, 0.0407802, 0.183108, -0.814784, -0.509673, -0.179896, -0.850727, -0.708996, -0.877853, 0.244782, -0.596752, -0.421855, 0.205228, 0.348155, -0.0605603, 0.167421, 0.233266, -0.410004, 0.921706, 0.116473, 0.199241, 0.203599, -0.919819, -0.259266, 0.793008, -0.779284, -0.128451, -0.375336, 0.399174, -0.841035, 0.443507, -0.391304, -0.373743, 0.560255, 0.242619, -0.138005, 0.810218, -0.616514, 0.197317, 0.176022, 0.292661, 0.383963, 0.782361, 0.313516, 0.726787, -0.960463, 0.513811, -0.359775, -0.573609, -0.260654, -0.44247, 0.355289, -0.690819, -0.474955, -0.385565, -0.826936, 0.686792, 0.748418, -0.811145, 0.668913, -0.113198, 0.193993, 4.64482e-05, -0.261161, 0.903754, 0.219445, -0.472382, 0.550474, -0.440699, -0.355702, 0.307689, -0.0490443, -0.880361, -0.0982786, 0.62726, 0.978477, -0.360439, 0.923323, -0.206334, -0.269527, 0.43301, -0.59682, 0.556377, 0.407377, -0.348527, 0.426465, 0.389283, -0.878478, 0.741682, -0.0570992, -0.802326, -0.534625, -0.0256824, 0.215271, -0.41493, -0.0708336, -0.0578183, 0.323682, 0.690599, 0.0940669, 0.00279153, 0.772271, 0.0438281, -0.617147, 0.683176, -0.649382, -0.880572, -0.200189, 0.612652, 0.988867, 0.763821, -0.747116, -0.0670563, 0.866166, 0.729892, 0.799604, 0.159274, -0.0377921, 0.775137, -0.495997, -0.0147589, -0.354623, -0.068891, 0.188154, 0.22414, -0.069266, 0.188047, -0.393162, -0.0270128, -0.633437, -0.422833, -0.1026, -0.177204, -0.751729, 0.803905, -0.576279, -0.358099, 0.720326, -0.646665, -0.768935, -0.965272, -0.376527, 0.55188, 0.827527, 0.883157, 0.575054, -0.614452, 0.215255, 0.825982, -0.906435, -0.389734, -0.380353, -0.815443, -0.886871, -0.991184, -0.518096, 0.435375, -0.171214, 0.694853, 0.0746993, 0.805138, 0.307302, 0.346792, 0.743427, -0.685183, -0.246037, -0.132904, 0.864603, 0.888684, -0.151692, -0.55245, 0.258361, -0.2535, 0.913085, 0.415645, -0.0455648, -0.976131, -0.353516, -0.888119, -0.468294, 0.380137, -0.75964, -0.166419, 0.208936, 0.0149922, 0.443843, -0.992654, 0.81764, -0.166394, -0.933774, 0.712469, 0.240861, -0.980733, 0.85198, 0.370393, 0.74464, 0.656504, 0.778624, 0.275054, 0.650842, -0.317497, -0.0439937, -0.149447, 0.734123, 0.559047, 0.0707153, 0.542227, -0.238117, -0.0243625, 0.722895, 0.286629, -0.713936, -0.95798, 0.135185, -0.864408, 0.616574, -0.0183767, 0.142913, 0.242423, 0.0497911, -0.104847, 0.914185, 0.512586, -0.547549, -0.95502, 0.0609885, -0.463608, 0.791157, 0.377547, -0.993041, 0.587032, -0.541856, 0.886067, -0.217259, -0.970566, 0.802704, -0.847023, -0.0471124, -0.956119, 0.323936, 0.466268, 0.135302, -0.0155655, 0.86412, 0.466811, 0.74216, 0.0346145, -0.136726, 0.78651, -0.619455, -0.263423, 0.151158, -0.17996, -0.237182, -0.0142415, 0.568835, 0.152605, 0.578111, 0.157598, 0.907719, 0.748923, 0.465056, 0.930282, -0.790491, 0.987935, 0.710233, -0.585675, -0.750872, -0.773214, 0.628846, 0.486034, 0.737641, 0.623329, 0.183816, -0.303259, -0.579185, 0.893103, -0.817623, -0.609538, -0.450539, -0.0664794, 0.179631, -0.016263, -0.516838, -0.198572, 0.30339, 0.192677, -0.211343, -0.368444, 0.871713, 0.389357, 0.748578, 0.342317, -0.216294, -0.296986, -0.558526, -0.22656, 0.680243, 0.678207, -0.214012, 0.30418, 0.946949, -0.695084, -0.848831, 0.699496, -0.528252, 0.548036, -0.0757901, -0.77576, -0.72806, 0.780454, -0.461366, -0.500917, 0.0756934, 0.211239, 0.18804, -0.0971972, -0.188536, -0.262247, -0.12975, 0.0476132, 0.0579352, 0.82062, -0.768913, 0.716354, -0.461958, -0.149536, -0.0985875, 0.819489, 0.816914, 0.509183, 0.807598, -0.476356, -0.326513, 0.48594, -0.513887, -0.588365, -0.441531, -0.404168, 0.420062, -0.328775, 0.647622, 0.923164, 0.251734, 0.976686, 0.282444, 0.579556, -0.282454, 0.54981, 0.677953, -0.580703, -0.949854, -0.885299, -0.321104, 0.464895, -0.419531, -0.765678, 0.235519, 0.243069, 0.541509, 0.516278, -0.343258, 0.982186, 0.419117, 0.844365, -0.125461, 0.09514, 0.669789, -0.0821952, -0.247471, -0.932741, 0.0219777, 0.602188, -0.634586, 0.00406558, -0.934129, -0.874228, -0.978295, 0.567436, 0.388252, -0.239417, -0.0588019, 0.0140978, 0.326764, -0.179958, -0.627612, 0.496975, -0.401866, 0.164413, 0.880765, -0.037581, 0.633225, -0.664317, -0.863748, 0.105078, -0.729747, -0.706799, 0.554724, 0.544994, 0.8961, -0.383193, -0.756874, -0.447808, 0.137709, -0.299869, 0.272654, 0.446212, -0.783422, 0.900744, -0.477079, -0.462446, -0.608273, -0.624415, 0.592446, 0.563694, -0.149679, -0.988173, -0.42364, 0.0461635, -0.936833, -0.975486, -0.539429, 0.134707, -0.963281, 0.693913, -0.270358, 0.450564, 0.630031, -0.957988, 0.789113, -0.00114662, 0.768914, 0.661144, -0.528079, 0.577307, -0.557895, 0.17319, -0.0890958, -0.349297, -0.738898, -0.205673, -0.530789, -0.835815, -0.472679, 0.765408, -0.6174, -0.160176, -0.975008, 0.799483, 0.0546401, 0.416398, -0.202272, 0.683945, -0.895086, -0.694375, 0.62045, 0.459998, 0.173078, -0.556988, 0.752128, 0.0749961, 0.22973, 0.398603, -0.76952, -0.534239, -0.885846, -0.898621, 0.358776, -0.455522, 0.784044, -0.429574, -0.945272, 0.67625, 0.449303, 0.187458, -0.700304, 0.608392, -0.0622544, -0.828749, -0.921903, 0.7156, -0.719543, -0.341794, 0.613369, 0.482488, 0.514987, -0.110696, 0.148396, 0.093316, 0.216374, 0.0481952, -0.749913, 0.818291, 0.129759, -0.457581, 0.135993, 0.582817, -0.726169, 0.425626, -0.960513, -0.561044, -0.95544, -0.0556209, 0.432428, -0.968863, -0.325106, -0.636442, 0.80926, -0.20797, 0.730365, 0.390761, -0.196805, 0.410423, 0.591532, 0.472393, -0.378727, -0.611242, 0.374579, 0.671443, 0.780803, -0.702186, -0.385793, -0.326398, -0.686648, -0.758994, -0.453289, -0.256759, -0.505724, -0.932218, -0.792338, -0.149292, -0.372901, 0.26937, 0.174311, 0.73628, -0.0681069, -0.683532, 0.0899305, -0.541862, 0.822086, 0.554363, 0.516678, -0.953602, 0.0379157, -0.19352, 0.901039, -0.607572, -0.405993, 0.768557, -0.642417, -0.388962, -0.893237, -0.447457, 0.180635, 0.305789, -0.282979, -0.667175, 0.380199, 0.33735, -0.321684, -0.996967, 0.979116, -0.745958, 0.746273, 0.61611, 0.649565, 0.155639, -0.210125, 0.291131, 0.324203, 0.626256, -0.0648081, 0.0919901, 0.000189891, 0.00889589, 0.562322, -0.467066, -0.721169, -0.457075, 0.776149, 0.522063, -0.557709, -0.297335, 0.943291, -0.311196, -0.484442, 0.663263, 0.189521, 0.720488, 0.301751, -0.413526, 0.240428, 0.332834, -0.938301, -0.0720547, -0.818934, 0.330248, -0.715269, 0.119039, 0.491608, 0.0388719, -0.242299, 0.37548, -0.0396619, 0.590819, -0.745081, 0.638087, 0.274047, -0.197759, -0.877884, 0.560174, 0.853829, 0.583324, -0.684519, -0.311207, 0.509971, 0.249287, 0.906947, 0.418074, -0.893787, -0.0479025, 0.381602, 0.35565, -0.215726, 0.291144, 0.265756, 0.871405, -0.720931, 0.890438, 0.332653, -0.0869759, 0.923139, -0.393037, 0.704432, -0.311899, -0.144719, -0.170852, 0.41295, 0.799942, 0.450491, 0.679989, -0.781579, 0.776828, -0.0483253, 0.100636, 0.767819, -0.513038, -0.791671, -0.511015, -0.0180253, -0.466148, 0.237425, -0.107483, 0.137717, 0.697102, -0.0550343, 0.135106, 0.689251, 0.556309, -0.605793, -0.575883, 0.665818, -0.0537181, 0.483563, -0.15057, 0.104638, 0.24514, -0.595495, 0.717188, -0.321073, 0.953426, -0.410188, -0.827221, 0.0641903, 0.963398, 0.107275, -0.147052, 0.167425, 0.474913, -0.93095, 0.510404, -0.0340511, -0.454464, -0.213837, 0.54995, -0.864825, -0.380086, -0.990452, -0.382543, 0.892975, 0.687344, 0.794248, -0.836606, -0.243587, 0.139059, 0.0555421, 0.113805, 0.561203, 0.671808, 0.0178783, -0.602269, -0.0273642, 0.235492, 0.918578, -0.293968, -0.227415, -0.995281, 0.865122, -0.456464, -0.219733, 0.257779, -0.75276, -0.791588, 0.219791, -0.301129, -0.146228, -0.332547, -0.760785, -0.528126, 0.645122, -0.63201, 0.924069, -0.945114, 0.335526, -0.137497, -0.918676, 0.407838, -0.0253841, -0.101459, -0.611574, 0.745967, -0.999152, -0.0234169, 0.518746, 0.492769, -0.121535, -0.508392, 0.69329, -0.138625, -0.376022, 0.948561, -0.523409, -0.893453, 0.0773315, 0.0412088, -0.785529, -0.685334, -0.786701, -0.771275, -0.450649, -0.760916, 0.87575, -0.425184, 0.626557, 0.309757, 0.100418, 0.86513, 0.657418, 0.278303, 0.614481, 0.198094, -0.11273, -0.959474, 0.891207, 0.403953, 0.855738, -0.452213, 0.178888, 0.568059, -0.39174, 0.241322, 0.153542, -0.326231, -0.532997, -0.851606, -0.217672, 0.118542, 0.0199976, -0.881012, 0.109248, -0.0140884, 0.0169123, 0.603906, -0.725991, -0.834011, 0.207907, 0.0418254, -0.7485, 0.467965, 0.210332, -0.086839, 0.954466, -0.71417, -0.460957, -0.577869, 0.0245297, 0.665592, -0.378426, -0.0265663, -0.29265, 0.834854, 0.0462118, 0.354784, 0.0974384, -0.191508, 0.508156, -0.119609, -0.715283, 0.240374, 0.783216, 0.784725, -0.761223, -0.323554, -0.779671, -0.98485, -0.92815, -0.783246, 0.504429, -0.743519, 0.739939, 0.41553, -0.0406252, 0.466338, -0.996233, -0.271955, -0.663768, -0.49848, -0.69553, 0.349121, -0.566256, 0.408368, -0.572625, 0.116027, 0.882372, -0.142055, -0.0888475, -0.75755, 0.262309, -0.433463, -0.852514, 0.288787, -0.54844, -0.189362, 0.712462, 0.0150714, -0.65354, 0.947386, -0.353045, -0.298524, -0.771331, 0.689928, -0.0611873, 0.126153, -0.96596, -0.151495, -0.998661, 0.186316, 0.217851, -0.993603, -0.801147, 0.145663, 0.699758, 0.447427, -0.985332, 0.253904, 0.00662584, 0.130269, -0.517378, 0.496788, 0.522585, 0.0705777, 0.74995, -0.748187, 0.333519, 0.588269, 0.38963, 0.202316, -0.742187, 0.678226, 0.518375, 0.914337, -0.470588, 0.804558, -0.33368, 0.751897, -0.177124, 0.214054, -0.183193, 0.517141, -0.416604, -0.285118, 0.2447, -0.484585, -0.546385, 0.0981813, 0.305512, -0.501295, -0.73555, 0.681307, -0.411503, 0.438092, 0.305616, 0.438157, -0.0776409, -0.392066, 0.868072, 0.80745, 0.0819985, -0.499834, -0.787732, -0.830166, -0.107077, -0.647181, -0.395397, -0.493446, -0.873783, 0.858773, 0.844067, -0.970959, 0.920683, -0.128807, 0.896764, 0.886782, 0.185376, -0.978049, -0.494699, -0.664137, -0.757826, -0.541944, 0.85197, -0.81929, 0.27737, -0.80951, -0.647521, 0.293289, 0.00333575, 0.882507, -0.746124, 0.555599, -0.682762, 0.698818, -0.478212, -0.605067, 0.950047, 0.390913, -0.711727, 0.924408, -0.564946, -0.408664, 0.321598, -0.589884, 0.614127, -0.667254, -0.0107406, 0.302074, -0.571953, -0.58441, -0.640621, -0.191331, 0.0796449, 0.435766, 0.0010705, 0.441072, -0.428623, 0.942038, 0.796889, -0.386599, -0.997945, -0.893749, 0.169672, 0.0308102, 0.782556, 0.240752, -0.462515, -0.662606, 0.589015, -0.363618, -0.863367, 0.557356, -0.599334, -0.0883281, 0.466671, -0.513853, 0.141885, -0.626407, 0.140075, -0.211776, 0.389632, 0.840702, -0.534589, 0.169889, 0.261186, -0.915243, -0.527089, 0.0343268, -0.492973, 0.624435, -0.439908, -0.839436, -0.601866, -0.570753, -0.896241, -0.843251, 0.203892, -0.608812, 0.848164, 0.143458, -0.843825, 0.643186, 0.704633, -0.120193, 0.0517418, -0.42186, -0.80396, -0.864613, 0.603123, 0.0902277, 0.634937, -0.612153, -0.076777, 0.00162272, 0.388811, 0.626665, 0.53217, 0.819372, 0.00692227, -0.548738, -0.417067, -0.346698, -0.961756, 0.159643, -0.0898019, -0.639101, 0.198372, -0.96466, 0.584534, -0.432128, -0.845811, -0.529921, 0.95746, -0.790445, 0.568786, 0.115886, 0.0925279, -0.82595, 0.87855, 0.305963, -0.27215, 0.89545, 0.700628, -0.863546, -0.49659, -0.108061, 0.675839, 0.8251, 0.667587, -0.773022, 0.51582, -0.167045, 0.779601, 0.45703, -0.414446, -0.442655, 0.66063, -0.848338, -0.121513, -0.256988, 0.0992753, -0.71548, -0.118287, 0.757915, 0.990466, 0.420201, -0.265733, 0.13242, -0.42373, -0.690631, -0.419308, 0.814754, -0.977953, -0.464892, 0.645396, -0.318593, -0.614407, 0.214909, 0.169119, -0.157608, -0.0477636, 0.556817, 0.922369, 0.113633, -0.782948, -0.920263, 0.367113, 0.920515, 0.887729, -0.65995, 0.319652, -0.165868, 0.433195, -0.835219, -0.444728, -0.9374, 0.613361, 0.770035, 0.690722, 0.952527, -0.970802, -0.066083, -0.173185, 0.255278, 0.398089, 0.258954, -0.117411, -0.266979, 0.23305, 0.0175309, 0.401925, 0.148745, -0.179639, -0.14045, 0.300348, 0.778196, 0.37012, 0.982747, 0.642975, -0.735626, -0.266731, -0.183451, 0.158749, 0.353716, -0.254592, -0.170945, -0.90255, -0.981519, 0.781964, 0.471106, 0.412472, 0.949992, -0.00892316, 0.292454, 0.529255, 0.450619, 0.246878, -0.650028, 0.887413, 0.386971, 0.804582, 0.0492037, 0.894767, -0.34538, 0.384961, 0.688404, 0.940697, 0.280695, 0.904436, 0.0872705, 0.461731, -0.850734, 0.0401165, 0.748544, -0.505528, 0.114519, -0.296834, 0.302364, -0.72799, 0.188047, 0.822623, -0.186035, -0.245255, 0.0579215, -0.251929, -0.021013, 0.623358, 0.429716, -0.128379, 0.101847, 0.408604, 0.346221, -0.338258, -0.452663, -0.776957, 0.118939, 0.172424, 0.308959, 0.755701, -0.480109, -0.777354, 0.140913, -0.283369, 0.959531, 0.0367458, 0.667602, -0.963945, -0.317449, -0.121041, 0.268275, 0.932446, 0.560571, -0.933629, 0.66282, -0.250967, -0.19116, -0.493407, -0.267678, -0.866212, -0.404056, -0.467122, -0.46647, -0.949154, -0.585564, 0.0887748, 0.120478, 0.413248, 0.916984, -0.937564, 0.371715, -0.0673251, -0.571079, -0.679666, 0.512806, 0.980451, 0.658093, -0.0593738, 0.794326, 0.487702, -0.688391, 0.971153, -0.382923, -0.81128, -0.835244, -0.846243, 0.779682, 0.1909, -0.592476, -0.292518, -0.912639, -0.649946, 0.395067, 0.874107, -0.520387, -0.893851, -0.372945, -0.61985, 0.311394, -0.380566, 0.984438, 0.414487, 0.396142, 0.720414, -0.699161, -0.459904, -0.0952002, -0.0788854, -0.807609, 0.408034, -0.40087, -0.659233, -0.126903, -0.158812, 0.13219, -0.200467, -0.193638, -0.00787383, 0.774918, -0.391644, 0.0529265, -0.00410929, -0.139657, 0.452414, 0.128977, -0.777158, 0.752956, -0.211627, 0.7209, 0.203821, 0.607486, 0.110405, -0.733532, 0.386136, -0.570973, -0.018893, 0.449125, 0.45996, 0.480104, 0.52502, 0.852689, 0.776275, -0.0149903, -0.413951, 0.540593, 0.244892, -0.258675, 0.0664993, 0.38599, -0.0218794, -0.714855, -0.691877, 0.495461, 0.141189, -0.764017, -0.183899, -0.872161, -0.318657, 0.00673588, 0.705272, 0.433026, 0.5371, -0.916691, -0.120237, -0.496143, -0.337001, -0.834294, 0.29535, 0.0702641, -0.327113, 0.6236, -0.915539, 0.397284, 0.668166, -0.62901, 0.898058, 0.558865, -0.115838, 0.544031, -0.512437, 0.646876, 0.593159, 0.632174, -0.981576, 0.0737495, -0.0657292, 0.938084, 0.88119, -0.924404, 0.73693, 0.779739, 0.997889, 0.841311, -0.777485, -0.91571, 0.0268721, -0.469331, 0.40659, -0.840522, 0.528625, 0.174005, -0.633129, -0.00367428, 0.626119, -0.421982, 0.881049, 0.335401, 0.911654, -0.969524, -0.348456, 0.607569, 0.0779519, 0.62713, 0.539765, -0.443252, -0.43172, 0.917641, -0.582945, -0.72799, 0.134036, -0.645862, 0.982153, -0.458028, 0.497058, -0.638183, -0.156, -0.341905, -0.502361, 0.342534, -0.351437, 0.568351, 0.229789, -0.526464, 0.935405, 0.14635, 0.83794, -0.140626, 0.939801, 0.80128, -0.611664, -0.288728, -0.988508, -0.681803, 0.515576, 0.342157, -0.943514, -0.313732, -0.9608, 0.89315, -0.279893, -0.981405, -0.490991, 0.280393, 0.95061, -0.824699, -0.651492, 0.333919, -0.183991, -0.316088, -0.401811, 0.809829, 0.0462161, 0.324513, -0.079065, -0.504072, 0.0136244, 0.805375, 0.0812802, 0.298651, 0.597668, 0.293423, -0.766568, 0.217865, 0.075658, 0.840118, 0.883238, 0.106934, 0.0238478, 0.652868, -0.145466, 0.0460468, -0.927032, 0.94174, 0.095788, -0.496773, -0.338745, -0.604457, -0.605102, -0.552587, -0.505345, -0.926994, -0.366716, 0.104237, 0.746391, 0.808701, 0.0248242, 0.673402, -0.282777, -0.77107, 0.249058, -0.531124, 0.00978203, -0.0756303, -0.252741, -0.156364, 0.830409, 0.10223, 0.924803, 0.29323, -0.0499852, 0.0917038, -0.900444, 0.332132, 0.861001, 0.942341, 0.682959, 0.648295, -0.871077, -0.340762, 0.196958, 0.302361, -0.139365, -0.993381, -0.741616, -0.504922, 0.426466, -0.877586, 0.503721, -0.7161, 0.718144, -0.690037, -0.130703, 0.142697, -0.21722, -0.400696, -0.0551928, 0.991231, -0.722387, -0.0587891, 0.483041, 0.343088, 0.181432, -0.206062, 0.921748, 0.55059, -0.799848, -0.932007, 0.481948, -0.188155, -0.433411, -0.748026, -0.133045, -0.70703, -0.392839, 0.384499, -0.819677, -0.767831, -0.445039, -0.620459, 0.28149, 0.350107, 0.187895, 0.334962, 0.573233, -0.99629, -0.726545, -0.937933, -0.95033, 0.971183, -0.563011, -0.331781, -0.986473, -0.986455, 0.205672, -0.230329, -0.707852, 0.240899, 0.0512037, 0.571126, -0.792271, -0.816247, -0.987227, 0.121228, 0.426218, -0.155153, 0.0903221, -0.620483, -0.671095, -0.0500018, 0.802048, -0.39837, 0.510365, 0.842092, 0.331907, -0.695337, -0.143871, 0.701238, -0.819617, 0.736242, -0.92095, 0.00797682, 0.466435, 0.473835, 0.851838, -0.44486, -0.454201, -0.134798, -0.859964, -0.175876, 0.871968, -0.528324, -0.811372, 0.493318, -0.0981154, 0.243171, -0.322298, -0.346762, -0.967563, -0.263115, 0.281975, -0.342215, -0.382054, -0.28647, 0.9974, -0.145168, 0.462778, -0.993237, -0.971693, -0.63309, -0.48429, 0.9306, -0.445437, -0.478881, 0.0701488, 0.600132, 0.791947, 0.666116, -0.387185, -0.583758, 0.0465024, 0.232757, 0.5191, -0.885446, 0.693626, 0.175076, -0.818714, -0.432789, 0.969534, 0.322536, 0.300624, -0.65664, 0.204247, -0.419918, 0.302328, -0.0807753, 0.732099, 0.521268, 0.466839, -0.0780903, 0.80525, -0.6756, -0.637917, 0.814907, 0.0260694, 0.0166463, -0.949916, -0.214785, 0.682379, -0.438966, 0.307878, -0.889866, 0.466199, 0.550326, 0.551278, -0.419268, 0.231811, -0.495706, 0.548402, -0.570294, 0.424109, 0.984416, -0.700909, 0.999175, -0.674881, -0.840773, 0.315296, 0.748942, -0.706408, 0.718366, 0.0878958, -0.517637, 0.188261, 0.812735, 0.00449838, 0.465943, 0.00116165, 0.361851, -0.0166977, 0.209598, 0.88846, -0.583036, 0.545302, -0.528771, 0.483878, 0.540368, -0.876784, -0.982815, -0.676767, 0.0376043, 0.76401, -0.596689, 0.120888, 0.143926, 0.610024, -0.038116, 0.746988, -0.40219, -0.0974659, -0.84931, 0.492828, 0.488619, 0.0521711, -0.682614, 0.47168, -0.375858, -0.463658, 0.274991, 0.728816, 0.594487, 0.61497, 0.364667, -0.273225, 0.47461, -0.199832, -0.159176, -0.498325, -0.0231936, -0.847863, 0.529725, -0.805629, 0.494657, -0.670901, 0.0488097, -0.732873, -0.14862, 0.510639, 0.588054, 0.203095, 0.181711, -0.967296, 0.766351, 0.363888, 0.849928, -0.466666, 0.186384, -0.249735, 0.853774, 0.277781, 0.209014, -0.425086, -0.0985069, -0.243885, -0.0893538, -0.966503, 0.608751, 0.408511, 0.774066, -0.464057, -0.142387, -0.0224332, 0.0578144, -0.0528306, -0.437988, -0.643511, -0.216865, -0.224618, -0.4958, -0.70194, 0.0884404, -0.304061, -0.0708068, -0.983392, -0.636612, 0.443452, -0.686917, -0.404748, -0.360382, -0.682477, 0.513993, 0.379076, 0.576487, 0.108468, 0.281305, 0.90119, 0.343405, 0.693457, -0.465953, 0.874113, 0.460832, -0.970318, 0.081404, 0.271974, 0.552007, 0.293512, -0.175055, -0.962251, 0.347596, -0.267233, 0.798189, -0.736889, -0.726558, -0.40093, -0.246755, -0.318244, -0.885378, -0.140304, 0.488492, 0.00995237, 0.0756626, 0.402378, 0.53328, 0.311574, 0.674467, -0.0835392, 0.779352, -0.768629, -0.530223, -0.6168, 0.665997, -0.319689, 0.403791, 0.914668, -0.426164, -0.351446, -0.0153367, 0.496789, 0.531336, -0.0673635, 0.0877196, -0.883452, 0.766161, 0.610339, 0.855051, -0.43423, -0.277022, -0.788043, -0.836884, 0.469074, -0.246651, 0.966105, 0.774311, 0.8551, 0.470063, -0.551312, 0.189131, 0.768551, -0.362825, -0.444494, 0.637366, 0.88256, -0.147897, -0.722019, 0.265659, -0.462819, 0.219442, -0.251443, -0.144415, 0.257312, -0.956262, -0.0162705, 0.796615, -0.579849, -0.107934, -0.435235, -0.247343, 0.385352, -0.0368497, -0.573083, -0.0988422, 0.546004, 0.936513, -0.593551, 0.538414, 0.622286, 0.69668, -0.307844, -0.196454, -0.457592, -0.332954, -0.93792, -0.328751, 0.251817, -0.0549746, 0.1915, -0.128315, 0.006482, -0.937086, -0.328112, -0.966473, -0.582451, 0.306803, 0.93715, -0.816259, 0.584334, 0.0835467, -0.310043, -0.0432225, 0.891249, 0.771621, 0.0198902, 0.902638, -0.329409, 0.442216, -0.0541975, 0.0547637, -0.630617, 0.326053, -0.795566, -0.205024, -0.920836, 0.461565, -0.323843, 0.407293, 0.76447, 0.371522, -0.170714, 0.961303, 0.0942947, -0.212502, -0.221696, 0.974599, 0.855121, 0.875343, -0.460005, -0.41759, -0.407632, -0.948259, 0.943753, -0.895199, -0.281817, -0.0151574, 0.073702, 0.590567, 0.87959, 0.608446, 0.387569, -0.931306, -0.934199, -0.334781, -0.59328, -0.380705, 0.58823, -0.259997, 0.802541, -0.0932458, 0.694642, -0.625854, 0.868141, 0.327903, 0.00523035, -0.140403, -0.482108, 0.15502, -0.0838846, -0.512784, -0.839231, -0.589087, 0.473533, 0.574165, -0.154061, -0.560154, 0.172385, -0.966662, -0.886046, -0.562118, 0.784021, -0.519602, -0.204236, -0.562985, 0.734619, -0.277525, 0.336305, 0.62897, 0.50392, 0.867697, -0.497356, -0.330258, 0.87466, -0.418198, -0.456226, -0.468025, -0.186205, 0.15342, 0.605553, -0.596108, -0.931876, 0.96039, -0.436105, -0.536884, -0.480509, -0.795162, -0.899081, -0.388002, -0.278733, 0.728465, 0.876163, -0.716473, 0.891712, -0.214952, 0.431931, 0.205901, 0.778654, -0.944097, 0.247866, -0.303734, 0.171509, 0.624659, -0.109689, 0.086278, 0.73811, 0.683087, -0.377948, -0.890298, -0.241697, -0.109209, 0.986502, -0.972343, -0.77211, 0.849497, -0.771247, -0.359142, 0.489922, 0.0200643, 0.225355, 0.230751, -0.851529, 0.639111, -0.776726, -0.171606, -0.25154, 0.788907, -0.73433, 0.608717, -0.133831, 0.0300698, 0.695313, 0.938917, 0.371538, -0.148993, -0.236693, 0.340058, -0.445336, -0.868812, 0.356863, 0.585897, -0.0709097, 0.179759, 0.894024, -0.553815, -0.929524, -0.246213, 0.98308, 0.611667, -0.910355, -0.791075, 0.96512, -0.0378555, 0.172264, 0.661575, -0.553997, 0.204394, -0.258265, -0.941606, 0.208972, -0.0820925, 0.611533, -0.271613, -0.554264, 0.379487, 0.174849, -0.561761, 0.0296858, -0.694358, 0.19156, 0.941489, -0.715648, -0.0975253, 0.997457, 0.820632, -0.273257, 0.715535, 0.464057, -0.627108, -0.968743, -0.471352, -0.409927, -0.54154, 0.390911, -0.310492, 0.792414, 0.029885, -0.812819, 0.153571, -0.80855, -0.0884861, -0.953114, 0.432864, -0.210269, 0.193258, -0.271363, -0.0976448, 0.319136, 0.509408, -0.979902, -0.477121, -0.587795, -0.462949, 0.198617, 0.286013, 0.548018, 0.909904, -0.128226, 0.608619, 0.416321, -0.821959, 0.38463, 0.700458, 0.512628, -0.571135, -0.343361, 0.118686, -0.504801, -0.176298, -0.521626, 0.702431, 0.322576, 0.687565, 0.535861, -0.842167, -0.803818, 0.123966, 0.320191, 0.376569, -0.894085, 0.212863, 0.636048, 0.764931, -0.42436, 0.269233, 0.8821, -0.998104, 0.769805, -0.547756, 0.205949, 0.162965, -0.57199, 0.130191, 0.616808, 0.189768, -0.154878, -0.284373, -0.252256, -0.585445, 0.20605, -0.359726, 0.0151177, 0.501083, 0.906961, 0.156044, 0.667289, 0.949728, -0.829708, -0.340192, -0.323101, 0.543145, 0.574624, 0.190127, 0.904547, -0.0405874, 0.289412, 0.138263, -0.0375456, 0.478291, 0.456761, 0.946176, 0.926427, -0.75606, 0.730846, 0.177408, 0.773005, -0.0569087, 0.314852, -0.337737, 0.441604, 0.387845, -0.0538663, -0.688739, 0.427214, -0.380879, 0.250449, -0.887758, 0.431475, -0.33425, 0.636737, 0.270145, -0.499112, 0.997649, 0.6431, 0.154928, -0.144205, -0.555643, 0.150035, -0.083656, 0.296713, -0.534536, 0.579221, 0.0206286, 0.750192, -0.0751088, -0.623636, -0.892362, -0.087166, 0.993093, 0.754511, -0.933811, 0.483284, 0.369799, 0.238821, 0.599791, 0.698338, -0.61611, 0.125698, 0.41789, -0.800749, 0.825012, -0.828661, -0.483846, 0.198195, 0.624537, -0.820257, 0.169987, -0.902507, -0.618759, 0.739184, -0.656929, 0.493274, -0.480799, 0.302426, 0.444474, -0.526006, 0.90794, -0.517477, 0.649324, 0.366259, 0.79876, -0.280398, -0.209133, -0.890809, 0.96234, 0.367459, -0.65159, 0.291417, -0.0953986, 0.964497, -0.142732, 0.867464, -0.227046},
-	{-0.736657, -0.579668, 0.596999, 0.989381, 0.938116, -0.107306, -0.690025, 0.558586, -0.555379, 0.360849, 0.364764, 0.783755, -0.346459, 0.403388, 0.250661, 0.195344, -0.195782, 0.544874, -0.513659, 0.59966, -0.12149, -0.0326099, -0.247815, -0.839367, 0.453823, 0.624709, -0.228859, 0.476994, 0.541206, -0.225172, -0.483803, 0.0983336, 0.386433, -0.369629, 0.176092, 0.129331, 0.597663, 0.544064, 0.141751, -0.717905, -0.84265, 0.155197, -0.82037, -0.875299, 0.220068, 0.56406, -0.0573012, 0.998172, -0.328754, -0.206292, -0.0892562, -0.89546, -0.00170426, 0.0223657, -0.225312, 0.72035, 0.956884, -0.676248, -0.37724, -0.540974, 0.983404, -0.514178, -0.708503, -0.707815, -0.47346, 0.371421, 0.448302, 0.40889, -0.034446, 0.536989, 0.712184, -0.426885, 0.0190681, -0.313092, -0.850387, 0.491311, -0.696884, -0.925399, 0.56808, -0.108874, 0.256394, 0.86021, 0.683871, 0.400516, 0.824063, 0.018176, -0.395783, -0.276924, -0.056395, -0.592934, -0.736574, 0.282758, -0.0720912, 0.386795, 0.713264, -0.84216, -0.350494, 0.733337, 0.750949, -0.872372, 0.952326, -0.355344, 0.980758, -0.467155, -0.933962, 0.240057, 0.932477, 0.0453829, 0.874539, 0.953031, -0.189646, -0.286027, -0.393897, 0.541682, 0.966244, -0.19681, -0.844918, 0.529924, -0.791269, 0.210196, -0.101391, -0.20625, -0.877082, -0.215644, -0.295179, 0.402926, 0.621841, 0.375394, -0.820799, 0.870405, -0.602716, 0.97374, 0.567637, -0.983676, 0.554802, -0.78571, 0.0378767, -0.0644498, 0.469505, -0.668828, -0.485339, 0.439308, 0.643692, -0.336383, -0.186986, 0.108338, 0.433901, 0.374393, 0.919125, 0.480073, -0.563513, -0.604837, -0.597537, -0.756257, -0.854785, -0.864178, 0.752536, -0.574255, -0.157354, -0.700298, 0.799565, -0.987522, -0.057828, 0.895946, -0.797083, 0.163545, -0.0359619, 0.609621, -0.702046, -0.513366, -0.401189, -0.165069, -0.372492, -0.708462, 0.0828908, -0.411598, 0.0188097, 0.507767, -0.629291, -0.243484, -0.741108, -0.0387167, 0.690768, 0.383795, 0.0508585, 0.0392348, -0.553667, 0.142268, -0.324264, -0.155236, 0.930649, 0.883828, -0.530213, 0.276383, -0.667097, 0.0384147, 0.53537, -0.371974, -0.53576, 0.26312, 0.625377, -0.703065, 0.320053, 0.329474, 0.797031, -0.463558, -0.619812, 0.363123, 0.345628, 0.365061, -0.988374, 0.968516, 0.0834932, 0.999356, 0.585145, -0.349982, 0.761153, 0.589956, 0.131008, 0.405988, 0.208693, 0.440934, -0.0823349, 0.00376833, 0.907557, -0.519559, 0.121882, 0.298075, -0.607691, 0.559195, 0.000285445, -0.981627, -0.983668, 0.737517, 0.240812, 0.552305, 0.326207, 0.951628, 0.89407, 0.883898, 0.734011, 0.803645, -0.574743, -0.654832, -0.823322, -0.916752, -0.216303, -0.329905, 0.205146, -0.418341, 0.444693, -0.184841, -0.436533, -0.931367, -0.380632, 0.723685, 0.812958, 0.782231, -0.13013, -0.734435, 0.803769, -0.613253, -0.674631, 0.111191, -0.633366, -0.432114, -0.435751, -0.372904, -0.226155, 0.479477, 0.707766, 0.644824, 0.792796, -0.564593, -0.932987, -0.977198, 0.92794, 0.222944, 0.667195, 0.959933, -0.801054, 0.740403, 0.0706291, -0.124688, -0.675414, 0.640311, 0.994065, -0.363001, 0.458802, 0.209568, 0.528524, -0.453106, -0.397221, 0.277711, 0.665955, -0.987927, -0.656436, -0.245356, -0.487894, -0.936755, 0.0434521, -0.710008, -0.312932, 0.846557, -0.980584, -0.609856, -0.763558, -0.187763, -0.909228, 0.648017, 0.65795, 0.934858, 0.116206, -0.0398645, 0.624002, 0.449248, 0.649619, 0.490319, 0.265466, 0.533801, 0.516141, 0.937559, -0.180866, 0.710285, -0.169354, 0.124906, 0.493918, 0.257398, -0.139129, -0.326605, 0.800189, -0.520162, 0.648225, -0.410172, 0.498437, -0.942315, -0.413365, 0.70299, 0.997391, -0.150677, -0.625103, 0.296693, 0.504909, -0.307981, 0.289791, 0.158281, -0.624132, -0.447659, -0.466069, 0.924264, -0.623162, -0.993054, -0.294366, -0.120873, -0.482572, -0.794748, 0.729889, 0.0135159, -0.417503, 0.144167, -0.0958185, 0.955262, 0.676247, 0.19726, -0.961425, 0.41302, -0.401066, 0.649931, -0.245038, -0.163219, -0.920687, -0.452908, 0.0905973, -0.0112883, -0.141206, 0.46362, 0.211595, -0.835982, -0.2153, 0.888308, 0.469978, 0.434013, -0.364224, 0.215886, 0.527449, -0.938265, 0.115661, 0.319965, -0.390426, -0.135024, -0.358021, -0.192157, 0.255138, 0.623288, -0.671065, 0.637865, 0.763919, -0.529485, 0.928929, -0.181111, -0.169783, 0.348166, -0.204299, 0.637222, -0.758929, -0.0211893, -0.410247, 0.721317, 0.453317, 0.135146, 0.023553, -0.499231, -0.837844, -0.673875, -0.556953, -0.0308578, 0.839462, 0.836604, 0.287508, -0.347709, 0.735202, -0.97012, 0.379653, 0.106329, 0.578889, -0.647903, 0.201061, -0.793108, -0.24083, 0.975311, 0.0859019, -0.87609, -0.512123, 0.74128, 0.939561, 0.132836, 0.322663, 0.216011, 0.128838, -0.638228, -0.76707, -0.159611, 0.511739, 0.046639, -0.400413, -0.219659, -0.271113, 0.251637, -0.442693, 0.989324, -0.475961, 0.597174, 0.310418, 0.39796, 0.743857, -0.0306915, 0.815479, -0.679005, -0.647199, 0.304211, 0.579748, 0.241849, 0.135991, 0.972575, -0.577218, -0.613634, 0.091091, -0.976929, -0.475732, -0.821154, 0.568478, 0.632, -0.73636, 0.339969, -0.626473, -0.233619, -0.636546, -0.0267994, 0.500054, 0.874219, 0.970186, 0.801846, -0.859423, -0.969003, 0.787716, -0.0712655, 0.527862, 0.029114, -0.802638, -0.0693131, -0.517775, -0.0342631, -0.566057, 0.835661, -0.0652688, 0.417357, 0.944203, -0.410706, -0.45926, -0.463211, -0.688775, 0.94715, 0.599925, 0.0606946, -0.174232, 0.701556, 0.799249, -0.904949, 0.908274, -0.945485, 0.0737994, 0.0404781, -0.703534, 0.0781234, 0.677789, 0.970939, -0.682813, -0.779554, -0.556318, -0.86625, 0.735242, -0.490236, 0.581906, 0.0564457, 0.0262844, -0.137754, 0.454503, 0.958664, -0.76757, 0.781205, 0.554009, 0.983658, -0.259522, 0.313274, 0.926912, -0.1037, 0.666704, 0.874697, 0.445589, 0.758601, -0.743876, 0.747437, 0.554639, 0.621643, -0.256625, -0.275557, -0.266756, -0.935765, -0.386465, 0.936471, -0.463584, -0.436142, 0.0792968, 0.710091, -0.646339, -0.252711, -0.568483, -0.231732, 0.399146, 0.899336, 0.463372, 0.245181, -0.641326, 0.213684, 0.263099, 0.70211, -0.356899, -0.982304, 0.872008, 0.797468, 0.068829, -0.82341, -0.360266, -0.91115, 0.527621, -0.498856, -0.361122, 0.74375, 0.2102, -0.97791, 0.443038, 0.0693272, 0.12795, -0.737445, 0.523418, -0.187109, 0.301249, 0.780135, 0.661571, -0.787499, -0.232733, 0.9903, 0.580254, -0.277147, 0.279802, -0.494862, -0.768962, -0.32537, 0.455308, 0.0829697, 0.122875, 0.1378, 0.196975, -0.268506, -0.0353807, -0.140118, 0.91257, -0.346223, 0.299904, -0.162975, -0.162211, -0.226345, 0.651879, 0.295457, 0.326466, -0.125139, -0.952249, 0.462265, -0.315703, -0.587928, -0.357972, -0.0300269, 0.399104, 0.358796, 0.457303, -0.559845, 0.0467189, -0.042075, -0.364731, 0.394597, 0.357904, 0.201356, -0.434052, 0.79953, -0.990251, -0.776935, -0.502509, -0.156875, 0.248239, -0.411997, -0.502048, 0.208037, 0.701584, 0.712177, 0.502756, 0.417791, -0.258388, 0.636694, -0.0367259, 0.0937078, 0.155219, 0.801903, 0.207299, 0.202038, 0.516068, 0.377593, 0.946816, -0.327839, 0.552926, -0.965582, -0.0922305, -0.241604, 0.481696, 0.0782259, 0.430277, 0.130548, -0.0882839, -0.593423, 0.303113, -0.439488, 0.962496, 0.77351, -0.180278, -0.692347, -0.311373, 0.457593, -0.623063, -0.628072, 0.861091, -0.348629, 0.729108, -0.701707, 0.571644, 0.379284, -0.646116, 0.173981, -0.16243, -0.889688, 0.330165, 0.795815, 0.795438, 0.384836, 0.701593, -0.684554, 0.709141, 0.664625, 0.458806, 0.0572968, 0.798356, -0.586759, 0.040831, 0.257796, -0.665326, 0.884861, -0.421407, -0.966408, -0.624769, 0.456692, 0.994835, -0.14601, -0.862424, 0.551246, -0.683556, 0.612795, -0.516696, -0.241012, 0.868601, 0.0767956, -0.942923, -0.785548, -0.563464, 0.695411, -0.422881, 0.829308, -0.959237, -0.372584, -0.0332029, -0.0545874, -0.0109094, 0.371768, 0.753351, -0.950341, 0.179189, -0.50372, 0.400156, -0.645949, 0.336083, 0.512662, -0.991413, -0.103677, 0.474305, 0.390051, 0.259385, -0.402063, -0.18145, 0.647265, 0.69798, -0.0789748, -0.862156, 0.103317, 0.911537, 0.511574, -0.269399, 0.0236412, -0.0339859, -0.989698, -0.838073, 0.788357, 0.344801, -0.944553, 0.859508, 0.840918, -0.603133, 0.271999, -0.399362, -0.619437, -0.849024, 0.282881, 0.588144, -0.16053, -0.0310583, -0.748878, 0.792623, 0.459419, -0.0648915, 0.519671, 0.970206, -0.777829, -0.9523, 0.397689, -0.960614, -0.200846, 0.065114, 0.0547279, 0.194405, -0.806057, -0.378918, -0.220139, 0.969889, 0.761171, 0.782637, 0.142485, -0.250655, -0.508468, -0.727972, 0.568921, -0.592595, 0.804586, 0.0161145, 0.025855, 0.533602, 0.0882577, -0.603001, -0.829241, -0.999342, -0.902298, 0.902464, 0.00633354, 0.593409, -0.338927, -0.766468, -0.186078, -0.75433, 0.941888, -0.0679976, 0.730834, -0.220151, -0.809609, 0.943505, 0.561151, 0.262309, -0.109888, -0.0647266, 0.644725, -0.235231, 0.299124, 0.536006, -0.277079, 0.601491, 0.774228, 0.0352406, 0.745175, 0.81205, 0.26109, -0.261278, -0.828843, -0.363087, 0.978112, -0.00809418, -0.974239, -0.312276, 0.0960622, 0.405251, -0.290912, 0.457631, -0.289406, -0.408768, 0.563856, 0.10044, 0.555249, -0.627315, 0.369741, -0.605363, -0.734572, 0.107154, -0.835016, 0.481326, 0.929489, -0.354589, 0.994393, 0.624578, 0.0818448, -0.583821, -0.217972, 0.220497, 0.489805, -0.865182, -0.113131, -0.228756, 0.433969, 0.149266, 0.385674, -0.616341, -0.369015, -0.815357, -0.648288, 0.796935, 0.202353, 0.876309, 0.638959, -0.00467436, -0.964177, -0.89475, -0.756474, 0.725669, 0.435324, -0.40728, -0.223415, 0.285117, 0.729704, -0.703602, 0.588809, 0.192333, -0.0102917, 0.854375, 0.494368, 0.320126, 0.591475, -0.478276, -0.960662, 0.332025, -0.499289, 0.071682, 0.864687, -0.248828, -0.836792, -0.553401, -0.913756, 0.715591, 0.727511, 0.414236, -0.279731, 0.922969, -0.596326, -0.167242, 0.0454551, -0.657679, -0.975018, -0.348296, -0.102484, 0.307769, 0.479744, -0.980711, -0.1653, -0.80418, 0.354552, -0.688668, 0.598858, 0.827133, 0.61979, -0.464126, 0.246357, 0.470422, -0.631967, -0.466071, -0.798933, 0.150684, 0.714322, -0.448297, -0.994574, -0.72395, -0.900341, -0.404322, 0.307317, -0.480646, 0.788902, -0.365788, -0.222892, -0.205445, -0.53904, 0.62105, -0.265802, 0.0690501, -0.691104, -0.676863, 0.581785, -0.192309, 0.563695, 0.786823, -0.369647, -0.265299, 0.994648, -0.763483, 0.385817, 0.0296615, 0.151006, -0.393418, 0.671445, 0.435, -0.224504, 0.935161, 0.842817, -0.855007, -0.825551, 0.811575, 0.333894, -0.852566, 0.399763, -0.557426, 0.134308, 0.227123, 0.117363, -0.781773, 0.572874, 0.574636, 0.854514, -0.91275, 0.396286, 0.151744, 0.994073, -0.420623, -0.760015, 0.611301, 0.457494, -0.976958, -0.369542, -0.0202784, -0.135998, -0.762378, 0.133594, -0.47297, -0.0322358, 0.0288852, -0.393699, -0.732578, 0.0725299, -0.91812, -0.467339, -0.457777, -0.465813, -0.759587, -0.701307, -0.159938, 0.315962, -0.97255, 0.634126, 0.228414, 0.809138, -0.494325, 0.271802, -0.859918, 0.328658, -0.879643, -0.768235, 0.813256, 0.971472, -0.517599, -0.380341, 0.255169, -0.143302, -0.525049, -0.268851, -0.449587, 0.444978, 0.0530854, -0.824089, -0.0702112, 0.962443, -0.352472, 0.783166, -0.756232, -0.451439, -0.360501, 0.0859872, -0.257234, 0.629961, 0.491434, 0.0231106, -0.698409, 0.106483, 0.15065, -0.146974, 0.945519, -0.628875, 0.0853581, -0.335078, 0.0360103, -0.396124, 0.802423, 0.770954, -0.48309, 0.65772, 0.299657, 0.0868315, -0.486561, 0.0709935, -0.643823, -0.752578, 0.392031, 0.573725, -0.259794, 0.0935977, 0.990338, 0.869302, 0.571355, 0.872538, 0.885794, 0.392926, -0.354851, 0.312391, 0.544094, 0.727639, 0.665086, 0.608089, 0.905008, 0.554404, -0.462413, -0.5271, 0.52636, -0.704768, 0.534905, -0.133082, -0.435577, -0.639793, 0.127359, -0.782636, -0.25931, -0.875469, 0.692044, 0.248036, 0.334163, 0.66903, -0.247758, -0.223859, -0.428911, 0.865216, -0.0846036, -0.956039, 0.229014, -0.602432, 0.549383, -0.131819, -0.489129, -0.991585, -0.371515, -0.283284, -0.00419932, -0.0315234, -0.575454, 0.19445, 0.0378988, 0.468286, 0.162994, 0.563727, -0.867263, -0.25015, -0.531595, 0.192844, -0.415828, -0.55218, 0.198486, -0.540697, -0.729408, -0.360435, 0.853567, 0.980729, -0.638845, -0.00797483, -0.753427, -0.777877, -0.0197169, -0.558258, -0.437265, 0.531503, 0.878467, -0.994685, 0.144876, 0.797894, 0.956841, -0.0994331, 0.956527, 0.728419, -0.777377, -0.617368, -0.185748, 0.992851, -0.405046, 0.129944, -0.808793, -0.468449, 0.0300155, 0.49095, -0.933297, -0.330458, -0.20812, -0.687669, -0.116509, -0.654201, -0.211396, 0.463646, -0.330407, -0.762368, 0.97721, -0.503417, 0.280937, 0.36256, -0.979755, 0.0621841, -0.0473176, 0.244271, 0.114326, 0.820684, -0.645324, -0.474081, -0.467886, -0.130066, 0.154662, 0.29709, 0.980006, -0.550393, 0.748704, -0.850589, -0.83167, -0.578332, 0.445789, -0.26689, -0.579737, 0.0241633, 0.837065, -0.417068, 0.643361, 0.353466, -0.652592, -0.0402515, 0.606258, 0.716119, 0.324868, 0.116784, -0.292384, -0.761875, -0.926366, -0.727604, 0.399184, 0.211747, 0.908488, 0.885876, -0.393687, 0.623772, 0.826718, 0.787222, -0.495384, -0.011973, -0.385363, 0.217009, 0.944924, -0.29487, 0.51035, 0.995771, -0.462249, 0.819268, 0.537326, 0.363132, -0.786373, 0.975831, 0.863531, 0.499789, 0.999356, -0.672899, -0.421347, -0.936184, 0.690591, 0.124834, -0.0191781, -0.547115, 0.355982, 0.914334, 0.533779, 0.379734, -0.288604, -0.831277, 0.00519031, -0.261217, 0.972708, 0.459353, 0.642593, -0.427753, -0.905441, 0.997325, 0.573925, -0.0867906, 0.83434, 0.0518815, 0.850352, -0.877512, -0.524479, 0.938124, -0.530866, 0.0238699, 0.170058, -0.865284, 0.0419813, -0.582037, 0.335737, 0.863458, 0.743949, -0.613642, -0.822742, -0.570934, 0.15669, 0.431916, 0.558219, 0.129709, 0.984648, -0.263714, -0.485999, -0.282609, 0.498673, 0.844961, -0.467074, 0.814198, 0.668846, -0.603482, -0.0751003, -0.27298, -0.243863, 0.0477292, -0.296955, 0.59836, -0.873256, 0.700926, -0.0854584, 0.644622, 0.464206, 0.318257, -0.212974, -0.896318, 0.931806, 0.800405, 0.690845, -0.558275, -0.950064, 0.213431, -0.104116, 0.826476, -0.121805, -0.328484, -0.596846, -0.71609, -0.498866, 0.972784, 0.542215, -0.35256, -0.674483, -0.368225, -0.390444, 0.853792, 0.168845, -0.062891, 0.460713, 0.0262955, -0.25828, 0.465927, -0.610827, 0.436699, -0.805818, -0.449327, 0.698044, 0.502023, 0.999864, 0.802562, 0.330515, 0.305223, -0.0297531, 0.730545, 0.566337, -0.38864, 0.923137, 0.417624, 0.863145, 0.771961, -0.724447, 0.216606, -0.392179, -0.423428, -0.522314, 0.439726, -0.831187, 0.0208128, 0.507023, -0.912937, -0.357473, 0.216871, -0.887203, 0.857703, -0.270426, -0.167035, -0.806416, -0.484638, 0.527167, -0.316492, 0.521096, -0.465209, -0.0492667, -0.0898628, -0.90261, 0.622722, 0.0304261, -0.604354, -0.944885, 0.324108, 0.754077, 0.351764, -0.515639, -0.815967, 0.297522, -0.230635, -0.446732, -0.813864, 0.230703, -0.765611, 0.053107, 0.28125, -0.573051, -0.0482944, 0.333931, -0.377019, 0.613394, 0.459692, 0.954351, 0.00262533, 0.299041, -0.680466, -0.804842, -0.436055, 0.957674, -0.293065, 0.842922, 0.0932064, 0.565663, 0.796716, -0.422063, 0.617742, 0.497555, 0.936462, -0.875999, -0.237296, -0.310875, 0.620551, 0.96912, 0.984416, -0.863182, -0.182239, 0.598356, 0.397539, -0.393359, 0.42418, 0.0343528, 0.182567, 0.90468, -0.430476, 0.630344, 0.318096, -0.0774487, -0.0698548, 0.635305, 0.0390643, 0.361362, 0.259804, -0.785806, -0.786544, -0.8336, -0.710288, -0.422326, -0.975693, 0.0861466, -0.711319, -0.166389, 0.338862, -0.409912, -0.424376, 0.470163, -0.590812, -0.632108, -0.577349, -0.324947, 0.154784, 0.117404, 0.0258501, -0.31718, -0.613999, -0.38484, 0.608071, -0.509219, -0.294791, 0.238204, 0.487335, -0.58215, -0.171202, -0.487835, -0.263461, -0.119645, -0.956943, 0.766767, -0.680715, -0.823963, -0.124006, -0.575993, 0.583964, 0.267718, 0.784354, -0.275829, -0.964802, -0.586069, -0.209897, 0.632543, -0.246162, -0.593011, -0.641571, 0.00539272, 0.901686, -0.238799, 0.0308805, -0.966002, -0.123366, 0.190867, 0.775361, 0.570509, 0.844228, -0.616962, 0.821297, 0.438878, -0.760384, 0.808353, -0.491921, -0.549212, 0.618991, -0.644598, -0.467179, 0.132919, 0.563804, 0.482483, 0.775927, -0.217368, 0.447368, 0.959333, -0.121211, 0.0496315, -0.775443, 0.256681, -0.661007, 0.39307, 0.900559, 0.203315, 0.787642, 0.660631, -0.0572705, -0.106924, -0.694635, 0.868918, -0.0324335, -0.390744, -0.571478, -0.332308, 0.168697, -0.62977, -0.18501, 0.673194, -0.0487071, 0.547011, -0.449422, 0.492456, 0.72729, 0.0372132, -0.376018, -0.250132, 0.213855, -0.680091, 0.94036, 0.0729231, -0.757967, -0.891547, 0.945938, -0.908015, -0.413002, -0.358411, -0.458276, -0.657642, -0.159558, -0.736567, 0.22592, 0.0244503, -0.452838, 0.106535, -0.313834, 0.179091, 0.48723, 0.545206, -0.695468, -0.186962, -0.0847808, -0.333759, -0.231585, 0.927181, -0.29324, 0.715253, 0.0807172, -0.828497, -0.654099, -0.503989, -0.536152, -0.402128, -0.778453, 0.00747656, -0.391392, -0.962176, -0.411458, 0.830736, -0.402087, -0.104802, -0.463705, -0.0532306, -0.755196, 0.620476, 0.691022, 0.210719, -0.189826, 0.262589, 0.577698, 0.374807, -0.10702, -0.376361, -0.258725, 0.722415, 0.09132, 0.102364, 0.0887381, 0.0644373, 0.149482, -0.737005, -0.882092, -0.531219, 0.551634, 0.833704, -0.632655, -0.0583748, 0.0746756, -0.460499, -0.774771, 0.0339316, 0.00666296, -0.977033, -0.933034, 0.570961, -0.641361, -0.444421, -0.730721, -0.310524, -0.734508, -0.796853, 0.434656, -0.353591, 0.646947, 0.549918, -0.195465, -0.0761115, -0.704749, 0.755127, 0.830893, -0.598622, -0.312504, 0.783302, 0.886742, -0.200554, -0.729278, 0.356124, 0.131493, -0.598672, 0.173822, -0.231196, 0.373419, -0.383115, -0.169052, -0.902108, 0.83435, -0.929661, 0.516775, -0.339669, 0.896794, -0.786436, 0.610308, -0.174662, 0.588019, 0.559239, -0.902891, -0.66424, 0.322269, 0.881898, 0.787354, 0.841301, -0.463984, -0.370226, -0.343329, 0.791618, 0.806132, 0.294515, -0.164348, 0.632038, -0.497248, -0.723213, 0.953629, 0.864486, 0.365439, 0.599107, -0.0204635, -0.419405, -0.498066, 0.712822, -0.189084, -0.603257, -0.875687, -0.00659322, 0.279103, -0.542803, 0.323308, -0.354414, 0.365484, 0.305673, 0.462581, -0.726786, -0.432268, 0.569526, -0.791412, 0.944555, 0.890774, 0.872628, 0.881001, 0.869867, 0.620194, -0.701838, 0.796561, 0.564678, 0.135653, 0.337866, -0.268407, 0.482054, -0.26525, 0.103849, 0.417096, -0.511575, 0.345782, -0.126787, 0.365383, -0.68974, -0.515709, -0.340157, -0.203562, 0.848303, -0.397038, 0.748718, 0.871649, 0.693176, 0.788547, 0.369281, 0.683913, 0.0702713, 0.409492, -0.531017, 0.643137, 0.814836, 0.663619, 0.444048, -0.166164, 0.623242, -0.627493, 0.644129, -0.137677, -0.547534, -0.720731, -0.0728156, 0.218721, -0.344906, -0.719379, 0.203742, 0.665957, -0.929879, 0.617388, -0.572755, 0.521991, 0.228472, 0.396769, 0.0471001, -0.60288, -0.956971, -0.196588, 0.643696, 0.741884, -0.762569, 0.155454, -0.0719924, 0.0904895, -0.910775, 0.649176, 0.817791, 0.55644, 0.855234, 0.74198, 0.567516, -0.0453229, 0.639372, 0.370194, -0.177312, -0.37563, 0.118484, -0.174824, -0.50964, -0.764281, 0.66868, 0.821403, 0.44259, -0.652587, 0.438192, -0.320658, 0.83524, 0.804811, 0.685386, 0.231457, 0.429385, 0.312918, -0.738938, -0.104326, 0.591508, 0.333738, 0.727498, -0.841247, 0.736923, 0.520102, 0.0284022, -0.219892, 0.350751, -0.782166, -0.244122, 0.975371, -0.333138, 0.729027, 0.667656, 0.169762, -0.225928, -0.821235, 0.0721195, -0.52467, 0.627084, -0.561378, -0.816759, -0.939643, 0.580375, -0.47757, 0.235741, 0.619985, -0.201611, 0.857653, -0.0605898, 0.392832, -0.633099, -0.0916168, 0.864426, 0.0908569, 0.543329, 0.0924425, 0.856139, 0.0859262, 0.979674, 0.441916, 0.819255, 0.728084, 0.58916, 0.853823, -0.746185, 0.363989, 0.606189, -0.678919, -0.389885, -0.558366, 0.661467, 0.47275, 0.359087, 0.439914, -0.606455, 0.755307, 0.83994, -0.175455, -0.208518, 0.411523, -0.750379, 0.738084, -0.164271, 0.377856, -0.289182, 0.875564, -0.548476, 0.256623, 0.865546, -0.10545, 0.531778, -0.0687791, 0.737682, 0.318366, -0.214545, 0.733264, 0.251206, 0.824706, 0.109899, 0.272164, 0.881713, -0.430617, -0.70194, -0.812857, -0.0265405, 0.643765, 0.958861, -0.0285364, 0.327179, -0.901737, -0.814472, -0.827872, -0.655095, -0.475444, 0.671208, 0.646072, -0.99356, 0.142554, -0.58045, 0.530119, 0.315904, -0.196093, -0.493561, -0.269159, 0.445005, -0.618539, 0.895321, 0.870642, 0.199096, -0.203781, -0.511206, 0.29335, -0.0436323, -0.93355, 0.247306, 0.900797, -0.121209, 0.929202, -0.913938, 0.353078, 0.757725, 0.863524, 0.430783, 0.889719, 0.0936952, 0.8898, 0.126354, 0.977123, 0.554646, -0.0894738, -0.704487, -0.614792, 0.666715, -0.659114, -0.925249, 0.660298, -0.464275, -0.557504, 0.887061, 0.86515, -0.0631094, 0.162877, -0.940108, 0.0641213, -0.690478, 0.483838, 0.174978, 0.414796, -0.449503, -0.485999, 0.258375, -0.324016, -0.489011, -0.0883053, -0.944376, 0.12207, -0.675011, 0.231855, -0.771673, 0.188676, -0.973967, -0.600414, 0.0234954, 0.821115, 0.312516, 0.971305, 0.0925001, -0.736037, 0.201844, 0.114203, 0.442257, -0.999538, 0.2306, -0.0569388, -0.546244, 0.805162, 0.980896, -0.112215, -0.440444, -0.144661, 0.992453, 0.796876, -0.348034, 0.38502, 0.915653, -0.652429, -0.211817, -0.111023, -0.823367, 0.616049, -0.173098, 0.109685, -0.20792, 0.285003, 0.543553, -0.453448, -0.0250916, 0.883688, 0.160364, 0.0790032, 0.666542, -0.271963, 0.180657, 0.101535, -0.798768, 0.126182, 0.696215, -0.516424, 0.679001, 0.379528, 0.787923, 0.814907, 0.622559, -0.221391, 0.941564, 0.150092, -0.113293, 0.120409, 0.0328628, 0.169242, 0.462048, -0.030363, 0.74801, 0.378148, -0.375024, -0.425309, -0.679849, 0.722826, 0.998435, -0.838582, -0.581713, -0.772524, -0.536766, -0.167259, 0.302221, 0.619689, -0.82524, -0.563805, -0.305739, 0.820951, -0.973629, -0.166707, -0.438649, -0.456041, -0.381592, 0.985177, 0.67582, 0.789624, 0.530157, 0.674968, -0.387406, -0.391246, 0.0891699, 0.134211, 0.96832, 0.102077, 0.419153, 0.99925, -0.0415893, -0.819709, 0.588257, -0.169425, 0.199408, 0.849187, -0.518721, -0.782061, 0.437511, 0.714255, 0.248082, 0.795443, 0.313624, 0.696173, -0.0888741, -0.782036, 0.424394, -0.865976, 0.22865, -0.367942, 0.999225, 0.542271, -0.172189, -0.383375, -0.0875069, 0.316356, -0.427277, -0.369047, 0.0716704, 0.037726, -0.237527, -0.0964021, -0.647101, 0.449597, -0.901126, 0.796315, 0.0845288, -0.499076, -0.122163, 0.520902, 0.500626, 0.669376, -0.51893, 0.719385, 0.979296, 0.232695, 0.967566, 0.0381146, -0.403767, -0.763077, -0.167091, 0.869768, 0.84841, -0.387273, 0.946274, -0.718643, 0.654816, -0.801633, -0.41372, 0.221171, -0.441797, -0.319953, 0.978998, 0.187391, 0.666681, -0.602521, -0.712228, -0.405448, 0.20026, 0.259025, 0.466349, 0.680481, 0.0427922, 0.0337495, -0.453802, -0.694046, -0.118177, -0.0184441, -0.141133, 0.245817, 0.105278, -0.512911, 0.050083, -0.0208406, 0.280142, -0.208436, -0.1712, 0.532861, -0.800588, 0.202999, -0.638023, -0.879517, -0.727688, -0.571998, -0.689814, -0.29897, 0.619752, -0.956767, -0.750811, 0.452498, 0.576301, 0.795592, -0.779275, -0.503455, -0.00490043, 0.969834, 0.923733, 0.0798972, -0.522914, 0.865266, -0.593537, 0.658611, -0.894809, 0.220716, 0.560619, 0.491719, -0.598998, 0.632437, -0.259902, -0.255981, -0.694699, -0.79543, 0.226919, -0.93748, 0.12892, -0.096511, 0.624182, 0.287549, 0.57688, 0.414946, 0.323249, 0.403032, -0.0317527, 0.916797, -0.721098, 0.0695724, 0.457732, -0.355129, 0.613207, -0.285384, 0.500878, -0.236825, -0.424412, 0.266094, 0.013013, 0.59312, 0.845511, -0.92633, -0.777423, -0.9404, 0.566957, -0.734961, -0.695236, -0.91934, -0.97824, -0.612982, -0.192005, -0.125759, -0.903314, 0.303266, -0.833192, 0.648339, -0.652532, 0.369291, -0.315797, 0.755683, 0.164626, -0.185809, 0.698104, 0.0361016, 0.918087, 0.362853, -0.611242, -0.493035, 0.735286, -0.209365, -0.886953, -0.635678, -0.39243, -0.17549, -0.178675, -0.0962364, -0.829652, -0.594737, -0.762252, 0.107704, -0.758102, -0.877619, 0.75676, -0.758662, 0.717996, 0.800941, -0.0437779, -0.281438, -0.670502, -0.472236, -0.91742, 0.334521, -0.268221, 0.0911821, 0.641364, -0.0382071, -0.559903, -0.0486965, 0.494272, 0.332916, 0.0633885, 0.463948, -0.397508, 0.362371, 0.68229, -0.51689, 0.999245, 0.300632, -0.631769, 0.633864, -0.460642, -0.704135, -0.661495, -0.598105, 0.610276, 0.469885, 0.239966, 0.756357, 0.697823, 0.769028, 0.653273, -0.231021, -0.761093, 0.483089, -0.698652, 0.636065, 0.177139, 0.27165, 0.656043, 0.70461, -0.00339911, -0.656326, -0.0699752, -0.299787, -0.294255, -0.428737, 0.737167, -0.692377, -0.66676, -0.445789, 0.34213, -0.529144, 0.358999, -0.818959, -0.093741, 0.671837, -0.728099, -0.706839, 0.168817, -0.508071, -0.284512, -0.582389, 0.542569, -0.304191, 0.625047, 0.91938, -0.36105, 0.983935, 0.220164, 0.389841, -0.769221, -0.790157, -0.947307, 0.528312, 0.212683, 0.137367, -0.580615, 0.45274, -0.413183, 0.013288, -0.568063, -0.0249212, 0.925989, -0.25406, -0.67192, -0.573684, -0.15127, 0.584647, 0.176225, 0.915426, -0.46284, -0.717785, -0.954316, 0.932841, -0.510349, 0.361743, 0.915626, 0.285052, 0.961295, 0.0538416, -0.318944, -0.316283, -0.95183, -0.252138, 0.166846, -0.0764332, -0.172272, -0.228295, -0.379126, -0.795835, -0.475616, 0.265879, 0.997434, 0.962061, 0.50676, -0.797877, 0.585232, 0.939411, 0.892701, 0.452442, -0.895877, -0.927218, -0.71231, 0.626257, -0.320911, 0.743522, -0.29679, 0.76175, -0.341856, -0.966213, 0.116094, -0.29168, -0.640454, 0.39342, 0.14409, -0.0674639, -0.0784302, -0.319681, -0.998904, -0.877679, -0.0765161, -0.0417564, -0.452937, -0.949059, 0.765666, -0.337499, -0.189569, -0.65918, 0.156203, -0.982421, -0.560063, -0.0149887, -0.658047, 0.834005, 0.415497, -0.235825, 0.173576, -0.659524, 0.158557, -0.674641, 0.106063, 0.0594573, 0.761408, -0.275604, 0.422246, 0.37007, -0.0198437, 0.80597, -0.565642, -0.535215, -0.170148, 0.139595, 0.297118, -0.169517, -0.655044, -0.716305, -0.312826, 0.940462, 0.0412912, -0.955947, -0.379926, 0.0363224, -0.792278, -0.218114, -0.758843, 0.255185, 0.367351, 0.500377, -0.636752, 0.579173, -0.907792, 0.777007, 0.151191, 0.207889, 0.184251, -0.462666, -0.771816, 0.990108, 0.372094, 0.602891, 0.448893, 0.821514, -0.189338, 0.984012, 0.609276, 0.538795, 0.889221, 0.250497, -0.75117, 0.204925, -0.81292, -0.915832, -0.851623, 0.138423, 0.0993911, 0.580514, 0.956771, 0.875488, 0.942912, 0.0556222, 0.17898, 0.408392, 0.577423, 0.105231, -0.516467, -0.643818, 0.273377, 0.11069, 0.624045, -0.667554, 0.409881, 0.427906, -0.30434, 0.185574, -0.92314, -0.0510322, -0.200475, -0.820682, -0.0992467, 0.500169, 0.545193, 0.0331674, -0.427551, 0.0818607, -0.731886, -0.898579, 0.915622, 0.776727, 0.393969, 0.646991, -0.782045, -0.95429, 0.330334, -0.90911, -0.304571, -0.138463, -0.950627, -0.23903, 0.862179, 0.359274, -0.178147, -0.871843, -0.421898, -0.860998, 0.0414558, -0.638287, 0.742811, -0.0438694, 0.793952, 0.962176, 0.509802, 0.638042, 0.174843, 0.483628, 0.896992, -0.255047, 0.767687, 0.641437, 0.143802, 0.924411, -0.148404, -0.345845, 0.72701, -0.427963, -0.19338, 0.49673, -0.616546, 0.0828626, -0.986117, 0.104466, 0.34865, 0.865461, 0.759549, 0.931839, 0.447515, -0.498096, 0.862552, 0.607862, 0.204178, 0.878168, -0.0440726, 0.0720072, -0.294297, 0.301034, -0.828997, 0.159556, -0.290193, -0.670572, -0.943964, -0.619547, -0.175789, -0.917109, -0.100958, -0.259766, 0.886419, -0.422071, 0.3104, 0.170384, 0.429329, -0.347637, 0.183745, 0.97295, -0.217553, 0.0289476, 0.201177, 0.832587, 0.0913865, -0.467743, 0.660472, 0.760936, -0.996358, -0.632668, 0.0751375, -0.408723, 0.566625, -0.622992, -0.75706, -0.330291, -0.803133, -0.0188252, 0.664834, -0.996574, 0.0920654, -0.389128, 0.168798, 0.923645, 0.362908, -0.518699, 0.876485, 0.175074, 0.588362, 0.864256, -0.226401, 0.680167, 0.610399, -0.2834, 0.671045, 0.479432, -0.838027, -0.785623, 0.390405, -0.811002, 0.587566, -0.253848, -0.397272, 0.0233885, -0.208822, -0.748525, 0.669846, -0.5619, -0.277445, -0.28517, 0.906591, 0.314519, 0.234954, 0.153232, 0.616244, 0.212157, -0.971181, 0.297007, 0.119035, -0.960601, 0.558678, -0.715506, -0.167985, -0.45639, -0.521401, 0.453866, -0.95639, 0.303012, 0.226575, 0.038478, -0.0620635, 0.4634, -0.762705, 0.719293, 0.444285, 0.173366, -0.562077, -0.173757, -0.0200436, -0.967666, -0.819326, 0.883132, -0.927525, -0.610121, 0.592093, 0.420266, 0.722705, -0.47446, 0.370945, -0.204714, 0.197159, 0.318641, -0.212282, 0.594287, 0.421213, 0.437416, 0.351019, -0.691627, -0.811621, 0.918798, 0.900668, 0.528814, -0.0590413, 0.684066, 0.107981, 0.48173, -0.0162396, 0.282615, -0.220973, -0.274485, -0.104145, -0.542305, 0.945352, 0.346032, -0.305673, 0.191562, 0.42227, -0.939059, 0.130837, -0.497511, -0.357547, 0.802287, 0.265956, -0.739147, 0.042561, 0.633604, 0.21968, 0.927187, 0.782604, 0.652653, -0.242341, 0.879407, 0.478862, 0.97698, 0.677557, 0.488262, -0.820791, 0.65534, 0.0610624, 0.369899, -0.0122771, 0.174676, 0.251742, -0.047401, -0.96479, 0.743653, 0.339273, -0.265848, 0.833849, -0.734348, 0.622742, 0.594591, -0.824714, 0.0690008, 0.435218, 0.871022, -0.500987, 0.434716, -0.0370029, -0.729159, -0.144558, 0.782031, -0.553843, 0.512105, -0.961874, -0.116745, 0.198025, -0.453173, -0.87303, 0.898569, -0.759882, 0.072374, -0.0222321, 0.317031, 0.123922, -0.262288, -0.682907, -0.232981},
-	{0.940557, 0.144502, -0.0478023, 0.1806, -0.960867, -0.828227, 0.865293, 0.920685, 0.143062, -0.655866, 0.184112, 0.161585, -0.020115, 0.976318, 0.958704, -0.245073, -0.257961, -0.471583, 0.52801, -0.57186, 0.146045, -0.129186, -0.860523, 0.682366, 0.804512, -0.104952, 0.972842, 0.285336, 0.105613, -0.46845, 0.194744, -0.797365, 0.547416, -0.167912, -0.717791, 0.826524, 0.770829, 0.838018, 0.447009, 0.604494, -0.889795, -0.342155, 0.19481, 0.888027, -0.373703, -0.33695, 0.49701, 0.580176, 0.766222, -0.488812, -0.940551, 0.627851, 0.866549, -0.694917, 0.96306, 0.941951, 0.581511, 0.40952, 0.864074, 0.95551, -0.636837, -0.533393, -0.310856, -0.537702, 0.0243442, -0.104093, 0.522572, 0.235366, -0.442156, -0.523353, 0.998372, 0.0830749, -0.160726, -0.975026, -0.0551524, -0.522374, -0.463713, -0.560278, -0.518108, -0.370451, 0.193212, -0.708192, -0.806354, 0.181521, 0.496255, 0.71788, -0.236801, 0.0493542, 0.664414, 0.566527, -0.919372, 0.620222, 0.0228482, -0.019804, -0.498929, -0.014243, 0.621906, -0.37651, 0.702494, 0.852684, -0.356663, 0.938027, 0.0847378, 0.649033, -0.733214, 0.0883046, -0.763402, -0.601793, 0.418933, 0.0935574, 0.176584, 0.982923, -0.0624076, 0.117644, -0.505069, 0.510141, 0.0206989, 0.104729, -0.0406368, -0.728337, -0.295299, 0.816595, -0.793418, -0.624824, -0.626187, -0.684131, 0.627726, 0.138278, -0.454113, -0.176476, 0.128722, -0.455955, 0.909076, -0.573386, 0.968983, -0.109653, 0.560359, 0.63303, -0.7463, 0.603751, 0.525741, 0.57998, -0.246593, 0.0343841, -0.0649759, -0.536274, -0.327049, 0.179759, -0.421203, -0.922281, 0.900434, -0.499844, 0.356592, -0.128047, -0.994994, 0.0968248, -0.953227, -0.570258, 0.918028, 0.374715, -0.93753, -0.262253, 0.586363, 0.274215, -0.18008, 0.0523749, 0.668424, 0.385376, 0.00961172, 0.374453, 0.465744, -0.575485, -0.570992, -0.024636, 0.706587, 0.74348, -0.832925, 0.114678, -0.930895, -0.611274, -0.0471417, -0.856734, -0.709473, 0.780193, -0.832095, -0.996377, -0.883193, 0.664843, -0.94542, -0.0172155, -0.628371, -0.659996, -0.727154, -0.939254, -0.613169, 0.00872598, 0.278555, 0.765932, 0.401651, 0.999299, 0.275348, 0.302117, 0.719538, 0.706003, -0.972685, -0.625523, -0.965629, 0.349541, -0.918531, 0.358447, -0.586171, -0.0296383, 0.209198, -0.0502047, 0.477836, -0.529679, 0.487274, -0.499277, 0.40395, -0.170611, -0.527608, 0.0382594, 0.936561, -0.571978, 0.904272, 0.304834, 0.702009, -0.740514, 0.344715, -0.277799, 0.618797, 0.354312, 0.0554898, 0.86061, -0.580035, -0.324323, 0.427906, -0.035084, 0.423984, 0.0200531, 0.876567, -0.357706, 0.711051, 0.546178, 0.243893, 0.583744, 0.319243, 0.727, 0.364175, -0.933227, -0.505954, 0.150332, -0.609765, -0.704506, 0.810955, -0.48729, 0.776103, 0.691782, 0.520586, 0.193897, -0.783763, 0.408956, -0.964914, 0.281219, -0.451709, -0.547875, 0.32841, -0.368647, -0.83516, 0.696931, 0.59121, 0.36873, 0.75547, 0.656873, 0.753975, 0.794381, 0.490349, -0.669359, 0.101202, -0.736732, -0.593917, 0.525908, 0.0627388, -0.424581, -0.205693, -0.624413, -0.515607, -0.627781, 0.850898, 0.209234, -0.444267, 0.455038, -0.756781, -0.00374085, 0.301489, 0.505599, 0.419194, 0.669947, -0.770574, -0.0360391, 0.673118, -0.205825, 0.445352, -0.6074, 0.549534, -0.997463, -0.19584, 0.661208, 0.0450707, -0.83088, -0.883608, -0.619877, 0.252446, 0.455392, -0.843439, -0.70476, 0.41873, -0.721254, -0.47855, -0.478362, 0.33526, -0.631503, -0.945772, 0.46041, 0.169423, 0.451965, -0.864084, 0.237466, -0.321207, -0.0694486, -0.795373, -0.498704, -0.010742, -0.275359, 0.57165, -0.574458, 0.506013, -0.338149, -0.961705, 0.251011, -0.247814, 0.0253394, -0.732038, 0.581877, 0.681744, -0.976592, 0.503012, 0.906809, 0.331602, 0.149246, -0.258017, -0.472506, 0.349522, -0.618017, 0.282331, 0.789677, -0.235659, -0.849933, 0.433434, 0.0779484, -0.73189, -0.413338, -0.0903146, 0.616688, 0.292063, 0.902304, 0.62657, -0.158113, 0.624886, -0.123131, -0.455486, 0.989374, -0.506, 0.161585, 0.517781, -0.335951, 0.760821, -0.730289, 0.585939, 0.754589, 0.328294, -0.193795, 0.316023, -0.281283, -0.359227, -0.189269, -0.484901, 0.737762, 0.597541, -0.14138, 0.267057, 0.629801, -0.302211, -0.827885, 0.573554, -0.257658, 0.365133, -0.526992, -0.29961, -0.856671, 0.103268, -0.825156, 0.0539041, -0.716845, 0.978868, -0.606269, 0.37932, -0.245518, -0.56808, 0.161034, -0.297612, -0.861556, 0.391396, -0.101023, -0.0808569, -0.0453859, 0.198183, -0.313873, 0.611421, -0.909925, 0.405293, 0.0966081, 0.490778, 0.408029, -0.167212, 0.833909, -0.777499, 0.909892, -0.514103, -0.128325, 0.0300263, -0.429633, 0.408251, -0.359597, -0.264678, -0.447025, -0.0106633, 0.664273, -0.823181, -0.953957, -0.838638, 0.991866, -0.778686, 0.843597, 0.232121, -0.646839, 0.272093, -0.231244, -0.53401, -0.188294, 0.0731792, -0.16754, 0.40707, -0.155629, -0.686799, -0.684694, 0.591647, -0.715629, -0.187047, 0.573578, 0.694554, 0.734365, -0.740774, 0.894626, -0.222019, 0.592535, 0.446316, 0.96532, 0.800976, 0.424258, -0.30737, -0.945436, -0.313155, 0.618832, 0.137824, 0.992449, -0.00280236, -0.194332, -0.0603172, 0.923614, -0.409442, 0.0424195, -0.837735, 0.791136, -0.298532, -0.145808, 0.521704, 0.000864628, -0.169477, 0.190105, 0.541433, -0.858942, 0.118544, 0.894155, 0.203573, -0.615923, 0.686388, -0.795761, -0.301951, 0.162785, -0.770181, 0.723604, -0.188625, -0.880737, 0.0419931, -0.891603, 0.0836246, -0.653432, -0.818747, 0.527533, -0.944189, 0.364149, 0.198044, 0.56739, -0.468922, 0.0866989, 0.582615, 0.436608, -0.616046, -0.52947, 0.115399, 0.423983, 0.809844, -0.185437, 0.118796, -0.0816155, -0.895629, 0.426866, 0.0347468, 0.991684, -0.785128, -0.694545, 0.562777, 0.0742807, -0.0221868, -0.411445, -0.780815, 0.757909, 0.750484, 0.283378, 0.277729, -0.158892, -0.531845, 0.676584, -0.567734, 0.432829, -0.771789, -0.528337, 0.866387, 0.54352, -0.951153, 0.754757, -0.200458, 0.525103, -0.679524, 0.636354, 0.193971, -0.249329, -0.157025, -0.711023, 0.381467, -0.106178, 0.819402, 0.0567424, -0.131755, -0.289376, -0.706305, -0.0456686, 0.346669, -0.527582, -0.489067, -0.219716, 0.372892, 0.553235, -0.378779, 0.0742501, -0.451169, 0.952301, -0.498221, 0.900601, -0.71707, -0.0692034, 0.220833, 0.541687, -0.991079, 0.844403, 0.380884, 0.760775, 0.541989, 0.688905, 0.171683, 0.632366, -0.614381, 0.307627, -0.178047, -0.910587, -0.784706, -0.776227, 0.637584, 0.691433, -0.359512, 0.406777, 0.552063, 0.629708, -0.727843, -0.152802, -0.0110646, 0.0472849, -0.266143, 0.537269, -0.362687, 0.206866, -0.0748588, -0.702979, -0.611968, 0.122869, -0.0622061, -0.308471, 0.349185, 0.833801, 0.471325, 0.545235, 0.451852, -0.38564, -0.277844, 0.236143, -0.325479, -0.00700351, 0.0136979, -0.434195, -0.38868, -0.438933, -0.719927, -0.972432, 0.11744, -0.368538, 0.607238, 0.907267, 0.385993, -0.0407795, 0.625901, 0.948179, 0.20446, -0.738964, -0.855457, 0.271205, -0.747467, -0.109716, 0.780014, 0.709018, 0.579916, -0.304849, 0.0955877, 0.663271, 0.357519, 0.972303, 0.167529, -0.571835, 0.508965, -0.968259, -0.0964146, -0.752781, 0.29728, 0.202635, 0.762822, 0.876097, -0.0193606, 0.734331, -0.426103, 0.521079, -0.363989, 0.74347, -0.829668, -0.185455, -0.589628, -0.922262, -0.543781, -0.0154422, -0.471268, -0.785695, 0.625952, -0.604582, 0.380661, 0.327546, -0.496279, 0.683337, 0.254037, 0.060341, -0.00665885, 0.258882, 0.075869, -0.672515, 0.98173, -0.0730885, -0.576501, -0.0288685, 0.983082, 0.570308, 0.123678, 0.220642, -0.66465, 0.92551, 0.455278, -0.453272, -0.419533, -0.591153, -0.0862551, 0.809304, 0.0372016, 0.379448, 0.444899, -0.0350644, -0.746833, -0.774763, -0.533159, -0.371203, 0.508425, 0.136009, -0.25457, 0.403954, -0.446719, 0.836387, -0.913578, -0.751675, 0.977271, 0.517591, -0.203274, 0.849163, -0.777565, 0.935437, -0.716428, -0.665716, 0.988087, -0.106048, 0.581069, 0.805745, 0.822886, -0.638642, 0.841702, -0.106218, 0.826378, -0.127193, -0.52412, -0.351094, -0.600986, 0.895983, -0.597047, 0.0365273, -0.843112, -0.700147, 0.921743, 0.539254, 0.202161, -0.216769, -0.0356241, -0.903441, 0.753362, -0.911503, -0.677872, 0.937233, -0.0330302, 0.97339, -0.212579, -0.231456, 0.494753, 0.142311, 0.51379, 0.640205, 0.921099, -0.0221317, -0.838334, 0.739488, 0.69488, -0.482511, 0.458809, 0.191297, -0.858081, -0.670309, -0.405781, 0.929641, 0.031521, -0.865913, -0.166365, 0.0160843, -0.067676, -0.830118, -0.819841, 0.104369, -0.528517, 0.960176, -0.165708, 0.61231, 0.361558, -0.0508518, -0.733392, 0.951584, 0.668937, 0.70408, -0.126097, -0.115074, -0.405223, 0.0486559, -0.132019, -0.333067, -0.266231, 0.231163, -0.822561, -0.813561, 0.0781107, 0.809245, -0.431499, 0.92507, 0.825297, 0.494289, 0.713189, 0.0742147, -0.0733549, 0.874629, -0.889221, 0.0199936, 0.623292, -0.56127, 0.959103, 0.83548, 0.636149, -0.797491, -0.651887, -0.647359, 0.204651, -0.626283, 0.0558687, 0.541637, 0.122152, 0.624492, 0.735688, -0.337287, -0.800402, -0.606252, 0.63472, 0.257628, -0.879192, 0.592172, -0.741546, -0.811677, 0.884685, -0.765191, 0.62416, -0.745367, 0.699524, -0.772874, -0.439281, 0.394641, -0.879973, -0.925535, 0.580444, 0.520776, -0.519903, -0.494173, -0.892419, 0.560651, -0.0302199, 0.0022071, 0.891365, 0.137275, -0.0432583, 0.685846, -0.307491, 0.899107, 0.316213, -0.167986, 0.472441, -0.188884, 0.195453, -0.624557, 0.692459, -0.842631, -0.633994, 0.399215, 0.889995, -0.514539, 0.94983, -0.0823926, 0.567346, 0.533872, 0.62978, 0.283444, -0.645844, -0.136027, 0.475374, 0.445591, -0.103688, -0.880119, 0.0119704, -0.916528, 0.127578, 0.584291, 0.465826, 0.169684, 0.931085, 0.115706, -0.38301, -0.447079, 0.0243836, -0.383227, -0.595182, 0.070898, -0.634695, -0.0102424, -0.924956, -0.914397, -0.716786, -0.692872, 0.668885, -0.212724, -0.331863, 0.000823979, 0.439815, -0.0113772, -0.392377, -0.386163, 0.582843, -0.409924, 0.696127, 0.691397, -0.589032, 0.160727, -0.593752, 0.748353, 0.583102, 0.510114, 0.714251, -0.250914, 0.113451, 0.593166, -0.797355, -0.276912, -0.961707, -0.000465251, 0.921255, 0.546741, -0.118371, -0.540877, 0.250842, -0.013694, 0.114494, -0.25759, -0.61914, -0.948651, -0.9348, 0.512689, 0.124297, -0.48627, 0.935544, -0.793862, -0.90652, 0.850623, -0.714315, 0.588403, -0.265846, 0.759831, 0.00321542, 0.507563, -0.460228, 0.144126, -0.741245, -0.889408, -0.0771251, -0.273418, 0.694262, 0.83112, 0.744484, -0.644536, -0.395549, -0.882456, 0.504192, 0.802905, 0.277332, 0.826149, -0.182582, -0.196201, 0.262126, 0.181472, -0.621811, -0.433164, -0.0371415, 0.298538, 0.0980718, -0.318859, 0.742582, -0.367739, -0.30596, -0.841478, -0.902754, -0.99471, -0.28036, -0.323664, -0.590264, -0.89334, -0.889309, -0.348822, 0.844263, -0.0732295, -0.370566, -0.495442, 0.760257, 0.607099, 0.533168, 0.138079, 0.359734, 0.0808034, -0.911611, 0.140612, 0.0748459, -0.605536, -0.0326596, -0.318189, -0.416732, -0.51444, 0.277145, -0.548954, -0.560292, -0.577721, -0.973068, 0.0735966, -0.870882, -0.570983, -0.160104, -0.869139, 0.47923, -0.67933, -0.24569, -0.389011, 0.652769, 0.198589, -0.566884, 0.322276, -0.919194, 0.742174, 0.591998, 0.129601, 0.420659, -0.104527, -0.431065, 0.844277, 0.429791, -0.302834, 0.472067, -0.554916, -0.739754, 0.831321, 0.525902, -0.820592, -0.704945, 0.959012, 0.392571, 0.823544, -0.507285, -0.00705552, -0.73345, 0.126277, -0.47473, 0.103804, -0.179301, 0.831516, -0.53398, 0.478913, -0.575135, -0.285235, -0.476495, -0.0364996, 0.573338, 0.851522, 0.888137, -0.615542, -0.965734, 0.874601, 0.645158, -0.92548, -0.370413, 0.964378, 0.655594, -0.434703, -0.127323, 0.345695, 0.994421, 0.917444, -0.162663, 0.205927, 0.699146, -0.331545, -0.599536, 0.944706, -0.614312, 0.988626, 0.753419, -0.727482, -0.409598, -0.583524, -0.193928, 0.411609, -0.27507, 0.502963, -0.866598, 0.420269, 0.868375, 0.47738, -0.938365, 0.782446, -0.89748, -0.438202, -0.148298, 0.955038, -0.496711, -0.483328, -0.895731, 0.338646, -0.614187, -0.858431, -0.834997, 0.582813, 0.524137, -0.0318165, 0.00250569, 0.958042, -0.416601, 0.934413, 0.319447, 0.600242, -0.484309, 0.531848, -0.972857, 0.937635, 0.85053, 0.874345, -0.703355, 0.338394, 0.787184, -0.837456, -0.87696, 0.720879, 0.445472, 0.785055, 0.958733, -0.735767, -0.636789, -0.14365, 0.88964, -0.858175, 0.213792, -0.916333, -0.393212, -0.875597, 0.00797848, 0.947674, -0.186541, 0.380717, -0.135863, -0.802184, 0.123094, 0.937372, 0.97942, -0.109512, 0.230435, 0.677439, -0.693531, 0.148073, -0.248146, 0.234873, -0.16743, -0.692559, -0.198295, -0.300864, -0.389585, -0.888932, -0.874942, -0.0112642, 0.509489, -0.402464, -0.698067, 0.254798, 0.599257, 0.0172925, 0.00504161, 0.930116, 0.571683, 0.243322, 0.897527, 0.821522, -0.184241, -0.594378, 0.158533, 0.941176, -0.375995, 0.417363, 0.932711, -0.71394, -0.715965, -0.163976, -0.813465, -0.539112, 0.134857, 0.931938, -0.63539, -0.852257, 0.128889, -0.305505, -0.615913, 0.316143, -0.842696, 0.285683, -0.897742, 0.163197, 0.0524085, -0.0960304, 0.801242, -0.211556, 0.940738, -0.186061, -0.414175, 0.889025, 0.238924, -0.823952, -0.659917, 0.60195, -0.221364, -0.567542, 0.83888, -0.662667, 0.847142, -0.981071, -0.809334, -0.553233, -0.251957, 0.725649, -0.500411, -0.451663, -0.724006, 0.624439, 0.416817, -0.824398, -0.226743, -0.533155, -0.228784, 0.842351, -0.545553, -0.561865, 0.58936, 0.977914, -0.616829, -0.514436, 0.6892, 0.277525, -0.908681, -0.226866, -0.653585, 0.312337, -0.597979, 0.306054, 0.644871, -0.787561, -0.211544, -0.917234, 0.738234, 0.286417, -0.785673, 0.607687, 0.0885449, -0.492576, 0.974273, -0.960033, -0.962143, 0.74126, 0.9249, -0.712312, -0.313339, 0.122643, 0.0584091, -0.0973471, -0.654526, 0.832559, -0.0531666, 0.661917, 0.684275, 0.68541, -0.116816, -0.804747, -0.173124, -0.447882, 0.803911, 0.962539, 0.315778, -0.151197, -0.463041, 0.0965847, 0.927834, 0.59543, 0.613511, 0.493139, -0.609219, 0.0871963, 0.794142, -0.870833, 0.851112, 0.997539, 0.932019, 0.190072, 0.594014, -0.307628, 0.991155, 0.0937854, -0.375015, 0.050981, -0.915659, 0.407132, 0.125695, 0.34775, -0.897198, -0.532016, 0.168196, -0.561553, 0.687462, -0.461034, -0.991927, -0.157944, -0.46996, 0.798577, -0.399837, -0.553683, 0.72607, 0.57962, -0.687262, 0.401074, 0.967087, 0.51339, -0.118206, 0.745405, -0.693336, -0.124793, 0.219625, -0.046881, 0.891648, -0.5561, 0.53997, -0.87939, 0.591551, -0.982746, -0.923219, -0.668067, -0.257784, -0.446811, 0.162332, 0.761409, 0.0247359, 0.625068, 0.0063498, 0.79364, 0.456682, 0.884301, -0.469607, -0.183157, -0.0355725, 0.199003, 0.273339, 0.360818, -0.418539, 0.238656, -0.146205, -0.436731, 0.936838, -0.35263, -0.475066, 0.498755, -0.160902, 0.782594, 0.782478, -0.747644, 0.650231, -0.906539, -0.121166, 0.889463, -0.55231, -0.942792, -0.183931, -0.702472, 0.623068, 0.397692, 0.720434, 0.0292131, -0.429584, 0.158358, -0.550303, 0.284625, 0.833952, -0.906175, 0.938977, -0.254264, -0.26143, 0.665336, -0.173895, 0.494444, 0.0328635, 0.927203, 0.608226, -0.697535, 0.848155, 0.803564, 0.750594, -0.446684, 0.970758, -0.665114, -0.59362, -0.423303, 0.83679, 0.518492, 0.214149, 0.524477, -0.954487, -0.746378, -0.166641, 0.750434, -0.123036, 0.354898, -0.935996, -0.968225, -0.190758, -0.250776, 0.0098446, 0.115851, 0.116192, 0.636367, 0.0864717, -0.244225, -0.988259, 0.0732052, 0.328435, 0.412009, 0.870885, 0.412394, -0.154633, -0.829781, -0.955889, 0.618912, -0.44722, 0.58517, 0.753154, -0.351871, -0.551362, -0.235088, 0.0809169, -0.2333, -0.241035, -0.228188, -0.730136, -0.952508, 0.87755, -0.62434, -0.675916, -0.911757, -0.710295, 0.267836, 0.593341, 0.0364338, -0.517363, -0.0620283, -0.834418, 0.689235, 0.993615, 0.504005, -0.844907, -0.489428, -0.0938502, 0.913648, -0.192259, -0.410195, -0.875357, -0.436634, -0.397333, 0.386041, -0.54442, -0.587253, -0.179537, 0.333511, 0.34184, 0.471448, -0.275589, -0.177504, 0.786249, 0.939465, 0.791367, -0.554799, 0.759373, -0.969592, -0.82617, -0.966195, -0.83269, 0.48131, 0.163093, -0.145439, 0.484754, 0.924318, -0.371798, 0.592982, -0.550451, 0.762059, -0.501834, -0.172014, -0.834707, 0.239033, -0.289072, 0.105001, 0.26802, 0.185542, -0.484799, -0.568495, -0.192938, 0.948756, 0.395873, -0.711316, -0.126553, 0.690277, -0.0935959, 0.698494, -0.658318, -0.286038, -0.550956, -0.304747, 0.561186, -0.600906, 0.0740648, 0.185087, -0.338502, -0.478431, -0.753168, -0.501294, -0.341007, -0.39282, -0.670911, 0.605463, -0.236263, 0.102179, -0.630905, -0.123145, 0.129404, -0.485435, -0.331188, -0.32593, 0.729172, 0.65741, -0.231576, 0.243472, 0.140399, -0.13838, -0.871506, -0.460761, 0.409823, 0.166907, 0.563995, -0.319715, 0.537978, -0.785014, -0.526603, 0.408426, -0.116504, -0.356903, 0.237438, -0.562336, -0.657224, 0.647727, -0.192223, -0.801931, 0.990095, 0.559774, 0.0211231, -0.929037, 0.385239, -0.913334, -0.26689, -0.213734, -0.136013, 0.461956, -0.638903, 0.269454, 0.859031, 0.0382179, 0.233603, 0.957836, 0.174464, -0.456438, 0.868654, -0.0952529, -0.269261, -0.101771, 0.0924691, -0.593843, -0.667501, 0.899883, 0.947433, -0.982481, -0.935068, 0.162483, 0.649997, 0.0812273, -0.132475, 0.554134, 0.44779, 0.279339, -0.751807, -0.0254565, -0.216745, 0.950925, 0.000898761, 0.162096, -0.304173, -0.621831, -0.227723, -0.119161, 0.959825, -0.173419, -0.326709, 0.554351, -0.542847, -0.904341, -0.465547, 0.882986, -0.682194, 0.00433981, 0.877501, -0.409473, 0.349571, 0.387037, -0.102896, -0.8262, -0.599831, 0.0243062, 0.617235, 0.616417, -0.679428, 0.561112, -0.151634, 0.903568, 0.0702998, 0.420216, 0.246389, 0.121968, 0.426936, -0.666684, -0.109073, 0.963801, -0.49103, -0.367555, -0.767153, -0.74874, 0.456994, 0.116525, -0.350098, 0.02762, 0.821408, 0.445374, -0.314105, -0.156418, -0.337621, 0.196428, 0.154939, -0.465186, -0.0553959, 0.383117, 0.0319626, -0.622493, -0.960608, -0.301452, 0.0805942, -0.586248, 0.9567, 0.670438, 0.179854, 0.764267, 0.312392, 0.678446, -0.0272592, 0.429674, 0.862228, -0.286386, 0.0908275, -0.0315768, 0.245572, 0.995035, -0.800307, -0.953243, 0.449693, 0.0199902, -0.783901, -0.969778, -0.953465, 0.087901, 0.252922, -0.661147, 0.814328, 0.996525, 0.329853, 0.792054, 0.294157, -0.856054, 0.110698, -0.795822, 0.116925, -0.0556029, -0.754391, -0.300081, 0.330363, 0.351184, -0.836596, -0.0278236, 0.807145, -0.158946, 0.92912, 0.726664, -0.254811, 0.303191, -0.501644, 0.875212, 0.581956, -0.0339384, 0.858535, 0.765732, -0.649189, 0.653875, -0.569056, -0.237362, 0.833647, 0.0496025, -0.240713, -0.887294, 0.580579, -0.938684, 0.959968, -0.33579, 0.446852, -0.340631, -0.968358, -0.953625, -0.540597, -0.576839, 0.501228, 0.265041, 0.678999, 0.413701, -0.679211, 0.303003, -0.262978, -0.463043, 0.910775, -0.557959, 0.365039, -0.826316, -0.237861, -0.805211, -0.607224, 0.988528, 0.482874, -0.39235, -0.354483, 0.428584, -0.029635, -0.686392, 0.578565, 0.532744, -0.387409, -0.484528, -0.960559, -0.0303841, -0.769355, 0.156069, 0.406493, 0.15748, 0.0827807, -0.801608, -0.43577, 0.680865, -0.1713, 0.567012, -0.444227, -0.201261, 0.774759, -0.84672, 0.80686, 0.791865, 0.565776, 0.259467, 0.277573, -0.30093, -0.688618, -0.311674, -0.253183, -0.580641, 0.690063, -0.905376, 0.845449, 0.885021, -0.414857, -0.090134, 0.306989, -0.675466, 0.967244, -0.706749, 0.540222, 0.295113, 0.556918, -0.419409, -0.72695, 0.045529, 0.505644, -0.38579, -0.0152364, -0.56236, -0.314074, -0.205826, -0.607528, 0.638066, -0.0394058, -0.221703, 0.517821, 0.0340239, 0.74072, -0.759473, 0.146768, -0.439155, -0.846668, -0.837046, 0.953177, 0.491007, 0.793534, -0.612276, 0.250905, 0.708451, -0.0903789, -0.561769, -0.349882, 0.415511, -0.874791, -0.809554, -0.118246, -0.508487, -0.686594, -0.527543, 0.249388, 0.599952, 0.647028, 0.344559, 0.286976, 0.926478, 0.562456, -0.516859, -0.00239281, -0.0281239, 0.215009, 0.447958, 0.830809, -0.363978, 0.927675, -0.432768, 0.184238, -0.79694, -0.516453, -0.368853, -0.974125, -0.889617, -0.113749, 0.392435, 0.866518, 0.483686, 0.726689, -0.923515, 0.454859, -0.972294, -0.324552, 0.99786, -0.94215, 0.546959, 0.732537, -0.521135, -0.998611, 0.340508, 0.185016, -0.792236, 0.203537, 0.246034, 0.6343, -0.495785, -0.592086, -0.711208, 0.161735, 0.0923243, 0.731072, -0.0705987, 0.277229, -0.163961, 0.924296, 0.486862, 0.0707351, -0.843736, -0.986915, -0.340136, 0.867125, -0.917323, 0.313872, -0.830123, 0.0725538, -0.305258, -0.816089, -0.296332, 0.0463499, 0.582735, -0.911011, -0.55666, 0.398797, 0.313729, 0.759863, 0.822885, -0.0486273, 0.396988, 0.401757, 0.499636, -0.972409, 0.694457, 0.633381, 0.474665, -0.792805, -0.187774, 0.0219394, 0.452237, 0.0717692, -0.0427927, 0.985679, -0.394947, -0.611943, 0.655212, 0.0603701, 0.643722, 0.64041, -0.258367, -0.175849, -0.621907, 0.847641, -0.98085, 0.322062, 0.273186, -0.120404, 0.648661, 0.229345, -0.140584, 0.174688, 0.648173, -0.189473, 0.127531, 0.135037, 0.488708, 0.188664, 0.804841, -0.00769389, 0.242555, 0.56694, 0.298395, -0.811113, -0.875504, -0.806241, -0.693095, -0.279363, -0.971081, 0.713632, 0.511768, 0.625646, 0.141108, 0.847148, 0.249481, 0.204535, 0.464735, -0.486569, -0.174472, -0.130404, -0.530815, 0.871919, -0.906573, -0.709511, -0.661875, -0.447309, -0.642957, -0.44513, 0.766812, 0.107806, -0.33836, 0.147193, -0.12165, -0.470953, 0.333189, -0.181017, 0.123184, -0.433461, -0.731114, 0.329738, 0.698, 0.412297, 0.192589, 0.493742, 0.818517, 0.219433, -0.302461, 0.275378, 0.987124, 0.446864, -0.640802, 0.743457, -0.690284, 0.991304, 0.54527, -0.0422142, -0.41866, 0.459599, 0.490072, -0.278709, -0.855333, 0.892023, 0.501856, 0.921727, 0.721551, -0.0106124, 0.20846, 0.129916, 0.771481, -0.302204, -0.0228775, -0.951719, 0.120279, -0.194424, -0.394282, -0.733131, -0.52382, -0.242511, 0.351979, -0.20702, -0.357425, 0.996041, -0.983629, 0.977672, -0.584837, -0.321675, -0.873974, 0.515316, -0.307388, 0.710001, -0.0623709, -0.9455, -0.0122025, 0.662581, -0.778546, 0.871079, -0.130829, -0.763097, 0.610865, 0.570686, -0.16721, 0.53838, -0.489647, -0.0420069, 0.853698, -0.105057, -0.559691, 0.709125, 0.8031, -0.94933, -0.0494215, -0.218017, 0.487577, 0.904561, -0.881209, -0.629406, 0.610121, -0.631618, 0.183613, 0.167908, -0.672388, -0.218939, -0.933927, 0.459327, -0.800012, -0.145985, -0.898699, 0.741446, 0.144279, 0.448759, 0.103221, 0.302995, -0.881132, -0.465085, 0.894859, 0.803043, 0.628146, -0.390573, -0.726661, 0.463987, 0.438332, -0.757439, -0.906272, 0.877629, -0.121357, -0.281085, -0.744896, -0.204913, 0.0877135, 0.440552, -0.600989, 0.381467, 0.182951, -0.739327, 0.443082, -0.0538688, -0.979575, -0.295874, 0.361554, -0.909077, 0.666046, 0.0129305, 0.503119, 0.788452, -0.911314, -0.783517, -0.156599, 0.939882, 0.132486, 0.184076, 0.261078, -0.766019, -0.42672, 0.474839, -0.449752, -0.100941, -0.160433, 0.624123, -0.96388, -0.949524, -0.318939, 0.2998, -0.673372, -0.827588, 0.150962, 0.167213, 0.611061, -0.433444, 0.700318, 0.0108513, 0.0924228, -0.652413, 0.263464, -0.109807, 0.428434, 0.513216, -0.385023, 0.430156, -0.939577, -0.0595613, -0.0993835, 0.590414, -0.954139, -0.843831, -0.280328, -0.992489, -0.626867, 0.79752, -0.433686, -0.889094, 0.499755, -0.613626, -0.955543, 0.665696, 0.761444, 0.650257, 0.8563, 0.132493, 0.901457, -0.995172, -0.936342, -0.802613, -0.614042, 0.29935, 0.252403, -0.653033, 0.239184, 0.92284, 0.147734, 0.0402076, 0.527397, 0.477727, -0.390998, 0.509904, 0.861569, -0.196755, 0.634805, 0.119851, 0.510902, -0.248815, -0.208442, 0.946219, 0.165152, -0.641279, 0.636108, 0.240076, -0.55017, 0.29192, -0.759191, 0.853562, 0.151369, 0.314921, -0.758985, 0.999208, 0.0248393, 0.260594, -0.147286, 0.683064, 0.113782, 0.409857, 0.955933, 0.152967, 0.168257, -0.382734, -0.978527, 0.921282, -0.457034, 0.697072, 0.806172, -0.443327, 0.322861, 0.418383, -0.0357211, -0.754095, 0.163614, 0.135236, 0.222348, -0.584141, -0.321914, -0.326254, -0.0167602, -0.851782, -0.105293, -0.846817, -0.274989, 0.253078, 0.944163, 0.636441, 0.975997, 0.223781, -0.954742, -0.431682, 0.360941, -0.846614, -0.614619, 0.786743, 0.895424, 0.478337, 0.115205, -0.883743, -0.928899, 0.175306, -0.788793, 0.148323, 0.297399, -0.747783, -0.00702313, 0.9682, 0.427334, -0.268601, 0.865041, -0.423517, 0.700273, 0.838776, 0.754859, 0.659254, 0.849469, 0.786798, 0.942385, 0.616084, -0.751864, -0.361387, 0.514919, -0.59171, -0.661476, -0.694311, 0.992248, -0.249819, -0.528137, 0.945216, -0.621038, 0.314976, -0.355979, 0.748655, 0.203289, -0.546541, 0.754348, 0.0928608, -0.0813726, 0.636779, 0.0371056, 0.937011, 0.107155, 0.20721, 0.271875, 0.753021, -0.661661, 0.485193, -0.678346, 0.350972, 0.484523, -0.779651, -0.916674, 0.353326, 0.992405, 0.959309, -0.28039, -0.706833, -0.507452, 0.300477, -0.800827, 0.470098, -0.534988, -0.957186, -0.893905, 0.847917, 0.216207, 0.133236, 0.800432, 0.951542, -0.508697, -0.16266, -0.465808, -0.948706, 0.954989, 0.561064, -0.292215, 0.379891, 0.0630234, 0.456869, -0.622326, 0.288883, -0.753592, -0.199929, 0.601656, 0.557718, 0.264991, -0.649169, -0.242476, -0.726431, -0.887341, 0.31233, -0.407833, 0.545929, -0.589699, 0.8157, -0.052904, 0.355972, -0.684461, -0.686277, -0.574901, 0.777653, 0.13169, -0.87721, 0.217459, 0.386177, 0.402861, -0.164812, -0.757523, -0.829768, 0.258248, -0.520738, -0.00591673, 0.905522, -0.457948, -0.384953, 0.935233, 0.00120013, 0.650314, -0.609666, -0.504384, -0.343589, 0.196241, -0.903355, 0.375415, -0.661329, -0.658677, -0.485401, -0.785385, 0.56849, -0.94766, -0.579078, -0.662036, -0.509908, -0.28586, -0.244676, 0.478744, 0.743086, -0.386427, 0.373439, 0.795629, 0.630692, 0.131952, 0.787158, 0.614638, 0.780835, 0.517664, -0.91975, -0.869884, -0.395127, -0.0785077, -0.586186, -0.496686, 0.0032074, 0.954911, 0.570174, -0.335716, 0.771132, 0.251498, 0.432711, -0.280172, 0.278652, 0.108573, -0.462917, 0.456377, -0.681359, 0.736347, 0.178037, 0.0489221, 0.932355, 0.304678, 0.435914, -0.914979, -0.91939, -0.377802, -0.233236, 0.802755, -0.619208, 0.374428, -0.501701, -0.541503, 0.383932, -0.766872, 0.540095, 0.803208, 0.0846558, 0.924653, 0.649727, -0.08036, 0.952701, -0.163052, 0.200555, 0.250548, 0.497765, 0.230515, 0.966373, 0.132571, 0.344693, -0.797562, 0.261733, -0.493153, 0.934932, 0.76472, 0.552851, -0.025533, 0.157725, -0.718332, -0.354895, 0.954263, 0.686722, -0.921644, 0.31426, -0.649319, 0.515248, -0.928371, 0.0111879, -0.458806, -0.306626, 0.285394, -0.249258, 0.483625, 0.540752, -0.8869, -0.00577121, 0.307965, 0.314009, -0.065972, 0.109047, 0.637413, -0.256828, -0.392822, 0.2244, -0.0595655, -0.390448, -0.393285, 0.789654, 0.722816, -0.495609, -0.655963, -0.414449, -0.57108, -0.505695, -0.110125, -0.677375, 0.104956, 0.874816, 0.204894, 0.00378444, 0.431366, 0.615898, 0.863978, 0.984073, 0.680522, -0.234334, 0.453816, 0.142361, -0.919203, 0.662766, 0.410131, -0.617354, -0.69473, 0.460747, 0.989379, 0.397467, -0.218015, 0.882626, 0.646004, -0.91384, 0.637482, 0.641868, 0.315631, 0.752367, -0.900471, 0.822647, -0.104339, 0.538941, 0.781963, 0.0451827, 0.429466, 0.85402, 0.939662, 0.207703, 0.244868, 0.425679, 0.465192, -0.609131, 0.541757, 0.968603, -0.397364, 0.896805, 0.158692, -0.884407, -0.227728, 0.7764, -0.857304, 0.299911, -0.780321, -0.89212, 0.908552, -0.173988, 0.204373, -0.310044, 0.924671, -0.976338, 0.481588, -0.610691, 0.0873509, 0.605608, -0.0559716, 0.526613, -0.148277, -0.72694, 0.516611, -0.988562, -0.366628, 0.564466, 0.563781, 0.97085, 0.742343, -0.743091, 0.0617656, -0.123314, -0.650602, -0.168048, -0.0917129, 0.462412, 0.973655, 0.140872, -0.804189, -0.530475, 0.669223, -0.210733, -0.829909, -0.629734, -0.366303, -0.0252048, 0.924784, -0.0431176, -0.351413, -0.00735968, -0.606079, 0.242271, -0.99132, 0.0479868, 0.577524, -0.5801, -0.114751, 0.00849512, -0.976336, 0.678393, 0.105203, -0.381771, -0.827075, 0.174232, 0.821541, -0.155884, 0.277157, 0.983386, 0.128476, -0.418472, 0.611882, 0.374961, 0.18781, -0.303435, 0.887418, 0.879443, -0.882834, -0.805088, -0.230649, -0.493811, -0.690894, 0.647544, -0.00526031, 0.0056794, -0.408144, -0.365415, 0.734269, 0.417559, -0.271808, -0.979489, 0.885438, 0.028256, 0.821859, -0.0479482, 0.40474, 0.533696, -0.587229, 0.22485, 0.469931, -0.422443, -0.161096, 0.946936, 0.979847, 0.382136, 0.112021, 0.0235169, 0.543097, -0.223035, -0.732497, -0.028408, -0.869485, -0.554807, 0.796811, 0.393809, -0.380186, -0.564501, -0.514869, 0.515553, -0.651395, 0.0401575, -0.33461, -0.176154, 0.638055, -0.0283669, -0.676058, 0.772908, 0.191286, 0.662044, 0.00046493, -0.62382, -0.641944, 0.312986, 0.0208827, 0.489058, 0.867891, 0.388231, 0.0841373, 0.845865, 0.134593, -0.726931, 0.0314089, 0.705414, 0.264466, 0.741568, 0.71272, -0.111157, -0.622168, -0.146046, -0.337334, -0.936047, 0.683929, -0.165655, 0.816209, -0.207226, 0.0217815, -0.691216, 0.54019, 0.957145, -0.67599, 0.486195, 0.710156, -0.589542, 0.222047, 0.703029, 0.168817, 0.702629, -0.334072, -0.52621, 0.353637, 0.376879, -0.442789, -0.913126, -0.322999, 0.421104, 0.907647, 0.152957, 0.682516, 0.61649, 0.639496, -0.964023, 0.410642, 0.239736, -0.778963, -0.899058, -0.322979, 0.422598, 0.653267, 0.301443, -0.396164, 0.369274, -0.263987, 0.0627362, 0.525228, -0.833875, 0.263328, 0.897147, -0.585465, 0.640217, -0.899874, 0.103077, 0.0408538, -0.0516946, 0.725619, -0.132209, 0.5556, -0.931437, -0.564601},
-	{0.828269, -0.934421, -0.964057, 0.689674, -0.491014, 0.824352, -0.184292, -0.797849, 0.124955, -0.360959, -0.0181478, 0.80785, -0.161478, 0.542659, 0.840278, 0.900646, 0.150947, -0.565715, 0.33066, 0.499356, 0.520743, 0.462346, 0.923617, 0.998369, -0.262119, 0.675598, -0.60357, 0.8994, 0.329592, -0.10793, 0.049422, 0.586662, -0.841338, 0.349913, 0.450648, -0.659888, -0.583503, 0.00715608, 0.681829, 0.663442, 0.185743, -0.931639, -0.758507, -0.805566, 0.418383, -0.594848, -0.0939576, -0.156789, 0.340714, -0.607456, 0.632326, 0.471408, 0.937991, 0.789602, -0.470636, 0.969459, 0.684191, 0.962969, 0.202029, 0.335599, -0.558232, -0.51952, -0.261846, 0.313814, -0.399212, -0.933862, -0.637112, 0.636688, 0.766615, 0.841332, -0.0964212, -0.30346, -0.740967, 0.713099, 0.68234, 0.757851, -0.877409, 0.0810194, 0.957983, -0.423302, 0.0509531, 0.48104, 0.807492, -0.84176, 0.323594, -0.22635, -0.945121, -0.116165, 0.763569, -0.183135, -0.0373184, 0.37221, -0.14812, -0.255412, -0.497034, 0.241373, -0.741647, -0.132739, 0.737013, 0.016666, 0.0273127, -0.667006, 0.952733, -0.2795, -0.560393, 0.425497, -0.636291, 0.430302, -0.825407, 0.938107, 0.96293, -0.949138, 0.0922515, 0.362956, -0.0656226, 0.302666, -0.884679, 0.466842, -0.0548015, -0.307481, 0.976365, -0.613727, -0.133861, -0.530244, -0.717297, 0.592435, -0.39888, 0.994145, -0.472803, -0.661149, 0.167191, -0.695558, -0.826679, -0.693518, -0.659143, -0.0920577, 0.965104, -0.991262, -0.866165, 0.282112, 0.552734, -0.640059, 0.884295, -0.330375, 0.824367, 0.364015, -0.928077, 0.584062, 0.476236, -0.664807, -0.243465, 0.538536, 0.124258, 0.458444, 0.46692, -0.357312, -0.895703, 0.671055, -0.863497, -0.535878, -0.582912, 0.366025, -0.989825, 0.43522, -0.655, -0.0659642, -0.191469, -0.357947, 0.0736857, -0.5545, -0.901119, 0.590644, -0.58228, 0.305741, 0.777842, 0.139372, -0.202495, 0.459234, 0.189088, -0.325379, -0.33496, 0.233825, -0.298822, -0.246568, -0.413175, -0.904429, -0.000655207, -0.612101, 0.510027, 0.977934, -0.156918, 0.52909, 0.0274883, -0.713837, -0.0243291, 0.317279, 0.734954, 0.58394, -0.107804, 0.492553, -0.254553, 0.531016, 0.78984, -0.750171, -0.0108387, 0.189066, -0.72451, 0.347366, -0.221692, 0.520956, 0.211907, -0.127783, -0.469487, -0.625706, -0.151573, -0.878127, -0.00816139, 0.597493, -0.566162, 0.547995, -0.329821, 0.729243, -0.418969, 0.861448, 0.857174, -0.968417, -0.391622, 0.402448, -0.218967, -0.796854, -0.349077, 0.386446, -0.123921, -0.166016, 0.416668, 0.142762, 0.396389, -0.6762, -0.171394, -0.634301, 0.297774, -0.976899, -0.060134, 0.809532, 0.582201, -0.168788, -0.467763, 0.764798, 0.650886, 0.968801, 0.146606, -0.310339, 0.652427, 0.024302, 0.277242, -0.45086, 0.467573, 0.024659, 0.646075, 0.624199, 0.246234, 0.721347, -0.755308, -0.597561, 0.051934, 0.604967, -0.866302, 0.180006, -0.730807, 0.644894, -0.680614, 0.0291463, 0.947648, -0.489278, 0.284691, 0.77253, -0.970445, 0.494133, 0.292465, 0.324838, -0.426111, -0.0481876, 0.498778, -0.80311, -0.779435, -0.242585, 0.479307, 0.875122, -0.534943, -0.260206, -0.921194, -0.243762, -0.0422805, 0.870033, -0.262604, 0.70046, -0.556234, -0.829224, -0.493643, 0.0942852, -0.0405385, 0.146726, 0.825362, 0.34572, -0.138308, 0.650341, -0.930658, 0.94536, -0.620688, 0.666683, 0.286063, -0.390575, -0.952602, 0.385772, 0.633651, 0.0789794, 0.112097, 0.526753, -0.838819, -0.904609, 0.685226, -0.487323, 0.249041, -0.855216, -0.973703, 0.672439, -0.85515, 0.606113, -0.51714, -0.112802, -0.266181, -0.556493, 0.976075, -0.427309, 0.0586516, -0.0622584, -0.132839, -0.557005, -0.0830313, 0.51426, 0.233057, -0.472997, -0.393528, 0.396239, -0.0430557, 0.42543, -0.310602, 0.626415, -0.436138, -0.327454, -0.0304421, 0.558369, -0.606718, 0.98598, 0.196628, -0.558315, -0.987948, -0.628121, -0.828805, 0.405622, -0.481866, -0.790134, -0.279078, -0.879574, 0.637968, -0.750171, 0.365886, -0.446096, 0.742598, -0.975402, -0.790922, 0.287281, 0.105138, -0.0239104, -0.487802, -0.233084, -0.52736, -0.471499, -0.932846, -0.304989, 0.697041, -0.30545, 0.960679, 0.969254, 0.251619, 0.376181, 0.736113, -0.409999, 0.194574, -0.623118, 0.240161, 0.39086, 0.425053, 0.709252, -0.861959, 0.317631, -0.23428, -0.451819, 0.132834, 0.235984, 0.107868, -0.679498, 0.709952, -0.500587, 0.443225, 0.584045, 0.624616, -0.249894, -0.746393, -0.676007, 0.0868944, -0.847157, 0.15072, 0.96157, 0.595415, -0.0922225, -0.0773662, -0.916824, 0.348277, 0.88654, 0.809576, 0.86299, 0.329783, -0.196957, -0.14822, -0.334647, -0.687752, 0.869404, 0.216473, -0.332089, -0.17268, -0.812638, -0.958804, -0.185689, 0.731586, -0.249435, -0.563527, 0.269102, -0.167669, 0.464442, 0.304557, -0.276645, 0.218407, 0.0565956, -0.0178737, -0.777932, 0.38505, -0.471805, -0.108592, -0.864543, 0.42525, 0.957452, 0.349751, -0.0420829, -0.349273, 0.0160602, 0.749231, -0.808089, 0.157944, -0.0212812, 0.446112, 0.415083, 0.853884, 0.821781, -0.774415, -0.843439, -0.859902, 0.865565, -0.108788, 0.960423, 0.320409, 0.729356, 0.4037, 0.310827, 0.0864302, 0.498096, -0.816528, 0.0120769, 0.254652, -0.754332, -0.528774, -0.616135, 0.283896, -0.623415, -0.302754, -0.351688, -0.028961, 0.0530691, 0.0121869, -0.269042, -0.759371, -0.254613, -0.98193, -0.445329, 0.477666, -0.777325, -0.642527, 0.0825188, 0.829986, -0.332109, -0.101999, 0.4613, 0.425826, 0.773411, -0.545166, -0.114897, -0.0163914, 0.663221, -0.278288, 0.499424, -0.0791742, -0.863917, -0.151749, 0.492144, -0.924322, 0.212359, 0.304663, 0.627714, -0.0635216, -0.934338, -0.292273, 0.732475, -0.360426, -0.737824, -0.500258, 0.606404, 0.172207, -0.59251, -0.253434, -0.543388, -0.25056, 0.844417, -0.942019, 0.478948, -0.251323, -0.60618, 0.800709, 0.108964, 0.154897, -0.642769, 0.408138, -0.816355, -0.528792, 0.743014, 0.200927, 0.242373, 0.902017, -0.875178, 0.877862, 0.662174, -0.268433, 0.580929, -0.95528, 0.489435, 0.678051, -0.502022, 0.0846727, 0.347801, -0.203681, -0.23628, -0.368179, -0.154078, 0.502949, -0.856927, -0.958798, -0.756786, -0.932211, -0.217788, -0.398737, -0.621729, -0.0321839, -0.305407, 0.363527, -0.608733, -0.685167, -0.356298, 0.784687, -0.219961, 0.489674, -0.151094, -0.529562, -0.346022, 0.632562, -0.226975, -0.217033, -0.451475, -0.242144, 0.677349, 0.604987, 0.513159, -0.105972, 0.53652, -0.920263, 0.124718, -0.235945, -0.00557887, 0.950405, 0.690502, 0.391055, -0.867989, 0.250468, -0.0881939, -0.593269, 0.643103, 0.831922, -0.983776, 0.934001, -0.718492, 0.223069, 0.610984, -0.845199, 0.887808, 0.264311, 0.6217, 0.848134, 0.0685472, 0.176647, -0.569771, -0.12811, 0.152007, 0.51354, 0.0323663, -0.864904, 0.447375, -0.169947, -0.825915, -0.538321, 0.317498, -0.176034, 0.426655, 0.827245, -0.519874, -0.0801998, -0.793934, -0.850027, -0.392003, -0.594325, 0.401909, -0.495625, -0.622063, -0.0367386, -0.495426, 0.654727, 0.768527, 0.0500126, -0.36143, 0.56698, 0.710628, 0.998026, 0.287735, -0.4117, 0.433923, 0.936162, -0.687213, 0.904282, 0.0588221, 0.0600135, -0.178026, -0.340551, 0.303435, -0.594328, 0.337182, 0.441645, -0.546561, 0.37133, 0.184247, 0.164126, -0.679871, -0.213206, 0.192651, 0.0632655, -0.737672, 0.546972, -0.948892, -0.0681335, -0.705715, -0.998716, -0.449188, -0.895763, -0.988658, 0.539608, -0.94519, -0.219214, -0.909214, 0.0351403, 0.632806, 0.27878, -0.273675, -0.817893, -0.491893, 0.412497, 0.81585, -0.842024, -0.663682, 0.780993, 0.883123, -0.0243613, 0.403244, 0.121555, -0.204015, 0.154666, 0.767399, -0.360454, 0.149979, 0.746147, 0.624634, 0.498632, -0.67053, -0.319579, -0.425366, 0.0993124, -0.678369, -0.52869, 0.782453, 0.375636, 0.776033, 0.232309, 0.954109, 0.832205, -0.709774, -0.530566, -0.309515, 0.689915, -0.91989, 0.178806, -0.768163, 0.133531, -0.29903, -0.717689, 0.884566, 0.77973, 0.716642, 0.675312, -0.423103, 0.808693, -0.6196, 0.388994, 0.614101, -0.846877, 0.435669, -0.165989, 0.83747, -0.455171, 0.248544, -0.35533, 0.61786, -0.104248, -0.254747, -0.678323, 0.787617, -0.364466, 0.230017, 0.0756662, 0.251215, 0.809537, 0.592087, 0.518108, 0.0946279, 0.94072, -0.126937, -0.560202, -0.118716, -0.483704, 0.342997, 0.300612, -0.396852, -0.78071, 0.84165, -0.497142, -0.167171, 0.520628, 0.717862, -0.054076, 0.541233, 0.164261, 0.595793, 0.367539, -0.375486, -0.959725, 0.0428803, -0.147378, -0.652633, -0.158793, 0.451494, 0.29024, 0.142699, -0.669646, -0.229139, -0.19397, -0.933254, -0.131474, -0.75522, 0.229177, 0.654219, 0.616316, -0.0464147, 0.157821, 0.664134, -0.444396, 0.915175, 0.769674, 0.423411, 0.613819, -0.871144, 0.232445, 0.483886, -0.809795, 0.802015, -0.0311515, -0.693044, 0.71659, -0.121179, -0.865733, -0.319611, 0.0980824, 0.655284, 0.747361, 0.463064, -0.429291, -0.350314, -0.781446, -0.0361156, 0.679061, -0.969038, 0.569704, 0.945583, -0.360093, -0.0134806, -0.0525039, 0.994573, -0.080586, 0.238701, 0.589215, -0.506931, -0.227682, 0.33615, -0.228616, -0.913106, 0.576686, -0.692188, -0.762937, 0.586687, -0.823419, 0.705175, -0.865707, 0.433754, 0.928872, -0.32902, 0.977384, -0.629888, -0.944077, 0.740561, 0.424064, -0.785475, 0.873774, -0.739626, -0.869736, 0.573857, 0.598341, 0.887134, -0.169134, 0.249644, 0.867528, 0.936426, 0.312018, 0.1045, -0.213207, -0.713081, -0.271907, -0.485872, -0.0680979, -0.202019, 0.525435, 0.743146, -0.731415, -0.310034, -0.106767, -0.994095, 0.355281, -0.691009, -0.113397, -0.548645, -0.833634, 0.402761, -0.977228, 0.36118, -0.160453, -0.385989, -0.0772546, -0.983605, 0.685538, -0.737976, 0.680575, 0.585294, 0.470501, -0.72331, -0.357447, 0.917859, 0.749687, -0.850532, 0.460113, 0.413614, 0.0269735, -0.224431, -0.967808, 0.599052, 0.421607, -0.908829, 0.922686, -0.0691335, -0.625973, 0.3976, -0.499226, 0.951783, 0.0126882, 0.679201, -0.0628286, 0.797885, 0.195326, -0.220245, 0.0851052, 0.565661, 0.540498, -0.834607, -0.321402, 0.793116, -0.0922255, 0.669913, -0.470969, 0.189615, -0.321096, -0.337741, -0.334736, -0.590257, 0.837212, 0.619604, -0.997653, -0.0616029, -0.688596, 0.607155, 0.496592, 0.242195, -0.96507, -0.518879, -0.375651, -0.15819, -0.512074, 0.168186, 0.674366, 0.124501, 0.273398, 0.478816, -0.999805, 0.18875, 0.277876, -0.690917, -0.0833854, -0.58075, -0.445321, 0.314204, 0.0523256, -0.592041, 0.00444153, 0.162297, -0.502171, -0.0831337, 0.431408, 0.959956, -0.667617, 0.789752, 0.772464, 0.189164, 0.460855, -0.0998152, 0.0388489, 0.742135, -0.141703, 0.280938, 0.0824502, 0.6571, -0.986348, -0.973641, -0.357019, -0.490274, -0.806119, -0.979661, -0.118649, -0.383439, 0.103449, 0.680835, -0.153848, 0.690877, -0.462442, -0.268023, 0.587342, -0.510645, -0.545644, -0.248912, 0.186584, -0.664884, 0.523467, 0.871793, -0.728896, 0.398038, 0.839377, -0.0968598, 0.398879, 0.802797, 0.832263, 0.24033, -0.163852, -0.97744, 0.315821, 0.784814, -0.729767, -0.770058, 0.595214, 0.358403, 0.822497, 0.503814, -0.350025, -0.885456, -0.198717, 0.338114, 0.769114, -0.403825, 0.99728, 0.748141, 0.39411, 0.339555, 0.732352, -0.162256, 0.44523, -0.00913427, 0.577033, -0.814634, -0.213083, -0.787166, -0.201014, 0.817672, 0.732608, -0.32775, -0.234741, 0.121675, 0.677909, -0.552803, 0.364405, 0.726049, 0.530767, -0.2081, -0.345255, -0.0591445, -0.0348163, 0.0405481, -0.0144168, 0.569675, 0.762915, 0.0470825, 0.407584, 0.977492, -0.84211, -0.840755, 0.567982, 0.957985, 0.506967, -0.191901, -0.90367, 0.312308, -0.628378, -0.773753, 0.665712, 0.0411258, -0.150673, -0.661895, -0.901044, 0.543611, 0.0233744, 0.139794, 0.51946, -0.911325, 0.0275902, 0.447084, 0.566251, -0.20251, -0.758749, 0.702535, -0.725597, -0.218357, -0.0923641, 0.86143, -0.0857136, -0.0598133, 0.477509, 0.778729, 0.237497, 0.519066, -0.69833, 0.355214, 0.966007, -0.975172, 0.00227516, -0.746427, 0.901754, -0.263773, 0.59203, -0.904264, 0.712121, 0.0546586, 0.224101, 0.837182, -0.979983, -0.0127272, -0.967434, 0.0286962, -0.213859, -0.0753858, 0.00672996, 0.133855, -0.639717, 0.148541, 0.753687, 0.648983, -0.671101, -0.828015, 0.848284, 0.267312, -0.561202, -0.404615, 0.734879, -0.164403, -0.510771, 0.967785, 0.908574, 0.204629, 0.382594, 0.651527, -0.535008, -0.559327, -0.924871, 0.191299, -0.0167888, 0.86402, 0.851766, 0.714024, -0.131277, 0.249064, 0.776055, 0.957535, -0.259534, -0.266056, 0.0190614, 0.57733, -0.466151, -0.717056, 0.389071, -0.764351, 0.0936228, -0.841365, 0.230938, -0.737428, 0.0627798, -0.565769, 0.568133, 0.360639, 0.930946, 0.117722, -0.576862, -0.881117, -0.849968, 0.279609, 0.285395, 0.811558, 0.815698, -0.784527, -0.753147, -0.538625, -0.227404, 0.724927, -0.827787, -0.735882, 0.546985, -0.023632, 0.0629912, -0.61452, 0.482743, -0.793676, -0.545321, -0.50181, 0.13548, -0.497384, 0.115388, 0.211669, 0.0215487, 0.789144, -0.659272, 0.0937102, 0.486103, 0.0919958, 0.11884, 0.887417, -0.511853, 0.248024, -0.541648, 0.90799, 0.5204, 0.125512, -0.409556, 0.432973, 0.641526, 0.588883, 0.907204, -0.0306672, -0.204532, 0.96047, 0.542785, -0.362897, 0.505934, -0.345252, 0.802837, 0.822409, 0.765024, 0.774849, 0.348692, 0.43012, -0.987474, -0.540894, 0.97662, -0.461127, -0.183048, -0.922047, -0.276502, -0.571091, -0.964235, -0.320275, -0.283713, -0.958533, 0.525904, -0.35024, -0.828086, -0.688485, -0.107146, -0.683831, 0.576559, 0.0104374, -0.673549, 0.353742, -0.760232, 0.251366, 0.921389, -0.935725, -0.751318, -0.984191, 0.595528, 0.114825, -0.211575, 0.938, -0.372906, -0.239837, -0.297246, -0.151903, -0.875775, 0.907338, -0.892798, -0.702662, 0.500037, -0.708698, 0.438252, -0.807172, 0.626247, -0.146428, 0.102162, 0.540601, 0.497396, 0.360375, 0.351457, -0.488866, -0.616982, 0.0813904, -0.108821, -0.856627, 0.280499, 0.957385, -0.975173, 0.57143, 0.172729, -0.449244, 0.62316, 0.831902, -0.0856967, 0.0117524, 0.0457547, -0.943587, -0.626961, -0.835623, -0.209786, -0.618926, 0.434722, -0.618768, 0.00474733, -0.227266, -0.653026, 0.367569, 0.872091, -0.731454, -0.633096, 0.909494, 0.17796, -0.410241, 0.00127239, 0.801732, 0.856622, -0.0514431, 0.437089, -0.12911, 0.759658, 0.252233, -0.303127, -0.715004, 0.417755, 0.683219, 0.535854, 0.757351, 0.242909, -0.623126, 0.358405, 0.926425, -0.918017, -0.817229, -0.719908, -0.0733399, 0.856683, -0.334325, -0.373361, 0.141345, -0.980013, -0.221297, -0.0789528, -0.213232, 0.418512, 0.885177, -0.663768, 0.831438, 0.317052, 0.400399, -0.00510633, 0.901512, -0.613279, 0.212358, -0.723689, 0.107079, -0.297111, 0.868238, 0.993846, -0.864814, 0.514908, -0.0550808, 0.808803, 0.736457, 0.326097, -0.623339, 0.0227321, -0.134391, -0.6174, -0.657694, 0.137165, -0.666253, 0.238172, -0.0547293, 0.321881, -0.0669982, -0.258536, 0.350801, 0.522482, -0.465081, 0.360293, 0.384489, 0.335955, 0.83865, 0.288897, -0.849925, -0.260577, -0.806198, -0.489202, -0.0230971, 0.790947, 0.86832, 0.126086, -0.524902, -0.402979, -0.490849, 0.595466, 0.275523, 0.182466, -0.706733, 0.220337, -0.874785, -0.627006, 0.496752, 0.766666, 0.940328, 0.671246, 0.866048, -0.50443, 0.993338, 0.00241315, -0.0861668, -0.749355, -0.427642, -0.477408, -0.489365, -0.403584, -0.557937, -0.273001, -0.533139, 0.456404, -0.65523, 0.622523, 0.527247, 0.189834, 0.359139, 0.127226, -0.647853, 0.338354, -0.162947, -0.510898, -0.876163, 0.312964, -0.761165, -0.461998, -0.542498, 0.58072, 0.393591, 0.615947, 0.528415, 0.967902, -0.550328, -0.475799, -0.0842664, 0.715736, -0.353027, 0.617525, -0.0910071, -0.708689, 0.904573, -0.591141, -0.634185, 0.88734, 0.456026, 0.668631, 0.777174, 0.863667, 0.29498, 0.447999, -0.059736, 0.774117, -0.867165, 0.88733, 0.321662, -0.70941, -0.0598275, -0.514039, 0.520106, 0.125608, -0.336968, -0.505954, 0.7882, 0.696687, -0.721469, -0.395059, 0.634855, 0.0667545, -0.129384, -0.790462, -0.926103, -0.823775, -0.434865, -0.467656, 0.333183, -0.18523, 0.0720885, 0.565194, 0.246777, 0.225955, 0.417806, -0.0167688, 0.0298819, 0.524594, 0.53736, -0.378292, 0.77147, -0.714192, 0.259274, 0.436774, -0.0555439, -0.222592, 0.341454, -0.049689, 0.0142362, 0.0222509, -0.945188, 0.983876, -0.105627, 0.0038296, -0.831248, -0.919166, 0.969943, -0.153644, 0.705704, 0.172206, 0.900091, 0.594834, 0.871859, -0.76233, 0.527863, -0.484409, -0.594455, -0.542012, -0.828936, 0.0118866, -0.948779, 0.678686, -0.0973947, 0.260981, 0.200465, -0.18853, -0.674567, 0.740454, 0.893248, -0.186201, -0.537428, -0.609605, 0.362655, 0.680534, -0.848723, 0.124396, -0.386176, 0.150519, -0.557225, -0.098136, 0.861995, 0.171569, -0.445342, -0.102927, -0.765134, -0.0503362, 0.556289, 0.158144, 0.928567, 0.558913, 0.600069, -0.711919, 0.751921, 0.457177, -0.663156, -0.822162, 0.0761766, -0.256033, 0.731312, 0.109418, 0.119535, 0.14473, 0.363634, -0.141685, 0.584977, 0.647, 0.725768, -0.498197, -0.77928, -0.202042, 0.574445, 0.0557576, -0.0820216, 0.54114, 0.0794147, 0.644591, -0.575344, -0.749838, -0.303596, 0.119094, -0.145468, -0.185319, -0.370984, 0.712319, -0.877189, -0.53522, 0.406469, 0.796596, 0.674449, -0.302225, 0.582799, 0.624502, 0.684103, 0.890213, 0.53469, 0.355346, -0.252541, -0.914741, 0.527925, -0.077592, -0.302522, 0.168972, -0.254363, -0.00653445, -0.648278, -0.324082, 0.275324, -0.246558, -0.719156, -0.704559, -0.259742, -0.731729, -0.675715, -0.593198, -0.8198, 0.600572, 0.668545, 0.923004, -0.404655, 0.695671, -0.251262, -0.520166, 0.214439, 0.976834, -0.976481, -0.630711, -0.191587, 0.932275, -0.501673, 0.774976, 0.706885, 0.177086, -0.089232, -0.497478, -0.951139, 0.392158, -0.765398, 0.711731, -0.966137, -0.0671698, -0.118557, -0.677938, 0.807781, -0.259506, -0.934123, -0.974024, -0.47357, 0.263261, -0.866684, -0.157596, -0.712618, 0.609555, 0.922588, -0.464194, -0.364367, 0.128527, -0.610954, 0.848599, -0.174806, 0.972617, -0.289961, -0.477197, 0.422058, -0.817985, -0.587339, -0.830304, -0.681229, 0.373252, -0.769232, 0.752325, 0.683432, 0.670143, 0.243502, -0.883594, -0.991651, -0.461058, 0.37708, 0.737528, 0.128114, -0.930103, 0.713266, 0.527787, -0.750042, 0.681482, -0.278831, 0.0704478, 0.647158, 0.787809, -0.0662621, -0.674138, 0.119278, 0.559699, -0.883423, 0.356273, -0.86242, -0.583671, -0.697202, 0.140585, 0.797609, -0.77541, 0.624807, 0.98528, -0.952808, 0.379153, 0.892829, -0.277523, -0.533934, 0.0190703, 0.928743, 0.762101, 0.29231, -0.391054, 0.566816, 0.610182, -0.646987, -0.348942, -0.120534, 0.375352, -0.918706, -0.336488, -0.514403, -0.809714, 0.0513076, 0.980389, 0.86844, -0.763931, -0.948021, 0.624934, 0.660744, -0.633322, -0.367328, 0.27508, 0.440093, -0.601263, 0.336865, 0.387514, -0.599268, -0.479802, 0.800845, 0.064908, -0.200368, -0.705408, 0.254248, -0.92692, 0.687846, 0.517638, 0.39152, -0.327054, -0.624812, 0.200529, 0.0240245, -0.327452, -0.43707, 0.358041, 0.237228, 0.475355, -0.604246, -0.523635, 0.00222669, 0.588042, 0.357935, -0.0531097, 0.714938, -0.375335, 0.976054, -0.493681, -0.540157, 0.68304, 0.0107773, 0.211112, -0.615863, -0.98955, -0.0312458, -0.0436662, 0.776089, -0.892432, 0.863263, 0.127959, -0.719312, -0.053278, 0.0908644, -0.604012, -0.339586, -0.0168018, 0.100361, 0.57246, -0.23964, 0.602271, -0.975999, 0.0552196, -0.112309, 0.692488, 0.881485, -0.372581, 0.794373, -0.0131681, 0.736676, -0.438508, 0.140952, -0.201248, 0.992502, 0.749056, -0.866971, -0.171255, -0.450769, -0.0829315, -0.481086, 0.639661, -0.152699, -0.653626, 0.35208, 0.95546, -0.717508, -0.0180438, -0.641405, 0.0938622, -0.588646, 0.84312, 0.777787, 0.858584, 0.454661, -0.0743869, 0.381202, -0.294392, 0.391054, 0.291957, -0.365923, 0.340648, -0.458509, 0.198099, -0.07665, -0.933829, -0.0897203, -0.10678, -0.246823, -0.70372, -0.788354, -0.411256, -0.61137, 0.428581, 0.253807, -0.437511, 0.916772, -0.531291, -0.803687, -0.549415, -0.742805, -0.681185, -0.800699, 0.853931, 0.163391, 0.499905, 0.330746, -0.696692, 0.47871, 0.727486, -0.570336, -0.860344, 0.217606, -0.083271, -0.912763, -0.932875, 0.148315, 0.289426, 0.413726, 0.987191, -0.817915, 0.409037, 0.120557, 0.593873, 0.117344, -0.528784, -0.591767, -0.660419, 0.742636, 0.507552, 0.505993, 0.279584, -0.511868, 0.939225, -0.604838, -0.0718558, -0.969732, 0.424694, -0.450106, -0.405064, -0.545306, -0.333586, -0.875324, -0.985557, 0.740297, 0.460422, -0.195499, -0.85796, 0.725056, 0.341131, 0.450213, 0.646942, -0.674353, 0.476071, 0.0444256, -0.883724, 0.769582, -0.939419, -0.297046, -0.203472, 0.341327, -0.727711, -0.738204, -0.325186, -0.162672, -0.572961, -0.882251, 0.713222, -0.662106, 0.315, -0.343773, -0.63348, 0.262238, -0.743913, 0.00748874, -0.883837, -0.0571233, 0.363367, 0.31807, 0.785247, 0.636368, 0.681452, -0.894364, -0.651981, 0.0898239, -0.105972, -0.621754, -0.11103, -0.32127, 0.282808, 0.0346749, 0.155927, 0.221881, 0.0599958, 0.219609, 0.724193, 0.91552, -0.940432, 0.932967, 0.907502, 0.583661, 0.919972, -0.788046, 0.576027, 0.462834, -0.197389, 0.543647, -0.246439, -0.111762, 0.780255, -0.246111, -0.917515, 0.876478, -0.67077, -0.844097, 0.702356, 0.276655, 0.917613, -0.233157, 0.213027, 0.980183, 0.797306, 0.105207, 0.661851, 0.884326, -0.550434, -0.888404, -0.788609, -0.69998, -0.178544, 0.722645, -0.0308185, 0.777162, -0.293331, -0.0919485, -0.517988, -0.983498, -0.0657168, 0.101223, -0.40972, -0.215405, -0.497517, -0.160177, -0.147837, -0.796096, -0.993675, 0.52136, -0.450569, -0.932971, -0.327308, 0.245309, -0.108142, -0.750033, 0.831922, 0.853376, 0.966418, 0.745622, -0.110077, 0.26386, 0.208766, 0.768453, -0.450142, 0.89159, 0.4136, 0.5876, 0.957265, 0.422778, 0.00387566, -0.942313, -0.0111424, 0.499351, 0.997025, -0.968108, -0.196447, 0.477881, 0.467215, -0.0726304, 0.450899, -0.878449, -0.205318, 0.981263, -0.572058, 0.719889, -0.561416, 0.266319, 0.295373, 0.165452, 0.638859, -0.405461, -0.85354, 0.615076, -0.710239, 0.957596, 0.429476, 0.981352, 0.7461, 0.332114, -0.450196, -0.258483, -0.472153, 0.960841, 0.936308, -0.140883, 0.279543, 0.303248, 0.848565, -0.444482, 0.982729, -0.868853, 0.639342, 0.915393, -0.285886, 0.986409, 0.681544, -0.66457, 0.236353, 0.710665, 0.214481, -0.85802, -0.866142, -0.601289, -0.575818, -0.610202, -0.839435, -0.38933, 0.634986, -0.520311, -0.687552, -0.451032, 0.949836, 0.86774, -0.863395, 0.233434, 0.373945, -0.808775, 0.468498, 0.12765, -0.313252, -0.357754, -0.164102, -0.060215, -0.538872, -0.15327, -0.129131, -0.173245, -0.474468, -0.877361, -0.874782, -0.434115, -0.167145, 0.0871516, 0.189538, 0.58001, 0.374972, -0.793209, 0.890963, 0.290448, -0.717728, 0.0712101, -0.965536, -0.764841, 0.845624, 0.477956, 0.931595, -0.776858, -0.108089, 0.970755, 0.0261681, 0.276984, -0.437637, -0.0965021, -0.388012, -0.571054, -0.532644, 0.514436, 0.801754, 0.72887, 0.841273, 0.890615, -0.355144, -0.18978, 0.292093, 0.042897, -0.838238, 0.829121, -0.328762, 0.691722, -0.44852, 0.765442, -0.473965, 0.524788, -0.565803, 0.820984, -0.481863, -0.376101, 0.968137, -0.34743, -0.204563, 0.430643, 0.120083, -0.723807, 0.727008, -0.386333, -0.662756, 0.73829, 0.378509, -0.360545, -0.456618, -0.657616, 0.742058, 0.297493, 0.987977, -0.412167, -0.809681, -0.572087, 0.050695, -0.517816, -0.269647, -0.245418, -0.131486, 0.471907, 0.362106, -0.238357, -0.531258, -0.914987, 0.649397, -0.621912, -0.508938, -0.841828, -0.883043, 0.991357, 0.116519, 0.672748, -0.722798, 0.772273, 0.758671, 0.191892, -0.878692, 0.760486, -0.136162, 0.493984, -0.246382, -0.830269, -0.990794, 0.662713, 0.513928, 0.934957, 0.375006, -0.0935892, 0.204557, 0.0795242, 0.650951, 0.538842, 0.0790628, 0.313184, -0.645946, 0.511536, -0.950675, 0.474445, 0.74842, 0.328122, 0.485608, 0.62758, 0.516657, -0.138713, 0.0681099, -0.630822, -0.269606, 0.654244, -0.613216, -0.488602, -0.0600439, -0.468896, -0.495205, -0.988686, -0.68834, 0.445828, 0.489714, 0.103467, 0.978222, 0.345157, 0.0251733, -0.955948, 0.243512, 0.786834, 0.314798, 0.796495, 0.419893, -0.7455, -0.42516, -0.90082, 0.330615, 0.458422, -0.605924, 0.369936, -0.802884, -0.445915, -0.948403, -0.126613, 0.590036, 0.576159, 0.524142, -0.583977, 0.206837, -0.693366, 0.159502, -0.158358, 0.615763, 0.404559, -0.0669362, 0.176478, 0.872457, -0.731844, -0.409516, -0.61297, -0.8435, -0.506878, -0.489734, 0.341695, -0.656189, 0.500785, 0.331614, -0.537711, 0.0484464, 0.389785, 0.492671, 0.138885, 0.804624, 0.371295, -0.262619, 0.136026, 0.489505, 0.370739, 0.943874, -0.502434, -0.0900716, 0.662501, -0.720573, 0.524352, -0.541284, 0.425502, 0.705862, -0.994208, -0.622278, 0.126561, -0.228255, -0.0446652, 0.559842, 0.862127, 0.457879, 0.141603, -0.918553, 0.842605, 0.197968, 0.398933, 0.194228, 0.855184, 0.624871, 0.17641, 0.0497855, -0.951785, -0.184705, -0.671142, 0.193787, 0.978557, -0.447797, 0.876905, 0.116678, -0.0623999, -0.148079, -0.93983, 0.826077, 0.0458538, 0.386471, 0.0539913, -0.436655, -0.445304, -0.311292, -0.48988, 0.760209, 0.919566, -0.28213, -0.593509, -0.311278, -0.291341, 0.657965, -0.185066, 0.388229, 0.212686, -0.0704257, -0.389404, -0.879248, 0.110944, 0.0381306, -0.0904959, -0.00559342, 0.493324, 0.814498, -0.899749, 0.602236, -0.7423, 0.409587, -0.967154, 0.604604, -0.710028, -0.549689, 0.896433, 0.967207, -0.33802, -0.186579, 0.378136, -0.28645, -0.660089, 0.959587, -0.469121, -0.511157, 0.765236, 0.472728, 0.96633, -0.0573877, -0.11071, -0.294984, -0.745393, 0.538043, -0.343034, 0.423167, -0.976131, 0.167564, -0.847864, -0.386675, 0.996864, -0.963327, 0.927237, -0.881839, 0.485514, -0.251119, -0.916044, -0.974451, 0.366484, -0.272931, -0.766795, -0.286741, 0.115638, 0.700417, 0.461486, 0.572551, 0.786766, -0.329786, 0.0827296, -0.286229, -0.587908, -0.227216, -0.411936, 0.688953, -0.475505, 0.303116, 0.903856, -0.448512, -0.18488, -0.377572, -0.899496, -0.117515, 0.385524, 0.15248, -0.561301, -0.500848, 0.209613, 0.127805, -0.365395, 0.355284, 0.368839, -0.884844, -0.28374, -0.551809, 0.981387, 0.361046, -0.315241, 0.626413, -0.52614, 0.949641, 0.536077, 0.557075, 0.624231, -0.854734, -0.774162, 0.269059, -0.260017, 0.62244, -0.425104, 0.272833, 0.424491, 0.893313, -0.961705, -0.41057, -0.931342, -0.27388, 0.124339, 0.428057, 0.588228, -0.845597, -0.27826, -0.955644, -0.5707, -0.845509, -0.974281, 0.475351, -0.8239, 0.768571, 0.72383, 0.186037, 0.152587, -0.302084, -0.0758003, 0.841973, 0.371533, 0.606033, -0.517175, 0.20242, 0.980453, 0.516628, -0.725152, -0.795975, 0.934108, 0.917742, 0.835509, 0.341307, -0.73901, 0.10341, 0.320128, -0.255651, 0.624429, 0.342359, -0.189423, -0.864704, -0.977176, 0.707546, 0.133388, -0.140426, 0.103631, 0.358761, 0.0545849, 0.0103577, 0.344087, 0.143885, 0.906467, 0.879002, 0.0782623, -0.42536, 0.717137, -0.671038, 0.599317, -0.419945, 0.964885, 0.0866061, -0.954932, 0.742875, -0.126018, 0.459241, -0.710879, 0.587609, 0.896281, -0.236194, 0.12861, 0.696604, 0.508962, -0.495458, 0.201761, 0.719729, 0.776127, -0.526575, -0.957446, -0.0980924, -0.313847, 0.361012, 0.451001, 0.279008, -0.781997, 0.678749, 0.931578, -0.516305, -0.348351, -0.592801, 0.8686, -0.417957, 0.603875, 0.0576448, 0.575633, 0.502838, -0.649085, 0.2341, -0.55058, 0.0209662, -0.105799, -0.0600723, 0.91724, 0.323873, -0.631034, 0.297404, 0.709899, -0.552759, 0.296305, 0.962113, 0.7964, 0.239817, 0.270425, 0.993154, 0.492659, 0.141184, 0.637035, -0.663967, -0.592477, -0.655284, 0.828619, -0.600938, 0.943727, -0.600224, -0.0444443, -0.756674, 0.492149, -0.876634, -0.175858, 0.983744, -0.263093, 0.82165, -0.76587, 0.621779, -0.274652, 0.405502, 0.728637, 0.867422, 0.115899, 0.224293, 0.862112, -0.545205, 0.475649, -0.635786, -0.238543, -0.745078, -0.373604, -0.610239, 0.0811026, -0.386881, -0.656282, -0.22418, -0.867745, 0.435629, -0.49441, -0.262066, -0.112659, -0.921796, 0.065521, -0.742053, 0.744195, 0.737974, 0.267036, 0.0551398, 0.913941, 0.909932, 0.489157, -0.0790365, -0.727867, 0.581412, 0.0640083, 0.158791, 0.744774, -0.713469, 0.573441, -0.800976, -0.616545, 0.935403, -0.810271, -0.603111, 0.246519, -0.0713043, 0.468885, -0.0157108, 0.112576, -0.644822, -0.805216, 0.217115, 0.785413, -0.796768, -0.209527, -0.526443, -0.645416, -0.340874, -0.54241, 0.319304, 0.110001, 0.0326447, 0.310791, -0.661938, -0.147611, -0.589057, 0.425189, 0.812055, -0.67933, 0.40584, 0.58708, 0.159226, 0.0752009, 0.776625, -0.245171, 0.771448, 0.15914, 0.401118, -0.688254, 0.532342, -0.134552, 0.551727, 0.639456, 0.673533, -0.111344, -0.222213, 0.228302, 0.990421, 0.377448, -0.641885, -0.608407, -0.658869, -0.594497, 0.981831, 0.199066, 0.815947, -0.645408, -0.901808, 0.995264, 0.901481, -0.0990516, -0.117528, -0.430485, 0.699726, 0.498596, -0.892217, 0.786404, 0.224237, -0.972798, -0.497311, -0.596629, 0.715685, 0.197321, 0.917828, -0.86019, 0.570998, -0.22024, -0.140146, 0.131339, -0.635867, -0.537588, 0.882965, -0.242991, 0.237261, 0.216323, -0.0639019, -0.709725, 0.0395268, 0.191998, -0.289994, 0.866593, 0.541258, 0.470093, 0.943032, -0.173476, -0.370017, 0.82385, 0.644844, 0.88205, -0.502172, 0.121422, -0.423401, 0.0698645, -0.503354, 0.338208, -0.169516, -0.332095, -0.922738, -0.557398, -0.972298, 0.381439, -0.633197, -0.947423, -0.973401, -0.103359, -0.145843, 0.795987, 0.273368, -0.141247, 0.476628, 0.248378, -0.813436, 0.94347, 0.631413, 0.284061, -0.834983, -0.553434, -0.688076, 0.512684, -0.529109, 0.114163, 0.435152, 0.302668, 0.617394, 0.622488, 0.0502816, 0.788032, 0.298793, 0.953138, 0.514358, -0.966208, -0.3826, 0.651006},
-	{0.800058, 0.135044, -0.613298, 0.0711081, -0.332759, 0.12521, -0.539003, -0.132537, 0.301669, -0.79243, -0.497116, -0.759219, -0.749282, 0.99266, -0.615152, -0.694531, -0.205859, 0.551916, -0.582047, 0.0829444, -0.214779, -0.422251, -0.45857, -0.327996, 0.350509, -0.751589, 0.797774, -0.23726, 0.353821, -0.232492, 0.738069, 0.735685, -0.702769, -0.0632974, -0.112399, -0.792982, 0.102363, -0.441804, 0.624504, -0.983086, 0.798293, -0.413207, 0.953541, -0.66702, -0.288811, 0.692023, -0.324697, 0.870599, -0.903758, -0.621981, 0.994025, -0.71205, -0.690009, -0.949656, -0.720311, 0.422866, 0.623236, -0.909432, -0.969787, 0.290625, -0.840921, 0.899654, -0.386282, -0.34941, 0.712912, 0.191783, 0.590787, 0.805458, 0.0566181, -0.10056, -0.711383, 0.78731, -0.128156, -0.348546, -0.503283, 0.522545, -0.744675, -0.350695, -0.570708, 0.166618, 0.635746, -0.912742, -0.184113, -0.307249, 0.860686, 0.83217, 0.227861, 0.869345, -0.379343, 0.78934, 0.643491, -0.829386, -0.32872, 0.965337, 0.840851, 0.899961, -0.9256, -0.166262, -0.659988, -0.812973, -0.382962, 0.00940755, -0.417376, 0.56551, 0.546635, 0.358426, -0.27695, 0.0697249, 0.566404, -0.549578, 0.482636, -0.5891, -0.971992, 0.089104, -0.583815, -0.221449, 0.875223, -0.434571, 0.708538, 0.328331, 0.342769, -0.663315, -0.338816, 0.198704, 0.518872, 0.221138, 0.16036, -0.367517, -0.931111, 0.352524, -0.775299, -0.708704, -0.461306, 0.703172, 0.556079, -0.389536, 0.333998, 0.936825, -0.990167, 0.819377, -0.784661, -0.339587, -0.671817, -0.995147, -0.619017, 0.543221, 0.311706, -0.439495, 0.554841, -0.274535, -0.251164, -0.403948, 0.774751, -0.617516, 0.238128, -0.76134, 0.0250569, 0.516879, -0.0202688, 0.14866, -0.331109, 0.911351, 0.327881, -0.379134, 0.165634, 0.416443, 0.581513, 0.0266987, -0.482523, 0.290004, -0.325071, -0.553144, -0.869027, -0.582768, -0.79419, -0.0865065, -0.180675, -0.655759, -0.321181, 0.137136, -0.622428, 0.357455, 0.435993, 0.503633, 0.736792, -0.883218, 0.0652189, 0.443164, 0.000661743, 0.624383, 0.627568, 0.508201, -0.826913, -0.0129921, -0.325972, 0.073152, 0.934539, 0.530646, 0.869618, -0.443596, -0.987225, 0.12104, -0.723642, -0.595818, -0.106608, 0.676077, -0.0305459, 0.561975, -0.574092, 0.670935, -0.169706, -0.320185, 0.67521, -0.958642, 0.297316, -0.184414, -0.267608, -0.524847, -0.642027, -0.152105, -0.46712, -0.397486, -0.868, 0.14901, 0.215523, -0.962539, 0.711114, 0.319665, -0.453277, 0.486047, -0.679357, -0.447402, -0.162924, -0.619529, 0.309991, 0.409842, -0.829706, 0.336772, -0.176921, 0.923584, -0.532141, -0.0653615, 0.411497, -0.182897, -0.0240345, 0.449653, -0.230598, -0.224152, 0.0673631, 0.327041, -0.210081, -0.892038, 0.854514, 0.617467, -0.278743, -0.404035, -4.35071e-06, 0.279358, -0.234912, -0.332664, -0.207637, -0.47956, -0.14134, 0.169529, 0.381355, 0.0116849, -0.638176, -0.218175, 0.413818, 0.886336, 0.814668, -0.952322, -0.702009, -0.40181, -0.520711, 0.261798, -0.707505, 0.849617, -0.260592, 0.948129, -0.431325, -0.52048, -0.333043, 0.881467, -0.412362, -0.772903, 0.458693, -0.487175, 0.857265, -0.821724, -0.520361, -0.296097, 0.0873734, -0.597409, 0.0901212, -0.198428, -0.369099, -0.153363, 0.0180194, 0.94888, -0.721228, 0.310365, 0.908748, -0.434532, 0.945767, 0.296859, -0.00380064, -0.269706, 0.673812, 0.618002, 0.0309577, -0.581366, 0.517226, -0.531786, 0.599248, 0.754192, 0.029661, 0.153603, -0.158107, -0.148037, 0.332884, 0.886355, 0.230761, -0.37751, -0.171847, -0.729311, 0.658401, 0.498991, -0.53551, 0.381019, -0.280398, 0.0766406, -0.344587, 0.256786, -0.633135, -0.0534293, -0.276634, -0.643836, -0.286391, -0.707445, 0.624562, -0.447978, 0.00201238, -0.729638, 0.237334, 0.753119, 0.0889407, 0.870687, 0.43011, -0.73779, -0.951198, -0.632629, -0.00761377, -0.343327, 0.858239, 0.389964, -0.312498, 0.180864, -0.287175, -0.590062, 0.986704, 0.745187, 0.304566, 0.577566, -0.61265, 0.375227, 0.954428, 0.931928, 0.647031, -0.888903, -0.813363, -0.166048, -0.352695, 0.196721, 0.572548, -0.189342, -0.164545, 0.315111, 0.101067, 0.759013, -0.652757, 0.210944, 0.700374, 0.975288, 0.380995, -0.374873, 0.103539, -0.0649465, -0.467515, 0.269834, -0.0211965, -0.235085, -0.982233, 0.556817, 0.480609, -0.32354, -0.593907, -0.377122, 0.450032, 0.545141, 0.518175, -0.52587, -0.539583, 0.726253, -0.610403, -0.239693, -0.632606, -0.795353, 0.640886, -0.0457228, -0.0713575, -0.218457, 0.918893, 0.871502, 0.290612, 0.765479, -0.999752, -0.946916, -0.483853, -0.539379, -0.462789, 0.88043, 0.37122, -0.753176, 0.270322, 0.880963, -0.711466, -0.67477, 0.510468, -0.379617, 0.294219, 0.885264, -0.139312, 0.492515, -0.167449, -0.258307, -0.758295, -0.112403, 0.860972, -0.20827, 0.763799, 0.495194, 0.600618, -0.608185, -0.0734572, 0.353821, -0.766881, 0.594435, -0.0437248, -0.00168939, 0.709271, 0.0153153, 0.814446, -0.558248, 0.644699, -0.523656, 0.0072553, -0.659251, -0.510651, -0.382561, 0.924207, 0.484991, -0.649318, 0.585124, -0.197004, -0.347578, -0.688357, -0.354708, 0.107897, -0.411096, -0.347964, 0.447093, 0.0159347, -0.489535, 0.861177, -0.821114, 0.690354, -0.515976, 0.446937, -0.222095, 0.981137, 0.96892, 0.806312, 0.445372, -0.800816, -0.123168, -0.50173, 0.082146, 0.94942, 0.6329, 0.426742, 0.315526, -0.421363, 0.816297, 0.140684, 0.895523, 0.267967, 0.248424, -0.629278, -0.872539, -0.96455, -0.928866, 0.896975, -0.747067, 0.559872, -0.221306, -0.405951, 0.685966, -0.434766, -0.161241, 0.293807, 0.590657, -0.0217733, 0.44049, -0.8507, -0.665923, 0.14728, -0.543971, 0.154018, 0.406028, -0.934391, -0.443367, 0.0377169, -0.0701727, 0.810271, -0.10976, 0.378922, -0.606663, 0.584534, -0.0905731, -0.157554, 0.0984696, -0.630206, 0.259061, -0.429103, 0.848619, -0.00847317, 0.887493, 0.153504, 0.0599246, 0.850489, 0.733827, 0.645615, 0.732965, 0.404007, -0.391243, -0.910299, -0.0994497, -0.0506077, -0.429347, 0.42301, 0.44171, 0.0699044, -0.333099, -0.999745, 0.61796, 0.113615, 0.176389, 0.569433, -0.756831, 0.414098, -0.819758, 0.603164, -0.946886, 0.754277, -0.0331782, 0.84333, 0.929862, 0.160403, 0.630125, 0.404309, 0.155092, 0.797391, -0.956573, 0.345714, -0.604257, -0.158502, 0.984597, -0.759918, 0.973557, 0.136834, 0.299081, 0.661279, 0.538191, -0.994289, -0.789952, -0.388567, 0.884506, 0.171878, 0.733498, 0.267005, 0.264772, -0.886995, -0.803315, 0.960964, -0.287457, 0.902267, 0.536084, -0.424528, 0.694008, -0.602678, 0.482476, 0.455268, -0.133942, -0.50867, 0.515285, -0.30437, -0.0272156, 0.992442, -0.602313, -0.982368, -0.72583, 0.166608, 0.291717, -0.495808, 0.531437, 0.478735, -0.272886, 0.197518, -0.118045, 0.947153, -0.588269, -0.795581, 0.785634, -0.508296, 0.477599, 0.247619, -0.050716, 0.617762, 0.140723, 0.768312, -0.708869, 0.588354, 0.569561, 0.828116, -0.0970982, 0.512153, -0.114777, -0.0969503, 0.234162, -0.678512, -0.632975, 0.369492, -0.660724, -0.410529, 0.392107, -0.171313, 0.675658, 0.556458, 0.477125, 0.876583, -0.200732, 0.707118, 0.889054, 0.463134, 0.365086, 0.587615, 0.930546, -0.158841, 0.0308075, 0.599877, 0.400772, -0.309195, -0.748287, 0.358517, -0.680638, -0.871784, 0.826071, -0.124146, 0.166805, -0.393208, -0.0337286, 0.521544, -0.93608, -0.525104, -0.815366, 0.124099, -0.565303, -0.62527, -0.516651, 0.108866, -0.564216, -0.581259, 0.703891, 0.289754, -0.445434, -0.812337, 0.707605, -0.764785, -0.0542211, -0.266755, -0.852207, -0.730935, -0.551454, -0.678793, 0.489905, 0.471845, 0.473148, 0.877159, -0.0376884, -0.718034, 0.128565, 0.964659, -0.333604, -0.746808, 0.359742, 0.635301, -0.866329, -0.086829, 0.24226, 0.725189, 0.869922, -0.488256, -0.332115, 0.372098, 0.334266, 0.77124, 0.0267013, -0.595461, 0.494034, 0.0725721, -0.889629, -0.672144, -0.871754, -0.812488, 0.721257, -0.310087, -0.480989, -0.885396, 0.258381, -0.476169, -0.733981, -0.289685, 0.8581, 0.0624756, -0.270692, -0.139748, 0.19034, 0.518177, -0.257346, -0.0514021, 0.261458, -0.363786, -0.860097, 0.969045, 0.0572641, 0.377754, -0.0290928, 0.00560494, -0.99341, 0.455001, 0.400168, 0.202723, 0.18189, -0.0538001, 0.40573, 0.411166, 0.14554, 0.551072, -0.696389, -0.399997, 0.750353, 0.247339, 0.694716, -0.0784034, 0.791745, 0.851512, -0.741451, 0.892259, -0.637507, 0.667265, 0.442467, -0.770429, -0.287432, -0.140896, -0.144595, -0.603455, 0.539545, -0.611714, 0.0856463, -0.210087, -0.480644, 0.117966, -0.962048, 0.399811, -0.403756, 0.251716, -0.299094, 0.69778, -0.466362, -0.0443779, -0.847399, -0.806855, 0.850219, 0.461307, 0.534505, 0.0724433, -0.593744, -0.0481664, -0.968684, 0.785092, -0.391441, 0.643826, 0.739703, 0.914325, 0.14727, 0.550179, -0.291025, -0.475506, -0.960574, -0.535768, 0.551374, -0.24067, -0.489671, -0.849695, 0.400627, 0.137783, -0.759852, -0.888802, 0.635329, -0.470767, 0.856392, -0.308003, -0.709323, 0.783704, 0.218455, -0.730569, -0.551846, -0.802495, 0.321915, -0.893942, 0.409455, 0.0542157, 0.16539, 0.406886, 0.167816, -0.864122, -0.719056, 0.941031, 0.192664, 0.625162, -0.24611, -0.301563, -0.535674, -0.579732, 0.14027, 0.623792, -0.186831, -0.580384, -0.919867, -0.764322, 0.923928, -0.188272, -0.74435, 0.63448, -0.83507, -0.49938, 0.951728, 0.0600622, -0.000928675, 0.244949, 0.100838, -0.818922, -0.68055, 0.987544, -0.730466, -0.716054, 0.984885, -0.840264, 0.789222, -0.951802, 0.0393572, 0.549312, -0.341859, -0.726738, 0.440223, -0.110235, 0.740466, -0.797139, 0.377416, -0.667598, -0.34764, -0.200734, 0.899917, 0.59419, -0.763003, -0.987485, 0.0828954, 0.656553, -0.235983, 0.46269, 0.159338, -0.480292, -0.477008, 0.0597732, 0.93575, 0.26338, -0.923835, 0.228204, 0.0534344, -0.803032, -0.00272917, 0.0457075, 0.349736, 0.291784, 0.944846, 0.231886, 0.166767, -0.810777, 0.383827, -0.524852, 0.891686, 0.523189, 0.827144, -0.0838102, -0.216465, 0.648847, -0.263058, -0.979623, 0.859597, -0.158612, 0.660232, -0.442742, -0.201012, 0.549319, 0.855493, -0.733861, 0.0742094, 0.257907, 0.579206, 0.548898, 0.167464, -0.257454, -0.191827, -0.0557624, 0.903508, -0.0431928, 0.0995345, 0.237422, 0.174053, 0.335397, -0.526542, -0.944136, 0.729112, 0.627631, 0.480422, -0.488272, 0.781262, -0.110265, -0.429833, 0.721096, 0.533297, 0.396376, 0.773005, -0.730187, 0.778893, 0.0285533, 0.661897, -0.618409, -0.461239, -0.821458, -0.784907, 0.748422, -0.768655, -0.681654, 0.340895, -0.543455, -0.713903, 0.601088, 0.576129, -0.715853, -0.0835894, -0.551915, 0.0418386, -0.797925, -0.231081, -0.679441, 0.777047, 0.574981, 0.446893, 0.029625, -0.358264, -0.509486, 0.161004, 0.169114, -0.149959, -0.308242, 0.907241, -0.903954, -0.261191, 0.487004, 0.409826, -0.261337, -0.550018, 0.682988, 0.0262115, -0.256419, 0.198942, 0.952962, -0.690007, -0.467817, -0.0441477, -0.329309, 0.972682, 0.258866, 0.892442, 0.81546, -0.680752, 0.112407, 0.282454, -0.271488, -0.724148, 0.451474, -0.325978, -0.588939, 0.0598697, 0.840531, 0.629594, 0.394649, -0.950512, -0.136764, -0.23502, 0.0758663, -0.014424, -0.318453, -0.253906, -0.647642, -0.665181, 0.150414, 0.704316, 0.16394, -0.400579, -0.206895, -0.571453, 0.837178, -0.327459, -0.426377, -0.638824, -0.581587, 0.0755773, -0.255527, -0.987513, 0.0813174, 0.947798, 0.690451, 0.362499, 0.633516, -0.714818, 0.57468, -0.513657, -0.0835212, 0.516218, -0.59542, -0.575886, -0.238578, -0.0539691, 0.532198, 0.946546, 0.942304, 0.211986, 0.687643, -0.478424, -0.2651, 0.329516, -0.571785, -0.602423, -0.485292, 0.181435, 0.367174, 0.959966, 0.44351, 0.718062, 0.488281, -0.699751, 0.279446, 0.383137, -0.349479, -0.93792, 0.651287, 0.597212, -0.477063, 0.559074, 0.586329, 0.175061, -0.59226, -0.616909, 0.291534, -0.524265, 0.656752, -0.609522, 0.903852, -0.705083, 0.859991, 0.121287, -0.494307, 0.560307, -0.807795, -0.382496, 0.155327, -0.0906967, -0.590459, 0.0229428, 0.645031, -0.335367, -0.790494, -0.812749, 0.190798, -0.385664, 0.0703957, 0.986676, 0.130687, -0.804849, -0.180768, 0.089467, 0.212235, 0.80479, -0.0605164, -0.402795, 0.686333, -0.376603, -0.555512, 0.761475, 0.206698, -0.908135, 0.930841, 0.35184, -0.886854, 0.489991, 0.604133, -0.516474, -0.714946, 0.5152, -0.118185, -0.289366, 0.364388, -0.26534, -0.94826, 0.515122, 0.5573, -0.338922, -0.541933, -0.637745, -0.605913, -0.549944, 0.793311, -0.3383, 0.956738, -0.583475, 0.962119, 0.128043, 0.250516, 0.764427, -0.580852, 0.732923, -0.369868, 0.522966, 0.95685, -0.676836, 0.293687, 0.774663, 0.893565, -0.492009, -0.823824, 0.970891, 0.90182, -0.664765, -0.789078, -0.670141, -0.309823, -0.260976, -0.619235, 0.607973, 0.333928, 0.984403, -0.449222, -0.360993, 0.42522, -0.11272, 0.862864, 0.996417, -0.585325, -0.0392105, 0.560533, 0.0960823, -0.919854, 0.773126, 0.877546, 0.827967, 0.934646, -0.481172, -0.333294, 0.989242, 0.327615, -0.27117, -0.355842, -0.584124, 0.120981, -0.182017, -0.380431, 0.00279182, 0.67707, 0.300828, 0.603024, -0.0611878, -0.333688, 0.767001, -0.231385, -0.829935, 0.513693, -0.867328, 0.309886, -0.539501, 0.829296, 0.814055, -0.626632, -0.963111, 0.252016, 0.560297, -0.0398427, 0.237043, 0.86888, -0.164518, 0.242352, 0.589709, 0.0496841, -0.307197, -0.485819, -0.264993, 0.189339, -0.991434, 0.0966645, -0.790774, 0.903551, 0.749422, 0.815559, -0.692705, -0.586062, -0.775675, -0.28333, -0.532713, -0.9774, 0.471864, -0.479721, -0.447717, 0.44312, -0.11391, -0.658228, -0.856672, -0.748407, -0.586434, 0.953689, 0.64453, 0.326521, -0.649069, 0.676423, 0.461861, -0.0203635, -0.7186, -0.293655, -0.0632125, -0.602372, 0.178177, -0.09026, -0.234243, 0.267276, 0.924426, 0.320857, -0.0595217, -0.0857363, 0.00825606, -0.431664, 0.312444, -0.972497, 0.143971, 0.930312, -0.462066, 0.957836, -0.416532, 0.810577, -0.0935084, -0.461103, 0.674978, -0.649474, -0.92278, -0.847459, -0.880226, -0.273533, 0.934702, -0.468221, -0.633951, 0.795934, 0.178437, 0.306881, 0.671282, 0.523745, -0.811652, -0.459414, -0.449812, -0.00772044, 0.875416, -0.871437, 0.14814, 0.902889, 0.33383, 0.793179, 0.378951, 0.571225, -0.0213569, 0.0491027, 0.760325, 0.676196, 0.519489, -0.0893201, -0.651245, -0.765142, -0.32879, 0.193145, 0.772469, 0.746779, 0.0075883, -0.930042, 0.333903, 0.530757, -0.519358, 0.416736, 0.538663, 0.698112, -0.0439085, -0.59974, 0.0713047, -0.399103, 0.772187, 0.459098, 0.998529, 0.054071, -0.514597, -0.456349, -0.320831, -0.72287, 0.756724, -0.357048, -0.967505, 0.687298, -0.227666, 0.445937, -0.458805, 0.258586, -0.99728, 0.39023, -0.903673, -0.0931078, -0.891648, 0.926197, 0.816033, 0.877607, 0.650699, 0.0253918, -0.85171, -0.129843, -0.394022, 0.843274, -0.83714, 0.312307, 0.552191, 0.96489, 0.0715335, 0.826273, -0.782545, 0.4774, 0.819222, 0.859441, 0.462831, 0.73768, 0.0258849, 0.88497, 0.153231, -0.52586, -0.463653, -0.364006, 0.394489, 0.811553, 0.517829, 0.73001, 0.759031, 0.657032, 0.0455071, -0.194959, -0.555181, 0.89416, 0.823689, 0.45581, -0.0810749, -0.356278, 0.331849, 0.288943, 0.00428448, -0.346227, 0.483118, -0.274389, 0.449268, 0.158816, 0.318917, -0.14766, 0.419829, 0.610691, 0.962628, 0.332496, -0.096642, 0.697119, -0.286479, -0.733555, 0.349736, -0.177385, 0.814255, 0.194277, -0.156596, -0.411751, -0.745079, -0.97137, 0.043668, -0.126256, 0.662346, -0.824367, 0.333175, 0.355263, -0.836337, -0.0833444, -0.495263, 0.109175, -0.673645, 0.135472, 0.532348, 0.140005, -0.34988, -0.899463, -0.00656287, 0.611658, 0.868111, -0.07076, 0.372548, -0.274711, 0.513573, -0.421417, 0.407376, 0.133204, -0.53679, 0.893283, -0.883484, 0.626182, -0.429698, 0.0507316, 0.278007, -0.788152, 0.0693373, -0.721039, -0.117169, -0.969816, 0.108465, 0.379686, 0.387895, -0.602081, -0.359088, -0.882371, -0.0686361, 0.225978, -0.762115, 0.958341, -0.491482, -0.651134, 0.259396, -0.835761, -0.702301, -0.39002, 0.455008, 0.984349, -0.0933286, -0.255495, 0.236063, 0.282773, 0.611371, -0.191045, -0.791774, -0.323325, -0.905985, -0.560845, -0.845796, -0.946774, 0.982467, -0.945454, -0.802009, 0.203494, 0.868524, 0.896952, 0.226268, -0.70517, 0.662479, 0.233062, -0.94281, -0.284286, 0.154051, -0.115801, 0.65132, -0.335799, -0.246504, -0.0251484, 0.891393, -0.335185, 0.49638, 0.923968, -0.940054, -0.469099, 0.516889, -0.483528, -0.689724, 0.180797, -0.164883, -0.429193, 0.536594, -0.334884, 0.675434, -0.528686, 0.251385, -0.267817, -0.435282, -0.287804, -0.183113, -0.726736, 0.683951, 0.819147, -0.823593, -0.567162, -0.653411, -0.460127, -0.288933, -0.706616, 0.363796, 0.373785, -0.358696, -0.405309, -0.286744, 0.853523, -0.807254, -0.541696, 0.749086, -0.683875, 0.101477, -0.950096, -0.583711, 0.262321, -0.832494, -0.20246, 0.771875, -0.701255, 0.722523, -0.0951039, -0.974654, -0.156497, -0.378172, 0.310929, -0.31727, -0.322354, -0.0897507, 0.406228, -0.310988, -0.832221, -0.0842507, 0.81294, -0.189309, -0.0871426, -0.394386, 0.576789, -0.339028, -0.280577, 0.22978, -0.582058, -0.69204, -0.893279, 0.829916, 0.0171961, -0.706547, 0.843736, -0.0179625, -0.0391315, -0.270745, -0.323368, 0.232595, -0.298847, 0.103844, -0.923222, 0.666203, -0.899088, 0.812572, 0.0575481, -0.835621, 0.0466233, 0.900058, -0.74304, 0.215013, 0.600075, -0.902355, -0.0761072, -0.739221, -0.61479, 0.979273, 0.399739, 0.72013, -0.842124, 0.948108, 0.625578, 0.0119817, 0.241392, 0.80344, -0.827628, 0.172483, 0.000203265, 0.971924, -0.929141, 0.31619, -0.976986, 0.386046, 0.106291, 0.350515, 0.853921, -0.487986, -0.556461, 0.606763, -0.69698, -0.484898, 0.966306, 0.955382, -0.690327, 0.528284, 0.193425, -0.0998631, 0.22182, 0.456096, -0.834483, -0.0729545, 0.515398, -0.917189, -0.885045, -0.237494, 0.801017, -0.448871, 0.426555, 0.620041, -0.406484, -0.0481192, -0.735872, -0.125033, -0.26902, -0.163124, 0.814852, -0.0986999, 0.306235, 0.349781, 0.6616, -0.0313514, -0.925854, -0.0530359, -0.254348, -0.360478, 0.191418, -0.400983, -0.114954, 0.797739, -0.826996, -0.400622, -0.279505, 0.959189, 0.524941, -0.865877, 0.467362, -0.944087, -0.662626, -0.565496, 0.176287, -0.413362, 0.780595, 0.604293, -0.849498, 0.579982, -0.410201, 0.776177, -0.621483, -0.74424, 0.626845, -0.331345, 0.437185, -0.514386, -0.0844588, 0.275862, 0.686462, -0.199214, 0.422758, 0.739232, 0.355053, 0.3547, -0.815368, 0.860152, 0.931027, 0.443946, -0.411445, -0.844802, -0.327008, 0.264596, -0.775098, 0.936113, 0.681918, -0.25419, -0.0864331, 0.862934, -0.292209, 0.167135, 0.408237, 0.635093, 0.393994, 0.609618, -0.937333, 0.701747, -0.911264, -0.33834, 0.536007, 0.854692, 0.953381, 0.531638, -0.249385, 0.502071, -0.20537, 0.225341, 0.100076, 0.357687, -0.840519, -0.0478242, 0.055359, 0.49632, 0.0830015, -0.160119, 0.397986, 0.1119, -0.197709, -0.225158, -0.448459, 0.987541, 0.0456173, 0.10825, 0.301369, 0.620181, 0.551749, 0.819302, -0.0302905, 0.819424, 0.681095, 0.660366, -0.11891, -0.237527, 0.859519, 0.945695, -0.0796554, -0.540557, -0.860387, 0.81173, -0.424928, -0.707301, 0.8662, -0.155934, 0.98704, -0.556665, 0.113339, -0.907281, -0.583897, 0.305651, 0.954837, -0.754548, -0.896001, -0.0799596, -0.833099, 0.499333, 0.0520608, -0.211607, -0.366283, 0.723286, -0.746663, -0.913722, 0.53332, -0.33476, 0.621292, 0.505039, 0.128632, -0.314886, 0.256785, -0.820665, -0.644192, -0.472559, -0.152718, 0.83267, -0.438006, -0.838794, -0.471815, -0.853527, -0.101371, 0.980326, 0.177297, -0.532378, -0.55531, 0.677469, 0.78335, -0.398531, -0.461944, 0.937624, -0.790585, 0.245074, 0.607509, -0.718683, 0.591425, -0.685185, 0.870109, 0.238743, 0.904763, 0.0455531, -0.513483, -0.46101, -0.847889, -0.449093, 0.197835, 0.208253, 0.959439, -0.469372, -0.554513, 0.332172, 0.0790537, -0.116098, 0.255515, 0.368079, -0.937337, 0.104208, 0.901295, -0.0373994, 0.136302, -0.778624, 0.5899, -0.289693, 0.287892, -0.22977, -0.503799, 0.477573, 0.0661647, 0.254978, -0.30002, 0.477997, 0.884055, 0.323536, 0.245157, -0.806124, 0.593552, 0.162333, -0.977552, 0.181396, -0.84823, -0.956774, -0.989515, -0.626477, 0.214778, 0.0551604, 0.82748, -0.327634, -0.540387, -0.293576, 0.842574, -0.16477, -0.764714, -0.640627, -0.200486, -0.13436, -0.986028, -0.423655, -0.162845, -0.246863, -0.873419, -0.174818, 0.773569, -0.343079, -0.923122, 0.437867, 0.310038, 0.362351, -0.369442, -0.394431, 0.826693, 0.374782, -0.288554, 0.0173871, -0.456204, 0.174978, 0.0398037, -0.681641, 0.352586, 0.474176, -0.213497, 0.0793767, 0.0149472, 0.00688265, -0.480325, -0.188878, 0.801084, -0.261592, -0.998908, -0.227467, -0.836575, 0.642634, -0.104381, 0.916673, 0.632994, -0.576031, 0.598041, -0.110048, -0.22284, 0.893481, 0.326121, -0.438791, -0.0808862, 0.837492, 0.234437, 0.696998, 0.671814, 0.158196, -0.181635, 0.230488, 0.73159, 0.675119, 0.503217, -0.093371, -0.0867543, 0.99331, -0.234565, -0.606571, 0.559498, -0.206551, 0.91917, 0.234342, -0.405906, 0.522836, -0.620729, -0.572257, -0.350111, 0.802436, 0.214065, 0.851643, -0.0104911, -0.261395, 0.738123, 0.105257, 0.948124, 0.72774, 0.0601304, 0.115149, -0.926667, -0.838025, -0.0885621, 0.884198, 0.550456, 0.61605, 0.501974, -0.520633, -0.191657, 0.41883, -0.875697, -0.787386, 0.573755, -0.23143, 0.658185, -0.303818, -0.948911, 0.609919, -0.336388, -0.482919, 0.352724, 0.626605, -0.288653, 0.37375, 0.969278, 0.205456, 0.788868, -0.959912, -0.0592191, 0.95141, 0.86649, -0.180025, 0.741045, -0.526162, 0.939689, -0.639533, 0.903372, -0.818538, -0.690698, 0.468037, -0.637864, 0.809177, -0.703163, -0.808485, -0.209963, -0.504712, 0.649124, 0.267709, -0.803372, -0.897898, 0.536692, 0.408809, -0.760031, 0.244425, 0.688399, 0.946562, -0.869548, 0.53423, -0.843899, -0.0349288, -0.522634, -0.41115, 0.631577, 0.334275, 0.897011, -0.799171, 0.684106, -0.723238, -0.620417, 0.634183, 0.789252, 0.237981, 0.659937, -0.532607, -0.995343, -0.651137, -0.690678, -0.271206, 0.732575, 0.691984, 0.702666, 0.261381, 0.333251, 0.665786, 0.828601, 0.338611, -0.444582, -0.575336, 0.603616, 0.934754, -0.441091, 0.88984, 0.876586, -0.238895, -0.403478, 0.300259, 0.983898, 0.527221, -0.538442, 0.594131, -0.674647, 0.730108, 0.919888, 0.686068, -0.568761, 0.386029, -0.188525, 0.496497, 0.80004, 0.0802104, 0.272213, 0.822615, 0.459508, 0.000272674, 0.846813, 0.723086, -0.305242, -0.633297, -0.588151, -0.0864627, -0.957281, -0.502888, 0.586775, 0.950503, 0.432712, -0.105924, 0.20548, -0.851224, 0.675482, 0.205913, 0.798582, 0.87404, -0.10787, 0.0425715, -0.932904, 0.515912, 0.165452, -0.619121, -0.73909, 0.455071, -0.926197, -0.593205, 0.804508, -0.210384, 0.140381, 0.849834, 0.935427, 0.539123, -0.0982429, 0.55332, 0.0372872, -0.727755, -0.959426, 0.999973, -0.0548478, -0.933748, -0.537886, 0.4857, 0.72834, 0.137346, 0.251032, -0.369557, -0.924614, -0.990273, 0.989937, -0.255468, -0.954611, 0.454059, -0.804767, -0.528776, -0.386031, 0.699271, -0.347727, -0.386022, 0.758962, -0.958474, 0.0976661, -0.647462, -0.616968, 0.838472, 0.487383, 0.565919, 0.609926, 0.246978, 0.928947, 0.453543, 0.824079, 0.260112, 0.570133, -0.116975, 0.757353, -0.941061, -0.724938, -0.492182, -0.226436, 0.185818, -0.131596, -0.0708566, 0.290063, 0.513414, 0.830967, 0.721882, 0.721855, 0.960032, 0.567439, -0.314639, -0.287053, -0.712872, 0.635892, 0.54067, -0.0712814, 0.684983, -0.670322, 0.617716, -0.926569, -0.202157, 0.499476, -0.454731, -0.329608, -0.528718, 0.480472, -0.00276597, 0.516914, 0.0996703, 0.82928, 0.102119, -0.590402, 0.413667, 0.85207, 0.330339, 0.332627, -0.0971212, -0.78584, 0.470716, -0.0262906, 0.815996, -0.319497, -0.410051, 0.915336, 0.659326, -0.344416, 0.802802, -0.723949, -0.523857, 0.362654, -0.722948, -0.668897, 0.19419, -0.0189754, -0.376022, 0.497631, 0.76901, 0.0553762, 0.703558, -0.230454, 0.0317546, 0.730485, -0.48952, 0.122079, -0.590384, 0.44353, -0.82844, -0.184951, -0.478561, 0.186187, -0.914882, -0.189784, 0.194414, 0.728494, 0.554998, 0.936527, 0.455038, 0.0525707, -0.419494, 0.0822583, 0.231592, -0.981078, -0.30754, 0.347545, 0.0385666, -0.907171, -0.225528, 0.207843, 0.0629726, 0.412058, 0.790704, 0.774655, -0.338387, 0.69741, -0.807, -0.313566, -0.983026, 0.705032, -0.869952, -0.150845, 0.893652, -0.966165, 0.501707, 0.804924, 0.346134, -0.750682, 0.764583, 0.738072, 0.655024, -0.44599, 0.883321, 0.612847, 0.0381649, 0.926072, -0.961795, 0.557409, -0.236942, 0.3995, -0.988338, 0.294121, -0.325949, 0.88146, -0.983888, 0.117277, 0.905645, 0.187449, -0.331231, -0.400963, -0.730968, -0.483286, -0.210892, 0.919393, 0.146244, -0.921931, -0.789725, 0.151243, 0.480422, -0.917769, -0.184154, 0.881603, 0.87088, 0.395636, 0.962253, -0.789577, 0.85656, 0.152404, 0.852221, 0.956801, 0.208262, 0.801222, -0.871733, -0.552993, 0.811387, 0.644489, -0.00595922, 0.644619, -0.318749, 0.422923, -0.56651, 0.271635, 0.261164, 0.655995, 0.339796, -0.228226, -0.450349, 0.026715, 0.932162, 0.0460857, -0.648095, 0.0182629, -0.775439, -0.217859, 0.792937, -0.480992, -0.667964, 0.74257, -0.243572, 0.833538, 0.732564, -0.187754, -0.192197, -0.339235, 0.0687252, 0.10822, -0.576343, 0.49021, 0.108484, -0.291067, 0.686986, 0.641413, -0.317264, -0.0455056, 0.0490873, -0.722157, 0.0474884, 0.925886, 0.040933, -0.288844, 0.474095, 0.858063, 0.273219, 0.961833, 0.372777, 0.963455, 0.975011, 0.0685306, -0.412139, -0.520785, -0.85746, -0.486763, -0.906192, 0.376264, -0.424861, -0.838373, -0.0410597, -0.493517, 0.814163, -0.98583, 0.812444, -0.263163, -0.46047, -0.810483, -0.0141114, 0.21133, 0.430253, 0.138913, -0.385672, 0.801674, 0.610268, 0.713142, -0.214857, -0.616196, -0.0893841, 0.0256265, 0.21725, -0.870011, -0.379341, 0.412514, -0.29048, 0.885312, -0.678844, -0.323553, 0.0477622, 0.275082, -0.344843, -0.638996, 0.474624, 0.770604, -0.808289, -0.552447, -0.815948, -0.00674798, -0.0534284, -0.482805, -0.627585, 0.00178462, -0.154996, 0.219353, -0.678069, 0.520121, 0.844467, -0.27422, -0.0281624, 0.331083, -0.0985222, -0.571624, -0.244791, 0.221188, -0.355898, 0.265358, 0.444123, 0.160214, -0.599938, 0.523062, -0.132634, -0.246496, 0.00303223, 0.965944, -0.246934, -0.497791, -0.445247, 0.937718, 0.83591, 0.807781, -0.299732, -0.814154, 0.791098, 0.601379, 0.486197, 0.784107, -0.765689, 0.787202, 0.641666, 0.904187, 0.39787, 0.875617, -0.751605, 0.513506, -0.454811, 0.427467, 0.151014, 0.189844, -0.0373331, -0.592043, 0.335658, -0.672239, -0.561491, 0.652044, 0.849993, 0.234092, -0.00534204, -0.59374, 0.25764, 0.759804, -0.541893, -0.660433, 0.663421, 0.867092, -0.824859, 0.714098, -0.580173, 0.911717, 0.147609, -0.501599, -0.578796, -0.523658, 0.417146, 0.718296, -0.0476376, -0.0573158, -0.0208924, -0.574358, -0.780804, 0.183777, 0.7827, -0.981767, -0.0676587, 0.719092, -0.331525, -0.054108, 0.824662, 0.523183, 0.308231, 0.553563, 0.214006, -0.237209, 0.792976, 0.113976, 0.0491042, 0.29559, -0.97893, 0.529247, -0.155307, 0.130821, 0.2082, 0.40094, -0.98172, 0.675407, 0.0589806, -0.511435, 0.0591998, -0.926079, -0.854534, 0.989922, 0.476943, 0.185354, 0.0415787, -0.434291, -0.986667, -0.968702, -0.28624, -0.551645, 0.0571235, 0.528454, 0.509033, 0.151387, -0.749157, -0.0673488, 0.358956, 0.635988, -0.827604, 0.602157, 0.343209, 0.898566, -0.655728, -0.621943, 0.226281, -0.937749, -0.169017, 0.144151, -0.219913, 0.434399, -0.43259, -0.234984, -0.429967, 0.102045, -0.987479, -0.622068, 0.486024, 0.18796, 0.905328, 0.894526, 0.101067, 0.941056, -0.966991, 0.097397, -0.293041, 0.109681, -0.350646, -0.539286, 0.351637, 0.435544, -0.764144, -0.908013, 0.99926, 0.130506, -0.969769, 0.695466, -0.18768, 0.181322, -0.851484, -0.920546, 0.584649, -0.507767, 0.355119, -0.553547, 0.979368, 0.589906, -0.581892, -0.10338, -0.520202, 0.0649632, 0.996399, 0.309573, -0.0517621, 0.563095, -0.390128, -0.735919, -0.508076, 0.60723, 0.715918, -0.766301, -0.0544392, -0.115085, 0.193456, 0.0163817, 0.942881, 0.810677, -0.588843, -0.605035, -0.0626706, -0.0567628, 0.748089, -0.831297, -0.994808, -0.171057, -0.709717, -0.157588, 0.0705142, -0.107525, -0.321809, -0.714558, 0.762411, -0.37337, 0.585363, 0.942282, 0.872793, 0.51934, 0.794973, 0.253366, 0.816056, -0.0615048, -0.78181, -0.0472953, -0.487951, -0.32602, -0.591984, -0.68107, 0.770082, 0.201876, 0.138505, -0.0696993, -0.693739, 0.599214, -0.925969, -0.869868, 0.295597, -0.178579, 0.740829, 0.962246, 0.688694, 0.44775, -0.973342, -0.365835, -0.129635, 0.900395, -0.170174, 0.552993, 0.843879, -0.16295, -0.762408, 0.38411, 0.0416648, -0.726797, -0.604057, 0.852532, 0.788455, 0.951079, 0.127664, 0.612318, 0.349021, 0.448513, 0.0299467, 0.60492, -0.429156, -0.576504, 0.290932, 0.0116365, -0.180828, 0.963357, -0.659525, 0.129871, -0.610604, 0.203916, 0.952721, 0.283687, 0.528463, -0.585058, -0.747956, -0.49882, 0.460843, -0.821108, -0.907137, -0.486175, -0.648749, -0.989078, -0.638485, 0.82284, -0.0359299, 0.969683, 0.924768, 0.262597, -0.109772, 0.173293, 0.544235, -0.229901, 0.318247, 0.375021, -0.769311, -0.16102, 0.865613, 0.583472, -0.337309, 0.691529, -0.627187, -0.0553403, 0.254547, 0.527415, -0.984245, -0.355403, 0.0161208, 0.156524, 0.554639, -0.905947, -0.133339, 0.940256, 0.234491, 0.524725, 0.591954, 0.201763, -0.0799163, -0.352121, -0.984878, -0.215147, 0.438609, -0.831891, -0.770839, 0.126505, 0.133697, 0.857816, -0.437206, -0.990114, 0.0661292, -0.625624, -0.728365, 0.0911008, -0.114546, -0.0302023, -0.53469, 0.791544, 0.142917, -0.396396, -0.610335, 0.461153, -0.316575, 0.823773, -0.993003, 0.983608, 0.535033, 0.167211, -0.696907, 0.983146, -0.633663, 0.681592, 0.94489},
-	{-0.0801062, 0.285713, 0.114247, -0.816559, -0.261516, -0.995038, -0.399554, -0.653067, -0.182258, 0.568153, 0.42859, 0.49852, 0.74082, -0.449756, 0.902285, -0.484792, -0.00593984, 0.263971, 0.894306, -0.0319318, -0.69439, -0.207014, 0.487821, -0.743762, 0.259366, 0.55026, -0.0913789, 0.803855, -0.333705, -0.760429, 0.154778, -0.23721, -0.83249, 0.171139, -0.745798, -0.94302, 0.795611, 0.244483, -0.4732, 0.664373, -0.71687, -0.390397, 0.635576, 0.854244, 0.399356, -0.956452, -0.243156, 0.202985, -0.924079, -0.255223, 0.541747, 0.12886, 0.0296662, 0.985613, -0.704855, 0.6741, 0.50189, 0.086089, 0.238435, -0.979124, 0.831039, -0.912752, -0.677659, 0.695637, -0.588678, -0.88845, -0.043165, 0.409616, -0.956315, 0.850967, 0.73497, 0.219124, 0.228672, 0.0626637, 0.880281, 0.33533, 0.338439, 0.705177, 0.380356, 0.139739, -0.98262, -0.898303, 0.317798, -0.639269, -0.0726246, -0.204777, -0.748506, 0.712412, -0.539406, 0.798163, 0.121826, 0.306641, 0.66337, -0.945854, 0.948797, 0.882078, -0.831664, -0.245746, 0.717068, -0.779648, 0.475944, -0.691653, 0.58831, 0.692522, 0.770854, -0.205892, 0.66352, 0.170441, -0.388966, 0.115984, 0.315324, 0.443411, -0.764346, -0.785975, 0.68373, 0.137099, -0.255671, -0.821553, -0.704469, -0.85924, -0.629433, 0.130886, -0.145008, 0.748983, 0.230108, 0.224966, 0.368021, -0.286443, 0.151304, 0.479989, 0.644348, -0.242142, -0.783867, 0.902297, 0.913223, 0.650494, 0.455636, -0.0972006, -0.46023, -0.19483, 0.345565, -0.457404, -0.836261, -0.644356, -0.220027, 0.160306, 0.253499, -0.0973569, 0.414845, -0.138087, 0.517693, -0.50223, -0.816923, 0.863996, 0.947244, -0.882982, -0.992639, 0.577365, 0.648604, 0.406198, 0.290154, -0.938309, 0.0768559, -0.86264, -0.377011, 0.802711, 0.735938, -0.0118385, 0.891779, 0.266414, -0.735883, 0.937138, 0.0344623, 0.730607, -0.917928, 0.400521, 0.460293, -0.744683, 0.329908, 0.0926813, -0.502881, 0.782067, -0.232821, -0.33966, 0.270843, -0.0645225, -0.599558, 0.673051, 0.460023, -0.272979, 0.787288, 0.160204, -0.679374, 0.452038, -0.377488, -0.766965, 0.366345, 0.117351, 0.891443, 0.847676, 0.283984, -0.0182327, 0.561768, -0.808367, -0.683725, 0.289702, -0.634867, 0.944758, 0.268176, -0.366123, -0.135651, -0.219371, -0.051073, 0.0344726, -0.15376, 0.40127, -0.92808, 0.917924, -0.611474, -0.414529, 0.44229, -0.507508, -0.710435, -0.858331, -0.705508, 0.106942, 0.591335, 0.52302, 0.196555, -0.541816, 0.00454747, -0.0308337, -0.17563, -0.489044, 0.87514, 0.179381, -0.101834, -0.161092, -0.141459, -0.103186, 0.283751, -0.593037, 0.111278, -0.722359, -0.996635, 0.496789, 0.147021, -0.0457618, -0.771251, 0.817665, -0.821595, 0.276164, -0.368944, 0.469422, -0.397761, -0.0172069, 0.255516, 0.405058, -0.288835, 0.476735, -0.0867614, 0.521183, -0.325002, -0.261986, 0.583503, 0.673633, -0.464634, 0.117094, 0.255617, -0.967589, 0.884292, 0.447525, -0.455812, 0.234367, -0.776206, 0.171297, 0.0507269, 0.738684, -0.200878, 0.827089, 0.72317, 0.216029, 0.279979, 0.736257, -0.0915848, 0.65226, 0.292385, -0.604771, 0.0238605, -0.520445, -0.172934, -0.0866904, -0.801827, -0.272997, -0.189248, -0.722537, -0.748794, -0.901708, -0.640162, 0.276464, 0.165384, 0.290546, 0.675662, 0.0651707, 0.554134, -0.302186, -0.545602, 0.582822, -0.289772, -0.457575, -0.775882, -0.0558653, -0.359685, -0.130207, 0.56595, -0.781466, 0.975328, -0.150986, -0.430086, 0.021675, 0.990466, -0.0154752, -0.442675, 0.70143, 0.746286, -0.0921993, -0.597068, -0.866617, 0.774899, -0.351491, -0.708931, -0.769525, 0.748221, 0.00257963, -0.618405, -0.672814, 0.0731592, -0.368695, -0.902437, -0.0816145, 0.165898, 0.831439, 0.123524, -0.64176, 0.524482, -0.0261564, -0.223797, -0.372627, -0.642302, 0.902916, -0.224383, 0.974487, 0.202869, 0.0332567, -0.244571, -0.157897, -0.456914, 0.0650517, 0.869155, -0.480552, 0.310887, 0.121762, 0.759105, 0.405962, 0.329376, -0.719909, -0.436851, 0.8265, 0.0174909, -0.748354, -0.0845776, -0.831273, -0.940994, 0.724163, -0.935983, -0.925525, 0.635748, 0.840074, 0.946942, -0.0108608, 0.681056, 0.473118, -0.0602113, 0.884726, -0.769418, 0.212761, 0.0880564, 0.0933497, 0.520753, -0.488644, 0.914689, -0.589415, 0.628745, -0.81328, -0.172603, 0.920571, 0.173968, 0.0719891, 0.361347, -0.794183, -0.590408, 0.57784, 0.0192284, -0.262796, -0.0856537, -0.148462, -0.958301, 0.670786, -0.361165, 0.430016, -0.760057, -0.935109, 0.585281, 0.0739787, 0.70005, 0.7204, 0.0120278, -0.91514, 0.49024, 0.125423, 0.843729, 0.449734, 0.405703, -0.458164, 0.849111, -0.341928, -0.699315, -0.477385, -0.944938, 0.393414, 0.586242, 0.608148, 0.0874408, 0.763857, 0.283117, -0.343943, -0.574467, -0.552537, 0.409233, -0.572102, -0.0209502, -0.389564, 0.0818231, 0.280269, -0.124638, -0.724892, -0.630669, 0.376921, -0.698984, 0.562874, 0.309243, 0.921075, 0.813682, 0.780522, 0.815723, 0.455078, 0.256162, -0.73075, 0.0135447, -0.28414, -0.258478, 0.698264, -0.723837, 0.156878, 0.664435, 0.533633, 0.84016, 0.494886, -0.22344, -0.531935, 0.559769, -0.800798, 0.0770755, 0.302069, 0.953674, -0.361317, -0.802284, -0.494, -0.614599, -0.754703, -0.165732, -0.460725, -0.457255, 0.857954, -0.242807, -0.358711, 0.577114, 0.831105, 0.739022, -0.586268, -0.0741409, -0.427687, -0.3122, -0.91634, 0.734644, -0.0460585, -0.799475, -0.344953, -0.481923, 0.706103, -0.376757, -0.972029, -0.450775, -0.235754, -0.357244, -0.14433, -0.432109, -0.145316, 0.216013, 0.860076, 0.994808, -0.472584, -0.55786, 0.14616, -0.944954, -0.504235, 0.638755, -0.937268, -0.588645, -0.253744, -0.98778, -0.413638, 0.165682, 0.245455, 0.852712, 0.572119, 0.252173, -0.585551, 0.666068, -0.904325, -0.130181, -0.923244, 0.911365, -0.918343, 0.791706, -0.61634, 0.701489, 0.475312, 0.00446246, -0.426326, 0.569633, -0.129094, -0.638424, -0.795422, 0.937498, -0.9532, -0.932421, 0.514202, -0.756119, -0.329513, -0.69968, -0.834155, -0.0991847, 0.108546, 0.468576, -0.930201, 0.38457, 0.82256, -0.246078, 0.393939, -0.700986, 0.313863, -0.535074, 0.59027, 0.909819, -0.786129, 0.572048, 0.633181, 0.643647, 0.388647, -0.490974, 0.073761, -0.831711, 0.330696, 0.724746, -0.612325, -0.0124081, 0.963448, 0.521562, 0.0796471, 0.225223, 0.594098, 0.725162, -0.957387, 0.00610852, -0.27613, -0.0456665, -0.352178, -0.119239, 0.477516, 0.0620466, 0.892853, -0.810057, 0.999866, -0.852791, 0.911087, 0.764358, -0.450389, -0.796572, 0.297091, 0.521759, 0.0370475, -0.514076, -0.992972, -0.0966333, 0.0387921, -0.829367, 0.308412, 0.140255, -0.796796, -0.581928, -0.214519, -0.11327, 0.170202, 0.360996, -0.562301, 0.244331, -0.679315, -0.310089, 0.225526, -0.985375, 0.724115, 0.828014, -0.954432, 0.591209, 0.98082, 0.867698, -0.300979, -0.349442, -0.711154, 0.488634, -0.615512, 0.407341, 0.237985, 0.632238, 0.202925, -0.246804, 0.761231, 0.85162, -0.511969, -0.709154, -0.564513, 0.671598, 0.59477, -0.804619, 0.836909, 0.998064, -0.245503, -0.193903, 0.803418, 0.626415, 0.335243, 0.69272, -0.146464, -0.536725, -0.160441, -0.00584022, 0.424144, -0.560702, -0.0883619, 0.270813, -0.698637, 0.973696, -0.0363689, -0.964855, 0.488885, -0.320558, 0.262396, -0.131596, 0.707144, -0.519069, -0.773593, -0.728575, -0.0122926, 0.309135, 0.407281, -0.450876, -0.898622, -0.173192, -0.333169, 0.924164, 0.416872, -0.548879, 0.496396, -0.471728, 0.739055, 0.505671, 0.623546, -0.238486, 0.904735, -0.676044, -0.477262, -0.654869, 0.776964, -0.876448, -0.938102, 0.835362, 0.661655, 0.935176, 0.780934, -0.615743, -0.322403, -0.123031, 0.80246, -0.131147, 0.886203, 0.0923565, 0.602385, 0.81681, 0.248924, 0.145843, 0.626806, -0.277533, -0.07799, -0.678181, -0.022676, -0.533899, -0.0146167, -0.530388, -0.63948, -0.685391, -0.662908, -0.794433, -0.982073, 0.705742, 0.20634, -0.950378, -0.320109, 0.131965, -0.671181, 0.703177, -0.942297, 0.489475, -0.0114638, 0.479121, 0.119419, -0.0275407, -0.675853, -0.200061, -0.0541377, -0.383539, -0.380581, 0.713692, 0.934525, -0.0673907, -0.719158, -0.165821, 0.370165, -0.347785, -0.475274, -0.44467, 0.354684, -0.553564, -0.980447, -0.362323, -0.534462, 0.641264, 0.232875, 0.0855187, 0.90694, -0.033009, 0.591033, 0.115221, 0.230358, 0.381108, 0.882512, -0.25607, -0.419271, -0.131151, 0.207592, 0.706628, 0.209672, 0.792113, 0.00368256, 0.858942, -0.882222, 0.118094, -0.743693, 0.66489, -0.852442, -0.214074, -0.506977, -0.315018, -0.0937487, 0.208106, -0.708633, 0.0898392, -0.88097, 0.558858, -0.03403, -0.150564, -0.483957, 0.34727, -0.3432, 0.213169, 0.874819, -0.835137, 0.19802, 0.454391, -0.78968, -0.45538, 0.854316, 0.0488085, 0.209881, -0.631499, 0.645497, 0.422087, -0.899985, 0.0994362, -0.937559, -0.202477, 0.456098, 0.332228, 0.714731, -0.401552, -0.625378, -0.441601, 0.0910315, 0.522637, -0.25183, 0.638026, -0.322194, 0.919054, 0.810763, -0.944175, -0.965937, -0.742892, -0.738624, 0.889995, 0.142352, 0.596185, -0.488518, 0.118189, -0.548978, 0.865148, -0.179779, 0.808564, 0.924664, -0.203519, 0.381054, 0.305338, 0.636298, -0.573565, 0.674141, 0.587827, 0.299073, 0.915177, 0.887931, 0.395402, 0.848159, -0.450463, -0.0625767, -0.503029, 0.662428, 0.450211, -0.349089, 0.00170807, -0.31072, -0.510389, -0.595897, 0.172563, -0.658862, 0.984407, 0.656219, -0.137103, 0.876915, -0.371134, -0.201511, 0.32603, 0.803461, 0.930028, -0.146373, -0.628779, 0.69563, 0.830014, 0.767603, 0.0699138, -0.618978, 0.292234, -0.147558, 0.330664, 0.746558, -0.72988, 0.199755, -0.987855, 0.00220595, 0.380607, -0.0147574, -0.403941, 0.832516, 0.592326, -0.933681, 0.121944, 0.572045, -0.39499, 0.0744533, 0.136668, 0.588885, 0.426026, -0.562802, 0.560434, 0.500162, -0.482576, 0.422216, 0.151807, 0.483665, -0.629849, -0.346959, 0.535846, 0.855698, -0.0767691, 0.56282, 0.718186, -0.168415, 0.734491, 0.558441, 0.524554, 0.0106497, -0.219066, -0.860845, -0.444487, -0.192839, -0.146055, -0.0970065, -0.41821, 0.939516, -0.375957, -0.313014, -0.0388733, 0.130509, -0.0800827, -0.439179, -0.460834, 0.0226431, -0.562817, 0.600024, -0.854561, -0.526518, 0.908008, 0.345103, 0.841027, 0.806679, -0.469339, -0.239759, 0.321083, 0.0480901, -0.498403, -0.223922, -0.646549, -0.333469, 0.211477, -0.898001, -0.0243711, -0.118058, -0.789516, 0.206042, 0.788219, -0.624518, -0.0733556, -0.555398, -0.0860462, -0.287571, -0.193087, -0.225561, -0.942732, -0.788434, -0.198686, -0.766284, -0.358203, 0.573392, 0.916898, 0.732386, 0.951724, -0.0933935, 0.897548, 0.154916, 0.535392, 0.035259, 0.711793, 0.330507, -0.701949, 0.934811, -0.882856, -0.649868, 0.310071, -0.0213865, 0.401547, -0.178107, -0.198162, -0.359316, 0.719165, -0.0757734, -0.509929, -0.306248, -0.0897397, -0.618972, 0.459679, 0.902572, -0.705972, 0.854102, 0.840511, -0.981852, -0.82048, 0.642899, -0.407992, -0.524839, -0.973683, -0.340155, -0.0276638, -0.211605, -0.14867, 0.56786, 0.129186, -0.803237, -0.040573, 0.512751, -0.987582, -0.978764, -0.535129, 0.69138, 0.787967, 0.750294, -0.588791, -0.387772, -0.876408, 0.84969, 0.807277, -0.508224, 0.18225, -0.977792, -0.50122, -0.149938, 0.550815, 0.349339, -0.0656243, -0.614101, 0.173498, 0.0523918, 0.173552, 0.895225, 0.663198, -0.409852, 0.299037, 0.519737, -0.763164, -0.805484, 0.18956, 0.489744, -0.639911, 0.153042, 0.298335, 0.794386, -0.780511, -0.132125, 0.466974, 0.476274, 0.0120168, 0.0148646, -0.849041, -0.461606, 0.356696, -0.0380188, 0.334279, -0.0373522, 0.687892, -0.996579, -0.43888, 0.699079, 0.635142, -0.574778, 0.647237, -0.875718, -0.400513, 0.108408, 0.214931, 0.775784, 0.155111, -0.677809, -0.259781, 0.6076, -0.270182, -0.678237, 0.503532, -0.302526, -0.424182, -0.958692, 0.183523, 0.840822, -0.233719, 0.369714, 0.551259, 0.810433, 0.74953, 0.543639, -0.897371, 0.772878, -0.321938, 0.31846, 0.0385827, 0.834991, 0.865703, -0.88264, -0.860983, -0.827267, 0.730119, 0.797999, -0.907919, -0.0484954, 0.0810641, -0.197579, 0.31745, 0.153545, -0.877666, 0.54597, 0.941954, 0.050343, -0.660973, -0.179991, 0.988415, 0.830009, 0.561916, 0.37275, -0.554469, -0.441475, -0.897964, 0.165272, 0.829675, 0.674374, -0.193367, -0.932556, -0.132499, 0.037589, -0.468286, 0.411523, -0.587956, 0.563045, -0.528084, -0.640701, -0.814223, 0.0969211, 0.723478, -0.919122, 0.468912, 0.908281, -0.103885, -0.911995, -0.983345, -0.244701, -0.0321486, -0.277519, 0.149623, 0.978228, -0.975978, 0.615968, -0.0530184, -0.974189, 0.00260727, 0.157365, 0.770116, -0.422036, -0.19261, -0.189488, 0.0555364, -0.795611, -0.557221, 0.0245624, -0.707304, 0.695836, -0.352203, -0.970691, 0.459852, 0.438347, 0.762769, 0.952006, -0.964156, 0.0626589, 0.385332, 0.0194385, -0.745129, -0.445067, 0.1433, 0.231511, 0.504727, -0.889216, 0.442719, -0.0787006, 0.588238, -0.0478884, -0.292181, -0.789427, -0.117918, -0.836293, 0.0468344, 0.275914, 0.272015, -0.323954, 0.325789, 0.787037, 0.162968, -0.0487778, -0.646988, 0.319035, -0.731566, 0.328747, 0.757953, 0.991723, 0.0960943, 0.708821, -0.964667, 0.481754, -0.760973, 0.488191, 0.712672, 0.619025, -0.605537, 0.489064, -0.736761, -0.165977, -0.825422, -0.839885, 0.0524945, 0.650718, 0.881803, -0.933045, -0.408518, -0.470014, -0.834599, 0.12254, 0.861726, 0.985694, 0.329326, -0.488731, 0.63309, -0.666075, 0.664437, -0.963057, 0.711635, 0.481493, 0.24589, -0.206848, -0.0558384, -0.566551, 0.430857, 0.515269, 0.782769, -0.400644, 0.529448, -0.56242, 0.304317, -0.385427, 0.546026, -0.133111, 0.47535, 0.818333, -0.373292, -0.315089, -0.587985, -0.535489, -0.0348418, 0.612508, -0.506781, -0.153383, 0.806311, -0.639883, 0.415079, 0.933474, -0.815632, 0.34245, 0.422346, -0.420887, 0.0360942, 0.104946, 0.0805903, -0.771219, 0.983105, 0.47748, -0.949725, -0.495139, -0.347718, -0.888244, 0.826255, 0.239844, -0.902022, -0.340203, 0.381609, -0.112059, -0.0704865, 0.790727, 0.826011, 0.363396, -0.451322, 0.0267306, 0.701373, -0.030708, 0.0238133, -0.603769, -0.456497, 0.319306, 0.526771, -0.491765, 0.744443, 0.542006, 0.169176, -0.602147, -0.701507, 0.584097, -0.248586, -0.207094, 0.25485, -0.141403, 0.14118, 0.288051, 0.489272, -0.770759, 0.884487, -0.173106, -0.277104, 0.500263, 0.114465, -0.115678, -0.972084, 0.607137, 0.545724, 0.874401, 0.639548, -0.951964, 0.987919, 0.719723, -0.783648, 0.903717, -0.345177, -0.0201597, -0.279607, -0.953195, 0.630397, -0.402274, -0.862146, -0.822804, -0.0627332, 0.580782, -0.938859, 0.416006, -0.564418, 0.71562, 0.549395, 0.469815, -0.308609, -0.0974683, -0.12395, -0.539058, 0.886495, -0.0155012, -0.632375, 0.2302, -0.745235, -0.0218647, 0.426006, -0.738839, 0.459609, -0.882574, 0.0644816, -0.682113, -0.146456, 0.0513086, -0.99668, 0.026769, -0.757236, 0.281847, -0.995536, 0.0875862, 0.318387, -0.0716829, -0.00463267, 0.707878, 0.219018, -0.770686, -0.443928, 0.836909, 0.718085, 0.599789, -0.164236, -0.494136, 0.662766, -0.694173, 0.577099, 0.337137, -0.778671, 0.852467, -0.465574, -0.514267, 0.316486, -0.695948, -0.946854, 0.346933, 0.342533, 0.246521, 0.24784, -0.380656, -0.606292, -0.678109, -0.124405, -0.448629, 0.552609, 0.756013, 0.794224, -0.345861, -0.0535101, -0.620573, 0.163125, 0.892299, 0.487336, 0.758696, -0.459174, -0.754025, -0.923256, -0.217985, 0.776428, 0.939023, -0.271878, 0.771171, -0.706086, -0.939429, -0.303146, -0.178037, 0.214797, 0.285859, -0.336304, 0.918285, 0.249643, -0.77475, -0.098257, -0.12291, 0.669305, -0.208666, -0.201222, 0.825271, 0.416542, -0.596241, -0.548603, 0.893873, -0.47542, 0.0861835, 0.783325, -0.188494, 0.941505, -0.990213, 0.0634013, 0.457455, -0.816168, 0.64184, -0.713089, 0.523371, -0.0771566, 0.374513, 0.542767, 0.596028, -0.425877, 0.423946, 0.974264, 0.553354, -0.244627, -0.395213, -0.0334137, 0.201441, -0.250856, 0.482849, -0.508995, 0.50879, 0.256974, 0.584141, 0.852453, -0.601173, 0.275087, -0.251182, -0.918128, -0.171973, -0.0628493, -0.407967, -0.379167, 0.332975, -0.429878, 0.38413, -0.576223, -0.159071, -0.964041, 0.136005, 0.528933, -0.319129, -0.733822, 0.337182, 0.316408, 0.46312, 0.44717, 0.991928, -0.410137, -0.0873399, -0.454551, 0.464503, -0.918265, -0.857067, -0.204048, 0.325234, -0.164654, 0.519265, -0.70635, -0.275659, -0.559192, -0.916766, -0.737899, -0.825823, -0.18274, 0.71307, -0.753742, 0.0524352, -0.64438, 0.869669, 0.205343, 0.722664, 0.192285, 0.811077, 0.226472, 0.123226, 0.362794, -0.649148, 0.0788989, -0.0717805, 0.735478, 0.678634, -0.82351, -0.089153, -0.0273677, -0.942773, 0.436816, 0.740271, 0.99834, 0.257608, -0.947001, -0.715829, 0.376834, 0.812501, 0.523797, 0.778327, -0.330907, 0.854873, -0.492541, -0.879113, 0.508952, -0.117621, 0.74234, 0.666511, 0.6735, -0.125388, 0.511905, -0.403138, -0.400872, 0.13773, -0.848619, -0.758267, -0.0525265, 0.268769, -0.888828, 0.147842, 0.338833, -0.895337, 0.470067, 0.22668, -0.0674558, 0.21632, 0.0752213, -0.385063, 0.00474596, -0.52541, -0.182229, 0.253933, 0.66546, 0.578502, 0.973435, -0.298751, -0.820568, 0.717314, 0.642337, 0.998803, 0.86745, -0.809514, 0.716435, 0.721133, 0.373796, 0.170639, 0.617968, 0.580677, 0.178423, 0.305783, 0.123597, -0.454228, -0.217824, -0.642768, 0.597838, 0.0101263, 0.124281, 0.501715, 0.994138, -0.6888, -0.424577, -0.908866, 0.761509, -0.81273, -0.0345529, 0.921692, -0.905131, 0.194226, -0.261325, 0.636414, -0.778219, -0.65834, 0.590835, -0.595156, 0.686102, 0.963791, 0.0193297, 0.307479, 0.661357, -0.89314, 0.326088, -0.0279332, -0.862692, -0.227051, -0.150458, -0.842868, 0.832534, -0.622442, -0.71871, -0.78576, -0.0149279, -0.663298, 0.0784714, 0.623559, 0.812637, 0.625021, 0.0230515, 0.341137, 0.144535, 0.947623, -0.657797, 0.599731, -0.339897, -0.991604, -0.582107, -0.222059, -0.903169, -0.984795, 0.414048, 0.504062, -0.242339, 0.652681, 0.224746, -0.759919, 0.0824839, 0.400378, -0.329478, -0.970546, 0.461575, 0.751589, 0.701671, -0.278309, 0.775841, -0.870668, -0.995965, 0.147634, -0.807608, -0.86816, -0.136168, -0.505034, -0.536246, -0.640226, -0.158497, 0.393927, 0.565716, 0.0532087, -0.0509302, -0.360717, -0.957634, -0.251748, 0.459174, -0.487387, 0.131409, 0.827256, 0.695947, 0.337948, 0.884333, -0.855281, -0.274248, 0.373232, 0.731162, 0.505276, 0.533318, -0.0295321, -0.348715, -0.746767, -0.959115, 0.421484, -0.246539, -0.784326, 0.577966, -0.762483, 0.372931, -0.794102, 0.808647, -0.297966, 0.912293, -0.926746, 0.0355344, 0.270757, -0.94472, 0.692687, 0.843845, 0.900322, -0.00154634, 0.576443, 0.463745, -0.107279, 0.104812, -0.608545, 0.799073, 0.835614, 0.401457, -0.990141, -0.423101, -0.397568, 0.869667, -0.457425, 0.493866, -0.599631, 0.505614, -0.207858, -0.369616, -0.697206, 0.476076, -0.624334, 0.057503, -0.527543, -0.547048, -0.27196, -0.0379775, 0.349777, -0.00210137, 0.796694, -0.336288, 0.953648, -0.613378, 0.165997, 0.176436, 0.0644598, 0.858142, -0.701721, -0.80127, -0.152131, -0.890652, -0.305366, -0.944379, 0.0783073, 0.642596, 0.892384, -0.296668, -0.033233, 0.903978, 0.341615, -0.989119, -0.375768, 0.410303, -0.459572, 0.772759, 0.20001, -0.702762, -0.429838, 0.528484, -0.0938698, -0.231542, -0.691022, 0.47925, 0.4892, -0.421452, 0.735542, -0.541075, 0.783064, -0.591846, 0.709415, 0.323093, 0.338986, 0.652804, 0.720059, 0.537069, 0.466306, -0.0908814, 0.140914, -0.730597, -0.852351, 0.541948, 0.648229, 0.634208, -0.850304, 0.934659, 0.119453, -0.724773, 0.567975, -0.583409, -0.945525, 0.184692, 0.505076, 0.765152, 0.0656068, 0.689348, 0.593714, -0.226664, -0.597993, -0.104609, 0.931922, -0.644074, -0.751025, -0.39558, -0.391498, 0.380953, -0.534993, -0.972162, 0.621588, -0.00557031, 0.505935, -0.19992, 0.392527, -0.663548, -0.455113, 0.113406, -0.172533, -0.793351, -0.718686, -0.550877, 0.56027, -0.422217, -0.36717, 0.470459, 0.343402, -0.476875, 0.233629, -0.486381, 0.539045, 0.665199, -0.202075, 0.995334, -0.345677, -0.751657, 0.802015, 0.00147423, -0.417105, 0.70705, -0.354926, 0.0175204, -0.260871, 0.201924, 0.0092435, 0.353019, 0.286403, 0.582308, -0.730891, 0.413903, 0.843357, 0.259519, 0.0499733, 0.99653, 0.019293, 0.164554, -0.0486075, -0.894947, 0.00828473, -0.480625, 0.813803, 0.746878, 0.835636, 0.891756, 0.162948, 0.329661, -0.294208, -0.0967485, 0.274482, -0.643873, -0.541457, -0.598562, -0.081905, 0.921586, -0.120579, -0.264903, 0.266938, -0.501035, 0.378756, -0.895846, -0.666318, 0.497652, 0.257592, -0.846578, -0.481711, 0.999417, 0.977301, 0.509343, 0.179133, 0.0992323, -0.332658, 0.239167, -0.371982, -0.2936, -0.549398, -0.403382, 0.984876, 0.0888391, -0.316143, -0.432876, -0.632267, 0.710394, 0.413609, 0.0193761, 0.974972, -0.787346, -0.605245, 0.747265, -0.733934, -0.806026, -0.6235, 0.781611, -0.521459, 0.252419, 0.412461, 0.390684, -0.113718, -0.920226, -0.333042, -0.717229, -0.0610078, 0.114618, 0.17165, 0.650023, -0.422791, 0.0705583, -0.315902, -0.202539, 0.524301, -0.102288, 0.320528, -0.345881, -0.0540301, 0.300433, -0.69169, 0.948618, 0.300578, 0.20187, -0.0293486, 0.87571, 0.72521, 0.938682, 0.705811, 0.434122, 0.102525, -0.335236, 0.004774, -0.429788, 0.427173, 0.578735, 0.311915, -0.675029, 0.0149849, -0.134806, -0.652621, -0.617482, 0.494449, -0.350582, 0.610354, -0.861918, 0.447923, -0.733716, 0.392018, -0.905865, 0.919228, -0.491199, 0.757341, 0.839928, -0.177004, -0.19657, 0.29217, -0.601083, -0.17489, -0.483703, -0.276586, -0.759472, -0.682229, 0.627498, -0.0125216, 0.955905, 0.741533, -0.634244, -0.745157, -0.50997, 0.676236, 0.550244, 0.692156, 0.845187, -0.0618611, 0.483438, -0.696974, -0.94216, -0.190108, 0.764277, -0.15489, -0.545221, -0.750281, 0.106348, -0.486504, 0.610941, 0.672788, 0.691177, -0.87619, -0.292373, 0.588568, 0.724667, 0.94247, -0.65841, 0.907683, -0.216214, -0.902434, -0.456341, -0.100565, -0.760305, 0.0308809, -0.143298, 0.145561, -0.406773, -0.206289, -0.242763, -0.119611, -0.30625, 0.941533, -0.934382, 0.122761, 0.734759, 0.147499, -0.364797, -0.764414, -0.424412, 0.899824, -0.298988, -0.815419, -0.41427, -0.91021, -0.462836, 0.249425, 0.711424, -0.265406, -0.172236, 0.795455, 0.00883596, -0.417102, 0.200934, -0.307055, 0.247959, 0.358696, -0.710433, -0.203535, -0.229201, -0.84625, 0.309673, -0.126627, -0.420892, -0.424832, 0.526325, -0.562456, -0.0254398, 0.842577, 0.628364, 0.286612, -0.35422, -0.803159, 0.437942, 0.704364, -0.25893, 0.705495, 0.0254321, -0.985197, 0.405423, -0.827298, -0.996013, 0.86292, -0.106419, -0.704154, 0.116799, -0.30681, -0.799972, 0.138743, 0.552021, -0.00804942, -0.254946, 0.164493, -0.143397, -0.53716, 0.728768, 0.927162, -0.375712, 0.531372, -0.858771, 0.574791, 0.664496, 0.382351, 0.381734, 0.589976, 0.896586, -0.691253, 0.258106, -0.618521, -0.687925, 0.0285356, 0.636118, 0.709248, -0.38862, -0.264682, 0.0459164, 0.34254, -0.354494, 0.894534, 0.391592, 0.676621, 0.74282, 0.76684, 0.822255, 0.548178, 0.918421, -0.462376, 0.417069, -0.516547, -0.0741967, -0.694917, -0.414818, -0.352342, 0.584883, -0.499351, -0.434416, 0.412409, -0.706828, -0.405907, -0.883033, -0.0251987, 0.708342, 0.411009, 0.469208, 0.0801255, -0.744422, -0.753993, -0.0746874, 0.476192, -0.674082, -0.313945, 0.432656, -0.111606, -0.429659, -0.51159, 0.196132, -0.17364, -0.745535, 0.21361, -0.0720927, 0.6335, -0.709809, -0.535148, 0.582824, 0.294498, -0.163797, 0.584763, 0.38899, -0.842931, 0.280698, -0.344804, -0.581018, 0.781191, -0.425756, 0.831798, -0.617919, -0.578386, 0.779462, 0.553913, 0.401216, 0.798568, -0.386135, -0.796955, -0.514293, 0.612451, -0.47814, 0.862637, -0.130153, 0.416327, 0.646562, 0.323034, -0.224915, 0.237223, 0.110861, -0.0304531, -0.569583, 0.627875, -0.627387, 0.141275, -0.234888, 0.389403, -0.80254, 0.218083, -0.923391, 0.463061, 0.75226, -0.680797, -0.241019, -0.239929, -0.297125, 0.91402, 0.76362, -0.817808, 0.888428, -0.426998, 0.153411, 0.30303, -0.146002, -0.503331, 0.511707, 0.833116, -0.759427, -0.402471, -0.0739621, -0.0750693, 0.518856, -0.477134, -0.301629, 0.28634, 0.983336, 0.823684, -0.353758, -0.31817, 0.516222, 0.307666, 0.0576311, -0.641771, -0.693958, 0.328848, -0.761654, -0.5314, -0.441982, 0.645545, 0.175833, -0.223239, -0.421556, 0.470574, 0.728181, -0.289494, -0.22682, -0.705945, -0.813492, 0.328, -0.72013, 0.982878, 0.375908, 0.417955, 0.713029, 0.418846, -0.446982, 0.79285, -0.559542, -0.639011, 0.700883, -0.470609, -0.972107, -0.934905, 0.976793, -0.132235, -0.124616, -0.297699, -0.456903, -0.278198, -0.391379, -0.0407527, 0.672826, 0.912564, -0.385857, 0.293975, 0.260056, -0.209199, -0.367356, -0.946976, -0.606692, -0.394601, 0.913744, -0.902624, 0.624682, -0.755116, -0.416734, 0.56094, -0.930449, -0.0777961, 0.647516, -0.798449, 0.873185, -0.816952, -0.75391, -0.387461, 0.964706, 0.531759, -0.728803, 0.644183, -0.652134, 0.875239, 0.331285, 0.479088, 0.637195, -0.777044, 0.300893, -0.179905, -0.73293, -0.294378, 0.606084, 0.434765, -0.528894, 0.0120549, -0.512388, -0.869017, -0.669847, 0.958894, -0.212445, 0.957489, 0.59232, -0.232163, -0.927204, -0.5974, 0.617108, -0.744534, -0.644343, 0.372558, 0.344528, 0.63601, 0.48015, -0.832253, 0.230235, 0.311627, 0.932829, -0.854649, -0.721422, -0.928622, 0.376666, -0.0996805, -0.0999461, -0.529516, 0.0168329, -0.267297, 0.280974, -0.743467, 0.35802, -0.959306, 0.285114, -0.899419, -0.495609, 0.388025, 0.953944, -0.692459, -0.716308, 0.806481, -0.0978014, -0.603688, 0.85159, 0.540058, -0.130842, 0.383464, -0.201668, -0.384234, 0.269789, 0.496844, -0.425336, -0.909905, 0.688518, 0.691301, -0.83317, 0.577307, -0.823415, 0.564402, 0.694723, 0.228186, -0.556157, -0.718793, 0.350242, 0.976132, -0.841463, 0.443934, -0.963365, -0.400839, -0.427543, 0.816794, 0.395105, 0.544893, 0.151357, -0.0108698, 0.366997, 0.00239983, 0.102112, -0.787011, 0.33966, -0.561135, 0.0169607, -0.111466, -0.799202, -0.933174, -0.520753, 0.584105, 0.841424, 0.80404, 0.583872, -0.104129, 0.82769, -0.133522, -0.922879, 0.572512, -0.315726, 0.575245, -0.958975, 0.802228, -0.894544, 0.230528, 0.904407, 0.708406, -0.944015, 0.151533, -0.184447, -0.539636, -0.904268, -0.927784, 0.442571, -0.643964, -0.305415, -0.0822096, 0.406902, 0.435148, -0.924374, 0.896162, 0.934324, -0.168663, -0.550662, 0.920692, 0.75762, -0.622067, 0.61072, 0.923215, 0.854064, -0.0808943, 0.942052, -0.697259, 0.263919, -0.610948, 0.0461681, 0.563395, 0.696687, -0.575786, 0.40035, 0.0248933, 0.263174, 0.494953, 0.175479, 0.26704, -0.681632, -0.848942, -0.498916, 0.879959, -0.397539, -0.97732, 0.682592, -0.0854583, 0.649538, 0.911422, -0.555472, 0.801091, -0.20576, -0.610417, -0.88797, 0.637742, 0.549921, 0.312631, -0.883294, -0.0499039, -0.998256, 0.284759, 0.660216, -0.151634, -0.83976, 0.404386, 0.307298, -0.426702, -0.988657, -0.047402, -0.148273, 0.264857, -0.0975033, -0.586272, 0.390305, 0.765257, -0.780809, 0.260298, 0.574223, -0.764352, 0.575672, 0.409487, -0.193054, -0.804843, 0.522288, 0.681566, 0.672783, -0.725897, -0.595356, -0.168736, -0.867252, -0.945259, 0.190499, -0.769178, -0.0182475, -0.799372, -0.592774, -0.510506, 0.811747, 0.0600011, 0.0627428, -0.491739, 0.347927, 0.638509, 0.755124, 0.126369, 0.0603177, -0.159599, 0.300011, -0.511667, -0.129282, -0.890509, 0.202054, 0.268217, 0.116447, -0.157433, -0.837692, 0.193889, 0.224977, -0.0101463, 0.998289, 0.804176, -0.925304, 0.137385, -0.156017, -0.827035, 0.721016, -0.762193, -0.81588, 0.182381, -0.0512482, 0.162404, 0.371918, -0.885695, 0.867568, 0.551768, -0.47461, -0.083114, -0.460979, 0.122592, -0.894912, 0.986627, -0.280968, 0.300617, -0.378858, 0.558636, -0.84756, 0.553693, -0.722647, -0.225205, 0.412118, 0.328313, 0.881421, -0.152079, 0.224616, -0.280329, 0.246322, 0.945468, 0.306381, -0.619435, -0.367703, -0.344581, 0.639226, 0.351306, 0.672256, 0.529663, -0.0685905, -0.443135, 0.464809, 0.456792, 0.198282, -0.566557, -0.0959647, -0.933987, 0.249114, -0.398218, -0.88449, 0.629459, -0.335534, 0.853854, -0.437752, 0.0089158, 0.17518, 0.496598, 0.513486, -0.655613, 0.242231, -0.718939, -0.0300937, 0.576007, 0.453494, 0.171089, -0.669591, -0.375141, -0.749544, 0.98976, 0.457628, 0.576083, -0.495147, 0.0604289, 0.945299, -0.769214, 0.80359, 0.830319, 0.419049, 0.432897, 0.029617, 0.115339, -0.61792, -0.725977, 0.756831, -0.378407, 0.225049, 0.507135, 0.819328, -0.131151, 0.372839, -0.425035, -0.31449, 0.0609545, 0.941182, 0.313003, 0.307824, -0.505849, -0.774504, 0.685791, -0.542061, -0.238268, 0.515141, -0.0161889, 0.417169, -0.621476, 0.425265, 0.9161, 0.836223, -0.266284, 0.384747, 0.293834, -0.58232, -0.237612, -0.909706, 0.523305, 0.338115, -0.139347, 0.99763, -0.488624, -0.838042, 0.917721, -0.581664, -0.222967, -0.791114, -0.277619, 0.544341, 0.50842, 0.286807, -0.539456, 0.872568, 0.100526, 0.210726, -0.908829, -0.821751, -0.764872, 0.891435, 0.254481, -0.600444, -0.288446, -0.994481, -0.778203, 0.802639, 0.269722, 0.184494, -0.817582, -0.254713, -0.678306, 0.245536, 0.16931, 0.329993, -0.160268, 0.878381, 0.44701, 0.64428, -0.662374, -0.90265, -0.134572, -0.0822628, 0.75047, -0.425721, 0.92095, -0.665281, 0.345265, -0.818236, -0.970388, -0.289357, -0.0417448, 0.0275235, -0.147986, -0.317447, -0.91215, -0.376842, 0.569989, 0.175049, -0.851837, 0.705478, -0.870436, 0.320322, 0.368483, 0.792029, 0.856057, 0.0964452, -0.907124, -0.712174, -0.858177, -0.918427, 0.869969, 0.486591, -0.493734, 0.73771, 0.952405, 0.308744, 0.393323, 0.150578, -0.946475, 0.970437, -0.497999, 0.591038, 0.485203, -0.945317, 0.331767, -0.955609, 0.438999, 0.59707, -0.866291, 0.701268, -0.145982},
-	{0.335298, -0.36981, -0.943573, -0.384066, -0.996208, -0.88973, 0.576007, 0.15932, -0.48305, 0.794322, -0.419579, 0.456182, 0.612474, 0.590453, -0.422082, 0.643631, -0.354744, 0.355215, 0.0736607, -0.718436, 0.750287, -0.876004, -0.0917124, -0.666091, 0.471839, -0.384789, -0.038161, -0.327041, -0.4251, 0.916378, 0.421411, 0.927784, -0.0584807, -0.484894, 0.227405, -0.7085, -0.871549, 0.325979, 0.0690874, -0.802616, -0.148152, 0.286109, 0.874474, 0.35733, 0.0654108, 0.0926173, -0.581576, 0.678168, -0.698041, -0.748542, 0.40764, -0.812055, -0.413993, -0.230891, -0.137994, 0.964346, -0.0321808, -0.732428, 0.00179301, -0.799329, 0.187223, 0.180554, 0.9419, -0.988516, 0.619674, -0.891654, 0.948942, 0.679049, -0.748329, -0.74082, -0.631109, -0.333842, -0.614496, 0.450522, 0.751751, -0.966906, -0.696371, -0.648571, -0.513209, -0.798678, -0.901605, -0.620975, -0.892894, 0.421094, 0.506863, -0.120561, -0.251556, -0.188788, -0.954539, 0.647803, -0.338965, 0.0574543, 0.209467, -0.235445, 0.305926, -0.624106, 0.183126, 0.238165, -0.772273, 0.974743, -0.83953, -0.103208, -0.145458, 0.382636, -0.57822, 0.961996, -0.444657, 0.221847, -0.155919, -0.554974, 0.748524, -0.0695472, 0.917222, -0.384142, 0.835373, -0.241105, 0.234096, 0.996038, -0.667395, -0.652977, 0.336042, 0.685184, 0.0492178, -0.613692, 0.99578, -0.351605, 0.317817, 0.647092, 0.579046, -0.290031, 0.671076, -0.75116, -0.54125, -0.179421, 0.936139, 0.389618, 0.668682, 0.895178, 0.985141, -0.165306, -0.898191, -0.13694, -0.353711, 0.414472, 0.284834, 0.649748, 0.28711, 0.526254, -0.509654, 0.769177, -0.612525, -0.358087, 0.604676, 0.953018, -0.221611, 0.920203, -0.402114, -0.154729, 0.0738406, 0.6452, 0.1306, -0.276228, 0.961341, 0.0223849, -0.428613, -0.536135, -0.261381, 0.937198, 0.25425, 0.442481, -0.829004, -0.180419, -0.00617169, 0.509977, -0.624085, 0.147246, 0.475436, 0.340115, 0.432916, -0.009047, -0.593827, -0.353989, -0.994876, 0.874631, -0.800518, 0.609479, 0.144079, -0.103727, -0.658186, 0.42804, -0.928461, -0.672171, 0.0185036, 0.737805, -0.711468, 0.221775, -0.483069, -0.557155, -0.373587, -0.531227, -0.0969984, 0.410856, 0.693401, 0.98802, 0.418023, -0.0151139, -0.839902, 0.451119, 0.716541, -0.525728, 0.901203, -0.989641, -0.995081, -0.193484, 0.738181, -0.905599, 0.328032, 0.779444, -0.0125423, 0.683831, -0.86024, -0.108468, 0.320806, 0.453308, -0.462523, 0.358309, -0.30424, 0.857911, 0.858844, -0.0857114, 0.959023, -0.464548, -0.540308, 0.968038, 0.938478, 0.967192, 0.567272, 0.00510575, 0.51407, 0.412757, -0.834831, 0.959474, -0.0663253, -0.148129, 0.689244, 0.959221, -0.135115, -0.397562, 0.522489, 0.893275, -0.985636, 0.045963, -0.522282, 0.966723, 0.636255, 0.989202, -0.822796, 0.703453, 0.708057, -0.554731, -0.700152, 0.624563, 0.0230724, 0.302873, 0.503267, 0.88487, 0.0280063, 0.884172, 0.304726, 0.392226, -0.896016, -0.474229, 0.867107, -0.0686697, 0.172005, -0.274929, -0.391567, -0.320247, -0.578823, 0.462784, 0.0500764, 0.536456, -0.775139, 0.304563, 0.0271326, 0.359789, -0.218388, 0.463932, -0.878437, 0.863436, 0.961056, -0.909439, 0.119764, 0.756416, -0.472163, 0.390348, 0.268804, 0.120383, 0.308408, -0.955433, 0.549285, 0.877231, -0.904784, 0.755775, -0.815643, 0.0874298, -0.979458, 0.373425, 0.621315, -0.104782, 0.99056, -0.606275, -0.0177914, 0.522485, 0.619704, -0.0962845, -0.665916, 0.893775, -0.350502, -0.960011, 0.264336, -0.976475, -0.605287, 0.710565, -0.234065, -0.774618, 0.510093, 0.286458, 0.3262, -0.531289, -0.0243088, -0.234472, 0.495916, -0.285945, 0.172805, -0.816841, -0.520221, 0.449382, 0.549254, 0.89727, 0.0646228, -0.561949, 0.164923, 0.809954, -0.92798, -0.57667, -0.556104, 0.247541, -0.599172, 0.371699, 0.445047, -0.869815, -0.459477, -0.348071, 0.644016, 0.198275, -0.568367, -0.747022, -0.188702, -0.615606, -0.967617, 0.298323, -0.103131, -0.292302, -0.144023, 0.216608, -0.29979, 0.856549, 0.272585, -0.89133, -0.00838383, 0.115201, 0.22806, -0.661586, 0.0940974, -0.693669, 0.961818, 0.48799, -0.757606, 0.16169, -0.500288, 0.523495, -0.304116, 0.46674, 0.659405, 0.999508, -0.141931, 0.182772, -0.0764002, 0.322716, -0.215156, -0.71955, 0.210561, 0.435571, -0.236441, -0.756992, -0.0502362, -0.0842107, 0.475543, -0.608628, -0.882943, -0.372328, 0.841455, 0.705846, -0.758801, -0.623046, 0.468594, -0.454364, -0.991901, -0.599629, -0.388287, -0.489427, 0.716045, -0.0925907, -0.905061, -0.149082, -0.972262, 0.445649, 0.447102, 0.140721, -0.421945, 0.539041, 0.577606, -0.646316, 0.488551, -0.845241, 0.243968, -0.933444, -0.471106, 0.185356, -0.457382, -0.17898, -0.166801, -0.530032, 0.707676, -0.750161, 0.198757, -0.300097, -0.610207, 0.26234, -0.916214, 0.935539, 0.179592, -0.965696, 0.212443, 0.0311707, -0.429277, 0.901307, 0.145516, 0.802771, 0.996349, -0.748016, 0.94647, 0.454384, 0.294322, 0.701891, 0.401569, -0.237188, -0.0280308, -0.323914, -0.740727, 0.215754, 0.919555, -0.844391, 0.465776, -0.219471, -0.44471, 0.387198, 0.839059, 0.426786, 0.202404, -0.698989, 0.965563, -0.10013, 0.76257, 0.853147, 0.0952756, -0.5071, -0.587773, 0.381001, -0.805019, -0.769795, -0.444013, -0.924792, 0.369852, -0.015966, 0.637137, 0.326104, 0.963766, 0.636823, -0.111919, -0.502541, -0.202302, -0.504125, 0.323604, -0.615982, -0.44071, -0.514954, -0.595712, 0.673779, 0.306189, -0.549152, 0.82337, -0.54045, -0.77399, 0.699474, 0.963518, -0.372821, 0.119998, -0.710641, -0.685651, 0.509, -0.709896, -0.0718817, -0.774409, 0.240095, -0.850466, -0.309218, 0.483739, 0.372323, -0.348233, 0.616868, 0.182826, -0.910726, 0.0517013, -0.276464, -0.36684, 0.853975, -0.406052, -0.958596, -0.585236, 0.879333, -0.657906, 0.924381, 0.828142, 0.623423, -0.483096, -0.0904964, 0.694619, 0.620829, -0.515736, -0.0305255, -0.338643, -0.509068, -0.935155, -0.251629, -0.287038, 0.426629, -0.107043, -0.417448, 0.900541, 0.77899, 0.114344, 0.983651, -0.0139891, 0.356829, -0.814047, -0.204878, -0.838408, 0.823111, -0.333199, -0.486643, -0.274597, 0.632606, 0.747166, -0.32163, -0.627174, -0.234168, 0.217792, -0.498331, 0.975985, 0.176765, 0.474107, 0.908026, -0.0346034, -0.842525, -0.312385, -0.959137, 0.881543, 0.424207, -0.347095, -0.421083, 0.63601, 0.739508, 0.622485, -0.517297, 0.103899, 0.976128, -0.207669, -0.824181, -0.165166, 0.739922, 0.252026, 0.0365987, -0.336684, 0.757425, 0.226113, -0.837041, -0.604343, 0.677705, -0.32001, -0.578166, 0.603514, -0.469914, -0.726264, 0.803465, -0.24987, 0.121111, -0.880408, 0.400574, -0.0710943, -0.241652, -0.0714224, -0.0587624, -0.610567, 0.441799, -0.869738, 0.996279, -0.449569, 0.959933, -0.0790579, -0.361471, -0.602664, -0.20641, 0.348995, -0.164367, 0.231475, 0.0245908, 0.923576, -0.462674, -0.678789, 0.0512464, -0.074707, -0.730018, 0.779579, 0.837713, 0.817393, -0.361501, 0.751856, -0.38082, 0.230759, -0.481877, 0.891041, 0.0665917, -0.425301, -0.806629, 0.163064, 0.0273083, -0.715846, 0.997562, -0.491382, -0.817568, -0.48741, 0.398931, -0.559653, -0.973186, -0.153246, -0.272299, 0.59512, -0.472737, -0.473295, -0.758254, 0.304129, -0.0930745, -0.75267, 0.411847, -0.535618, -0.180172, -0.673579, 0.936802, -0.853218, -0.75578, -0.797859, -0.897635, -0.402913, -0.104149, -0.301505, 0.649753, 0.132793, 0.730135, -0.128279, -0.507911, 0.594456, 0.318953, -0.0751186, 0.130153, 0.11419, 0.630346, -0.968293, -0.538462, -0.40357, 0.219755, 0.858593, 0.139079, 0.571108, 0.352388, 0.0976905, 0.185551, 0.251249, -0.203365, 0.979705, 0.138855, -0.322177, -0.431027, 0.623155, -0.309588, 0.50463, 0.261059, 0.822478, -0.400655, 0.520659, 0.49861, -0.219566, 0.329676, -0.428085, -0.0189066, 0.0310076, 0.982572, -0.175896, 0.559132, 0.121864, -0.999049, 0.248346, -0.212201, 0.396038, -0.407705, 0.285446, -0.0101793, -0.356742, 0.555218, -0.641767, 0.578101, 0.226133, -0.113133, -0.0307653, 0.00745323, 0.0711324, 0.222962, 0.539023, -0.928076, 0.492546, 0.780454, -0.627537, -0.851586, -0.0204287, -0.429239, 0.561612, 0.0911942, 0.395719, 0.129548, 0.125721, -0.769514, 0.870863, 0.960746, -0.866605, -0.860069, 0.514271, -0.647858, 0.310303, -0.9749, 0.690165, 0.542224, -0.814256, -0.0146512, 0.197656, -0.760725, 0.945758, -0.131657, 0.793166, -0.353742, 0.445983, -0.104114, 0.389089, 0.655435, 0.579461, -0.887773, -0.964997, 0.285924, -0.798217, -0.613339, -0.872618, 0.764809, 0.845158, -0.28638, 0.222568, 0.813603, 0.0895951, 0.546619, 0.0878813, -0.783339, -0.805754, 0.550285, 0.166137, 0.845637, 0.978612, -0.914389, 0.765371, -0.322018, -0.783394, 0.990748, -0.77978, -0.404964, 0.55661, 0.655662, -0.820548, -0.270067, 0.447366, -0.361336, 0.998866, -0.699092, -0.756118, -0.58078, 0.12514, -0.817401, 0.556192, -0.640667, -0.891627, 0.0546507, 0.23797, 0.00233041, 0.945511, 0.346213, 0.749518, 0.889441, -0.0570465, -0.908406, -0.922931, -0.510458, 0.333853, -0.0976327, 0.894774, -0.592621, 0.637965, 0.644074, 0.521388, -0.632497, -0.00176677, 0.375165, -0.353726, -0.309057, 0.935263, 0.889811, -0.179227, 0.858169, -0.946035, -0.0472453, 0.75051, -0.771953, 0.890998, 0.384643, -0.658224, 0.674281, 0.637687, -0.443258, -0.96459, -0.444226, 0.599978, 0.27106, 0.157892, -0.331379, 0.143835, -0.0325335, 0.970167, 0.716167, -0.668273, 0.0796114, -0.847515, -0.505665, 0.34434, 0.501931, -0.505447, 0.488377, 0.737073, 0.976888, 0.929386, -0.180869, -0.00160759, 0.303471, 0.252017, 0.228641, -0.154811, 0.867006, 0.387443, -0.0660965, 0.700396, 0.6956, -0.665522, -0.646718, 0.396117, -0.882319, 0.151844, -0.391704, 0.237853, -0.131346, -0.632858, 0.458568, 0.0141857, 0.865966, -0.485394, -0.517779, -0.979064, -0.297071, 0.84284, -0.85363, -0.733939, -0.405139, -0.325375, -0.276702, 0.619419, 0.863611, -0.749395, -0.26663, 0.998477, 0.0977523, 0.252973, -0.608104, -0.774956, 0.740981, -0.705727, -0.321179, 0.515021, 0.251844, -0.69874, -0.631414, -0.218809, -0.209538, 0.231295, 0.865605, 0.185939, 0.215729, -0.827323, -0.830141, 0.201529, -0.604045, 0.843927, -0.976227, -0.196916, -0.0598109, 0.297678, 0.457312, -0.0583142, -0.0864594, 0.157686, 0.903595, 0.181336, 0.911834, 0.621453, -0.341809, -0.782945, 0.426724, 0.404549, 0.662507, 0.671762, 0.528152, -0.722671, -0.516051, 0.463371, 0.15084, -0.765857, -0.868237, -0.758374, -0.962157, 0.560924, 0.58257, 0.56917, 0.748145, -0.696549, 0.261545, 0.709344, 0.34756, 0.496361, 0.597518, 0.994758, 0.419545, -0.891599, 0.597444, 0.978908, -0.671686, 0.877691, 0.656802, -0.408052, -0.439103, -0.490694, 0.656742, -0.308381, -0.396642, 0.945401, -0.675381, -0.630201, 0.561616, -0.572274, 0.566271, 0.185509, -0.932918, -0.334284, -0.736326, -0.797047, 0.910223, 0.617232, -0.164797, 0.0976639, -0.598722, -0.905496, 0.189017, 0.757393, -0.21834, 0.463598, -0.550031, 0.20052, 0.0343153, 0.363917, -0.376708, 0.693096, -0.915886, 0.0578294, -0.805027, -0.0821459, 0.0347113, -0.242677, 0.174435, -0.224104, 0.587626, -0.834966, 0.933267, 0.736117, -0.485623, -0.58278, -0.103141, -0.948765, -0.887909, 0.487853, -0.566718, -0.438057, -0.375508, -0.747312, 0.555003, -0.186071, -0.356424, 0.883509, 0.188277, 0.179889, -0.759063, 0.947034, -0.883262, -0.274087, 0.604284, 0.285038, 0.490049, -0.258804, 0.6902, -0.753634, -0.912193, 0.739052, -0.963501, 0.53842, 0.878584, -0.0428944, 0.456701, -0.590369, 0.97749, 0.529003, 0.589436, 0.227173, 0.0636425, -0.356708, 0.60878, -0.882985, 0.181616, -0.635209, -0.341291, 0.718992, -0.0482298, -0.489538, 0.221351, -0.458461, 0.999291, -0.784521, -0.489689, 0.676106, -0.0473029, -0.817384, -0.889555, -0.111298, 0.0633686, 0.807592, 0.53749, 0.627843, 0.539849, 0.61861, -0.826175, 0.858124, -0.786682, -0.697427, -0.440343, 0.480302, -0.156079, 0.51895, -0.503383, 0.00528135, 0.950753, 0.918983, -0.699851, 0.691452, 0.754462, -0.10289, -0.150753, -0.586175, 0.547336, -0.930411, -0.242379, -0.185095, 0.385062, 0.534039, 0.606832, -0.0515479, 0.596285, 0.144475, 0.670413, 0.697582, -0.738877, 0.995474, -0.0418223, -0.793054, -0.345325, -0.0646406, -0.409492, -0.10942, 0.757073, -0.781493, -0.838716, 0.569435, 0.248915, -0.231946, 0.87598, -0.0760812, 0.38617, 0.612808, -0.998405, -0.181059, -0.165601, 0.931375, 0.0486295, 0.32934, 0.843141, 0.717477, -0.380995, -0.320312, -0.645519, -0.248492, 0.959641, 0.634162, 0.592944, -0.482355, -0.139288, -0.267786, -0.0272354, -0.899324, 0.639969, -0.797748, -0.583352, -0.605559, -0.301271, -0.131108, 0.587138, 0.304583, -0.754458, 0.624993, -0.743529, -0.878217, -0.40342, -0.73169, 0.748712, 0.640486, 0.296188, 0.256014, -0.0398067, 0.907232, 0.834296, -0.527228, -0.973893, 0.140895, 0.384336, 0.440813, -0.722131, 0.381233, 0.177065, 0.859543, -0.615484, -0.437921, 0.198684, -0.24904, -0.233351, 0.718769, -0.908282, 0.951641, -0.800138, 0.641276, 0.381937, 0.81728, -0.54509, -0.951624, -0.577649, -0.360405, -0.63341, 0.205566, -0.532824, -0.718789, 0.955474, -0.582101, -0.208211, -0.0149571, -0.290391, -0.246879, 0.0728775, 0.133432, -0.256828, 0.713838, -0.582442, 0.252472, 0.784105, 0.0228549, -0.814953, 0.348456, 0.10812, -0.449457, -0.392556, 0.277244, 0.617956, 0.519564, 0.281243, 0.188007, -0.580397, 0.816575, -0.893271, 0.0694291, -0.122986, 0.0379459, -0.0891308, -0.585543, -0.518029, -0.763054, 0.918245, 0.828609, 0.781251, 0.761388, 0.376583, -0.466599, -0.323886, 0.213214, -0.856789, 0.875508, 0.957297, -0.394231, 0.225917, 0.526801, 0.0122261, 0.591878, 0.672849, 0.0352235, -0.351679, -0.311432, 0.133821, -0.552142, -0.0339856, -0.361099, 0.134267, 0.749868, -0.930059, 0.684002, 0.349416, -0.876062, -0.0993127, 0.838994, -0.3857, 0.412553, 0.878062, -0.106878, -0.448068, -0.916231, -0.526027, -0.986038, -0.242134, -0.922698, 0.349879, -0.05182, 0.446634, -0.2869, 0.33301, 0.0063746, 0.574688, 0.699865, -0.596653, -0.739152, -0.457558, -0.499093, 0.274802, 0.677688, -0.367353, 0.507599, -0.0475274, 0.953915, 0.464031, 0.823451, 0.767184, -0.900597, 0.22921, 0.977824, -0.351409, 0.534861, -0.569076, 0.766754, -0.671609, -0.652872, -0.86539, 0.343879, 0.692171, 0.379757, -0.295065, 0.352132, -0.528191, -0.590756, 0.307386, -0.315269, -0.367364, -0.814949, 0.383163, -0.076136, 0.611324, 0.0864764, 0.566663, -0.371634, 0.0257524, 0.266989, 0.249471, 0.112335, 0.599584, -0.91439, 0.243381, 0.137604, -0.760495, 0.701701, -0.67509, 0.310607, 0.761359, 0.115609, -0.931602, 0.367247, 0.731391, 0.116478, 0.0271383, -0.500537, 0.745444, 0.205076, -0.759936, -0.395898, 0.731234, -0.420569, -0.411556, -0.966635, 0.806107, 0.306094, 0.368893, -0.164267, -0.0173126, 0.147571, -0.95508, -0.921605, 0.215406, 0.0603438, 0.6256, 0.303599, 0.707181, 0.892936, 0.246042, 0.0877943, -0.175983, 0.84095, -0.182822, 0.59781, 0.688002, 0.617778, -0.342273, 0.229835, 0.457208, 0.178983, 0.357836, 0.889089, 0.494541, -0.142211, 0.468758, -0.677802, -0.0423304, -0.837912, -0.274945, -0.768804, 0.286851, 0.90063, 0.179275, -0.721575, 0.168703, -0.147358, 0.360337, 0.120665, 0.894897, -0.829643, -0.462651, 0.552497, -0.936701, 0.831947, 0.48854, -0.623457, -0.0923676, 0.10706, -0.783066, 0.60171, -0.598973, -0.418374, 0.243006, 0.0548289, 0.056036, 0.135013, 0.319569, -0.219814, 0.766481, 0.175173, 0.843499, -0.265026, -0.865471, 0.284415, 0.503923, 0.956426, 0.785562, -0.847628, 0.47392, -0.76573, -0.0840358, 0.830253, 0.104121, 0.561278, -0.840649, -0.832954, -0.33437, 0.708175, -0.531094, -0.298036, -0.511546, -0.357949, -0.669771, 0.732351, -0.0966176, 0.778077, -0.668996, -0.292043, 0.622019, 0.317437, 0.843726, -0.531846, -0.254995, 0.786438, -0.719301, 0.603095, -0.00250523, -0.421034, 0.739105, 0.81314, 0.0134745, -0.642412, -0.935627, -0.165654, 0.69232, -0.237227, -0.158497, -0.829882, -0.00773127, 0.605963, 0.630544, -0.796633, 0.423438, 0.992654, -0.644283, 0.579776, 0.296237, 0.511445, -0.717237, 0.0140776, 0.665883, -0.53191, -0.839682, 0.989074, -0.00789418, -0.782691, -0.311214, -0.208724, 0.832095, 0.188558, -0.713444, 0.667794, 0.661799, 0.0378503, 0.0245555, 0.570129, 0.687349, -0.559746, 0.217725, -0.882692, -0.157742, 0.158455, -0.0729969, 0.693048, -0.318878, -0.977356, 0.539005, 0.510287, -0.277299, -0.110794, -0.876916, -0.261125, 0.764218, 0.108758, -0.124763, 0.0980598, 0.519459, -0.182326, 0.907186, -0.68326, -0.313046, 0.906827, 0.712399, -0.0725664, -0.100635, -0.447625, 0.401733, -0.720071, 0.952917, 0.232342, 0.128986, 0.642034, 0.909019, 0.391623, 0.316888, -0.968933, -0.499551, 0.0411039, 0.630502, -0.60275, -0.774157, 0.482075, 0.0811065, 0.652596, -0.856193, 0.241862, -0.787555, -0.544388, 0.738803, -0.639715, -0.451785, -0.906418, 0.921533, 0.479449, 0.817855, -0.642622, -0.479244, -0.877899, 0.904156, 0.22421, 0.85198, 0.214357, -0.718362, -0.416761, 0.162484, -0.207286, -0.0545521, -0.497012, -0.545065, -0.235151, 0.619568, 0.878831, 0.452939, -0.436635, -0.7998, -0.830586, 0.830971, 0.0217886, 0.681429, 0.462873, 0.676848, 0.952909, -0.883282, 0.750073, -0.669653, -0.731285, -0.765051, 0.638893, -0.588822, -0.583729, 0.924844, -0.0452738, -0.321526, 0.669594, 0.280994, 0.481622, 0.571437, -0.0148943, -0.786989, 0.404716, -0.431461, 0.16252, -0.389807, -0.65599, -0.486292, -0.6941, -0.116413, -0.704178, 0.743602, -0.299377, -0.759562, 0.868281, 0.210599, 0.706073, -0.693809, 0.834663, 0.355321, 0.420278, 0.0933249, 0.510946, -0.838513, 0.045827, -0.44605, 0.204485, 0.956281, -0.054331, 0.447068, -0.241048, -0.373814, 0.670343, 0.639915, -0.834004, -0.115343, 0.838501, 0.0637276, 0.139646, -0.191909, -0.437373, 0.110516, 0.176119, -0.387041, 0.823493, 0.649699, 0.388587, -0.944931, 0.989078, -0.105177, -0.709516, -0.0387, -0.788183, 0.242176, -0.971308, 0.104233, 0.67618, -0.987434, -0.187609, -0.502594, 0.736706, 0.534746, 0.870645, -0.978049, -0.586621, -0.367693, -0.321356, 0.132192, -0.165301, 0.224407, 0.130619, 0.258068, 0.226062, -0.621015, -0.198816, 0.929527, 0.336126, -0.274398, 0.688858, 0.486069, -0.682265, 0.533891, -0.455719, -0.172952, 0.972552, 0.258933, -0.812408, 0.971222, 0.779649, 0.215125, 0.0396805, 0.74165, 0.927431, -0.947322, 0.834897, 0.504059, 0.271182, 0.654647, -0.658012, 0.426018, 0.108021, -0.0969007, -0.277845, 0.62535, -0.742506, -0.932505, -0.920037, 0.342142, -0.424358, 0.219603, 0.461292, 0.354324, 0.741187, -0.494449, -0.762032, -0.774994, 0.14403, 0.468355, -0.774752, 0.774304, -0.912853, 0.405741, -0.389033, 0.502745, -0.056457, -0.893344, -0.371028, -0.531121, 0.595352, 0.920757, -0.461777, -0.381362, -0.352623, -0.804882, 0.980196, 0.416631, -0.0563958, -0.723046, -0.408695, -0.22202, -0.932864, 0.776914, 0.202098, -0.970955, -0.81729, -0.071032, -0.801524, 0.870621, -0.536142, -0.197389, -0.274485, 0.0941299, -0.0429684, -0.286146, -0.12617, -0.88307, 0.158763, -0.776039, 0.425268, -0.370451, -0.607824, 0.391525, 0.662887, 0.711182, 0.517846, -0.854652, 0.314038, -0.16133, -0.553082, 0.714375, -0.261128, -0.0286382, 0.808154, 0.684054, 0.921641, 0.871029, 0.0106122, 0.471673, 0.821111, 0.259192, 0.784025, 0.572611, 0.108579, 0.620388, 0.368255, -0.381443, 0.822942, 0.227854, -0.181721, 0.237129, -0.519449, -0.0319892, 0.0615288, -0.905875, 0.319726, -0.686943, -0.625012, -0.734713, 0.274159, -0.0125739, -0.436141, 0.761504, -0.369404, -0.906993, 0.525819, 0.283026, 0.15932, -0.621192, -0.306027, -0.243674, -0.150815, -0.709295, 0.565685, -0.554803, -0.591949, -0.808436, 0.561848, 0.802183, 0.156984, -0.626842, 0.895195, -0.232143, 0.0422636, 0.481727, -0.60032, -0.220152, -0.0690243, 0.713017, 0.632101, -0.958057, 0.0101606, -0.986795, -0.448835, 0.634268, 0.0412152, 0.450938, -0.192804, 0.525386, 0.317129, -0.604331, 0.268898, -0.591163, -0.108254, -0.344636, 0.377855, -0.0642212, -0.658259, -0.376787, 0.588489, 0.244015, 0.194772, 0.997148, 0.0939287, 0.406584, -0.183258, 0.49512, 0.764472, -0.211689, 0.278162, 0.244375, 0.415029, -0.00751435, 0.340547, -0.175361, -0.835532, -0.122624, 0.827259, 0.31287, -0.70618, -0.451965, -0.697965, 0.516712, 0.224937, -0.159709, 0.561966, -0.565218, 0.645892, 0.767757, 0.989356, -0.512146, -0.131966, -0.529621, 0.80677, -0.68522, -0.729092, 0.484502, 0.596724, 0.485813, 0.0853955, -0.199899, -0.0290929, 0.506202, 0.874465, -0.616889, 0.378188, -0.737419, 0.459022, -0.822874, -0.408455, 0.634443, 0.312514, -0.91623, -0.119922, -0.723129, 0.0411479, -0.767035, -0.435516, -0.189692, 0.413493, 0.843269, -0.206905, 0.850252, -0.934244, 0.723478, -0.904757, -0.49606, -0.270906, -0.139646, 0.717119, -0.206075, 0.234898, 0.649972, 0.631544, 0.797989, -0.420773, -0.234564, 0.612151, -0.482729, -0.694358, -0.567548, 0.84684, -0.148866, 0.477454, -0.2507, 0.396474, 0.173059, -0.548216, 0.254356, 0.131027, -0.26131, -0.599145, 0.763324, 0.851314, -0.551219, 0.243991, 0.374969, 0.965575, 0.878387, 0.844526, -0.262014, 0.955352, 0.75546, 0.85085, -0.129514, 0.525207, -0.819236, -0.955326, -0.547166, 0.38262, 0.930266, 0.93079, 0.346367, -0.994951, 0.866036, -0.662485, -0.492547, 0.72498, -0.540021, 0.0713014, -0.0336061, 0.465236, -0.718779, 0.0258252, 0.376662, 0.733986, 0.821231, 0.269121, 0.359969, 0.91204, 0.372512, 0.981853, -0.859506, 0.468903, 0.589648, 0.727133, 0.240794, -0.333352, -0.269135, 0.112767, 0.649122, 0.918768, 0.704455, -0.977765, -0.438591, -0.877936, -0.448984, -0.94943, 0.604749, 0.106674, -0.820734, 0.184794, 0.273134, 0.590501, 0.887311, -0.15708, -0.77369, 0.0086984, 0.0150167, 0.578891, -0.480024, -0.906303, 0.437006, -0.0985019, 0.567242, -0.0657634, 0.508842, 0.127454, 0.388068, 0.0153794, -0.711058, -0.298347, -0.179782, -0.380394, 0.425806, 0.186009, -0.633673, 0.917824, -0.83535, 0.895377, -0.442988, 0.251438, -0.369214, -0.393615, -0.86403, 0.359828, -0.486222, -0.0232862, -0.948763, -0.411973, -0.498222, -0.0402153, 0.250509, -0.26403, 0.812315, 0.0318222, 0.0515697, -0.649543, -0.545446, 0.0137883, -0.189638, 0.449594, 0.991595, -0.760016, -0.438984, 0.197791, 0.000289961, 0.58944, -0.559497, -0.67453, 0.824739, 0.367023, 0.398449, -0.795937, 0.753764, -0.658227, 0.155619, -0.197513, 0.407349, -0.607242, -0.974469, -0.0514943, -0.188189, -0.054573, -0.484271, 0.323673, -0.890477, 0.212384, 0.589466, 0.400065, -0.615203, 0.265337, -0.0181316, -0.881209, 0.490533, -0.996612, -0.228232, -0.775353, 0.895878, -0.799743, -0.256626, 0.864414, 0.503825, -0.0998221, 0.975075, 0.869785, 0.278162, 0.0856633, -0.249775, 0.585351, 0.696083, -0.232387, 0.238102, -0.540722, 0.0402633, -0.0601035, -0.261237, 0.81933, 0.261583, 0.00495527, -0.343218, 0.229236, 0.0963608, -0.629537, -0.460803, 0.149461, 0.0998036, 0.591222, 0.655803, 0.815363, 0.773031, -0.569217, 0.0738227, 0.880751, 0.751226, -0.517662, -0.221443, 0.584607, 0.702208, 0.269478, -0.984909, -0.738325, -0.521736, 0.521568, 0.221082, -0.430451, 0.454564, 0.517745, -0.671238, -0.172782, -0.73857, 0.177684, -0.00814212, 0.23241, 0.538647, -0.00515075, -0.491148, 0.0174312, 0.565567, -0.947539, -0.365148, -0.761405, -0.728734, 0.932737, 0.140575, -0.627184, 0.546499, -0.625583, -0.23949, -0.293746, -0.933465, 0.317346, 0.0755328, 0.944242, -0.884273, 0.515067, -0.5574, -0.520448, -0.539655, -0.765478, -0.97246, 0.291399, 0.836769, 0.113889, -0.949633, -0.98024, 0.519379, -0.701167, -0.451514, 0.347421, -0.859119, 0.674215, -0.372668, -0.282231, -0.0408129, -0.387393, 0.23759, -0.0248135, 0.701029, -0.735814, -0.561018, -0.480234, 0.00543796, -0.0413078, -0.243433, -0.396795, 0.55025, -0.921122, -0.228217, -0.728122, 0.456977, -0.116665, 0.452081, -0.839966, 0.724652, 0.158452, 0.878143, 0.215862, 0.768025, -0.40882, 0.146493, -0.339315, 0.916692, 0.558019, -0.0415833, -0.335694, -0.557105, 0.924031, 0.736142, -0.271447, 0.958196, 0.242918, -0.553361, -0.342703, -0.223444, -0.218082, -0.585603, 0.657895, 0.263138, -0.640205, 0.261451, -0.495252, 0.86895, 0.659961, 0.21248, -0.520891, -0.683711, 0.493104, 0.91372, -0.443031, 0.918079, 0.847882, -0.434996, -0.795693, -0.0462418, -0.282605, 0.171419, 0.712158, 0.579545, 0.631071, -0.507523, -0.770411, 0.879556, -0.454019, -0.146788, 0.168735, -0.181598, -0.757049, -0.976261, -0.999548, -0.368368, 0.600457, 0.0155634, -0.769317, 0.285706, -0.394922, -0.751666, -0.711257, -0.153049, 0.202606, -0.900351, 0.173522, 0.127356, -0.247899, -0.544779, -0.071002, -0.222556, 0.336363, 0.989632, -0.784092, 0.410621, 0.771883, 0.808529, 0.0686999, 0.481973, -0.330403, 0.244933, -0.104982, 0.1136, 0.00491262, -0.28713, 0.0725242, 0.675554, 0.568955, -0.812448, -0.590112, -0.901852, 0.602829, 0.194902, 0.191488, -0.01798, 0.195997, 0.637455, 0.310775, 0.621669, 0.434018, -0.190625, -0.772355, 0.156415, 0.924296, 0.901633, 0.210744, 0.355905, 0.133832, -0.437294, -0.430824, -0.176175, -0.939504, -0.716367, 0.174734, -0.986868, 0.84688, -0.566649, 0.593732, 0.117903, -0.83026, 0.787708, -0.924183, 0.498502, 0.597505, -0.434533, -0.706439, -0.310427, 0.176325, 0.529258, 0.709619, -0.453982, -0.610799, -0.434005, -0.979177, -0.582095, -0.420427, -0.0886733, -0.203819, -0.812379, -0.126375, -0.47636, -0.293572, 0.797455, 0.537205, -0.585348, -0.669501, 0.5342, -0.0565913, 0.59036, 0.791894, -0.889307, -0.838609, -0.697179, -0.810178, -0.388426, -0.0268392, -0.836399, 0.220333, 0.130945, -0.170852, -0.851651, -0.662003, 0.198602, -0.640209, 0.801863, -0.28458, -0.62593, -0.708306, 0.183221, -0.513377, 0.413572, -0.751139, 0.478272, 0.738602, 0.115013, -0.0351086, 0.429591, 0.809363, 0.729369, 0.629305, 0.974728, 0.246448, 0.890998, -0.467018, 0.491279, 0.094145, 0.292643, 0.627605, 0.0562614, -0.252069, 0.626223, -0.897851, 0.327172, 0.98287, 0.00138332, 0.376104, -0.208373, -0.391955, -0.452201, -0.987791, -0.522535, 0.381057, -0.298458, 0.211804, 0.994177, 0.675713, -0.287226, -0.90021, -0.700521, 0.105847, 0.64331, -0.508992, 0.756576, -0.13397, -0.160787, 0.982017, -0.710114, 0.561346, 0.387717, 0.941613, -0.756318, -0.977374, -0.769422, -0.251497, 0.179631, 0.514886, -0.513855, 0.627494, -0.759255, -0.396233, 0.158859, 0.982783, 0.583928, 0.218239, -0.194324, 0.106193, -0.513056, 0.308254, -0.823465, -0.931614, 0.519508, 0.519911, 0.529985, -0.776391, -0.926695, 0.952989, 0.272087, 0.134919, -0.981743, -0.364216, 0.953332, -0.844753, -0.34965, 0.364389, -0.0245067, 0.731336, 0.940712, -0.467263, 0.269404, 0.525509, 0.253548, -0.409367, 0.683787, 0.664615, -0.219606, 0.261126, -0.264987, 0.565787, 0.382561, -0.0304178, -0.735287, 0.123593, -0.34331, 0.299807, 0.757493, -0.0594524, 0.637824, -0.724844, -0.523348, -0.0145311, 0.346, 0.103351, -0.960854, 0.278582, 0.102425, -0.191116, 0.912816, 0.601993, -0.939353, 0.366254, 0.244526, 0.373956, -0.820507, -0.0976718, 0.116158, -0.0071301, 0.295848, 0.70146, -0.799867, 0.55958, 0.807972, -0.0918983, 0.51446, -0.0768182, -0.188621, 0.348687, -0.660147, -0.0862079, 0.913761, -0.187544, -0.50771, -0.0214237, -0.757888, 0.0640509, -0.826495, 0.45221, 0.124367, 0.468701, 0.539131, 0.391019, 0.491171, 0.331291, -0.882909, 0.401261, -0.242696, 0.966899, 0.884373, -0.149596, 0.958744, -0.381657, 0.373554, -0.196787, 0.55878, -0.0125055, 0.296916, -0.483002, -0.380244, -0.544835, -0.0396794, -0.0166302, -0.540883, -0.110761, -0.886401, 0.12835, -0.00729491, -0.966585, 0.211669, 0.873996, 0.538703, 0.298287, -0.0243628, -0.808269, 0.170242, -0.185094, -0.857341, -0.466523, 0.401726, 0.0393247, -0.422346, 0.470844, -0.153071, 0.637135, -0.799371, -0.387583, -0.396369, -0.0672442, 0.239444, -0.289324, 0.869649, 0.390921, 0.238603, -0.0218103, 0.794695, -0.162559, 0.640407, 0.714293, 0.0673437, -0.17503, -0.700381, -0.317447, -0.711423, 0.0452865, -0.0922705, 0.293852, 0.647554, 0.98866, 0.91066, -0.466333, 0.569855, -0.783601, 0.598871, 0.803695, -0.762094, -0.247747, -0.676152, -0.0362958, 0.699712, 0.817542, -0.889217, -0.898504, -0.552988, 0.826129, -0.145252, -0.840204, -0.328209, 0.326053, 0.961556, 0.509535, 0.494007, 0.464699, -0.34228, 0.769361, 0.989283, 0.194502, -0.206071, 0.776156, -0.000221584, -0.358231, -0.837458, -0.859157, -0.221003, 0.789713, -0.233554, 0.590118, 0.0440627, -0.135289, 0.813766, -0.986133, -0.818014, -0.918022, -0.707137, 0.147351, -0.181703, -0.462539, -0.681329, 0.723533, -0.938921, 0.238227, 0.0682482, 0.630021, -0.509155, -0.0481568, 0.12891, 0.745825, -0.48008, 0.123687, -0.246953, 0.596286, -0.497201, 0.0131843, 0.236645, 0.633534, -0.215993, 0.858395, -0.554781, -0.163419, -0.482562, -0.223958, 0.40165, -0.518358, -0.121375, 0.597142, 0.0766767, -0.531349, -0.777371, 0.321868, 0.679462, 0.376262, -0.982909, -0.841658, -0.89182, 0.0998808, 0.10428, 0.40021, -0.558997, -0.283646, -0.380836, 0.511768, -0.191381, 0.0265754, -0.94464, -0.634494, -0.646237, 0.795776, 0.913419, 0.377299, 0.0755494, -0.389479, 0.00931928, 0.332392, 0.429153, -0.1962, -0.827516, -0.994793, -0.252914, -0.822599, -0.263602, 0.00270188, -0.671648, 0.134617, 0.894607, 0.985266, 0.801725, 0.180387, 0.722722, -0.275674, -0.516402, 0.66553, -0.22301, 0.860012, -0.351914, -0.859575, 0.0735957, 0.474351, 0.0064578, -0.145482, 0.0436563, -0.0927914, -0.284877, -0.354917, -0.778585, -0.628916, -0.927712, 0.301444, 0.685687, -0.064901, 0.381016, 0.301937, -0.470776, 0.0407857, 0.164558, 0.732834, 0.673421, -0.1304, 0.810398, -0.811041, -0.235287, 0.917323, -0.961484, -0.87075, 0.649012, -0.0800102, -0.746836, 0.749714, 0.898831, -0.58643, -0.576263, 0.712785, -0.0984314},
-	{-0.858713, 0.252516, 0.356053, 0.10201, -0.275769, -0.59345, 0.976774, -0.394727, -0.29268, -0.900682, -0.172503, 0.9689, 0.674897, -0.368493, -0.231365, -0.742317, -0.568368, 0.807684, 0.0921819, 0.302376, -0.839802, 0.0918481, 0.169404, -0.759339, 0.523583, 0.118399, 0.500394, 0.00104315, -0.347911, 0.168385, 0.923292, 0.630013, 0.423944, 0.30792, -0.817493, 0.0753707, -0.910919, -0.204587, 0.363636, 0.088328, 0.925973, 0.849919, 0.307362, 0.197762, -0.0724599, 0.937021, -0.848253, -0.587949, -0.78692, -0.558871, -0.953363, 0.0849392, -0.949994, -0.0493319, -0.762779, 0.451479, -0.0791323, -0.759045, -0.657662, 0.00239586, 0.16755, -0.668286, 0.272203, 0.493249, 0.327629, -0.363952, -0.273065, -0.814824, -0.89283, -0.906575, 0.538938, -0.966606, -0.533407, -0.442058, 0.951289, -0.110669, -0.291503, 0.443965, -0.0176095, 0.98916, 0.725406, 0.227937, -0.0761354, 0.67916, -0.276197, 0.849373, -0.114812, -0.0229452, 0.414508, 0.328189, -0.0158472, 0.830465, -0.759159, -0.872831, 0.591895, 0.0800768, 0.698485, 0.902229, -0.976425, 0.718101, -0.959579, -0.491544, 0.707006, -0.0345127, -0.172094, 0.079456, 0.572734, -0.703661, 0.227374, -0.31404, 0.199037, 0.293351, 0.867156, 0.844371, 0.750583, 0.0589186, -0.0681215, -0.677922, -0.631575, -0.192279, 0.357526, 0.131837, 0.412672, -0.544286, 0.946433, 0.734178, 0.635391, 0.647406, -0.275193, 0.639527, 0.793756, 0.228429, -0.382554, 0.378408, -0.406105, 0.18594, -0.406995, 0.736426, 0.304531, -0.775241, 0.797142, 0.9992, -0.86635, -0.9139, 0.668071, 0.904235, -0.524704, 0.96264, 0.106604, 0.95014, -0.948638, 0.100788, -0.44827, 0.916477, -0.499077, -0.00476502, 0.0569442, 0.689209, -0.438925, 0.663919, 0.0626322, 0.789552, -0.0907771, 0.401951, -0.932289, 0.146206, -0.924437, 0.434307, -0.612496, 0.426111, -0.412599, 0.965972, 0.605548, -0.0384019, 0.292162, 0.963968, -0.353694, 0.602239, 0.724849, 0.39748, -0.353476, -0.174787, -0.848877, 0.743139, -0.747831, -0.724053, 0.96351, 0.210744, 0.721111, -0.932882, 0.232217, -0.3642, 0.901142, 0.505415, 0.127103, 0.0230348, 0.71656, 0.951553, 0.898762, -0.625496, 0.222806, -0.761377, -0.433979, 0.81953, -0.274582, 0.37212, -0.317429, -0.174367, 0.295002, 0.782933, 0.118887, -0.572935, 0.0873629, -0.674182, 0.907271, -0.0492879, 0.345198, -0.0479166, -0.592708, 0.562597, -0.226476, 0.303298, -0.00332042, 0.727816, 0.0635113, 0.879373, 0.486591, -0.446322, -0.819561, 0.651315, 0.336176, 0.162485, -0.287339, -0.597514, 0.646719, -0.638942, -0.0266924, -0.466625, 0.559738, -0.165105, -0.398648, -0.1067, 0.544626, -0.311925, 0.123241, -0.641118, 0.736288, -0.112221, -0.236702, -0.325581, -0.552825, -0.750849, 0.477585, -0.905714, -0.00858632, -0.734672, -0.517393, -0.393999, 0.530818, 0.790228, 0.0872013, 0.984507, 0.346843, 0.00848722, -0.312903, -0.000740066, -0.621716, 0.288948, -0.352604, -0.0244973, -0.0409965, 0.947329, -0.399247, -0.0848328, -0.0616544, -0.626276, -0.0365152, 0.178659, -0.432422, -0.817186, -0.932474, -0.643961, -0.657425, 0.757805, 0.620706, -0.971848, 0.431248, 0.793199, 0.71688, -0.132904, 0.637862, 0.503618, 0.43632, 0.346195, -0.954491, -0.392985, -0.621676, 0.432566, -0.488117, -0.146531, -0.165834, 0.912907, 0.843232, -0.383924, -0.400462, -0.506583, 0.153796, -0.067117, -0.11307, -0.302145, -0.731697, -0.342499, -0.999608, -0.0600522, -0.364772, 0.418268, 0.984657, 0.908626, 0.679342, 0.0487966, -0.943514, -0.772381, 0.986837, -0.289687, 0.856072, -0.669047, -0.655856, 0.940756, 0.0109103, -0.00703917, 0.502522, 0.511857, -0.158689, -0.845121, 0.84588, 0.321913, 0.0410967, -0.469362, 0.517515, 0.393168, 0.650404, -0.95622, -0.727822, 0.588888, -0.994221, 0.577402, -0.636081, -0.572906, 0.972694, 0.0508667, 0.51316, -0.935867, 0.175674, -0.769038, 0.295938, 0.675666, 0.851872, -0.604079, 0.679128, -0.392747, -0.828574, -0.79681, 0.65822, -0.625052, -0.517404, 0.258944, 0.625548, 0.397006, 0.878733, -0.663173, -0.0395021, -0.0188164, 0.718134, 0.123893, -0.0351172, 0.210587, -0.656602, -0.31921, 0.252009, -0.358917, 0.668626, -0.185702, 0.447241, -0.44922, 0.732884, 0.765125, -0.812301, 0.246334, -0.47696, 0.931526, 0.565782, 0.676135, -0.451433, 0.305772, 0.0798135, -0.565289, 0.609366, 0.642706, -0.317161, 0.217667, -0.806588, -0.571519, -0.0599681, 0.0503214, 0.398056, 0.382887, 0.406505, -0.953421, 0.265852, 0.823676, -0.293018, 0.00836239, -0.407455, 0.0824982, 0.589187, -0.0421115, -0.12525, 0.867163, -0.450444, -0.826192, -0.166835, 0.326453, 0.999393, 0.133328, 0.053171, 0.128184, 0.0503316, -0.145548, -0.0795567, -0.690997, 0.902494, 0.925218, 0.815869, 0.22348, -0.467391, 0.14204, -0.387237, 0.346414, 0.454867, -0.285255, 0.144814, -0.545026, 0.300359, -0.605263, -0.444202, -0.706362, 0.474306, -0.958059, 0.987376, 0.669126, -0.942655, 0.46953, -0.875685, -0.387641, 0.689279, -0.294831, 0.111894, 0.824813, -0.836876, 0.993182, -0.278284, -0.472287, 0.891616, -0.0962475, 0.373558, 0.288786, 0.719286, -0.0666613, -0.321167, -0.771948, -0.789359, 0.284547, 0.537756, 0.671932, 0.568626, 0.833831, 0.995003, -0.744856, -0.930515, 0.613099, 0.416645, -0.330143, -0.00306081, 0.916317, 0.302997, -0.474567, -0.505531, 0.634717, 0.502167, 0.498866, 0.950164, 0.509672, 0.352862, -0.341567, -0.886787, 0.441924, 0.123241, 0.470775, 0.263313, -0.10053, -0.127579, 0.60052, -0.364954, -0.396685, -0.933812, 0.889171, -0.312369, 0.208263, -0.231706, -0.511899, -0.575273, -0.563258, 0.0814166, -0.931272, -0.889553, -0.751955, -0.320296, -0.109, -0.557523, -0.017578, -0.97967, -0.860621, 0.513167, -0.211613, -0.0144587, 0.488982, 0.251755, 0.662342, -0.362008, 0.285638, 0.332786, -0.274219, -0.866209, 0.971094, -0.583167, 0.908585, 0.443276, -0.911495, -0.307954, 0.896439, -0.276509, 0.910905, -0.635996, 0.281207, 0.0868373, -0.985452, 0.933155, -0.15181, -0.92128, 0.919102, -0.409167, -0.826077, 0.952259, 0.451292, -0.320614, -0.0260379, -0.539594, 0.703692, -0.699536, 0.485786, 0.846126, 0.921493, -0.348531, -0.175448, 0.35692, 0.262734, 0.549527, -0.410296, -0.594063, -0.476672, -0.308308, -0.346977, 0.93583, -0.955866, 0.0572478, 0.127072, 0.276906, 0.164285, 0.791502, 0.6213, -0.0627648, 0.924089, -0.141737, 0.324061, 0.709859, -0.445068, -0.587691, -0.243037, 0.853757, 0.614708, 0.75326, 0.230387, -0.313004, -0.744595, -0.736809, 0.772535, 0.421187, 0.229966, 0.198104, 0.0120175, -0.600911, -0.556824, 0.955596, 0.668154, 0.0747322, -0.842303, 0.138182, -0.566301, -0.841807, 0.557793, -0.90761, -0.947014, -0.79921, -0.100036, -0.535104, -0.665332, -0.141936, -0.354698, 0.810186, -0.432927, 0.973749, -0.592345, -0.973634, 0.417993, 0.450347, 0.244284, 0.632208, 0.307166, -0.865027, -0.932615, 0.641136, -0.311489, -0.258178, 0.359767, -0.254084, -0.0294945, 0.726997, 0.0261237, -0.669944, -0.221857, -0.664364, -0.624284, -0.373321, -0.497639, 0.897805, 0.664778, -0.240719, -0.660856, 0.0792241, -0.472022, 0.519096, 0.378203, -0.823102, 0.372704, -0.479281, -0.86889, -0.0220032, 0.5148, -0.441092, -0.3789, 0.453252, -0.621409, 0.258817, 0.730154, 0.613329, -0.739499, -0.816294, 0.53111, -0.130766, 0.50964, 0.197336, -0.554767, 0.127937, -0.0422161, 0.0649246, -0.589232, -0.259322, 0.481575, 0.552676, -0.661136, -0.122118, 0.28121, -0.212034, 0.213738, 0.541522, 0.721769, -0.986128, 0.840705, -0.105138, 0.310576, 0.617185, -0.924124, 0.0408613, -0.271779, 0.782947, -0.911626, -0.0671017, 0.781159, 0.931159, 0.39991, -0.275937, -0.358995, -0.756657, -0.225478, -0.196936, -0.0234706, -0.492866, 0.846164, 0.902713, -0.0687783, 0.503486, 0.675551, 0.0269713, -0.525627, -0.761195, -0.268684, -0.333666, 0.585807, -0.905855, 0.389533, -0.535856, -0.0653807, 0.303178, 0.566833, -0.894267, 0.767544, 0.493359, -0.357922, -0.624737, 0.484017, -0.623483, 0.0835891, 0.495489, -0.265165, -0.58375, 0.743734, -0.718955, -0.462701, -0.531347, -0.723538, -0.0402169, 0.918454, 0.974793, -0.5223, 0.405515, 0.568074, -0.0293897, -0.029577, -0.666783, -0.95699, 0.413486, -0.0882735, 0.62728, -0.500043, -0.162587, -0.827805, -0.21305, -0.306986, -0.687123, 0.707882, 0.85299, 0.627017, -0.690145, -0.527061, -0.832473, -0.642083, 0.532879, 0.686553, 0.0196656, -0.921673, 0.129218, -0.0874855, -0.578112, -0.284001, -0.491185, -0.349259, 0.367652, -0.00635072, -0.422428, -0.726602, 0.511315, -0.649268, -0.534733, -0.0647708, 0.184498, 0.581657, -0.00317211, 0.848693, -0.576235, -0.432859, -0.333795, -0.579854, -0.427498, 0.0736097, 0.4216, 0.60063, 0.674946, -0.0679411, 0.694222, -0.878106, 0.174121, 0.478571, 0.238705, 0.782096, -0.223142, 0.952137, 0.701549, 0.729361, 0.0477618, 0.922551, -0.314953, -0.916304, 0.24886, 0.349386, 0.272598, -0.640636, 0.116598, 0.528683, -0.752111, -0.91929, -0.730147, -0.114828, 0.55141, -0.705714, 0.647029, 0.496686, 0.227997, -0.859851, 0.150306, -0.491162, -0.890168, -0.875601, 0.0602529, -0.810008, 0.927288, 0.806258, -0.730495, 0.632714, -0.831274, 0.915005, 0.371608, -0.157341, -0.141717, 0.577439, -0.613928, 0.430715, -0.633129, 0.374428, -0.569655, -0.431845, 0.603032, -0.824648, -0.518417, 0.417705, 0.498062, 0.661244, -0.417133, 0.8815, -0.114053, -0.52921, -0.396337, 0.521874, 0.050347, -0.224052, 0.382087, 0.317291, 0.284774, 0.327999, -0.676093, -0.472803, -0.860688, 0.340941, 0.820679, -0.63512, 0.403165, -0.585769, -0.292878, -0.758937, -0.961254, -0.0821678, -0.20409, 0.811597, 0.312602, -0.584012, -0.716268, 0.302449, -0.583084, -0.708148, -0.722386, -0.823695, 0.998463, -0.27496, 0.926986, -0.46121, -0.233159, 0.585012, -0.754239, -0.237103, -0.764477, -0.185376, -0.159626, 0.396476, -0.69654, 0.482811, 0.457016, 0.462787, -0.862485, -0.501612, 0.314618, -0.707763, 0.759587, -0.311155, 0.397773, 0.343556, -0.503985, -0.620353, -0.928633, -0.417411, -0.102174, -0.782502, 0.836201, -0.285691, -0.182058, 0.697698, 0.859256, 0.442321, -0.751619, -0.972835, 0.553614, -0.726036, -0.755799, -0.205402, -0.278773, 0.848903, -0.288078, 0.109961, -0.485281, 0.833273, -0.24273, 0.159259, 0.804291, -0.916419, 0.375187, 0.485151, 0.495897, -0.788482, -0.979531, 0.799096, -0.0872273, -0.952308, 0.186586, 0.368307, -0.427892, 0.874367, 0.653422, -0.115599, -0.945925, 0.689152, 0.0524246, 0.355487, -0.625688, -0.94679, -0.45123, -0.120153, -0.686773, -0.620408, 0.0963379, 0.395882, 0.403386, -0.444145, 0.388138, 0.523052, -0.451808, -0.573732, -0.0255447, -0.370375, 0.933853, 0.878496, 0.625658, -0.307606, -0.506455, 0.918047, -0.248644, 0.46495, -0.378953, 0.782817, -0.218998, -0.225394, -0.185334, -0.46365, -0.51786, -0.131095, -0.895181, 0.469306, -0.949584, -0.643954, 0.218767, 0.780837, -0.318025, -0.0546816, -0.177611, -0.535019, -0.659248, -0.208987, -0.635779, -0.612797, 0.776952, -0.687974, 0.203624, -0.31129, -0.0368515, 0.805372, 0.0106264, 0.711788, 0.474674, 0.593044, -0.0467713, 0.292001, -0.91398, 0.405992, -0.820659, -0.343207, -0.563501, -0.621591, 0.185105, 0.576519, 0.576125, -0.784954, 0.299829, 0.0807607, -0.057417, 0.839462, 0.978662, 0.290604, -0.347202, -0.407188, 0.25366, 0.13226, -0.844816, -0.0250022, -0.369147, -0.952899, 0.953655, -0.166091, -0.579567, -0.740324, 0.90251, 0.0993478, -0.279434, 0.562893, 0.473686, -0.0138197, 0.808487, -0.234344, -0.255079, 0.718702, -0.596642, -0.756627, -0.259458, -0.894283, 0.245495, 0.691232, -0.254633, 0.722063, 0.410316, 0.191121, -0.276443, -0.602151, -0.0929225, -0.337367, 0.909106, -0.0281889, 0.0699576, -0.0528394, 0.543186, 0.208338, -0.735987, -0.440352, -0.1069, -0.721787, -0.506023, -0.791814, 0.913668, 0.939057, -0.684438, -0.240565, -0.511131, -0.592509, 0.170796, -0.160743, 0.939425, 0.956718, -0.447945, 0.733496, -0.335414, -0.240819, 0.133466, 0.318829, 0.710762, -0.222266, 0.94268, -0.96918, -0.168258, -0.287489, 0.114037, -0.956971, -0.760821, -0.66265, -0.362006, -0.897765, -0.843101, 0.460379, -0.0441677, -0.294332, -0.716994, -0.546783, 0.802526, -0.461084, -0.53756, 0.576665, 0.57894, -0.792921, 0.358148, -0.8953, 0.654438, -0.748293, -0.0604217, -0.631278, 0.803105, 0.89932, 0.414761, 0.765368, -0.786707, 0.588835, -0.552057, 0.308504, 0.263067, -0.607503, -0.285862, -0.628037, -0.423545, 0.268428, 0.656317, 0.368376, 0.919334, 0.557955, -0.755589, -0.580673, -0.370689, 0.00475532, -0.462085, 0.969404, -0.254763, 0.672317, -0.841798, -0.92335, -0.228115, -0.541075, -0.56073, 0.642437, 0.503895, -0.84418, -0.233561, -0.137916, -0.978487, 0.0143584, 0.0742237, 0.0785232, -0.165308, -0.401266, 0.640327, -0.116098, -0.953589, 0.951565, -0.356172, -0.88892, -0.893854, 0.338588, 0.65047, 0.548456, -0.0132131, -0.698318, 0.35111, 0.0154014, 0.862737, 0.0590843, 0.670018, 0.691062, 0.292722, 0.494152, 0.168463, -0.158868, 0.538789, -0.694056, -0.897858, 0.759558, -0.214506, 0.696903, -0.357577, -0.839154, -0.0659367, 0.520286, -0.569627, -0.733641, 0.00901457, 0.200848, -0.91917, -0.707053, 0.45208, 0.31266, 0.357175, -0.853673, -0.825423, 0.497969, -0.732914, 0.500779, -0.35593, -0.859862, -0.269209, 0.853447, 0.483971, 0.798804, -0.16712, -0.614803, 0.646852, -0.344856, -0.252853, 0.258739, 0.0123142, 0.734904, 0.285584, -0.64286, -0.304763, -0.467779, -0.589165, 0.113854, 0.468468, 0.542044, -0.109183, 0.230063, -0.84045, 0.624782, -0.476575, -0.382957, -0.0785179, 0.848798, -0.267841, 0.0540762, -0.937595, -0.349978, 0.224963, 0.0988766, 0.901015, -0.740038, 0.17577, 0.895847, -0.135343, -0.671737, -0.647271, 0.500802, 0.704317, 0.0842048, 0.424176, 0.87802, -0.564849, -0.920865, -0.228611, 0.642036, -0.0683383, -0.416522, -0.771132, 0.0222396, -0.885721, 0.60125, -0.766396, -0.21538, 0.41429, 0.17474, -0.319049, -0.433066, -0.473346, 0.643773, 0.675962, 0.744455, 0.938038, 0.222446, -0.21114, -0.445441, -0.969949, -0.164808, 0.340196, 0.773259, 0.112001, -0.250129, 0.0476712, -0.963103, 0.836531, -0.39236, -0.175915, 0.29245, -0.188818, 0.745665, 0.797286, -0.0639605, -0.0969021, 0.594535, -0.141311, -0.656674, -0.0251412, 0.203269, -0.0987039, 0.592515, -0.388938, 0.972169, 0.735346, -0.864627, -0.687857, 0.325314, 0.626, 0.884355, -0.321083, -0.28921, 0.938656, 0.466972, -0.321295, -0.618027, -0.0881352, 0.30115, -0.580794, -0.891711, 0.116508, 0.617599, 0.74422, 0.139065, 0.950445, 0.467585, 0.433448, -0.163001, -0.0620579, 0.932619, 0.0159852, 0.00843427, 0.100267, -0.293067, 0.64111, -0.716893, -0.902591, 0.447892, -0.895953, -0.525126, 0.169627, 0.766524, 0.213594, -0.26398, 0.248588, -0.677503, 0.0665484, 0.914097, 0.543873, 0.262758, 0.57598, -0.428619, -0.22121, 0.904943, 0.906473, 0.370922, -0.174722, 0.251284, 0.751922, -0.342942, 0.577814, -0.0565605, 0.390625, 0.314016, 0.0813648, -0.069245, -0.586861, -0.334956, 0.0541503, -0.384244, -0.649552, 0.601183, 0.641256, 0.989615, -0.645597, 0.900213, 0.487923, 0.236432, 0.0404994, 0.511597, -0.241837, -0.431682, -0.300434, 0.243581, -0.248536, -0.464251, 0.802393, -0.944521, 0.439007, -0.479133, 0.829612, -0.2477, 0.0507361, 0.66741, 0.720817, 0.543518, 0.830579, -0.27984, 0.36333, -0.527961, 0.280413, 0.917122, -0.96976, -0.667272, -0.567608, 0.128437, -0.281054, 0.766071, 0.857815, -0.716116, -0.604802, 0.136203, 0.529129, -0.711618, -0.937039, -0.773259, -0.274605, 0.401935, -0.28525, 0.992593, -0.68718, 0.154723, -0.179457, -0.59448, 0.765603, -0.0874622, 0.585572, 0.671729, -0.962449, 0.295649, -0.859072, -0.887055, 0.0542209, 0.487243, 0.90344, -0.303514, -0.895144, 0.706848, 0.311567, -0.481041, -0.455935, 0.84244, -0.727038, -0.391151, 0.812938, 0.844904, 0.033523, -0.835056, -0.879397, -0.540754, -0.264498, 0.949598, 0.677601, -0.450498, 0.0360389, 0.990371, -0.486153, 0.179386, 0.766195, 0.743906, -0.594899, -0.626982, 0.446448, -0.432079, 0.905427, -0.203084, 0.124849, 0.1459, -0.567546, -0.34586, 0.0242903, 0.131882, 0.111515, -0.0534673, 0.751476, -0.808509, -0.572231, -0.134812, 0.328019, -0.301291, 0.726833, -0.515901, 0.175496, -0.00357654, -0.646234, 0.0239316, -0.275608, -0.0599152, -0.288393, 0.975714, -0.378953, -0.52441, -0.400199, 0.286743, 0.445062, -0.0542845, 0.419598, 0.250878, 0.471749, 0.953245, 0.28522, 0.776196, 0.764916, -0.720255, 0.602606, 0.67579, -0.691557, 0.248885, -0.27998, -0.608997, 0.661927, -0.317501, -0.42387, -0.654936, -0.326942, 0.195522, -0.228762, -0.100391, -0.41595, -0.190154, 0.948077, 0.139934, -0.964202, -0.165214, 0.76785, 0.95273, 0.37806, 0.87379, 0.791682, 0.876115, -0.763811, 0.292774, -0.156751, -0.145813, -0.0387245, 0.0516457, -0.46203, 0.696304, 0.404922, -0.758309, -0.240486, 0.706063, -0.121106, -0.325598, 0.439486, 0.0433327, -0.685071, -0.942642, 0.81575, 0.150134, -0.57723, 0.36702, 0.280445, -0.577046, -0.383632, 0.738077, 0.77708, 0.788739, 0.100651, 0.190351, -0.0458225, -0.66093, 0.109673, -0.718445, 0.613426, 0.220625, -0.444948, -0.896228, 0.198011, -0.138861, -0.802162, -0.476321, -0.785174, -0.16538, -0.962688, -0.0396624, 0.455505, -0.565576, -0.650641, 0.507176, -0.681937, -0.728778, 0.615839, 0.549928, -0.0469932, -0.654232, 0.457794, -0.68871, 0.489363, 0.635372, 0.773265, -0.2744, -0.480463, -0.0581253, 0.929623, -0.200439, 0.995223, 0.921932, 0.499072, -0.719353, -0.593357, 0.550386, 0.70642, -0.637548, -0.49958, -0.0500469, 0.400836, 0.1981, -0.358412, -0.63265, -0.841596, 0.203766, -0.37645, 0.298304, -0.508105, -0.61376, 0.026897, 0.937817, -0.29578, 0.847209, -0.0742714, 0.754835, -0.24338, -0.756817, -0.878062, -0.654183, -0.735827, -0.313959, -0.25025, 0.256245, -0.500586, 0.339977, 0.66142, 0.0535797, -0.13992, 0.49979, -0.791218, -0.609477, 0.845688, 0.266165, -0.256178, -0.529772, -0.999432, -0.563697, -0.231166, -0.409111, -0.704671, -0.711179, 0.00393645, -0.955797, 0.193024, -0.649379, 0.351685, 0.363897, 0.275131, -0.418681, 0.152768, 0.756405, -0.186318, -0.671247, 0.277784, -0.582865, -0.43984, -0.906721, 0.26621, 0.667935, 0.162994, -0.36415, -0.146738, 0.0916475, 0.0116526, -0.13537, -0.197373, 0.939139, 0.82834, 0.751878, 0.497209, 0.766778, -0.662943, 0.792954, 0.252277, -0.933097, -0.244306, 0.0707006, 0.0561062, 0.651932, 0.539707, 0.483807, -0.274819, -0.946998, -0.72156, -0.445413, -0.378721, -0.593764, -0.849583, 0.643555, 0.988044, -0.576054, 0.741642, -0.89788, -0.417479, 0.430228, -0.398554, -0.297374, -0.67746, 0.121071, -0.987554, -0.701251, 0.394345, 0.80931, 0.892881, -0.879588, -0.989963, -0.731842, -0.859297, 0.148269, 0.040712, 0.165044, -0.0891062, 0.41461, -0.533589, -0.14855, 0.187404, 0.458021, -0.221351, -0.626167, -0.637595, 0.825682, -0.421991, 0.244403, -0.276722, 0.62454, 0.945873, -0.740284, -0.355365, 0.602127, 0.568083, -0.350644, -0.738224, 0.249492, 0.84243, 0.91188, -0.114196, 0.307776, 0.619291, 0.721147, -0.621743, 0.579227, 0.265353, 0.638738, -0.511351, -0.819179, -0.816521, 0.760011, 0.947516, 0.141373, -0.724852, -0.863377, 0.0676159, -0.109821, -0.560149, -0.708305, -0.460232, -0.575456, -0.406613, -0.799434, -0.212154, -0.610699, -0.965316, -0.679998, -0.86698, -0.147683, -0.262138, -0.160647, 0.460223, -0.0127195, -0.214719, 0.240474, 0.512892, 0.00398828, 0.622677, 0.835511, 0.550165, -0.16479, 0.993882, 0.562436, 0.878551, 0.405233, 0.821402, -0.0622894, -0.977986, 0.310214, 0.234012, 0.687282, -0.272734, 0.763418, -0.90465, -0.801591, -0.794421, 0.0313957, 0.653385, 0.377768, -0.639807, -0.303655, -0.188233, -0.962414, 0.0347794, 0.835567, -0.284592, -0.428477, -0.0778666, 0.251449, 0.725695, 0.197331, -0.371479, -0.193999, 0.428147, 0.957073, 0.423723, -0.239254, 0.949154, 0.996994, -0.54401, 0.781304, 0.712477, -0.993576, 0.732819, -0.0903279, 0.361387, -0.216965, 0.432487, -0.320812, 0.937455, -0.0261821, -0.993167, 0.71667, -0.419028, 0.379217, -0.608157, -0.324015, -0.0493736, 0.885802, 0.0300508, -0.331774, -0.230275, 0.373509, 0.201832, 0.704992, 0.465258, -0.892714, 0.972703, -0.348749, -0.900382, -0.976807, 0.0563808, 0.832818, -0.138047, -0.391074, 0.287279, 0.222425, -0.604639, -0.334787, 0.811805, -0.695821, 0.185309, -0.393069, -0.400466, 0.372013, -0.362595, -0.478148, -0.209529, 0.358448, -0.217215, -0.410184, -0.946492, -0.782208, 0.178442, -0.382517, -0.566463, 0.152776, 0.73235, -0.369858, -0.0785861, -0.658297, 0.324692, 0.0415917, -0.189136, -0.262156, 0.0220427, -0.504048, 0.693027, 0.287022, -0.491658, -0.759535, 0.364834, -0.918981, 0.895517, -0.809639, -0.118426, -0.609194, 0.916498, -0.527197, 0.260032, -0.112294, 0.0395691, 0.257348, -0.706245, -0.579094, -0.951054, 0.120887, 0.716826, -0.00669433, 0.876025, -0.723168, 0.55626, 0.0270422, -0.52998, -0.375883, 0.400992, 0.887874, -0.463744, 0.0142117, 0.191206, -0.991564, 0.742998, 0.5292, -0.631811, -0.490731, -0.504471, -0.343761, -0.00102903, 0.405237, 0.788782, -0.179665, -0.676539, -0.15655, -0.784326, -0.130296, 0.185011, 0.586948, -0.240026, 0.835078, -0.0823572, 0.699645, 0.303722, -0.676366, -0.459428, 0.311268, 0.930293, -0.745852, 0.0993212, 0.979499, 0.722164, 0.364642, 0.607527, 0.227414, -0.640217, -0.13323, 0.550294, -0.638084, 0.448195, -0.931102, 0.245319, 0.188017, -0.0500473, 0.0849021, 0.312636, 0.101397, 0.107119, 0.642587, 0.761663, 0.764413, -0.374981, 0.0413325, 0.465915, -0.930095, -0.019179, 0.574973, -0.0545586, -0.567189, 0.998309, 0.861252, -0.382503, 0.37024, 0.0585965, -0.520568, -0.802892, -0.30434, -0.450029, -0.551791, -0.0542304, -0.456593, 0.606599, -0.883828, 0.730932, 0.190706, -0.87955, 0.654288, -0.173365, -0.756537, 0.876498, 0.899369, -0.476167, -0.226598, 0.0184299, -0.909522, 0.107975, 0.837243, -0.668315, 0.312054, -0.382674, -0.359599, 0.972086, -0.792356, 0.609144, 0.786745, 0.72598, -0.9332, -0.9914, 0.867623, 0.875919, -0.651254, 0.739192, 0.0565856, 0.0131317, -0.78646, 0.982435, 0.998535, -0.628658, -0.158353, 0.112291, -0.594769, -0.597096, -0.997584, 0.25197, -0.612895, -0.925239, -0.470415, -0.0443271, 0.0298532, 0.735077, -0.910946, 0.419769, 0.561312, 0.888229, 0.126083, -0.0647036, -0.0155104, 0.367358, 0.634964, 0.108226, 0.208874, 0.418427, -0.0613768, -0.69257, -0.962047, 0.195181, -0.360972, 0.580805, -0.00172271, 0.176653, -0.988078, 0.331605, -0.634164, -0.209059, -0.0535995, -0.0973554, -0.641048, 0.812394, -0.8608, 0.406448, -0.479111, 0.489046, 0.924862, 0.505546, 0.561421, 0.879277, -0.898931, 0.11491, -0.546398, 0.540902, 0.285188, -0.448932, 0.431171, 0.681356, 0.00443468, -0.363971, -0.566101, -0.869302, 0.0431413, 0.0159839, -0.345379, -0.0102752, -0.144976, 0.836713, -0.437076, 0.390368, 0.0688177, 0.812428, -0.478363, 0.650319, -0.975358, -0.244612, 0.691712, 0.459745, 0.853772, 0.852989, 0.76836, 0.673053, -0.123501, 0.0351458, -0.379507, 0.899663, -0.565087, -0.711337, -0.61761, 0.606523, -0.723897, -0.711807, -0.133847, 0.563998, -0.540541, -0.619432, 0.244281, 0.996238, 0.868767, 0.974088, 0.654674, -0.120254, 0.149169, -0.808746, 0.44869, 0.214662, -0.0677689, 0.126359, 0.0789357, 0.948522, -0.927272, -0.437247, -0.937218, -0.686074, -0.70914, 0.31701, -0.950982, -0.824346, 0.181235, -0.506823, 0.904909, 0.15254, -0.652013, -0.829913, -0.113449, -0.454962, 0.452537, 0.714009, 0.629369, 0.951934, 0.862707, -0.758654, -0.716233, 0.473649, -0.39474, -0.0189344, -0.374495, 0.493806, -0.965829, -0.646455, -0.407201, -0.129485, 0.850544, 0.881381, -0.913785, -0.418871, 0.788242, -0.0108533, -0.29987, -0.877915, -0.478137, 0.322455, 0.553116, -0.943905, -0.561423, 0.763989, 0.0934797, -0.863313, -0.744544, 0.121485, 0.220559, 0.951738, -0.202217, 0.860999, 0.467701, -0.24533, -0.698664, -0.054929, 0.831811, 0.0251437, 0.460293, 0.641991, 0.911969, -0.441441, 0.269848, -0.199854, 0.775594, -0.385719, -0.708265, -0.340467, 0.672968, 0.379603, 0.712744, 0.477268, -0.679346, -0.236855, 0.280188, 0.549801, 0.483995, 0.024019, 0.518905, -0.0732928, -0.703769, -0.825362, 0.210908, 0.0322575, 0.218528, 0.0250315, 0.726041, 0.106982, 0.0524898, -0.296281, 0.166784, 0.360472, -0.626726, -0.680432, -0.646589, 0.420501, -0.042055, -0.373858, -0.217765, 0.321993, 0.95334, 0.375526, 0.903797, 0.605149, -0.323758, -0.448154, -0.796975, -0.206128, 0.513237, 0.262121, 0.470782, 0.852958, -0.644919, 0.424388, 0.0404535, 0.971264, -0.1619, -0.42775, -0.80832, 0.842381, -0.899006, -0.0693949, -0.691763, 0.207486, 0.718629, -0.749169, 0.120749, 0.697114, -0.321627, -0.345206, -0.371955, 0.715401, 0.755441, -0.770658, 0.0583875, 0.0590583, 0.118829, 0.119163, 0.439606, -0.75587, -0.366705, 0.455789, -0.683939, 0.124647, -0.205449, -0.901047, 0.641665, 0.588013, 0.156511, 0.0540047, -0.345533, 0.52284, -0.191324, -0.138627, -0.296207, 0.406045, 0.347461, 0.981379, -0.633314, -0.0360088, 0.809372, 0.37033, -0.922992, 0.608225, 0.416924, 0.141378, -0.017311, -0.617202, -0.366334, -0.027436, -0.860345, -0.835804, -0.472886, 0.474935, 0.665656, 0.900716, -0.199679, -0.438851, 0.0540377, -0.388781, 0.464467, -0.961086, 0.271825, 0.396074, -0.677706, -0.413389, -0.27619, 0.733973, -0.363926, 0.784443, 0.863564, -0.917109, 0.648112, -0.620671, -0.071876, 0.580125, -0.662495, -0.250044, -0.225016, 0.801373, 0.875396, -0.0159326, -0.634074, 0.818084, 0.827906, 0.574926, 0.850174, -0.728538, -0.762343, 0.0838487, -0.161234, 0.0738051, -0.189781, -0.167328, 0.320456, -0.691031, -0.411488, 0.178778, -0.248639, -0.473028, -0.805884, 0.666799, 0.0620778, -0.0245453, -0.755921, 0.0617164, 0.689322, -0.684926, -0.39507, -0.0582547, 0.966887, 0.0816597, 0.661522, -0.809166, -0.0100116, -0.669596, -0.0344447, -0.671972, -0.836422, -0.286816, -0.957343, -0.726611, -0.418779, -0.256424, 0.139571, -0.441208, 0.666558, -0.894664, -0.31968, -0.745088, -0.802252, 0.12643, 0.165328, -0.00690314, 0.429442, 0.613793, 0.464966, 0.227575, 0.10037, 0.627995, -0.118844, -0.551216, 0.883003, -0.775767, 0.72367, -0.0666748, -0.214, -0.817672, 0.498267, -0.470866, -0.775275, -0.063616, 0.548185, 0.558863, -0.446628, -0.417849, -0.222643, -0.738465, 0.182906, 0.519464, 0.59281, -0.520137, 0.945081, 0.219413, 0.567594, 0.580909, -0.200554, -0.545656, -0.775833, 0.186609, -0.499519, -0.340236, -0.263625, 0.00152947, 0.96523, 0.175661, 0.768347, 0.426887, 0.306122, 0.210864, -0.0825107, -0.21173, 0.0100633, -0.02795, 0.881185, 0.566524, 0.587801, -0.0418768, -0.596135, -0.584935, 0.593601, 0.419843, -0.14757, 0.764111, 0.0593991, -0.569438, -0.771475, -0.731221, -0.566806, 0.151021, 0.243377, -0.285932, -0.393787, 0.703917, 0.577356, 0.690768, 0.335493, -0.136354, 0.661566, -0.619187, 0.810791, -0.87805, -0.713285, -0.67912, 0.0874192, 0.746473, -0.641714, -0.746361, 0.152121, 0.0112996, -0.11187, -0.00592313, -0.945588, -0.92241, -0.605593, 0.71224, 0.14447, 0.643797, 0.931309, 0.267235, 0.0623509, -0.431331, -0.312395, 0.834867, 0.700556, 0.943197, 0.540089, 0.0352707, -0.3222, 0.306447, -0.656455, 0.598827, -0.553356, 0.23627, -0.305451, 0.574631, 0.0376581, -0.655237, -0.320486, -0.883939, 0.962951, -0.341897, 0.22119, -0.345986, 0.346035, 0.0359885, 0.444981, 0.791061, 0.188936, -0.862181, 0.415077, 0.395987, -0.664524, 0.592138, -0.889533, -0.790306, 0.777467, 0.304146, -0.277077, 0.981918, 0.555546, 0.1391, -0.169663, -0.966115, -0.126644, 0.237271, -0.593109, -0.00972946, 0.0138214, 0.544444, -0.593578, 0.347791, 0.776203, 0.326002, 0.173809, 0.855317, 0.244052, 0.523504, 0.615359, 0.0293984, 0.468428, -0.0200717, -0.110565, -0.0291706, -0.0200742, 0.0655708, -0.0153421, -0.231365, 0.346749, 0.341492, 0.685805, 0.0853341, 0.0745548, 0.271536, 0.698603, -0.381156, 0.805129, 0.242951, 0.306178, -0.989616, -0.0415005, -0.814711, 0.187259, -0.176559, 0.401324, -0.988195, 0.586651, -0.931373, 0.0972346, 0.0821708, -0.841921, -0.107251, 0.241828, 0.723861, 0.396009, -0.0550785, -0.555313, 0.680832, 0.0856607, 0.455182, 0.0776091, -0.405722, -0.534196, -0.646925, -0.051664, 0.243697, -0.719134, 0.222731, -0.286865, -0.328722, 0.235329, -0.849126, 0.291057, -0.0625573, -0.415764, -0.87814, -0.795458, -0.671026, 0.0446627, -0.293947, -0.422447, -0.346974, -0.694165, -0.360005, 0.88368, -0.420641, -0.489976, 0.91975, -0.946961, 0.571897, -0.382302, -0.140367, 0.636438, 0.349962, 0.833623, 0.305567, -0.873743, -0.206365, -0.178782, -0.895624, 0.467655, 0.73897, -0.75433, 0.879929, -0.806208, 0.90407, -0.192208, -0.00584805, -0.909717, 0.763357, 0.519964, 0.718183, 0.478813, 0.516115, 0.995751, 0.796726, -0.343908, 0.338017, -0.440677, -0.468352, 0.692649, 0.987849, -0.873435, 0.843322, -0.421546, -0.523251, 0.690432, -0.128194, 0.248619, 0.790293, 0.904095, 0.92057, -0.426943, 0.213108, 0.574734, -0.659624, 0.102681, 0.86562, 0.0437308, 0.724155, -0.896827, 0.102656, 0.640905, 0.700991, 0.0272517, 0.0436218, -0.841283, -0.773388, -0.334918, 0.605239, 0.279468, 0.694787, 0.802336, -0.961693, 0.272843, -0.455533, 0.438474, 0.611316, 0.135194, -0.915679, -0.677354, -0.198207, 0.559643, -0.369659, 0.980401, 0.51596, 0.72712, 0.469842, -0.647914, -0.941826, -0.746275, -0.561529, -0.0714797, 0.09972, -0.83921, 0.403539, -0.310267, -0.579481, -0.626424, 0.775255, 0.930231, 0.856237, -0.271236, 0.35384, -0.0864509, -0.901019, -0.457629, -0.632967, -0.540329, -0.214087, 0.899325, -0.910066, 0.170624, 0.241051, -0.383243, -0.341326, 0.587626, -0.889701, -0.383259, 0.802876, -0.943784, -0.327664, 0.97898, 0.433698, -0.288931, -0.202316, 0.37445, 0.609333, -0.442928, -0.139129, 0.750503, 0.755313, -0.499662, -0.159843, 0.990105, -0.442913, 0.0242752},
-	{0.499617, -0.853677, -0.561339, -0.797876, 0.375569, -0.356816, -0.888792, 0.38616, -0.596641, -0.780066, -0.164343, 0.189948, 0.26055, 0.22248, 0.184497, 0.868774, -0.902082, -0.83007, 0.777858, -0.551123, -0.20676, -0.469768, 0.989576, 0.986702, -0.343479, 0.180933, 0.131375, -0.65949, -0.669243, -0.722654, -0.969904, -0.735376, 0.0438504, 0.316007, 0.0480602, -0.115481, -0.273726, 0.535747, -0.88057, -0.900131, -0.538379, 0.525562, -0.760489, 0.14409, -0.478893, 0.774397, 0.612534, -0.0454517, 0.502862, -0.0854401, -0.788023, -0.0433928, 0.91982, 0.622496, -0.67921, -0.15039, 0.46456, -0.0388407, -0.639502, -0.43171, -0.147295, 0.980195, 0.466075, 0.0637847, 0.108809, -0.54074, -0.32865, -0.127512, -0.514558, -0.809898, -0.730448, -0.0122592, -0.529942, 0.790187, -0.738116, -0.359218, 0.287568, -0.862513, -0.260973, -0.168648, -0.862364, 0.78445, 0.759331, -0.938523, 0.576468, 0.42257, 0.222072, 0.360542, 0.477168, 0.375501, 0.59077, 0.508523, 0.361619, 0.0275644, -0.365591, -0.890719, -0.423498, 0.521315, -0.928101, 0.743818, -0.887161, 0.913576, 0.778021, -0.0879962, 0.441364, -0.569522, -0.600502, -0.971599, -0.939593, -0.567657, -0.106755, -0.839849, 0.527133, -0.794404, -0.120037, -0.619129, 0.612772, 0.0800229, 0.0560207, -0.587947, 0.46549, 0.476901, -0.677331, -0.818305, -0.40727, -0.520693, -0.575793, -0.0108952, -0.826836, -0.355879, 0.912705, 0.898059, -0.4685, 0.931061, -0.404079, 0.413311, 0.296686, -0.190918, -0.981449, -0.593421, -0.0853875, -0.703924, 0.151662, 0.221043, 0.335674, -0.80295, 0.00465626, 0.893204, -0.908607, -0.235338, 0.535271, -0.355822, 0.66238, -0.469411, 0.605064, 0.311151, -0.0800867, 0.957654, -0.0969382, 0.615201, -0.770504, -0.423459, 0.668614, -0.150818, 0.165494, -0.440897, 0.897891, -0.818133, 0.201405, -0.500462, 0.500753, 0.561061, -0.12595, -0.048364, 0.242201, 0.0477825, 0.136339, -0.721524, -0.159378, -0.185236, 0.714746, 0.620034, 0.983042, -0.421141, 0.365343, 0.300462, -0.730607, 0.194585, 0.753319, -0.181143, -0.165826, -0.732814, -0.861996, 0.0752087, 0.0652214, -0.455278, 0.443542, 0.244944, -0.491259, 0.959755, 0.0257562, 0.127903, -0.640424, 0.957965, -0.0412428, -0.850614, 0.605532, -0.755323, -0.719434, -0.629609, -0.046931, -0.94391, 0.462492, -0.589473, 0.909647, -0.111174, -0.643563, -0.778132, 0.631557, -0.0438562, -0.780429, 0.274515, -0.994463, 0.0108238, -0.133123, 0.433068, 0.287257, 0.596327, 0.223544, -0.140999, 0.655144, 0.750198, -0.336189, 0.627416, -0.0781359, 0.957559, -0.0879831, -0.326716, 0.759956, 0.343295, -0.40266, 0.744464, 0.13186, 0.861868, -0.491828, 0.149446, 0.696474, 0.282492, -0.734801, 0.949325, 0.814189, -0.178487, -0.782807, 0.374841, 0.476234, 0.0975195, 0.418117, 0.365984, -0.650036, -0.479967, -0.517819, 0.98493, -0.500706, -0.115725, -0.78585, -0.576704, -0.256602, -0.405502, 0.370002, -0.831659, -0.0885843, 0.195346, -0.710488, -0.577319, 0.965231, 0.198603, -0.38086, -0.00314343, -0.92951, 0.947581, -0.124425, -0.827744, 0.34148, 0.722208, 0.206595, -0.175342, 0.953093, 0.206979, 0.0267325, -0.301365, -0.893447, 0.0103305, 0.407378, -0.421662, 0.617532, 0.776908, -0.0924742, 0.562417, 0.531437, -0.143526, -0.109967, 0.794312, -0.898128, 0.801351, -0.711945, -0.703078, -0.497427, -0.0644756, -0.658315, 0.797819, -0.364942, -0.704458, -0.43272, 0.788448, 0.286442, -0.367012, 0.108024, 0.700639, 0.0880625, -0.903627, -0.270137, -0.209963, -0.62537, -0.969332, 0.742022, 0.9934, 0.517857, 0.801678, -0.868966, 0.514973, -0.254553, -0.406852, -0.409129, 0.490274, -0.801282, 0.828201, 0.14116, 0.639255, 0.618452, 0.998335, -0.9073, 0.748599, -0.200358, 0.0721323, 0.481282, 0.683462, 0.306882, 0.293075, -0.952082, -0.348568, -0.954745, -0.591489, -0.11561, -0.811075, -0.467459, 0.286486, -0.300229, 0.834777, 0.496299, -0.294359, -0.253526, 0.666846, 0.587878, -0.0495896, -0.784575, 0.413317, 0.293141, 0.687489, -0.173117, -0.437266, 0.419819, -0.624113, 0.73043, -0.903311, -0.766403, 0.964862, 0.696725, 0.500989, -0.444195, -0.513832, 0.191913, 0.382164, 0.436285, -0.0345773, -0.190413, -0.10883, 0.527077, 0.12986, -0.123156, -0.428241, -0.66101, 0.47927, -0.805948, 0.0869871, 0.136738, -0.698506, 0.330146, 0.0905172, 0.392064, -0.430292, 0.376751, 0.754485, 0.609197, -0.918414, -0.582531, 0.234833, 0.566583, 0.217539, 0.316759, 0.708887, -0.610615, -0.375493, -0.632145, -0.60734, -0.372112, 0.584814, 0.126582, 0.951816, 0.283271, -0.92275, -0.015555, 0.306572, -0.952327, -0.524015, 0.649537, 0.667818, -0.787776, 0.795507, 0.913302, 0.746055, 0.358852, -0.979364, -0.806128, -0.0845911, 0.533871, -0.266271, 0.78708, 0.830567, 0.796039, -0.779184, -0.88809, -0.504017, 0.180388, -0.111301, 0.693921, -0.59517, -0.857248, -0.544196, 0.0923116, -0.654348, -0.995173, 0.471513, 0.692179, 0.362059, 0.688161, 0.955893, -0.918217, 0.7883, -0.605084, 0.773427, -0.066893, -0.85244, -0.237382, -0.433227, 0.639715, -0.985634, -0.929972, 0.679146, 0.960518, -0.451353, 0.888602, -0.28449, -0.184382, 0.569375, -0.279603, 0.726729, 0.496144, -0.753103, 0.55416, 0.44816, 0.0314121, -0.298848, -0.987215, -0.714155, 0.484287, -0.81786, 0.444339, -0.581596, -0.827249, -0.928343, -0.848114, -0.732839, 0.53751, 0.645829, 0.434915, -0.772648, -0.188063, 0.231741, -0.307434, 0.250533, -0.197243, 0.0395304, -0.187427, -0.420476, -0.587064, -0.579535, -0.416261, 0.302408, -0.550937, 0.922546, -0.0569996, -0.583399, 0.210469, -0.223144, -0.35505, -0.828354, 0.0347262, 0.9865, -0.0284255, 0.917981, 0.742744, 0.779739, -0.974664, -0.952261, -0.167738, 0.251232, 0.987371, -0.975749, -0.42789, 0.100164, 0.0746925, -0.869896, 0.488988, 0.377197, -0.235726, -0.444745, -0.0481031, -0.265241, 0.867274, 0.936785, -0.285199, 0.414601, -0.21442, 0.547578, 0.0903079, -0.981665, 0.721441, 0.297742, 0.0840032, -0.412577, 0.585934, -0.811868, 0.586306, -0.730112, -0.402968, -0.0315875, 0.818493, -0.622111, -0.875469, 0.0706819, 0.818058, -0.0804656, -0.794938, -0.0635373, 0.909928, -0.326634, -0.3869, -0.0880196, 0.395732, 0.170541, 0.903125, 0.712687, -0.0446998, 0.927293, 0.791916, 0.477197, -0.264303, 0.394081, 0.917811, 0.89436, 0.671407, 0.773253, 0.202958, 0.290932, 0.972014, -0.196918, 0.504438, 0.12288, -0.874218, -0.548627, -0.780601, 0.263732, -0.193963, -0.722094, -0.374556, 0.0715436, 0.896724, -0.320694, -0.0573951, -0.103348, -0.347124, 0.457234, 0.957216, -0.776209, 0.509162, 0.0244087, -0.961825, 0.504329, -0.677462, 0.216651, -0.0789818, 0.412792, 0.969339, -0.442791, 0.068795, -0.923097, 0.50793, -0.425879, -0.364171, -0.197361, -0.620922, 0.093604, -0.205479, -0.313125, -0.414459, 0.824507, -0.296663, 0.924219, -0.0307871, -0.988919, -0.855725, -0.242664, 0.232809, -0.486884, -0.754962, 0.681875, 0.509876, -0.686105, 0.531655, -0.163475, -0.0285418, -0.609207, 0.613412, 0.32105, -0.0885145, 0.937138, -0.890693, -0.443711, -0.533832, -0.567441, 0.353374, -0.207362, -0.177005, -0.57465, -0.112005, 0.544217, 0.949296, 0.285893, -0.321364, 0.568871, 0.169394, 0.987646, -0.313631, -0.997972, 0.715496, -0.156352, 0.867474, 0.386799, -0.0746636, 0.373409, 0.531117, 0.467746, -0.727495, 0.0258028, 0.450497, -0.943693, -0.528414, -0.649704, 0.613537, -0.057171, 0.115353, 0.909165, -0.525516, 0.678436, 0.353775, -0.304471, -0.565527, 0.838361, -0.626537, 0.883789, -0.303147, 0.39937, 0.690887, -0.950438, 0.421641, 0.0438445, 0.432039, 0.00981631, -0.576764, 0.276452, 0.0764196, -0.139854, 0.0887011, -0.00185852, 0.462138, 0.145998, -0.283525, 0.148793, 0.410914, -0.803062, 0.899586, -0.564798, -0.631156, -0.656235, -0.186818, -0.330854, 0.264419, -0.446597, -0.411912, -0.832995, 0.538486, -0.370717, -0.340363, 0.452829, 0.043279, 0.241011, -0.864863, -0.768437, -0.252507, -0.866827, 0.900341, -0.0329659, 0.0759414, 0.842803, -0.840216, 0.397768, -0.217944, 0.147018, 0.506144, 0.145965, 0.241315, 0.188375, 0.225517, -0.0895752, -0.301968, -0.894247, -0.976281, -0.933932, 0.748144, 0.555788, 0.730013, 0.703397, -0.963603, 0.999903, 0.809676, -0.0953751, -0.239329, 0.260553, 0.480866, 0.276874, -0.800415, -0.189626, -0.993877, -0.117591, 0.814172, 0.099957, 0.798336, -0.403981, 0.786867, 0.537405, 0.260788, 0.652972, 0.928839, 0.150805, -0.56007, 0.25269, 0.387842, 0.334664, 0.325407, -0.971404, 0.891314, 0.201775, 0.62177, 0.307519, 0.976991, -0.381157, -0.506085, -0.230217, 0.470727, 0.111588, -0.909085, 0.803349, 0.222505, 0.972446, 0.581437, 0.602804, -0.278459, -0.0171538, -0.472424, -0.660913, 0.478257, -0.72744, -0.978799, -0.124376, 0.406063, 0.996736, 0.10391, -0.035404, 0.0992741, -0.497521, -0.181263, 0.463542, 0.10273, -0.9383, 0.717148, -0.884368, -0.390517, -0.0577694, -0.610053, 0.301625, -0.285104, -0.00793855, -0.421998, -0.369711, -0.24532, 0.135195, 0.328155, 0.22621, -0.169919, 0.309399, -0.283872, -0.15693, 0.919164, -0.482661, -0.119773, 0.836616, 0.399237, -0.212045, 0.747737, 0.170692, 0.887371, -0.211156, -0.851606, -0.831586, 0.178549, 0.218288, 0.586377, 0.684517, 0.237748, 0.561703, 0.117964, -0.770918, -0.963687, 0.198505, 0.302622, -0.115461, -0.729062, -0.979485, -0.338503, 0.351535, 0.419272, -0.785929, 0.850059, 0.0316841, 0.334348, 0.781263, 0.276109, 0.61875, 0.865936, -0.408931, -0.35659, -0.690762, -0.779319, -0.618483, -0.0421931, 0.770148, -0.516102, -0.637622, 0.94477, -0.0545388, 0.500325, 0.841991, 0.456891, 0.253047, -0.938201, 0.983216, 0.957198, -0.772864, -0.180855, -0.21433, 0.623648, 0.94363, 0.516862, -0.785437, -0.943904, -0.313024, -0.619991, 0.630982, 0.133835, 0.103209, 0.137311, -0.111734, 0.89666, 0.327306, 0.42102, -0.117773, 0.156149, -0.519196, 0.820925, 0.89144, 0.950675, -0.125684, -0.129481, -0.707315, 0.479852, 0.649489, 0.643068, -0.819307, -0.95191, -0.00886761, -0.958021, 0.222115, 0.107044, -0.468239, 0.521247, 0.0590119, -0.158856, 0.631347, -0.473981, -0.581994, 0.414169, -0.685039, -0.553977, -0.906341, 0.148168, 0.428649, -0.369493, -0.85558, -0.222067, -0.281359, 0.187302, 0.968418, -0.0915377, -0.74046, -0.230216, 0.101231, -0.520855, -0.660415, 0.0358966, -0.949192, 0.155008, 0.875122, -0.665042, -0.507109, 0.471785, 0.864436, 0.806234, -0.278311, 0.905646, 0.125177, 0.500639, -0.347112, 0.331331, 0.431319, 0.112577, -0.580435, 0.504174, -0.382075, 0.00411255, -0.871451, -0.220809, 0.995969, -0.503873, -0.791455, -0.59031, 0.0385068, -0.86321, -0.698075, 0.222519, 0.590419, 0.821646, 0.47105, -0.46458, -0.867433, 0.122395, -0.271231, -0.815303, 0.449362, -0.172295, -0.293713, 0.354724, -0.937862, 0.707294, -0.863387, -0.869954, -0.528838, -0.940421, -0.303885, -0.260237, -0.155416, -0.0838567, -0.218944, -0.291247, -0.994948, 0.17639, 0.985852, -0.90597, 0.329025, -0.579344, 0.159283, 0.727885, 0.484254, -0.256854, 0.867458, 0.497496, 0.357511, -0.847962, 0.293528, 0.666183, -0.654276, 0.616945, -0.357928, 0.496388, -0.994282, 0.154386, 0.471655, 0.211991, 0.844214, -0.0234646, 0.77803, 0.362391, 0.369668, -0.879127, 0.910413, -0.442114, 0.064549, 0.234138, 0.225095, -0.52285, 0.246467, -0.104565, -0.194148, 0.418501, 0.00590411, 0.798668, -0.385853, 0.58969, -0.899133, -0.995642, -0.417247, -0.113561, 0.583975, -0.985877, -0.77064, 0.855148, 0.440477, -0.196855, 0.264641, -0.11733, 0.626698, 0.621957, -0.175334, -0.117022, 0.125541, 0.22227, 0.365758, 0.160584, -0.198399, -0.927826, -0.339981, -0.715106, 0.627619, -0.474751, 0.188544, -0.0148879, 0.445634, -0.790623, 0.0159009, 0.305323, 0.470631, -0.504088, -0.154303, 0.679017, -0.990462, -0.96264, 0.304438, -0.644969, 0.00978537, 0.635358, 0.977815, -0.273688, 0.60807, -0.058644, -0.584485, -0.256897, 0.340993, -0.978832, -0.692403, 0.447486, -0.482493, 0.508717, -0.683714, 0.491195, 0.837677, 0.346926, -0.448281, -0.768937, 0.590079, -0.0722999, 0.23442, -0.232865, -0.498032, 0.724535, -0.117267, -0.622136, -0.440098, 0.350955, -0.67079, 0.6626, 0.935345, 0.663364, -0.799129, 0.625501, -0.765295, 0.900514, -0.580204, -0.0567257, -0.244972, 0.396811, -0.435547, 0.314274, -0.518281, 0.314789, 0.682035, -0.426784, 0.889829, 0.960861, -0.849101, -0.708274, 0.294484, 0.388928, -0.779655, -0.779868, 0.437129, 0.869496, 0.689215, 0.533449, 0.431904, -0.0558407, 0.425448, 0.40397, 0.817605, 0.411139, -0.325616, -0.811886, 0.695823, -0.732489, -0.764313, 0.543036, 0.379716, -0.689331, -0.885925, 0.243853, 0.60398, -0.736185, 0.753062, 0.426004, 0.615394, 0.55573, -0.788446, 0.068006, -0.519542, -0.84073, -0.749926, -0.001102, 0.165016, 0.49443, -0.868315, 0.997511, -0.566676, -0.84518, -0.553455, 0.0999635, 0.84922, -0.956669, -0.912419, -0.12243, -0.321155, 0.730759, -0.112483, -0.810777, 0.267003, 0.153248, -0.866582, -0.915089, 0.924448, 0.214695, 0.892767, -0.575313, -0.675473, -0.673705, -0.651847, -0.429233, 0.514002, -0.952431, 0.268735, 0.220003, -0.0923941, -0.779672, -0.921146, 0.619285, 0.163739, 0.0227288, -0.467631, -0.0570013, -0.404964, 0.284245, 0.202359, -0.626521, -0.000365177, 0.16389, -0.420776, -0.40647, 0.249996, 0.291606, 0.834006, 0.555831, -0.851292, -0.932502, -0.138967, 0.607979, -0.096261, -0.209677, -0.96282, 0.458242, -0.99208, -0.521495, -0.188907, -0.206013, 4.99054e-06, -0.655978, 0.147082, 0.493655, -0.881856, -0.774979, 0.212075, 0.706135, -0.849358, -0.094178, -0.259646, -0.851385, 0.394356, 0.444144, -0.0386029, 0.726179, 0.493724, -0.550745, -0.83813, -0.77478, -0.0303608, -0.399318, 0.428853, -0.21362, -0.587154, 0.716507, -0.556742, -0.552886, 0.997615, 0.163698, 0.24905, -0.442028, -0.819856, -0.671751, -0.599835, -0.485041, -0.080255, 0.335144, 0.755992, 0.00419951, 0.255374, 0.0426636, 0.216538, 0.391232, -0.3039, -0.373011, -0.361788, -0.17346, -0.653514, 0.616958, 0.905953, 0.637704, 0.680619, 0.462329, -0.260023, 0.146666, -0.526304, 0.912801, 0.977444, -0.897028, -0.723209, 0.717752, 0.836444, 0.851401, 0.89114, 0.894201, -0.907584, -0.168137, -0.473108, 0.910489, -0.952246, -0.230061, 0.673344, 0.660428, 0.286485, 0.108574, 0.348703, -0.481822, -0.20137, -0.763133, -0.479872, 0.266869, -0.153152, 0.221193, 0.495516, -0.514073, -0.457398, 0.243676, -0.117797, -0.0916518, -0.990049, -0.0452996, 0.621847, 0.739726, 0.302617, 0.55614, 0.319895, -0.401481, -0.00898069, -0.688466, -0.515254, 0.626805, -0.848928, 0.477319, 0.52421, 0.435142, -0.855544, -0.241179, -0.620896, -0.313005, -0.326467, 0.302392, -0.90351, -0.341219, -0.869289, -0.0348073, 0.631133, 0.39897, 0.259979, 0.825005, 0.820267, 0.864197, -0.915142, 0.890986, 0.406303, -0.975761, -0.892351, 0.710742, -0.815258, -0.427106, 0.920538, 0.17252, 0.924612, -0.872611, -0.282548, 0.405502, 0.774633, -0.0789469, -0.333597, 0.99388, 0.418528, -0.901573, 0.633559, -0.826199, 0.676444, -0.527649, -0.764039, 0.279676, -0.618612, 0.195047, 0.324323, 0.596761, -0.455325, -0.836516, -0.0126024, -0.0695597, 0.213246, -0.32089, -0.220719, 0.270052, -0.248365, 0.419436, 0.676588, -0.529291, 0.341716, 0.233507, 0.093876, -0.0303572, -0.95759, 0.756783, -0.236317, -0.412787, -0.40326, 0.784243, 0.71512, 0.322579, 0.847855, -0.826975, -0.0120308, 0.213761, 0.183301, -0.0790943, 0.266919, 0.441339, 0.834157, 0.519301, -0.499494, 0.274815, -0.181801, -0.265381, 0.00942035, -0.4495, 0.827301, 0.856, -0.64165, 0.394465, -0.890131, 0.501067, -0.995332, -0.218861, 0.939247, 0.386384, -0.388493, -0.364004, 0.620721, 0.269953, 0.108497, -0.902448, 0.621844, -0.223965, 0.647989, -0.0719958, 0.101551, -0.23986, 0.284186, 0.304633, -0.674131, -0.654744, 0.680489, 0.842156, -0.213948, 0.355625, -0.56054, -0.754315, 0.813715, 0.156592, 0.255921, 0.506234, -0.865621, -0.68138, -0.736919, -0.643867, -0.687459, -0.105832, 0.90978, 0.0440344, -0.216269, -0.956371, 0.745298, 0.637157, 0.603903, -0.48145, 0.507921, -0.139513, -0.533375, 0.498212, 0.0571322, 0.776644, -0.269538, 0.622265, 0.589213, 0.0396756, -0.374045, -0.154328, 0.0538018, -0.134295, 0.35168, 0.0296689, -0.417928, 0.213219, -0.225109, -0.816091, -0.392215, 0.380111, 0.342026, 0.977892, 0.0221438, -0.222214, -0.0717647, -0.91093, -0.233298, -0.672252, 0.849623, 0.962546, 0.165751, 0.48542, 0.952959, 0.673657, 0.102412, -0.79939, 0.547166, 0.124517, 0.796049, -0.66363, 0.509649, -0.240581, -0.575742, -0.476748, -0.957275, 0.526075, -0.53548, -0.524603, -0.184835, -0.703416, 0.0622696, -0.238026, 0.810468, 0.0946053, -0.414673, -0.0555177, -0.0315473, -0.0354918, -0.164695, -0.287483, 0.0602234, 0.776999, -0.871055, -0.133739, -0.56434, -0.00753241, -0.609433, 0.529198, 0.789246, 0.63611, 0.586063, -0.384652, 0.529126, -0.928893, -0.069144, 0.0811313, -0.247132, -0.641186, -0.809428, 0.443338, -0.850346, 0.535928, -0.946716, -0.619766, -0.208839, -0.248501, 0.582184, -0.670263, -0.0308368, -0.257556, 0.207632, -0.136508, 0.877554, 0.47524, 0.100139, 0.401028, -0.206838, -0.594918, 0.0402915, 0.650513, 0.519511, 0.0558005, -0.343979, -0.122539, -0.0984193, -0.568468, 0.421049, -0.536338, 0.335162, -0.212099, -0.53285, 0.0852905, 0.249252, 0.977708, 0.983331, -0.775383, -0.594444, 0.117481, 0.206982, 0.443925, -0.563663, -0.499126, -0.461847, 0.03668, 0.115168, 0.755691, -0.812455, 0.815088, -0.766475, 0.593495, -0.0174277, 0.784741, -0.149726, 0.495547, -0.335319, 0.418122, 0.180012, 0.501922, 0.949505, 0.289457, -0.78787, -0.432752, 0.968159, 0.542583, -0.729759, 0.0924892, -0.782091, -0.0727089, 0.798182, 0.536846, -0.535177, 0.0525915, 0.921436, -0.424409, 0.703692, 0.19972, -0.0363909, 0.00986074, -0.713038, 0.022536, 0.0424131, -0.355246, 0.745137, -0.11533, -0.973286, 0.866657, 0.0195831, -0.257124, -0.736241, 0.551071, 0.595757, -0.270213, 0.0763714, 0.891614, -0.600963, 0.71411, 0.855985, -0.373954, 0.735896, 0.23993, 0.199374, 0.517794, 0.547017, 0.381317, -0.505087, -0.442792, -0.291117, -0.829966, -0.563263, 0.645335, -0.95453, 0.656569, 0.812794, 0.896132, -0.0259605, -0.34776, -0.498297, 0.380733, 0.6713, -0.996759, 0.88284, -0.467596, -0.657282, -0.747432, 0.414864, -0.548145, 0.959921, -0.603475, -0.297993, -0.978105, 0.857895, -0.168832, 0.685514, -0.292023, -0.724034, -0.046214, -0.523194, -0.880759, -0.494203, -0.943001, -0.142013, 0.935969, -0.69511, 0.639308, -0.0703786, 0.191816, 0.694908, 0.238848, 0.769505, -0.370995, 0.527731, -0.916068, -0.425244, 0.402662, 0.0628576, -0.389657, 0.349279, 0.888579, -0.513766, -0.512473, -0.891061, -0.408409, 0.521691, -0.399099, 0.968245, -0.704342, -0.580693, 0.123222, -0.704786, 0.187443, 0.706237, 0.449565, 0.700401, 0.888623, 0.855864, 0.879862, 0.28504, -0.78932, 0.674695, 0.606751, 0.843101, -0.401629, 0.4487, -0.581985, 0.73277, 0.604904, -0.275636, -0.429187, 0.11621, -0.90768, 0.614206, -0.432986, -0.36689, 0.597488, -0.505072, 0.0388748, -0.506861, -0.922672, 0.0960587, 0.194155, 0.94948, 0.193362, 0.754873, -0.262231, 0.945473, 0.50462, -0.935847, -0.515788, -0.500105, -0.448599, 0.123643, 0.788624, -0.581979, -0.244598, 0.723706, 0.11672, -0.903244, -0.228896, 0.786959, -0.98125, -0.272166, 0.55806, 0.959242, 0.808167, -0.282662, 0.369669, -0.406175, 0.621739, -0.536904, -0.167532, -0.0934187, -0.144144, -0.0571856, 0.617726, 0.758562, 0.0949317, 0.845323, 0.67526, 0.50625, -0.615177, -0.801185, 0.0368296, 0.24449, -0.687857, 0.978002, -0.377988, -0.99461, -0.509325, 0.101114, 0.279301, -0.0949947, -0.439813, 0.695761, 0.893587, 0.226216, -0.607041, 0.782802, 0.9566, 0.282236, -0.525655, -0.200106, -0.0376072, 0.36276, -0.0788757, -0.997518, 0.578216, 0.0737343, -0.21439, -0.471702, -0.16896, -0.866519, -0.857995, -0.0654308, 0.348095, 0.0338018, 0.582413, 0.760353, -0.370513, -0.849378, -0.229756, -0.725856, 0.0585529, -0.271521, 0.143571, 0.712414, 0.0995659, -0.96266, 0.596758, 0.66997, -0.0995812, -0.859652, -0.681091, -0.0987816, 0.623393, 0.50038, 0.894697, 0.260752, 0.452296, -0.837405, 0.0774191, 0.588422, 0.78742, 0.517128, 0.132161, -0.531724, -0.281939, -0.367936, -0.683977, 0.972855, -0.790798, -0.697635, -0.23452, 0.911555, 0.934501, 0.886761, 0.275008, -0.906905, -0.632555, -0.778169, -0.839585, -0.18388, -0.216688, -0.784202, -0.39801, -0.201767, 0.781873, -0.262507, -0.66834, -0.652634, -0.767655, 0.402589, 0.74499, 0.0855546, -0.0784727, -0.876071, -0.402845, 0.749587, 0.994671, -0.170296, 0.104417, 0.172431, -0.409997, 0.976364, 0.66772, -0.040811, -0.688263, -0.645251, -0.884342, -0.335639, -0.426607, 0.907817, -0.371322, 0.636395, 0.766031, 0.386781, -0.977659, 0.387448, -0.964796, 0.124162, -0.778741, -0.887063, 0.242882, 0.135337, 0.770987, -0.324712, -0.619342, -0.742206, -0.375332, 0.259453, 0.496986, -0.481159, 0.585279, 0.280068, 0.921688, -0.354437, -0.358177, -0.264058, 0.645328, -0.131189, -0.907609, -0.878831, -0.364871, -0.268029, -0.456357, 0.945072, -0.0121128, -0.597942, -0.0620585, 0.0898772, -0.302844, 0.618782, 0.0300541, 0.589154, 0.3785, -0.219751, -0.228621, 0.369449, 0.743905, -0.577134, -0.599424, -0.596801, 0.112484, -0.138786, 0.964284, -0.248416, -0.213107, -0.137704, 0.403608, -0.581614, -0.400914, -0.962014, -0.834964, 0.12769, -0.682825, -0.748064, -0.763965, 0.629738, -0.25278, -0.413885, 0.417634, -0.923791, 0.824909, -0.344441, 0.479965, 0.871355, -0.578194, -0.839516, -0.912037, -0.411672, -0.595532, 0.0463885, -0.534354, 0.919654, -0.413255, -0.147044, 0.493345, 0.274832, -0.844414, 0.430003, -0.443628, 0.16886, 0.660659, -0.335478, 0.758715, -0.536341, -0.879506, -0.359453, -0.878174, -0.893596, -0.0906415, -0.495458, 0.727508, 0.500069, 0.43378, -0.878473, -0.472158, -0.0657867, 0.614576, 0.928806, -0.112898, 0.194511, -0.0593047, -0.0962961, 0.844819, 0.265628, 0.471505, -0.152274, 0.082019, 0.347216, 0.653334, -0.532823, -0.969126, 0.749325, 0.0299862, 0.695117, -0.963164, 0.729271, 0.60799, -0.906973, 0.633329, -0.0900514, -0.160825, -0.0862269, 0.182752, 0.446057, -0.0827012, 0.186057, -0.0937567, -0.646106, -0.705323, -0.216778, 0.47163, 0.728238, -0.681367, 0.595104, -0.841238, 0.354035, 0.512433, -0.11277, -0.163432, 0.0718434, -0.596893, 0.0360893, -0.912782, -0.411616, 0.472244, -0.589023, -0.767316, 0.0985013, 0.614959, 0.868179, -0.294222, 0.482745, -0.920417, 0.381165, 0.48285, -0.704342, -0.58249, -0.594817, -0.16056, -0.868746, 0.866445, -0.200731, 0.968824, -0.348895, -0.454569, 0.969178, -0.00223532, 0.268075, 0.770531, 0.22461, 0.302339, 0.456566, 0.733579, 0.11311, 0.101456, -0.0156072, 0.0890924, 0.725638, 0.729047, 0.101045, -0.856293, 0.984161, 0.61286, 0.567254, -0.326335, -0.981487, 0.613954, 0.259071, 0.00514967, -0.423683, 0.711473, -0.926768, -0.163863, -0.603924, -0.60498, 0.981441, 0.677088, 0.203863, 0.320452, 0.0474395, -0.128102, 0.546896, 0.297388, -0.181524, 0.380248, 0.807212, 0.161199, 0.382338, -0.955377, -0.710799, -0.497011, -0.57549, 0.820543, -0.186, 0.444658, -0.906139, 0.207341, -0.678492, 0.0603666, 0.786316, -0.773268, 0.866827, 0.122107, 0.257549, -0.915468, 0.736881, -0.756213, -0.209924, 0.992963, -0.243165, 0.626882, 0.0576189, 0.428675, -0.500929, -0.535291, 0.475539, -0.123548, -0.536469, 0.921206, -0.188449, 0.792615, -0.122805, 0.0267944, -0.899626, -0.856362, 0.577368, -0.232138, -0.919604, 0.107895, 0.372493, -0.634698, -0.238881, -0.187198, -0.638259, -0.532969, -0.692994, -0.176608, -0.779281, -0.526436, 0.634822, -0.338019, 0.601309, 0.681495, -0.379967, 0.957545, -0.820362, -0.439386, 0.647839, 0.0345323, -0.201898, 0.746825, 0.874498, -0.352186, 0.289988, 0.229002, 0.165246, 0.663812, 0.786337, -0.493782, -0.621343, -0.653216, -0.935908, 0.0427248, -0.112429, -0.418851, 0.838629, 0.860129, 0.810275, 0.677439, 0.680053, -0.171142, 0.175906, -0.564874, -0.509524, 0.311407, -0.148387, 0.393561, -0.762817, -0.161534, 0.331999, -0.252528, -0.603084, 0.840899, 0.408512, -0.429735, -0.626861, 0.340288, -0.615797, -0.0547695, -0.640678, -0.541086, 0.265358, 0.568015, -0.981514, -0.843757, -0.634299, 0.277252, -0.87241, 0.365004, 0.169326, -0.042384, 0.794159, 0.743628, 0.52315, 0.0634905, -0.968297, 0.344412, 0.460051, 0.742911, 0.776446, -0.939534, 0.576739, 0.558996, -0.557825, -0.0784674, 0.0848339, 0.467201, 0.687714, 0.235979, -0.647087, 0.60782, 0.546651, 0.561762, 0.878013, -0.905198, 0.715465, -0.625725, -0.699963, 0.575473, 0.599228, -0.698326, 0.131088, -0.701487, -0.654785, 0.756452, -0.966754, 0.727938, -0.107276, 0.72072, 0.597748, 0.797756, -0.603543, -0.413203, 0.780921, -0.897984, 0.19258, 0.635665, 0.0564351, 0.638608, 0.21334, -0.239396, 0.572934, -0.078175, 0.273025, -0.788666, -0.433296, -0.647941, -0.24414, 0.838369, 0.125056, -0.559787, -0.984736, 0.498822, -0.527928, -0.69113, 0.513463, 0.270371, -0.554198, -0.405973, 0.840819, 0.333284, 0.133462, -0.935905, 0.970803, -0.071592, -0.241935, 0.862936, -0.0788155, 0.723896, 0.544837, 0.966623, -0.464706, 0.711826, -0.27576, 0.243869, 0.517999, 0.206711, 0.694209, -0.683069, -0.310992, -0.595028, -0.908977, 0.307196, 0.993021, -0.743798, -0.184484, 0.0288792, 0.024801, -0.77984, -0.559976, -0.605144, 0.954915, 0.893933, 0.716767, -0.450714, -0.419673, 0.0992726, 0.00653553, -0.745493, 0.904981, -0.727266, 0.342314, 0.00483, -0.371557, 0.489566, 0.441064, -0.359759, 0.96783, 0.00118084, -0.148024, -0.076982, 0.406131, 0.543143, 0.658856, -0.272878, -0.764144, 0.569116, 0.982821, -0.362025, 0.253752, -0.324692, 0.423082, 0.310887, -0.54135, 0.152654, 0.105291, 0.551765, 0.652285, -0.203143, 0.806349, 0.441804, 0.189984, 0.472835, 0.524771, -0.939742, -0.743961, 0.643176, 0.599873, 0.512758, 0.89808, 0.827203, -0.203744, 0.441875, 0.193729, -0.542234, -0.397522, 0.666012, -0.888336, 0.0973693, -0.838797, 0.48143, 0.972711, 0.821106, -0.688797, 0.448041, 0.260692, -0.835522, -0.523779, -0.175834, -0.450337, 0.271268, 0.0803472, -0.4988, 0.987441, 0.556309, 0.767041, 0.628888, -0.142711, 0.0283852, -0.968392, 0.518196, 0.628336, -0.249684, -0.322569, -0.659513, 0.253845, 0.689221, 0.462932, -0.771827, 0.394587, 0.466005, 0.989781, 0.155767, 0.432632, -0.813941, 0.892778, -0.723557, 0.766425, 0.568631, 0.450835, 0.658571, -0.581838, 0.500365, 0.650888, -0.165836, -0.577552, -0.25112, -0.600752, 0.517031, -0.396506, 0.0521554, -0.31549, 0.0764953, 0.479723, 0.607758, 0.0970662, 0.983263, -0.529454, 0.789139, 0.606206, -0.0664359, -0.461735, -0.736929, -0.0516538, 0.966126, -0.310976, 0.10244, 0.465459, -0.220701, -0.0507064, -0.270276, 0.0148403, 0.375176, -0.219949, -0.450844, -0.783339, 0.174189, 0.130088, -0.0928741, 0.501909, -0.218749, 0.899196, -0.716472, -0.951941, 0.516399, -0.177131, -0.252101, 0.313495, 0.181509, 0.108683, 0.915546, 0.398432, -0.394131, 0.396576, 0.420415, 0.0400524, -0.372316, 0.82312, -0.147677, -0.878275, -0.918668, 0.752608, 0.0251539, 0.830815, -0.884062, 0.43864, 0.858942, -0.715409, -0.707159, -0.142354, 0.616955, 0.581253, 0.932706, -0.336252, 0.861345, -0.805169, -0.992349, 0.956182, 0.764807, 0.428817, -0.143824, -0.615302, 0.396026, -0.215773, 0.0860603, 0.0693382, 0.450537, 0.946554, -0.996727, -0.212854, 0.380785, 0.121675, 0.542029, -0.0573174, -0.0651678, -0.71874, -0.91751, -0.741258, 0.269863, 0.955851, 0.921789, -0.263631, -0.648744, -0.590555, -0.981021, -0.289499, -0.237696, 0.744334, -0.868629, -0.941942, -0.249099, -0.544702, 0.110047, 0.279471, -0.817553, -0.112761, 0.540504, -0.38547, -0.259303, 0.340978, -0.427399, 0.652667, 0.123273, -0.970182, 0.804107, 0.11548, -0.731927, 0.0399582, 0.312145, 0.584226, 0.813007, -0.0294654, 0.104928, 0.894594, 0.126617, -0.204015, 0.395627, 0.265158, 0.1985, -0.676653, -0.393821, -0.963397, 0.143473, -0.696625, 0.394839, 0.437457, -0.7904, 0.902854, 0.245953, -0.748258, -0.817102, -0.99463, 0.88205, 0.0700059, 0.445436, -0.824489, -0.0430111, -0.119335, 0.13602, -0.88496, -0.736141, 0.991392, 0.926953, 0.639514, -0.378864, -0.314059, 0.522938, -0.0806466, 0.967494, 0.738382, 0.447117, 0.879291, 0.219462, 0.32081, 0.524627, -0.163385, 0.395931, -0.866881, -0.917774, -0.393403, 0.266839, -0.381857, 0.643032, 0.128526, -0.00291898, -0.816648, -0.226933, -0.520576, 0.825649, -0.83163, -0.331406, 0.150036, 0.62651, 0.0855103, -0.347386, 0.582115, -0.669767, -0.383328, 0.851414, 0.538519, 0.925147, -0.633012, -0.620813, 0.322084, 0.289024, 0.444389, -0.899219, 0.457722, 0.573259, 0.215541, 0.847537, -0.0857201, 0.551022, 0.61976, 0.832457, 0.894625, -0.280325, -0.289851, 0.148613, -0.415863, -0.38815, -0.942728, 0.375956, 0.815852, -0.990839, 0.237608, -0.344076, -0.409854, 0.847308, 0.0222716, 0.843485, -0.15537, -0.698191, 0.579222, -0.53386, 0.658056, -0.490163, 0.923153, 0.676992, 0.103897, -0.94908, 0.0186895, 0.101797, 0.277294, 0.755945, 0.838806, 0.861248, 0.204701, 0.364319, -0.228318, -0.282873, -0.0703563, 0.346986, -0.0130944, 0.975931, -0.575687, -0.860108, 0.270988, -0.270252, -0.388595, 0.0344865, -0.257601, 0.443093, 0.842777, -0.852912, 0.320054, 0.823426, 0.374939, -0.0839715, 0.935247, 0.0389849, -0.190305, -0.107252, -0.768298, -0.586822, -0.119556, 0.551583, -0.74709, -0.393637, -0.785705, 0.212659, 0.764342, 0.638892, 0.584141, 0.993492, -0.641933, -0.0480084, 0.394494, 0.351962, -0.655157, -0.661963, 0.310855, 0.751715, -0.460729, 0.10793, -0.0615484, -0.640659, -0.587391, 0.0691027, 0.607912, -0.75075, -0.706618, -0.893969, -0.980372, -0.0922126, 0.448481, -0.418893, -0.644309, -0.683854, -0.123108, -0.0565998, 0.618204},
-	{0.203945, 0.678559, 0.940214, -0.60292, -0.784174, -0.290314, 0.910436, 0.781446, -0.719458, 0.993804, -0.590255, -0.807468, -0.306071, 0.825903, -0.842256, 0.70907, -0.412099, 0.851421, 0.963245, -0.592158, -0.429373, 0.797804, -0.939906, -0.391925, 0.274321, 0.160218, 0.288438, 0.684241, 0.0251316, -0.333705, -0.450999, -0.776945, 0.126226, -0.394081, -0.824379, -0.587111, 0.471605, 0.0828549, 0.240661, 0.697106, -0.749874, -0.44777, -0.246729, -0.757138, 0.967624, -0.917929, -0.474067, 0.0618587, 0.981093, 0.162363, 0.0786849, -0.108973, -0.38045, -0.661686, -0.969997, 0.610734, 0.69311, -0.632501, 0.480941, -0.499982, 0.971292, -0.888977, -0.683839, -0.960924, 0.765097, 0.17001, 0.546193, -0.712468, -0.0912192, 0.200301, -0.857193, 0.226638, -0.010373, -0.394617, -0.751921, -0.346405, 0.717696, -0.16962, -0.323976, -0.978587, 0.561528, -0.711053, 0.691009, -0.0744133, -0.632871, 0.0592324, 0.629751, -0.269466, 0.406435, 0.46097, -0.0425415, 0.0403284, -0.242222, 0.75593, 0.265658, 0.880288, 0.925504, -0.377746, 0.0659622, -0.760244, -0.0760339, 0.757029, 0.735837, -0.312261, 0.554845, -0.348784, -0.213426, 0.0373783, 0.100226, -0.98172, -0.783027, -0.498648, 0.616209, 0.504296, -0.644899, 0.784278, 0.819205, -0.659919, -0.536659, 0.208133, 0.524814, -0.208484, -0.378321, 0.653084, -0.059238, -0.291776, -0.336618, 0.159933, -0.798029, 0.306452, 0.0398437, -0.938323, 0.653868, -0.880048, -0.495649, -0.612042, 0.600001, 0.60328, -0.284496, 0.105243, -0.930354, 0.377392, -0.674403, -0.269269, -0.792274, -0.884585, -0.336721, 0.0537797, -0.0482284, -0.136359, -0.130629, 0.533951, -0.307475, -0.293339, 0.587701, -0.936725, -0.958641, -0.818412, -0.536943, 0.843327, -0.999004, -0.0883249, -0.387819, -0.546952, 0.17045, 0.666575, -0.723834, 0.949777, -0.960084, -0.485098, 0.985243, 0.0360862, -0.0946254, 0.161166, 0.0283448, 0.534076, -0.543514, 0.0311269, -0.799292, 0.607907, 0.0571806, 0.77742, -0.959582, -0.00433609, -0.405598, 0.604489, -0.192657, -0.180504, -0.0798269, -0.852076, -0.62051, -0.967456, -0.228844, -0.471373, -0.652309, 0.328031, -0.186053, 0.172033, 0.572748, -0.929947, -0.418093, -0.726768, -0.250496, -0.715792, 0.0334054, 0.53643, -0.401137, -0.801731, 0.949901, -0.257019, -0.706441, -0.359846, -0.710734, 0.274111, 0.842594, 0.991652, 0.878171, 0.0738751, 0.54432, -0.835853, -0.14859, 0.891637, -0.276622, -0.348315, 0.531182, -0.561942, 0.635045, 0.670256, 0.977094, 0.839702, 0.244686, 0.521904, 0.909752, -0.739253, -0.915382, 0.976285, -0.786371, -0.137536, -0.123536, -0.626969, -0.433567, -0.351684, 0.62257, 0.545943, 0.677288, -0.110384, -0.892299, 0.363335, 0.439886, -0.0567415, -0.600978, 0.599324, 0.514667, 0.9355, -0.150209, 0.608449, 0.97759, -0.123586, -0.104937, 0.347204, -0.953712, 0.461681, 0.261734, 0.87781, 0.0420279, -0.914258, -0.720236, -0.133256, -0.999896, 0.534406, -0.239216, -0.750643, 0.738946, 0.722405, 0.352923, 0.777152, 0.905206, -0.173293, -0.477636, -0.54516, 0.65878, -0.690092, -0.92629, 0.0589632, -0.169124, 0.973976, 0.964979, 0.650858, -0.271158, 0.969316, -0.239201, -0.554052, -0.489241, -0.940749, -0.992848, 0.872017, 0.145943, -0.301778, 0.0975937, 0.339959, 0.998075, 0.297993, 0.685077, -0.234937, 0.911533, -0.557088, 0.864003, -0.790663, 0.287311, 0.398447, 0.758092, 0.907446, 0.252235, -0.361458, 0.331523, -0.79193, 0.17706, 0.0736588, -0.859842, 0.169629, -0.391939, -0.857301, -0.867739, -0.904847, 0.516968, -0.889057, -0.824196, 0.354974, 0.11341, 0.0207831, -0.964878, -0.464126, -0.803371, 0.77115, -0.959186, -0.392445, 0.562051, 0.249421, -0.482597, -0.779096, -0.920649, 0.320934, -0.569951, -0.586304, -0.689105, -0.0755722, 0.661626, -0.177985, -0.675369, -0.570524, -0.18418, 0.124949, -0.169018, 0.312904, -0.80331, 0.543955, -0.833984, -0.201356, 0.447641, 0.444483, -0.813245, 0.893305, -0.807216, 0.174594, -0.811334, -0.466293, -0.0237076, 0.164799, -0.396215, -0.617108, 0.436404, 0.680916, -0.744647, -0.806677, 0.033952, -0.0481264, -0.296928, -0.270601, -0.23196, -0.804112, -0.819815, -0.655757, -0.865947, 0.351067, -0.47101, -0.686744, 0.657637, 0.0100983, -0.530384, 0.985584, -0.165935, -0.879229, -0.163237, 0.149488, 0.0190855, -0.90793, -0.317291, 0.0834168, -0.38402, 0.623784, 0.769321, -0.0563318, -0.923539, 0.457134, 0.615189, -0.921459, -0.702038, 0.0377479, -0.658199, -0.848746, 0.185121, -0.537696, -0.65338, -0.766824, 0.709616, 0.083815, -0.332771, -0.817192, 0.517587, -0.937591, -0.0835332, -0.635154, -0.74755, -0.0851704, 0.133301, 0.156197, 0.619154, -0.521805, -0.642413, 0.700361, 0.405862, -0.459923, 0.516098, 0.670668, 0.171408, 0.210156, -0.892971, 0.848386, 0.479909, 0.600932, -0.356679, 0.368469, 0.858245, 0.727177, 0.616347, 0.0952745, 0.0784234, -0.783912, -0.662889, -0.0691413, -0.937211, 0.567608, -0.10117, 0.188156, -0.357901, -0.22695, 0.202176, 0.266052, -0.18151, -0.527195, 0.670739, 0.981216, 0.981018, -0.221009, 0.246389, 0.639192, -0.00880445, -0.184843, -0.93374, 0.596272, 0.48395, 0.732036, -0.204673, 0.235871, -0.101922, -0.167957, -0.95484, 0.459045, 0.288625, 0.653264, 0.594985, 0.0393011, 0.82867, -0.770376, -0.948514, -0.512603, -0.762687, 0.469066, 0.443178, 0.611102, 0.618199, -0.661966, 0.382825, -0.0962221, -0.657444, -0.626544, -0.476308, 0.526276, 0.86871, 0.576566, -0.290416, -0.282969, 0.197279, -0.125719, -0.547162, -0.252666, 0.245008, 0.276762, 0.766844, -0.63008, 0.384837, 0.213257, -0.357914, -0.129124, 0.719226, -0.660345, -0.30844, 0.132269, 0.857423, -0.114757, -0.880749, 0.25476, -0.0116655, 0.40965, 0.458861, -0.0321122, 0.283402, 0.543518, -0.510154, -0.591985, 0.936976, -0.54612, -0.281305, -0.16486, -0.737809, 0.944125, 0.820868, 0.524838, -0.854318, 0.208201, 0.416585, 0.846444, 0.91906, -0.41195, 0.212976, -0.15041, 0.844139, -0.942078, 0.231862, 0.824088, 0.554443, 0.154683, 0.224304, 0.668188, 0.573169, -0.658654, -0.0676856, 0.193191, -0.366432, -0.8928, -0.0598636, 0.908955, -0.875322, -0.415415, -0.406728, 0.084854, 0.98534, 0.0978135, 0.681483, 0.93005, 0.200287, 0.875459, 0.0745162, -0.549099, 0.97009, -0.618297, -0.671877, 0.112958, -0.512301, 0.662929, -0.886984, 0.730646, 0.385324, -0.837993, 0.463085, 0.782459, 0.198916, 0.411506, -0.184845, -0.387361, -0.869502, 0.69742, 0.816004, -0.201159, 0.0937794, -0.521816, -0.699332, 0.163337, -0.535074, -0.401179, 0.84296, -0.197018, -0.407106, -0.646246, 0.529685, -0.819297, 0.251525, -0.930126, -0.538868, 0.419207, -0.496142, -0.679368, -0.742279, -0.814154, -0.987151, 0.711224, 0.198852, -0.30059, -0.531998, 0.860357, 0.88841, 0.241142, 0.667575, -0.87999, 0.690724, -0.110702, 0.631724, 0.541802, -0.531781, -0.528529, 0.0835066, 0.812522, -0.572036, 0.208042, -0.368311, -0.918942, -0.345524, -0.706299, -0.800486, -0.71385, -0.511577, 0.603829, 0.42089, -0.15161, -0.338176, 0.362795, -0.342971, -0.377665, 0.875029, -0.741006, -0.46307, -0.496252, 0.48742, 0.726785, 0.5731, 0.758723, 0.669558, 0.0291281, 0.223778, -0.742568, 0.574299, -0.665956, 0.0504617, -0.889173, -0.445808, -0.0459352, 0.189744, 0.737851, -0.639614, 0.00128484, -0.878374, 0.512044, -0.592694, 0.61265, 0.175031, 0.502755, 0.298713, -0.243379, 0.914579, -0.298999, 0.332295, -0.717658, -0.155056, 0.478378, -0.0548867, 0.256013, -0.300709, 0.877363, 0.158235, 0.484875, 0.637151, 0.97156, 0.111719, -0.035209, 0.588713, -0.342005, -0.514854, -0.605455, -0.767583, 0.190307, -0.792707, -0.0591551, -0.260652, 0.193984, 0.509855, -0.370166, -0.321223, 0.823086, -0.0701869, 0.964498, -0.55944, -0.451096, -0.0374222, 0.441138, 0.560432, 0.764439, 0.953518, 0.1772, -0.375429, -0.287895, 0.461846, -0.627066, 0.189813, 0.376824, 0.441028, -0.399834, -0.576402, -0.137926, 0.43783, 0.188139, -0.667607, -0.347179, 0.522417, -0.00982767, 0.91325, -0.759899, 0.574762, 0.180203, 0.381219, 0.265253, 0.376633, -0.633064, -0.86012, -0.412749, 0.509694, 0.00365581, 0.464784, -0.469266, -0.108404, 0.547637, 0.822207, -0.915142, -0.348213, -0.175849, 0.397351, -0.592685, -0.0774636, -0.584875, -0.512555, -0.420951, -0.492223, 0.375183, -0.451818, -0.696883, 0.931515, -0.405992, -0.160923, -0.618603, -0.103271, -0.00390932, -0.421856, 0.941275, -0.47309, -0.355432, -0.621597, 0.986398, 0.883212, 0.732714, 0.208563, -0.34851, -0.916022, -0.660813, 0.220157, 0.601878, 0.995316, 0.651358, 0.402919, 0.00721248, 0.0613217, 0.0862047, 0.285736, -0.319062, 0.322263, 0.265276, 0.0591264, 0.710503, 0.0631863, -0.0986497, 0.37548, 0.0865389, 0.127124, -0.999504, 0.622221, -0.176214, 0.271128, 0.789674, 0.823981, 0.288533, -0.843137, 0.126337, 0.336449, -0.463746, -0.00234236, 0.0565144, 0.274778, 0.974763, -0.732484, 0.297859, -0.877148, 0.444589, -0.0188475, -0.581424, 0.425894, 0.953295, -0.579208, 0.893536, -0.595639, -0.817623, 0.912402, -0.257423, -0.620569, -0.317679, -0.250212, -0.370734, -0.395797, 0.171385, -0.384708, 0.736009, 0.0955049, 0.443128, -0.695171, 0.158483, 0.884616, 0.0911429, -0.0353967, -0.11926, 0.744549, 0.197717, 0.615376, 0.567566, -0.620893, 0.347457, -0.541165, -0.863479, -0.253576, -0.990809, 0.141404, -0.468518, 0.853298, 0.615827, -0.492115, -0.4223, -0.0277307, 0.545039, -0.703421, 0.0723838, -0.0353389, -0.47076, 0.203681, -0.549703, 0.141298, -0.291332, -0.67173, 0.741202, 0.502525, 0.315111, -0.319514, 0.130874, -0.207278, 0.000479407, -0.287424, 0.0175629, -0.622883, 0.936093, -0.0864316, -0.0381886, -0.772741, 0.35754, -0.956068, 0.666399, 0.302993, 0.672063, -0.28462, -0.102212, -0.983082, 0.937243, -0.181133, 0.330169, -0.854965, -0.0595588, 0.690343, -0.949839, 0.922921, -0.704499, -0.462451, -0.963301, 0.271777, -0.229344, -0.0516503, 0.251436, -0.78344, -0.291127, -0.461942, 0.136986, -0.749476, -0.472365, -0.41044, -0.0381818, -0.123187, -0.987618, -0.0818936, 0.174188, -0.199078, -0.499177, -0.953215, -0.0314443, -0.8586, 0.296074, 0.393598, -0.190411, -0.939265, -0.225037, -0.8259, 0.964249, -0.376648, -0.961088, -0.989894, 0.614189, 0.203785, 0.0502424, -0.692354, -0.515342, -0.724781, 0.0890495, 0.103114, -0.212789, 0.354825, 0.246784, 0.301953, 0.338048, 0.573745, 0.788149, -0.736827, -0.785948, -0.835639, -0.041888, 0.143196, 0.934387, 0.831679, -0.667954, 0.787346, -0.291488, -0.938216, -0.762812, -0.36505, -0.842847, -0.00516456, -0.430825, -0.732888, -0.999733, 0.718387, -0.031281, -0.96664, -0.794593, -0.678992, 0.367167, -0.224319, -0.232384, -0.0196903, -0.448951, 0.343127, -0.802939, -0.610356, 0.518555, 0.722065, -0.725715, -0.518027, -0.372311, -0.866837, -0.817807, -0.736982, 0.234493, -0.301809, 0.0178525, -0.479692, 0.286114, 0.511145, -0.0474816, 0.56374, 0.709998, 0.351166, 0.232719, 0.517316, -0.126023, -0.156578, -0.374835, 0.849887, -0.999627, 0.410468, -0.54974, -0.340872, 0.274447, -0.894723, -0.370833, 0.11523, 0.184067, -0.529048, -0.0901049, -0.448957, -0.401633, 0.010417, 0.0754969, 0.818146, -0.424543, 0.0179903, -0.862927, 0.91992, -0.349151, -0.82253, -0.252138, 0.374841, -0.986979, 0.923702, 0.759176, -0.246195, -0.731283, 0.662252, 0.640981, 0.212686, -0.48104, 0.735485, 0.406288, 0.0707651, 0.233993, -0.188663, 0.0184622, -0.516618, -0.940348, 0.0629512, -0.699758, -0.590501, -0.82981, -0.0408295, -0.917793, 0.673622, -0.290375, -0.190527, -0.305213, -0.113463, -0.851216, -0.457385, -0.69867, 0.345236, -0.974795, -0.137511, -0.874295, 0.063011, -0.278491, 0.201065, -0.210304, 0.207205, -0.281034, 0.024787, -0.788899, 0.613322, -0.0680114, 0.943619, -0.781546, 0.375501, 0.215341, -0.716346, 0.105238, -0.37418, 0.95706, -0.132581, 0.243272, -0.664814, -0.240987, -0.973615, -0.154074, -0.769342, -0.292776, -0.801701, -0.849013, 0.793679, -0.408971, -0.649212, 0.945209, -0.107562, 0.825525, 0.769074, -0.917018, -0.00438018, -0.812127, 0.393748, 0.328947, -0.389098, -0.627285, 0.704662, -0.127078, 0.276501, 0.423606, 0.800925, -0.865851, 0.255233, -0.255065, -0.246208, 0.571682, -0.916623, -0.653646, -0.0323827, -0.137326, -0.276313, 0.341608, -0.462931, 0.441849, -0.503999, 0.0495941, -0.398702, 0.363261, 0.751151, -0.491225, -0.48994, -0.858621, 0.498601, 0.0524835, -0.195683, 0.956734, 0.843759, -0.712051, 0.228206, 0.819085, 0.307335, -0.359916, 0.659672, -0.990233, 0.876154, 0.047672, 0.406881, -0.224863, -0.319793, 0.917309, 0.334181, -0.0346211, 0.0870227, -0.382163, 0.905178, 0.425614, 0.722276, 0.0434588, -0.848937, 0.876688, 0.228841, -0.425453, -0.713011, 0.0272983, 0.949031, -0.124608, 0.727224, 0.522584, -0.772355, -0.948057, -0.626764, 0.316554, -0.0336607, -0.478189, -0.159719, 0.636066, -0.581499, 0.150002, -0.89137, 0.034364, -0.465224, -0.697767, -0.566158, 0.479009, -0.672756, 0.900874, -0.509841, 0.199602, 0.607201, -0.580658, -0.860871, 0.975221, 0.806535, -0.54868, 0.383763, -0.353573, -0.895361, 0.526863, -0.296658, 0.809192, 0.789418, 0.457585, 0.206891, 0.145071, 0.570101, 0.346264, 0.524004, 0.47978, 0.816948, 0.517736, 0.879878, 0.334554, 0.027188, -0.665008, 0.389121, -0.582644, 0.105134, 0.992483, -0.179952, -0.754124, -0.356794, -0.0603248, -0.0258247, 0.0922533, 0.909471, 0.304963, -0.0564561, 0.415195, 0.727094, 0.0513469, 0.349646, 0.0495683, 0.621417, -0.812165, -0.887343, -0.887266, 0.43301, -0.523519, 0.497898, 0.129855, -0.967071, -0.0179143, -0.341839, 0.253318, -0.675276, 0.199591, -0.469552, -0.387088, 0.875781, 0.0444535, 0.421424, 0.43128, 0.657924, 0.480075, -0.456917, 0.974519, 0.0569172, -0.0318122, 0.610458, -0.325521, -0.59283, -0.905769, -0.10115, 0.80915, 0.0494216, 0.141539, -0.737539, -0.871322, -0.939211, -0.89965, 0.761722, -0.701816, -0.13014, -0.422071, -0.849242, -0.561701, -0.139535, -0.266484, 0.132742, -0.126766, -0.0331834, -0.591279, -0.277673, -0.408883, 0.960887, 0.360541, 0.736227, -0.357944, 0.910054, 0.220573, 0.39031, 0.853042, -0.811787, -0.985409, -0.726743, 0.508773, 0.319623, 0.479917, -0.0976045, 0.978323, -0.253413, 0.752057, 0.686076, 0.0176678, -0.234468, 0.0998526, 0.213042, -0.735592, 0.432814, -0.239722, -0.729282, 0.928339, 0.725921, 0.0618323, -0.573738, -0.884351, -0.123289, 0.87731, 0.183974, 0.0347044, -0.550623, 0.247355, -0.0860886, 0.147438, -0.607662, -0.718213, -0.0189771, -0.997719, -0.789526, -0.519044, 0.782984, 0.156805, 0.460784, -0.211401, -0.38344, 0.297872, 0.698849, -0.620159, 0.578626, -0.0180449, 0.881134, -0.148712, -0.512986, -0.0233009, 0.0290485, -0.0981266, -0.778935, 0.885251, 0.154877, -0.678955, -0.718879, -0.652898, -0.687879, 0.793007, 0.145438, -0.824477, -0.167499, 0.0566709, -0.201605, -0.0766303, -0.532673, 0.147739, -0.808469, -0.169692, 0.180258, 0.558844, -0.449804, 0.127276, -0.525471, 0.756255, 0.824983, 0.990426, 0.832168, 0.645066, -0.572097, -0.543179, -0.409134, -0.919128, 0.0646984, 0.49381, -0.0472401, -0.363651, -0.548217, -0.974273, 0.0429828, 0.813118, -0.253769, -0.547183, -0.104076, -0.130926, -0.00987201, -0.880979, -0.749087, 0.965486, 0.665041, -0.762779, -0.0998958, 0.48991, -0.726843, 0.321228, -0.988175, -0.844981, -0.286637, -0.428255, -0.348911, 0.738192, 0.643646, -0.0856894, 0.101095, -0.898517, -0.26098, -0.275565, -0.617904, 0.316485, 0.925941, 0.265049, -0.244817, -0.438157, 0.220948, 0.66644, 0.40317, 0.947657, 0.81564, 0.473796, 0.470631, 0.0451944, 0.128968, -0.186088, -0.983607, 0.324765, 0.146418, 0.656227, 0.369115, 0.544329, -0.505557, -0.122224, -0.297851, -0.792097, -0.675329, -0.85389, 0.128179, 0.0506574, 0.0764378, -0.525983, 0.120813, 0.0174665, 0.879712, 0.702839, 0.240264, -0.180415, -0.420429, -0.425485, -0.52662, 0.333281, -0.352165, -0.502039, -0.050703, 0.925698, -0.966016, 0.812321, 0.231126, 0.790407, 0.4691, -0.992359, -0.180901, 0.563826, 0.711794, -0.845029, -0.424263, 0.296618, -0.401473, 0.629839, 0.973606, 0.504787, -0.494856, 0.4354, -0.248129, -0.787728, -0.635729, 0.498937, -0.463657, -0.93941, 0.674249, 0.447597, -0.850953, -0.130163, 0.662889, 0.862808, 0.56142, -0.433631, 0.237213, -0.986518, -0.411944, 0.36288, 0.934138, -0.850354, 0.767128, 0.0244617, 0.697808, 0.219752, -0.264832, -0.433834, 0.79885, -0.12729, -0.245691, 0.263063, -0.297201, 0.997252, -0.721502, -0.76669, 0.67646, 0.969126, 0.220708, -0.936777, 0.633644, -0.795425, 0.969132, 0.980426, 0.685059, -0.193997, 0.0150119, 0.220786, -0.883539, 0.70793, 0.934658, -0.567215, 0.033463, -0.656111, -0.364405, 0.932043, 0.602558, 0.224834, -0.647421, -0.245481, 0.856631, 0.30229, -0.918489, -0.773916, 0.863044, -0.458525, -0.66248, 0.998095, 0.376733, -0.185656, 0.0895254, -0.601401, -0.973224, -0.50934, -0.297285, -0.478072, -0.468628, 0.237649, 0.198741, 0.650587, 0.882588, 0.186696, -0.232453, 0.240518, 0.0977873, -0.335702, 0.734854, -0.153769, -0.740638, 0.875623, -0.594183, 0.107034, 0.769068, -0.299342, 0.329604, 0.0584489, 0.422906, 0.185151, -0.354491, -0.377338, -0.405484, -0.727584, 0.14121, 0.664902, 0.226365, -0.0596538, 0.865627, 0.406436, 0.480892, 0.839055, 0.801772, -0.570416, 0.626609, -0.657808, 0.992972, -0.856423, 0.685432, -0.534972, 0.294739, 0.354292, 0.933972, 0.523403, 0.0318042, -0.60784, -0.662385, -0.69791, 0.567641, 0.631595, -0.834669, 0.737179, -0.52966, -0.621139, 0.104708, 0.98541, -0.760518, -0.357114, 0.176816, -0.355684, -0.490821, -0.144373, -0.775595, -0.903408, 0.769347, 0.276762, 0.157217, 0.909085, -0.884144, -0.3198, 0.425052, -0.871298, -0.91891, -0.163336, 0.893645, 0.356797, -0.549714, 0.029368, -0.987827, 0.272991, -0.495311, 0.816308, -0.881842, 0.253383, 0.483056, 0.498232, -0.917594, -0.0829249, 0.658198, 0.969513, -0.459759, 0.964048, 0.635124, 0.916579, 0.309978, -0.206831, -0.836084, 0.770064, 0.0418229, -0.55167, -0.110248, 0.0744013, 0.174944, 0.858063, -0.983848, 0.974663, 0.975724, 0.732312, -0.716693, 0.973854, -0.0167264, 0.621132, -0.173307, -0.150857, -0.505804, 0.167501, 0.655923, -0.670856, -0.159505, 0.810304, -0.653294, -0.414402, 0.906427, 0.326444, -0.312381, -0.931831, -0.0317917, -0.660686, -0.800389, -0.026784, 0.837934, -0.0422853, 0.114348, -0.282416, 0.726645, 0.0362227, -0.117952, 0.152931, -0.0323933, -0.346472, -0.234586, 0.398493, -0.00444546, 0.7245, 0.04314, 0.746386, -0.178331, -0.694691, 0.0585024, 0.118503, -0.0192153, 0.0583733, 0.696868, -0.18472, 0.637027, 0.795833, -0.245273, -0.469449, -0.12379, 0.169716, 0.159657, 0.260611, 0.583836, 0.224261, -0.196857, 0.0612893, -0.721422, 0.0720474, -0.367363, -0.250011, 0.523712, -0.616199, -0.136004, -0.920658, -0.892921, -0.991962, -0.052254, 0.666082, 0.249168, 0.365253, -0.739624, 0.490433, 0.893459, 0.0969437, -0.913335, 0.398922, -0.667862, 0.337147, 0.533076, 0.819216, 0.325734, 0.787628, -0.656784, -0.042821, 0.665016, -0.359737, -0.849105, -0.497349, -0.489738, -0.91792, 0.0225291, 0.786253, 0.591205, -0.0598483, 0.376094, 0.798264, -0.0855135, -0.00703836, -0.0576206, 0.720982, -0.846576, 0.371656, 0.398525, 0.582526, -0.2854, 0.532047, 0.662026, 0.762984, 0.464148, -0.394893, 0.85964, 0.00370336, -0.704632, -0.825892, 0.0257989, 0.434094, -0.131858, -0.856215, -0.21768, 0.187362, -0.359839, -0.153973, 0.065643, -0.355343, 0.0838681, -0.347406, 0.635324, -0.811083, -0.524153, -0.0981265, -0.391796, 0.856959, 0.771633, 0.391196, 0.803258, -0.301362, 0.610708, -0.0181959, 0.12803, -0.742928, 0.285018, 0.556505, 0.454791, -0.544647, 0.651341, -0.488794, 0.969818, -0.880172, -0.236681, -0.692155, 0.796192, -0.247376, -0.391801, 0.639361, -0.747212, -0.611881, 0.56748, -0.184545, -0.26209, -0.13381, -0.180076, -0.84164, 0.76606, -0.0529027, 0.200002, 0.989621, -0.97813, 0.0945381, -0.70616, 0.994447, 0.504707, 0.676777, 0.487885, 0.299434, -0.715086, -0.375489, 0.257191, -0.714651, -0.142936, -0.029156, -0.203069, -0.559457, -0.286795, -0.579669, -0.286126, -0.972081, -0.345562, -0.902255, -0.528364, 0.766575, -0.788478, -0.444656, 0.926347, -0.0367559, -0.87206, 0.105223, -0.60203, -0.866086, -0.918878, -0.195539, 0.961734, -0.817049, -0.132881, -0.164009, 0.784116, 0.751075, -0.418035, 0.221271, 0.954256, -0.280857, -0.623149, 0.574387, -0.105604, 0.233876, -0.766638, -0.194459, 0.389059, -0.961824, 0.933839, 0.174937, 0.428181, 0.915382, 0.0249728, -0.905372, 0.352728, -0.0652544, 0.260511, -0.784058, 0.835967, -0.851414, -0.468515, -0.297957, 0.224222, 0.704718, 0.0882926, 0.552862, 0.760012, 0.623674, 0.816044, -0.74784, 0.285315, -0.209784, 0.98552, 0.200607, -0.441543, 0.70995, -0.205456, -0.215088, 0.360091, 0.530321, 0.939135, -0.804026, 0.43852, -0.8679, 0.194431, -0.65302, 0.694851, 0.809049, -0.946678, -0.0944932, 0.977962, -0.118654, -0.869769, -0.306489, -0.142267, 0.408622, -0.576452, -0.659707, 0.936578, 0.541983, -0.893139, 0.573631, 0.48631, 0.552296, 0.337834, -0.600036, 0.0405568, 0.891182, 0.884964, 0.256157, 0.0401418, -0.334031, 0.238755, -0.519396, -0.337746, 0.284413, 0.0113427, 0.564458, 0.947247, 0.169279, 0.130889, -0.15697, 0.700855, 0.729217, 0.485614, 0.419652, 0.0634355, -0.948619, -0.841626, -0.741677, 0.260235, -0.346904, -0.379817, 0.767775, 0.688064, 0.726643, 0.657095, -0.503182, -0.492036, 0.668691, -0.0306138, 0.645902, -0.27541, -0.696969, 0.598232, -0.710015, 0.94939, 0.635687, -0.494653, -0.186009, -0.615552, 0.183482, -0.745112, 0.352394, 0.465206, -0.362897, -0.666693, 0.510901, 0.788524, -0.0534275, 0.212999, 0.369475, -0.837724, 0.241022, -0.781314, -0.879898, 0.441666, 0.73191, 0.433228, 0.60923, 0.756786, 0.393339, 0.0802786, 0.65122, 0.855992, 0.800284, 0.367888, -0.886234, 0.145701, 0.257103, 0.631398, 0.600069, -0.282579, -0.881111, -0.929764, -0.993277, -0.307385, -0.103888, 0.548564, 0.939898, 0.147547, -0.333371, -0.548657, -0.0966924, -0.492267, -0.425992, 0.994943, -0.188822, 0.257242, -0.832717, 0.940532, -0.817687, -0.707001, 0.826007, 0.876688, 0.0682459, -0.796566, -0.789845, -0.341921, -0.207989, 0.584127, -0.494138, 0.064651, -0.860131, -0.271613, 0.140534, -0.318864, 0.249661, -0.937679, -0.987204, 0.952581, 0.588451, -0.748312, -0.0114441, 0.938186, 0.67322, 0.762847, 0.512281, 0.405335, -0.0621642, 0.972969, -0.0506358, -0.72409, -0.670075, -0.156772, 0.488175, -0.63767, 0.90419, 0.185218, -0.152888, -0.673464, 0.456385, -0.866448, -0.0310991, 0.701118, 0.422941, -0.173008, 0.93546, -0.055998, 0.0869285, -0.303044, -0.576038, -0.666831, 0.69118, -0.558837, -0.644695, 0.190731, 0.974399, 0.152386, 0.614861, -0.116109, -0.0172817, 0.685839, -0.669683, 0.272703, 0.0262058, 0.830621, 0.544017, -0.97866, 0.733998, 0.0644116, -0.472292, -0.24657, -0.539322, 0.206403, -0.831741, 0.206471, -0.147576, 0.82538, -0.397283, 0.304965, 0.215168, -0.431912, -0.782208, 0.99897, -0.601113, 0.890088, 0.675508, -0.527615, -0.954007, -0.719682, 0.615429, 0.278653, 0.0280504, 0.136281, 0.832253, 0.331473, 0.500389, -0.875855, 0.825165, -0.703244, -0.0232524, -0.184188, 0.466924, 0.222014, 0.501181, 0.143012, -0.785919, -0.216293, -0.610609, 0.41675, 0.466024, -0.104547, -0.181653, -0.640082, 0.875476, 0.671861, 0.371344, 0.45832, 0.269023, 0.657281, -0.960998, 0.551162, -0.733008, -0.928714, 0.359749, 0.966619, -0.654088, 0.612561, -0.848861, 0.853774, 0.671444, 0.172067, -0.152744, 0.23711, -0.368008, -0.495367, 0.205775, 0.308033, -0.960218, -0.805219, -0.950065, -0.0848767, 0.124351, 0.992613, 0.668941, 0.235889, -0.921837, -0.364345, 0.661592, 0.148531, -0.209326, 0.0441641, -0.321453, 0.354463, -0.650026, -0.264476, 0.237409, 0.622269, 0.28532, -0.516647, -0.149272, -0.203512, -0.166555, -0.465471, -0.311923, -0.644595, 0.745069, -0.399548, -0.659466, -0.0821394, -0.0212442, 0.151744, -0.644978, -0.90067, -0.727556, -0.451274, -0.717219, 0.525617, -0.0185358, 0.107152, -0.208039, 0.67947, -0.493873, -0.37988, -0.145486, -0.014452, -0.299701, 0.767025, 0.831274, 0.653973, 0.281556, -0.348245, -0.699363, -0.97008, -0.964421, 0.2548, -0.39059, -0.715649, -0.0526437, -0.396458, -0.796939, 0.135089, -0.0699719, -0.428802, 0.508202, -0.202006, -0.0520502, -0.641975, 0.732924, 0.232798, 0.221436, -0.802325, -0.592535, 0.523437, 0.586109, -0.0374358, 0.844869, 0.217676, 0.258027, -0.669875, 0.183201, 0.443478, 0.329685, 0.412398, -0.908612, 0.616312, 0.342724, 0.467451, 0.0297631, 0.321423, 0.367286, -0.146123, -0.174459, -0.768794, 0.379857, -0.46219, -0.528694, -0.134638, 0.557266, 0.0554368, -0.502075, -0.296073, 0.80726, -0.956026, 0.0626876, 0.534152, -0.172826, 0.533704, -0.749879, -0.489367, 0.911748, -0.913065, -0.75097, 0.318539, -0.247238, -0.073863, -0.339434, 0.0368516, -0.26438, 0.950548, -0.760225, -0.574593, -0.0391395, -0.24512, 0.392931, 0.510998, 0.0645196, 0.459159, -0.0314268, 0.863899, 0.334543, 0.815854, -0.977557, 0.727226, 0.727517, 0.747119, 0.924975, 0.230192, -0.928201, 0.633891, -0.416659, -0.353225, -0.377942, 0.0312095, 0.593096, -0.842456, -0.606395, -0.5621, -0.287685, 0.374724, -0.413259, 0.423718, -0.377557, -0.156269, 0.0581462, 0.87593, 0.515677, 0.862348, 0.975547, -0.998974, 0.553193, -0.700178, -0.912644, 0.721916, -0.931224, -0.924753, -0.958246, -0.500938, 0.54295, -0.576395, -0.750279, -0.269897, -0.116787, -0.0179532, -0.890457, 0.217691, -0.127373, 0.341912, 0.729693, 0.42835, 0.832078, -0.796154, 0.71362, 0.381493, 0.809935, 0.871006, 0.177478, -0.0224721, -0.45563, 0.27456, -0.226008, -0.583485, 0.823678, -0.589511, 0.723213, -0.821261, 0.253877, -0.251676, -0.789557, 0.346307, 0.14868, 0.179807, -0.522446, 0.276696, 0.935395, 0.700269, 0.706412, 0.323855, -0.656215, -0.749213, 0.727653, 0.129855, -0.783575, 0.784275, -0.0710458, -0.126812, 0.604857, -0.228008, 0.712671, 0.373256, 0.613357, -0.500424, 0.00722654, -0.338555, 0.550538, 0.549675, -0.139302, -0.642226, -0.16782, -0.718182, -0.156485, 0.719811, -0.660459, 0.800862, 0.738667, 0.849458, 0.943848, -0.0674716, -0.712507, -0.834306, 0.459211, -0.575865, -0.00746871, -0.93198, -0.135021, 0.384671, 0.614547, -0.481773, -0.555361, -0.266924, 0.608072, 0.275245, -0.816834, 0.496629, -0.0212406, -0.962065, 0.759293, 0.720718, 0.777058, -0.743752, -0.609862, -0.346278, -0.870674, -0.962758, 0.248687, 0.51649, 0.824246, -0.228401, 0.0405326, -0.811137, 0.668711, 0.817211, 0.412117, 0.260271, -0.701422, 0.571036, -0.904865, -0.405258, 0.971389, 0.431382, 0.124737, 0.013488, 0.573467, -0.442848, 0.544679, -0.955663, -0.380077, 0.7627, -0.361622, -0.678355, -0.0939086, 0.592781, 0.336301, -0.528974, 0.294972, 0.621518, 0.998257, 0.47814, 0.832455, 0.300173, -0.860985, -0.378098, -0.276848, 0.500573, -0.379636, -0.954267, -0.541921, -0.224908, -0.336541, -0.419211, 0.209662, -0.795672, 0.0538498, 0.740055, 0.54574, 0.638195, -0.451676, -0.0837981, 0.933574, 0.994417, 0.298432, -0.965845, -0.929718, -0.0295963, -0.289527, 0.607441, -0.159695, 0.492464, -0.0573608, 0.882444, 0.819787, -0.143521, -0.388852, 0.944829, 0.78794, -0.1031, 0.218494, 0.866776, -0.0246053, 0.151291, -0.78458, -0.299467, -0.412305, -0.331006, 0.139162, 0.342993, 0.503573, -0.270518, 0.900574, -0.644918, -0.882974, 0.394317, 0.170576, -0.22735, 0.826114, 0.780274, 0.899789, 0.921928, -0.522846, -0.883957, -0.485563, -0.586485, 0.973372, 0.805837, 0.865353, -0.364979, -0.259224, 0.663342, -0.248873, -0.212337, 0.488576, 0.804114, -0.253761, 0.393096, 0.465109, -0.274296, -0.27211, -0.256456, -0.624902, -0.749709, 0.626763, -0.931372, 0.0310139, -0.563037, 0.956947, 0.0469378, 0.0221966, 0.744205, -0.169975, -0.515079, 0.756298, 0.463515, 0.21621, -0.569749, -0.920706, -0.131896, -0.760321, 0.0338467, 0.684937, 0.143978, 0.882622, 0.0695464, -0.658492, 0.73068, 0.68038, -0.977605, 0.893886, -0.234078, 0.425112, -0.894039, 0.449475, 0.0465965, -0.475817, 0.162741, 0.266609, -0.509584, 0.122635, -0.507445, -0.164012, 0.825971, 0.0264129, 0.540145, -0.551388, 0.0426171, 0.506651, 0.59926, 0.109892, 0.204282, -0.853945, -0.969224, 0.796975, 0.370635, -0.88483, -0.855603, 0.116328, -0.539256, -0.577929, -0.485695, -0.238981, 0.16146, 0.780021, 0.52012, 0.123375, -0.0442667, 0.996524, -0.458534, 0.180602, -0.114425, -0.950297, -0.314385, 0.801746, -0.557406, 0.656254, -0.781632, -0.195748, -0.58138, 0.970255, 0.0793099, 0.961668, 0.223413, -0.264656, -0.655573, 0.745808, -0.59523, 0.639601, 0.537296, -0.715152, 0.418816, -0.747065, -0.931102, -0.3368, 0.556521, 0.6944, -0.371235, 0.152451, -0.59847, -0.372867, -0.139017, -0.581571, -0.884198, 0.605835, -0.530255, -0.127385, 0.869167, -0.871866, -0.807763, 0.566881, -0.788596, 0.749826, -0.747877, -0.673937, -0.7877, 0.377746, -0.0338107, -0.867185, -0.12789, -0.382397, -0.412754, 0.904742, -0.549925, -0.150185, 0.956082, 0.75488, -0.935074, -0.0985989, -0.191852, -0.601479, 0.0672114, -0.646625, 0.846873, -0.397819, -0.9015, 0.374211, 0.136509, 0.955177, 0.639766, -0.623816, -0.730311, 0.973171, 0.736319, -0.348113, -0.552703, 0.565204, -0.997929, 0.241935, 0.106125, -0.107399, 0.174622, 0.178441, 0.526198, 0.461465, 0.120551, 0.396435, 0.98616, -0.551768, -0.149861, -0.644369, -0.228837, 0.876622, -0.513255, 0.445154, 0.271298, -0.6274, -0.487675, -0.418422, -0.354155, 0.22444, -0.866315, -0.450841, -0.435667, 0.823092, 0.119972, 0.235382, 0.272104, 0.108384, 0.19011, 0.716046, 0.0794511, 0.105769, -0.194592, -0.109464, -0.974756, 0.757801, -0.209578, 0.302134, -0.00106042, -0.871725, -0.764312, -0.577779, -0.394765, -0.43148, 0.598694, -0.827786, 0.447281, 0.203353, 0.625003, 0.10541, 0.264514, 0.474437, 0.677583, -0.777357},
-	{-0.406163, -0.00840805, 0.829529, 0.864351, -0.0621496, 0.9125, 0.540026, -0.167349, 0.543319, 0.391116, -0.757166, -0.889434, 0.950621, 0.113576, -0.956313, 0.176163, 0.561807, -0.0229148, -0.535422, 0.676962, -0.595396, -0.981471, -0.0688237, -0.708308, 0.951566, 0.22554, 0.0796077, -0.362861, 0.0440576, -0.935761, 0.178935, -0.431298, -0.799367, -0.676637, 0.543907, -0.504996, 0.493137, 0.0108133, 0.0378622, 0.0411343, 0.608829, -0.574106, -0.530029, 0.660261, 0.890659, -0.643203, -0.0346726, -0.838304, -0.229484, -0.478752, 0.559559, 0.375533, 0.407162, -0.0651128, -0.470443, -0.842806, -0.369638, -0.763373, -0.00742426, 0.108781, 0.0193957, -0.623707, 0.271154, -0.425987, 0.774539, 0.438367, -0.438226, 0.834063, -0.237602, -0.00642674, 0.29536, 0.131724, -0.627727, -0.544593, -0.0121239, 0.954368, -0.179622, -0.967615, -0.243617, -0.0938924, 0.488126, -0.549004, 0.0234363, 0.297613, -0.360033, -0.866064, -0.982927, 0.788166, -0.717112, 0.292934, -0.280595, -0.660573, -0.7834, 0.343195, 0.531405, -0.507112, 0.428622, -0.11226, -0.871604, 0.576467, -0.318898, 0.0704147, 0.3457, 0.427649, 0.42465, 0.341669, -0.227052, -0.942443, -0.96201, -0.558387, -0.816731, -0.147556, -0.355732, 0.204114, -0.538596, -0.351156, -0.366909, -0.0808338, 0.518995, -0.100986, -0.404856, 0.520447, -0.451699, -0.621428, 0.0318137, -0.6145, 0.534894, 0.56024, -0.403828, -0.831933, -0.132943, -0.0626475, -0.946208, 0.360271, -0.25355, 0.985977, -0.844971, 0.512288, -0.352191, 0.499549, 0.323048, -0.359759, -0.300832, -0.121278, 0.787036, 0.495937, -0.43335, 0.866522, 0.112107, -0.402903, -0.187373, -0.258782, -0.930499, 0.0828197, -0.946124, -0.308014, 0.0919787, 0.837294, -0.866475, 0.785901, 0.775185, 0.452171, 0.43309, 0.738737, -0.330171, 0.43973, -0.342579, -0.352963, 0.0498529, 0.208317, -0.221989, 0.704293, 0.995235, -0.854472, 0.0891687, -0.516496, -0.29243, 0.98254, -0.908589, 0.672173, -0.291342, 0.606244, -0.792565, 0.453474, 0.860452, -0.087181, -0.354039, -0.318371, 0.583108, 0.454956, 0.0177311, -0.671815, -0.0363514, -0.56522, 0.239761, -0.0300036, 0.981255, -0.304332, 0.670792, -0.0641485, 0.132809, -0.738087, -0.378899, 0.960565, -0.78312, 0.377718, 0.0366612, 0.274151, -0.696403, -0.0628432, 0.844255, -0.93413, -0.904598, 0.32369, -0.824423, -0.468033, 0.625594, 0.322693, -0.276976, 0.736821, 0.275896, -0.741486, 0.858786, -0.264534, 0.390021, -0.572234, -0.997155, 0.45467, -0.877652, -0.184056, 0.947472, -0.195936, -0.116502, -0.519557, -0.215903, -0.367464, 0.698618, 0.850293, 0.839581, 0.102775, -0.587062, -0.0599835, 0.821015, -0.424207, -0.959246, -0.215174, 0.226935, 0.0323548, 0.0781691, -0.998793, 0.0362018, -0.912311, -0.238936, 0.673012, -0.37356, 0.394347, 0.844208, -0.449338, 0.406002, -0.584786, 0.409797, -0.750437, 0.0719265, 0.892298, -0.745864, 0.735737, -0.446049, -0.115376, 0.97098, 0.416254, 0.403237, 0.718875, -0.542427, -0.259533, -0.505351, 0.508632, -0.755638, -0.00396727, -0.903478, 0.364842, -0.903219, 0.729323, -0.92901, -0.372462, 0.454686, -0.830503, 0.627377, 0.759124, 0.00536236, 0.153129, 0.5261, -0.40475, 0.525847, -0.68609, -0.843093, 0.0607262, -0.0131038, 0.50332, 0.792303, 0.753551, 0.69392, 0.618446, 0.534322, 0.0279574, 0.0964576, 0.429276, -0.904139, 0.37731, 0.832397, -0.944268, 0.392188, -0.348533, 0.751423, -0.780216, 0.679485, 0.980079, 0.665431, -0.529585, -0.440422, -0.293978, -0.147896, -0.475051, 0.241137, -0.897239, -0.831017, 0.182758, 0.374031, 0.755007, -0.714034, -0.771398, 0.866393, 0.901726, -0.535009, -0.664193, -0.593288, -0.300152, 0.0661258, 0.127862, -0.657973, -0.716794, 0.780702, 0.841658, -0.0510704, -0.84919, 0.236039, -0.990014, -0.787873, 0.770031, 0.660166, 0.532991, 0.00666624, 0.895253, 0.848012, -0.960441, -0.972857, 0.500974, 0.239217, -0.40356, -0.360422, -0.444437, -0.407076, 0.429796, 0.824529, 0.053562, 0.222777, -0.0369753, -0.124804, -0.212839, -0.892893, -0.727727, 0.765053, 0.0589594, -0.413793, -0.217319, -0.063963, -0.555351, 0.360201, -0.949765, 0.67359, -0.176205, 0.167936, 0.249698, -0.11815, 0.624144, 0.384645, 0.25072, -0.374082, 0.668322, 0.871441, 0.496916, -0.853339, -0.016917, 0.761641, 0.874229, 0.470762, 0.788951, 0.910492, -0.445896, -0.755175, 0.889928, -0.868181, -0.078325, -0.124338, 0.33694, -0.778474, -0.0201437, -0.517331, 0.876076, 0.610011, 0.942554, -0.124818, 0.567057, 0.0420097, -0.581327, -0.740252, -0.289418, 0.438629, -0.10704, 0.375594, 0.326705, 0.147316, -0.768228, -0.418696, 0.249921, 0.181346, -0.497737, 0.597893, -0.189826, -0.0333771, -0.709417, 0.257602, 0.802999, 0.0119506, 0.597628, -0.83835, -0.116019, -0.947583, -0.948246, 0.5369, 0.651424, 0.0283019, 0.560176, 0.242055, -0.640427, 0.52577, -0.122315, -0.676125, 0.659049, 0.981962, -0.70392, -0.463856, -0.6284, 0.0457958, -0.329335, 0.606002, 0.851754, 0.821354, -0.368709, -0.753083, 0.811618, 0.31658, -0.505085, 0.314736, -0.183489, -0.51064, 0.115193, 0.268471, -0.761504, -0.396619, -0.575718, -0.0501885, -0.985668, 0.782527, 0.940193, 0.584505, -0.847862, -0.266001, -0.0667647, 0.55243, 0.0342585, -0.993172, 0.611294, -0.798832, -0.963041, -0.145325, -0.0641837, -0.625886, 0.950502, 0.394841, 0.747255, -0.322509, 0.670218, -0.301232, 0.0370502, 0.731756, 0.627917, -0.361708, 0.101472, 0.317079, 0.520793, -0.981411, -0.0323834, -0.862553, 0.169037, -0.358385, 0.853948, 0.740936, -0.931576, -0.0311834, -0.557585, -0.843416, 0.734172, 0.703568, -0.563413, -0.254025, -0.978146, 0.953591, 0.929996, -0.677968, -0.871425, 0.94098, -0.337268, 0.86493, -0.770336, 0.766372, 0.699367, -0.281081, -0.431116, 0.799624, 0.173147, -0.162606, -0.620531, 0.757068, 0.210022, -0.0310135, -0.981284, 0.28223, 0.972183, 0.662529, -0.380198, 0.889028, -0.506183, -0.517465, 0.173637, -0.93052, 0.114768, 0.38044, -0.0269562, 0.918992, -0.352419, -0.960736, -0.620487, -0.340395, 0.858636, -0.721873, 0.805181, -0.665382, 0.267198, -0.859639, 0.784484, 0.484449, 0.261723, 0.890627, -0.0425137, -0.492505, 0.46682, -0.0170441, -0.692969, -0.877864, -0.731975, 0.288451, -0.396968, 0.35103, -0.556156, 0.00723231, -0.361344, -0.307019, -0.543281, 0.445815, -0.518879, -0.609007, 0.737182, 0.917389, 0.1327, -0.670841, 0.235464, -0.450303, 0.00757086, -0.86992, 0.846795, -0.56204, 0.419768, 0.959917, -0.702655, 0.581023, -0.749201, -0.697429, 0.904438, 0.644857, 0.289975, -0.686864, -0.942104, 0.63778, 0.234936, -0.19832, -0.56541, 0.00635173, -0.757978, -0.394716, 0.0560853, -0.0848761, 0.596012, 0.111573, 0.805243, 0.142656, -0.906281, 0.113179, 0.870938, -0.768829, -0.902758, -0.37892, -0.804397, 0.927403, -0.0954949, 0.937903, -0.810265, -0.632612, -0.241204, -0.183089, 0.089225, -0.946803, 0.361024, -0.382883, -0.889571, 0.97148, -0.0931385, -0.403274, 0.525502, 0.940416, -0.695933, 0.872998, -0.523735, -0.0718948, 0.809937, 0.256035, 0.566249, -0.450507, -0.978257, -0.370376, 0.721061, 0.510842, 0.543523, -0.572927, 0.0582504, -0.989615, 0.369086, -0.00909519, 0.967222, -0.474646, 0.824313, 0.179804, -0.993542, 0.781582, -0.442495, 0.180997, 0.795051, -0.178201, 0.520612, -0.636206, -0.771355, 0.900295, 0.499428, -0.937815, 0.997854, -0.467442, -0.00945352, -0.851565, 0.203066, 0.423191, 0.980563, 0.358852, -0.153909, 0.559318, 0.814708, -0.22198, 0.246522, 0.871929, 0.416442, -0.245482, -0.747293, -0.400403, -0.242765, -0.53513, 0.228115, 0.987655, -0.414798, 0.799693, 0.658804, -0.693068, -0.342011, -0.521736, 0.489596, -0.100533, -0.59126, -0.256095, 0.478878, 0.186213, -0.318844, 0.221377, 0.20675, -0.605045, 0.086806, 0.890389, -0.173732, -0.400492, 0.671986, -0.411594, -0.911656, -0.626931, 0.441773, -0.0849397, -0.569709, 0.774199, -0.464848, 0.465761, -0.938535, -0.410976, -0.497238, -0.887559, -0.15832, -0.928094, 0.219487, -0.917115, 0.36903, -0.354287, 0.399109, 0.825611, -0.772013, 0.924296, 0.302616, -0.547384, -0.705685, 0.968842, -0.501701, 0.25732, -0.0631032, 0.964539, -0.53355, -0.332788, -0.0149236, -0.457434, -0.270423, 0.490397, -0.602295, 0.234469, -0.70359, 0.458332, 0.518172, -0.216502, 0.81346, -0.261673, -0.725818, -0.458303, -0.390348, -0.850423, 0.0729757, 0.227002, -0.772012, -0.667739, -0.552479, 0.667159, 0.0996603, -0.301994, 0.363925, 0.0243463, -0.0372645, 0.802825, 0.442198, -0.731851, 0.771613, -0.74868, -0.755663, -0.0547328, 0.807247, 0.427803, -0.902713, -0.703699, 0.693422, -0.128441, -0.789218, -0.744609, -0.391328, -0.773212, -0.0976929, -0.252026, 0.484229, 0.564391, 0.800021, -0.123245, 0.902176, 0.664496, -0.512038, 0.770232, 0.387938, 0.536239, -0.46852, 0.13854, 0.946637, 0.963904, 0.0158811, 0.219135, 0.360454, -0.9752, 0.00461825, 0.317176, -0.0310123, -0.786564, 0.402083, 0.931056, 0.542745, -0.0780908, -0.647777, -0.634999, -0.0436751, -0.893341, 0.394774, -0.95981, -0.226525, -0.563936, -0.17978, 0.952464, 0.29892, 0.607533, -0.553841, 0.500038, -0.0295283, 0.815816, 0.0139082, -0.754877, -0.333482, 0.101364, 0.539132, -0.932809, 0.823648, 0.0976794, -0.80329, 0.21964, -0.126645, 0.164489, 0.238456, -0.761408, -0.0073304, -0.610226, -0.201007, -0.365285, 0.00484448, -0.459951, 0.0743659, -0.897551, 0.569223, 0.757878, -0.2142, 0.56293, 0.749754, -0.641562, 0.0582829, 0.434683, -0.0265878, -0.556522, -0.536614, 0.386897, -0.844639, 0.702816, 0.332281, 0.986896, 0.376291, -0.115384, 0.380266, 0.97165, 0.538082, 0.643311, -0.90665, -0.712131, -0.762377, 0.198571, 0.943604, -0.367017, -0.894226, -0.626528, 0.789123, 0.485068, 0.888213, 0.838106, 0.0676499, -0.885085, 0.446626, -0.759734, 0.249541, -0.816555, -0.453608, -0.355718, 0.618656, 0.570842, 0.439654, -0.684024, -0.691285, -0.762521, -0.225106, -0.523424, -0.556183, -0.429198, 0.586316, 0.800781, 0.808877, 0.847622, -0.620455, -0.542194, -0.333528, 0.643045, 0.489975, 0.552098, 0.780723, 0.371782, 0.398018, 0.47955, 0.852534, -0.715968, 0.996063, 0.804058, 0.318253, -0.993051, 0.000712707, 0.690649, -0.0827739, 0.665988, 0.086194, 0.59039, 0.860963, 0.662084, -0.204197, 0.77378, 0.987072, -0.56085, -0.504747, 0.94748, -0.19461, -0.810275, 0.741822, 0.775896, -0.829755, -0.165121, -0.603981, 0.296533, 0.602172, 0.534504, -0.658239, 0.0970214, -0.799645, -0.352154, 0.21967, -0.08262, 0.810207, 0.661279, -0.581939, 0.390824, 0.0976867, 0.629463, -0.061319, 0.0112114, -0.491422, 0.466743, -0.123552, 0.613993, -0.961511, 0.385632, 0.451344, -0.526689, -0.577558, -0.26359, -0.943405, -0.474283, 0.693793, -0.749169, 0.810535, -0.442081, 0.288775, 0.370108, -0.810338, 0.339404, -0.182721, -0.83942, 0.654368, 0.865644, -0.28421, -0.404959, 0.139176, 0.248956, -0.756459, -0.611953, 0.168811, -0.660403, -0.668926, -0.386254, -0.420306, 0.784537, 0.755022, -0.859989, 0.725818, -0.595288, 0.147702, -0.0849874, -0.025311, 0.340126, 0.56728, 0.243858, -0.669234, 0.091201, -0.121031, -0.5209, -0.310665, -0.841203, 0.982925, -0.534675, 0.681777, -0.603708, 0.297886, 0.702111, -0.693162, -0.827539, 0.692235, 0.774236, 0.363946, 0.228724, -0.194878, 0.963354, -0.687601, 0.798468, 0.608901, 0.86735, -0.600702, -0.442892, -0.901321, -0.109198, -0.712812, -0.69253, 0.94604, -0.186347, -0.517798, -0.806984, 0.83057, 0.74563, 0.405417, -0.245348, -0.500872, 0.281766, 0.262639, -0.595607, 0.332203, -0.917568, 0.699611, 0.5914, 0.817039, 0.203039, 0.0591322, -0.30764, 0.334396, -0.591652, 0.421934, 0.886456, 0.442755, 0.79657, -0.211797, 0.511165, -0.163489, 0.379235, -0.460849, 0.557226, -0.795747, -0.434582, -0.185482, 0.538506, 0.742432, 0.506245, -0.715022, 0.439394, 0.851836, 0.538651, -0.283032, -0.850749, 0.141823, 0.973401, -0.572574, 0.4232, 0.680312, 0.067002, 0.728428, -0.947366, 0.477191, 0.860267, 0.334641, -0.568097, 0.760058, 0.682928, 0.420475, 0.226332, -0.42201, 0.79288, 0.317151, -0.502785, 0.488133, 0.83352, -0.578686, -0.644296, -0.866933, -0.116394, 0.892443, -0.390846, 0.553166, -0.931366, -0.925681, 0.406757, -0.131505, 0.397194, 0.0573855, -0.873096, -0.407216, 0.918886, 0.739265, -0.661867, -0.524672, 0.347733, 0.839915, 0.654984, -0.903951, 0.313249, -0.296569, 0.762103, -0.328664, -0.731519, 0.523918, 0.983545, -0.601035, 0.81029, 0.789721, 0.850221, -0.12056, 0.747581, 0.713352, -0.569878, 0.403663, 0.0389576, 0.542037, -0.993093, -0.107312, 0.473127, 0.815853, 0.422057, 0.799732, -0.0815059, -0.835578, 0.96994, -0.64906, 0.669442, 0.397334, -0.134392, -0.814981, 0.864563, -0.744678, -0.923224, 0.544761, -0.0137322, 0.47334, 0.881724, 0.379761, 0.426741, -0.998387, -0.903237, 0.927485, 0.3318, 0.10906, 0.966303, 0.0111294, -0.675532, -0.888962, -0.556078, 0.373285, -0.71708, 0.51978, -0.739749, 0.378892, 0.593013, -0.987117, -0.0363571, -0.261826, -0.35849, -0.861591, 0.633051, -0.520771, -0.715579, -0.424298, 0.371162, -0.967404, 0.0856532, -0.663699, 0.826465, -0.816942, 0.557525, 0.276867, -0.0628541, -0.99331, -0.116617, -0.450142, -0.0234652, -0.0339786, 0.17711, 0.407766, 0.0794514, 0.658581, -0.295795, 0.225406, -0.747263, 0.957147, 0.0539693, -0.582357, 0.205298, -0.517632, -0.0505373, -0.795657, 0.967534, 0.886248, 0.915121, 0.268976, -0.112142, 0.359847, 0.580255, 0.333915, -0.219733, -0.740722, 0.452609, 0.248469, -0.82171, 0.602379, 0.413223, -0.673409, -0.451134, 0.604816, 0.608839, -0.000108617, 0.721639, 0.406413, 0.405264, -0.423161, -0.493953, 0.234917, 0.501499, -0.315725, 0.194284, 0.960655, 0.437555, 0.103644, 0.397528, 0.595584, 0.537153, -0.843711, -0.212066, 0.857226, -0.272607, 0.587122, -0.068376, -0.952929, -0.907339, -0.454519, -0.388962, -0.723837, 0.112274, -0.782875, -0.433874, -0.179887, 0.815665, 0.675154, 0.017056, 0.145203, -0.385754, -0.85922, -0.0605036, -0.207937, 0.30819, 0.623796, 0.547566, 0.36464, -0.689644, -0.0388616, 0.296445, 0.961081, -0.967071, 0.665552, 0.495011, 0.950197, 0.79289, 0.636183, -0.10313, 0.461246, 0.766579, -0.675943, -0.517827, 0.685588, -0.166213, 0.35685, 0.162003, -0.302612, 0.775611, -0.736794, -0.0195956, 0.0853922, -0.0323534, -0.751464, -0.589444, -0.432142, 0.346695, -0.748289, -0.65597, 0.946326, -0.873943, 0.245633, -0.714258, 0.198443, -0.708419, -0.130987, -0.210448, -0.365092, 0.315865, 0.970608, 0.212695, 0.318883, 0.330619, 0.801877, 0.103688, -0.921303, -0.334708, -0.612515, 0.755006, -0.753019, 0.74984, 0.881753, -0.826335, -0.38124, 0.270425, 0.438243, 0.858763, -0.0967418, -0.697385, 0.310181, -0.903716, -0.344918, -0.746144, -0.00383382, -0.779982, -0.111584, 0.518936, -0.0373838, 0.209255, 0.673685, -0.130897, 0.558152, 0.24845, -0.544372, 0.766416, -0.356383, -0.622999, -0.904664, -0.594387, 0.763726, -0.300078, 0.955034, 0.00567643, 0.795862, 0.609814, -0.201348, -0.239367, 0.138622, -0.78334, -0.965738, 0.588595, 0.132087, -0.919325, -0.379724, -0.373648, -0.467141, -0.243406, -0.35595, -0.136718, -0.830582, 0.578243, 0.195626, 0.120633, 0.0528859, -0.800842, 0.332559, 0.100985, -0.1939, -0.167132, 0.387055, -0.574956, 0.909197, -0.263292, -0.489604, 0.238335, 0.764004, -0.87472, 0.199976, 0.0846217, 0.919491, -0.658964, -0.400442, 0.0933112, 0.303812, -0.175223, -0.235386, 0.985537, 0.906391, 0.142205, 0.485841, -0.802936, 0.202988, -0.284971, 0.818367, -0.350712, -0.000683752, 0.0147937, 0.180797, 0.221399, -0.0215927, -0.509027, -0.623071, -0.746045, -0.212154, 0.735643, 0.451732, 0.705512, -0.316951, -0.506141, 0.163006, -0.570506, -0.706862, -0.969133, -0.499787, -0.793935, 0.191812, 0.848516, -0.23495, -0.825009, -0.563464, 0.437025, 0.603443, 0.807658, -0.693851, -0.488104, 0.310881, 0.715821, 0.347917, -0.876519, -0.7241, -0.531645, -0.158126, -0.422505, 0.178334, 0.544399, 0.448285, -0.72637, 0.410484, 0.0678821, 0.607975, 0.718037, 0.226569, -0.404249, 0.0261744, 0.350055, -0.211302, 0.669061, -0.310748, -0.363119, -0.0565667, 0.824606, 0.814837, 0.292876, 0.562226, -0.0272691, -0.625609, 0.0491996, 0.787682, -0.537693, -0.856411, -0.387589, 0.517407, -0.170774, -0.322454, 0.293648, 0.623087, 0.419217, -0.273277, 0.280368, -0.925366, -0.624356, 0.171035, 0.581587, 0.65845, 0.481984, 0.0148475, -0.837587, -0.740977, -0.91526, -0.629196, 0.499393, 0.883229, 0.775311, -0.385205, -0.076561, 0.427425, 0.358029, 0.488562, 0.476739, -0.812184, -0.983607, 0.878913, 0.345209, -0.714138, -0.0801048, -0.339921, -0.02584, 0.305266, -0.291952, -0.0317737, -0.893531, -0.754254, 0.383553, 0.726408, -0.538397, -0.469836, -0.114761, 0.0142395, -0.562807, -0.276533, 0.373507, -0.299069, 0.141986, -0.817308, 0.387204, -0.705954, -0.818995, -0.701541, 0.428254, 0.0480607, -0.176184, -0.984437, -0.794262, 0.754513, 0.76351, 0.487689, -0.226469, 0.0480085, 0.100835, 0.438214, 0.90001, 0.194313, -0.880516, -0.693794, -0.732266, 0.0908467, -0.56684, 0.481427, -0.938844, 0.939407, -0.227327, -0.783311, -0.79054, -0.216746, 0.867192, 0.368266, -0.870749, 0.826994, 0.978951, 0.832309, 0.929593, -0.232385, 0.760784, 0.588406, 0.0813749, 0.356261, 0.617391, 0.504299, 0.965779, -0.182594, -0.773534, -0.540268, -0.193641, -0.677763, -0.47348, -0.622541, 0.661961, 0.47019, -0.74556, -0.0986685, -0.920478, 0.311048, 0.242549, -0.951691, -0.66618, 0.303729, -0.856551, 0.87969, -0.269029, -0.229889, 0.633984, 0.71651, -0.597948, 0.366888, -0.102541, -0.937429, -0.118797, 0.809401, -0.389416, 0.498238, -0.421191, 0.95714, -0.935345, -0.622437, -0.613943, 0.925658, -0.931225, 0.644615, 0.154533, -0.573148, 0.520439, 0.126345, -0.291922, 0.542749, 0.80888, -0.514865, -0.920279, -0.96433, 0.148016, -0.979921, -0.546207, 0.875479, 0.517943, -0.309043, -0.617032, 0.782369, 0.865532, 0.0700728, -0.362733, -0.565801, 0.873473, -0.787385, -0.83275, 0.746947, 0.466899, -0.682208, 0.966834, -0.616435, 0.603952, -0.733421, -0.774808, -0.882556, 0.276649, -0.853412, -0.0961666, -0.337132, 0.107331, -0.749603, -0.806275, 0.832333, -0.962334, -0.5629, 0.815283, -0.676596, -0.133365, -0.891405, 0.226749, -0.265799, 0.511564, 0.0868843, -0.448133, 0.366, 0.0278664, -0.719194, 0.457259, -0.749162, -0.960687, -0.926463, -0.29107, -0.353155, -0.158483, -0.681538, 0.496989, 0.125315, 0.0213483, -0.405027, -0.720263, -0.526249, 0.264405, -0.446338, 0.769741, -0.802649, -0.423614, 0.930944, -0.343936, -0.425438, -0.442029, 0.0901062, -0.435256, -0.31749, 0.1357, 0.385882, 0.270725, -0.0784048, 0.73758, 0.771237, 0.749934, 0.142194, -0.478106, -0.398771, -0.900445, 0.957778, -0.572987, -0.540283, -0.59442, 0.915102, 0.140244, 0.0532046, 0.0783197, -0.541513, -0.230631, -0.092113, -0.97598, -0.335075, -0.459743, -0.273264, 0.207423, -0.478758, 0.683094, -0.663669, -0.133841, 0.730966, -0.106199, 0.601929, -0.235617, 0.235773, 0.854603, -0.129893, -0.778768, -0.698171, 0.182659, 0.966566, 0.553788, -0.14555, 0.590926, 0.76471, 0.218178, 0.150796, -0.456572, 0.39481, 0.212771, -0.0533682, -0.282427, -0.0802186, 0.029546, -0.97062, -0.41976, -0.586209, -0.610997, 0.524363, 0.519463, 0.636903, -0.397534, -0.200992, -0.455954, 0.460842, -0.113362, 0.315782, -0.990072, -0.180441, -0.046825, -0.853515, -0.473447, 0.830718, 0.44768, -0.00133494, 0.364083, 0.826731, 0.588958, -0.373088, -0.513667, 0.050612, 0.255938, 0.761044, 0.551432, 0.293216, -0.595581, -0.0673728, 0.844182, 0.246838, 0.66921, -0.815363, -0.596991, -0.85099, -0.89564, -0.702014, 0.570951, 0.158625, 0.0642708, 0.635587, -0.158076, 0.0687414, -0.603141, -0.34051, -0.277465, -0.399798, -0.318654, -0.201091, -0.970801, -0.643792, -0.0449696, -0.438875, -0.400342, -0.972148, -0.798167, 0.727443, 0.961943, -0.871318, 0.821937, 0.805931, -0.334911, -0.993175, -0.835586, -0.54498, 0.12796, 0.126014, 0.780546, -0.713477, -0.435036, -0.519448, -0.626241, 0.806708, -0.681735, -0.966334, 0.395881, -0.591805, 0.578745, -0.916748, -0.154195, -0.835728, 0.831913, -0.643511, 0.3623, 0.305983, 0.612389, 0.117007, -0.187045, 0.148646, 0.90001, -0.788483, -0.875694, -0.176152, -0.046142, -0.690482, 0.418144, -0.363598, -0.840836, -0.776851, 0.79392, 0.459681, 0.449278, 0.584331, -0.952799, 0.588245, -0.988884, -0.619371, -0.709103, 0.84104, 0.550734, -0.148251, 0.604337, 0.911167, 0.205081, -0.971968, 0.0931023, 0.587519, 0.654582, -0.710868, 0.961189, 0.681364, -0.93297, -0.135273, -0.663914, -0.369833, -0.697614, 0.675575, 0.000734071, 0.0753468, 0.869836, -0.687211, 0.221167, -0.317847, -0.521007, 0.0154085, -0.851461, 0.0375188, 0.500796, 0.952571, -0.59719, 0.781104, 0.919393, 0.644747, -0.859169, -0.634726, 0.3347, 0.197953, 0.220577, -0.156229, -0.369132, -0.667832, 0.638918, -0.186767, 0.372832, -0.986698, 0.00243442, -0.0159373, 0.573526, -0.495469, -0.000151585, -0.62597, -0.117765, 0.641101, -0.611153, -0.34392, 0.255456, -0.674114, 0.972046, -0.0323956, 0.890904, -0.455468, -0.402831, -0.0809632, -0.0875929, 0.758942, -0.808122, -0.893221, -0.396945, -0.642468, 0.130649, 0.548559, 0.736055, 0.881606, -0.187122, -0.422538, -0.132545, 0.480012, -0.304694, -0.769506, 0.588896, -0.261235, 0.80963, 0.679597, -0.873429, 0.879814, -0.728383, -0.438045, 0.666731, -0.903166, 0.972758, 0.941536, 0.670145, 0.506979, -0.234102, 0.562446, 0.41648, -0.732802, -0.0666928, -0.269835, -0.847992, 0.115803, -0.708994, -0.146221, -0.958497, -0.612855, 0.0440742, -0.335472, 0.157921, -0.912856, -0.660134, -0.39643, -0.134542, -0.304547, 0.0685422, 0.922401, 0.115962, 0.321959, -0.454671, -0.287629, 0.572518, 0.964263, -0.703783, 0.395699, 0.0276528, 0.178359, 0.383676, -0.00519624, -0.0941896, 0.0339212, -0.810862, -0.271984, 0.11219, -0.853122, -0.945308, 0.82797, -0.251077, -0.848812, -0.341244, -0.925638, -0.80107, -0.0690173, 0.0448897, 0.45672, 0.160034, 0.375935, -0.0969347, 0.617558, -0.471582, -0.308754, 0.426719, -0.0102898, 0.696648, 0.284537, -0.415717, -0.238738, 0.424205, 0.439361, 0.474165, -0.148767, 0.889882, -0.0546634, 0.340011, 0.267861, -0.797662, -0.927351, 0.736103, 0.531011, 0.777903, -0.0597739, -0.922085, 0.323641, 0.172547, 0.161482, -0.931215, -0.0170429, -0.635979, -0.0575431, 0.844193, 0.973333, -0.564098, 0.929829, -0.827802, 0.23544, -0.547269, 0.0873589, 0.316563, -0.995662, -0.728629, 0.132206, 0.272704, -0.634342, -0.795543, 0.305798, -0.605409, 0.725955, -0.497445, -0.0127529, 0.238603, 0.862047, 0.728108, 0.795047, -0.378481, 0.382326, 0.316657, -0.175035, 0.983885, -0.364352, -0.647943, -0.184191, -0.189526, 0.780126, 0.963733, -0.503917, -0.831213, -0.485354, 0.396585, -0.582514, -0.999831, 0.873721, 0.509927, -0.658383, 0.366562, -0.580681, 0.36986, 0.877373, 0.471208, -0.561694, 0.474974, 0.599621, 0.83693, -0.527268, 0.528414, -0.477246, 0.171954, -0.830875, 0.965344, 0.755017, 0.21312, 0.656189, -0.808209, 0.321063, -0.747687, -0.618979, 0.292896, 0.0653111, -0.938772, -0.428902, -0.788887, -0.0149037, 0.687541, 0.100852, -0.974579, -0.0700569, -0.0349431, -0.984232, 0.680737, -0.598645, 0.70618, -0.897238, -0.527311, 0.0477309, -0.284329, -0.751855, 0.857256, -0.596226, -0.7532, -0.0703375, 0.428926, -0.555414, -0.859946, 0.358639, -0.819998, -0.0323879, -0.120594, -0.977912, -0.266136, 0.531202, -0.510541, 0.471093, -0.479196, 0.81152, 0.568596, -0.0411265, -0.915288, -0.0195472, 0.358255, 0.490184, 0.252656, -0.0415075, -0.85653, -0.609183, 0.576533, 0.458842, -0.925543, 0.861401, -0.273181, -0.723721, -0.574755, 0.525223, 0.55508, -0.255917, -0.916687, -0.352827, -0.0251343, 0.485741, 0.565467, 0.72898, -0.650834, 0.839178, -0.535695, -0.991943, -0.691228, 0.679019, 0.0998476, -0.886941, -0.521996, 0.0106276, 0.050061, 0.893336, -0.538886, 0.20766, 0.258294, 0.862782, 0.608128, 0.713473, -0.319632, 0.114128, 0.368798, 0.979915, 0.330054, -0.743848, 0.204697, -0.768192, -0.0366594, 0.577518, 0.364947, 0.587491, 0.457869, -0.457117, -0.851136, -0.226819, 0.431111, 0.491583, 0.233807, 0.863009, 0.621912, -0.0831525, -0.358608, 0.694745, 0.557432, 0.0326848, 0.263743, 0.0851909, -0.0525357, -0.664016, 0.674337, 0.342278, 0.196097, 0.404147, -0.709794, 0.326265, 0.201415, 0.108242, 0.0569852, -0.638532, 0.255264, -0.38688, -0.327436, 0.180754, -0.880696, -0.633322, 0.801639, -0.868589, -0.112011, 0.903769, 0.73237, -0.67046, -0.118539, -0.596477, 0.0390584, -0.0222291, 0.125956, -0.461574, -0.536523, -0.757395, -0.0405959, 0.141106, -0.355545, -0.596291, -0.973073, 0.365859, 0.25756, -0.31097, -0.662181, -0.444205, 0.958003, 0.502157, -0.317809, 0.322138, 0.731588, -0.506969, -0.978519, 0.69719, 0.857942, -0.656191, 0.627249, 0.916985, 0.683622, -0.514565, -0.393128, -0.311858, 0.643009, -0.792745, -0.788785, -0.556585, -0.748238, -0.312202, -0.215778, 0.279539, 0.423162, -0.447229, -0.207195, -0.287666, 0.821805, -0.885542, 0.893123, 0.487265, -0.591922, 0.365053, 0.355304, -0.17752, -0.65734, 0.73674, -0.437895, 0.871284, 0.598483, -0.174933, 0.872312, -0.889775, 0.149493, 0.891845, 0.232419, -0.346048, -0.997172, -0.725694, 0.883803, -0.698937, 0.00160166, -0.717231, -0.411394, -0.830832, -0.0098027, 0.505874, 0.247576, 0.962053, 0.69787, 0.178988, 0.33885, 0.659348, -0.749406, 0.476171, 0.462731, 0.614852, -0.60987, -0.319359, 0.289195, -0.375013, -0.747483, 0.682454, 0.129859, -0.95513, 0.568203, -0.975982, -0.187644, -0.250379, 0.539852, -0.695489, 0.0457742, -0.0118055, -0.18202, 0.759513, 0.254261, 0.0867476, 0.921237, 0.310823, -0.0320168, 0.245069, 0.580444, 0.963002, 0.916013, -0.730575, 0.859654, -0.243678, -0.910271, -0.864976, -0.929842, 0.425156, 0.90652, 0.255331, -0.165604, -0.606737, -0.505512, 0.229888, -0.921973, -0.23188, 0.327745, 0.306688, -0.54531, -0.250859, 0.481119, -0.532277, -0.858684, 0.284904, 0.515695, 0.793585, 0.734406, 0.98442, -0.814873, 0.280178, -0.509474, -0.788482, -0.414369, -0.457058, -0.153561, 0.984512, 0.967977, 0.176768, 0.507793, -0.901826, -0.344329, -0.962815, -0.660218, -0.225724, 0.820406, 0.14026, -0.0526318, 0.170922, 0.803363, -0.218479, 0.887414, 0.309942, -0.455532, -0.884848, 0.976042, -0.236071, -0.410015, 0.683923, 0.647628, -0.49687, 0.595244, 0.313242, -0.114973, 0.069439, 0.281288, -0.420566, 0.993352, 0.459126, -0.399632, -0.427902, 0.23681, -0.637247, 0.1614, -0.500335, -0.399078, 0.454107, -0.997458, -0.704039, 0.927494, 0.603104, -0.24824, 0.927161, -0.628357, -0.775911, 0.774714, 0.475791, 0.987588, -0.461159, -0.0648289, -0.510851, -0.406099, 0.202028, 0.694911, 0.317645, -0.791494, -0.602042, -0.882304, 0.919661, 0.886545, -0.497047, 0.192559, -0.325977, 0.713294, -0.624305, -0.376426, -0.0315518, 0.0727215, 0.662133, 0.0819297, -0.540672, -0.679663, -0.463303, -0.567271, -0.241508, -0.691429, 0.74805, 0.239353, -0.300012, 0.389662, 0.198094, 0.925077, 0.420082, -0.822366, -0.853491, -0.25385, 0.329018, 0.0354829, 0.947413, -0.616053, -0.592024, 0.0600609, 0.407045, 0.480865, 0.817981, 0.294632, -0.16556, -0.777849, 0.0251975, -0.528416, 0.922721, 0.202933, 0.183076, 0.412285, 0.0869438, 0.00276867, -0.177938, 0.533579, 0.427161, 0.826772, -0.352759, -0.984747, 0.0330882, -0.42264, 0.295372, -0.953991, 0.515132, -0.420243, -0.0775103, 0.835729, 0.277025, -0.823646, -0.795019, -0.477198, 0.0040618, 0.00268969, 0.96273, 0.0807446, 0.612129, 0.614133, 0.427296, 0.0288729, -0.776178, -0.22229, 0.151377, -0.0311202, -0.956212, 0.0978216, -0.0716898, 0.0030373, 0.635234, 0.293051, -0.719956, 0.50928, -0.142148, -0.475696, -0.0284185, -0.270311, -0.644355, -0.883933, 0.550341, 0.988299, -0.521983, -0.908587, -0.727894, 0.709941, -0.827801, 0.595151, 0.828702, -0.498497, 0.889964, 0.701945, 0.99898, 0.14288, -0.638757, 0.792228, -0.187593, 0.805929, -0.467292, -0.151053, 0.536125, 0.909566, -0.85776, -0.332749, -0.756824, -0.101066, 0.64555, -0.302859, -0.96066, 0.654756, 0.871554, -0.679116, -0.21148, 0.373828, -0.560972, 0.251545, -0.726806, 0.955408, -0.255069, 0.32037, -0.146689, 0.882719, 0.586941, 0.448021, 0.521644, -0.260952, 0.233528, 0.0202426, -0.469099, -0.708005, 0.118392, -0.073416, 0.391877, 0.173586, 0.942398, -0.00791642, -0.87969, 0.920724, -0.355133, -0.439849, -0.540609, 0.223465, -0.26903, 0.385545, -0.492541, -0.73025, 0.224519, -0.0375835, 0.549665, 0.512061, -0.826556, 0.0789173, -0.49823, -0.312922, -0.0555674, -0.661513, -0.393349, 0.308913, 0.113209, 0.227819, 0.409626, 0.904892, 0.819367, -0.723797, 0.985552, -0.0417346, -0.371518, 0.104531, -0.878672, 0.706089, -0.960653, 0.491751, 0.771459, 0.0238786, -0.858306, 0.721989, -0.261772, -0.268357, 0.697963, -0.491257, -0.561093, -0.147585, -0.407223, -0.456559, 0.0828105, 0.669992, -0.0437285, 0.713277, -0.320446, 0.758453, 0.0537657, 0.238941, 0.878964, -0.643774, -0.169791, 0.433164, 0.254517, 0.557033, 0.126777, 0.369152, -0.866437, -0.802074, -0.862716, 0.715627, 0.341505, -0.472617, -0.186188, 0.52571, -0.345604, 0.749655, 0.4554, -0.395129, 0.192853, -0.0685247, -0.254484, -0.834779, 0.852607, -0.67346, 0.0567913, 0.36496, 0.469233, 0.56726, 0.205645, 0.0475103, 0.921548, -0.50774, -0.226215, 0.515881, 0.55615, 0.544429, 0.905852, -0.0805225, 0.944929, 0.374932, 0.321863, 0.0998784, -0.715923, 0.457299, 0.729106, -0.151703, 0.30495, -0.633344, 0.0253834, -0.334278, -0.373646, 0.572139, 0.0144167, -0.640911, -0.408575, -0.964558, 0.37797, -0.698535, 0.149418, 0.863726, 0.050282, -0.79617, -0.808087, 0.0610363, -0.809754, -0.809989, 0.761424, -0.874996, -0.0476187, -0.770887, -0.0353315, -0.647088, 0.673366, -0.196913, -0.555756, 0.805503, -0.472077, 0.0130575, -0.614016, -0.982794, 0.0849315, 0.271481, -0.363824},
-	{-0.730326, -0.296968, -0.27476, 0.90185, 0.98544, -0.296642, -0.513082, -0.327365, 0.63899, -0.987196, 0.967847, 0.0284028, -0.825116, -0.302049, -0.138338, -0.758144, 0.00600262, 0.46014, 0.739878, 0.339403, 0.281844, 0.447347, 0.936361, -0.908129, 0.926374, -0.953863, -0.0380479, -0.127675, 0.375048, -0.190392, -0.440362, -0.0106322, -0.58674, -0.545449, 0.35992, 0.11838, -0.802445, -0.40527, -0.410705, -0.955223, 0.096101, -0.433057, 0.402263, -0.289321, 0.0253692, 0.754463, -0.972154, -0.73312, 0.423902, -0.276984, 0.410922, 0.767256, -0.578972, 0.469706, 0.583352, -0.975431, -0.575266, 0.83243, -0.795126, -0.254768, -0.62971, -0.99015, 0.130124, -0.828202, 0.850217, 0.373502, 0.276568, 0.008809, 0.954603, -0.773774, 0.0281094, -0.0970119, -0.607809, -0.216585, 0.537378, 0.375833, -0.399867, 0.871705, -0.725397, -0.691063, -0.371357, 0.611996, -0.925019, 0.529471, 0.0706353, 0.684277, -0.496099, -0.342886, 0.77135, 0.532687, 0.1623, -0.807108, -0.912105, 0.327162, 0.199815, -0.678063, -0.578935, -0.943343, 0.111585, -0.228627, -0.205345, -0.0406351, 0.278699, 0.97686, 0.697859, -0.233956, 0.14278, 0.799573, 0.76454, 0.900224, -0.310892, 0.119324, -0.343533, 0.958572, -0.910725, -0.0889883, -0.218927, -0.182557, -0.731027, 0.309025, -0.847342, -0.319619, 0.705006, 0.422231, -0.57443, 0.700931, -0.675755, 0.641577, 0.369427, 0.509455, 0.452445, 0.431297, 0.604754, 0.0942278, -0.51673, 0.907636, 0.781337, 0.348958, 0.111156, -0.480074, -0.587853, 0.418749, -0.21765, 0.0234012, -0.447328, -0.447569, -0.42223, 0.524671, -0.642948, 0.688926, -0.780841, 0.41478, 0.9656, 0.283282, 0.394519, -0.0421776, 0.516788, 0.461505, 0.737003, 0.0306987, -0.43454, 0.434144, -0.450718, -0.292201, -0.899401, 0.698672, 0.523441, 0.412328, -0.502004, -0.988365, -0.100859, -0.352593, 0.213566, 0.696228, -0.916066, -0.702887, -0.265549, 0.492396, 0.29392, 0.468171, -0.465314, -0.458406, 0.645245, -0.0913866, 0.0695699, 0.271742, 0.518505, 0.40582, -0.616408, 0.458701, -0.987913, 0.331277, -0.423219, -0.482219, -0.173751, -0.0758849, -0.5956, -0.326994, -0.823881, -0.65385, -0.642589, -0.749136, 0.70068, 0.381757, 0.277745, 0.156806, -0.455872, -0.416041, 0.644196, 0.365572, 0.911769, 0.677247, -0.827159, 0.346928, 0.841523, -0.0943711, -0.929472, -0.995717, 0.747918, -0.977047, -0.0445711, 0.0604642, -0.18195, 0.590168, 0.673748, 0.205301, 0.229859, -0.140548, 0.294537, -0.423749, -0.151846, 0.987181, 0.172925, -0.770333, 0.00164033, -0.327035, 0.251521, -0.0353269, -0.937227, -0.29, 0.740535, -0.907036, 0.666394, 0.205006, -0.904512, -0.75871, -0.72666, -0.460889, -0.33779, -0.216724, 0.451285, -0.332375, -0.974663, 0.142737, -0.86226, 0.762293, 0.278508, 0.367335, 0.182913, 0.208844, -0.880315, -0.673876, 0.16224, -0.0170929, 0.692281, -0.959225, 0.32677, -0.665061, -0.852529, 0.848952, -0.156477, 0.572794, -0.227149, -0.228126, 0.270733, -0.9007, 0.524964, 0.247102, 0.0163707, 0.0134975, -0.038788, 0.515934, -0.95281, -0.319056, 0.805442, 0.356874, -0.296099, -0.651656, 0.369473, -0.938001, 0.901119, -0.285799, 0.423927, 0.155385, -0.188311, 0.714438, -0.117957, -0.892577, 0.439114, -0.85508, -0.0747409, 0.557231, 0.410942, 0.796853, -0.159733, -0.0808449, -0.165124, -0.0724619, -0.488477, 0.319135, -0.675526, 0.312937, 0.353225, 0.714192, -0.569938, -0.0683017, -0.557907, 0.109431, 0.695514, 0.610179, 0.114437, -0.648994, 0.549649, 0.919498, 0.327051, -0.558663, -0.705762, 0.512475, 0.31843, 0.0835977, 0.445299, 0.666396, -0.942513, -0.310904, -0.635206, -0.602401, -0.911978, 0.512763, -0.733439, -0.765935, -0.193431, 0.781241, 0.171149, -0.0202983, 0.0591786, -0.933654, -0.193483, -0.551347, -0.108789, -0.675338, 0.605848, 0.115109, 0.082935, -0.178283, -0.101744, -0.965629, -0.734438, 0.23015, 0.444223, 0.014164, 0.000878211, 0.461838, -0.112333, 0.593444, 0.322253, 0.944481, 0.651905, -0.119013, -0.956012, -0.0941698, 0.27387, -0.0344653, 0.678775, 0.0160126, 0.0207925, -0.767334, 0.435951, -0.680602, -0.402093, -0.0958016, 0.227186, 0.695683, 0.904812, -0.365007, -0.572487, -0.0725302, -0.682879, 0.650298, 0.301287, 0.135778, 0.914902, 0.883498, -0.759367, 0.889923, -0.513447, -0.134681, -0.248879, 0.713013, 0.0271347, 0.790237, 0.707031, -0.17591, -0.0613191, -0.0212936, -0.24447, -0.897081, 0.362088, -0.910758, 0.691797, -0.295105, -0.210771, -0.319274, -0.744678, -0.611341, 0.889978, 0.205308, -0.141043, 0.663738, 0.0431227, 0.684982, 0.686059, -0.434399, 0.53996, -0.107323, 0.9995, 0.833714, 0.896, 0.755721, -0.142062, 0.00380502, -0.670232, 0.622688, 0.593113, -0.553855, -0.125737, -0.609765, 0.0947215, -0.341126, -0.140637, -0.32762, 0.649704, 0.424474, 0.910733, 0.286251, 0.910435, -0.687632, 0.688597, 0.740759, -0.449307, -0.545353, -0.624317, -0.74476, 0.230897, 0.561294, -0.0172108, 0.24069, 0.569029, -0.476718, 0.790708, -0.111443, 0.0439775, -0.0312691, 0.606896, -0.421879, -0.471211, 0.916364, 0.640996, -0.092428, -0.144492, -0.687466, 0.621759, -0.861826, 0.345747, 0.989317, 0.515788, -0.419605, 0.425076, 0.105262, -0.906389, 0.466265, 0.207403, -0.0623674, -0.306474, 0.481924, 0.115672, -0.702879, 0.624089, 0.786515, 0.60019, 0.904247, -0.281017, -0.553602, -0.163917, -0.135277, -0.598423, 0.81636, -0.261533, 0.65072, -0.14198, -0.690361, 0.400198, 0.59686, -0.580576, -0.927966, -0.429364, 0.18649, 0.553107, -0.902806, -0.238285, 0.442531, -0.825428, -0.107406, 0.31276, -0.651766, -0.249673, 0.872373, 0.334691, -0.752163, 0.502032, -0.225247, -0.236075, -0.524806, 0.27378, 0.556828, -0.676464, -0.987195, -0.413081, -0.119414, -0.0889141, 0.971822, 0.753797, 0.621291, -0.661712, -0.871091, 0.369617, 0.161477, -0.567048, 0.239467, 0.692024, -0.929393, -0.236, 0.0407897, 0.130502, 0.291032, -0.0656363, 0.478379, 0.270611, -0.563763, 0.798357, 0.319384, -0.830789, -0.323961, -0.373088, 0.717724, -0.986438, -0.585173, 0.437019, 0.455912, -0.46774, 0.760849, -0.794273, -0.817905, -0.2395, -0.452924, 0.0383386, -0.559023, -0.638583, -0.0475583, -0.355593, 0.429925, 0.706586, 0.809921, -0.00863428, -0.363315, 0.644475, -0.266402, 0.124596, 0.348431, 0.640501, -0.315909, -0.539379, -0.402909, -0.358866, -0.948211, -0.466762, -0.792509, 0.596306, 0.736227, -0.630095, -0.945365, 0.765812, -0.397825, 0.0107348, 0.183764, -0.779747, 0.0392249, 0.476365, 0.607847, -0.217296, 0.345991, 0.960665, -0.793283, -0.171808, -0.106249, -0.0745021, 0.156747, -0.0829843, 0.0159293, 0.242168, 0.845068, -0.589974, -0.325099, 0.95636, -0.978643, 0.666314, -0.972478, -0.391718, -0.140497, 0.329753, 0.0535532, -0.38309, -0.748812, -0.0685478, -0.671805, -0.668586, 0.820313, 0.339158, 0.807527, -0.0916074, -0.455996, -0.560398, 0.800647, 0.726682, 0.69828, -0.473033, 0.955313, 0.735843, -0.0713251, 0.770764, -0.880066, -0.92319, 0.424968, 0.58666, -0.295453, 0.879356, -0.71041, -0.0179003, 0.295406, 0.69951, 0.984242, 0.341837, -0.188094, 0.161687, -0.263329, -0.8463, 0.783987, -0.89786, -0.111773, -0.0936426, 0.990665, -0.52764, 0.38448, -0.368555, -0.228134, 0.97573, 0.226004, 0.879488, -0.943966, -0.750105, -0.553326, -0.385331, 0.41169, 0.941847, -0.631026, 0.0142343, -0.547117, -0.579443, -0.609545, 0.180865, 0.534224, 0.0460581, -0.348678, -0.122422, 0.159806, 0.740369, 0.264567, 0.827592, -0.384422, -0.988466, -0.0294182, 0.348618, 0.768429, -0.988824, -0.181928, -0.942717, -0.628225, 0.557989, 0.888129, -0.791697, -0.158932, 0.660397, 0.155892, 0.869774, 0.703091, 0.95762, -0.849554, 0.076186, 0.652206, 0.349104, 0.889304, -0.338926, -0.141682, -0.405585, -0.766578, 0.182975, 0.99196, 0.0640549, -0.346992, 0.241742, -0.247946, -0.61829, 0.138733, 0.0161962, -0.362103, 0.805567, -0.928542, 0.287067, -0.136251, 0.428843, -0.450017, -0.234765, -0.406387, -0.776828, -0.148563, 0.588393, -0.614686, -0.233026, 0.865554, 0.351668, 0.651666, -0.883725, 0.387626, -0.353094, -0.494947, -0.850327, -0.335721, 0.684336, 0.268475, 0.854419, 0.13572, -0.692183, -0.0101656, 0.955773, 0.190101, -0.738214, 0.593915, 0.28612, 0.325846, 0.677848, 0.664218, 0.577372, 0.974678, 0.744038, -0.105813, 0.910224, 0.181546, -0.283819, 0.285549, 0.962182, 0.397113, 0.35348, -0.25218, -0.0518323, -0.949981, -0.128978, -0.529463, -0.612999, -0.988592, 0.559431, -0.504398, -0.973855, 0.471886, -0.185106, -0.254549, 0.1786, 0.260921, 0.02097, 0.559734, 0.426036, -0.0526579, 0.658744, 0.968181, -0.703677, -0.0441689, -0.845815, -0.452279, 0.127355, -0.979193, -0.0592578, -0.462307, -0.927067, -0.0168915, -0.704053, -0.534347, 0.246691, 0.833167, -0.18405, -0.554825, -0.328791, -0.847751, -0.53705, 0.339009, 0.256044, 0.747042, -0.631744, 0.618745, -0.0337944, 0.167888, 0.617634, 0.782333, 0.580852, 0.910507, 0.000852134, 0.789878, -0.071791, 0.436027, 0.829916, 0.933581, -0.360901, -0.931343, 0.142609, 0.876476, 0.559907, -0.827377, -0.248014, 0.0679604, -0.74217, -0.369104, 0.815717, -0.992371, 0.188695, -0.708824, -0.798279, 0.143199, 0.244617, 0.731872, 0.539724, -0.640053, -0.984291, -0.61817, -0.725312, -0.796141, 0.0820918, 0.323952, -0.954808, -0.345501, 0.578773, 0.32816, 0.924374, -0.33256, 0.678992, 0.921469, -0.654966, -0.762845, -0.232595, 0.70462, 0.45779, 0.0277307, -0.842605, 0.813769, 0.285127, 0.650656, 0.19528, -0.0803803, -0.940315, -0.0338684, 0.225273, 0.54095, -0.162949, -0.587522, 0.342355, 0.380049, -0.363531, 0.539128, 0.113777, 0.27464, -0.942228, 0.285417, -0.250775, 0.54714, 0.980927, -0.804443, 0.10057, -0.748763, 0.268926, -0.181636, 0.767695, 0.469324, -0.0496825, -0.0537082, -0.898747, 0.0154696, -0.684872, 0.999554, -0.585983, -0.0760459, -0.0701715, -0.617512, -0.957974, -0.686433, 0.739105, -0.55391, -0.696561, 0.552863, -0.184084, 0.690995, 0.630923, 0.218112, -0.338039, 0.0908943, 0.865027, 0.689128, -0.479091, 0.439625, 0.933088, 0.729435, 0.352285, -0.719737, -0.30683, -0.327354, 0.444345, -0.662413, -0.0252053, -0.334729, -0.559998, -0.190968, 0.506708, 0.413128, -0.595897, -0.248302, -0.694452, 0.986874, -0.515833, 0.1514, 0.0856259, -0.721545, 0.508353, 0.213802, -0.395305, 0.497661, -0.137942, -0.554734, 0.0234352, 0.202977, -0.524063, -0.497932, -0.890739, -0.20171, -0.893284, -0.0215235, -0.855464, -0.433231, -0.00186555, -0.425398, -0.308756, -0.0621457, 0.167546, -0.71816, -0.168465, 0.145235, 0.690441, 0.192667, -0.0125978, -0.163653, 0.177662, 0.12006, -0.400851, -0.494383, -0.807786, -0.127927, 0.112223, -0.156763, -0.827399, 0.713172, -0.905767, -0.776992, -0.691182, 0.530738, 0.807049, -0.173128, 0.304031, -0.179922, -0.700895, 0.657554, -0.390426, -0.51839, -0.927327, -0.31929, -0.73705, 0.139571, -0.272162, 0.0531109, -0.847971, -0.971403, -0.412758, -0.757104, -0.889322, -0.36218, -0.61409, 0.653567, 0.913008, 0.971358, 0.326763, -0.260641, -0.0357492, -0.92492, -0.690122, 0.182118, 0.882246, -0.92375, -0.0617378, 0.23187, 0.21776, 0.727259, 0.0986578, -0.840744, 0.220426, -0.439572, -0.554997, 0.935383, -0.681098, 0.481991, 0.165912, -0.0153349, 0.396543, -0.439873, 0.630309, 0.0640691, -0.988658, -0.732852, -0.722599, -0.490387, 0.136047, -0.0920605, -0.128696, -0.881689, -0.459323, 0.833281, 0.461118, 0.847656, -0.0102291, -0.133714, 0.968484, 0.0928345, -0.700615, 0.589785, -0.0720672, 0.905988, 0.313205, -0.782272, -0.10462, 0.118424, 0.8583, -0.832556, 0.252526, 0.86317, -0.755057, -0.94235, 0.685282, 0.4882, -0.00757953, -0.953529, 0.0354259, -0.089537, -0.485816, 0.352459, 0.369328, 0.442516, -0.823091, 0.470941, -0.319862, 0.0891726, 0.031826, 0.874916, -0.235082, 0.468828, -0.179899, 0.88596, -0.24208, 0.511717, 0.587005, -0.138792, -0.770467, 0.717526, 0.393663, 0.583309, -0.051123, 0.741687, 0.182995, 0.951501, -0.354634, -0.126289, 0.672955, -0.65083, 0.500061, -0.178516, -0.974999, 0.547158, 0.245245, -0.170577, -0.0503786, -0.326897, -0.908903, 0.200069, 0.348876, -0.34366, 0.0644597, -0.836577, 0.486975, -0.270544, -0.970538, -0.271981, -0.189134, -0.67147, 0.131162, -0.19777, 0.616355, 0.866799, -0.0253693, -0.200172, 0.813308, 0.757209, 0.978856, 0.542241, 0.709714, 0.699679, 0.276519, 0.493395, -0.789939, 0.480314, 0.773901, -0.328283, 0.759761, 0.792964, 0.685616, -0.0569856, -0.765203, 0.0341521, 0.134122, -0.105463, 0.145662, 0.0102904, 0.316843, 0.40186, 0.57658, -0.528076, -0.587988, -0.714575, 0.495749, -0.0472509, 0.746934, 0.92714, -0.179926, -0.0499715, -0.65237, 0.523249, -0.834959, -0.195148, -0.891578, 0.905877, 0.678541, 0.461354, 0.435241, 0.863733, -0.657351, 0.422774, -0.0088049, 0.298221, -0.347164, 0.880148, 0.537818, 0.830237, 0.338071, 0.348167, -0.617684, -0.146914, 0.64684, -0.192087, -0.974319, -0.411365, 0.95396, -0.778594, 0.432869, -0.449253, -0.908353, 0.335487, -0.221127, -0.955441, 0.789921, -0.522078, -0.211564, 0.193418, 0.483032, 0.739418, 0.228857, 0.510778, -0.155135, -0.843347, -0.126895, 0.738735, 0.106729, 0.827879, -0.73165, 0.214353, -0.225311, -0.759768, 0.700705, 0.880151, -0.275413, -0.957249, -0.262729, 0.0138492, -0.238168, -0.130134, -0.12277, -0.112408, 0.94686, 0.354266, 0.539325, -0.635938, -0.323207, -0.701359, -0.458039, 0.769697, -0.683759, -0.15381, 0.206947, 0.487314, 0.475176, 0.356118, 0.707968, 0.134925, 0.604138, 0.045138, 0.932513, 0.254444, -0.565999, -0.304381, -0.54821, -0.974036, -0.679361, 0.943314, 0.12102, -0.233438, 0.263688, -0.793137, 0.320436, 0.70093, 0.383707, 0.469864, -0.145922, 0.994346, -0.0715495, -0.458558, 0.684501, 0.730955, 0.443365, 0.084302, -0.468289, -0.0927878, -0.833668, -0.644425, 0.388856, 0.709518, 0.125298, -0.809407, -0.637006, -0.540348, -0.00409383, 0.941076, -0.352402, -0.394911, -0.625558, 0.0340112, -0.371865, 0.27063, -0.181327, -0.381891, -0.974761, -0.827319, 0.936797, -0.0134316, -0.412673, 0.761809, -0.875923, 0.146885, -0.719832, -0.295817, -0.389847, 0.695457, 0.06548, 0.381595, -0.947977, -0.0999053, 0.465176, 0.0842161, 0.722707, -0.525793, 0.612918, -0.169943, 0.315159, 0.457782, 0.329784, 0.807336, 0.552639, 0.118672, -0.509143, -0.469839, -0.412847, 0.874219, -0.85105, -0.79427, -0.219357, -0.196894, -0.821414, -0.84504, -0.339177, -0.506316, 0.407418, -0.826811, 0.619052, -0.182534, -0.299152, 0.583179, -0.631379, -0.933375, -0.694491, -0.664931, -0.213903, -0.671861, -0.587735, -0.875531, 0.910882, 0.495798, 0.012027, 0.919185, 0.798907, -0.317593, 0.546858, -0.854582, 0.0197677, -0.57643, 0.978359, -0.299992, -0.548871, 0.574627, -0.534784, 0.843472, -0.499428, 0.97048, -0.183286, 0.128584, -0.979635, -0.435608, 0.456924, 0.818439, -0.946032, 0.798215, -0.714148, -0.414559, 0.916026, -0.969123, 0.090425, -0.876314, -0.0363831, -0.600856, -0.0816764, -0.165581, 0.755658, 0.869933, 0.553192, -0.340931, -0.551619, -0.814542, 0.965873, -0.579601, 0.0123279, 0.298569, -0.289297, -0.22319, -0.749363, 0.812215, -0.0180335, -0.254496, 0.713636, 0.0414507, 0.680185, 0.54117, -0.852069, -0.295318, 0.692755, 0.989238, -0.201768, -0.859991, 0.748326, -0.360996, -0.920221, 0.71227, -0.507936, 0.908981, -0.0806849, -0.320451, -0.994153, 0.813142, 0.158723, -0.464875, 0.138319, -0.747645, -0.863871, -0.514077, -0.893098, 0.0752384, -0.49491, -0.699296, -0.739099, -0.539521, 0.103035, 0.203945, -0.526465, -0.154875, 0.894907, 0.0357175, -0.50329, 0.256989, 0.622306, 0.747964, 0.160661, 0.152705, 0.313016, -0.919953, -0.286818, 0.636088, -0.51738, 0.358953, -0.745394, 0.0798069, -0.892912, 0.548353, 0.648931, -0.628601, -0.866487, -0.311542, 0.434284, 0.994864, -0.700662, -0.441353, 0.640995, -0.322741, -0.882724, 0.915456, -0.0287374, -0.827323, -0.0311016, -0.563034, 0.113932, 0.244807, -0.896617, -0.293445, -0.632068, -0.791094, 0.720983, -0.32272, -0.189358, 0.7483, 0.627462, -0.403756, -0.698921, 0.854636, -0.156735, -0.52389, -0.0567728, -0.762641, 0.695288, 0.0302218, 0.162024, 0.536365, -0.715076, -0.428277, -0.276928, -0.457533, -0.34342, -0.212259, -0.830857, 0.893599, -0.702358, -0.0749674, 0.985306, 0.74098, 0.324983, 0.337567, 0.28745, 0.437037, -0.342537, -0.348052, -0.217169, 0.711885, 0.227492, -0.517595, -0.272994, 0.912921, -0.831971, -0.29795, 0.00429488, 0.802945, -0.492823, 0.62751, 0.820976, -0.47186, -0.52464, 0.673205, 0.0563766, -0.817054, 0.201493, 0.00671643, -0.562164, 0.776934, 0.1622, 0.322827, 0.121868, 0.00253768, 0.397497, -0.912031, 0.738792, -0.810481, 0.605666, -0.400223, 0.811704, 0.597696, 0.15936, -0.224399, 0.171731, -0.816469, -0.871053, -0.0484933, 0.926727, 0.705299, -0.200777, -0.385823, -0.439345, -0.24161, 0.16071, -0.255506, -0.528199, 0.849285, -0.937217, -0.269356, 0.444291, -0.824287, 0.514727, -0.256242, 0.805107, 0.287221, -0.531507, -0.402652, 0.140086, 0.82215, 0.587388, -0.0878758, -0.385841, 0.994383, 0.0229082, -0.938261, 0.904253, -0.986462, 0.817115, 0.812083, 0.969182, 0.148211, 0.917781, 0.63715, 0.78498, 0.797029, 0.566111, -0.86277, -0.0747317, -0.698173, 0.477281, -0.793505, -0.75435, 0.353553, 0.541785, 0.269394, 0.5029, 0.338802, -0.791374, -0.115864, 0.43175, -0.0799918, -0.343136, 0.575988, 0.676012, 0.684058, 0.191193, 0.523479, -0.19392, -0.811166, -0.136825, -0.300127, -0.218988, 0.466772, 0.498266, 0.973289, 0.421612, -0.619096, -0.905564, -0.775121, -0.503404, 0.474723, -0.0482471, 0.0442952, -0.528961, -0.639241, -0.485156, 0.00860397, 0.544397, -0.84635, 0.024802, -0.201211, -0.254143, 0.414503, -0.299992, -0.519621, 0.9715, -0.26336, 0.490974, -0.0356933, 0.332081, 0.809436, 0.227799, 0.267887, 0.755333, -0.646883, 0.786785, -0.534395, -0.531294, -0.290298, -0.953671, -0.128584, -0.465974, 0.805825, -0.960382, 0.0204843, -0.0409594, -0.560162, -0.455241, 0.885967, -0.265734, 0.831085, -0.544517, 0.244833, -0.539406, 0.312294, 0.269332, -0.337623, 0.799935, 0.69012, -0.14541, 0.0353571, -0.576683, 0.851993, -0.925411, -0.338568, 0.96044, 0.919567, 0.477186, -0.0141059, 0.0592476, 0.56702, -0.782687, -0.641852, -0.511372, 0.854137, 0.0915277, 0.810076, -0.891561, 0.0731344, 0.830911, -0.331537, -0.19882, -0.812836, -0.48011, -0.925234, 0.19677, -0.0370253, 0.683621, -0.252216, 0.397209, 0.742656, -0.219595, 0.747405, -0.188119, 0.786843, 0.0449188, 0.972605, 0.43041, -0.90748, 0.156228, 0.229916, -0.0689186, 0.244199, 0.954867, -0.181085, 0.953834, 0.516363, -0.250382, 0.462137, -0.413531, -0.501627, 0.00269982, 0.820585, 0.242083, -0.104775, -0.832502, 0.734062, -0.762423, -0.655595, -0.253769, -0.395865, 0.816257, -0.11804, -0.278058, 0.0833499, -0.765516, -0.397452, -0.661616, -0.556548, 0.0611458, -0.588314, 0.471421, -0.214476, 0.199942, 0.378489, -0.223925, -0.126027, 0.943369, -0.799422, 0.119371, -0.936225, -0.589308, -0.00440124, -0.994722, 0.823863, 0.717772, -0.0322243, -0.805357, -0.797417, 0.610779, 0.755937, -0.704283, 0.444645, -0.0663338, -0.428512, -0.683629, -0.812375, -0.604507, -0.50085, 0.417792, -0.188837, 0.380089, -0.162217, -0.661869, 0.841973, 0.0580822, -0.66804, -0.221395, 0.610524, -0.37513, -0.303304, -0.327064, -0.402401, 0.395258, -0.887735, 0.570815, 0.611097, -0.873935, -0.992471, 0.0869734, 0.343965, 0.807665, -0.539518, 0.493357, -0.389739, 0.478539, 0.894465, 0.0919718, 0.220966, -0.214472, -0.52621, -0.819609, 0.537561, -0.746609, -0.252174, 0.709724, -0.460331, -0.322008, 0.676085, 0.791681, -0.892985, -0.678496, -0.296257, 0.0489039, 0.66912, -0.465794, -0.130586, -0.0854346, -0.911012, -0.671733, -0.586278, -0.532593, -0.650757, -0.829638, -0.58116, 0.431361, -0.80263, -0.745609, -0.957573, -0.587569, 0.860957, -0.380272, -0.518486, -0.683712, 0.535781, -0.630851, 0.0434232, 0.313778, 0.428032, -0.913529, 0.14272, -0.0295114, -0.707436, -0.266378, -0.629105, -0.820429, 0.0030574, -0.0765865, -0.22005, 0.237352, -0.789455, -0.622612, -0.508697, 0.000193778, -0.689116, 0.830424, 0.767593, -0.127005, -0.0453336, -0.0249762, 0.937738, 0.448479, -0.95106, 0.0264549, -0.17335, 0.179035, -0.228518, -0.135582, -0.590951, 0.0226716, -0.330179, 0.648117, -0.0149225, -0.493899, 0.0117182, 0.296937, 0.126545, 0.676897, -0.158782, 0.356795, -0.145688, -0.987433, -0.117851, -0.398085, 0.131319, 0.622283, -0.123126, -0.316033, 0.334714, -0.151719, -0.717541, -0.751486, 0.259032, 0.696159, -0.566232, 0.238288, -0.92541, 0.0918143, 0.60661, -0.700467, -0.929227, -0.964833, -0.899682, 0.582792, 0.252719, 0.29849, -0.358788, -0.271896, 0.151327, 0.465588, 0.950274, 0.806618, 0.188667, 0.855546, -0.150291, 0.489987, 0.72308, 0.899572, 0.0439931, 0.770762, 0.719644, 0.960778, 0.624686, 0.200594, -0.374539, 0.211734, -0.14137, -0.445102, -0.606248, 0.838729, -0.95552, 0.800596, -0.206231, 0.760265, 0.848912, 0.586275, 0.939149, 0.794344, -0.392557, 0.457949, 0.170103, 0.364066, 0.538678, 0.654905, -0.833593, -0.0452503, -0.970623, -0.362619, -0.228047, 0.288496, 0.963788, 0.458365, -0.915901, 0.821684, 0.599505, 0.581765, -0.0154421, -0.641207, -0.191018, 0.37285, -0.225353, -0.119407, -0.529529, -0.154552, 0.474052, -0.63037, 0.675077, -0.264222, -0.803624, 0.557425, -0.777664, 0.263067, -0.109054, -0.804732, 0.44337, -0.0418766, 0.0675651, -0.923227, -0.857262, -0.083222, 0.196669, -0.767924, 0.059455, 0.406639, 0.034814, 0.230087, -0.866187, -0.565178, -0.378605, 0.355942, -0.872525, -0.730114, 0.88226, 0.767795, -0.171929, -0.0665114, 0.53842, -0.720779, 0.672291, -0.299033, -0.627424, -0.487063, 0.334224, 0.560198, 0.84027, -0.753281, 0.947195, -0.128529, -0.00640878, -0.582014, 0.752187, -0.893462, -0.0994197, -0.248316, 0.824938, 0.905456, 0.578829, -0.0469108, 0.0514392, -0.0887325, -0.450397, 0.471519, 0.0330281, -0.172396, 0.0073372, 0.928293, -0.0374091, 0.947206, -0.00615595, -0.0157748, -0.621634, -0.593515, -0.0449905, -0.0987029, -0.601736, -0.0960969, -0.245676, 0.161347, -0.561463, -0.94962, -0.457005, 0.70891, -0.479231, 0.354313, -0.605635, 0.381024, -0.696587, -0.822461, 0.429845, -0.938922, -0.168482, 0.938373, 0.402177, 0.248525, -0.781958, 0.404077, 0.609555, 0.0913184, 0.0292787, 0.931143, -0.231269, 0.88052, 0.112664, -0.991199, -0.247578, -0.530532, -0.169194, -0.410277, -0.688733, 0.00311521, 0.0205311, 0.121883, -0.292534, -0.893606, -0.348849, -0.138049, -0.304244, 0.822176, -0.683362, -0.87083, -0.968877, 0.494644, 0.309413, -0.384971, -0.890947, 0.113656, -0.671208, 0.940538, -0.0952804, 0.233757, -0.080759, 0.314824, 0.982159, -0.1048, -0.190979, -0.177347, 0.798308, 0.57818, -0.259018, -0.816099, -0.503294, 0.49814, 0.315617, -0.178144, 0.397203, -0.517956, -0.189113, -0.286492, 0.272085, 0.379386, 0.355694, 0.897703, 0.315373, -0.3807, 0.487014, 0.717714, -0.673253, 0.981478, -0.332265, 0.40505, 0.676534, -0.266391, 0.479232, 0.949341, 0.0219499, 0.384864, 0.614858, 0.876314, 0.82702, 0.992893, -0.726779, -0.725983, -0.362472, 0.153646, -0.605464, -0.944948, -0.465395, 0.534819, 0.195669, 0.362825, 0.335076, 0.739653, 0.530114, 0.695738, 0.0380255, -0.137006, 0.323009, -0.485344, 0.0178199, -0.99603, -0.929866, 0.156108, -0.62796, 0.284339, 0.994081, -0.496042, 0.331517, 0.569367, -0.770229, -0.775163, -0.676421, -0.399925, -0.99075, 0.196009, -0.893768, 0.0403108, 0.666352, 0.0599927, -0.916998, 0.303941, -0.472537, -0.860351, 0.108808, -0.75704, 0.801321, -0.620509, 0.286595, -0.360117, 0.872652, 0.90372, -0.518208, -0.310613, -0.590184, -0.818451, -0.35645, 0.300844, 0.497084, -0.726834, -0.0874482, 0.853368, 0.493854, -0.534528, -0.482295, -0.951232, -0.55822, 0.186602, 0.986438, 0.811697, -0.388363, 0.112039, -0.373219, 0.582584, 0.744025, -0.484842, -0.194777, -0.646648, 0.659611, 0.201772, 0.288181, 0.457309, -0.842049, 0.763759, -0.179248, -0.110206, 0.933764, 0.38977, 0.18648, 0.76104, -0.52643, 0.30346, 0.132167, -0.575273, 0.303012, 0.210129, -0.274014, 0.761919, -0.743815, -0.061682, -0.522807, 0.946353, -0.773457, 0.114291, 0.755849, -0.497603, 0.904754, -0.342601, -0.698415, -0.182205, 0.0108314, 0.0870837, 0.955081, -0.0217187, 0.261563, 0.559379, 0.288886, -0.667742, 0.325399, 0.971416, -0.309867, -0.700409, -0.534972, -0.346779, 0.175589, 0.299484, -0.545101, 0.712965, 0.150431, -0.200346, 0.570786, -0.109344, 0.102252, -0.22338, 0.704983, 0.501762, 0.212614, 0.208866, -0.89879, 0.518076, -0.0338979, 0.978014, 0.211242, -0.512239, 0.375248, 0.541255, 0.847858, 0.928356, -0.916696, 0.614665, 0.794594, 0.4278, -0.624331, -0.998771, 0.322609, -0.415109, 0.654048, -0.265231, 0.41299, 0.923568, -0.0915033, 0.542942, -0.275003, -0.209721, -0.0870632, -0.848298, 0.936163, 0.941023, -0.683922, 0.624985, 0.657041, -0.508188, 0.558438, 0.67501, -0.670176, 0.0339427, 0.802017, -0.498919, -0.374192, -0.149754, 0.0510422, -0.0608443, -0.882018, 0.528408, -0.0111853, 0.861861, 0.614947, 0.614112, 0.568437, -0.259985, -0.46802, -0.970949, 0.265301, -0.891048, 0.728453, -0.905363, 0.311547, 0.228328, -0.789971, 0.73584, -0.676586, 0.0150203, 0.0814988, 0.542754, 0.0903459, 0.682715, 0.784986, -0.341171, 0.593197, -0.961585, 0.759422, 0.109916, 0.233562, -0.0574016, 0.436914, -0.728883, 0.914935, -0.444912, -0.694538, 0.992889, 0.874158, 0.454638, 0.754599, -0.599894, 0.454717, -0.167013, 0.424713, -0.379572, 0.142675, 0.430378, 0.846839, 0.0622848, 0.647092, -0.47989, -0.41821, -0.256364, 0.750314, 0.720298, 0.993911, -0.724383, -0.961804, 0.342623, -0.878239, 0.702405, -0.0618905, -0.951756, -0.479653, -0.993549, -0.507243, -0.0900914, 0.946744, -0.35845, -0.51393, -0.790476, 0.0109175, 0.482957, -0.638901, 0.303775, 0.585702, -0.12227, -0.108386, -0.266102, -0.723838, 0.968207, -0.657203, -0.05363, -0.716199, -0.341963, 0.609473, 0.554611, -0.319928, -0.614122, 0.855726, 0.483867, 0.104812, 0.870976, -0.775443, 0.12643, 0.212933, -0.402185, 0.753286, 0.502584, 0.953522, 0.707147, 0.0335139, 0.431708, -0.0799414, -0.725612, -0.785879, -0.222208, -0.52688, 0.042515, 0.889293, -0.784683, 0.874406, 0.44012, 0.406547, 0.240393, 0.42868, 0.169521, 0.757022, -0.602274, 0.312624, 0.155987, 0.13136, 0.512884, 0.145477, 0.862993, -0.994396, -0.332312, 0.0644046, -0.240897, -0.709442, 0.952971, -0.401925, 0.2478, 0.0269982, -0.732536, 0.545709, -0.32144, 0.576146, -0.551035, -0.626233, -0.358436, -0.306294, 0.0585157, 0.52943, 0.113472, 0.454851, 0.907323, 0.230044, 0.137523, 0.24068, 0.735392, 0.581026, 0.867344, 0.725583, 0.971888, 0.108783, 0.376399, -0.0600265, -0.559422, -0.46082, 0.0498636, -0.29749, -0.202268, 0.286851, -0.178333, 0.788963, 0.799141, 0.43816, 0.380249, 0.908423, -0.0546642, 0.689409, 0.363447, -0.452768, -0.771148, 0.400614, -0.886282, 0.292076, 0.0678701, -0.988272, -0.247364, -0.869847, 0.430091, 0.774323, 0.152408, -0.752624, 0.418832, -0.096278, -0.637828, -0.215469, -0.593697, 0.321792, 0.0147483, 0.394468, 0.427031, 0.942361, -0.34293, -0.630867, 0.802988, -0.3415, -0.964689, -0.119928, -0.798857, -0.0851199, 0.0200272, 0.218752, 0.196012, -0.257895, -0.514462, -0.16705, -0.895064, 0.601751, -0.686708, -0.550972, -0.915024, -0.235198, 0.027457, 0.35193, 0.908273, 0.830385, -0.289368, 0.464106, -0.201673, -0.894247, 0.374713, 0.862315, -0.648092, -0.521336, 0.866767, -0.580183, 0.128926, 0.542677, 0.981753, -0.725618, 0.246305, -0.5804, 0.635505, 0.263996, 0.323276, 0.807972, 0.837977, -0.982491, 0.856643, 0.457683, -0.499013, 0.905082, 0.671227, 0.210394, -0.699537, -0.5028, 0.343126, 0.345453, 0.00861637, 0.107806, -0.810467, 0.419261, -0.895156, -0.234296, -0.299855, -0.0426453, 0.951752, 0.806278, -0.540247, -0.369191, -0.623355, 0.140463, -0.850824, -0.852931, -0.674577, 0.136698, 0.650755, 0.634093, -0.166767, -0.597438, -0.284384, 0.54123, 0.0509886, 0.621989, -0.710619, -0.136419, -0.843283, -0.133149, 0.762042, -0.469736, -0.228518, 0.403615, -0.17839, 0.429833, 0.334851, 0.29339, -0.84869, -0.58786, 0.0560794, -0.615616, 0.519339, -0.347253, 0.44314, -0.115862, 0.754938, 0.645458, -0.813429, 0.907086, 0.766849, -0.417167, -0.550361, 0.926465, -0.57025, 0.258218, -0.91865, 0.124592, 0.0932111, 0.719128, -0.341736, -0.240266, -0.00454793, 0.56179, -0.921938, 0.148384, 0.904697, 0.523298, 0.00851441, 0.911872, 0.39274, -0.714165, -0.116368, 0.0549758, 0.0186515, -0.67681, 0.339561, 0.354921, 0.450972, -0.247666, 0.684087, -0.788884, -0.603777, 0.490832, 0.768313, 0.877434, 0.558731, 0.437305, -0.640571, 0.359266, 0.28141, 0.195258, -0.92761, 0.810532, -0.864831, 0.414522, -0.0403248, -0.0489706, 0.140962, -0.211624, -0.855614, 0.480904, -0.418085, -0.569822, -0.894646, 0.152143, 0.915201, 0.020542, 0.965688, 0.764196, -0.799869, -0.358277, -0.355853, -0.76402, -0.327814, -0.972332, -0.538577, -0.696484, 0.683018, 0.444854, -0.101888, -0.409722, 0.21085, -0.469025, -0.44227, 0.546063, 0.366368, 0.582208, 0.593967, -0.913943, -0.328191, -0.733037, -0.811705, -0.762526, -0.409228, 0.160824, -0.246098, 0.273525, -0.225233, 0.198686, 0.1344, 0.376795, -0.945562, -0.0255475, 0.135099, 0.0292329, -0.627584, -0.714494, -0.754828, -0.942536, -0.0698142, -0.230023, -0.076341, 0.0838493, -0.477999, -0.56342, -0.356539, -0.271806, 0.669544, 0.274736, 0.397901, 0.34154, 0.824373, -0.911858, 0.0190909, 0.235768, 0.760696, -0.758289, -0.0748842, 0.956307, 0.017414, 0.891065, -0.103861, 0.527398, 0.581086, 0.0449639, 0.939671, 0.828186, -0.716247, 0.491017, -0.0320575, 0.31904, 0.646367, -0.447967, -0.433616, -0.587697, -0.452553, 0.0504689, -0.271197, -0.788405, -0.818424, -0.0920659, 0.239277, 0.523465, -0.309063, -0.596295},
-	{0.910849, -0.470467, -0.640565, -0.321625, 0.844328, 0.864626, 0.146021, -0.824161, 0.849034, 0.967821, 0.51608, 0.550591, 0.160095, 0.206404, 0.690759, -0.123275, 0.141239, 0.920054, -0.279985, 0.194502, 0.12994, -0.354665, -0.701717, 0.0943522, -0.592322, -0.262728, 0.713071, -0.889435, -0.223776, -0.538983, -0.160508, -0.169896, 0.150197, -0.401474, -0.0499696, 0.350834, 0.849278, -0.186866, 0.0362204, -0.958466, 0.255306, 0.0796648, 0.662205, 0.608994, -0.24893, 0.630577, 0.978513, -0.876611, -0.741355, 0.533727, -0.251744, 0.290079, 0.597734, -0.40218, 0.00556934, -0.782966, 0.504045, 0.711679, 0.795148, 0.844326, -0.555312, -0.06871, 0.563694, 0.332177, 0.509266, 0.77713, 0.883868, 0.199021, 0.827399, 0.770765, 0.149854, 0.0470933, -0.16625, -0.0442195, 0.999729, -0.0765445, 0.45251, 0.550483, 0.074934, 0.789987, 0.0366898, 0.750707, 0.85773, -0.844599, -0.619151, -0.354832, 0.625521, -0.76818, 0.875412, -0.0127101, -0.585932, -0.19773, -0.484993, -0.600579, 0.174313, 0.162485, -0.776504, -0.888142, 0.802218, -0.382545, -0.983176, -0.759592, 0.0213368, -0.445595, 0.460362, -0.908146, 0.64711, -0.093484, -0.165119, -0.599104, 0.52513, -0.396702, -0.10764, 0.554714, -0.836139, -0.746107, -0.905371, -0.749155, -0.693147, 0.287055, 0.17288, -0.0415285, 0.0953548, 0.317199, 0.660928, 0.146477, 0.485313, -0.78443, -0.203876, -0.751049, 0.798033, -0.488707, 0.964661, 0.692482, -0.137482, 0.849004, 0.871939, -0.822189, -0.129539, 0.6069, -0.902337, 0.0180131, 0.868614, -0.300096, -0.225855, -0.847306, 0.851871, -0.783193, 0.987779, -0.853097, -0.523234, -0.532302, 0.158429, -0.939444, -0.0106947, 0.320563, 0.726568, 0.787751, 0.637063, -0.905632, -0.736031, 0.366666, 0.733193, 0.0203806, -0.208248, 0.149725, -0.678749, -0.201587, -0.861624, -0.286316, -0.0464352, 0.794196, 0.728825, 0.103423, -0.507084, -0.661478, -0.799246, -0.599403, 0.288381, 0.119313, 0.184376, -0.249307, 0.717728, -0.485618, -0.68982, 0.831088, 0.755906, -0.563731, -0.763318, -0.610688, 0.200799, -0.0404085, -0.560186, 0.237697, -0.682354, -0.359427, -0.811078, 0.0666624, -0.994607, 0.0229445, 0.257558, -0.389381, -0.201625, 0.423673, -0.492684, -0.845369, 0.283091, 0.191394, 0.91926, -0.599647, 0.207188, -0.572912, 0.438593, -0.295313, -0.351762, 0.0105305, -0.863311, -0.862291, -0.549828, -0.701372, -0.0825851, -0.29009, -0.238976, -0.198487, 0.731013, -0.0459202, 0.55114, 0.62683, -0.731609, 0.635344, -0.632112, -0.194798, 0.810163, 0.374659, 0.3179, 0.806417, -0.493681, -0.9183, 0.487583, 0.481773, 0.244714, 0.126304, 0.677964, -0.47114, 0.631782, 0.681205, -0.334338, 0.418775, 0.632002, 0.0677048, -0.623693, 0.314934, -0.388613, -0.659987, -0.800012, 0.926137, 0.791255, 0.853628, -0.0983448, -0.977847, 0.977128, -0.877936, 0.270251, -0.0455304, -0.368376, -0.758311, 0.157898, -0.449609, -0.29534, 0.876063, -0.158489, 0.771911, 0.093461, 0.565233, -0.306138, -0.578357, -0.387303, -0.650878, 0.519252, 0.650475, 0.304327, 0.18587, -0.321133, -0.616153, -0.464212, 0.89404, 0.831411, -0.350345, 0.605129, 0.0794393, -0.213502, 0.292124, 0.608229, -0.379467, 0.0240265, 0.319623, -0.814383, 0.636977, 0.487916, 0.559083, 0.995693, -0.295228, -0.990446, -0.19024, 0.376202, -0.172837, -0.718816, -0.847946, -0.2868, -0.614237, -0.391067, 0.513642, -0.500836, 0.425231, 0.0788584, 0.664118, -0.0858057, 0.429057, -0.449477, 0.678215, 0.765263, 0.637511, 0.825168, -0.813095, -0.448816, -0.784462, 0.477828, -0.936043, -0.797506, 0.403611, 0.202527, -0.333749, 0.10057, 0.562994, 0.979301, 0.588516, -0.519206, -0.820081, -0.907062, -0.984077, -0.566657, 0.465706, -0.199878, 0.911912, 0.0138586, 0.0610543, 0.525018, -0.839306, 0.960164, 0.68306, 0.00292829, -0.965107, 0.207832, 0.142816, -0.915359, 0.719852, -0.91841, -0.824378, 0.804732, 0.447817, 0.788663, 0.483012, -0.170195, -0.116603, -0.489365, 0.825084, -0.340645, 0.318676, -0.917927, -0.318054, 0.554421, 0.721183, -0.219876, -0.188159, 0.168466, 0.407792, 0.268276, -0.0468549, 0.455471, -0.977376, -0.600463, 0.107577, -0.964164, -0.0246182, -0.713624, -0.766096, -0.203042, 0.228942, 0.839548, 0.0307135, 0.257181, -0.164793, 0.877669, 0.522211, -0.864015, 0.225694, 0.322444, -0.250168, -0.759991, 0.477388, 0.1117, -0.243176, -0.403282, 0.506649, 0.974916, -0.358315, 0.812683, -0.894964, -0.506347, -0.542225, 0.13594, 0.234605, 0.859901, -0.888293, 0.177748, -0.972588, 0.454297, -0.433503, 0.0200509, 0.836333, 0.746952, -0.308593, 0.189695, -0.0432311, -0.821065, -0.796352, -0.339093, -0.0716153, -0.132487, -0.233558, -0.750471, -0.848531, -0.275137, -0.388337, 0.930609, 0.686211, -0.0945042, -0.0886581, 0.359287, -0.0254124, -0.123944, -0.18853, 0.293793, -0.30692, 0.092539, 0.221664, -0.0785288, -0.619145, 0.0654441, 0.746606, -0.654139, 0.131903, -0.144788, -0.908835, 0.106271, 0.175614, 0.79137, -0.919744, -0.941822, 0.470284, -0.089072, 0.991268, 0.697229, -0.982693, 0.12223, 0.708396, 0.471259, -0.147605, -0.173761, -0.77249, 0.810526, 0.185746, 0.316197, 0.218368, 0.201458, -0.617059, 0.456552, -0.145407, -0.519438, -0.945095, 0.59639, -0.986734, 0.756568, 0.671948, -0.497552, -0.33577, 0.716919, 0.970276, -0.960107, 0.18386, -0.591281, 0.2149, -0.147385, 0.375324, -0.980599, -0.480337, -0.217095, 0.949678, 0.194417, -0.000530275, 0.947168, -0.765979, 0.516924, 0.365884, 0.0881484, 0.0836342, 0.667941, -0.11457, -0.169204, -0.889607, 0.907101, -0.925846, 0.0204581, 0.154015, -0.415923, 0.509419, -0.204073, -0.00165737, -0.665317, 0.112088, 0.815353, 0.218904, 0.684897, 0.0124226, 0.305425, -0.697167, -0.030745, 0.192141, 0.661928, 0.0765678, 0.171695, 0.727537, -0.027138, -0.854473, -0.811139, -0.787435, -0.460262, -0.597643, -0.746373, 0.182258, 0.111217, -0.121844, -0.0816928, 0.234522, -0.596854, -0.362663, 0.588098, -0.656524, 0.55071, 0.0410417, 0.85329, -0.523778, 0.721438, 0.883871, 0.545525, -0.750576, 0.793309, -0.340021, 0.549422, -0.780654, -0.110102, 0.0654066, -0.284531, -0.89594, 0.851977, -0.0439827, -0.897668, 0.840194, -0.513548, -0.952756, -0.249007, 0.246999, 0.671639, -0.557671, 0.513717, 0.0872605, -0.320868, 0.748793, 0.761215, 0.244368, -0.423064, 0.333726, 0.04499, -0.848384, 0.917965, -0.705071, -0.905874, 0.529363, 0.851721, -0.225089, 0.403986, -0.425595, -0.114156, 0.424443, -0.43348, 0.255117, -0.304298, -0.90332, -0.04421, 0.42885, -0.518567, -0.272159, 0.0289791, -0.862933, -0.465361, 0.95106, 0.531221, 0.592157, -0.263071, 0.125661, 0.895698, -0.390672, 0.71627, -0.169982, -0.52228, 0.275637, 0.808001, 0.408279, 0.329839, -0.237513, 0.298789, 0.110289, 0.300261, -0.190367, -0.760074, 0.369584, 0.302107, -0.741715, -0.724164, 0.600763, 0.657749, 0.452784, 0.710148, 0.720981, -0.0720243, -0.71168, -0.484257, -0.886173, 0.843314, 0.370856, 0.564415, -0.678116, 0.0956433, -0.371479, -0.197613, -0.166438, 0.345005, -0.548363, -0.943637, -0.831224, 0.700742, -0.906158, 0.404026, 0.974553, 0.88408, -0.562278, 0.270194, 0.702539, -0.0458365, 0.173261, 0.44032, -0.482804, -0.0339326, 0.127864, 0.0527873, -0.461758, 0.409494, -0.333365, -0.900085, -0.0579596, -0.865019, 0.78962, 0.599216, 0.675541, 0.64768, -0.714914, -0.0480823, 0.0756235, 0.85837, 0.465784, -0.470776, 0.935242, 0.376957, -0.545684, 0.384888, -0.125672, -0.553297, -0.171657, -0.534415, -0.589851, 0.202233, 0.101391, 0.951033, -0.107198, -0.895645, 0.351076, 0.810477, 0.566332, -0.203504, 0.18892, -0.683683, 0.362684, -0.562861, -0.0254546, 0.795402, -0.167425, 0.152578, -0.0494245, -0.000877255, -0.686269, -0.716703, -0.627063, 0.139219, 0.806995, 0.300606, 0.779928, -0.338973, -0.690688, -0.0104165, -0.287704, 0.43603, 0.42026, -0.470378, -0.0446324, 0.0185517, -0.266295, 0.167802, 0.0251946, -0.238135, 0.608136, -0.114691, 0.362286, 0.358573, 0.354769, 0.74151, 0.81205, -0.437099, 0.845006, 0.649092, -0.880628, -0.428868, -0.626443, -0.0091237, -0.636932, -0.236931, 0.416149, -0.557138, -0.920934, 0.193741, -0.58812, -0.682295, -0.3869, -0.288137, -0.447749, 0.393619, -0.498721, 0.498098, 0.825933, -0.586002, 0.0392878, -0.402507, -0.241864, 0.324008, 0.102747, -0.757225, -0.57001, 0.318364, 0.821642, -0.727252, -0.557518, -0.881655, -0.983132, 0.749187, -0.515035, -0.22088, -0.537658, 0.381328, -0.362549, 0.476941, 0.814203, -0.759541, -0.804331, -0.458052, -0.582451, 0.235982, 0.503585, -0.708964, -0.504434, -0.278722, -0.856496, -0.354544, -0.755435, 0.595375, -0.918826, 0.980971, -0.459158, 0.119845, -0.0243032, -0.100703, 0.917934, -0.641195, -0.488398, -0.773419, -0.907503, 0.984661, -0.34071, 0.386618, -0.180598, -0.588877, 0.858713, -0.35681, 0.856859, -0.349723, -0.582299, -0.42627, 0.519571, 0.875772, -0.594465, -0.718048, -0.44701, -0.285932, 0.738585, 0.326663, -0.112819, -0.148217, 0.607854, -0.0752867, 0.494828, 0.398421, 0.440983, -0.118088, 0.959028, 0.40705, 0.135377, -0.968365, -0.918539, 0.248441, 0.804175, 0.0295646, -0.70935, -0.708897, 0.355128, 0.313898, 0.884687, -0.657241, -0.946743, 0.861158, -0.682352, -0.306441, 0.333712, -0.191911, -0.276982, -0.173362, 0.335268, -0.768157, -0.641172, -0.163542, 0.763855, -0.837102, -0.360517, -0.0928987, -0.692552, -0.691823, 0.321244, 0.148792, -0.795337, 0.13785, 0.703119, -0.130976, 0.0276056, -0.381342, 0.355754, 0.732274, -0.00724625, 0.591641, -0.381733, 0.0120315, -0.616202, 0.506854, -0.268667, -0.26321, -0.356655, 0.268334, 0.407398, -0.225888, -0.27969, -0.13947, 0.672148, 0.20899, 0.549513, 0.967157, 0.319982, 0.884508, -0.667578, 0.879259, 0.299357, -0.645859, 0.496625, -0.598619, 0.159403, 0.61182, 0.415522, 0.740287, -0.600963, -0.585392, 0.394846, 0.414642, 0.806186, 0.879142, 0.986551, 0.273379, -0.848205, 0.120281, -0.12083, -0.200768, 0.135986, 0.748203, 0.219218, -0.223723, -0.28717, 0.376212, -0.385359, -0.681794, -0.0720629, -0.455626, 0.108512, -0.415369, -0.696333, 0.525647, 0.806835, -0.5248, -0.150807, 0.229769, 0.984172, 0.850877, -0.324822, 0.316393, 0.928921, -0.817067, -0.90174, -0.482531, 0.627904, -0.129732, 0.816975, -0.746461, 0.412385, 0.269306, 0.184784, 0.110046, -0.0772555, 0.819562, 0.172767, -0.685665, 0.967843, -0.0289286, 0.78855, -0.337799, 0.0634026, -0.383794, -0.931069, 0.471801, -0.718876, 0.256438, 0.154739, -0.885162, -0.32385, 0.919284, 0.194943, -0.925894, 0.12286, 0.938319, 0.111541, -0.442368, -0.223836, 0.352102, 0.22984, 0.206372, -0.363305, -0.834883, -0.0169307, -0.433156, -0.114306, 0.178652, -0.920106, -0.762435, 0.225217, -0.105619, -0.49605, -0.333083, 0.00813797, -0.172921, -0.328896, 0.769809, 0.191845, -0.957351, -0.00344981, -0.195217, 0.461939, 0.0582162, -0.829618, -0.333408, 0.936955, -0.653217, -0.552437, -0.606871, -0.38349, 0.739693, 0.54883, -0.289908, 0.105089, -0.712219, -0.697712, -0.818526, 0.286715, -0.913485, -0.226966, 0.029124, 0.0377747, -0.799466, 0.51156, -0.839325, 0.0598407, 0.875204, -0.405551, -0.306927, -0.628854, -0.886442, 0.660384, -0.281743, -0.743135, -0.898481, 0.354122, -0.645052, 0.708044, -0.972029, 0.941974, 0.973087, -0.769279, -0.282123, 0.234067, 0.0697016, 0.517099, 0.251671, -0.993517, 0.257971, 0.395999, 0.670885, 0.945638, 0.94145, 0.606297, 0.503856, -0.700866, -0.801918, -0.839236, -0.640658, -0.289717, 0.934599, -0.301731, 0.796747, 0.139877, 0.245655, 0.532727, -0.770552, -0.691088, -0.685103, -0.730693, -0.921664, -0.176116, 0.264827, -0.912344, 0.779712, -0.819105, 0.0771892, 0.306576, 0.0765461, -0.86001, -0.826839, 0.23594, 0.80626, 0.797084, 0.928611, 0.173758, -0.489981, 0.183386, 0.308154, 0.920596, 0.614599, -0.992572, -0.731579, -0.959958, -0.312035, 0.539893, -0.576045, 0.959078, -0.732215, -0.696633, -0.663103, -0.678192, -0.976189, -0.816557, -0.588897, 0.117309, 0.876472, 0.86034, 0.906321, -0.903285, 0.983938, 0.000758536, 0.0979189, 0.399913, -0.938581, -0.719, 0.952864, 0.584672, -0.982073, -0.543975, -0.498834, 0.355504, 0.481442, -0.641968, 0.549208, -0.962559, 0.370885, 0.528227, -0.20983, -0.503928, -0.357592, 0.0381018, 0.307669, 0.694403, -0.820982, -0.853282, -0.118081, -0.806697, -0.625752, 0.53053, 0.647283, 0.937312, -0.293168, 0.0576371, -0.84963, -0.83988, 0.44112, 0.285462, 0.0182456, 0.7653, -0.848273, -0.532966, -0.346381, 0.4484, -0.776459, -0.891804, 0.641373, -0.513735, -0.523959, 0.362778, -0.917125, -0.480167, 0.896575, -0.817849, -0.378696, -0.346372, 0.787249, 0.6111, -0.295896, -0.0319579, -0.607164, -0.967409, -0.281226, -0.429512, -0.33132, -0.747434, 0.723152, 0.175903, -0.272986, 0.279553, -0.824787, 0.658045, -0.237678, 0.368501, 0.491662, 0.583212, 0.656298, -0.995419, 0.0580932, 0.25138, 0.325805, -0.737054, -0.296986, 0.46404, 0.719853, -0.70049, 0.589446, -0.990406, 0.490022, 0.0608424, 0.884616, 0.216363, -0.722005, -0.96256, 0.684545, -0.93633, 0.304412, -0.212958, -0.922079, -0.82201, 0.643898, 0.0688636, 0.768808, 0.935182, -0.181924, 0.784428, -0.153081, 0.966782, 0.99804, -0.171142, 0.70715, 0.769544, -0.529869, 0.6497, 0.316795, 0.255978, 0.947812, 0.931515, -0.96716, 0.103732, -0.864203, 0.272257, 0.548499, -0.314725, -0.536893, 0.646167, 0.684349, 0.866053, 0.983317, 0.760331, -0.164577, 0.929162, -0.0915893, -0.112834, 0.977488, -0.160753, -0.348614, -0.88317, 0.283774, 0.595461, 0.582978, 0.837182, -0.324454, 0.98246, -0.696641, -0.751758, 0.83126, 0.168594, -0.606456, 0.484822, -0.634964, 0.490428, -0.175506, 0.171682, -0.858547, 0.545228, -0.452274, 0.994329, 0.76001, -0.918934, 0.241208, 0.471537, -0.139727, 0.199179, -0.633921, -0.165454, 0.176485, 0.73384, 0.520383, 0.479458, -0.53961, -0.709615, 0.235601, -0.664556, -0.0143329, 0.35972, -0.491675, 0.633613, 0.46877, -0.380084, 0.386132, -0.389917, 0.403136, 0.823516, -0.267075, -0.727606, -0.12268, -0.185359, -0.148107, -0.0877181, -0.348381, 0.619746, 0.540644, 0.675806, 0.105873, -0.743938, -0.596992, -0.286381, -0.381821, -0.684795, -0.786104, 0.752309, 0.190019, -0.916682, 0.733015, -0.150773, -0.586471, 0.784676, 0.982636, 0.021832, 0.187534, 0.801648, -0.0131518, 0.34516, 0.15599, 0.178483, 0.658149, -0.578609, -0.43552, 0.534915, -0.579805, -0.799236, -0.502297, -0.685198, 0.0526331, -0.45528, -0.980266, -0.341202, 0.395653, 0.243321, 0.462888, 0.855459, -0.118007, -0.861306, -0.3283, 0.779211, -0.189082, 0.365414, -0.556866, 0.0933548, -0.78859, 0.806656, -0.645851, 0.324122, 0.327625, 0.41952, 0.50433, -0.45861, -0.39727, 0.315591, -0.822003, -0.712762, -0.693772, -0.781261, -0.52907, -0.986594, -0.0709698, 0.800319, -0.823155, 0.38573, -0.50559, -0.306038, -0.00610169, -0.719862, -0.158278, 0.847781, 0.0129117, 0.862431, -0.969824, -0.386816, 0.806479, 0.908876, 0.389872, -0.551162, 0.838313, 0.235243, 0.941813, 0.180692, 0.970058, 0.0495733, 0.926741, 0.493326, 0.491335, -0.187409, 0.174382, -0.802748, -0.632061, -0.76892, 0.105384, -0.593032, 0.278454, -0.913251, -0.680783, 0.877707, -0.922134, -0.36019, -0.466853, 0.56182, 0.800626, 0.0415746, 0.834618, 0.715978, 0.662605, 0.249089, -0.291016, 0.620719, 0.523504, 0.276618, -0.390668, 0.457892, -0.652842, 0.756054, 0.113303, 0.24858, -0.737955, -0.612735, 0.110756, -0.704867, -0.119019, 0.779933, 0.458681, -0.640784, 0.980502, -0.738015, -0.341748, 0.261402, -0.411771, 0.28268, -0.977903, 0.781253, 0.406703, 0.202957, 0.89672, -0.974196, -0.36549, -0.0918277, -0.612042, 0.390305, 0.865046, 0.992064, 0.0543939, 0.424223, -0.414334, 0.98381, 0.253279, -0.500465, -0.183984, -0.489716, 0.582019, -0.544037, 0.33911, 0.326625, 0.748315, 0.95616, -0.789744, -0.776785, 0.259845, 0.0315135, -0.362455, 0.162903, 0.489291, 0.6078, 0.709101, -0.154921, -0.0389974, 0.682482, -0.886508, -0.510715, -0.217969, -0.247961, -0.792128, -0.247261, -0.949075, 0.228163, 0.849298, 0.11524, -0.769488, 0.946395, -0.0402767, -0.107237, 0.255143, -0.464325, 0.902566, 0.658936, 0.187494, 0.943773, 0.945363, -0.0468872, -0.62967, -0.430857, -0.684406, -0.654501, -0.0799891, 0.793888, 0.0189258, 0.859392, -0.757917, -0.137215, 0.825193, 0.760035, 0.799128, 0.66645, 0.561245, -0.981005, 0.270348, 0.174755, -0.246066, 0.433201, -0.106781, 0.267947, 0.684793, 0.766158, 0.208974, -0.46301, -0.323953, 0.983062, -0.488275, -0.140876, 0.0124878, -0.0704919, -0.798498, -0.775539, 0.920679, 0.830697, 0.547459, -0.535538, -0.810474, 0.361912, -0.34358, 0.950084, 0.395912, 0.576398, 0.677168, -0.34159, -0.384698, -0.742039, -0.915234, -0.522638, 0.200656, 0.564601, -0.454804, 0.526213, 0.0948079, 0.561407, 0.668227, 0.318423, -0.243134, 0.331087, 0.421517, -0.228136, 0.951679, -0.0224719, 0.479548, 0.113638, 0.0492656, -0.902826, -0.602572, 0.493057, 0.0236866, -0.999121, -0.814833, 0.313448, 0.467679, 0.890182, -0.935102, -0.334932, -0.396167, 0.18262, -0.161332, 0.615585, 0.801623, 0.532313, -0.684869, -0.143751, 0.539117, 0.170651, -0.671866, 0.732836, -0.803535, 0.550091, 0.890803, 0.445329, 0.422691, 0.878451, -0.813855, -0.71182, -0.20348, 0.80994, 0.654504, -0.109871, -0.0394941, 0.409952, 0.46136, -0.656527, -0.695674, -0.639629, 0.0676622, -0.202544, 0.714832, 0.995973, 0.881068, 0.109831, -0.0991852, 0.705959, -0.201765, -0.754855, 0.849618, -0.41424, -0.728977, 0.235276, -0.571583, 0.883517, 0.933122, 0.801519, -0.704536, -0.311992, -0.614545, 0.228509, 0.782035, -0.0970803, 0.75406, -0.839872, -0.27263, -0.0526681, -0.678198, 0.400387, 0.73867, -0.154801, 0.596302, -0.465045, -0.892897, -0.831982, -0.220706, 0.85823, -0.600266, -0.939985, 0.544184, 0.209308, 0.22253, 0.780276, 0.692202, 0.42707, -0.794942, 0.542771, -0.83452, 0.69808, 0.389145, -0.995917, 0.842852, 0.757079, -0.529413, -0.895724, -0.80988, -0.301999, 0.774669, -0.168884, 0.322194, 0.232307, 0.992912, 0.588968, 0.0616875, -0.887047, 0.544343, 0.107378, 0.620709, 0.338089, 0.355009, -0.877585, -0.961393, 0.397608, 0.272159, -0.295749, 0.353122, -0.845863, -0.342124, -0.941595, -0.555961, 0.913813, -0.116303, 0.234456, -0.0140676, -0.930708, 0.285107, 0.593528, 0.910649, -0.970461, -0.838282, -0.790433, -0.403819, -0.799561, -0.735309, -0.145348, 0.365425, -0.622293, 0.849819, -0.773857, -0.868357, -0.0280712, 0.28024, -0.762973, -0.412178, -0.807509, -0.480385, 0.75869, -0.759473, 0.129811, 0.406707, 0.0567344, 0.994368, -0.182315, 0.79507, 0.36215, 0.91233, -0.644011, -0.509278, 0.4954, -0.863176, -0.0600391, 0.643589, 0.506349, -0.119022, 0.213354, 0.845744, -0.998131, 0.819695, -0.673878, 0.512521, 0.539418, -0.43541, -0.97432, -0.165497, 0.817696, 0.259968, 0.216706, 0.102149, -0.825986, 0.047613, 0.0276899, 0.327617, 0.131818, -0.613283, 0.0261482, 0.837051, -0.798326, 0.710488, -0.216395, 0.0635576, 0.0861401, 0.950781, -0.992866, -0.818286, -0.51866, 0.930786, -0.289575, 0.246297, -0.652486, 0.383817, 0.433075, -0.502565, 0.325273, 0.00162427, -0.603596, 0.0506528, -0.660332, -0.0781599, 0.399091, 0.877375, -0.96362, 0.754524, -0.789788, 0.695934, -0.0259422, -0.875029, 0.217449, -0.352561, 0.11775, -0.28458, -0.850296, -0.742052, -0.259084, -0.983715, -0.826991, -0.888557, -0.768778, -0.298028, -0.967395, 0.92535, -0.0781933, 0.70222, -0.688001, 0.0487063, -0.555241, 0.874424, -0.865487, 0.0640548, -0.930371, 0.371612, 0.530385, 0.636219, 0.766067, 0.918189, 0.606053, -0.601209, -0.447047, -0.911133, 0.00059271, -0.976738, -0.65356, -0.19111, 0.844225, 0.836373, 0.457562, -0.020969, 0.317229, -0.993139, 0.136392, 0.417194, 0.838553, 0.499118, 0.314087, 0.338934, 0.999284, 0.576656, -0.00757492, -0.923449, -0.10766, -0.623286, -0.090893, -0.669029, 0.388257, 0.150978, -0.25956, -0.85814, -0.101889, 0.658144, -0.221251, -0.166286, 0.64006, 0.751111, 0.778564, -0.193035, -0.674509, -0.677147, -0.963046, 0.107834, 0.175335, 0.139187, -0.648181, 0.918917, -0.257925, 0.404531, -0.248402, -0.308869, -0.337545, 0.162192, -0.355576, 0.240768, 0.827574, 0.759481, -0.790662, -0.915501, 0.714095, 0.904312, -0.313357, 0.803213, 0.0440302, -0.604892, -0.164989, 0.808662, -0.832094, 0.293764, -0.221058, -0.618218, 0.2916, -0.214172, 0.022823, 0.69127, -0.476395, 0.618937, -0.82209, -0.492332, 0.0850858, 0.579383, -0.466516, -0.470776, -0.510482, 0.34571, -0.324306, -0.731717, -0.164376, -0.471606, -0.167352, 0.949865, 0.913061, -0.859054, -0.756628, -0.915008, 0.606286, 0.129351, 0.020985, 0.702207, -0.200868, 0.724097, 0.552507, 0.952328, -0.205006, -0.490114, 0.590749, 0.828471, 0.478115, -0.291607, -0.981043, -0.404235, -0.100977, 0.134921, 0.0879888, -0.435415, 0.028361, 0.714713, -0.102225, -0.868467, -0.333194, -0.41284, -0.402342, -0.0962417, 0.301433, -0.347566, -0.650795, -0.551205, 0.369599, 0.926903, -0.503323, -0.290936, -0.467464, 0.0125082, -0.0650166, 0.118059, -0.780382, -0.24409, 0.314002, 0.145041, -0.207433, -0.830262, -0.834174, 0.389019, 0.561063, 0.736911, 0.137719, 0.297727, 0.0752231, -0.502561, 0.627982, 0.901683, -0.00791613, -0.0380636, 0.31102, 0.136962, 0.00401183, -0.886864, 0.298649, -0.724989, 0.279017, -0.670165, -0.920643, 0.465024, -0.561575, 0.859127, 0.0808162, 0.943976, 0.334064, 0.347437, 0.959749, 0.878861, -0.735408, 0.686599, 0.732512, -0.961512, -0.427364, 0.0907351, 0.0627877, 0.858925, -0.520143, 0.902895, 0.781053, -0.158341, 0.658364, 0.629303, 0.837435, -0.918028, -0.0319982, -0.695499, -0.60093, 0.940471, -0.320365, 0.0812648, -0.280654, 0.890884, 0.824376, -0.0999926, -0.0144543, 0.343377, 0.430146, -0.889814, -0.74043, 0.27333, 0.103915, 0.00945643, 0.480609, -0.51023, -0.842462, 0.430072, 0.644853, -0.414777, -0.0190051, -0.975603, -0.0653847, -0.886271, 0.890287, 0.242616, 0.75638, -0.100867, -0.394153, -0.203566, -0.847047, 0.848418, 0.0652508, -0.386909, -0.051029, -0.805986, -0.409241, 0.123461, 0.724248, 0.813421, -0.936682, -0.198503, 0.915403, 0.0900827, -0.376026, 0.913973, -0.572092, -0.778054, -0.0250036, -0.318242, 0.0212569, 0.708277, 0.704613, 0.894082, -0.19379, 0.979377, 0.297501, 0.534502, 0.796777, 0.635204, -0.927975, -0.99246, 0.408708, 0.323375, 0.535029, 0.882879, -0.949574, -0.311754, 0.546194, -0.758701, -0.514803, 0.0447341, 0.111197, -0.00958166, -0.726688, 0.973364, -0.966019, -0.739615, -0.868483, -0.705894, 0.109241, 0.282478, 0.0977851, -0.513556, 0.386195, -0.649212, 0.639442, 0.72938, -0.65959, 0.661799, -0.949569, -0.99745, 0.396984, -0.321245, -0.473829, 0.904221, 0.837435, -0.340071, -0.312305, 0.542493, 0.414838, -0.613995, -0.167414, -0.459024, 0.130103, 0.0771681, -0.297624, 0.479382, -0.855389, 0.805489, -0.376523, 0.894921, 0.434535, -0.392845, 0.513446, 0.824879, 0.372782, 0.936133, -0.919213, 0.915772, -0.767606, 0.564121, 0.424243, 0.53676, -0.347307, -0.217155, -0.620072, 0.560556, 0.165973, -0.0965439, 0.94784, -0.286516, 0.723325, -0.901419, -0.757251, 0.627429, 0.327905, 0.764794, -0.966786, 0.0911405, 0.115083, -0.325363, -0.953153, -0.569824, 0.0645921, 0.205222, -0.383575, 0.964797, 0.964532, -0.715451, 0.1954, -0.455758, -0.421741, 0.213026, -0.225927, -0.00040832, 0.352613, -0.0530295, 0.838525, -0.114991, -0.50854, -0.247061, -0.00622319, 0.0408451, 0.134959, -0.31646, 0.27415, 0.837164, -0.429292, 0.328014, -0.274526, -0.990745, -0.524465, 0.252441, 0.167951, 0.310881, -0.899444, -0.35333, 0.693769, -0.931647, -0.913595, -0.153877, -0.327667, -0.751704, 0.211219, -0.757244, 0.519254, 0.650258, -0.529221, -0.28146, -0.247667, -0.98545, 0.0428845, 0.252141, -0.246517, 0.464285, 0.731444, 0.484672, -0.0353128, -0.513161, 0.296454, 0.997613, 0.554588, 0.491164, -0.00304262, 0.517918, 0.12356, 0.739415, -0.690128, 0.10188, -0.139485, -0.713505, -0.115495, -0.349585, -0.502031, -0.138705, -0.795283, -0.349359, 0.734922, 0.804518, 0.889438, -0.773218, 0.304567, -0.629132, 0.916469, -0.588392, -0.708008, -0.00806336, 0.515153, -0.24166, 0.407983, 0.725739, -0.703862, 0.420838, -0.905774, 0.123953, 0.460974, -0.470968, -0.471401, -0.0554485, 0.318329, -0.957726, -0.02215, -0.793894, -0.939458, -0.767813, 0.222626, -0.416045, -0.309644, -0.72869, -0.971199, -0.495191, 0.299564, 0.35226, 0.403635, 0.287228, 0.24541, -0.785348, -0.46927, -0.755272, -0.0429934, -0.582936, 0.11762, -0.347868, -0.531361, -0.0195556, 0.214401, 0.299875, -0.528105, 0.765347, 0.158839, -0.381515, -0.749362, 0.569157, -0.872086, 0.862668, -0.0122598, -0.46688, 0.616987, 0.816633, 0.35534, 0.55564, 0.959649, -0.0504761, 0.302379, 0.955048, 0.528257, -0.175956, 0.505283, -0.319743, -0.783946, 0.14059, 0.625082, 0.387414, -0.496852, 0.638247, -0.0748191, -0.217645, -0.321641, -0.735628, 0.361844, 0.261261, -0.0483695, 0.7897, -0.287014, -0.721751, -0.792485, 0.569379, 0.958995, 0.601612, -0.254309, 0.770711, 0.183759, -0.325486, 0.0823018, -0.946231, 0.259744, -0.98928, 0.47507, 0.761587, 0.570367, -0.725462, 0.599451, 0.0553869, 0.613955, -0.644465, 0.0321436, 0.971472, -0.0407264, -0.398801, 0.537772, -0.539522, -0.782853, -0.0353157, -0.706651, -0.412372, 0.587784, -0.254676, -0.786861, -0.961598, -0.721701, 0.799092, 0.79467, 0.621324, 0.252267, -0.667824, -0.325593, -0.713982, -0.130084, -0.149729, 0.252049, 0.983166, 0.666091, -0.14187, -0.546871, -0.120011, 0.916025, -0.14562, 0.440219, -0.749808, 0.343093, -0.0370655, -0.85591, 0.442104, -0.200991, -0.274555, -0.297529, 0.840654, 0.256843, 0.903164, -0.474051, 0.596975, 0.543029, 0.669736, 0.780463, 0.879574, 0.614803, -0.753448, -0.612666, 0.435285, -0.219984, -0.436777, 0.541827, -0.742209, -0.760996, -0.583087, -0.360715, 0.794156, -0.175731, -0.995187, 0.570395, -0.426311, -0.663633, 0.284204, -0.126191, 0.40047, -0.533124, 0.697133, -0.587064, 0.743774, 0.30792, 0.671951, -0.113188, 0.540043, -0.436741, -0.66976, 0.374729, 0.977783, -0.771927, 0.263912, -0.853011, -0.243286, -0.969699, -0.196429, -0.527923, 0.696588, 0.842251, -0.812751, 0.0899629, -0.221446, -0.740835, 0.835853, -0.494664, -0.580629, 0.671711, -0.667087, -0.0280177, -0.827608, -0.700146, -0.487839, 0.0912921, -0.173889, -0.807137, 0.748804, 0.915744, 0.961886, -0.265258, 0.563383, 0.435421, -0.400525, -0.638259, -0.101748, -0.0912669, 0.793601, 0.498822, 0.0549294, -0.708611, 0.077903, -0.616745, -0.293171, -0.240364, 0.19553, -0.288202, 0.292355, -0.790174, -0.386035, -0.598218, 0.413542, -0.723582, -0.537793, 0.0664297, 0.426751, -0.289197, 0.127187, -0.465308, -0.180245, -0.989044, 0.49895, 0.823648, -0.292319, -0.676152, 0.40662, 0.46301, 0.625248, 0.685624, 0.591719, -0.0697792, -0.389626, 0.555706, 0.775104, -0.446562, -0.630785, -0.018671, -0.408808, 0.265638, -0.692317, 0.423271, -0.680585, -0.0164666, 0.240551, 0.216265, -0.915392, 0.319689, -0.715527, 0.304236, 0.859857, 0.476227, -0.830694, -0.848455, -0.258773, -0.873266, -0.397714, -0.694127, -0.121952, -0.991833, 0.215378, 0.850792, -0.682803, -0.703384, 0.713436, 0.088992, -0.796632, -0.0421463, 0.606551, 0.143787, 0.112487, -0.653795, 0.233552, 0.368656, 0.0163992, -0.411648, -0.882379, -0.764765, 0.882636, -0.978203, 0.770161, -0.374428, -0.389811, 0.646409, -0.029816, -0.833209, -0.746897, 0.381778, -0.690669, 0.440036, -0.207841, 0.536878, -0.61208, 0.782928, 0.258548, 0.690832, 0.443599, 0.250245, -0.234111, 0.776892, 0.700579, -0.778868, -0.959216, 0.576928, -0.0279478, -0.619552, -0.647902, 0.183505, -0.867211, -0.526967, 0.570878, 0.65742, 0.194848, -0.588311, 0.231332, -0.629525, 0.184543, -0.578903, -0.892987, 0.135294, 0.61196, 0.672137, -0.0810903, -0.849841, -0.297361, -0.651953, -0.722158, -0.656189, -0.0910948, 0.0806455, -0.751394, 0.82976, 0.502277, 0.135581, -0.988016, -0.648082, 0.0318791, 0.499497, 0.907927, 0.200341, 0.394353, 0.698975, 0.219161, 0.146984, -0.42794, 0.692503, -0.760342, 0.091888, 0.224674, 0.394444, -0.94251, -0.691302, 0.0706846, -0.263801, 0.542598, -0.241028, 0.594923, -0.651395, 0.425396, -0.428342, -0.390447, -0.953216, -0.914022, -0.51578, 0.755638, -0.352264, 0.65232, 0.022631, -0.806773, 0.831129, 0.633409, 0.929313, -0.809065, 0.872125, 0.0178424, -0.162771, 0.285009, 0.484697, 0.304213, -0.831047, 0.932489, -0.482893, -0.581213, -0.680614, 0.514511, 0.307513, -0.00742822, -0.0743562, -0.162673, -0.966487, -0.394864, 0.68208, 0.378932, -0.471459, -0.531471, 0.453718, -0.633667, 0.447652, 0.869662, -0.368643, -0.974316, -0.271796, -0.53772, -0.449849, -0.817436, -0.988644, -0.769127, -0.785817, 0.119451, 0.916371, -0.777374, 0.825794, -0.140933, 0.26016, 0.917629, 0.961468, 0.360611, 0.6241, 0.178492, -0.579563, -0.595534, 0.529652, 0.439842, -0.533334, 0.708589, 0.474777, 0.137284, -0.838717, -0.100499, -0.650828, 0.853491, -0.986708, 0.238956, 0.0492224, -0.0231618, 0.806642, -0.536043, 0.886913, -0.810781, -0.107032, 0.670804, -0.206023, -0.453407, -0.543984, -0.00235618, -0.250419, -0.427661, -0.611363, -0.387551, 0.00509401, -0.561325, -0.338379, 0.628885, -0.397396, -0.265233, 0.621175, 0.62264, -0.520368, -0.23065, 0.216417, 0.182896, -0.633032, -0.575816, 0.603392, 0.462787, 0.120342, -0.258356, -0.330604, 0.620897, 0.513574, 0.898759, 0.0705284, -0.783161, 0.163685, 0.209583, 0.742123, -0.0514796, 0.276955, 0.896989, -0.215852, -0.390623, -0.6393, -0.111464, 0.122024, 0.310745, -0.870276, -0.189309, 0.0280097, 0.897403, 0.878698, -0.539178, 0.510062, -0.890426, -0.746611, 0.546794, -0.59657, -0.107035, 0.168393, -0.202731, -0.97699, 0.469169, 0.210158, 0.289971, -0.627025, 0.184306, 0.718054, 0.175029, -0.414068, -0.154448, 0.97629, 0.710058, -0.703213},
-	{0.0103913, -0.530446, -0.0384585, -0.764654, -0.592347, -0.219707, 0.533994, 0.938168, -0.251502, -0.27468, -0.248195, 0.417762, -0.440089, 0.469997, -0.462603, -0.329797, 0.733461, 0.476928, -0.0161095, -0.815791, -0.02389, -0.930184, 0.381244, 0.0731988, -0.00116067, 0.19154, -0.430224, 0.24255, -0.914491, -0.545085, -0.461311, 0.594836, 0.702597, 0.221724, -0.210965, -0.651974, 0.14686, 0.663725, 0.751246, 0.977861, 0.642318, 0.958574, 0.122342, 0.738411, -0.281693, 0.915261, -0.617144, 0.0544348, 0.40787, -0.0712616, 0.194346, -0.644248, -0.711348, -0.858546, 0.0837033, -0.530857, -0.0585344, 0.0584818, -0.722023, 0.736585, 0.877311, -0.0964302, 0.558178, 0.837543, 0.434794, 0.205856, 0.208261, -0.000346195, -0.39793, -0.118019, 0.695652, -0.994376, 0.352251, -0.320536, -0.661471, 0.970786, -0.135992, 0.291298, -0.930636, -0.592796, 0.74548, -0.985209, 0.126986, -0.856279, 0.892479, -0.350259, 0.636176, -0.869772, -0.166401, -0.961369, -0.280473, 0.563043, 0.0177965, -0.145722, 0.880109, 0.838794, 0.971405, -0.340833, 0.691237, -0.203818, 0.244275, -0.585238, -0.52666, 0.74224, -0.726259, -0.0726466, -0.69934, 0.395013, -0.347909, 0.484982, -0.827808, -0.0658882, -0.208081, -0.45089, -0.64016, -0.536733, 0.0245522, 0.266187, -0.0593169, 0.978448, -0.744681, -0.881179, 0.300508, -0.531802, 0.520762, -0.642036, -0.705417, -0.237407, 0.487897, 0.666886, -0.223686, 0.822946, 0.178695, 0.164078, 0.979286, 0.681399, -0.0470325, 0.980469, 0.485511, 0.445107, -0.974848, 0.509946, -0.165726, 0.15155, 0.931726, 0.68553, -0.863092, -0.859217, -0.986428, 0.683086, 0.569733, -0.892742, 0.491002, -0.328368, -0.87207, 0.522959, -0.546917, -0.209346, 0.885174, -0.621186, 0.125012, -0.499306, -0.204864, -0.841539, -0.319045, 0.447015, -0.83778, 0.275451, 0.786171, 0.507885, 0.437665, -0.8735, 0.616692, -0.121518, 0.577305, 0.483018, 0.394669, -0.832204, -0.455838, -0.659441, 0.688597, 0.287648, 0.345831, 0.0568163, 0.220583, 0.229857, 0.747097, -0.0780942, 0.788661, -0.203091, 0.0345553, 0.336651, 0.842922, 0.538399, 0.342365, -0.6265, -0.408852, 0.586856, -0.909422, 0.417763, 0.54335, -0.64657, 0.941431, 0.228758, 0.360418, -0.768023, -0.311307, -0.860118, 0.826571, -0.0627872, 0.0513497, -0.636662, -0.631869, -0.066409, -0.923127, -0.508976, 0.933059, 0.383951, 0.384979, -0.59862, -0.387092, -0.762416, -0.526946, -0.798703, -0.458338, 0.764068, 0.300874, -0.749749, -0.612802, -0.859569, 0.0165357, -0.761881, 0.554794, -0.499614, 0.323706, -0.86883, -0.58743, 0.817687, -0.0821871, -0.151472, -0.099544, 0.209118, 0.0828003, -0.285029, -0.426969, 0.925531, -0.644956, -0.689216, -0.898308, 0.41457, -0.462744, 0.680338, -0.401913, 0.818061, -0.691107, -0.368668, 0.759099, 0.535026, 0.482227, 0.513032, -0.407404, 0.230333, -0.621951, -0.123944, 0.262135, 0.419165, 0.0780935, -0.609577, -0.716868, -0.527916, 0.0571442, -0.908746, -0.310198, 0.8043, 0.25153, -0.801078, -0.909216, 0.121843, -0.262513, 0.541023, 0.0856356, -0.881962, -0.495057, -0.897375, 0.0310718, -0.344702, -0.700179, 0.952229, -0.779608, -0.928809, -0.121649, -0.0773514, 0.234495, -0.59986, -0.404297, 0.0550456, 0.349497, -0.404361, 0.781785, -0.817007, -0.91732, -0.306186, -0.157088, -0.697229, -0.458068, -0.724051, -0.964608, -0.676788, -0.751801, 0.65203, 0.557237, -0.150917, -0.428348, -0.0972601, -0.996122, -0.811626, -0.779743, 0.719666, 0.341639, -0.144053, 0.0492299, -0.612822, -0.443771, -0.463363, -0.00825108, 0.684213, -0.836498, -0.737038, 0.0830523, -0.867149, -0.0260334, 0.695708, 0.608586, -0.28741, 0.221917, -0.871354, -0.962267, -0.232744, 0.113021, 0.0574188, -0.297085, 0.714328, -0.673949, 0.990776, -0.939864, -0.199115, -0.787385, -0.343253, -0.936284, 0.860734, -0.823236, 0.327234, -0.580524, 0.140072, -0.146768, 0.871893, -0.513549, -0.605948, -0.486447, 0.0286207, 0.857653, -0.290583, 0.398743, 0.413149, 0.702519, -0.371279, 0.355315, -0.516517, 0.649119, 0.630042, -0.524853, -0.74117, -0.973193, -0.761368, 0.966011, -0.404838, 0.19012, 0.948323, -0.0707753, 0.638167, -0.576349, -0.819131, 0.557658, 0.570178, 0.346413, -0.261739, -0.14924, 0.589668, 0.978821, -0.870542, 0.739869, -0.567789, -0.65367, -0.656454, 0.406474, -0.62947, 0.259035, 0.364854, -0.264666, 0.378366, 0.229467, -0.715546, 0.317371, 0.0883661, 0.679804, -0.426396, 0.568034, 0.0691094, -0.642789, -0.57705, 0.318544, 0.0537529, -0.304517, 0.325485, 0.7362, 0.837556, 0.0517449, 0.853971, 0.400418, -0.177248, 0.947382, -0.126312, -0.982665, -0.697488, 0.72607, -0.2085, 0.317165, -0.435627, -0.379837, -0.763364, 0.896323, 0.405138, -0.819951, 0.800022, -0.792117, 0.267167, -0.790361, 0.366156, 0.721351, 0.584155, -0.824622, 0.0140079, 0.711042, 0.00500805, 0.906623, 0.93205, -0.580474, 0.808733, 0.751287, -0.146822, 0.0743045, -0.497959, 0.155609, -0.669961, -0.803142, -0.794063, 0.29569, 0.624506, 0.364845, 0.921286, -0.0802466, -0.994457, -0.0348513, -0.529617, 0.526913, 0.817702, 0.149371, 0.793962, 0.0362686, -0.323651, 0.498406, -0.0226088, -0.0556198, -0.904485, -0.777238, 0.100352, -0.762279, 0.128043, 0.322493, -0.144486, 0.408134, -0.749843, -0.914774, -0.267993, -0.0462737, -0.303135, -0.148338, -0.538601, -0.0645444, 0.20556, -0.0267247, 0.24232, -0.119632, 0.38659, 0.986075, -0.528254, 0.244652, -0.847219, 0.350521, 0.218437, 0.0289872, -0.789828, -0.23029, -0.574634, -0.487033, -0.406645, -0.913748, 0.765365, 0.641312, -0.196376, -0.41104, -0.101787, 0.208582, 0.0448172, 0.350708, 0.721359, 0.799285, 0.23602, 0.989394, -0.219105, 0.614749, 0.973723, -0.437196, -0.863739, 0.847066, 0.389076, -0.562294, 0.921744, 0.595043, 0.776127, -0.970771, 0.102176, -0.361758, 0.900975, 0.753578, 0.0622816, -0.199129, -0.217055, 0.655849, 0.0431288, 0.241248, -0.448095, -0.732251, -0.0757334, 0.925863, 0.1542, -0.497621, -0.487541, 0.737729, 0.788939, -0.0284964, -0.47518, 0.697177, 0.0956237, 0.362729, -0.0548425, -0.597342, -0.156962, -0.543955, 0.370242, 0.798848, 0.209797, -0.0331304, -0.31467, -0.977755, -0.215417, -0.491534, 0.609177, -0.745786, 0.960052, -0.213792, 0.0684631, -0.61238, 0.221915, 0.0600916, -0.38396, -0.729533, -0.22236, 0.0853881, -0.195448, -0.576974, 0.582174, 0.806043, 0.640317, -0.891312, 0.0839871, -0.892065, 0.729448, 0.530345, 0.340878, -0.115438, 0.705395, 0.279589, -0.929337, 0.733557, -0.796183, -0.426226, -0.243529, -0.670899, -0.041948, 0.361969, 0.33966, -0.939815, 0.571187, -0.327644, 0.970901, 0.585941, 0.95116, 0.497938, -0.847149, 0.583775, 0.322538, 0.952802, 0.11502, -0.0737152, 0.931591, -0.72096, 0.824046, 0.969746, -0.896042, 0.09394, 0.959793, 0.204017, -0.349445, -0.841286, -0.285817, -0.252379, 0.827486, 0.618176, 0.565052, -0.983368, 0.129988, 0.762214, -0.161876, -0.0613026, 0.481262, 0.247153, 0.594866, 0.111035, -0.206128, -0.850403, 0.582309, -0.335459, 0.039309, -0.671739, -0.328606, 0.097058, -0.390744, -0.689306, 0.703208, -0.216886, 0.731907, 0.666583, 0.0315045, 0.466623, 0.185456, -0.0240145, -0.182989, 0.243952, 0.787229, -0.0470477, 0.763311, 0.34819, -0.983973, 0.701228, 0.981981, 0.821696, -0.838224, -0.941676, -0.0403976, -0.575057, -0.261626, -0.442715, 0.874328, -0.254413, 0.721688, 0.0078833, -0.229703, 0.998253, 0.355563, -0.122719, 0.806158, 0.476535, -0.77195, -0.758172, 0.554067, 0.364383, -0.74663, -0.800764, 0.19746, 0.906039, 0.757537, 0.109881, -0.149264, -0.949734, -0.39129, 0.860576, -0.715338, -0.977546, 0.797094, 0.411665, 0.074239, -0.25091, -0.109769, 0.353388, 0.788038, -0.0076623, -0.718371, 0.393796, -0.910783, -0.522792, 0.539774, 0.265827, -0.30128, 0.10275, 0.893307, -0.25122, 0.00673594, -0.801825, -0.490449, -0.722013, -0.786153, -0.606188, 0.743876, 0.404956, 0.555231, -0.162562, 0.00411846, -0.361242, 0.0154261, -0.143646, -0.361012, 0.172572, 0.103797, 0.349147, 0.756957, 0.100094, -0.529728, -0.206544, 0.657337, 0.0590773, 0.300886, -0.139443, 0.512289, 0.408428, -0.166363, -0.582025, -0.8425, 0.988107, -0.518658, 0.678768, 0.673026, 0.720638, 0.184944, 0.841496, -0.421468, 0.744292, -0.870802, 0.923266, -0.905356, 0.17694, 0.0663663, 0.38283, 0.657267, 0.48565, -0.111842, 0.58253, -0.211482, 0.776405, -0.817991, 0.604147, -0.686731, -0.0625097, 0.76588, 0.983471, -0.725239, 0.641285, 0.585864, -0.50399, 0.602041, 0.326559, -0.730139, 0.178701, 0.95004, -0.555639, -0.775126, -0.253846, 0.0995508, -0.371246, -0.0233377, -0.941062, -0.371935, -0.794361, -0.916155, 0.238839, 0.625171, 0.467602, 0.930772, 0.660462, -0.415505, -0.351621, 0.308361, 0.716165, 0.161762, -0.639303, -0.495817, -0.523065, -0.973498, -0.145144, 0.19603, -0.613804, -0.409491, 0.991182, -0.525868, 0.321407, -0.242469, -0.361541, -0.304109, -0.0276569, 0.476453, -0.78374, 0.588116, -0.71911, -0.656298, 0.969678, 0.0754994, -0.852889, 0.576375, -0.962715, -0.372201, -0.89164, -0.99419, -0.288101, 0.982809, 0.659051, -0.267185, 0.27647, -0.852404, 0.103089, 0.25849, -0.699505, -0.482975, -0.592301, 0.926407, 0.462457, 0.837552, -0.908703, 0.94181, -0.643088, 0.971814, -0.191731, 0.22424, 0.937569, 0.0925991, -0.795522, -0.345709, 0.0780493, -0.119367, 0.702779, -0.128088, -0.464629, -0.711441, -0.125735, 0.881843, -0.922555, -0.559042, -0.410026, -0.885858, 0.689155, -0.145297, 0.597922, -0.901102, -0.228073, -0.79268, -0.958831, 0.0972183, -0.37637, 0.796151, -0.404061, 0.58571, 0.218526, -0.211402, 0.0987585, 0.131734, -0.0597639, -0.421452, -0.155075, 0.599628, -0.287314, 0.255113, 0.319366, -0.798027, 0.87012, -0.639318, 0.152168, -0.0514392, 0.0399393, 0.869575, -0.583144, -0.687758, 0.750491, 0.58225, -0.937152, 0.745766, 0.340206, 0.0251771, -0.253613, -0.845668, 0.395465, -0.995123, 0.117416, 0.841641, -0.110016, 0.565009, -0.846048, -0.717975, 0.992063, -0.972131, -0.587921, 0.160058, 0.266256, -0.271484, 0.338144, 0.755852, -0.00700684, 0.595667, 0.246472, -0.496556, -0.805754, 0.988669, -0.349452, 0.930977, 0.68783, 0.0714229, 0.0844639, 0.994744, 0.613904, -0.192049, 0.115578, 0.411327, -0.41192, 0.903497, -0.0548879, 0.452085, 0.596449, 0.581607, 0.444633, -0.976306, -0.35723, -0.136861, 0.0175143, -0.527154, -0.497209, -0.0340041, 0.32908, -0.270607, -0.892217, 0.926944, 0.603255, -0.990695, 0.330762, -0.367106, -0.387938, -0.160654, -0.817028, 0.517144, 0.916932, -0.156698, -0.136382, 0.293579, 0.262221, -0.214782, -0.836023, -0.250321, 0.691771, -0.817584, 0.194077, 0.700271, -0.328155, -0.0967125, 0.551504, -0.139731, 0.778099, -0.326145, -0.851292, -0.0389589, -0.661007, 0.0102504, 0.236299, -0.834281, -0.98258, 0.166865, -0.452647, 0.82929, -0.566607, 0.631207, 0.132205, 0.820509, 0.163127, 0.360672, 0.754843, -0.850283, -0.92816, -0.907629, 0.745008, 0.610181, 0.44056, -0.122871, 0.157638, -0.628299, -0.954755, -0.722424, 0.880509, -0.517457, 0.288685, 0.95297, 0.26094, -0.717205, -0.00868142, 0.571582, -0.966871, 0.875077, 0.571557, -0.993706, 0.64154, -0.457313, 0.724335, -0.320772, 0.811285, -0.884624, 0.494256, 0.985867, -0.0386699, -0.0101791, 0.0180394, 0.481787, 0.172525, -0.654346, 0.476766, 0.623024, -0.553707, -0.1388, -0.280482, 0.101526, -0.0880616, -0.109302, -0.530136, -0.334127, 0.689225, -0.298857, 0.813264, 0.931864, 0.0476888, 0.212757, -0.871797, 0.801952, 0.943307, -0.947234, 0.348444, -0.566402, -0.259062, -0.0524404, -0.707145, 0.651824, 0.231401, -0.125209, 0.812057, -0.465757, -0.38431, -0.87842, -0.586783, 0.4584, -0.773196, -0.875849, -0.19382, 0.600014, -0.921352, 0.69459, 0.762997, 0.00909552, -0.111906, -0.319908, 0.478481, 0.988643, 0.133373, -0.104744, 0.6308, 0.216724, -0.850738, 0.588072, 0.187014, -0.274151, 0.211757, -0.711533, -0.795687, 0.0881866, 0.22795, -0.766364, 0.66182, 0.943995, 0.590132, -0.742673, -0.895399, -0.472963, -0.71529, 0.709258, -0.369706, -0.706208, -0.369335, -0.237847, 0.000983967, 0.090203, 0.132724, 0.460886, -0.937975, 0.917672, -0.208059, 0.17137, 0.230542, -0.385618, 0.0592408, 0.442325, -0.318434, 0.624475, 0.218004, 0.112832, -0.644567, -0.354512, 0.445538, 0.861421, 0.676437, 0.470777, 0.242875, -0.295752, 0.682547, -0.599981, 0.388393, 0.382043, -0.107328, -0.949424, -0.0492661, 0.685565, -0.220322, -0.528584, -0.304099, -0.406972, 0.775948, -0.700725, 0.958828, -0.378255, -0.955671, 0.594433, -0.157869, -0.75452, -0.472936, -0.546161, -0.378027, -0.517542, -0.976275, 0.234288, -0.320147, -0.887483, 0.186709, -0.292373, -0.927083, -0.620655, 0.137338, -0.0580354, -0.0316077, -0.109036, -0.0286403, -0.0324961, -0.0409905, 0.880294, 0.604058, -0.944142, -0.517727, 0.639804, 0.363974, -0.267666, 0.653642, -0.641164, 0.941777, 0.510761, 0.210624, -0.300717, -0.601608, 0.977257, 0.573434, 0.619887, 0.67346, 0.25875, 0.178824, 0.226419, -0.68299, -0.750093, 0.814568, -0.774238, 0.447994, 0.586913, 0.896223, 0.113732, 0.362233, 0.260612, 0.611774, -0.623709, 0.575544, 0.540746, -0.808759, 0.379567, 0.808655, -0.63404, -0.48996, 0.596487, 0.0373269, -0.332158, 0.634749, -0.0371085, -0.00279087, 0.598323, 0.829918, 0.161383, -0.452377, 0.623432, -0.891106, -0.478038, -0.378457, 0.77334, 0.925341, -0.357115, 0.925631, -0.0045614, -0.363884, -0.159114, 0.289765, 0.728772, 0.708518, -0.909149, 0.43456, -0.257231, 0.848384, 0.0898377, -0.238244, 0.515838, -0.618799, 0.9438, -0.42464, 0.206124, -0.581005, 0.892288, -0.478576, 0.267476, 0.804537, -0.0102229, -0.393168, -0.9762, 0.105443, 0.933651, -0.456361, 0.517266, -0.922858, -0.577737, 0.358109, 0.00079804, -0.301258, -0.122172, -0.478179, 0.357256, 0.0600563, 0.0975956, 0.554033, 0.143981, 0.479033, -0.0452214, -0.74926, 0.245727, 0.0159597, 0.814647, 0.0413745, 0.646787, 0.271351, -0.52834, 0.292729, 0.608431, 0.529074, -0.88171, -0.23897, -0.917421, -0.720319, -0.552962, -0.233159, -0.503137, -0.811426, 0.944025, 0.760091, 0.792635, 0.322158, 0.400625, 0.560092, 0.256493, -0.761821, -0.7412, 0.891091, -0.0103123, 0.874774, 0.0330783, 0.770879, -0.776516, -0.758218, 0.543678, -0.153604, -0.80065, 0.375613, -0.430887, 0.0581891, 0.372471, -0.56538, -0.685364, -0.526302, -0.237308, 0.346868, 0.167919, 0.339627, -0.0689996, -0.191728, -0.34987, 0.200603, 0.605403, -0.0198406, 0.190118, -0.931116, 0.257116, 0.41657, 0.388537, -0.170649, 0.517906, -0.803802, -0.834682, 0.38887, 0.646388, 0.745964, -0.327178, 0.363377, 0.105076, 0.515005, 0.389791, -0.592125, -0.359919, -0.400725, -0.548956, -0.387245, 0.600094, 0.784449, 0.578559, 0.0396498, 0.738719, -0.828562, -0.325184, -0.675263, 0.7796, -0.150844, -0.511172, 0.110711, -0.0685852, 0.27341, 0.751514, -0.0668817, 0.0263008, -0.588178, -0.237557, 0.760835, 0.974851, 0.948121, -0.899, 0.385023, 0.0264062, -0.564321, 0.457144, 0.287448, 0.413923, -0.672627, 0.588679, -0.508944, 0.323206, 0.313528, -0.373527, -0.190153, -0.892193, 0.863252, 0.26015, -0.771286, 0.901921, 0.024849, 0.364476, -0.0601543, -0.421754, 0.856467, 0.525166, -0.337024, -0.809092, 0.606026, -0.0612521, -0.293429, -0.177307, -0.712089, 0.535631, -0.0989521, -0.535094, 0.506647, -0.35164, -0.403323, 0.392742, -0.0450784, 0.271475, 0.200791, -0.227756, -0.708784, -0.624504, 0.483614, 0.212056, -0.894528, 0.684606, 0.42201, 0.20617, -0.851211, 0.361912, 0.655328, 0.260154, -0.0165717, -0.241582, 0.154899, 0.135869, -0.947994, -0.462876, 0.550623, -0.0664284, 0.0896834, 0.324625, 0.296654, 0.889867, -0.637154, 0.605912, -0.814444, 0.0507021, -0.835082, 0.970409, -0.14027, -0.0891691, 0.697983, -0.7463, -0.00670957, 0.900543, -0.251965, -0.933454, 0.684284, -0.854685, 0.856782, -0.672691, -0.277072, -0.27224, 0.883441, -0.465107, -0.209877, -0.719158, 0.854563, -0.872992, 0.841828, -0.966919, -0.0301493, -0.0111534, -0.169873, 0.532824, 0.63771, 0.436617, -0.426335, 0.440477, 0.965241, 0.328178, -0.758348, 0.745413, 0.217875, 0.522354, -0.622545, 0.31069, -0.612335, 0.363036, 0.347368, -0.0274055, 0.911715, 0.118831, 0.293896, 0.0443066, -0.754393, -0.908472, 0.380193, 0.0658503, -0.217645, -0.127994, -0.178836, -0.269887, -0.948335, -0.486511, -0.270593, -0.218354, 0.940975, 0.557064, 0.745767, 0.540314, 0.0541797, 0.935928, -0.586218, 0.0408851, -0.0806119, 0.064539, 0.435595, -0.437168, 0.681545, -0.0972116, -0.699219, -0.893494, 0.205141, -0.389192, -0.730282, -0.299361, 0.517059, -0.797738, 0.433459, 0.713073, -0.267998, 0.987051, 0.607541, -0.369587, -0.45022, 0.336613, 0.299639, 0.150916, -0.567461, -0.419371, -0.394765, 0.908567, 0.531405, -0.95009, -0.487415, -0.100941, -0.321704, -0.221445, 0.910628, -0.399855, -0.380832, -0.632194, 0.394762, -0.156143, 0.0540532, -0.786011, 0.537936, 0.455858, 0.399796, -0.724606, 0.112612, 0.90676, 0.394683, 0.455263, 0.648152, -0.209739, 0.852658, 0.75183, -0.959884, -0.727399, -0.499152, -0.0777318, -0.281422, 0.00686502, -0.284094, 0.165606, -0.590983, 0.667119, -0.0603824, 0.366942, -0.556199, 0.709699, 0.804138, -0.958067, 0.651275, -0.164506, 0.719651, 0.432787, -0.0311357, -0.517057, 0.269607, -0.164203, 0.34262, -0.211688, 0.949013, -0.38971, -0.140682, 0.18051, 0.959018, 0.017857, -0.749297, -0.150855, -0.571402, 0.305891, 0.255377, 0.419984, -0.326698, -0.00762801, -0.394267, -0.664879, 0.898967, 0.575526, -0.279739, -0.139274, -0.13739, -0.636928, -0.090097, -0.553097, -0.531038, -0.450713, -0.503788, -0.468508, -0.753973, -0.34381, -0.621697, -0.92818, 0.723809, -0.957376, 0.535795, -0.903557, -0.374154, 0.573564, 0.641042, -0.291683, 0.826538, -0.0622414, -0.195908, 0.868108, 0.481941, 0.477928, 0.638631, -0.257466, -0.689393, 0.711142, 0.357548, 0.552095, 0.257945, -0.151931, -0.887229, -0.829372, -0.175241, -0.791033, 0.227607, 0.615493, 0.0947145, -0.349821, 0.967011, 0.87529, -0.576744, 0.420667, 0.0397945, -0.871865, -0.0645026, -0.171225, 0.22495, 0.14243, 0.993771, 0.731729, 0.492798, 0.569505, -0.405277, -0.86656, -0.418547, -0.115344, -0.268842, -0.502328, 0.08859, 0.510228, 0.333282, -0.117217, 0.335012, -0.210164, -0.101781, 0.203053, -0.259156, 0.679546, -0.114955, -0.806025, -0.452209, -0.469937, -0.859936, 0.154806, 0.023272, 0.556508, -0.113056, -0.115929, 0.171936, 0.411898, 0.435927, 0.00100025, -0.560276, 0.664069, 0.0975958, -0.0166258, 0.664043, 0.290477, -0.788784, 0.275847, -0.589442, 0.742418, 0.92216, 0.538867, -0.234171, 0.757771, 0.360116, -0.424028, -0.186779, -0.446477, -0.703197, -0.152981, 0.702092, 0.24104, -0.0520552, 0.105167, 0.444235, -0.776422, -0.853991, -0.481274, 0.193972, -0.214426, 0.569607, -0.336725, -0.937931, 0.77968, -0.62156, 0.286348, -0.750394, 0.123928, -0.735786, -0.674802, 0.340673, 0.634642, 0.972046, 0.654772, -0.940564, -0.94468, -0.22865, -0.936408, 0.0152534, 0.782935, 0.688882, -0.0996817, -0.427259, -0.847837, 0.853504, 0.375648, -0.402663, -0.643839, 0.454613, -0.258439, 0.264915, 0.141752, 0.108806, -0.824054, 0.467885, -0.885093, 0.807023, -0.806343, 0.316747, 0.656666, 0.597528, 0.301106, -0.697246, -0.232078, 0.300066, 0.227191, 0.680752, 0.0661373, 0.0747937, -0.0159136, 0.447091, -0.41649, -0.373043, -0.727983, -0.49496, -0.254162, 0.894036, -0.420489, -0.450601, 0.118115, 0.851122, -0.613586, -0.609717, -0.869841, 0.84561, -0.210053, -0.0553403, 0.606089, 0.821689, 0.640078, 0.216315, 0.685941, -0.27199, -0.0731631, 0.952664, -0.0133971, 0.363509, -0.415491, -0.389786, 0.458506, 0.727903, 0.933085, 0.209037, 0.259112, 0.979416, 0.185179, -0.976787, -0.125192, 0.885118, 0.189493, -0.524419, -0.805247, 0.557639, -0.684158, -0.557262, 0.488872, -0.92918, -0.268572, 0.0322115, -0.458484, 0.992254, 0.363456, -0.42392, -0.710841, 0.72554, 0.29708, -0.838643, -0.700394, 0.286681, 0.873021, 0.992409, -0.885726, -0.754535, 0.851346, 0.912157, -0.871917, -0.482199, 0.833077, 0.397909, -0.150785, 0.327602, -0.723517, 0.733588, -0.625149, 0.0192956, 0.904333, 0.573646, 0.940539, -0.524607, -0.479682, -0.0707829, -0.992279, -0.41195, 0.58316, 0.108185, 0.765253, -0.00963945, -0.0275338, 0.376733, 0.199236, -0.658499, 0.366384, -0.202639, 0.724624, -0.913277, -0.0763745, -0.980453, 0.609644, -0.856607, 0.23446, 0.0456036, -0.999531, -0.700189, -0.34792, 0.321823, -0.474474, -0.195214, -0.632266, -0.436618, -0.199601, -0.830216, -0.870375, 0.514674, -0.842632, 0.775387, 0.892845, 0.23934, 0.212057, 0.420936, 0.536315, -0.0241985, 0.225252, 0.73453, 0.279704, 0.0470305, -0.132096, -0.69521, -0.335859, -0.696403, -0.610681, 0.546262, -0.487694, 0.522229, 0.298666, -0.171582, -0.111284, -0.287344, -0.550859, -0.78943, 0.565054, 0.439183, -0.667802, -0.714095, -0.849368, 0.964802, 0.690173, -0.697267, -0.278759, 0.481839, -0.516149, -0.321157, -0.760768, 0.702904, -0.0484774, 0.272795, 0.0831269, 0.743394, -0.310373, -0.62567, -0.586684, -0.223226, -0.829106, -0.763318, -0.681403, -0.341792, 0.386804, 0.751735, -0.981647, 0.162663, -0.883338, -0.68081, 0.355034, -0.0609263, 0.661359, -0.931771, -0.00593762, 0.450578, -0.806877, -0.862439, 0.139066, 0.915405, 0.29076, 0.848627, 0.211097, -0.378156, -0.0347448, 0.201339, 0.592994, 0.78706, -0.352844, 0.162871, -0.0187501, 0.339936, 0.570683, -0.689449, -0.705215, -0.334017, 0.358083, 0.297791, -0.856567, 0.896062, -0.760221, 0.402318, -0.470874, -0.381423, 0.356639, 0.693243, -0.392706, 0.255374, -0.0278053, 0.3507, -0.349379, -0.101131, -0.821553, 0.688386, 0.720367, 0.983701, -0.712144, -0.739765, -0.862544, -0.32012, -0.440837, 0.187299, -0.349957, -0.447425, -0.15294, -0.824176, 0.124273, -0.614609, 0.673431, 0.934296, -0.687632, 0.631169, -0.299594, 0.991065, -0.602768, -0.398954, -0.351548, -0.776611, 0.261837, 0.194163, 0.0409394, 0.841252, 0.091102, -0.297055, -0.926662, -0.00263949, -0.750338, 0.744462, 0.138108, 0.272531, 0.266412, -0.328871, -0.788577, 0.398479, -0.262036, -0.0979111, 0.368846, -0.288023, -0.286669, -0.51026, -0.578153, 0.373555, -0.54207, -0.714485, 0.68171, 0.0114006, -0.396277, -0.153103, -0.0246893, -0.0965393, -0.0909563, -0.917486, 0.16992, 0.970906, -0.743591, -0.798526, 0.7704, -0.600838, 0.535406, 0.891558, 0.053062, 0.17742, 0.837206, 0.318262, -0.356393, 0.977159, -0.210284, -0.764492, -0.411888, -0.675598, 0.100745, 0.0468653, -0.714793, -0.353197, 0.374259, 0.328377, -0.757446, 0.224587, -0.653008, 0.423854, -0.934694, 0.314901, 0.255557, -0.292698, 0.381712, -0.811104, 0.0634252, 0.523739, -0.309978, 0.776248, -0.850599, -0.21698, -0.243701, 0.449586, -0.142635, -0.425376, -0.568114, -0.124747, -0.536621, 0.173328, 0.4805, 0.458909, 0.162182, 0.416891, -0.714921, -0.64016, 0.277824, 0.0259079, 0.215196, 0.849589, -0.387672, 0.174534, -0.516299, 0.39395, 0.539943, -0.240492, 0.755512, 0.71434, 0.247271, 0.314182, 0.535464, -0.82847, 0.0817195, 0.270217, 0.419162, -0.00625063, 0.36647, -0.790692, -0.503196, -0.593696, -0.813038, -0.508228, -0.667019, 0.442542, 0.349513, 0.705564, 0.290857, -0.788694, 0.686548, 0.364443, 0.0581756, -0.775306, 0.51446, 0.994119, 0.239916, -0.727297, -0.19859, 0.882489, 0.193819, 0.981077, -0.91087, -0.0701046, -0.863514, -0.574514, 0.0202027, -0.948333, 0.872624, 0.376742, 0.275937, 0.802491, 0.627698, 0.761556, 0.774019, -0.0170719, 0.64157, 0.272589, -0.593589, -0.0550654, 0.798368, -0.731935, 0.429255, -0.545956, -0.565549, -0.821168, 0.900409, -0.522855, -0.498912, -0.337801, -0.576109, -0.807183, -0.793477, -0.124191, -0.0424915, -0.530124, 0.854434, -0.988669, -0.0710301, 0.607241, 0.480804, -0.861896, 0.304721, -0.449897, 0.590958, -0.246708, -0.439878, -0.0603123, 0.445596, 0.070049, -0.441169, 0.00678033, -0.427326, 0.339496, -0.243776, -0.439322, 0.93264, -0.862449, 0.223833, -0.714895, -0.918689, 0.552213, -0.239099, 0.93172, 0.290726, -0.433486, -0.101134, 0.935503, 0.491018, 0.716776, -0.977616, 0.713289, 0.832278, -0.00297957, -0.0838313, -0.836906, -0.654175, 0.663453, -0.38953, -0.864152, -0.0203046, 0.571119, 0.797626, -0.389864, 0.321551, 0.631549, -0.154956, 0.365933, 0.0488919, 0.456752, -0.344225, 0.633913, 0.662883, 0.49723, -0.720257, 0.782622, 0.841737, 0.461437, 0.242381, 0.463356, -0.2597, -0.994174, -0.966339, 0.597832, -0.189876, 0.835684, 0.380515, -0.306972, 0.527136, -0.405642, 0.815816, 0.519778, -0.670838, -0.207506, -0.407906, -0.174257, -0.0196559, 0.476003, 0.896773, -0.772138, 0.779973, 0.719831, 0.630073, -0.991722, -0.507072, 0.318389, -0.992575, -0.395533, -0.25333, 0.857482, -0.580922, -0.590819, -0.504118, -0.308087, -0.534795, -0.274225, -0.416456, 0.765349, 0.123185, -0.786252, -0.439211, -0.330155, -0.798533, 0.482345, -0.901503, -0.0103875, -0.977751, -0.910416, 0.838944, 0.788529, 0.301341, -0.0776772, 0.598133, 0.512091, -0.240003, 0.997665, -0.520345, -0.865622, 0.0277759, 0.662294, -0.127956, 0.680292, -0.00439815, 0.845099, -0.930604, 0.453644, 0.660273, 0.322876, 0.143939, -0.981392, 0.894372, -0.869343, 0.0866704, 0.411448, 0.825832, -0.293125, -0.721654, -0.412024, 0.231097, -0.0159854, -0.010135, -0.6484, 0.544324, 0.899914, -0.140925, 0.796005, -0.546008, 0.18277, -0.955438, 0.148237, -0.971314, 0.914602, 0.0367984, -0.00404438, 0.696637, -0.0114096, -0.847645, -0.0624403, -0.776232, -0.597169, -0.113335, 0.191113, 0.511542, -0.493627, -0.644544, -0.909794, -0.193619, -0.251635, 0.729723, 0.913682, 0.449937, 0.767671, 0.607936, 0.783014, 0.533658, -0.0131899, -0.561025, 0.303786, 0.536795, 0.514189, -0.210847, -0.478004, -0.770589, -0.241526, -0.391847, -0.37395, 0.481651, 0.209375, -0.492403, 0.016038, -0.492678, -0.273483, -0.604372, 0.684345, 0.453087, -0.00915779, 0.595004, 0.38657, -0.339575, 0.196401, -0.29005, -0.24326, 0.439619, -0.303513, -0.296998, 0.0406227, 0.596705, -0.564413, -0.226722, 0.0554177, 0.647707, -0.789624, -0.304884, 0.214871, 0.0611783, 0.776818, -0.359141, 0.583317, -0.251672, -0.836361, 0.232184, 0.0464478, -0.571401, 0.27383, -0.814363, 0.338227, -0.785071, 0.594204, -0.550559, -0.0416533, -0.653872, 0.184306, 0.292811, 0.703208, 0.278108, -0.509587, -0.372971, 0.172441, -0.105226, 0.609026, -0.503662, -0.354991, 0.63211, -0.042813, 0.776338, -0.0550023, -0.27414, -0.0759948, -0.324291, -0.246756, -0.560631, 0.617176, -0.154536, 0.0590175, -0.0914056, -0.414324, -0.875141, 0.567924, -0.950973, 0.415307, 0.490909, -0.393912, -0.776688, -0.160966, -0.847759, 0.888918, -0.188346, -0.695179, -0.835718, -0.841742, -0.423945, 0.42315, 0.532559, 0.418109, -0.0291113, 0.240867, -0.70488, -0.908269, 0.408185, 0.379481, -0.376752, 0.138498, -0.544626, -0.0163737, 0.701305, 0.503233, -0.6944, -0.33185, 0.151194, -0.382404, -0.569568, -0.263983, 0.577492, 0.498421, -0.563545, -0.499148, -0.183673, 0.665704, -0.161184, -0.190315, -0.757263, -0.959536, -0.81044, -0.537481, -0.30677, 0.129541, 0.838585, -0.747183, -0.180536, -0.0773889, 0.963384, 0.185795, 0.386598, 0.525104, -0.201081, 0.854206, -0.750144, -0.529357, 0.565789, -0.478101, -0.689583, 0.332522, -0.282905, -0.140409, 0.509352, -0.357549, 0.293452, -0.100492, -0.64585, 0.964642, 0.0157179, -0.200785, -0.0305224, -0.291758, -0.667659, 0.134609, 0.267746, -0.383907, -0.872988, -0.574828, 0.18356, 0.521693, -0.612548, 0.202763, 0.791508, 0.585927, 0.371819, -0.888208, 0.113066, -0.795383, -0.382804, -0.505098, -0.863208, -0.267958, 0.188665, 0.212328, 0.406006, -0.746502, 0.6061, -0.127378, 0.819616, -0.0866679, -0.586199, -0.122356, 0.135571, -0.0373717, -0.331776, -0.453433, 0.625228, -0.470278, -0.876498, -0.547124, 0.726737, -0.441747, -0.6211, -0.0123516, -0.804537, -0.521385, -0.916952, -0.94698, 0.662008, -0.252655, -0.657151, -0.207025, 0.55613, 0.461836, 0.0773522, 0.415759, -0.840418, 0.481246, 0.459839, 0.966702, 0.797471, 0.449659, 0.194096, 0.38207, 0.295401, 0.428728, 0.534285, 0.564569, 0.137232, -0.982977, 0.285161, -0.354025, 0.556819, -0.17218, 0.420186, -0.830659, -0.942169, 0.261233, -0.696693, -0.763189, 0.107738, -0.608712, -0.9919, 0.755649, 0.976748, -0.601259, 0.77662, 0.36155, -0.436053, -0.219367, -0.736536, 0.278442, 0.184831, 0.853091, 0.681777, -0.0973307, 0.969947, -0.431575, -0.529594, 0.265595, 0.118868, 0.195352, -0.160566, -0.0800865, -0.948348, -0.0442104, 0.699319, 0.0602761, -0.213224, -0.996451, -0.242573, -0.818305, -0.0650305, -0.0451426, 0.177439, -0.267747, -0.956582, 0.353082, -0.528461, 0.478334, 0.0337983, 0.398784, 0.229894, 0.597719, -0.685981, -0.984836, 0.0103334, 0.56878, 0.733201, -0.033978, 0.156848, 0.89559, 0.237825, -0.231755, 0.902387, 0.429488, 0.119257, 0.260036, -0.339694, -0.343478, -0.474511, -0.169724, -0.0409786, 0.110077, -0.959399, -0.537947, 0.256726, -0.370952, 0.615916, 0.174076, -0.330476, 0.967965, 0.696297, -0.50761, 0.423302, -0.388829, -0.0503934, -0.153886, -0.53958, 0.445298, 0.0210943, -0.896697, 0.608548, -0.24475, -0.0120265, 0.11041, -0.737327, -0.85824, -0.26946, -0.74288, 0.280316, -0.228466, -0.255423, -0.278928, 0.72492, -0.580064, 0.0200731, 0.450918, 0.623035, 0.51042, 0.526809, 0.291482, -0.938703, 0.254797, -0.817252, 0.402642, 0.868044, -0.84368, 0.210325, -0.221853, -0.0398784, -0.0404736, -0.748658, 0.5218, -0.676386, 0.786691, -0.596154, -0.0508388, -0.265754, -0.898062, 0.220332, -0.978527, 0.117404, 0.902375, 0.660609, -0.0090525, 0.00468379, 0.170367, 0.075127, -0.192474, 0.057776, 0.692048, 0.772314, 0.0996464, -0.307943, -0.851441, -0.115341, 0.449387, -0.930071, 0.72716, -0.844075, -0.670033, 0.883483, -0.453747, -0.713585, 0.20577, -0.255817, 0.896354, -0.766841, 0.375131, -0.0468594, -0.764438, -0.870534, -0.620644, 0.445447, -0.722562, 0.857895}
-};